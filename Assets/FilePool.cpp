@@ -0,0 +1,286 @@
+#include "FilePool.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+FilePool::File::File(const File& other) {
+	_size = other._size;
+	_data = new char[_size];
+
+	memcpy((void*)_data, other._data, _size);
+}
+
+FilePool::File::File(File&& other) noexcept {
+	_size = other._size;
+	_data = other._data;
+	mapped = other.mapped;
+
+	other._size = 0;
+	other._data = nullptr;
+	other.mapped = false;
+}
+
+FilePool::File::~File() {
+	if(_data) {
+		if(mapped) {
+		#ifdef _WIN32
+			UnmapViewOfFile(_data);
+		#else
+			munmap((void*)_data, _size);
+		#endif
+		} else delete[] _data;
+		_data = nullptr;
+	}
+	_size = 0;
+	mapped = false;
+}
+
+FilePool::File& FilePool::File::operator=(const File& other) {
+	this->~File();
+
+	_size = other._size;
+	_data = new char[_size];
+
+	memcpy((void*)_data, other._data, _size);
+
+	return *this;
+}
+
+FilePool::File& FilePool::File::operator=(File&& other) noexcept {
+	this->~File();
+
+	_size = other._size;
+	_data = other._data;
+	mapped = other.mapped;
+
+	other._size = 0;
+	other._data = nullptr;
+	other.mapped = false;
+
+	return *this;
+}
+
+uint64_t FilePool::File::size() const {
+	return _size;
+}
+
+const char* FilePool::File::data() const {
+	return _data;
+}
+
+bool FilePool::File::ready() const {
+	// Check if _data is valid since it will be updated last, which avoids the need for a mutex
+	return _data != nullptr;
+}
+
+FilePool::File::operator bool() const {
+	return ready();
+}
+
+// Blocks until this file's data is ready
+void FilePool::File::wait() const {
+	while(true) {
+		if(ready()) return;
+
+		std::this_thread::yield();
+	}
+}
+
+void FilePool::File::close() {
+	this->~File();
+
+	_size = 0;
+	_data = nullptr;
+}
+
+// Blocks in flight at once and the largest read of a single block
+constexpr uint32_t RING_QUEUE_DEPTH = 64;
+constexpr uint32_t RING_BLOCK_SIZE = 1 << 20;
+
+FilePool::FilePool(bool useRing) {
+#ifdef __linux__
+	if(useRing) {
+		ring = new IORing(RING_QUEUE_DEPTH, RING_BLOCK_SIZE);
+		if(!ring->supported()) {
+			delete ring;
+			ring = nullptr;
+		}
+	}
+#endif
+}
+
+FilePool::~FilePool() {
+#ifdef __linux__
+	delete ring;
+#endif
+}
+
+void FilePool::readFile(const char* fileName, File& fileRef, const callback_type& callback) {
+	// Close the file ref first to free up memory
+	// and leave it in an empty state in case the lambda fails
+	fileRef.close();
+
+#ifdef __linux__
+	if(ring) {
+		ring->read(fileName,
+			[this, &fileRef, callback](char* data, uint64_t size) {
+				copiedBytes += size;
+
+				fileRef._size = size;
+				// Update this one last to avoid needing a mutex on ready()
+				fileRef._data = data;
+
+				if(callback) callback(fileRef);
+			}
+		);
+
+		return;
+	}
+#endif
+
+	threadPool.enqueueJob(
+		[this, fileName, &fileRef, callback]() {
+			std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+
+			if(file.is_open()) {
+				std::ifstream::pos_type size = file.tellg();
+				if(size != std::ifstream::pos_type(-1)) {
+					file.seekg(0);
+
+					char* data = new char[size];
+					file.read(data, size);
+					copiedBytes += size;
+
+					fileRef._size = size;
+					// Update this one last to avoid needing a mutex on ready()
+					fileRef._data = data;
+
+					if(callback) callback(fileRef);
+				}
+			}
+
+			// Destructor is called and file is closed
+		}
+	);
+}
+
+// Maps the whole file read-only, data is left null for empty files since they cannot be mapped
+static bool mapView(const char* fileName, const char*& data, uint64_t& size) {
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if(file == INVALID_HANDLE_VALUE) return false;
+
+	LARGE_INTEGER fileSize{};
+	if(!GetFileSizeEx(file, &fileSize)) {
+		CloseHandle(file);
+		return false;
+	}
+	size = fileSize.QuadPart;
+
+	if(size) {
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if(mapping) {
+			data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			// The view keeps the mapping and the file open
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(file);
+#else
+	int file = open(fileName, O_RDONLY);
+	if(file == -1) return false;
+
+	struct stat fileStat{};
+	if(fstat(file, &fileStat) == -1) {
+		close(file);
+		return false;
+	}
+	size = fileStat.st_size;
+
+	if(size) {
+		// MAP_POPULATE reads the whole file in up front
+		void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, file, 0);
+		if(mapping != MAP_FAILED) data = (const char*)mapping;
+	}
+
+	// The mapping keeps the file open
+	close(file);
+#endif
+
+	return !size || data;
+}
+
+// Faults every page of the view in so that the first reads do not stall on the disk
+static void prefaultView(const char* data, uint64_t size) {
+#ifdef _WIN32
+	WIN32_MEMORY_RANGE_ENTRY range{ (void*)data, (SIZE_T)size };
+	PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+	SYSTEM_INFO systemInfo{};
+	GetSystemInfo(&systemInfo);
+	uint64_t pageSize = systemInfo.dwPageSize;
+#else
+	madvise((void*)data, size, MADV_WILLNEED);
+
+	uint64_t pageSize = sysconf(_SC_PAGESIZE);
+#endif
+
+	// Volatile so that the reads are not optimized out
+	const volatile char* view = data;
+	for(uint64_t i = 0; i < size; i += pageSize)
+		(void)view[i];
+}
+
+void FilePool::mapFile(const char* fileName, File& fileRef, const callback_type& callback) {
+	// Close the file ref first to free up memory
+	// and leave it in an empty state in case the lambda fails
+	fileRef.close();
+
+	threadPool.enqueueJob(
+		[fileName, &fileRef, callback]() {
+			const char* data = nullptr;
+			uint64_t size = 0;
+			if(!mapView(fileName, data, size)) return;
+
+			if(data) prefaultView(data, size);
+
+			fileRef._size = size;
+			fileRef.mapped = data != nullptr;
+			// Update this one last to avoid needing a mutex on ready()
+			fileRef._data = data ? data : new char[0];
+
+			if(callback) callback(fileRef);
+		}
+	);
+}
+
+void FilePool::wait() {
+	threadPool.wait();
+#ifdef __linux__
+	if(ring) ring->wait();
+#endif
+}
+
+bool FilePool::usingRing() const {
+#ifdef __linux__
+	return ring != nullptr;
+#else
+	return false;
+#endif
+}
+
+uint64_t FilePool::getCopiedBytes() const {
+	return copiedBytes;
+}
\ No newline at end of file
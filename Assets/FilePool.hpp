@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include <ThreadPool.hpp>
+
+#include "IORing.hpp"
+
+/*
+readFile reads through io_uring where the kernel supports it, otherwise
+each read blocks a worker of the thread pool
+*/
+class FilePool {
+	RIN::ThreadPool threadPool;
+	std::atomic<uint64_t> copiedBytes = 0;
+#ifdef __linux__
+	IORing* ring = nullptr;
+#endif
+public:
+	class File {
+		friend FilePool;
+
+		uint64_t _size = 0;
+		const char* _data = nullptr;
+		bool mapped = false; // Set if _data is a read-only view of the file instead of a copy
+	public:
+		File() = default;
+		File(const File& other);
+		File(File&& other) noexcept;
+		~File();
+		File& operator=(const File& other);
+		File& operator=(File&& other) noexcept;
+		uint64_t size() const;
+		const char* data() const;
+		bool ready() const;
+		operator bool() const;
+		void wait() const;
+		void close();
+	};
+
+	// Called on the thread which finished the file once it is ready, it is
+	// not called if the file could not be read
+	typedef std::function<void(File&)> callback_type;
+
+	// If useRing is false, readFile always uses the thread pool
+	FilePool(bool useRing = true);
+	FilePool(const FilePool&) = delete;
+	~FilePool();
+	// fileName must stay valid until the file is ready
+	void readFile(const char* fileName, File& fileRef, const callback_type& callback = nullptr);
+	// Maps the file into memory instead of copying it, the pages are
+	// faulted in on the worker before the file becomes ready
+	void mapFile(const char* fileName, File& fileRef, const callback_type& callback = nullptr);
+	void wait();
+	// True if readFile goes through io_uring
+	bool usingRing() const;
+	// Bytes readFile has copied out of files
+	uint64_t getCopiedBytes() const;
+};
\ No newline at end of file
@@ -0,0 +1,282 @@
+#include "IORing.hpp"
+
+#ifdef __linux__
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+IORing::IORing(uint32_t queueDepth, uint32_t blockSize) :
+	queueDepth(queueDepth),
+	blockSize(blockSize)
+{
+	io_uring_params params{};
+	ring = (int)syscall(__NR_io_uring_setup, queueDepth, &params);
+	if(ring == -1) return;
+
+	sqMappingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+	cqMappingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	// Newer kernels share a single mapping between both rings
+	bool singleMapping = params.features & IORING_FEAT_SINGLE_MMAP;
+	if(singleMapping) sqMappingSize = cqMappingSize = std::max(sqMappingSize, cqMappingSize);
+
+	sqMapping = mmap(nullptr, sqMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+	if(sqMapping == MAP_FAILED) {
+		sqMapping = nullptr;
+		release();
+		return;
+	}
+
+	if(singleMapping) cqMapping = sqMapping;
+	else {
+		cqMapping = mmap(nullptr, cqMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+		if(cqMapping == MAP_FAILED) {
+			cqMapping = nullptr;
+			release();
+			return;
+		}
+	}
+
+	sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+	void* sqesMapping = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+	if(sqesMapping == MAP_FAILED) {
+		release();
+		return;
+	}
+
+	char* sq = (char*)sqMapping;
+	sqEntries = params.sq_entries;
+	sqHead = (uint32_t*)(sq + params.sq_off.head);
+	sqTail = (uint32_t*)(sq + params.sq_off.tail);
+	sqMask = *(uint32_t*)(sq + params.sq_off.ring_mask);
+	sqArray = (uint32_t*)(sq + params.sq_off.array);
+	sqes = (io_uring_sqe*)sqesMapping;
+
+	char* cq = (char*)cqMapping;
+	cqHead = (uint32_t*)(cq + params.cq_off.head);
+	cqTail = (uint32_t*)(cq + params.cq_off.tail);
+	cqMask = *(uint32_t*)(cq + params.cq_off.ring_mask);
+	cqes = (io_uring_cqe*)(cq + params.cq_off.cqes);
+
+	thread = std::thread(&IORing::work, this);
+}
+
+IORing::~IORing() {
+	if(thread.joinable()) {
+		{
+			// Even though this is atomic, the condition
+			// must be modified under the mutex
+			std::lock_guard<std::mutex> lock(mutex);
+			terminate = true;
+		}
+		// Condition variable notification should not be under the mutex
+		condition.notify_one();
+
+		thread.join();
+	}
+
+	release();
+}
+
+void IORing::release() {
+	if(sqes) munmap(sqes, sqesSize);
+	if(cqMapping && cqMapping != sqMapping) munmap(cqMapping, cqMappingSize);
+	if(sqMapping) munmap(sqMapping, sqMappingSize);
+	if(ring != -1) close(ring);
+
+	sqes = nullptr;
+	cqMapping = nullptr;
+	sqMapping = nullptr;
+	ring = -1;
+}
+
+void IORing::open(Request& request, std::queue<Block>& blocks) {
+	int file = ::open(request.fileName, O_RDONLY);
+	if(file == -1) {
+		--pending;
+		return;
+	}
+
+	struct stat fileStat{};
+	if(fstat(file, &fileStat) == -1) {
+		close(file);
+		--pending;
+		return;
+	}
+
+	// The whole file is read front to back, so let the kernel read ahead aggressively
+	posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+	uint64_t size = fileStat.st_size;
+	Read* read = new Read{ file, new char[size], size, 0, false, std::move(request.callback) };
+
+	for(uint64_t offset = 0; offset < size; offset += blockSize) {
+		blocks.push({ read, offset, (uint32_t)std::min<uint64_t>(blockSize, size - offset) });
+		++read->blocks;
+	}
+
+	if(!read->blocks) finish(read);
+}
+
+void IORing::finish(Read* read) {
+	close(read->file);
+
+	if(read->failed) delete[] read->data;
+	else read->callback(read->data, read->size);
+
+	delete read;
+	--pending;
+}
+
+void IORing::work() {
+	std::queue<Block> blocks; // Blocks which have not been submitted yet
+	std::vector<Request> opening;
+	// Blocks in flight are identified by their slot in the submission user data
+	std::vector<Block> slots(queueDepth);
+	std::vector<uint32_t> freeSlots;
+	for(uint32_t i = queueDepth; i > 0; --i)
+		freeSlots.push_back(i - 1);
+	// Entries in the submission queue which the kernel has not consumed yet, they are submitted again
+	uint32_t unsubmitted = 0;
+
+	while(true) {
+		bool terminating;
+		{
+			// Critical section
+			std::unique_lock<std::mutex> lock(mutex);
+			if(freeSlots.size() == queueDepth && blocks.empty()) {
+				condition.wait(lock,
+					[this]() {
+						return !requests.empty() || terminate;
+					}
+				);
+			}
+
+			terminating = terminate;
+
+			// Only open more files once the blocks already opened are nearly submitted,
+			// this bounds the number of files open at once
+			if(!terminating) {
+				while(!requests.empty() && blocks.size() < queueDepth) {
+					opening.push_back(std::move(requests.front()));
+					requests.pop();
+				}
+			}
+		}
+
+		for(Request& request : opening)
+			open(request, blocks);
+		opening.clear();
+
+		if(terminating) {
+			// Drop the blocks which have not been submitted, the kernel still owns the others
+			while(!blocks.empty()) {
+				Read* read = blocks.front().read;
+				blocks.pop();
+
+				read->failed = true;
+				if(!--read->blocks) finish(read);
+			}
+
+			if(freeSlots.size() == queueDepth) return;
+		}
+
+		// Fill the submission queue
+		uint32_t sqTailValue = *sqTail;
+		uint32_t sqHeadValue = std::atomic_ref<uint32_t>(*sqHead).load(std::memory_order_acquire);
+		uint32_t submitCount = 0;
+		while(!blocks.empty() && !freeSlots.empty() && sqTailValue - sqHeadValue < sqEntries) {
+			Block block = blocks.front();
+			blocks.pop();
+
+			// Skip the rest of a file once one of its blocks has failed
+			if(block.read->failed) {
+				if(!--block.read->blocks) finish(block.read);
+				continue;
+			}
+
+			uint32_t slot = freeSlots.back();
+			freeSlots.pop_back();
+			slots[slot] = block;
+
+			uint32_t index = sqTailValue & sqMask;
+			io_uring_sqe& sqe = sqes[index];
+			memset(&sqe, 0, sizeof(sqe));
+			sqe.opcode = IORING_OP_READ;
+			sqe.fd = block.read->file;
+			sqe.addr = (uint64_t)(block.read->data + block.offset);
+			sqe.len = block.length;
+			sqe.off = block.offset;
+			sqe.user_data = slot;
+			sqArray[index] = index;
+
+			++sqTailValue;
+			++submitCount;
+		}
+		std::atomic_ref<uint32_t>(*sqTail).store(sqTailValue, std::memory_order_release);
+
+		// Submit and wait for at least one completion if the kernel already has blocks in flight,
+		// blocks which are only being submitted now may not be consumed, so they are not waited on
+		uint32_t toSubmit = unsubmitted + submitCount;
+		uint32_t waitCount = queueDepth - (uint32_t)freeSlots.size() > toSubmit ? 1 : 0;
+		if(toSubmit || waitCount) {
+			int submitted = (int)syscall(__NR_io_uring_enter, ring, toSubmit, waitCount, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if(submitted == -1) {
+				submitted = 0;
+				if(errno != EINTR) std::this_thread::yield(); // The kernel is out of resources, try again later
+			}
+			unsubmitted = toSubmit - (uint32_t)submitted;
+		}
+
+		// Reap the completions
+		uint32_t cqHeadValue = *cqHead;
+		uint32_t cqTailValue = std::atomic_ref<uint32_t>(*cqTail).load(std::memory_order_acquire);
+		for(; cqHeadValue != cqTailValue; ++cqHeadValue) {
+			const io_uring_cqe& cqe = cqes[cqHeadValue & cqMask];
+			uint32_t slot = (uint32_t)cqe.user_data;
+			Block block = slots[slot];
+			freeSlots.push_back(slot);
+
+			if(cqe.res == -EINTR || cqe.res == -EAGAIN) {
+				blocks.push(block);
+				continue;
+			}
+
+			if(cqe.res <= 0) block.read->failed = true;
+			else if((uint32_t)cqe.res < block.length) {
+				// Short read, read the rest of the block
+				blocks.push({ block.read, block.offset + cqe.res, block.length - cqe.res });
+				continue;
+			}
+
+			if(!--block.read->blocks) finish(block.read);
+		}
+		std::atomic_ref<uint32_t>(*cqHead).store(cqHeadValue, std::memory_order_release);
+	}
+}
+
+bool IORing::supported() const {
+	return ring != -1;
+}
+
+void IORing::read(const char* fileName, const callback_type& callback) {
+	++pending;
+	{
+		// Critical section
+		std::lock_guard<std::mutex> lock(mutex);
+		requests.push({ fileName, callback });
+	}
+	// Condition variable notification should not be under the mutex
+	condition.notify_one();
+}
+
+void IORing::wait() {
+	while(pending)
+		std::this_thread::yield();
+}
+#endif
\ No newline at end of file
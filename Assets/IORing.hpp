@@ -0,0 +1,100 @@
+#pragma once
+
+#ifdef __linux__
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <linux/io_uring.h>
+
+/*
+Reads whole files asynchronously through io_uring
+
+Every read is submitted from a single thread, files are split into
+blocks of blockSize bytes and up to queueDepth blocks are in flight at
+once, so many files are read in parallel without parking a thread on
+each of them
+
+The callback of a read is called on the ring thread once the whole
+file has been read, it is not called if the file could not be read
+
+Thread Safety:
+IORing::supported is thread-safe
+IORing::read is thread-safe
+IORing::wait is thread-safe
+*/
+class IORing {
+public:
+	// Takes ownership of data, which was allocated with new[]
+	typedef std::function<void(char* data, uint64_t size)> callback_type;
+private:
+	struct Request {
+		const char* fileName;
+		callback_type callback;
+	};
+
+	struct Read {
+		int file;
+		char* data;
+		uint64_t size;
+		uint32_t blocks; // Blocks which have not completed yet
+		bool failed;
+		callback_type callback;
+	};
+
+	struct Block {
+		Read* read;
+		uint64_t offset;
+		uint32_t length;
+	};
+
+	const uint32_t queueDepth;
+	const uint32_t blockSize;
+
+	int ring = -1;
+	void* sqMapping = nullptr;
+	size_t sqMappingSize = 0;
+	void* cqMapping = nullptr;
+	size_t cqMappingSize = 0;
+	size_t sqesSize = 0;
+
+	uint32_t sqEntries = 0;
+	uint32_t* sqHead = nullptr;
+	uint32_t* sqTail = nullptr;
+	uint32_t sqMask = 0;
+	uint32_t* sqArray = nullptr;
+	io_uring_sqe* sqes = nullptr;
+	uint32_t* cqHead = nullptr;
+	uint32_t* cqTail = nullptr;
+	uint32_t cqMask = 0;
+	io_uring_cqe* cqes = nullptr;
+
+	bool terminate = false;
+	std::queue<Request> requests;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::atomic<uint32_t> pending = 0; // Reads which have been requested but not finished
+	std::thread thread;
+
+	void release();
+	void open(Request& request, std::queue<Block>& blocks);
+	void finish(Read* read);
+	void work();
+public:
+	IORing(uint32_t queueDepth, uint32_t blockSize);
+	IORing(const IORing&) = delete;
+	// Waits for the blocks in flight, reads which have not started are dropped
+	~IORing();
+	// False if the kernel does not support io_uring, in which case reads must not be made
+	bool supported() const;
+	// fileName must stay valid until the callback is called
+	void read(const char* fileName, const callback_type& callback);
+	// Blocks until every requested read has finished
+	void wait();
+};
+#endif
\ No newline at end of file
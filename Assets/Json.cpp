@@ -0,0 +1,240 @@
+#include "Json.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+const JsonValue* JsonValue::find(const char* key) const {
+	if(type != JSON_TYPE::OBJECT) return nullptr;
+
+	for(const std::pair<std::string, JsonValue>& member : members)
+		if(member.first == key) return &member.second;
+
+	return nullptr;
+}
+
+const JsonValue* JsonValue::at(size_t index) const {
+	if(type != JSON_TYPE::ARRAY || index >= elements.size()) return nullptr;
+	return &elements[index];
+}
+
+double JsonValue::getNumber(const char* key, double fallback) const {
+	const JsonValue* value = find(key);
+	return value && value->type == JSON_TYPE::NUMBER ? value->number : fallback;
+}
+
+const char* JsonValue::getString(const char* key, const char* fallback) const {
+	const JsonValue* value = find(key);
+	return value && value->type == JSON_TYPE::STRING ? value->string.c_str() : fallback;
+}
+
+struct JsonParser {
+	const char* data;
+	const char* end;
+
+	void skipWhitespace() {
+		while(data < end && (*data == ' ' || *data == '\t' || *data == '\n' || *data == '\r'))
+			++data;
+	}
+
+	bool match(const char* literal) {
+		const size_t length = strlen(literal);
+		if((size_t)(end - data) < length || memcmp(data, literal, length)) return false;
+
+		data += length;
+		return true;
+	}
+
+	static void appendUTF8(uint32_t codePoint, std::string& string) {
+		if(codePoint < 0x80) string += (char)codePoint;
+		else if(codePoint < 0x800) {
+			string += (char)(0xC0 | codePoint >> 6);
+			string += (char)(0x80 | (codePoint & 0x3F));
+		} else if(codePoint < 0x10000) {
+			string += (char)(0xE0 | codePoint >> 12);
+			string += (char)(0x80 | (codePoint >> 6 & 0x3F));
+			string += (char)(0x80 | (codePoint & 0x3F));
+		} else {
+			string += (char)(0xF0 | codePoint >> 18);
+			string += (char)(0x80 | (codePoint >> 12 & 0x3F));
+			string += (char)(0x80 | (codePoint >> 6 & 0x3F));
+			string += (char)(0x80 | (codePoint & 0x3F));
+		}
+	}
+
+	bool parseHex(uint32_t& value) {
+		if(end - data < 4) return false;
+
+		value = 0;
+		for(uint32_t i = 0; i < 4; ++i) {
+			const char c = *data++;
+			value <<= 4;
+			if(c >= '0' && c <= '9') value |= c - '0';
+			else if(c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+			else if(c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+			else return false;
+		}
+
+		return true;
+	}
+
+	bool parseString(std::string& string) {
+		// Skip the opening quote
+		++data;
+		while(data < end && *data != '"') {
+			if((uint8_t)*data < 0x20) return false;
+
+			if(*data != '\\') {
+				string += *data++;
+				continue;
+			}
+
+			if(++data == end) return false;
+			switch(*data++) {
+			case '"': string += '"'; break;
+			case '\\': string += '\\'; break;
+			case '/': string += '/'; break;
+			case 'b': string += '\b'; break;
+			case 'f': string += '\f'; break;
+			case 'n': string += '\n'; break;
+			case 'r': string += '\r'; break;
+			case 't': string += '\t'; break;
+			case 'u':
+			{
+				uint32_t codePoint;
+				if(!parseHex(codePoint)) return false;
+
+				// Surrogate pairs encode code points past the basic multilingual plane
+				if(codePoint >= 0xD800 && codePoint < 0xDC00) {
+					uint32_t low;
+					if(!match("\\u") || !parseHex(low) || low < 0xDC00 || low >= 0xE000) return false;
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				}
+
+				appendUTF8(codePoint, string);
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+
+		if(data == end) return false;
+		// Skip the closing quote
+		++data;
+		return true;
+	}
+
+	bool parseNumber(double& number) {
+		// strtod accepts more than JSON does, so check the grammar first
+		const char* start = data;
+		if(data < end && *data == '-') ++data;
+		if(data == end || *data < '0' || *data > '9') return false;
+		if(*data == '0') ++data;
+		else while(data < end && *data >= '0' && *data <= '9') ++data;
+
+		if(data < end && *data == '.') {
+			++data;
+			if(data == end || *data < '0' || *data > '9') return false;
+			while(data < end && *data >= '0' && *data <= '9') ++data;
+		}
+
+		if(data < end && (*data == 'e' || *data == 'E')) {
+			++data;
+			if(data < end && (*data == '+' || *data == '-')) ++data;
+			if(data == end || *data < '0' || *data > '9') return false;
+			while(data < end && *data >= '0' && *data <= '9') ++data;
+		}
+
+		// The data is not null terminated
+		const std::string text(start, data);
+		number = strtod(text.c_str(), nullptr);
+		return true;
+	}
+
+	bool parseValue(JsonValue& value, uint32_t depth) {
+		if(depth > JSON_MAX_DEPTH) return false;
+
+		skipWhitespace();
+		if(data == end) return false;
+
+		switch(*data) {
+		case 'n':
+			value.type = JSON_TYPE::NUL;
+			return match("null");
+		case 't':
+			value.type = JSON_TYPE::BOOLEAN;
+			value.boolean = true;
+			return match("true");
+		case 'f':
+			value.type = JSON_TYPE::BOOLEAN;
+			value.boolean = false;
+			return match("false");
+		case '"':
+			value.type = JSON_TYPE::STRING;
+			return parseString(value.string);
+		case '[':
+			value.type = JSON_TYPE::ARRAY;
+			++data;
+			skipWhitespace();
+			if(data < end && *data == ']') {
+				++data;
+				return true;
+			}
+
+			while(true) {
+				value.elements.emplace_back();
+				if(!parseValue(value.elements.back(), depth + 1)) return false;
+
+				skipWhitespace();
+				if(data == end) return false;
+				if(*data == ']') {
+					++data;
+					return true;
+				}
+				if(*data++ != ',') return false;
+			}
+		case '{':
+			value.type = JSON_TYPE::OBJECT;
+			++data;
+			skipWhitespace();
+			if(data < end && *data == '}') {
+				++data;
+				return true;
+			}
+
+			while(true) {
+				skipWhitespace();
+				if(data == end || *data != '"') return false;
+
+				value.members.emplace_back();
+				std::pair<std::string, JsonValue>& member = value.members.back();
+				if(!parseString(member.first)) return false;
+
+				skipWhitespace();
+				if(data == end || *data++ != ':') return false;
+				if(!parseValue(member.second, depth + 1)) return false;
+
+				skipWhitespace();
+				if(data == end) return false;
+				if(*data == '}') {
+					++data;
+					return true;
+				}
+				if(*data++ != ',') return false;
+			}
+		default:
+			value.type = JSON_TYPE::NUMBER;
+			return parseNumber(value.number);
+		}
+	}
+};
+
+bool parseJson(const char* data, uint64_t size, JsonValue& value) {
+	JsonParser parser{ data, data + size };
+	value = JsonValue();
+	if(!parser.parseValue(value, 0)) return false;
+
+	// Nothing but whitespace may follow the value
+	parser.skipWhitespace();
+	return parser.data == parser.end;
+}
\ No newline at end of file
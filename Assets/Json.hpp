@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+Minimal JSON parser for asset files such as glTF
+
+The whole document is parsed into a tree of JsonValues, numbers are kept
+as doubles, strings are unescaped to UTF-8 and members keep their order
+
+Thread Safety:
+parseJson is thread-safe
+*/
+
+enum class JSON_TYPE : uint8_t {
+	NUL,
+	BOOLEAN,
+	NUMBER,
+	STRING,
+	ARRAY,
+	OBJECT
+};
+
+struct JsonValue {
+	JSON_TYPE type = JSON_TYPE::NUL;
+	bool boolean = false;
+	double number = 0.0;
+	std::string string;
+	std::vector<JsonValue> elements;
+	std::vector<std::pair<std::string, JsonValue>> members;
+
+	// Returns nullptr if this is not an object or has no member with the key
+	const JsonValue* find(const char* key) const;
+	// Returns nullptr if this is not an array or index is out of range
+	const JsonValue* at(size_t index) const;
+
+	// Return fallback if the value is missing or has the wrong type
+	double getNumber(const char* key, double fallback) const;
+	const char* getString(const char* key, const char* fallback) const;
+};
+
+// Returns false if data is not valid JSON or nests deeper than JSON_MAX_DEPTH
+constexpr uint32_t JSON_MAX_DEPTH = 64;
+bool parseJson(const char* data, uint64_t size, JsonValue& value);
\ No newline at end of file
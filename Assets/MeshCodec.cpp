@@ -0,0 +1,310 @@
+#include "MeshCodec.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define MESH_CODEC_SSE2
+#include <emmintrin.h>
+#endif
+
+constexpr uint32_t GROUP_SIZE = 16;
+
+// Bytes of group data for each 2-bit group header
+constexpr uint32_t GROUP_DATA_SIZES[]{ 0, 4, 8, 16 };
+
+static uint8_t zigzag(uint8_t value) {
+	return (uint8_t)((value << 1) ^ (uint8_t)((int8_t)value >> 7));
+}
+
+static uint8_t unzigzag(uint8_t value) {
+	return (uint8_t)((value >> 1) ^ (uint8_t)-(value & 1));
+}
+
+static uint32_t getGroupCount(uint32_t vertexCount) {
+	return (vertexCount + GROUP_SIZE - 1) / GROUP_SIZE;
+}
+
+static uint32_t getHeaderSize(uint32_t groupCount) {
+	return (groupCount + 3) / 4;
+}
+
+static void encodeGroup(const uint8_t* values, std::vector<char>& data, uint8_t& header, uint32_t headerShift) {
+	uint8_t maxValue = *std::max_element(values, values + GROUP_SIZE);
+
+	uint32_t mode;
+	if(!maxValue) mode = 0;
+	else if(maxValue < 4) mode = 1;
+	else if(maxValue < 16) mode = 2;
+	else mode = 3;
+
+	header |= mode << headerShift;
+
+	switch(mode) {
+	case 1:
+		for(uint32_t i = 0; i < GROUP_SIZE; i += 4)
+			data.push_back((char)(values[i] | values[i + 1] << 2 | values[i + 2] << 4 | values[i + 3] << 6));
+		break;
+	case 2:
+		for(uint32_t i = 0; i < GROUP_SIZE; i += 2)
+			data.push_back((char)(values[i] | values[i + 1] << 4));
+		break;
+	case 3:
+		data.insert(data.end(), (const char*)values, (const char*)values + GROUP_SIZE);
+		break;
+	}
+}
+
+void encodeVertices(const char* vertices, uint32_t vertexCount, uint32_t stride, std::vector<char>& data) {
+	uint8_t last[MAX_VERTEX_STRIDE]{};
+	uint8_t values[VERTEX_BLOCK_SIZE];
+
+	for(uint32_t blockStart = 0; blockStart < vertexCount; blockStart += VERTEX_BLOCK_SIZE) {
+		const uint32_t blockCount = std::min(VERTEX_BLOCK_SIZE, vertexCount - blockStart);
+		const uint32_t groupCount = getGroupCount(blockCount);
+		const uint8_t* block = (const uint8_t*)vertices + (uint64_t)blockStart * stride;
+
+		for(uint32_t k = 0; k < stride; ++k) {
+			// The tail of the last group is padded with zero deltas
+			uint8_t previous = last[k];
+			for(uint32_t i = 0; i < groupCount * GROUP_SIZE; ++i) {
+				if(i < blockCount) {
+					uint8_t value = block[i * stride + k];
+					values[i] = zigzag((uint8_t)(value - previous));
+					previous = value;
+				} else values[i] = 0;
+			}
+			last[k] = previous;
+
+			const size_t headerStart = data.size();
+			data.resize(data.size() + getHeaderSize(groupCount));
+
+			for(uint32_t group = 0; group < groupCount; ++group) {
+				uint8_t header = (uint8_t)data[headerStart + group / 4];
+				encodeGroup(values + group * GROUP_SIZE, data, header, group % 4 * 2);
+				data[headerStart + group / 4] = (char)header;
+			}
+		}
+	}
+}
+
+// Decodes a column of zigzag deltas, returns nullptr if data runs out
+static const uint8_t* decodeColumn(const uint8_t* data, const uint8_t* end, uint32_t groupCount, uint8_t* values) {
+	const uint8_t* headers = data;
+	data += getHeaderSize(groupCount);
+	if(data > end) return nullptr;
+
+	for(uint32_t group = 0; group < groupCount; ++group) {
+		const uint32_t mode = headers[group / 4] >> (group % 4 * 2) & 0x3;
+		if(data + GROUP_DATA_SIZES[mode] > end) return nullptr;
+
+		uint8_t* groupValues = values + group * GROUP_SIZE;
+
+	#ifdef MESH_CODEC_SSE2
+		__m128i result;
+		switch(mode) {
+		case 0:
+			result = _mm_setzero_si128();
+			break;
+		case 1:
+		{
+			// Spread each 2-bit field into its own byte, then interleave them back into order
+			int32_t packed;
+			memcpy(&packed, data, sizeof(packed));
+			const __m128i mask = _mm_set1_epi8(0x3);
+			__m128i bits = _mm_cvtsi32_si128(packed);
+			__m128i bits0 = _mm_and_si128(bits, mask);
+			__m128i bits2 = _mm_and_si128(_mm_srli_epi32(bits, 2), mask);
+			__m128i bits4 = _mm_and_si128(_mm_srli_epi32(bits, 4), mask);
+			__m128i bits6 = _mm_and_si128(_mm_srli_epi32(bits, 6), mask);
+			result = _mm_unpacklo_epi16(_mm_unpacklo_epi8(bits0, bits2), _mm_unpacklo_epi8(bits4, bits6));
+			break;
+		}
+		case 2:
+		{
+			const __m128i mask = _mm_set1_epi8(0xF);
+			__m128i bits = _mm_loadl_epi64((const __m128i*)data);
+			__m128i low = _mm_and_si128(bits, mask);
+			__m128i high = _mm_and_si128(_mm_srli_epi16(bits, 4), mask);
+			result = _mm_unpacklo_epi8(low, high);
+			break;
+		}
+		default:
+			result = _mm_loadu_si128((const __m128i*)data);
+			break;
+		}
+		_mm_storeu_si128((__m128i*)groupValues, result);
+	#else
+		switch(mode) {
+		case 0:
+			memset(groupValues, 0, GROUP_SIZE);
+			break;
+		case 1:
+			for(uint32_t i = 0; i < GROUP_SIZE; ++i)
+				groupValues[i] = data[i / 4] >> (i % 4 * 2) & 0x3;
+			break;
+		case 2:
+			for(uint32_t i = 0; i < GROUP_SIZE; ++i)
+				groupValues[i] = data[i / 2] >> (i % 2 * 4) & 0xF;
+			break;
+		default:
+			memcpy(groupValues, data, GROUP_SIZE);
+			break;
+		}
+	#endif
+
+		data += GROUP_DATA_SIZES[mode];
+	}
+
+	return data;
+}
+
+bool decodeVerticesScalar(const char* data, uint64_t size, uint32_t vertexCount, uint32_t stride, char* vertices) {
+	if(stride > MAX_VERTEX_STRIDE) return false;
+
+	const uint8_t* current = (const uint8_t*)data;
+	const uint8_t* end = current + size;
+	uint8_t last[MAX_VERTEX_STRIDE]{};
+	uint8_t values[VERTEX_BLOCK_SIZE];
+
+	for(uint32_t blockStart = 0; blockStart < vertexCount; blockStart += VERTEX_BLOCK_SIZE) {
+		const uint32_t blockCount = std::min(VERTEX_BLOCK_SIZE, vertexCount - blockStart);
+		const uint32_t groupCount = getGroupCount(blockCount);
+		uint8_t* block = (uint8_t*)vertices + (uint64_t)blockStart * stride;
+
+		for(uint32_t k = 0; k < stride; ++k) {
+			current = decodeColumn(current, end, groupCount, values);
+			if(!current) return false;
+
+			uint8_t previous = last[k];
+			for(uint32_t i = 0; i < blockCount; ++i) {
+				previous += unzigzag(values[i]);
+				block[i * stride + k] = previous;
+			}
+			last[k] = previous;
+		}
+	}
+
+	return current == end;
+}
+
+#ifdef MESH_CODEC_SSE2
+// Rows become columns, 4 rounds of interleaving rows i and i + 8
+static void transpose(__m128i rows[16]) {
+	for(uint32_t round = 0; round < 4; ++round) {
+		__m128i interleaved[16];
+		for(uint32_t i = 0; i < 8; ++i) {
+			interleaved[i * 2] = _mm_unpacklo_epi8(rows[i], rows[i + 8]);
+			interleaved[i * 2 + 1] = _mm_unpackhi_epi8(rows[i], rows[i + 8]);
+		}
+		memcpy(rows, interleaved, sizeof(interleaved));
+	}
+}
+
+bool decodeVertices(const char* data, uint64_t size, uint32_t vertexCount, uint32_t stride, char* vertices) {
+	if(stride > MAX_VERTEX_STRIDE) return false;
+
+	// Columns are padded to a multiple of 16 with zero deltas so the padding bytes never change
+	const uint32_t paddedStride = (stride + 15) & ~15;
+	alignas(16) uint8_t columns[MAX_VERTEX_STRIDE][VERTEX_BLOCK_SIZE];
+	for(uint32_t k = stride; k < paddedStride; ++k)
+		memset(columns[k], 0, VERTEX_BLOCK_SIZE);
+
+	const uint8_t* current = (const uint8_t*)data;
+	const uint8_t* end = current + size;
+	__m128i last[MAX_VERTEX_STRIDE / 16];
+	for(__m128i& chunk : last)
+		chunk = _mm_setzero_si128();
+
+	const __m128i one = _mm_set1_epi8(1);
+	const __m128i low7 = _mm_set1_epi8(0x7F);
+
+	for(uint32_t blockStart = 0; blockStart < vertexCount; blockStart += VERTEX_BLOCK_SIZE) {
+		const uint32_t blockCount = std::min(VERTEX_BLOCK_SIZE, vertexCount - blockStart);
+		const uint32_t groupCount = getGroupCount(blockCount);
+		char* block = vertices + (uint64_t)blockStart * stride;
+
+		for(uint32_t k = 0; k < stride; ++k) {
+			current = decodeColumn(current, end, groupCount, columns[k]);
+			if(!current) return false;
+		}
+
+		// Transpose 16 columns by 16 vertices at a time, so each vertex's deltas
+		// are added to the previous vertex 16 bytes at a time
+		for(uint32_t group = 0; group < groupCount; ++group) {
+			const uint32_t groupStart = group * GROUP_SIZE;
+			const uint32_t groupVertexCount = std::min(GROUP_SIZE, blockCount - groupStart);
+
+			for(uint32_t k = 0; k < paddedStride; k += 16) {
+				__m128i rows[16];
+				for(uint32_t i = 0; i < 16; ++i)
+					rows[i] = _mm_load_si128((const __m128i*)(columns[k + i] + groupStart));
+				transpose(rows);
+
+				__m128i previous = last[k / 16];
+				for(uint32_t i = 0; i < groupVertexCount; ++i) {
+					// Unzigzag
+					__m128i value = rows[i];
+					__m128i sign = _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(value, one));
+					value = _mm_xor_si128(_mm_and_si128(_mm_srli_epi16(value, 1), low7), sign);
+
+					previous = _mm_add_epi8(previous, value);
+
+					char* vertex = block + (uint64_t)(groupStart + i) * stride + k;
+					if(k + 16 <= stride) _mm_storeu_si128((__m128i*)vertex, previous);
+					else {
+						// Do not write over the next vertex
+						alignas(16) char tail[16];
+						_mm_store_si128((__m128i*)tail, previous);
+						memcpy(vertex, tail, stride - k);
+					}
+				}
+				last[k / 16] = previous;
+			}
+		}
+	}
+
+	return current == end;
+}
+#else
+bool decodeVertices(const char* data, uint64_t size, uint32_t vertexCount, uint32_t stride, char* vertices) {
+	return decodeVerticesScalar(data, size, vertexCount, stride, vertices);
+}
+#endif
+
+void encodeIndices(const uint32_t* indices, uint32_t indexCount, std::vector<char>& data) {
+	uint32_t previous = 0;
+	for(uint32_t i = 0; i < indexCount; ++i) {
+		int32_t delta = (int32_t)(indices[i] - previous);
+		uint32_t value = (uint32_t)(delta << 1) ^ (uint32_t)(delta >> 31);
+		previous = indices[i];
+
+		while(value >= 0x80) {
+			data.push_back((char)((value & 0x7F) | 0x80));
+			value >>= 7;
+		}
+		data.push_back((char)value);
+	}
+}
+
+bool decodeIndices(const char* data, uint64_t size, uint32_t indexCount, uint32_t* indices) {
+	const uint8_t* current = (const uint8_t*)data;
+	const uint8_t* end = current + size;
+
+	uint32_t previous = 0;
+	for(uint32_t i = 0; i < indexCount; ++i) {
+		uint32_t value = 0;
+		for(uint32_t shift = 0;; shift += 7) {
+			if(current == end || shift > 28) return false;
+
+			uint8_t byte = *current++;
+			value |= (uint32_t)(byte & 0x7F) << shift;
+			if(!(byte & 0x80)) break;
+		}
+
+		previous += (value >> 1) ^ (uint32_t)-(int32_t)(value & 1);
+		indices[i] = previous;
+	}
+
+	return current == end;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/*
+Vertex and index buffer compression for mesh files
+
+Vertices are delta encoded byte by byte against the previous vertex,
+zigzag encoded and stored column by column in blocks of up to
+VERTEX_BLOCK_SIZE vertices, each column is split into groups of 16
+bytes which are bit packed to 0, 2, 4 or 8 bits, selected by a 2-bit
+header per group, so attributes which vary smoothly from one vertex to
+the next mostly pack down to 2 or 4 bits
+
+Indices are delta encoded against the previous index, zigzag encoded
+and stored as variable length integers, 7 bits per byte
+
+decodeVertices decodes with SSE2 where it is available, otherwise it
+is the same as decodeVerticesScalar
+
+Thread Safety:
+All functions are thread-safe
+*/
+
+constexpr uint32_t VERTEX_BLOCK_SIZE = 256;
+constexpr uint32_t MAX_VERTEX_STRIDE = 256;
+
+// Appends the encoded vertices to data
+void encodeVertices(const char* vertices, uint32_t vertexCount, uint32_t stride, std::vector<char>& data);
+// Returns false if data is not a valid encoding of vertexCount vertices
+bool decodeVertices(const char* data, uint64_t size, uint32_t vertexCount, uint32_t stride, char* vertices);
+bool decodeVerticesScalar(const char* data, uint64_t size, uint32_t vertexCount, uint32_t stride, char* vertices);
+
+// Appends the encoded indices to data
+void encodeIndices(const uint32_t* indices, uint32_t indexCount, std::vector<char>& data);
+// Returns false if data is not a valid encoding of indexCount indices
+bool decodeIndices(const char* data, uint64_t size, uint32_t indexCount, uint32_t* indices);
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "MeshCooker.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include <DirectXPackedVector.h>
+
+struct Vector3 {
+	float x, y, z;
+
+	Vector3 operator+(const Vector3& v) const { return { x + v.x, y + v.y, z + v.z }; }
+	Vector3 operator-(const Vector3& v) const { return { x - v.x, y - v.y, z - v.z }; }
+	Vector3 operator*(float s) const { return { x * s, y * s, z * s }; }
+};
+
+static float dot(const Vector3& a, const Vector3& b) {
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static Vector3 cross(const Vector3& a, const Vector3& b) {
+	return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+static float length(const Vector3& v) {
+	return sqrtf(dot(v, v));
+}
+
+// Returns the zero vector if v is too short to normalize
+static Vector3 normalize(const Vector3& v) {
+	const float l = length(v);
+	return l > 1e-20f ? v * (1.0f / l) : Vector3{};
+}
+
+static Vector3 getVector(const std::vector<float>& values, uint32_t index) {
+	return { values[index * 3], values[index * 3 + 1], values[index * 3 + 2] };
+}
+
+// Angle of the corner at a between b and c
+static float getCornerAngle(const Vector3& a, const Vector3& b, const Vector3& c) {
+	const Vector3 u = normalize(b - a), v = normalize(c - a);
+	return acosf(std::clamp(dot(u, v), -1.0f, 1.0f));
+}
+
+// Any unit vector perpendicular to n
+static Vector3 getPerpendicular(const Vector3& n) {
+	const Vector3 axis = fabsf(n.x) < 0.9f ? Vector3{ 1.0f, 0.0f, 0.0f } : Vector3{ 0.0f, 1.0f, 0.0f };
+	return normalize(cross(n, axis));
+}
+
+static std::vector<Vector3> getNormals(const ImportedMesh& mesh) {
+	const uint32_t vertexCount = mesh.vertexCount();
+	std::vector<Vector3> normals(vertexCount);
+	bool complete = mesh.normals.size() == vertexCount * 3;
+	if(complete) {
+		for(uint32_t i = 0; i < vertexCount; ++i) {
+			normals[i] = normalize(getVector(mesh.normals, i));
+			complete &= length(normals[i]) > 0.0f;
+		}
+	}
+	if(complete) return normals;
+
+	// Triangles are counter-clockwise until they are packed
+	std::vector<Vector3> generated(vertexCount);
+	for(size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+		const uint32_t* triangle = mesh.indices.data() + i;
+		const Vector3 p[3]{ getVector(mesh.positions, triangle[0]), getVector(mesh.positions, triangle[1]), getVector(mesh.positions, triangle[2]) };
+		const Vector3 normal = normalize(cross(p[1] - p[0], p[2] - p[0]));
+		for(uint32_t j = 0; j < 3; ++j)
+			generated[triangle[j]] = generated[triangle[j]] + normal * getCornerAngle(p[j], p[(j + 1) % 3], p[(j + 2) % 3]);
+	}
+
+	for(uint32_t i = 0; i < vertexCount; ++i) {
+		if(length(normals[i]) > 0.0f) continue;
+		normals[i] = normalize(generated[i]);
+		// Vertices which are not used by any triangle
+		if(length(normals[i]) == 0.0f) normals[i] = { 0.0f, 0.0f, 1.0f };
+	}
+
+	return normals;
+}
+
+static std::vector<Vector3> getTangents(const ImportedMesh& mesh, const std::vector<Vector3>& normals) {
+	const uint32_t vertexCount = mesh.vertexCount();
+	const bool hasTexCoords = mesh.texCoords.size() == vertexCount * 2;
+
+	std::vector<Vector3> tangents(vertexCount);
+	if(hasTexCoords) {
+		for(size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+			const uint32_t* triangle = mesh.indices.data() + i;
+			const Vector3 p[3]{ getVector(mesh.positions, triangle[0]), getVector(mesh.positions, triangle[1]), getVector(mesh.positions, triangle[2]) };
+			const float* t[3]{ mesh.texCoords.data() + triangle[0] * 2, mesh.texCoords.data() + triangle[1] * 2, mesh.texCoords.data() + triangle[2] * 2 };
+
+			// Solve for the direction in which u increases across the triangle
+			const Vector3 e1 = p[1] - p[0], e2 = p[2] - p[0];
+			const float du1 = t[1][0] - t[0][0], dv1 = t[1][1] - t[0][1];
+			const float du2 = t[2][0] - t[0][0], dv2 = t[2][1] - t[0][1];
+			const float determinant = du1 * dv2 - du2 * dv1;
+			if(fabsf(determinant) < 1e-20f) continue;
+
+			// Only the sign of the determinant matters once the tangent is normalized,
+			// mirrored texture coordinates still get the direction in which u increases
+			const Vector3 tangent = normalize((e1 * dv2 - e2 * dv1) * (determinant > 0.0f ? 1.0f : -1.0f));
+			for(uint32_t j = 0; j < 3; ++j) {
+				const Vector3& n = normals[triangle[j]];
+				// Project onto the plane of the vertex normal before weighting, as MikkTSpace does
+				const Vector3 projected = normalize(tangent - n * dot(n, tangent));
+				tangents[triangle[j]] = tangents[triangle[j]] + projected * getCornerAngle(p[j], p[(j + 1) % 3], p[(j + 2) % 3]);
+			}
+		}
+	}
+
+	for(uint32_t i = 0; i < vertexCount; ++i) {
+		const Vector3& n = normals[i];
+		const Vector3 tangent = normalize(tangents[i] - n * dot(n, tangents[i]));
+		tangents[i] = length(tangent) > 0.0f ? tangent : getPerpendicular(n);
+	}
+
+	return tangents;
+}
+
+// Normalizes the weights and rounds them to unorm8 so they still sum to 255
+static void packWeights(const float* weights, uint8_t* packed) {
+	float sum = 0.0f;
+	for(uint32_t i = 0; i < MAX_BONE_INFLUENCES; ++i)
+		sum += std::max(weights[i], 0.0f);
+
+	if(sum <= 0.0f) {
+		packed[0] = 255;
+		for(uint32_t i = 1; i < MAX_BONE_INFLUENCES; ++i)
+			packed[i] = 0;
+		return;
+	}
+
+	uint32_t total = 0;
+	float remainders[MAX_BONE_INFLUENCES];
+	for(uint32_t i = 0; i < MAX_BONE_INFLUENCES; ++i) {
+		const float scaled = std::max(weights[i], 0.0f) / sum * 255.0f;
+		packed[i] = (uint8_t)scaled;
+		remainders[i] = scaled - packed[i];
+		total += packed[i];
+	}
+
+	// Give what rounding down lost to the weights which lost the most
+	for(; total < 255; ++total) {
+		const uint32_t i = (uint32_t)(std::max_element(remainders, remainders + MAX_BONE_INFLUENCES) - remainders);
+		++packed[i];
+		remainders[i] = -1.0f;
+	}
+}
+
+static void storeHalf(char* vertex, uint32_t offset, float value) {
+	const DirectX::PackedVector::HALF half = DirectX::PackedVector::XMConvertFloatToHalf(value);
+	memcpy(vertex + offset, &half, sizeof(half));
+}
+
+bool cookMesh(const ImportedMesh* meshes, uint32_t meshCount, MESH_TYPE type, MeshData& mesh) {
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint32_t)type];
+	mesh = MeshData();
+	mesh.type = type;
+
+	// Packed vertices are merged if they are identical, like the Blender scripts do
+	std::unordered_map<std::string, uint32_t> vertexIndices;
+	std::string vertex(stride, '\0');
+	for(uint32_t i = 0; i < meshCount; ++i) {
+		const ImportedMesh& source = meshes[i];
+		const uint32_t vertexCount = source.vertexCount();
+		if(type == MESH_TYPE::SKINNED && (source.boneIndices.size() != vertexCount * MAX_BONE_INFLUENCES ||
+			source.boneWeights.size() != vertexCount * MAX_BONE_INFLUENCES)) return false;
+
+		const std::vector<Vector3> normals = getNormals(source);
+		const std::vector<Vector3> tangents = getTangents(source, normals);
+		const bool hasTexCoords = source.texCoords.size() == vertexCount * 2;
+
+		std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+		for(size_t j = 0; j + 2 < source.indices.size(); j += 3) {
+			// Clockwise winding
+			for(uint32_t k = 3; k-- > 0;) {
+				const uint32_t index = source.indices[j + k];
+				if(remap[index] == UINT32_MAX) {
+					memcpy(vertex.data(), source.positions.data() + index * 3, sizeof(float) * 3);
+					storeHalf(vertex.data(), 12, normals[index].x);
+					storeHalf(vertex.data(), 14, normals[index].y);
+					storeHalf(vertex.data(), 16, normals[index].z);
+					storeHalf(vertex.data(), 18, hasTexCoords ? source.texCoords[index * 2] : 0.0f);
+					storeHalf(vertex.data(), 20, tangents[index].x);
+					storeHalf(vertex.data(), 22, tangents[index].y);
+					storeHalf(vertex.data(), 24, tangents[index].z);
+					storeHalf(vertex.data(), 26, hasTexCoords ? source.texCoords[index * 2 + 1] : 0.0f);
+
+					if(type == MESH_TYPE::SKINNED) {
+						uint8_t weights[MAX_BONE_INFLUENCES];
+						packWeights(source.boneWeights.data() + index * MAX_BONE_INFLUENCES, weights);
+						for(uint32_t l = 0; l < MAX_BONE_INFLUENCES; ++l) {
+							// Unused influences point at the root
+							vertex[28 + l] = weights[l] ? source.boneIndices[index * MAX_BONE_INFLUENCES + l] : 0;
+							vertex[32 + l] = (char)weights[l];
+						}
+					}
+
+					auto [it, inserted] = vertexIndices.try_emplace(vertex, (uint32_t)vertexIndices.size());
+					if(inserted) mesh.vertices.insert(mesh.vertices.end(), vertex.begin(), vertex.end());
+					remap[index] = it->second;
+				}
+
+				mesh.indices.push_back(remap[index]);
+			}
+		}
+	}
+
+	if(mesh.indices.empty()) return false;
+
+	const uint32_t vertexCount = (uint32_t)vertexIndices.size();
+	mesh.vertexCounts.push_back(vertexCount);
+	mesh.indexCounts.push_back((uint32_t)mesh.indices.size());
+
+	const RIN::BoundingSphere sphere = RIN::computeBoundingSphere(mesh.vertices.data(), vertexCount, stride);
+	mesh.boundingSphere[0] = sphere.center.x;
+	mesh.boundingSphere[1] = sphere.center.y;
+	mesh.boundingSphere[2] = sphere.center.z;
+	mesh.boundingSphere[3] = sphere.radius;
+	if(type == MESH_TYPE::SKINNED) mesh.boundingSphere[3] *= SKINNED_BOUNDING_SPHERE_SCALE;
+
+	return true;
+}
+
+void writeArmature(const ImportedBone* bones, uint32_t boneCount, std::vector<char>& data) {
+	data.push_back((char)(uint8_t)boneCount);
+	data.insert(data.end(), (const char*)bones[0].restMatrix, (const char*)(bones[0].restMatrix + 16));
+
+	for(uint32_t i = 1; i < boneCount; ++i) {
+		data.push_back((char)(uint8_t)i);
+		data.push_back((char)(uint8_t)bones[i].parent);
+		data.insert(data.end(), (const char*)bones[i].restMatrix, (const char*)(bones[i].restMatrix + 16));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "MeshFile.hpp"
+#include "ModelImport.hpp"
+
+/*
+Packs imported meshes into RIN's vertex layouts, the same way the Blender
+scripts export them
+
+Missing or zero normals are generated from the angle weighted normals of
+the triangles around each vertex
+Tangents follow MikkTSpace, the tangent of each triangle is weighted by
+the angle of the corner, projected onto the plane of the normal and
+normalized, there is no bitangent sign since the shaders take the
+cross product of the normal and tangent
+Triangles are turned clockwise, identical vertices are merged and bone
+weights are normalized to unorm8 weights which sum to 255
+
+The bounding sphere comes from RIN::computeBoundingSphere, skinned meshes
+scale its radius by SKINNED_BOUNDING_SPHERE_SCALE since posing moves them
+past it
+
+Thread Safety:
+All functions are thread-safe
+*/
+
+constexpr float SKINNED_BOUNDING_SPHERE_SCALE = 2.0f;
+
+/*
+Combines the meshes into LOD 0 of mesh
+Skinned meshes must have bone influences, the other types ignore them
+Returns false if there are no triangles
+*/
+bool cookMesh(const ImportedMesh* meshes, uint32_t meshCount, MESH_TYPE type, MeshData& mesh);
+// Appends a .arm file to data, bones must be ordered as ImportedModel::bones
+void writeArmature(const ImportedBone* bones, uint32_t boneCount, std::vector<char>& data);
\ No newline at end of file
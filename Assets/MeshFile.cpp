@@ -0,0 +1,238 @@
+#include "MeshFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "MeshCodec.hpp"
+
+// Size of the header and the LOD arrays
+static uint64_t getTableSize(uint32_t lodCount) {
+	return sizeof(MeshHeader) + lodCount * (sizeof(uint32_t) * 2 + sizeof(uint64_t) * 4);
+}
+
+bool readMesh(const char* data, uint64_t size, MeshData& mesh) {
+	if(size < sizeof(MeshHeader)) return false;
+
+	MeshHeader header;
+	memcpy(&header, data, sizeof(header));
+	if(memcmp(header.magic, MESH_MAGIC, sizeof(MESH_MAGIC)) || header.version != MESH_VERSION) return false;
+	if((uint8_t)header.type > (uint8_t)MESH_TYPE::SKINNED || !header.lodCount) return false;
+
+	const uint32_t lodCount = header.lodCount;
+	if(size < getTableSize(lodCount)) return false;
+
+	// The arrays are not aligned, so they are copied out
+	mesh.type = header.type;
+	mesh.sharedVertices = (header.flags & MESH_FLAG_SHARED_VERTICES) != 0;
+	memcpy(mesh.boundingSphere, header.boundingSphere, sizeof(mesh.boundingSphere));
+	mesh.vertexCounts.resize(lodCount);
+	mesh.indexCounts.resize(lodCount);
+	std::vector<uint64_t> offsets(lodCount * 4);
+
+	const char* table = data + sizeof(MeshHeader);
+	memcpy(mesh.vertexCounts.data(), table, lodCount * sizeof(uint32_t));
+	table += lodCount * sizeof(uint32_t);
+	memcpy(mesh.indexCounts.data(), table, lodCount * sizeof(uint32_t));
+	table += lodCount * sizeof(uint32_t);
+	memcpy(offsets.data(), table, offsets.size() * sizeof(uint64_t));
+
+	const uint64_t* vertexOffsets = offsets.data();
+	const uint64_t* vertexSizes = vertexOffsets + lodCount;
+	const uint64_t* indexOffsets = vertexSizes + lodCount;
+	const uint64_t* indexSizes = indexOffsets + lodCount;
+
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+	uint64_t vertexCount = 0, indexCount = 0;
+	for(uint32_t i = 0; i < lodCount; ++i) {
+		if(vertexOffsets[i] > size || vertexSizes[i] > size - vertexOffsets[i]) return false;
+		if(indexOffsets[i] > size || indexSizes[i] > size - indexOffsets[i]) return false;
+		if(mesh.sharedVertices && i && mesh.vertexCounts[i] > mesh.vertexCounts[i - 1]) return false;
+
+		vertexCount += mesh.vertexCounts[i];
+		indexCount += mesh.indexCounts[i];
+	}
+
+	if(mesh.sharedVertices) vertexCount = mesh.vertexCounts[0];
+
+	mesh.vertices.resize(vertexCount * stride);
+	mesh.indices.resize(indexCount);
+
+	char* vertices = mesh.vertices.data();
+	uint32_t* indices = mesh.indices.data();
+	for(uint32_t i = 0; i < lodCount; ++i) {
+		// Shared vertex streams only hold the vertices the next LOD does not use
+		uint32_t streamVertexCount = mesh.vertexCounts[i];
+		if(mesh.sharedVertices) {
+			const uint32_t nextVertexCount = i + 1 < lodCount ? mesh.vertexCounts[i + 1] : 0;
+			streamVertexCount -= nextVertexCount;
+			vertices = mesh.vertices.data() + (uint64_t)nextVertexCount * stride;
+		}
+
+		const uint64_t lodVertexSize = (uint64_t)streamVertexCount * stride;
+		if(header.flags & MESH_FLAG_COMPRESSED_VERTICES) {
+			if(!decodeVertices(data + vertexOffsets[i], vertexSizes[i], streamVertexCount, stride, vertices)) return false;
+		} else {
+			if(vertexSizes[i] != lodVertexSize) return false;
+			memcpy(vertices, data + vertexOffsets[i], lodVertexSize);
+		}
+
+		const uint64_t lodIndexSize = (uint64_t)mesh.indexCounts[i] * sizeof(uint32_t);
+		if(header.flags & MESH_FLAG_COMPRESSED_INDICES) {
+			if(!decodeIndices(data + indexOffsets[i], indexSizes[i], mesh.indexCounts[i], indices)) return false;
+		} else {
+			if(indexSizes[i] != lodIndexSize) return false;
+			memcpy(indices, data + indexOffsets[i], lodIndexSize);
+		}
+
+		vertices += lodVertexSize;
+		indices += mesh.indexCounts[i];
+	}
+
+	return true;
+}
+
+void writeMesh(const MeshData& mesh, uint32_t flags, std::vector<char>& data) {
+	if(mesh.sharedVertices) flags |= MESH_FLAG_SHARED_VERTICES;
+	else flags &= ~MESH_FLAG_SHARED_VERTICES;
+
+	const uint32_t lodCount = mesh.lodCount();
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+
+	const size_t start = data.size();
+	data.resize(start + getTableSize(lodCount));
+
+	// Write the streams first, then fill in the table
+	std::vector<uint64_t> offsets(lodCount * 4);
+	uint64_t* vertexOffsets = offsets.data();
+	uint64_t* vertexSizes = vertexOffsets + lodCount;
+	uint64_t* indexOffsets = vertexSizes + lodCount;
+	uint64_t* indexSizes = indexOffsets + lodCount;
+
+	const char* vertices = mesh.vertices.data();
+	for(uint32_t i = 0; i < lodCount; ++i) {
+		uint32_t streamVertexCount = mesh.vertexCounts[i];
+		if(mesh.sharedVertices) {
+			const uint32_t nextVertexCount = i + 1 < lodCount ? mesh.vertexCounts[i + 1] : 0;
+			streamVertexCount -= nextVertexCount;
+			vertices = mesh.vertices.data() + (uint64_t)nextVertexCount * stride;
+		}
+
+		const uint64_t lodVertexSize = (uint64_t)streamVertexCount * stride;
+
+		vertexOffsets[i] = data.size() - start;
+		if(flags & MESH_FLAG_COMPRESSED_VERTICES) encodeVertices(vertices, streamVertexCount, stride, data);
+		else data.insert(data.end(), vertices, vertices + lodVertexSize);
+		vertexSizes[i] = data.size() - start - vertexOffsets[i];
+
+		vertices += lodVertexSize;
+	}
+
+	const uint32_t* indices = mesh.indices.data();
+	for(uint32_t i = 0; i < lodCount; ++i) {
+		indexOffsets[i] = data.size() - start;
+		if(flags & MESH_FLAG_COMPRESSED_INDICES) encodeIndices(indices, mesh.indexCounts[i], data);
+		else data.insert(data.end(), (const char*)indices, (const char*)(indices + mesh.indexCounts[i]));
+		indexSizes[i] = data.size() - start - indexOffsets[i];
+
+		indices += mesh.indexCounts[i];
+	}
+
+	MeshHeader header{};
+	memcpy(header.magic, MESH_MAGIC, sizeof(MESH_MAGIC));
+	header.version = MESH_VERSION;
+	header.type = mesh.type;
+	header.lodCount = (uint8_t)lodCount;
+	header.flags = flags;
+	memcpy(header.boundingSphere, mesh.boundingSphere, sizeof(header.boundingSphere));
+
+	char* table = data.data() + start;
+	memcpy(table, &header, sizeof(header));
+	table += sizeof(header);
+	memcpy(table, mesh.vertexCounts.data(), lodCount * sizeof(uint32_t));
+	table += lodCount * sizeof(uint32_t);
+	memcpy(table, mesh.indexCounts.data(), lodCount * sizeof(uint32_t));
+	table += lodCount * sizeof(uint32_t);
+	memcpy(table, offsets.data(), offsets.size() * sizeof(uint64_t));
+}
+
+void computeBounds(MeshData& mesh) {
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+	mesh.boundingBoxes.clear();
+	mesh.boneSpheres.clear();
+
+	const char* vertices = mesh.vertices.data();
+	for(uint32_t i = 0; i < mesh.lodCount(); ++i) {
+		if(mesh.vertexCounts[i]) mesh.boundingBoxes.push_back(RIN::computeBoundingBox(vertices, mesh.vertexCounts[i], stride));
+		else mesh.boundingBoxes.push_back(RIN::BoundingBox({}, {}));
+		// Shared LODs use the start of the vertices
+		if(!mesh.sharedVertices) vertices += (uint64_t)mesh.vertexCounts[i] * stride;
+	}
+
+	const uint64_t vertexCount = mesh.vertices.size() / stride;
+	if(!vertexCount) return;
+
+	if(mesh.type != MESH_TYPE::SKINNED) {
+		const RIN::BoundingSphere sphere = RIN::computeBoundingSphere(mesh.vertices.data(), vertexCount, stride);
+		mesh.boundingSphere[0] = sphere.center.x;
+		mesh.boundingSphere[1] = sphere.center.y;
+		mesh.boundingSphere[2] = sphere.center.z;
+		mesh.boundingSphere[3] = sphere.radius;
+		return;
+	}
+
+	// Enough spheres for every bone the vertices use
+	const RIN::SkinnedVertex* skinnedVertices = (const RIN::SkinnedVertex*)mesh.vertices.data();
+	uint32_t boneCount = 0;
+	for(uint64_t i = 0; i < vertexCount; ++i) {
+		const uint8_t* indices = &skinnedVertices[i].boneIndices.x;
+		const uint8_t* weights = &skinnedVertices[i].boneWeights.x;
+		for(uint32_t k = 0; k < 4; ++k)
+			if(weights[k]) boneCount = std::max(boneCount, indices[k] + 1u);
+	}
+
+	mesh.boneSpheres.resize(boneCount);
+	RIN::computeBoneBoundingSpheres(skinnedVertices, vertexCount, boneCount, mesh.boneSpheres.data());
+}
+
+void MeshFile::load(FilePool& filePool, const char* fileName, const LODSettings* settings, const callback_type& callback) {
+	close();
+	if(settings) lodSettings = *settings;
+
+	filePool.mapFile(fileName, file,
+		[this, callback](FilePool::File& mapped) {
+			// Called on the worker which mapped the file
+			const bool read = readMesh(mapped.data(), mapped.size(), _mesh);
+			mapped.close();
+			if(!read) {
+				if(callback) callback(false);
+				return;
+			}
+
+			if(lodSettings) _lodErrors = generateLODs(_mesh, *lodSettings);
+			else _lodErrors.assign(_mesh.lodCount(), 0.0f);
+			computeBounds(_mesh);
+			_ready = true;
+			if(callback) callback(true);
+		}
+	);
+}
+
+bool MeshFile::ready() const {
+	return _ready;
+}
+
+const MeshData& MeshFile::mesh() const {
+	return _mesh;
+}
+
+const std::vector<float>& MeshFile::lodErrors() const {
+	return _lodErrors;
+}
+
+void MeshFile::close() {
+	_ready = false;
+	_mesh = MeshData();
+	lodSettings.reset();
+	_lodErrors.clear();
+	file.close();
+}
\ No newline at end of file
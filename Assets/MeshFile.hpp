@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <Bounds.hpp>
+
+#include "FilePool.hpp"
+#include "MeshSimplifier.hpp"
+
+/*
+Layout of a .smesh, .dmesh or .skmesh file
+
+MeshHeader
+Vertex counts (uint32 array of LOD count elements)
+Index counts (uint32 array of LOD count elements)
+Vertex offsets (uint64 array of LOD count elements)
+Vertex sizes (uint64 array of LOD count elements)
+Index offsets (uint64 array of LOD count elements)
+Index sizes (uint64 array of LOD count elements)
+Vertex streams, one per LOD
+Index streams, one per LOD
+
+The offsets are from the start of the file and the sizes are the
+stored sizes of the streams, so a loader can read just the LODs it
+needs, the streams are compressed with MeshCodec if the header flags
+say so
+
+With MESH_FLAG_SHARED_VERTICES the LODs index into one set of vertex
+count 0 vertices, ordered so LOD i only uses the first vertex count i,
+vertex stream i holds vertices vertex count i + 1 up to vertex count i
+of the set, so the least detailed LODs still only need their own streams
+*/
+
+constexpr char MESH_MAGIC[4]{ 'R', 'M', 'S', 'H' };
+constexpr uint16_t MESH_VERSION = 2;
+
+enum class MESH_TYPE : uint8_t {
+	STATIC,
+	DYNAMIC,
+	SKINNED
+};
+
+// sizeof(StaticVertex), sizeof(DynamicVertex) and sizeof(SkinnedVertex)
+constexpr uint32_t MESH_VERTEX_SIZES[]{ 28, 28, 36 };
+
+enum MESH_FLAG : uint32_t {
+	MESH_FLAG_COMPRESSED_VERTICES = 0x1,
+	MESH_FLAG_COMPRESSED_INDICES = 0x2,
+	MESH_FLAG_SHARED_VERTICES = 0x4
+};
+
+#pragma pack(push, 1)
+struct MeshHeader {
+	char magic[4];
+	uint16_t version;
+	MESH_TYPE type;
+	uint8_t lodCount;
+	uint32_t flags;
+	float boundingSphere[4]; // Center and radius
+};
+#pragma pack(pop)
+
+/*
+A decoded mesh, the LODs are stored back to back starting with the most detailed
+If sharedVertices is set, vertices holds one set of vertexCounts[0] vertices
+which every LOD indexes into, LOD i only uses the first vertexCounts[i]
+*/
+struct MeshData {
+	MESH_TYPE type = MESH_TYPE::STATIC;
+	bool sharedVertices = false;
+	float boundingSphere[4]{};
+	std::vector<uint32_t> vertexCounts;
+	std::vector<uint32_t> indexCounts;
+	std::vector<char> vertices;
+	std::vector<uint32_t> indices;
+	// Filled in by computeBounds, they are not stored in the file
+	std::vector<RIN::BoundingBox> boundingBoxes; // One per LOD
+	std::vector<DirectX::XMFLOAT4> boneSpheres; // Skinned meshes only, see RIN::computeBoneBoundingSpheres
+
+	uint32_t lodCount() const {
+		return (uint32_t)vertexCounts.size();
+	}
+};
+
+// Returns false if data is not a valid mesh file
+bool readMesh(const char* data, uint64_t size, MeshData& mesh);
+// Appends the file to data, MESH_FLAG_SHARED_VERTICES comes from the mesh
+void writeMesh(const MeshData& mesh, uint32_t flags, std::vector<char>& data);
+/*
+Computes the bounding box of each LOD and, for static and dynamic meshes,
+replaces the bounding sphere with a tight one around every LOD
+Skinned meshes keep the sphere of the file, which has to enclose every
+pose, and get the sphere of each bone, which the renderer carries with the
+bones to bound the current pose
+*/
+void computeBounds(MeshData& mesh);
+
+/*
+Loads and decodes a mesh file through a FilePool
+
+The file is mapped and decoded on the FilePool worker which mapped it,
+the mapping is closed as soon as the mesh is decoded
+If LOD settings are given, the LODs the file is missing are generated on
+the same worker, then the bounds are computed with computeBounds
+
+Thread Safety:
+MeshFile::ready is thread-safe
+MeshFile::mesh is thread-safe once the mesh is ready
+*/
+class MeshFile {
+	FilePool::File file;
+	MeshData _mesh;
+	std::optional<LODSettings> lodSettings;
+	std::vector<float> _lodErrors;
+	std::atomic<bool> _ready = false;
+public:
+	// Called on the worker with whether the mesh could be decoded, it is
+	// not called if the file could not be read
+	typedef std::function<void(bool)> callback_type;
+
+	MeshFile() = default;
+	MeshFile(const MeshFile&) = delete;
+	~MeshFile() = default;
+	// The MeshFile must not be destroyed or reloaded until the file pool has finished with it
+	void load(FilePool& filePool, const char* fileName, const LODSettings* settings = nullptr, const callback_type& callback = nullptr);
+	// Stays false if the file could not be read or decoded
+	bool ready() const;
+	const MeshData& mesh() const;
+	// Error of each LOD from generateLODs, 0 for the LODs which were in the file
+	const std::vector<float>& lodErrors() const;
+	// Frees the decoded mesh
+	void close();
+};
\ No newline at end of file
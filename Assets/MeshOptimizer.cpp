@@ -0,0 +1,444 @@
+#include "MeshOptimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Scoring constants from Forsyth's article
+constexpr float CACHE_DECAY_POWER = 1.5f;
+constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+constexpr float VALENCE_BOOST_SCALE = 2.0f;
+constexpr float VALENCE_BOOST_POWER = 0.5f;
+// Valence scores past this are computed on the fly
+constexpr uint32_t MAX_VALENCE_SCORE = 32;
+
+struct VertexScoreTable {
+	float cache[VERTEX_CACHE_SIZE];
+	float valence[MAX_VALENCE_SCORE];
+
+	VertexScoreTable() {
+		// The vertices of the last triangle get a fixed score so they are not favored
+		// over the rest of the cache, which would just emit the same triangle again
+		for(uint32_t i = 0; i < 3; ++i)
+			cache[i] = LAST_TRIANGLE_SCORE;
+		for(uint32_t i = 3; i < VERTEX_CACHE_SIZE; ++i)
+			cache[i] = powf(1.0f - (float)(i - 3) / (VERTEX_CACHE_SIZE - 3), CACHE_DECAY_POWER);
+
+		valence[0] = 0.0f;
+		for(uint32_t i = 1; i < MAX_VALENCE_SCORE; ++i)
+			valence[i] = VALENCE_BOOST_SCALE * powf((float)i, -VALENCE_BOOST_POWER);
+	}
+
+	float get(int32_t cachePosition, uint32_t liveTriangleCount) const {
+		// Not used by any triangle which is left
+		if(!liveTriangleCount) return -1.0f;
+
+		// Vertices with few triangles left are finished off first so they do not have to be transformed again
+		float score = liveTriangleCount < MAX_VALENCE_SCORE ? valence[liveTriangleCount] :
+			VALENCE_BOOST_SCALE * powf((float)liveTriangleCount, -VALENCE_BOOST_POWER);
+		if(cachePosition >= 0) score += cache[cachePosition];
+
+		return score;
+	}
+};
+
+static const VertexScoreTable VERTEX_SCORES;
+
+VertexCacheStats getVertexCacheStats(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize) {
+	VertexCacheStats stats{};
+
+	// A vertex is in the cache if it was added in the last cacheSize misses
+	std::vector<uint32_t> timestamps(vertexCount);
+	std::vector<bool> used(vertexCount);
+	uint32_t time = cacheSize + 1, usedCount = 0;
+	for(uint32_t i = 0; i < indexCount; ++i) {
+		const uint32_t vertex = indices[i];
+		if(time - timestamps[vertex] > cacheSize) {
+			timestamps[vertex] = time++;
+			++stats.transformCount;
+		}
+
+		if(!used[vertex]) {
+			used[vertex] = true;
+			++usedCount;
+		}
+	}
+
+	const uint32_t triangleCount = indexCount / 3;
+	if(triangleCount) stats.acmr = (float)stats.transformCount / triangleCount;
+	if(usedCount) stats.atvr = (float)stats.transformCount / usedCount;
+
+	return stats;
+}
+
+void optimizeVertexCache(uint32_t* indices, uint32_t indexCount, uint32_t vertexCount) {
+	const uint32_t triangleCount = indexCount / 3;
+	if(!triangleCount) return;
+
+	// Triangles which use each vertex, the live triangles of vertex v are
+	// adjacency[offsets[v]] to adjacency[offsets[v] + liveCounts[v]]
+	std::vector<uint32_t> offsets(vertexCount);
+	std::vector<uint32_t> liveCounts(vertexCount);
+	for(uint32_t i = 0; i < triangleCount * 3; ++i)
+		++liveCounts[indices[i]];
+
+	uint32_t offset = 0;
+	for(uint32_t i = 0; i < vertexCount; ++i) {
+		offsets[i] = offset;
+		offset += liveCounts[i];
+	}
+
+	std::vector<uint32_t> adjacency(triangleCount * 3);
+	{
+		std::vector<uint32_t> cursors(offsets);
+		for(uint32_t i = 0; i < triangleCount * 3; ++i)
+			adjacency[cursors[indices[i]]++] = i / 3;
+	}
+
+	std::vector<int32_t> cachePositions(vertexCount, -1);
+	std::vector<float> vertexScores(vertexCount);
+	for(uint32_t i = 0; i < vertexCount; ++i)
+		vertexScores[i] = VERTEX_SCORES.get(-1, liveCounts[i]);
+
+	int64_t best = -1;
+	float bestScore = 0.0f;
+	for(uint32_t i = 0; i < triangleCount; ++i) {
+		const uint32_t* triangle = indices + i * 3;
+		const float score = vertexScores[triangle[0]] + vertexScores[triangle[1]] + vertexScores[triangle[2]];
+		if(score > bestScore) {
+			best = i;
+			bestScore = score;
+		}
+	}
+
+	std::vector<bool> emitted(triangleCount);
+	std::vector<uint32_t> output(triangleCount * 3);
+	// The cache briefly holds the 3 new vertices on top of the full cache
+	uint32_t cache[VERTEX_CACHE_SIZE + 3];
+	uint32_t newCache[VERTEX_CACHE_SIZE + 3];
+	uint32_t cacheCount = 0;
+	// First triangle which might not be emitted yet
+	uint32_t nextTriangle = 0;
+
+	for(uint32_t i = 0; i < triangleCount; ++i) {
+		// Nothing in the cache has triangles left, so start over wherever the input is
+		if(best < 0) {
+			while(emitted[nextTriangle])
+				++nextTriangle;
+			best = nextTriangle;
+		}
+
+		const uint32_t* triangle = indices + best * 3;
+		memcpy(output.data() + i * 3, triangle, sizeof(uint32_t) * 3);
+		emitted[best] = true;
+
+		uint32_t newCount = 0;
+		for(uint32_t j = 0; j < 3; ++j) {
+			const uint32_t vertex = triangle[j];
+
+			// Remove the triangle from the live triangles of the vertex
+			uint32_t* triangles = adjacency.data() + offsets[vertex];
+			uint32_t& liveCount = liveCounts[vertex];
+			for(uint32_t k = 0; k < liveCount; ++k) {
+				if(triangles[k] == best) {
+					triangles[k] = triangles[--liveCount];
+					break;
+				}
+			}
+
+			// Degenerate triangles repeat vertices
+			if(std::find(newCache, newCache + newCount, vertex) == newCache + newCount)
+				newCache[newCount++] = vertex;
+		}
+
+		// The triangle moves to the front of the cache, everything else shifts back
+		for(uint32_t j = 0; j < cacheCount; ++j) {
+			const uint32_t vertex = cache[j];
+			if(vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2])
+				newCache[newCount++] = vertex;
+		}
+
+		for(uint32_t j = 0; j < newCount; ++j) {
+			const uint32_t vertex = newCache[j];
+			cachePositions[vertex] = j < VERTEX_CACHE_SIZE ? (int32_t)j : -1;
+			vertexScores[vertex] = VERTEX_SCORES.get(cachePositions[vertex], liveCounts[vertex]);
+		}
+
+		cacheCount = std::min(newCount, VERTEX_CACHE_SIZE);
+		memcpy(cache, newCache, cacheCount * sizeof(uint32_t));
+
+		// Only the triangles of vertices which moved in the cache change score
+		// Any triangle which is left scores above 0 since all its vertices have live triangles
+		best = -1;
+		bestScore = 0.0f;
+		for(uint32_t j = 0; j < newCount; ++j) {
+			const uint32_t vertex = newCache[j];
+			const uint32_t* triangles = adjacency.data() + offsets[vertex];
+			for(uint32_t k = 0; k < liveCounts[vertex]; ++k) {
+				const uint32_t t = triangles[k];
+				const uint32_t* next = indices + t * 3;
+				const float score = vertexScores[next[0]] + vertexScores[next[1]] + vertexScores[next[2]];
+				if(score > bestScore) {
+					best = t;
+					bestScore = score;
+				}
+			}
+		}
+	}
+
+	memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+// Returns the number of vertices of the triangle which miss a FIFO cache of VERTEX_CACHE_STATS_SIZE
+static uint32_t simulateCache(const uint32_t* triangle, uint32_t* timestamps, uint32_t& time) {
+	uint32_t misses = 0;
+	for(uint32_t i = 0; i < 3; ++i) {
+		const uint32_t vertex = triangle[i];
+		if(time - timestamps[vertex] > VERTEX_CACHE_STATS_SIZE) {
+			timestamps[vertex] = time++;
+			++misses;
+		}
+	}
+
+	return misses;
+}
+
+static void getPosition(const char* vertices, uint32_t stride, uint32_t vertex, float position[3]) {
+	memcpy(position, vertices + (uint64_t)vertex * stride, sizeof(float) * 3);
+}
+
+void optimizeOverdraw(uint32_t* indices, uint32_t indexCount, const char* vertices, uint32_t vertexCount, uint32_t stride, float threshold) {
+	const uint32_t triangleCount = indexCount / 3;
+	if(!triangleCount) return;
+
+	std::vector<uint32_t> timestamps(vertexCount);
+	// Advancing time past the cache size empties the cache
+	uint32_t time = VERTEX_CACHE_STATS_SIZE + 1;
+
+	// Hard boundaries are where the cache optimizer started over, none of the vertices were cached
+	std::vector<uint32_t> hardClusters;
+	for(uint32_t i = 0; i < triangleCount; ++i)
+		if(simulateCache(indices + i * 3, timestamps.data(), time) == 3) hardClusters.push_back(i);
+	hardClusters.push_back(triangleCount);
+
+	// Soft boundaries split the hard clusters further, starting over with an empty cache
+	// as soon as the ACMR of the new cluster is within threshold of the whole hard cluster
+	std::vector<uint32_t> clusters;
+	for(size_t i = 0; i + 1 < hardClusters.size(); ++i) {
+		const uint32_t start = hardClusters[i], end = hardClusters[i + 1];
+
+		time += VERTEX_CACHE_STATS_SIZE + 1;
+		uint32_t clusterMisses = 0;
+		for(uint32_t j = start; j < end; ++j)
+			clusterMisses += simulateCache(indices + j * 3, timestamps.data(), time);
+		const float limit = threshold * clusterMisses / (end - start);
+
+		time += VERTEX_CACHE_STATS_SIZE + 1;
+		clusters.push_back(start);
+		uint32_t clusterStart = start, misses = 0;
+		for(uint32_t j = start; j + 1 < end; ++j) {
+			misses += simulateCache(indices + j * 3, timestamps.data(), time);
+			if(misses <= limit * (j + 1 - clusterStart)) {
+				time += VERTEX_CACHE_STATS_SIZE + 1;
+				clusterStart = j + 1;
+				misses = 0;
+				clusters.push_back(clusterStart);
+			}
+		}
+	}
+	clusters.push_back(triangleCount);
+
+	const size_t clusterCount = clusters.size() - 1;
+	if(clusterCount < 2) return;
+
+	// Area weighted centroid and normal of each cluster, the cross product is twice the area
+	std::vector<float> clusterData(clusterCount * 7);
+	float meshCentroid[3]{};
+	float meshArea = 0.0f;
+	for(size_t i = 0; i < clusterCount; ++i) {
+		float* data = clusterData.data() + i * 7;
+		for(uint32_t j = clusters[i]; j < clusters[i + 1]; ++j) {
+			const uint32_t* triangle = indices + j * 3;
+			float p0[3], p1[3], p2[3];
+			getPosition(vertices, stride, triangle[0], p0);
+			getPosition(vertices, stride, triangle[1], p1);
+			getPosition(vertices, stride, triangle[2], p2);
+
+			const float e0[3]{ p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			const float e1[3]{ p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			const float normal[3]{
+				e0[1] * e1[2] - e0[2] * e1[1],
+				e0[2] * e1[0] - e0[0] * e1[2],
+				e0[0] * e1[1] - e0[1] * e1[0]
+			};
+			const float area = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+
+			for(uint32_t k = 0; k < 3; ++k) {
+				data[k] += (p0[k] + p1[k] + p2[k]) * area;
+				data[k + 3] += normal[k];
+			}
+			data[6] += area;
+		}
+
+		for(uint32_t k = 0; k < 3; ++k)
+			meshCentroid[k] += data[k];
+		meshArea += data[6];
+	}
+
+	if(meshArea > 0.0f) {
+		for(uint32_t k = 0; k < 3; ++k)
+			meshCentroid[k] /= meshArea * 3.0f;
+	}
+
+	// Clusters are drawn in order of how far they face out from the center of the mesh
+	std::vector<float> keys(clusterCount);
+	for(size_t i = 0; i < clusterCount; ++i) {
+		const float* data = clusterData.data() + i * 7;
+		const float length = sqrtf(data[3] * data[3] + data[4] * data[4] + data[5] * data[5]);
+		if(data[6] <= 0.0f || length <= 0.0f) continue;
+
+		float key = 0.0f;
+		for(uint32_t k = 0; k < 3; ++k)
+			key += (data[k] / (data[6] * 3.0f) - meshCentroid[k]) * data[k + 3];
+		keys[i] = key / length;
+	}
+
+	std::vector<uint32_t> order(clusterCount);
+	for(uint32_t i = 0; i < clusterCount; ++i)
+		order[i] = i;
+	std::stable_sort(order.begin(), order.end(), [&keys](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+	std::vector<uint32_t> output;
+	output.reserve(triangleCount * 3);
+	for(uint32_t cluster : order)
+		output.insert(output.end(), indices + clusters[cluster] * 3, indices + clusters[cluster + 1] * 3);
+
+	memcpy(indices, output.data(), output.size() * sizeof(uint32_t));
+}
+
+uint32_t optimizeVertexFetch(char* vertices, uint32_t vertexCount, uint32_t stride, uint32_t* indices, uint32_t indexCount) {
+	std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+	uint32_t count = 0;
+	for(uint32_t i = 0; i < indexCount; ++i) {
+		uint32_t& vertex = remap[indices[i]];
+		if(vertex == UINT32_MAX) vertex = count++;
+		indices[i] = vertex;
+	}
+
+	const std::vector<char> source(vertices, vertices + (uint64_t)vertexCount * stride);
+	for(uint32_t i = 0; i < vertexCount; ++i)
+		if(remap[i] != UINT32_MAX) memcpy(vertices + (uint64_t)remap[i] * stride, source.data() + (uint64_t)i * stride, stride);
+
+	return count;
+}
+
+void shareLODVertices(MeshData& mesh) {
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+
+	// Indices into the merged vertices, shared meshes are already merged
+	std::vector<char> vertices;
+	if(mesh.sharedVertices) vertices = std::move(mesh.vertices);
+	else {
+		std::unordered_map<std::string, uint32_t> merged;
+		const char* lodVertices = mesh.vertices.data();
+		uint32_t* lodIndices = mesh.indices.data();
+		for(uint32_t i = 0; i < mesh.lodCount(); ++i) {
+			std::vector<uint32_t> remap(mesh.vertexCounts[i]);
+			for(uint32_t j = 0; j < mesh.vertexCounts[i]; ++j) {
+				const char* vertex = lodVertices + (uint64_t)j * stride;
+				auto [it, inserted] = merged.try_emplace(std::string(vertex, stride), (uint32_t)(vertices.size() / stride));
+				if(inserted) vertices.insert(vertices.end(), vertex, vertex + stride);
+				remap[j] = it->second;
+			}
+
+			for(uint32_t j = 0; j < mesh.indexCounts[i]; ++j)
+				lodIndices[j] = remap[lodIndices[j]];
+
+			lodVertices += (uint64_t)mesh.vertexCounts[i] * stride;
+			lodIndices += mesh.indexCounts[i];
+		}
+	}
+
+	const uint32_t vertexCount = (uint32_t)(vertices.size() / stride);
+
+	// First use order from the least detailed LOD up, the LODs start at the back of the indices
+	std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+	uint32_t count = 0;
+	uint32_t* lodIndices = mesh.indices.data() + mesh.indices.size();
+	for(uint32_t i = mesh.lodCount(); i--;) {
+		lodIndices -= mesh.indexCounts[i];
+		for(uint32_t j = 0; j < mesh.indexCounts[i]; ++j) {
+			uint32_t& vertex = remap[lodIndices[j]];
+			if(vertex == UINT32_MAX) vertex = count++;
+			lodIndices[j] = vertex;
+		}
+
+		mesh.vertexCounts[i] = count;
+	}
+
+	// Vertices no LOD uses are dropped
+	mesh.vertices.resize((uint64_t)count * stride);
+	for(uint32_t i = 0; i < vertexCount; ++i)
+		if(remap[i] != UINT32_MAX) memcpy(mesh.vertices.data() + (uint64_t)remap[i] * stride, vertices.data() + (uint64_t)i * stride, stride);
+
+	mesh.sharedVertices = true;
+}
+
+void optimizeMesh(MeshData& mesh, bool overdraw) {
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+
+	// Shared LODs can only reorder their triangles, the vertices are ordered for every LOD at once
+	if(mesh.sharedVertices) {
+		uint32_t* lodIndices = mesh.indices.data();
+		for(uint32_t i = 0; i < mesh.lodCount(); ++i) {
+			optimizeVertexCache(lodIndices, mesh.indexCounts[i], mesh.vertexCounts[i]);
+			if(overdraw) optimizeOverdraw(lodIndices, mesh.indexCounts[i], mesh.vertices.data(), mesh.vertexCounts[i], stride);
+
+			lodIndices += mesh.indexCounts[i];
+		}
+
+		shareLODVertices(mesh);
+		return;
+	}
+
+	// Unused vertices are dropped, so the LODs are packed into a new buffer
+	std::vector<char> vertices;
+	vertices.reserve(mesh.vertices.size());
+
+	char* lodVertices = mesh.vertices.data();
+	uint32_t* lodIndices = mesh.indices.data();
+	for(uint32_t i = 0; i < mesh.lodCount(); ++i) {
+		const uint32_t vertexCount = mesh.vertexCounts[i];
+		const uint32_t indexCount = mesh.indexCounts[i];
+
+		optimizeVertexCache(lodIndices, indexCount, vertexCount);
+		if(overdraw) optimizeOverdraw(lodIndices, indexCount, lodVertices, vertexCount, stride);
+		mesh.vertexCounts[i] = optimizeVertexFetch(lodVertices, vertexCount, stride, lodIndices, indexCount);
+		vertices.insert(vertices.end(), lodVertices, lodVertices + (uint64_t)mesh.vertexCounts[i] * stride);
+
+		lodVertices += (uint64_t)vertexCount * stride;
+		lodIndices += indexCount;
+	}
+
+	mesh.vertices = std::move(vertices);
+}
+
+void optimizeMeshShared(MeshData& mesh, bool overdraw, uint32_t flags) {
+	if(mesh.sharedVertices) {
+		optimizeMesh(mesh, overdraw);
+		return;
+	}
+
+	MeshData shared = mesh;
+	shareLODVertices(shared);
+	optimizeMesh(shared, overdraw);
+	optimizeMesh(mesh, overdraw);
+
+	std::vector<char> file, sharedFile;
+	writeMesh(mesh, flags, file);
+	writeMesh(shared, flags, sharedFile);
+	if(sharedFile.size() < file.size()) mesh = std::move(shared);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+
+#include "MeshFile.hpp"
+
+/*
+Offline index and vertex reordering for mesh files
+
+optimizeVertexCache orders the triangles with Tom Forsyth's linear-speed
+vertex cache optimization, which scores vertices by their position in a
+simulated LRU cache and by how many triangles still use them, and
+greedily emits the best scoring triangle next to the ones in the cache
+
+optimizeOverdraw follows Sander et al., the cache optimized triangles are
+split into clusters wherever starting over costs at most threshold times
+the ACMR of the cluster, then the clusters are sorted so the ones which
+face away from the center of the mesh are drawn first, since those tend
+to occlude the rest
+
+optimizeVertexFetch moves the vertices into the order the triangles
+first use them and drops the vertices which are never used
+
+shareLODVertices merges the vertices of every LOD into one set, identical
+vertices are found by their bytes, then orders the set by first use from
+the least detailed LOD up, so each LOD only uses a prefix of the set
+LOD 0 gives up some vertex fetch locality in exchange for storing and
+uploading the vertices the LODs have in common once
+Simplified LODs mostly create new vertices, so the shared set is often
+barely smaller and the worse locality makes it compress worse, which is
+why optimizeMeshShared only keeps it when the file gets smaller
+
+The cache statistics simulate a FIFO cache, which is closer to how
+hardware reuses vertices than the LRU cache used for optimization
+ACMR is the average number of vertices transformed per triangle
+ATVR is the average number of times each used vertex is transformed,
+1 is the best possible
+
+Thread Safety:
+All functions are thread-safe
+*/
+
+constexpr uint32_t VERTEX_CACHE_SIZE = 32;
+constexpr uint32_t VERTEX_CACHE_STATS_SIZE = 16;
+constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+struct VertexCacheStats {
+	uint32_t transformCount;
+	float acmr;
+	float atvr;
+};
+
+VertexCacheStats getVertexCacheStats(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize = VERTEX_CACHE_STATS_SIZE);
+
+// Reorders the triangles in place
+void optimizeVertexCache(uint32_t* indices, uint32_t indexCount, uint32_t vertexCount);
+// Reorders the triangles in place, indices should already be cache optimized
+// Positions are the first 3 floats of each vertex
+void optimizeOverdraw(uint32_t* indices, uint32_t indexCount, const char* vertices, uint32_t vertexCount, uint32_t stride, float threshold = OVERDRAW_THRESHOLD);
+// Reorders the vertices and remaps the indices in place, returns the new vertex count
+uint32_t optimizeVertexFetch(char* vertices, uint32_t vertexCount, uint32_t stride, uint32_t* indices, uint32_t indexCount);
+
+// Makes the LODs of the mesh share their vertices, shared meshes are reordered again
+void shareLODVertices(MeshData& mesh);
+
+// Runs the optimizations above on every LOD, shared meshes stay shared
+void optimizeMesh(MeshData& mesh, bool overdraw);
+// Runs optimizeMesh with and without shared vertices and keeps the mesh which is smaller written with flags
+// Meshes which are already shared stay shared
+void optimizeMeshShared(MeshData& mesh, bool overdraw, uint32_t flags);
\ No newline at end of file
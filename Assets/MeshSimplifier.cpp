@@ -0,0 +1,449 @@
+#include "MeshSimplifier.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+#include <DirectXPackedVector.h>
+
+#include "MeshOptimizer.hpp"
+
+// Normal and texture coordinates
+constexpr uint32_t ATTRIBUTE_COUNT = 5;
+
+// Offsets of the attributes in the vertex layout
+constexpr uint32_t NORMAL_OFFSET = 12;
+constexpr uint32_t TEX_X_OFFSET = 18;
+constexpr uint32_t TEX_Y_OFFSET = 26;
+
+// Collapses which turn a triangle by more than about 75 degrees are skipped,
+// which catches flips and most of the slivers which would fold over later
+constexpr float MIN_TURN_COS = 0.25f;
+
+// Plane quadric of a position, error(p) = p^T A p + 2 b^T p + c
+struct Quadric {
+	double a00 = 0.0, a01 = 0.0, a02 = 0.0, a11 = 0.0, a12 = 0.0, a22 = 0.0;
+	double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+	double c = 0.0;
+	double weight = 0.0;
+
+	void addPlane(const float normal[3], float distance, float planeWeight) {
+		a00 += planeWeight * normal[0] * normal[0];
+		a01 += planeWeight * normal[0] * normal[1];
+		a02 += planeWeight * normal[0] * normal[2];
+		a11 += planeWeight * normal[1] * normal[1];
+		a12 += planeWeight * normal[1] * normal[2];
+		a22 += planeWeight * normal[2] * normal[2];
+		b0 += planeWeight * normal[0] * distance;
+		b1 += planeWeight * normal[1] * distance;
+		b2 += planeWeight * normal[2] * distance;
+		c += planeWeight * distance * distance;
+		weight += planeWeight;
+	}
+
+	void add(const Quadric& other) {
+		a00 += other.a00; a01 += other.a01; a02 += other.a02;
+		a11 += other.a11; a12 += other.a12; a22 += other.a22;
+		b0 += other.b0; b1 += other.b1; b2 += other.b2;
+		c += other.c;
+		weight += other.weight;
+	}
+
+	// Unnormalized error
+	double evaluate(const float p[3]) const {
+		const double x = p[0], y = p[1], z = p[2];
+		return a00 * x * x + a11 * y * y + a22 * z * z +
+			2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+			2.0 * (b0 * x + b1 * y + b2 * z) + c;
+	}
+};
+
+// Squared distance of the attributes of a vertex from the attributes it has replaced, weighted by area
+struct AttributeQuadric {
+	double weight = 0.0;
+	double b[ATTRIBUTE_COUNT]{};
+	double c = 0.0;
+
+	void add(const AttributeQuadric& other) {
+		weight += other.weight;
+		for(uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i)
+			b[i] += other.b[i];
+		c += other.c;
+	}
+
+	// Unnormalized error
+	double evaluate(const float a[ATTRIBUTE_COUNT]) const {
+		double error = c;
+		for(uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i)
+			error += weight * a[i] * a[i] - 2.0 * b[i] * a[i];
+		return error;
+	}
+};
+
+struct PositionKey {
+	uint32_t bits[3];
+
+	bool operator==(const PositionKey& other) const {
+		return !memcmp(bits, other.bits, sizeof(bits));
+	}
+};
+
+struct PositionHash {
+	size_t operator()(const PositionKey& key) const {
+		return ((size_t)key.bits[0] * 73856093) ^ ((size_t)key.bits[1] * 19349663) ^ ((size_t)key.bits[2] * 83492791);
+	}
+};
+
+struct Collapse {
+	uint32_t from;
+	uint32_t to;
+	float cost;
+};
+
+static float getHalf(const char* vertex, uint32_t offset) {
+	DirectX::PackedVector::HALF half;
+	memcpy(&half, vertex + offset, sizeof(half));
+	return DirectX::PackedVector::XMConvertHalfToFloat(half);
+}
+
+static void cross(const float a[3], const float b[3], const float c[3], float normal[3]) {
+	const float e0[3]{ b[0] - a[0], b[1] - a[1], b[2] - a[2] };
+	const float e1[3]{ c[0] - a[0], c[1] - a[1], c[2] - a[2] };
+	normal[0] = e0[1] * e1[2] - e0[2] * e1[1];
+	normal[1] = e0[2] * e1[0] - e0[0] * e1[2];
+	normal[2] = e0[0] * e1[1] - e0[1] * e1[0];
+}
+
+SimplifyResult simplifyMesh(
+	const char* vertices,
+	uint32_t vertexCount,
+	uint32_t stride,
+	const float boundingSphere[4],
+	const uint32_t* indices,
+	uint32_t indexCount,
+	uint32_t targetIndexCount,
+	float maxError,
+	uint32_t* destination
+) {
+	std::vector<uint32_t> result(indices, indices + indexCount / 3 * 3);
+
+	// Positions relative to the bounding sphere, attributes prescaled by their weights
+	const float scale = boundingSphere[3] > 0.0f ? 1.0f / boundingSphere[3] : 1.0f;
+	const float normalScale = sqrtf(SIMPLIFY_NORMAL_WEIGHT), texScale = sqrtf(SIMPLIFY_TEX_WEIGHT);
+	std::vector<float> positions(vertexCount * 3);
+	std::vector<float> attributes(vertexCount * ATTRIBUTE_COUNT);
+	for(uint32_t i = 0; i < vertexCount; ++i) {
+		const char* vertex = vertices + (uint64_t)i * stride;
+		float position[3];
+		memcpy(position, vertex, sizeof(position));
+		for(uint32_t j = 0; j < 3; ++j)
+			positions[i * 3 + j] = (position[j] - boundingSphere[j]) * scale;
+
+		float* attribute = attributes.data() + i * ATTRIBUTE_COUNT;
+		for(uint32_t j = 0; j < 3; ++j)
+			attribute[j] = getHalf(vertex, NORMAL_OFFSET + j * 2) * normalScale;
+		attribute[3] = getHalf(vertex, TEX_X_OFFSET) * texScale;
+		attribute[4] = getHalf(vertex, TEX_Y_OFFSET) * texScale;
+	}
+
+	// Vertices with the same position share a position id, which is the first of them,
+	// and are linked in a cycle through wedges
+	std::vector<uint32_t> positionIds(vertexCount);
+	std::vector<uint32_t> wedges(vertexCount);
+	{
+		std::unordered_map<PositionKey, uint32_t, PositionHash> firstVertices;
+		firstVertices.reserve(vertexCount);
+		for(uint32_t i = 0; i < vertexCount; ++i) {
+			PositionKey key;
+			memcpy(key.bits, vertices + (uint64_t)i * stride, sizeof(key.bits));
+			auto [it, inserted] = firstVertices.try_emplace(key, i);
+			positionIds[i] = it->second;
+			wedges[i] = i;
+			if(!inserted) {
+				// Insert into the cycle after the first vertex
+				wedges[i] = wedges[it->second];
+				wedges[it->second] = i;
+			}
+		}
+	}
+
+	// Lock the ends of edges which only have a triangle on one side or are used more than once in the same direction
+	std::vector<bool> locked(vertexCount);
+	{
+		std::unordered_map<uint64_t, uint32_t> edges;
+		edges.reserve(result.size());
+		for(size_t i = 0; i < result.size(); i += 3) {
+			for(uint32_t j = 0; j < 3; ++j) {
+				const uint32_t a = positionIds[result[i + j]], b = positionIds[result[i + (j + 1) % 3]];
+				if(a != b) ++edges[(uint64_t)a << 32 | b];
+			}
+		}
+
+		for(const auto& [edge, count] : edges) {
+			const uint32_t a = (uint32_t)(edge >> 32), b = (uint32_t)edge;
+			const auto opposite = edges.find((uint64_t)b << 32 | a);
+			if(count > 1 || opposite == edges.end() || opposite->second != count) {
+				locked[a] = true;
+				locked[b] = true;
+			}
+		}
+	}
+
+	std::vector<Quadric> quadrics(vertexCount);
+	std::vector<AttributeQuadric> attributeQuadrics(vertexCount);
+	for(size_t i = 0; i < result.size(); i += 3) {
+		const uint32_t* triangle = result.data() + i;
+		const float* p0 = positions.data() + triangle[0] * 3;
+		float normal[3];
+		cross(p0, positions.data() + triangle[1] * 3, positions.data() + triangle[2] * 3, normal);
+		const float length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		if(length <= 0.0f) continue;
+
+		for(uint32_t j = 0; j < 3; ++j)
+			normal[j] /= length;
+		const float distance = -(normal[0] * p0[0] + normal[1] * p0[1] + normal[2] * p0[2]);
+		const float area = length * 0.5f;
+
+		for(uint32_t j = 0; j < 3; ++j) {
+			const uint32_t vertex = triangle[j];
+			quadrics[positionIds[vertex]].addPlane(normal, distance, area);
+
+			const float* attribute = attributes.data() + vertex * ATTRIBUTE_COUNT;
+			AttributeQuadric& attributeQuadric = attributeQuadrics[vertex];
+			attributeQuadric.weight += area;
+			for(uint32_t k = 0; k < ATTRIBUTE_COUNT; ++k) {
+				attributeQuadric.b[k] += area * attribute[k];
+				attributeQuadric.c += area * attribute[k] * attribute[k];
+			}
+		}
+	}
+
+	const float maxCost = maxError * maxError;
+	float resultCost = 0.0f;
+
+	std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+	std::vector<uint32_t> adjacency;
+	std::vector<Collapse> collapses;
+	std::vector<uint32_t> targets(vertexCount);
+	std::vector<uint32_t> remap(vertexCount);
+	std::vector<bool> touched(vertexCount);
+
+	// Where each wedge of from goes if from collapses onto to, false if some wedge has nowhere to go
+	auto findTargets = [&](uint32_t from, uint32_t to) {
+		uint32_t wedge = from;
+		do {
+			uint32_t target = UINT32_MAX;
+			for(uint32_t i = adjacencyOffsets[from]; i < adjacencyOffsets[from + 1]; ++i) {
+				const uint32_t* triangle = result.data() + adjacency[i] * 3;
+				if(triangle[0] != wedge && triangle[1] != wedge && triangle[2] != wedge) continue;
+
+				for(uint32_t j = 0; j < 3; ++j) {
+					if(positionIds[triangle[j]] != to) continue;
+
+					// Both sides of a seam must agree on the vertex they go to
+					if(target != UINT32_MAX && target != triangle[j]) return false;
+					target = triangle[j];
+				}
+			}
+
+			// Wedges which are no longer used by any triangle can go anywhere
+			bool used = false;
+			for(uint32_t i = adjacencyOffsets[from]; i < adjacencyOffsets[from + 1] && !used; ++i) {
+				const uint32_t* triangle = result.data() + adjacency[i] * 3;
+				used = triangle[0] == wedge || triangle[1] == wedge || triangle[2] == wedge;
+			}
+			if(used && target == UINT32_MAX) return false;
+
+			targets[wedge] = target == UINT32_MAX ? to : target;
+			wedge = wedges[wedge];
+		} while(wedge != from);
+
+		return true;
+	};
+
+	auto getCost = [&](uint32_t from, uint32_t to) {
+		Quadric quadric = quadrics[from];
+		quadric.add(quadrics[to]);
+		double cost = quadric.weight > 0.0 ? quadric.evaluate(positions.data() + to * 3) / quadric.weight : 0.0;
+
+		uint32_t wedge = from;
+		do {
+			AttributeQuadric attributeQuadric = attributeQuadrics[wedge];
+			attributeQuadric.add(attributeQuadrics[targets[wedge]]);
+			if(attributeQuadric.weight > 0.0)
+				cost += attributeQuadric.evaluate(attributes.data() + targets[wedge] * ATTRIBUTE_COUNT) / attributeQuadric.weight;
+			wedge = wedges[wedge];
+		} while(wedge != from);
+
+		return (float)std::max(cost, 0.0);
+	};
+
+	// True if moving from to to turns any triangle around from too far
+	auto flips = [&](uint32_t from, uint32_t to) {
+		const float* target = positions.data() + to * 3;
+		for(uint32_t i = adjacencyOffsets[from]; i < adjacencyOffsets[from + 1]; ++i) {
+			const uint32_t* triangle = result.data() + adjacency[i] * 3;
+			const float* corners[3];
+			const float* moved[3];
+			bool collapsed = false;
+			for(uint32_t j = 0; j < 3; ++j) {
+				const uint32_t position = positionIds[triangle[j]];
+				collapsed |= position == to;
+				corners[j] = positions.data() + position * 3;
+				moved[j] = position == from ? target : corners[j];
+			}
+			// Triangles along the edge disappear
+			if(collapsed) continue;
+
+			float before[3], after[3];
+			cross(corners[0], corners[1], corners[2], before);
+			cross(moved[0], moved[1], moved[2], after);
+			const float dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+			const float lengths = sqrtf((before[0] * before[0] + before[1] * before[1] + before[2] * before[2]) * (after[0] * after[0] + after[1] * after[1] + after[2] * after[2]));
+			if(dot <= MIN_TURN_COS * lengths) return true;
+		}
+
+		return false;
+	};
+
+	while(result.size() > targetIndexCount) {
+		const uint32_t triangleCount = (uint32_t)(result.size() / 3);
+
+		// Triangles around each position
+		std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+		for(uint32_t index : result)
+			++adjacencyOffsets[positionIds[index] + 1];
+		for(uint32_t i = 0; i < vertexCount; ++i)
+			adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+
+		adjacency.resize(result.size());
+		{
+			std::vector<uint32_t> cursors(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+			for(uint32_t i = 0; i < triangleCount * 3; ++i)
+				adjacency[cursors[positionIds[result[i]]]++] = i / 3;
+		}
+
+		// Every directed edge is a candidate, interior edges show up once in each direction
+		collapses.clear();
+		for(uint32_t i = 0; i < triangleCount * 3; ++i) {
+			const uint32_t from = positionIds[result[i]];
+			const uint32_t to = positionIds[result[i - i % 3 + (i + 1) % 3]];
+			if(from == to || locked[from] || !findTargets(from, to)) continue;
+
+			const float cost = getCost(from, to);
+			if(cost <= maxCost) collapses.push_back({ from, to, cost });
+		}
+		if(collapses.empty()) break;
+
+		std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) { return a.cost < b.cost; });
+
+		// Only the cheaper half is collapsed in each pass, so the order of the costs is mostly kept
+		const size_t collapseLimit = std::max<size_t>(collapses.size() / 2, 1);
+		uint32_t removedCount = 0;
+		const uint32_t removeGoal = (uint32_t)((result.size() - targetIndexCount + 2) / 3);
+
+		for(uint32_t i = 0; i < vertexCount; ++i)
+			remap[i] = i;
+		std::fill(touched.begin(), touched.end(), false);
+
+		for(size_t i = 0; i < collapseLimit && removedCount < removeGoal; ++i) {
+			const Collapse& collapse = collapses[i];
+			// The adjacency is stale around positions which were touched, so they wait for the next pass
+			if(touched[collapse.from] || touched[collapse.to]) continue;
+			if(flips(collapse.from, collapse.to)) continue;
+			// Other candidates have overwritten the targets since
+			findTargets(collapse.from, collapse.to);
+
+			uint32_t wedge = collapse.from;
+			do {
+				remap[wedge] = targets[wedge];
+				attributeQuadrics[targets[wedge]].add(attributeQuadrics[wedge]);
+				wedge = wedges[wedge];
+			} while(wedge != collapse.from);
+			quadrics[collapse.to].add(quadrics[collapse.from]);
+
+			for(uint32_t j = adjacencyOffsets[collapse.from]; j < adjacencyOffsets[collapse.from + 1]; ++j) {
+				const uint32_t* triangle = result.data() + adjacency[j] * 3;
+				bool removed = false;
+				for(uint32_t k = 0; k < 3; ++k) {
+					touched[positionIds[triangle[k]]] = true;
+					removed |= positionIds[triangle[k]] == collapse.to;
+				}
+				if(removed) ++removedCount;
+			}
+
+			resultCost = std::max(resultCost, collapse.cost);
+		}
+
+		// Apply the collapses and drop the triangles which became degenerate
+		size_t writeIndex = 0;
+		for(size_t i = 0; i < result.size(); i += 3) {
+			const uint32_t a = remap[result[i]], b = remap[result[i + 1]], c = remap[result[i + 2]];
+			if(positionIds[a] == positionIds[b] || positionIds[b] == positionIds[c] || positionIds[a] == positionIds[c]) continue;
+
+			result[writeIndex] = a;
+			result[writeIndex + 1] = b;
+			result[writeIndex + 2] = c;
+			writeIndex += 3;
+		}
+
+		if(writeIndex == result.size()) break;
+		result.resize(writeIndex);
+	}
+
+	memcpy(destination, result.data(), result.size() * sizeof(uint32_t));
+
+	return { (uint32_t)result.size(), sqrtf(resultCost) };
+}
+
+std::vector<float> generateLODs(MeshData& mesh, const LODSettings& settings) {
+	std::vector<float> errors(mesh.lodCount());
+
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+	const uint32_t vertexCount = mesh.vertexCounts[0];
+	const uint32_t indexCount = mesh.indexCounts[0];
+	const uint32_t lodCount = std::min(settings.lodCount, RIN::LOD_COUNT);
+	const uint32_t lodStart = mesh.lodCount();
+
+	std::vector<uint32_t> indices(indexCount);
+	std::vector<char> vertices;
+	for(uint32_t i = mesh.lodCount(); i < lodCount; ++i) {
+		const uint32_t targetIndexCount = (uint32_t)(indexCount / 3 * settings.ratios[i]) * 3;
+		const SimplifyResult result = simplifyMesh(
+			mesh.vertices.data(),
+			vertexCount,
+			stride,
+			mesh.boundingSphere,
+			mesh.indices.data(),
+			indexCount,
+			targetIndexCount,
+			settings.maxError,
+			indices.data()
+		);
+
+		// A LOD which is no simpler than the last one is no use
+		if(result.indexCount >= mesh.indexCounts.back()) break;
+
+		optimizeVertexCache(indices.data(), result.indexCount, vertexCount);
+
+		// Shared LODs index straight into the vertices of LOD 0, which are reordered once every LOD is generated
+		uint32_t lodVertexCount = vertexCount;
+		if(!mesh.sharedVertices) {
+			// The LOD gets its own copy of the vertices it uses
+			vertices.assign(mesh.vertices.begin(), mesh.vertices.begin() + (uint64_t)vertexCount * stride);
+			lodVertexCount = optimizeVertexFetch(vertices.data(), vertexCount, stride, indices.data(), result.indexCount);
+			mesh.vertices.insert(mesh.vertices.end(), vertices.begin(), vertices.begin() + (uint64_t)lodVertexCount * stride);
+		}
+
+		mesh.indices.insert(mesh.indices.end(), indices.begin(), indices.begin() + result.indexCount);
+		mesh.vertexCounts.push_back(lodVertexCount);
+		mesh.indexCounts.push_back(result.indexCount);
+		errors.push_back(result.error);
+	}
+
+	// Put the vertices back into an order where each LOD uses a prefix of them
+	if(mesh.sharedVertices && mesh.lodCount() > lodStart) shareLODVertices(mesh);
+
+	return errors;
+}
\ No newline at end of file
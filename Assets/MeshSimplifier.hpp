@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Config.hpp>
+
+struct MeshData;
+
+/*
+Mesh simplification with quadric error metrics
+
+Edges are collapsed onto one of their vertices, so a simplified LOD only
+uses vertices of the original, vertices are never moved or blended
+
+The cost of a collapse is the plane quadric error of the new position,
+weighted by triangle area (Garland and Heckbert), plus the squared error
+of the normal and texture coordinates of every vertex which is replaced,
+scaled by SIMPLIFY_NORMAL_WEIGHT and SIMPLIFY_TEX_WEIGHT
+
+Vertices which share a position, such as along a UV seam, are collapsed
+together, and only along edges where each of them has a vertex to go to,
+so seams stay closed
+Vertices on the border of the mesh or on non-manifold edges are locked,
+and collapses which would flip or sharply turn a triangle are skipped
+
+Errors are relative to the radius of the bounding sphere and are the square
+root of the largest collapse cost, which makes them roughly the distance
+the surface moved
+
+Vertices use the layout shared by StaticVertex, DynamicVertex and SkinnedVertex
+
+Thread Safety:
+All functions are thread-safe
+*/
+
+constexpr float SIMPLIFY_NORMAL_WEIGHT = 0.01f;
+constexpr float SIMPLIFY_TEX_WEIGHT = 0.1f;
+
+struct SimplifyResult {
+	uint32_t indexCount;
+	float error;
+};
+
+/*
+Collapses edges until at most targetIndexCount indices are left or the
+next collapse would cost more than maxError, destination must hold indexCount indices
+boundingSphere is the center and radius used to make the error relative
+*/
+SimplifyResult simplifyMesh(
+	const char* vertices,
+	uint32_t vertexCount,
+	uint32_t stride,
+	const float boundingSphere[4],
+	const uint32_t* indices,
+	uint32_t indexCount,
+	uint32_t targetIndexCount,
+	float maxError,
+	uint32_t* destination
+);
+
+struct LODSettings {
+	// LODs are generated until the mesh has lodCount, at most RIN::LOD_COUNT
+	uint32_t lodCount = RIN::LOD_COUNT;
+	// Target triangle count of each LOD relative to LOD 0, the first is unused
+	float ratios[RIN::LOD_COUNT]{ 1.0f, 0.5f, 0.25f };
+	// LODs stop simplifying before their error passes this
+	float maxError = 0.05f;
+};
+
+/*
+Appends the LODs the mesh is missing, each simplified from LOD 0 and
+optimized with MeshOptimizer, generation stops early if a LOD could not
+be made simpler than the one before it
+The LODs of shared meshes index into the vertices of LOD 0 and the
+vertices are reordered with shareLODVertices
+Returns the error of each LOD, 0 for the ones which were already there
+*/
+std::vector<float> generateLODs(MeshData& mesh, const LODSettings& settings);
\ No newline at end of file
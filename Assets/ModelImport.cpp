@@ -0,0 +1,795 @@
+#include "ModelImport.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#include "Json.hpp"
+
+// Column-major column vector 4x4 matrices, the layout glTF uses, element (row, column) is m[column * 4 + row]
+// The same array read row-major is the row vector matrix RIN uses
+typedef float Matrix[16];
+
+static void setIdentity(Matrix m) {
+	memset(m, 0, sizeof(Matrix));
+	m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+static void multiply(const Matrix a, const Matrix b, Matrix result) {
+	Matrix product;
+	for(uint32_t column = 0; column < 4; ++column) {
+		for(uint32_t row = 0; row < 4; ++row) {
+			float sum = 0.0f;
+			for(uint32_t k = 0; k < 4; ++k)
+				sum += a[k * 4 + row] * b[column * 4 + k];
+			product[column * 4 + row] = sum;
+		}
+	}
+	memcpy(result, product, sizeof(Matrix));
+}
+
+// Returns false if m is singular
+static bool invert(const Matrix m, Matrix result) {
+	Matrix inverse;
+	inverse[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+	inverse[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+	inverse[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+	inverse[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+	inverse[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+	inverse[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+	inverse[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+	inverse[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+	inverse[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+	inverse[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+	inverse[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+	inverse[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+	inverse[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+	inverse[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+	inverse[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+	inverse[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+	const float determinant = m[0] * inverse[0] + m[1] * inverse[4] + m[2] * inverse[8] + m[3] * inverse[12];
+	if(determinant == 0.0f) return false;
+
+	for(uint32_t i = 0; i < 16; ++i)
+		result[i] = inverse[i] / determinant;
+	return true;
+}
+
+static float getDeterminant3x3(const Matrix m) {
+	return m[0] * (m[5] * m[10] - m[9] * m[6]) - m[4] * (m[1] * m[10] - m[9] * m[2]) + m[8] * (m[1] * m[6] - m[5] * m[2]);
+}
+
+// Y up to Z up, which is a rotation about the X axis, (x, y, z) -> (x, -z, y)
+static void convertVector(float* v) {
+	const float y = v[1];
+	v[1] = -v[2];
+	v[2] = y;
+}
+
+// C * m * C^-1 where C is the rotation of convertVector
+static void convertMatrix(Matrix m) {
+	Matrix c{ 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+	Matrix inverse{ 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+	multiply(c, m, m);
+	multiply(m, inverse, m);
+}
+
+static void convertModel(ImportedModel& model) {
+	for(ImportedMesh& mesh : model.meshes) {
+		for(size_t j = 0; j < mesh.positions.size(); j += 3)
+			convertVector(mesh.positions.data() + j);
+		for(size_t j = 0; j < mesh.normals.size(); j += 3)
+			convertVector(mesh.normals.data() + j);
+	}
+
+	for(ImportedBone& bone : model.bones)
+		convertMatrix(bone.restMatrix);
+}
+
+struct GLTFBuffer {
+	const char* data;
+	uint64_t size;
+};
+
+struct GLTFFile {
+	JsonValue root;
+	std::vector<GLTFBuffer> buffers;
+	// Buffers which were decoded or read from other files
+	std::vector<std::vector<char>> storage;
+};
+
+static bool decodeBase64(const char* text, size_t length, std::vector<char>& data) {
+	uint32_t bits = 0, bitCount = 0;
+	for(size_t i = 0; i < length; ++i) {
+		const char c = text[i];
+		uint32_t value;
+		if(c >= 'A' && c <= 'Z') value = c - 'A';
+		else if(c >= 'a' && c <= 'z') value = c - 'a' + 26;
+		else if(c >= '0' && c <= '9') value = c - '0' + 52;
+		else if(c == '+' || c == '-') value = 62;
+		else if(c == '/' || c == '_') value = 63;
+		else if(c == '=') break;
+		else return false;
+
+		bits = bits << 6 | value;
+		bitCount += 6;
+		if(bitCount >= 8) {
+			bitCount -= 8;
+			data.push_back((char)(bits >> bitCount));
+		}
+	}
+
+	return true;
+}
+
+// Undoes percent encoding in relative URIs
+static std::string decodeURI(const std::string& uri) {
+	std::string decoded;
+	for(size_t i = 0; i < uri.size(); ++i) {
+		if(uri[i] == '%' && i + 2 < uri.size()) {
+			char hex[3]{ uri[i + 1], uri[i + 2], 0 };
+			decoded += (char)strtol(hex, nullptr, 16);
+			i += 2;
+		} else decoded += uri[i];
+	}
+
+	return decoded;
+}
+
+static bool loadBuffers(GLTFFile& file, const char* binaryChunk, uint64_t binaryChunkSize, const std::filesystem::path& directory) {
+	const JsonValue* buffers = file.root.find("buffers");
+	if(!buffers) return true;
+	if(buffers->type != JSON_TYPE::ARRAY) return false;
+
+	file.storage.reserve(buffers->elements.size());
+	for(size_t i = 0; i < buffers->elements.size(); ++i) {
+		const JsonValue& buffer = buffers->elements[i];
+		const uint64_t byteLength = (uint64_t)buffer.getNumber("byteLength", 0.0);
+		const JsonValue* uri = buffer.find("uri");
+
+		if(!uri) {
+			// Only the first buffer of a .glb may leave out the URI, it is the binary chunk
+			if(i || !binaryChunk || binaryChunkSize < byteLength) return false;
+			file.buffers.push_back({ binaryChunk, byteLength });
+			continue;
+		}
+		if(uri->type != JSON_TYPE::STRING) return false;
+
+		std::vector<char>& data = file.storage.emplace_back();
+		if(!uri->string.compare(0, 5, "data:")) {
+			const size_t comma = uri->string.find(',');
+			if(comma == std::string::npos || uri->string.rfind(";base64", comma) == std::string::npos) return false;
+			if(!decodeBase64(uri->string.data() + comma + 1, uri->string.size() - comma - 1, data)) return false;
+		} else {
+			std::ifstream stream(directory / std::filesystem::u8path(decodeURI(uri->string)), std::ios::binary | std::ios::ate);
+			if(!stream.is_open()) return false;
+
+			data.resize(stream.tellg());
+			stream.seekg(0);
+			stream.read(data.data(), data.size());
+			if(!stream) return false;
+		}
+
+		if(data.size() < byteLength) return false;
+		file.buffers.push_back({ data.data(), byteLength });
+	}
+
+	return true;
+}
+
+static uint32_t getComponentCount(const char* type) {
+	if(!strcmp(type, "SCALAR")) return 1;
+	if(!strcmp(type, "VEC2")) return 2;
+	if(!strcmp(type, "VEC3")) return 3;
+	if(!strcmp(type, "VEC4")) return 4;
+	if(!strcmp(type, "MAT4")) return 16;
+	return 0;
+}
+
+static uint32_t getComponentSize(uint32_t componentType) {
+	switch(componentType) {
+	case 5120: // BYTE
+	case 5121: // UNSIGNED_BYTE
+		return 1;
+	case 5122: // SHORT
+	case 5123: // UNSIGNED_SHORT
+		return 2;
+	case 5125: // UNSIGNED_INT
+	case 5126: // FLOAT
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+static float readComponent(const char* data, uint32_t componentType, bool normalized) {
+	switch(componentType) {
+	case 5120:
+	{
+		int8_t value;
+		memcpy(&value, data, sizeof(value));
+		return normalized ? std::max(value / 127.0f, -1.0f) : value;
+	}
+	case 5121:
+		return normalized ? (uint8_t)*data / 255.0f : (uint8_t)*data;
+	case 5122:
+	{
+		int16_t value;
+		memcpy(&value, data, sizeof(value));
+		return normalized ? std::max(value / 32767.0f, -1.0f) : value;
+	}
+	case 5123:
+	{
+		uint16_t value;
+		memcpy(&value, data, sizeof(value));
+		return normalized ? value / 65535.0f : value;
+	}
+	case 5125:
+	{
+		uint32_t value;
+		memcpy(&value, data, sizeof(value));
+		return (float)value;
+	}
+	default:
+	{
+		float value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+	}
+}
+
+// Reads an accessor with componentCount components into floats, returns false if it is invalid or has a different type
+static bool readAccessor(const GLTFFile& file, const JsonValue* index, uint32_t componentCount, std::vector<float>& values) {
+	if(!index || index->type != JSON_TYPE::NUMBER) return false;
+	const JsonValue* accessor = file.root.find("accessors") ? file.root.find("accessors")->at((size_t)index->number) : nullptr;
+	if(!accessor || accessor->find("sparse")) return false;
+	if(getComponentCount(accessor->getString("type", "")) != componentCount) return false;
+
+	const uint32_t componentType = (uint32_t)accessor->getNumber("componentType", 0.0);
+	const uint32_t componentSize = getComponentSize(componentType);
+	const uint64_t count = (uint64_t)accessor->getNumber("count", 0.0);
+	const JsonValue* normalized = accessor->find("normalized");
+	if(!componentSize) return false;
+
+	values.assign(count * componentCount, 0.0f);
+	// Accessors without a buffer view are all zeros
+	const JsonValue* viewIndex = accessor->find("bufferView");
+	if(!viewIndex) return true;
+
+	const JsonValue* view = file.root.find("bufferViews") ? file.root.find("bufferViews")->at((size_t)viewIndex->number) : nullptr;
+	if(!view) return false;
+
+	const size_t bufferIndex = (size_t)view->getNumber("buffer", -1.0);
+	if(bufferIndex >= file.buffers.size()) return false;
+	const GLTFBuffer& buffer = file.buffers[bufferIndex];
+
+	const uint64_t viewOffset = (uint64_t)view->getNumber("byteOffset", 0.0);
+	const uint64_t viewLength = (uint64_t)view->getNumber("byteLength", 0.0);
+	if(viewOffset > buffer.size || viewLength > buffer.size - viewOffset) return false;
+
+	const uint64_t elementSize = (uint64_t)componentSize * componentCount;
+	const uint64_t stride = (uint64_t)view->getNumber("byteStride", (double)elementSize);
+	const uint64_t offset = (uint64_t)accessor->getNumber("byteOffset", 0.0);
+	if(count && (stride < elementSize || offset + (count - 1) * stride + elementSize > viewLength)) return false;
+
+	const char* data = buffer.data + viewOffset + offset;
+	for(uint64_t i = 0; i < count; ++i)
+		for(uint32_t j = 0; j < componentCount; ++j)
+			values[i * componentCount + j] = readComponent(data + i * stride + j * componentSize, componentType, normalized && normalized->boolean);
+
+	return true;
+}
+
+struct GLTFImport {
+	const GLTFFile& file;
+	ImportedModel& model;
+	const JsonValue* nodes;
+	// Skin joint index to bone index
+	std::vector<uint32_t> jointBones;
+	std::vector<bool> visited;
+
+	bool importSkin(const JsonValue& skin) {
+		const JsonValue* joints = skin.find("joints");
+		if(!joints || joints->type != JSON_TYPE::ARRAY || joints->elements.empty()) return false;
+		if(joints->elements.size() > MAX_BONE_COUNT) return false;
+
+		const size_t nodeCount = nodes->elements.size();
+		std::vector<uint32_t> parents(nodeCount, UINT32_MAX);
+		for(size_t i = 0; i < nodeCount; ++i) {
+			const JsonValue* children = nodes->elements[i].find("children");
+			if(!children) continue;
+			for(const JsonValue& child : children->elements)
+				if((size_t)child.number < nodeCount) parents[(size_t)child.number] = (uint32_t)i;
+		}
+
+		std::vector<uint32_t> jointNodes;
+		std::vector<uint32_t> nodeJoints(nodeCount, UINT32_MAX);
+		for(const JsonValue& joint : joints->elements) {
+			const size_t node = (size_t)joint.number;
+			if(joint.type != JSON_TYPE::NUMBER || node >= nodeCount || nodeJoints[node] != UINT32_MAX) return false;
+			nodeJoints[node] = (uint32_t)jointNodes.size();
+			jointNodes.push_back((uint32_t)node);
+		}
+
+		// The parent of a joint is its closest ancestor which is a joint
+		std::vector<uint32_t> jointParents(jointNodes.size(), UINT32_MAX);
+		uint32_t root = UINT32_MAX;
+		for(uint32_t i = 0; i < jointNodes.size(); ++i) {
+			uint32_t node = parents[jointNodes[i]];
+			for(size_t depth = 0; node != UINT32_MAX && nodeJoints[node] == UINT32_MAX && depth < nodeCount; ++depth)
+				node = parents[node];
+
+			if(node != UINT32_MAX && nodeJoints[node] != UINT32_MAX) jointParents[i] = nodeJoints[node];
+			else if(root != UINT32_MAX) return false;
+			else root = i;
+		}
+		if(root == UINT32_MAX) return false;
+
+		std::vector<float> inverseBindMatrices;
+		if(skin.find("inverseBindMatrices")) {
+			if(!readAccessor(file, skin.find("inverseBindMatrices"), 16, inverseBindMatrices)) return false;
+			if(inverseBindMatrices.size() < jointNodes.size() * 16) return false;
+		}
+
+		// Breadth first from the root, so parents come before their children
+		jointBones.assign(jointNodes.size(), UINT32_MAX);
+		std::vector<uint32_t> order{ root };
+		jointBones[root] = 0;
+		for(size_t i = 0; i < order.size(); ++i) {
+			for(uint32_t j = 0; j < jointNodes.size(); ++j) {
+				if(jointParents[j] == order[i] && jointBones[j] == UINT32_MAX) {
+					jointBones[j] = (uint32_t)order.size();
+					order.push_back(j);
+				}
+			}
+		}
+		if(order.size() != jointNodes.size()) return false;
+
+		for(uint32_t joint : order) {
+			ImportedBone& bone = model.bones.emplace_back();
+			bone.name = nodes->elements[jointNodes[joint]].getString("name", "");
+			bone.parent = jointBones[joint == root ? root : jointParents[joint]];
+
+			// The rest pose is the inverse of the inverse bind matrix, which is in the space of the skinned meshes
+			if(inverseBindMatrices.empty()) setIdentity(bone.restMatrix);
+			else if(!invert(inverseBindMatrices.data() + joint * 16, bone.restMatrix)) return false;
+		}
+
+		return true;
+	}
+
+	bool importPrimitive(const JsonValue& primitive, const char* name, const Matrix world, bool skinned) {
+		const uint32_t mode = (uint32_t)primitive.getNumber("mode", 4.0);
+		// Points and lines
+		if(mode < 4) return true;
+		if(mode > 6) return false;
+
+		const JsonValue* attributes = primitive.find("attributes");
+		if(!attributes) return false;
+
+		ImportedMesh& mesh = model.meshes.emplace_back();
+		mesh.name = name;
+		if(!readAccessor(file, attributes->find("POSITION"), 3, mesh.positions)) return false;
+		const uint32_t vertexCount = mesh.vertexCount();
+
+		if(attributes->find("NORMAL") && (!readAccessor(file, attributes->find("NORMAL"), 3, mesh.normals) || mesh.normals.size() != vertexCount * 3)) return false;
+		if(attributes->find("TEXCOORD_0")) {
+			if(!readAccessor(file, attributes->find("TEXCOORD_0"), 2, mesh.texCoords) || mesh.texCoords.size() != vertexCount * 2) return false;
+			// glTF puts the origin at the top left
+			for(size_t i = 1; i < mesh.texCoords.size(); i += 2)
+				mesh.texCoords[i] = 1.0f - mesh.texCoords[i];
+		}
+
+		if(skinned && !importInfluences(*attributes, mesh)) return false;
+
+		std::vector<uint32_t> indices;
+		if(primitive.find("indices")) {
+			std::vector<float> values;
+			if(!readAccessor(file, primitive.find("indices"), 1, values)) return false;
+			indices.reserve(values.size());
+			for(float value : values) {
+				if(value >= vertexCount) return false;
+				indices.push_back((uint32_t)value);
+			}
+		} else {
+			for(uint32_t i = 0; i < vertexCount; ++i)
+				indices.push_back(i);
+		}
+
+		// Mirroring transforms flip the winding
+		const bool mirrored = !skinned && getDeterminant3x3(world) < 0.0f;
+		auto addTriangle = [&mesh, mirrored](uint32_t a, uint32_t b, uint32_t c) {
+			if(mirrored) std::swap(b, c);
+			mesh.indices.insert(mesh.indices.end(), { a, b, c });
+		};
+
+		if(mode == 4) {
+			for(size_t i = 0; i + 2 < indices.size(); i += 3)
+				addTriangle(indices[i], indices[i + 1], indices[i + 2]);
+		} else if(mode == 5) {
+			// Every other triangle of a strip is flipped to keep the winding
+			for(size_t i = 0; i + 2 < indices.size(); ++i) {
+				if(i & 1) addTriangle(indices[i + 1], indices[i], indices[i + 2]);
+				else addTriangle(indices[i], indices[i + 1], indices[i + 2]);
+			}
+		} else {
+			for(size_t i = 1; i + 1 < indices.size(); ++i)
+				addTriangle(indices[0], indices[i], indices[i + 1]);
+		}
+
+		// Skinned meshes stay in the bind space of the skin
+		if(!skinned) {
+			Matrix normalMatrix;
+			if(!invert(world, normalMatrix)) setIdentity(normalMatrix);
+
+			for(size_t i = 0; i < mesh.positions.size(); i += 3) {
+				const float* p = mesh.positions.data() + i;
+				const float x = p[0], y = p[1], z = p[2];
+				for(uint32_t j = 0; j < 3; ++j)
+					mesh.positions[i + j] = world[j] * x + world[4 + j] * y + world[8 + j] * z + world[12 + j];
+			}
+
+			// Normals go through the inverse transpose
+			for(size_t i = 0; i < mesh.normals.size(); i += 3) {
+				const float* n = mesh.normals.data() + i;
+				const float x = n[0], y = n[1], z = n[2];
+				float normal[3];
+				for(uint32_t j = 0; j < 3; ++j)
+					normal[j] = normalMatrix[j * 4] * x + normalMatrix[j * 4 + 1] * y + normalMatrix[j * 4 + 2] * z;
+
+				const float length = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+				for(uint32_t j = 0; j < 3; ++j)
+					mesh.normals[i + j] = length > 0.0f ? normal[j] / length : 0.0f;
+			}
+		}
+
+		return true;
+	}
+
+	// Keeps the MAX_BONE_INFLUENCES largest weights of JOINTS_0 and JOINTS_1
+	bool importInfluences(const JsonValue& attributes, ImportedMesh& mesh) {
+		const uint32_t vertexCount = mesh.vertexCount();
+		mesh.boneIndices.assign(vertexCount * MAX_BONE_INFLUENCES, 0);
+		mesh.boneWeights.assign(vertexCount * MAX_BONE_INFLUENCES, 0.0f);
+
+		std::vector<std::pair<float, uint32_t>> influences(vertexCount * MAX_BONE_INFLUENCES * 2, { 0.0f, 0 });
+		for(uint32_t set = 0; set < 2; ++set) {
+			const std::string joints = "JOINTS_" + std::to_string(set), weights = "WEIGHTS_" + std::to_string(set);
+			if(!attributes.find(joints.c_str())) continue;
+
+			std::vector<float> jointValues, weightValues;
+			if(!readAccessor(file, attributes.find(joints.c_str()), 4, jointValues) || jointValues.size() != vertexCount * 4) return false;
+			if(!readAccessor(file, attributes.find(weights.c_str()), 4, weightValues) || weightValues.size() != vertexCount * 4) return false;
+
+			for(uint32_t i = 0; i < vertexCount * 4; ++i) {
+				const uint32_t joint = (uint32_t)jointValues[i];
+				if(weightValues[i] <= 0.0f) continue;
+				if(joint >= jointBones.size()) return false;
+				influences[(i / 4) * 8 + set * 4 + i % 4] = { weightValues[i], jointBones[joint] };
+			}
+		}
+
+		for(uint32_t i = 0; i < vertexCount; ++i) {
+			std::pair<float, uint32_t>* vertex = influences.data() + i * 8;
+			std::partial_sort(vertex, vertex + MAX_BONE_INFLUENCES, vertex + 8,
+				[](const std::pair<float, uint32_t>& a, const std::pair<float, uint32_t>& b) { return a.first > b.first; });
+
+			for(uint32_t j = 0; j < MAX_BONE_INFLUENCES; ++j) {
+				mesh.boneWeights[i * MAX_BONE_INFLUENCES + j] = vertex[j].first;
+				mesh.boneIndices[i * MAX_BONE_INFLUENCES + j] = (uint8_t)vertex[j].second;
+			}
+		}
+
+		return true;
+	}
+
+	bool importNode(uint32_t index, const Matrix parentWorld) {
+		const JsonValue* node = nodes->at(index);
+		// Nodes must form a tree
+		if(!node || visited[index]) return false;
+		visited[index] = true;
+
+		Matrix local;
+		const JsonValue* matrix = node->find("matrix");
+		if(matrix && matrix->elements.size() == 16) {
+			for(uint32_t i = 0; i < 16; ++i)
+				local[i] = (float)matrix->elements[i].number;
+		} else {
+			float t[3]{}, r[4]{ 0.0f, 0.0f, 0.0f, 1.0f }, s[3]{ 1.0f, 1.0f, 1.0f };
+			if(const JsonValue* translation = node->find("translation"); translation && translation->elements.size() == 3)
+				for(uint32_t i = 0; i < 3; ++i) t[i] = (float)translation->elements[i].number;
+			if(const JsonValue* rotation = node->find("rotation"); rotation && rotation->elements.size() == 4)
+				for(uint32_t i = 0; i < 4; ++i) r[i] = (float)rotation->elements[i].number;
+			if(const JsonValue* scale = node->find("scale"); scale && scale->elements.size() == 3)
+				for(uint32_t i = 0; i < 3; ++i) s[i] = (float)scale->elements[i].number;
+
+			// T * R * S from the unit quaternion (x, y, z, w)
+			const float x = r[0], y = r[1], z = r[2], w = r[3];
+			const float rotationMatrix[9]{
+				1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w),
+				2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w),
+				2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y)
+			};
+			for(uint32_t column = 0; column < 3; ++column) {
+				for(uint32_t row = 0; row < 3; ++row)
+					local[column * 4 + row] = rotationMatrix[column * 3 + row] * s[column];
+				local[column * 4 + 3] = 0.0f;
+			}
+			local[12] = t[0];
+			local[13] = t[1];
+			local[14] = t[2];
+			local[15] = 1.0f;
+		}
+
+		Matrix world;
+		multiply(parentWorld, local, world);
+
+		if(const JsonValue* meshIndex = node->find("mesh")) {
+			const JsonValue* meshes = file.root.find("meshes");
+			const JsonValue* mesh = meshes ? meshes->at((size_t)meshIndex->number) : nullptr;
+			const JsonValue* primitives = mesh ? mesh->find("primitives") : nullptr;
+			if(!primitives) return false;
+
+			// Only meshes bound to the first skin are skinned, the others are left out
+			const JsonValue* skin = node->find("skin");
+			const bool skinned = skin && skin->number == 0.0;
+			if(!skin || skinned) {
+				const char* name = node->getString("name", mesh->getString("name", ""));
+				for(const JsonValue& primitive : primitives->elements)
+					if(!importPrimitive(primitive, name, world, skinned)) return false;
+			}
+		}
+
+		if(const JsonValue* children = node->find("children")) {
+			for(const JsonValue& child : children->elements)
+				if(!importNode((uint32_t)child.number, world)) return false;
+		}
+
+		return true;
+	}
+};
+
+bool importGLTF(const char* data, uint64_t size, const std::filesystem::path& directory, ImportedModel& model) {
+	model = ImportedModel();
+	GLTFFile file;
+
+	const char* json = data;
+	uint64_t jsonSize = size;
+	const char* binaryChunk = nullptr;
+	uint64_t binaryChunkSize = 0;
+
+	// A .glb is a header followed by a JSON chunk and an optional binary chunk
+	if(size >= 12 && !memcmp(data, "glTF", 4)) {
+		uint32_t header[3];
+		memcpy(header, data, sizeof(header));
+		if(header[1] != 2 || header[2] > size) return false;
+		size = header[2];
+
+		uint64_t offset = 12;
+		json = nullptr;
+		while(offset + 8 <= size) {
+			uint32_t chunk[2];
+			memcpy(chunk, data + offset, sizeof(chunk));
+			offset += 8;
+			if(chunk[0] > size - offset) return false;
+
+			if(chunk[1] == 0x4E4F534A && !json) {
+				json = data + offset;
+				jsonSize = chunk[0];
+			} else if(chunk[1] == 0x004E4942 && !binaryChunk) {
+				binaryChunk = data + offset;
+				binaryChunkSize = chunk[0];
+			}
+
+			offset += (chunk[0] + 3) & ~3ull;
+		}
+
+		if(!json) return false;
+	}
+
+	if(!parseJson(json, jsonSize, file.root) || file.root.type != JSON_TYPE::OBJECT) return false;
+	const JsonValue* asset = file.root.find("asset");
+	if(!asset || strncmp(asset->getString("version", ""), "2.", 2)) return false;
+	if(!loadBuffers(file, binaryChunk, binaryChunkSize, directory)) return false;
+
+	JsonValue emptyNodes;
+	emptyNodes.type = JSON_TYPE::ARRAY;
+	const JsonValue* nodes = file.root.find("nodes");
+	if(!nodes || nodes->type != JSON_TYPE::ARRAY) nodes = &emptyNodes;
+
+	GLTFImport import{ file, model, nodes, {}, std::vector<bool>(nodes->elements.size()) };
+
+	const JsonValue* skins = file.root.find("skins");
+	if(skins && skins->at(0) && !import.importSkin(*skins->at(0))) return false;
+
+	// The default scene, or every node which is not a child if there are no scenes
+	std::vector<uint32_t> roots;
+	const JsonValue* scenes = file.root.find("scenes");
+	const JsonValue* scene = scenes ? scenes->at((size_t)file.root.getNumber("scene", 0.0)) : nullptr;
+	if(scene) {
+		if(const JsonValue* sceneNodes = scene->find("nodes"))
+			for(const JsonValue& node : sceneNodes->elements)
+				roots.push_back((uint32_t)node.number);
+	} else {
+		std::vector<bool> children(nodes->elements.size());
+		for(const JsonValue& node : nodes->elements)
+			if(const JsonValue* nodeChildren = node.find("children"))
+				for(const JsonValue& child : nodeChildren->elements)
+					if((size_t)child.number < children.size()) children[(size_t)child.number] = true;
+		for(uint32_t i = 0; i < children.size(); ++i)
+			if(!children[i]) roots.push_back(i);
+	}
+
+	Matrix identity;
+	setIdentity(identity);
+	for(uint32_t root : roots)
+		if(!import.importNode(root, identity)) return false;
+
+	convertModel(model);
+	return true;
+}
+
+// Parses whitespace separated floats from [data, end), returns how many were read
+static uint32_t parseFloats(const char*& data, const char* end, float* values, uint32_t maxCount) {
+	uint32_t count = 0;
+	while(count < maxCount) {
+		while(data < end && (*data == ' ' || *data == '\t'))
+			++data;
+
+		const std::from_chars_result result = std::from_chars(data, end, values[count]);
+		if(result.ec != std::errc()) break;
+
+		data = result.ptr;
+		++count;
+	}
+
+	return count;
+}
+
+struct OBJCorner {
+	int32_t position;
+	int32_t texCoord;
+	int32_t normal;
+
+	bool operator==(const OBJCorner& other) const {
+		return position == other.position && texCoord == other.texCoord && normal == other.normal;
+	}
+};
+
+struct OBJCornerHash {
+	size_t operator()(const OBJCorner& corner) const {
+		return ((size_t)corner.position * 73856093) ^ ((size_t)corner.texCoord * 19349663) ^ ((size_t)corner.normal * 83492791);
+	}
+};
+
+bool importOBJ(const char* data, uint64_t size, ImportedModel& model) {
+	model = ImportedModel();
+
+	std::vector<float> positions, texCoords, normals;
+	std::unordered_map<OBJCorner, uint32_t, OBJCornerHash> corners;
+	std::string name;
+	bool hasTexCoords = false, hasNormals = false;
+	ImportedMesh* mesh = nullptr;
+
+	// Drops the arrays the mesh never used
+	auto finishMesh = [&]() {
+		if(!mesh) return;
+		if(!hasTexCoords) mesh->texCoords.clear();
+		if(!hasNormals) mesh->normals.clear();
+		if(mesh->indices.empty()) model.meshes.pop_back();
+		mesh = nullptr;
+	};
+
+	const char* end = data + size;
+	while(data < end) {
+		const char* lineEnd = (const char*)memchr(data, '\n', end - data);
+		if(!lineEnd) lineEnd = end;
+		const char* line = data;
+		data = lineEnd + 1;
+
+		while(line < lineEnd && (*line == ' ' || *line == '\t'))
+			++line;
+		const char* keywordEnd = line;
+		while(keywordEnd < lineEnd && *keywordEnd != ' ' && *keywordEnd != '\t')
+			++keywordEnd;
+		const std::string keyword(line, keywordEnd);
+		line = keywordEnd;
+
+		if(keyword == "v") {
+			float values[3];
+			if(parseFloats(line, lineEnd, values, 3) != 3) return false;
+			positions.insert(positions.end(), values, values + 3);
+		} else if(keyword == "vt") {
+			float values[2]{};
+			if(!parseFloats(line, lineEnd, values, 2)) return false;
+			texCoords.insert(texCoords.end(), values, values + 2);
+		} else if(keyword == "vn") {
+			float values[3];
+			if(parseFloats(line, lineEnd, values, 3) != 3) return false;
+			normals.insert(normals.end(), values, values + 3);
+		} else if(keyword == "o" || keyword == "g") {
+			finishMesh();
+			while(line < lineEnd && (*line == ' ' || *line == '\t'))
+				++line;
+			name.assign(line, lineEnd);
+			while(!name.empty() && (name.back() == '\r' || name.back() == ' ')) name.pop_back();
+		} else if(keyword == "f") {
+			if(!mesh) {
+				mesh = &model.meshes.emplace_back();
+				mesh->name = name;
+				corners.clear();
+				hasTexCoords = hasNormals = false;
+			}
+
+			std::vector<uint32_t> face;
+			while(true) {
+				while(line < lineEnd && (*line == ' ' || *line == '\t'))
+					++line;
+				if(line == lineEnd || *line == '\r') break;
+
+				// v, v/vt, v//vn or v/vt/vn, negative indices count back from the end
+				int32_t values[3]{};
+				const int32_t counts[3]{ (int32_t)positions.size() / 3, (int32_t)texCoords.size() / 2, (int32_t)normals.size() / 3 };
+				for(uint32_t i = 0; i < 3 && line < lineEnd; ++i) {
+					if(*line != '/') {
+						const std::from_chars_result result = std::from_chars(line, lineEnd, values[i]);
+						if(result.ec != std::errc()) return false;
+						line = result.ptr;
+
+						values[i] = values[i] < 0 ? counts[i] + values[i] : values[i] - 1;
+						if(values[i] < 0 || values[i] >= counts[i]) return false;
+						++values[i];
+					}
+					if(line == lineEnd || *line != '/') break;
+					++line;
+				}
+				if(!values[0]) return false;
+
+				const OBJCorner corner{ values[0] - 1, values[1] - 1, values[2] - 1 };
+				auto [it, inserted] = corners.try_emplace(corner, mesh->vertexCount());
+				if(inserted) {
+					const float* position = positions.data() + corner.position * 3;
+					mesh->positions.insert(mesh->positions.end(), position, position + 3);
+
+					// Corners without texture coordinates or normals get zeros, MeshCooker fills in zero normals
+					hasTexCoords |= corner.texCoord >= 0;
+					const float* texCoord = corner.texCoord >= 0 ? texCoords.data() + corner.texCoord * 2 : nullptr;
+					mesh->texCoords.insert(mesh->texCoords.end(), { texCoord ? texCoord[0] : 0.0f, texCoord ? texCoord[1] : 0.0f });
+
+					hasNormals |= corner.normal >= 0;
+					const float* normal = corner.normal >= 0 ? normals.data() + corner.normal * 3 : nullptr;
+					mesh->normals.insert(mesh->normals.end(), { normal ? normal[0] : 0.0f, normal ? normal[1] : 0.0f, normal ? normal[2] : 0.0f });
+				}
+				face.push_back(it->second);
+			}
+
+			for(size_t i = 1; i + 1 < face.size(); ++i)
+				mesh->indices.insert(mesh->indices.end(), { face[0], face[i], face[i + 1] });
+		}
+	}
+	finishMesh();
+
+	convertModel(model);
+	return true;
+}
+
+bool importModel(const std::filesystem::path& path, ImportedModel& model) {
+	std::ifstream stream(path, std::ios::binary | std::ios::ate);
+	if(!stream.is_open()) return false;
+
+	std::vector<char> data(stream.tellg());
+	stream.seekg(0);
+	stream.read(data.data(), data.size());
+	if(!stream) return false;
+
+	std::string extension = path.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+	if(extension == ".gltf" || extension == ".glb") return importGLTF(data.data(), data.size(), path.parent_path(), model);
+	if(extension == ".obj") return importOBJ(data.data(), data.size(), model);
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/*
+Imports glTF 2.0 (.gltf and .glb) and Wavefront OBJ models
+
+Everything is converted to the space the Blender scripts export in, the
+same as Blender's own importers, so cooked meshes match exported ones
+Y up is turned into Z up, texture coordinates have their origin at the
+bottom left and triangles keep counter-clockwise winding, MeshCooker
+turns them clockwise
+
+glTF
+Triangles, strips and fans are read, points and lines are skipped
+Meshes are placed by the transforms of the nodes of the default scene,
+except skinned meshes, which are in the bind space of their skin
+Only the first skin is imported, the bones are ordered breadth first
+from its root, which must be the only one, and the joints are remapped
+to match
+Buffers may be in the .glb, in data URIs or in files next to the .gltf,
+sparse accessors are not supported
+
+OBJ
+Faces are triangulated as fans, the o and g statements split meshes,
+materials and smoothing groups are ignored
+
+Thread Safety:
+All functions are thread-safe
+*/
+
+// The bone count of a .arm file is a uint8
+constexpr uint32_t MAX_BONE_COUNT = 255;
+constexpr uint32_t MAX_BONE_INFLUENCES = 4;
+
+struct ImportedBone {
+	std::string name;
+	uint32_t parent; // Same as the bone index for the root
+	float restMatrix[16]; // Bone to model space at rest, row-major row vector (x * A)
+};
+
+// Triangle lists, the vertex arrays are empty if the file does not have them
+struct ImportedMesh {
+	std::string name;
+	std::vector<float> positions; // 3 per vertex
+	std::vector<float> normals; // 3 per vertex
+	std::vector<float> texCoords; // 2 per vertex
+	std::vector<uint8_t> boneIndices; // MAX_BONE_INFLUENCES per vertex
+	std::vector<float> boneWeights; // MAX_BONE_INFLUENCES per vertex
+	std::vector<uint32_t> indices;
+
+	uint32_t vertexCount() const {
+		return (uint32_t)(positions.size() / 3);
+	}
+};
+
+struct ImportedModel {
+	std::vector<ImportedMesh> meshes;
+	std::vector<ImportedBone> bones; // The root is first and parents come before their children
+};
+
+// Returns false if data is not a valid or supported file
+// directory is where the external buffers of a .gltf are looked up
+bool importGLTF(const char* data, uint64_t size, const std::filesystem::path& directory, ImportedModel& model);
+bool importOBJ(const char* data, uint64_t size, ImportedModel& model);
+// Reads the file and picks the importer from the extension
+bool importModel(const std::filesystem::path& path, ImportedModel& model);
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "Pack.hpp"
+
+#include <cstring>
+#include <thread>
+
+#include "TextureFormat.hpp"
+
+void Pack::read(FilePool& filePool, const char* fileName) {
+	checked = false;
+	filePool.readFile(fileName, file,
+		[this](FilePool::File&) {
+			check();
+		}
+	);
+}
+
+void Pack::map(FilePool& filePool, const char* fileName) {
+	checked = false;
+	filePool.mapFile(fileName, file,
+		[this](FilePool::File&) {
+			check();
+		}
+	);
+}
+
+void Pack::check() {
+	_valid = false;
+
+	if(file.size() < sizeof(PackHeader)) {
+		checked = true;
+		return;
+	}
+
+	const PackHeader* header = (const PackHeader*)file.data();
+	const uint64_t size = file.size();
+	// The table size must be a power of two for the probing mask
+	if(
+		memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) ||
+		header->version != PACK_VERSION ||
+		header->size != size ||
+		!header->tableSize || header->tableSize & (header->tableSize - 1) ||
+		header->tableSize > (size - sizeof(PackHeader)) / sizeof(PackEntry)
+	) {
+		checked = true;
+		return;
+	}
+
+	// Every entry and name must lie inside the archive
+	const PackEntry* table = (const PackEntry*)(file.data() + sizeof(PackHeader));
+	uint32_t entryCount = 0;
+	for(uint32_t i = 0; i < header->tableSize; ++i) {
+		const PackEntry& entry = table[i];
+		if(entry.type == PACK_ENTRY_TYPE::EMPTY) continue;
+		++entryCount;
+
+		if(
+			entry.offset > size || entry.size > size - entry.offset ||
+			entry.nameOffset > size || entry.nameSize >= size - entry.nameOffset ||
+			file.data()[entry.nameOffset + entry.nameSize]
+		) {
+			checked = true;
+			return;
+		}
+	}
+
+	_valid = entryCount == header->entryCount;
+	checked = true;
+}
+
+bool Pack::ready() const {
+	return checked;
+}
+
+void Pack::wait() const {
+	while(!checked)
+		std::this_thread::yield();
+}
+
+bool Pack::valid() const {
+	return checked && _valid;
+}
+
+const PackEntry* Pack::find(const char* name) const {
+	if(!valid()) return nullptr;
+
+	const PackHeader* header = (const PackHeader*)file.data();
+	const PackEntry* table = (const PackEntry*)(file.data() + sizeof(PackHeader));
+	const uint32_t mask = header->tableSize - 1;
+
+	const uint64_t hash = hashPackName(name);
+	const size_t nameSize = strlen(name);
+	for(uint32_t i = 0; i < header->tableSize; ++i) {
+		const PackEntry& entry = table[(hash + i) & mask];
+		if(entry.type == PACK_ENTRY_TYPE::EMPTY) return nullptr;
+		// Names whose hashes collide are told apart by the name itself
+		if(entry.hash == hash && entry.nameSize == nameSize && !memcmp(file.data() + entry.nameOffset, name, nameSize)) return &entry;
+	}
+
+	return nullptr;
+}
+
+const char* Pack::data(const PackEntry& entry) const {
+	return file.data() + entry.offset;
+}
+
+void Pack::close() {
+	checked = false;
+	_valid = false;
+	file.close();
+}
+
+PACK_ENTRY_TYPE getPackEntryType(const std::filesystem::path& path) {
+	const std::string extension = path.extension().string();
+	if(extension == ".dds" || extension == ".ktx2") return PACK_ENTRY_TYPE::TEXTURE;
+	if(extension == ".smesh") return PACK_ENTRY_TYPE::STATIC_MESH;
+	if(extension == ".dmesh") return PACK_ENTRY_TYPE::DYNAMIC_MESH;
+	if(extension == ".skmesh") return PACK_ENTRY_TYPE::SKINNED_MESH;
+	if(extension == ".arm") return PACK_ENTRY_TYPE::ARMATURE;
+	return PACK_ENTRY_TYPE::RAW;
+}
+
+constexpr uint64_t alignPack(uint64_t offset) {
+	return (offset + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+}
+
+bool writePack(const PackFile* files, uint32_t fileCount, std::vector<char>& data) {
+	std::vector<PackEntry> entries(fileCount);
+	std::vector<TextureView> views(fileCount);
+	for(uint32_t i = 0; i < fileCount; ++i) {
+		PackEntry& entry = entries[i];
+		entry = {};
+		entry.hash = hashPackName(files[i].name.c_str());
+		entry.type = files[i].type;
+		entry.size = files[i].data.size();
+		if(entry.type != PACK_ENTRY_TYPE::TEXTURE) continue;
+
+		TextureView& view = views[i];
+		if(!parseTexture(files[i].data.data(), files[i].data.size(), view)) return false;
+
+		entry.texture.type = view.type;
+		entry.texture.format = view.format;
+		entry.texture.width = view.width;
+		entry.texture.height = view.height;
+		entry.texture.mipCount = view.mipCount;
+		entry.size = view.size();
+	}
+
+	// Keep the table at most half full so probes stay short
+	uint32_t tableSize = 1;
+	while(tableSize < (uint64_t)fileCount * 2)
+		tableSize <<= 1;
+
+	// The names follow the table
+	uint64_t offset = sizeof(PackHeader) + (uint64_t)tableSize * sizeof(PackEntry);
+	for(uint32_t i = 0; i < fileCount; ++i) {
+		entries[i].nameOffset = offset;
+		entries[i].nameSize = (uint32_t)files[i].name.size();
+		offset += files[i].name.size() + 1;
+	}
+
+	std::vector<PackEntry> table(tableSize);
+	offset = alignPack(offset);
+	for(PackEntry& entry : entries) {
+		entry.offset = offset;
+		offset = alignPack(offset + entry.size);
+
+		// Names are compared on lookup, so entries whose hashes collide just take the next slot
+		uint32_t slot = entry.hash & (tableSize - 1);
+		while(table[slot].type != PACK_ENTRY_TYPE::EMPTY)
+			slot = (slot + 1) & (tableSize - 1);
+		table[slot] = entry;
+	}
+
+	PackHeader header{};
+	memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+	header.version = PACK_VERSION;
+	header.entryCount = fileCount;
+	header.tableSize = tableSize;
+	header.size = offset;
+
+	// The padding between entries is zeroed by the resize
+	const uint64_t start = data.size();
+	data.resize(start + header.size);
+	char* archive = data.data() + start;
+	memcpy(archive, &header, sizeof(header));
+	memcpy(archive + sizeof(PackHeader), table.data(), table.size() * sizeof(PackEntry));
+	for(uint32_t i = 0; i < fileCount; ++i) {
+		const PackEntry& entry = entries[i];
+		memcpy(archive + entry.nameOffset, files[i].name.c_str(), files[i].name.size() + 1);
+
+		if(entry.type == PACK_ENTRY_TYPE::TEXTURE) copyTextureData(views[i], archive + entry.offset);
+		else if(entry.size) memcpy(archive + entry.offset, files[i].data.data(), entry.size);
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "FilePool.hpp"
+#include "PackFormat.hpp"
+
+/*
+Reads the entries of an .rpak archive
+
+The whole archive is loaded with a single FilePool request, so it is
+read sequentially instead of one open and read per asset, and entries
+are found by name in constant time through the table of contents
+The archive is validated once it is loaded, including that every entry
+and name lies inside the file, so entries which are found can be read
+without further checks
+
+Thread Safety:
+Pack::find is thread-safe once the pack is ready
+Pack::data is thread-safe once the pack is ready
+*/
+class Pack {
+	FilePool::File file;
+	bool _valid = false;
+	std::atomic<bool> checked = false; // Set once the archive is loaded and validated
+
+	// Called on the worker which loaded the archive
+	void check();
+public:
+	Pack() = default;
+	Pack(const Pack&) = delete;
+	~Pack() = default;
+	// Reads the archive into memory
+	void read(FilePool& filePool, const char* fileName);
+	// Maps the archive instead, which keeps the entries aligned in memory as well
+	void map(FilePool& filePool, const char* fileName);
+	bool ready() const;
+	void wait() const;
+	// False if the archive is not ready or is not a valid archive
+	bool valid() const;
+	// Returns nullptr if there is no entry with this name
+	const PackEntry* find(const char* name) const;
+	const char* data(const PackEntry& entry) const;
+	void close();
+};
+
+struct PackFile {
+	std::string name; // Entry name, see PackFormat.hpp
+	std::vector<char> data; // Contents of the file, textures include their header
+	PACK_ENTRY_TYPE type;
+};
+
+// Returns the type a file is packed as from its extension
+PACK_ENTRY_TYPE getPackEntryType(const std::filesystem::path& path);
+/*
+Appends an archive of the files to data
+Textures are packed as their subresources, in subresource order, without
+the file header, returns false if a texture can't be parsed
+The entries are laid out in the order of files, so sort them by name for
+a deterministic archive
+*/
+bool writePack(const PackFile* files, uint32_t fileCount, std::vector<char>& data);
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+#include <Texture.hpp>
+
+/*
+Layout of an .rpak archive
+
+PackHeader
+PackEntry[tableSize], the table of contents
+Entry names, null terminated
+Entry data, every entry starts on a PACK_ALIGNMENT boundary
+
+The table of contents is an open addressing hash table keyed by the
+hash of the entry name, probed linearly from hash & (tableSize - 1),
+unused slots have the EMPTY type and the table is never more than
+half full, entries whose hashes match are told apart by their names
+
+Entry names are paths relative to the packed directory with forward
+slashes, e.g. "meshes/Cube.smesh"
+*/
+
+constexpr char PACK_MAGIC[4]{ 'R', 'P', 'A', 'K' };
+constexpr uint32_t PACK_VERSION = 2;
+// D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, so that texture data can be copied to upload memory as is
+constexpr uint64_t PACK_ALIGNMENT = 512;
+
+enum class PACK_ENTRY_TYPE : uint32_t {
+	EMPTY,
+	RAW,
+	TEXTURE, // Mip data without the file header
+	STATIC_MESH, // .smesh file
+	DYNAMIC_MESH, // .dmesh file
+	SKINNED_MESH, // .skmesh file
+	ARMATURE // .arm file
+};
+
+struct PackHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t entryCount;
+	uint32_t tableSize; // Power of two
+	uint64_t size; // Size of the whole archive
+};
+
+struct PackTextureInfo {
+	RIN::TEXTURE_TYPE type;
+	RIN::TEXTURE_FORMAT format;
+	uint32_t width;
+	uint32_t height;
+	uint32_t mipCount;
+};
+
+struct PackEntry {
+	uint64_t hash;
+	uint64_t offset; // Offset from the start of the archive
+	uint64_t size;
+	uint64_t nameOffset; // Offset from the start of the archive
+	uint32_t nameSize; // Without the null terminator
+	PACK_ENTRY_TYPE type;
+	PackTextureInfo texture; // Only set for TEXTURE entries
+};
+
+// FNV-1a
+inline uint64_t hashPackName(const char* name) {
+	uint64_t hash = 0xCBF29CE484222325;
+	for(; *name; ++name) {
+		hash ^= (uint8_t)*name;
+		hash *= 0x100000001B3;
+	}
+
+	return hash;
+}
\ No newline at end of file
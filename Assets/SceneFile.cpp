@@ -0,0 +1,383 @@
+#include "SceneFile.hpp"
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "Json.hpp"
+
+uint32_t getConstantTexelSize(RIN::TEXTURE_FORMAT format) {
+	switch(format) {
+	case RIN::TEXTURE_FORMAT::R8_UNORM:
+		return 1;
+	case RIN::TEXTURE_FORMAT::R8G8_UNORM:
+		return 2;
+	case RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM:
+	case RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB:
+	case RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM:
+	case RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB:
+		return 4;
+	default:
+		return 0;
+	}
+}
+
+// Textures each material type samples, in the order of SceneMaterial::textures
+static bool isMaterialTextureUsed(RIN::MATERIAL_TYPE type, uint32_t texture) {
+	if(texture == 3) return type != RIN::MATERIAL_TYPE::PBR_SHEEN;
+	if(texture == 5) return type != RIN::MATERIAL_TYPE::PBR_STANDARD;
+	return true;
+}
+
+static bool isPathValid(const SceneData& scene, uint32_t path) {
+	return path < scene.strings.size();
+}
+
+static bool areObjectsValid(const SceneData& scene, const std::vector<SceneObject>& objects, MESH_TYPE type) {
+	for(const SceneObject& object : objects) {
+		if(object.mesh >= scene.meshes.size() || scene.meshes[object.mesh].type != type) return false;
+		if(object.material >= scene.materials.size()) return false;
+		if(type == MESH_TYPE::SKINNED ? object.armature >= scene.armatures.size() : object.armature != SCENE_NONE) return false;
+	}
+
+	return true;
+}
+
+// Checks every reference, so a loader can index with them as they are
+static bool isSceneValid(const SceneData& scene) {
+	if(!scene.strings.empty() && scene.strings.back()) return false;
+
+	for(const SceneTexture& texture : scene.textures)
+		if(texture.path == SCENE_NONE ? !getConstantTexelSize(texture.format) : !isPathValid(scene, texture.path)) return false;
+
+	const bool skybox = scene.skybox[0] != SCENE_NONE;
+	for(uint32_t i = 0; i < 3; ++i)
+		if(skybox ? scene.skybox[i] >= scene.textures.size() : scene.skybox[i] != SCENE_NONE) return false;
+
+	for(const SceneMaterial& material : scene.materials) {
+		if((uint32_t)material.type > (uint32_t)RIN::MATERIAL_TYPE::PBR_SHEEN) return false;
+
+		for(uint32_t i = 0; i < 6; ++i) {
+			if(material.textures[i] == SCENE_NONE) {
+				if(isMaterialTextureUsed(material.type, i)) return false;
+			} else if(material.textures[i] >= scene.textures.size()) return false;
+		}
+	}
+
+	for(const SceneMesh& mesh : scene.meshes) {
+		if((uint8_t)mesh.type > (uint8_t)MESH_TYPE::SKINNED || !isPathValid(scene, mesh.path)) return false;
+		if(mesh.flags & ~(SCENE_MESH_FLAG_GENERATE_LODS | SCENE_MESH_FLAG_STREAMED)) return false;
+		if((mesh.flags & SCENE_MESH_FLAG_STREAMED) && mesh.type != MESH_TYPE::STATIC) return false;
+	}
+
+	for(const SceneArmature& armature : scene.armatures)
+		if(!isPathValid(scene, armature.path)) return false;
+
+	return areObjectsValid(scene, scene.staticObjects, MESH_TYPE::STATIC) &&
+		areObjectsValid(scene, scene.dynamicObjects, MESH_TYPE::DYNAMIC) &&
+		areObjectsValid(scene, scene.skinnedObjects, MESH_TYPE::SKINNED);
+}
+
+template<class T>
+static bool readArray(const char*& data, const char* end, uint32_t count, std::vector<T>& array) {
+	if((uint64_t)(end - data) / sizeof(T) < count) return false;
+
+	array.resize(count);
+	memcpy(array.data(), data, count * sizeof(T));
+	data += count * sizeof(T);
+
+	return true;
+}
+
+template<class T>
+static void writeArray(const std::vector<T>& array, std::vector<char>& data) {
+	const char* begin = (const char*)array.data();
+	data.insert(data.end(), begin, begin + array.size() * sizeof(T));
+}
+
+bool readScene(const char* data, uint64_t size, SceneData& scene) {
+	if(size < sizeof(SceneHeader)) return false;
+
+	SceneHeader header;
+	memcpy(&header, data, sizeof(header));
+	if(memcmp(header.magic, SCENE_MAGIC, sizeof(SCENE_MAGIC)) || header.version != SCENE_VERSION) return false;
+
+	const char* end = data + size;
+	data += sizeof(SceneHeader);
+	if(!readArray(data, end, header.textureCount, scene.textures) ||
+		!readArray(data, end, header.materialCount, scene.materials) ||
+		!readArray(data, end, header.meshCount, scene.meshes) ||
+		!readArray(data, end, header.armatureCount, scene.armatures) ||
+		!readArray(data, end, header.staticObjectCount, scene.staticObjects) ||
+		!readArray(data, end, header.dynamicObjectCount, scene.dynamicObjects) ||
+		!readArray(data, end, header.skinnedObjectCount, scene.skinnedObjects) ||
+		!readArray(data, end, header.lightCount, scene.lights) ||
+		!readArray(data, end, header.stringSize, scene.strings)) return false;
+	if(data != end) return false;
+
+	memcpy(scene.skybox, header.skybox, sizeof(scene.skybox));
+
+	return isSceneValid(scene);
+}
+
+void writeScene(const SceneData& scene, std::vector<char>& data) {
+	SceneHeader header{};
+	memcpy(header.magic, SCENE_MAGIC, sizeof(SCENE_MAGIC));
+	header.version = SCENE_VERSION;
+	header.textureCount = (uint32_t)scene.textures.size();
+	header.materialCount = (uint32_t)scene.materials.size();
+	header.meshCount = (uint32_t)scene.meshes.size();
+	header.armatureCount = (uint32_t)scene.armatures.size();
+	header.staticObjectCount = (uint32_t)scene.staticObjects.size();
+	header.dynamicObjectCount = (uint32_t)scene.dynamicObjects.size();
+	header.skinnedObjectCount = (uint32_t)scene.skinnedObjects.size();
+	header.lightCount = (uint32_t)scene.lights.size();
+	memcpy(header.skybox, scene.skybox, sizeof(header.skybox));
+	header.stringSize = (uint32_t)scene.strings.size();
+
+	const char* headerData = (const char*)&header;
+	data.insert(data.end(), headerData, headerData + sizeof(header));
+	writeArray(scene.textures, data);
+	writeArray(scene.materials, data);
+	writeArray(scene.meshes, data);
+	writeArray(scene.armatures, data);
+	writeArray(scene.staticObjects, data);
+	writeArray(scene.dynamicObjects, data);
+	writeArray(scene.skinnedObjects, data);
+	writeArray(scene.lights, data);
+	writeArray(scene.strings, data);
+}
+
+typedef std::unordered_map<std::string, uint32_t> name_map_type;
+
+// Returns the element count, or SCENE_NONE if the value is not an array or an element has no unique name
+static uint32_t mapNames(const JsonValue* array, name_map_type& names) {
+	if(!array) return 0;
+	if(array->type != JSON_TYPE::ARRAY) return SCENE_NONE;
+
+	for(size_t i = 0; i < array->elements.size(); ++i) {
+		const char* name = array->elements[i].getString("name", nullptr);
+		if(!name || !names.emplace(name, (uint32_t)i).second) return SCENE_NONE;
+	}
+
+	return (uint32_t)array->elements.size();
+}
+
+// Returns SCENE_NONE if the key is missing or does not name an asset, which isSceneValid rejects where it is needed
+static uint32_t findName(const JsonValue& value, const char* key, const name_map_type& names) {
+	const char* name = value.getString(key, nullptr);
+	if(!name) return SCENE_NONE;
+
+	const name_map_type::const_iterator it = names.find(name);
+	return it == names.end() ? SCENE_NONE : it->second;
+}
+
+// Returns false if the key names something which does not exist, as opposed to leaving it out
+static bool findOptionalName(const JsonValue& value, const char* key, const name_map_type& names, uint32_t& index) {
+	index = findName(value, key, names);
+	return index != SCENE_NONE || !value.find(key);
+}
+
+static uint32_t addString(const char* string, SceneData& scene) {
+	const uint32_t offset = (uint32_t)scene.strings.size();
+	scene.strings.insert(scene.strings.end(), string, string + strlen(string) + 1);
+	return offset;
+}
+
+static bool getBoolean(const JsonValue& value, const char* key) {
+	const JsonValue* member = value.find(key);
+	return member && member->type == JSON_TYPE::BOOLEAN && member->boolean;
+}
+
+// Reads exactly count numbers
+static bool getNumbers(const JsonValue& value, const char* key, uint32_t count, double* numbers) {
+	const JsonValue* array = value.find(key);
+	if(!array || array->type != JSON_TYPE::ARRAY || array->elements.size() != count) return false;
+
+	for(uint32_t i = 0; i < count; ++i) {
+		if(array->elements[i].type != JSON_TYPE::NUMBER) return false;
+		numbers[i] = array->elements[i].number;
+	}
+
+	return true;
+}
+
+static bool parseSceneTexture(const JsonValue& value, SceneData& scene, SceneTexture& texture) {
+	static const std::pair<const char*, RIN::TEXTURE_FORMAT> FORMATS[]{
+		{ "R8_UNORM", RIN::TEXTURE_FORMAT::R8_UNORM },
+		{ "R8G8_UNORM", RIN::TEXTURE_FORMAT::R8G8_UNORM },
+		{ "R8G8B8A8_UNORM", RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM },
+		{ "R8G8B8A8_UNORM_SRGB", RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB },
+		{ "B8G8R8A8_UNORM", RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM },
+		{ "B8G8R8A8_UNORM_SRGB", RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB }
+	};
+
+	texture = SceneTexture{};
+
+	if(const char* file = value.getString("file", nullptr)) {
+		texture.path = addString(file, scene);
+		return true;
+	}
+
+	texture.path = SCENE_NONE;
+
+	const char* format = value.getString("format", "");
+	uint32_t texelSize = 0;
+	for(const std::pair<const char*, RIN::TEXTURE_FORMAT>& entry : FORMATS) {
+		if(!strcmp(format, entry.first)) {
+			texture.format = entry.second;
+			texelSize = getConstantTexelSize(entry.second);
+		}
+	}
+
+	double color[4];
+	if(!texelSize || !getNumbers(value, "color", texelSize, color)) return false;
+
+	for(uint32_t i = 0; i < texelSize; ++i) {
+		if(!(color[i] >= 0.0 && color[i] <= 255.0)) return false;
+		texture.color[i] = (uint8_t)color[i];
+	}
+
+	return true;
+}
+
+static bool parseMaterial(const JsonValue& value, const name_map_type& textureNames, SceneMaterial& material) {
+	static const std::pair<const char*, RIN::MATERIAL_TYPE> TYPES[]{
+		{ "standard", RIN::MATERIAL_TYPE::PBR_STANDARD },
+		{ "emissive", RIN::MATERIAL_TYPE::PBR_EMISSIVE },
+		{ "clearCoat", RIN::MATERIAL_TYPE::PBR_CLEAR_COAT },
+		{ "sheen", RIN::MATERIAL_TYPE::PBR_SHEEN }
+	};
+	static const char* const TEXTURES[]{ "baseColor", "normal", "roughnessAO", "metallic", "height", "special" };
+
+	const char* type = value.getString("type", "");
+	bool found = false;
+	for(const std::pair<const char*, RIN::MATERIAL_TYPE>& entry : TYPES) {
+		if(!strcmp(type, entry.first)) {
+			material.type = entry.second;
+			found = true;
+		}
+	}
+	if(!found) return false;
+
+	for(uint32_t i = 0; i < 6; ++i)
+		if(!findOptionalName(value, TEXTURES[i], textureNames, material.textures[i])) return false;
+
+	return true;
+}
+
+static bool parseMesh(const JsonValue& value, SceneData& scene, SceneMesh& mesh) {
+	static const std::pair<const char*, MESH_TYPE> EXTENSIONS[]{
+		{ ".smesh", MESH_TYPE::STATIC },
+		{ ".dmesh", MESH_TYPE::DYNAMIC },
+		{ ".skmesh", MESH_TYPE::SKINNED }
+	};
+
+	mesh = SceneMesh{};
+
+	const char* file = value.getString("file", nullptr);
+	if(!file) return false;
+
+	const char* extension = strrchr(file, '.');
+	if(!extension) return false;
+
+	bool found = false;
+	for(const std::pair<const char*, MESH_TYPE>& entry : EXTENSIONS) {
+		if(!strcmp(extension, entry.first)) {
+			mesh.type = entry.second;
+			found = true;
+		}
+	}
+	if(!found) return false;
+
+	mesh.path = addString(file, scene);
+	if(getBoolean(value, "generateLODs")) mesh.flags |= SCENE_MESH_FLAG_GENERATE_LODS;
+	if(getBoolean(value, "streamed")) mesh.flags |= SCENE_MESH_FLAG_STREAMED;
+
+	return true;
+}
+
+static bool parseObjects(const JsonValue& root, const char* key, const name_map_type& meshNames, const name_map_type& materialNames, const name_map_type& armatureNames, std::vector<SceneObject>& objects) {
+	const JsonValue* array = root.find(key);
+	if(!array) return true;
+	if(array->type != JSON_TYPE::ARRAY) return false;
+
+	for(const JsonValue& value : array->elements) {
+		SceneObject object;
+		object.mesh = findName(value, "mesh", meshNames);
+		object.material = findName(value, "material", materialNames);
+		if(!findOptionalName(value, "armature", armatureNames, object.armature)) return false;
+
+		objects.push_back(object);
+	}
+
+	return true;
+}
+
+bool parseScene(const char* data, uint64_t size, SceneData& scene) {
+	scene = SceneData();
+
+	JsonValue root;
+	if(!parseJson(data, size, root) || root.type != JSON_TYPE::OBJECT) return false;
+
+	// Every name is mapped up front, so assets can be listed in any order
+	name_map_type textureNames, materialNames, meshNames, armatureNames;
+	const JsonValue* textures = root.find("textures");
+	const JsonValue* materials = root.find("materials");
+	const JsonValue* meshes = root.find("meshes");
+	const JsonValue* armatures = root.find("armatures");
+	if(mapNames(textures, textureNames) == SCENE_NONE || mapNames(materials, materialNames) == SCENE_NONE ||
+		mapNames(meshes, meshNames) == SCENE_NONE || mapNames(armatures, armatureNames) == SCENE_NONE) return false;
+
+	scene.textures.resize(textureNames.size());
+	for(uint32_t i = 0; i < scene.textures.size(); ++i)
+		if(!parseSceneTexture(textures->elements[i], scene, scene.textures[i])) return false;
+
+	if(const JsonValue* skybox = root.find("skybox")) {
+		scene.skybox[0] = findName(*skybox, "texture", textureNames);
+		scene.skybox[1] = findName(*skybox, "diffuse", textureNames);
+		scene.skybox[2] = findName(*skybox, "specular", textureNames);
+		if(scene.skybox[0] == SCENE_NONE || scene.skybox[1] == SCENE_NONE || scene.skybox[2] == SCENE_NONE) return false;
+	}
+
+	scene.materials.resize(materialNames.size());
+	for(uint32_t i = 0; i < scene.materials.size(); ++i)
+		if(!parseMaterial(materials->elements[i], textureNames, scene.materials[i])) return false;
+
+	scene.meshes.resize(meshNames.size());
+	for(uint32_t i = 0; i < scene.meshes.size(); ++i)
+		if(!parseMesh(meshes->elements[i], scene, scene.meshes[i])) return false;
+
+	scene.armatures.resize(armatureNames.size());
+	for(uint32_t i = 0; i < scene.armatures.size(); ++i) {
+		const char* file = armatures->elements[i].getString("file", nullptr);
+		if(!file) return false;
+		scene.armatures[i].path = addString(file, scene);
+	}
+
+	if(!parseObjects(root, "staticObjects", meshNames, materialNames, armatureNames, scene.staticObjects) ||
+		!parseObjects(root, "dynamicObjects", meshNames, materialNames, armatureNames, scene.dynamicObjects) ||
+		!parseObjects(root, "skinnedObjects", meshNames, materialNames, armatureNames, scene.skinnedObjects)) return false;
+
+	if(const JsonValue* lights = root.find("lights")) {
+		if(lights->type != JSON_TYPE::ARRAY) return false;
+
+		for(const JsonValue& value : lights->elements) {
+			double position[3]{}, color[3]{};
+			// Lights which are moved at runtime can leave out their position
+			if(value.find("position") && !getNumbers(value, "position", 3, position)) return false;
+			if(!getNumbers(value, "color", 3, color)) return false;
+
+			SceneLight light;
+			for(uint32_t i = 0; i < 3; ++i) {
+				light.position[i] = (float)position[i];
+				light.color[i] = (float)color[i];
+			}
+			light.radius = (float)value.getNumber("radius", 0.0);
+
+			scene.lights.push_back(light);
+		}
+	}
+
+	return isSceneValid(scene);
+}
\ No newline at end of file
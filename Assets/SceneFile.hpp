@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Material.hpp>
+#include <Texture.hpp>
+
+#include "MeshFile.hpp"
+
+/*
+Layout of an .rscn file
+
+SceneHeader
+SceneTexture[textureCount]
+SceneMaterial[materialCount]
+SceneMesh[meshCount]
+SceneArmature[armatureCount]
+SceneObject[staticObjectCount + dynamicObjectCount + skinnedObjectCount]
+SceneLight[lightCount]
+String table, stringSize bytes of null terminated strings
+
+Every record is a multiple of 4 bytes, so the arrays stay aligned and
+are copied out as they are
+Assets refer to each other by index into their arrays, SCENE_NONE is
+used for references which are left out, paths are offsets into the
+string table and are relative to the directory of the scene file
+
+Textures without a path are constant 1x1 textures of their color
+The objects are stored static first, then dynamic, then skinned, the
+mesh of each object must be of the matching type
+
+Scenes are written as JSON and compiled by the Cooker tool, see parseScene
+*/
+
+constexpr char SCENE_MAGIC[4]{ 'R', 'S', 'C', 'N' };
+constexpr uint32_t SCENE_VERSION = 1;
+constexpr uint32_t SCENE_NONE = UINT32_MAX;
+
+enum SCENE_MESH_FLAG : uint32_t {
+	SCENE_MESH_FLAG_GENERATE_LODS = 0x1, // Generate the LODs the file is missing with the default LODSettings
+	SCENE_MESH_FLAG_STREAMED = 0x2 // Static meshes only, see Renderer::addStaticMesh
+};
+
+struct SceneHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t textureCount;
+	uint32_t materialCount;
+	uint32_t meshCount;
+	uint32_t armatureCount;
+	uint32_t staticObjectCount;
+	uint32_t dynamicObjectCount;
+	uint32_t skinnedObjectCount;
+	uint32_t lightCount;
+	uint32_t skybox[3]; // Skybox, diffuse IBL and specular IBL textures, all SCENE_NONE if there is no skybox
+	uint32_t stringSize;
+};
+
+struct SceneTexture {
+	uint32_t path; // SCENE_NONE for constant textures
+	RIN::TEXTURE_FORMAT format; // Constant textures only
+	uint8_t color[4]; // Constant textures only, the first getConstantTexelSize(format) bytes are used
+};
+
+struct SceneMaterial {
+	RIN::MATERIAL_TYPE type;
+	uint32_t textures[6]; // In the order of Renderer::addMaterial
+};
+
+struct SceneMesh {
+	uint32_t path;
+	uint32_t flags;
+	MESH_TYPE type;
+	uint8_t reserved[3];
+};
+
+struct SceneArmature {
+	uint32_t path;
+};
+
+struct SceneObject {
+	uint32_t mesh;
+	uint32_t material;
+	uint32_t armature; // Skinned objects only
+};
+
+struct SceneLight {
+	float position[3];
+	float radius;
+	float color[3];
+};
+
+struct SceneData {
+	std::vector<SceneTexture> textures;
+	std::vector<SceneMaterial> materials;
+	std::vector<SceneMesh> meshes;
+	std::vector<SceneArmature> armatures;
+	std::vector<SceneObject> staticObjects;
+	std::vector<SceneObject> dynamicObjects;
+	std::vector<SceneObject> skinnedObjects;
+	std::vector<SceneLight> lights;
+	uint32_t skybox[3]{ SCENE_NONE, SCENE_NONE, SCENE_NONE };
+	std::vector<char> strings;
+
+	const char* string(uint32_t offset) const {
+		return strings.data() + offset;
+	}
+};
+
+// Size of a texel of a constant texture, 0 if the format can not be used for one
+uint32_t getConstantTexelSize(RIN::TEXTURE_FORMAT format);
+
+// Returns false if data is not a valid scene file
+bool readScene(const char* data, uint64_t size, SceneData& scene);
+// Appends the file to data
+void writeScene(const SceneData& scene, std::vector<char>& data);
+
+/*
+Returns false if data is not a valid JSON scene
+
+{
+	"textures": [
+		{ "name": "dirtBaseColor", "file": "../materials/dirt/basecolor.dds" },
+		{ "name": "black", "format": "R8_UNORM", "color": [ 0 ] }
+	],
+	"skybox": { "texture": "skybox", "diffuse": "diffuseIBL", "specular": "specularIBL" },
+	"materials": [
+		{ "name": "dirt", "type": "standard", "baseColor": "dirtBaseColor", "normal": ..., "roughnessAO": ...,
+		  "metallic": "black", "height": ..., "special": ... }
+	],
+	"meshes": [ { "name": "Cube", "file": "../meshes/Cube.smesh", "generateLODs": false, "streamed": true } ],
+	"armatures": [ { "name": "Monster", "file": "../armatures/Armature.arm" } ],
+	"staticObjects": [ { "mesh": "Cube", "material": "dirt" } ],
+	"dynamicObjects": [ { "mesh": "Torus", "material": "dirt" } ],
+	"skinnedObjects": [ { "mesh": "Monster", "armature": "Monster", "material": "dirt" } ],
+	"lights": [ { "position": [ 0, 0, 4 ], "radius": 15, "color": [ 50, 50, 50 ] } ]
+}
+
+Assets are referred to by name, the names are not kept in the binary file
+The type of a mesh comes from the extension of its file
+Material types are standard, emissive, clearCoat and sheen, the textures a
+type does not use can be left out, see Material.hpp
+Constant textures can use the 8 bit UNORM formats, with one color value
+from 0 to 255 per channel
+*/
+bool parseScene(const char* data, uint64_t size, SceneData& scene);
\ No newline at end of file
@@ -0,0 +1,492 @@
+#include "SceneLoader.hpp"
+
+#include <filesystem>
+#include <utility>
+
+void SceneLoader::load(FilePool& filePool, RIN::Renderer* sceneRenderer, const char* sceneFileName) {
+	renderer = sceneRenderer;
+	fileName = sceneFileName;
+	timer.start();
+
+	filePool.mapFile(fileName.c_str(), file,
+		[this, &filePool](FilePool::File&) {
+			parse(filePool);
+		}
+	);
+}
+
+void SceneLoader::parse(FilePool& filePool) {
+	const bool read = readScene(file.data(), file.size(), _scene);
+	file.close();
+	if(!read) {
+		_failed = true;
+		return;
+	}
+
+	_stats.parseSeconds = timer.elapsedSeconds();
+
+	const uint32_t textureCount = (uint32_t)_scene.textures.size();
+	const uint32_t meshCount = (uint32_t)_scene.meshes.size();
+	const uint32_t armatureCount = (uint32_t)_scene.armatures.size();
+	const uint32_t objectCount = (uint32_t)(_scene.staticObjects.size() + _scene.dynamicObjects.size() + _scene.skinnedObjects.size());
+
+	_stats.counts[(uint32_t)SCENE_ASSET::TEXTURE] = textureCount;
+	_stats.counts[(uint32_t)SCENE_ASSET::MATERIAL] = (uint32_t)_scene.materials.size();
+	_stats.counts[(uint32_t)SCENE_ASSET::MESH] = meshCount;
+	_stats.counts[(uint32_t)SCENE_ASSET::ARMATURE] = armatureCount;
+	_stats.counts[(uint32_t)SCENE_ASSET::STATIC_OBJECT] = (uint32_t)_scene.staticObjects.size();
+	_stats.counts[(uint32_t)SCENE_ASSET::DYNAMIC_OBJECT] = (uint32_t)_scene.dynamicObjects.size();
+	_stats.counts[(uint32_t)SCENE_ASSET::SKINNED_OBJECT] = (uint32_t)_scene.skinnedObjects.size();
+
+	for(uint32_t i = 0; i < SCENE_ASSET_COUNT; ++i) {
+		assetOffsets[i + 1] = assetOffsets[i] + _stats.counts[i];
+		remaining[i] = _stats.counts[i];
+	}
+
+	const uint32_t assetCount = assetOffsets[SCENE_ASSET_COUNT];
+	assets.reset(new Asset[assetCount]);
+	remainingAssets = assetCount;
+	remainingResident = objectCount;
+	if(!assetCount) _stats.addedSeconds = _stats.parseSeconds;
+	if(!objectCount) _stats.residentSeconds = _stats.parseSeconds;
+
+	// Each dependency and the asset which depends on it
+	std::vector<std::pair<uint32_t, uint32_t>> edges;
+	const auto addDependency = [this, &edges](uint32_t asset, SCENE_ASSET type, uint32_t index) {
+		if(index == SCENE_NONE) return;
+
+		edges.emplace_back(getAssetIndex(type, index), asset);
+		++assets[asset].pending;
+	};
+
+	for(uint32_t i = 0; i < _scene.materials.size(); ++i)
+		for(uint32_t texture : _scene.materials[i].textures)
+			addDependency(getAssetIndex(SCENE_ASSET::MATERIAL, i), SCENE_ASSET::TEXTURE, texture);
+
+	const std::pair<SCENE_ASSET, const std::vector<SceneObject>*> objects[]{
+		{ SCENE_ASSET::STATIC_OBJECT, &_scene.staticObjects },
+		{ SCENE_ASSET::DYNAMIC_OBJECT, &_scene.dynamicObjects },
+		{ SCENE_ASSET::SKINNED_OBJECT, &_scene.skinnedObjects }
+	};
+	for(const std::pair<SCENE_ASSET, const std::vector<SceneObject>*>& entry : objects) {
+		for(uint32_t i = 0; i < entry.second->size(); ++i) {
+			const SceneObject& object = (*entry.second)[i];
+			const uint32_t asset = getAssetIndex(entry.first, i);
+			addDependency(asset, SCENE_ASSET::MESH, object.mesh);
+			addDependency(asset, SCENE_ASSET::MATERIAL, object.material);
+			addDependency(asset, SCENE_ASSET::ARMATURE, object.armature);
+		}
+	}
+
+	// Bucket the dependents by dependency
+	dependentStarts.assign(assetCount + 1, 0);
+	for(const std::pair<uint32_t, uint32_t>& edge : edges)
+		++dependentStarts[edge.first + 1];
+	for(uint32_t i = 0; i < assetCount; ++i)
+		dependentStarts[i + 1] += dependentStarts[i];
+	dependents.resize(edges.size());
+	{
+		std::vector<uint32_t> cursors(dependentStarts.begin(), dependentStarts.end() - 1);
+		for(const std::pair<uint32_t, uint32_t>& edge : edges)
+			dependents[cursors[edge.first]++] = edge.second;
+	}
+
+	// Paths are resolved before any read is issued, so they do not move while the reads use them
+	const std::filesystem::path directory = std::filesystem::path(fileName).parent_path();
+	paths.resize(textureCount + meshCount + armatureCount);
+	for(uint32_t i = 0; i < textureCount; ++i)
+		if(_scene.textures[i].path != SCENE_NONE) paths[i] = (directory / _scene.string(_scene.textures[i].path)).string();
+	for(uint32_t i = 0; i < meshCount; ++i)
+		paths[textureCount + i] = (directory / _scene.string(_scene.meshes[i].path)).string();
+	for(uint32_t i = 0; i < armatureCount; ++i)
+		paths[textureCount + meshCount + i] = (directory / _scene.string(_scene.armatures[i].path)).string();
+
+	textureFiles.reset(new TextureFile[textureCount]);
+	meshFiles.reset(new MeshFile[meshCount]);
+	armatureFiles.reset(new FilePool::File[armatureCount]);
+	skeletons.reset(new RIN::Skeleton[armatureCount]);
+
+	// Lights do not depend on anything, so they are added before anything else can finish
+	lights.resize(_scene.lights.size());
+	for(uint32_t i = 0; i < lights.size(); ++i) {
+		const SceneLight& sceneLight = _scene.lights[i];
+		RIN::Light* light = renderer->addLight();
+		if(light) {
+			light->position = { sceneLight.position[0], sceneLight.position[1], sceneLight.position[2] };
+			light->radius = sceneLight.radius;
+			light->color = { sceneLight.color[0], sceneLight.color[1], sceneLight.color[2] };
+		}
+		lights[i] = light;
+	}
+
+	_parsed = true;
+
+	// Generating LODs takes the longest, so meshes and armatures are read first
+	for(uint32_t i = 0; i < meshCount; ++i) {
+		const uint32_t asset = getAssetIndex(SCENE_ASSET::MESH, i);
+		const LODSettings* settings = _scene.meshes[i].flags & SCENE_MESH_FLAG_GENERATE_LODS ? &lodSettings : nullptr;
+		meshFiles[i].load(filePool, paths[textureCount + i].c_str(), settings,
+			[this, asset](bool decoded) {
+				if(decoded) addAsset(asset);
+				else finishAsset(asset, nullptr);
+			}
+		);
+	}
+
+	for(uint32_t i = 0; i < armatureCount; ++i) {
+		const uint32_t asset = getAssetIndex(SCENE_ASSET::ARMATURE, i);
+		filePool.mapFile(paths[textureCount + meshCount + i].c_str(), armatureFiles[i],
+			[this, asset, i](FilePool::File& armatureFile) {
+				// The skeleton has its own copy of the file
+				const bool loaded = skeletons[i].load(armatureFile.data(), armatureFile.size());
+				armatureFile.close();
+
+				if(loaded) addAsset(asset);
+				else finishAsset(asset, nullptr);
+			}
+		);
+	}
+
+	for(uint32_t i = 0; i < textureCount; ++i) {
+		if(_scene.textures[i].path == SCENE_NONE) continue;
+
+		const uint32_t asset = getAssetIndex(SCENE_ASSET::TEXTURE, i);
+		textureFiles[i].load(filePool, paths[i].c_str(),
+			[this, asset](bool valid) {
+				if(valid) addAsset(asset);
+				else finishAsset(asset, nullptr);
+			}
+		);
+	}
+
+	for(uint32_t i = 0; i < textureCount; ++i)
+		if(_scene.textures[i].path == SCENE_NONE) addAsset(getAssetIndex(SCENE_ASSET::TEXTURE, i));
+}
+
+uint32_t SceneLoader::getAssetIndex(SCENE_ASSET type, uint32_t index) const {
+	return assetOffsets[(uint32_t)type] + index;
+}
+
+SCENE_ASSET SceneLoader::getAssetType(uint32_t asset) const {
+	uint32_t type = 0;
+	while(asset >= assetOffsets[type + 1])
+		++type;
+
+	return (SCENE_ASSET)type;
+}
+
+void SceneLoader::addAsset(uint32_t asset) {
+	const SCENE_ASSET type = getAssetType(asset);
+	const uint32_t index = asset - assetOffsets[(uint32_t)type];
+
+	if(assets[asset].failed) {
+		finishAsset(asset, nullptr);
+		return;
+	}
+
+	void* object = nullptr;
+	switch(type) {
+	case SCENE_ASSET::TEXTURE:
+	{
+		const SceneTexture& texture = _scene.textures[index];
+		if(texture.path == SCENE_NONE) {
+			object = renderer->addTexture(RIN::TEXTURE_TYPE::TEXTURE_2D, texture.format, 1, 1, 1, (const char*)texture.color);
+			break;
+		}
+
+		TextureFile& textureFile = textureFiles[index];
+		const TextureView& view = textureFile.view();
+		object = renderer->addTexture(view.type, view.format, view.width, view.height, view.mipCount, textureFile.data(), [&textureFile]() { textureFile.close(); });
+		if(!object) textureFile.close();
+		break;
+	}
+	case SCENE_ASSET::MATERIAL:
+	{
+		const SceneMaterial& material = _scene.materials[index];
+		RIN::Texture* textures[6];
+		for(uint32_t i = 0; i < 6; ++i)
+			textures[i] = getObject<RIN::Texture>(SCENE_ASSET::TEXTURE, material.textures[i]);
+
+		object = renderer->addMaterial(material.type, textures[0], textures[1], textures[2], textures[3], textures[4], textures[5]);
+		break;
+	}
+	case SCENE_ASSET::MESH:
+	{
+		MeshFile& meshFile = meshFiles[index];
+		const MeshData& mesh = meshFile.mesh();
+		const RIN::residency_callback_type onResident = [&meshFile]() { meshFile.close(); };
+
+		// The file holds a different type of mesh than the scene says
+		if(mesh.type != _scene.meshes[index].type) {
+			meshFile.close();
+			break;
+		}
+
+		// The LODs are stored back to back, starting with the most detailed
+		RIN::BoundingSphere boundingSphere(mesh.boundingSphere[0], mesh.boundingSphere[1], mesh.boundingSphere[2], mesh.boundingSphere[3]);
+
+		switch(mesh.type) {
+		case MESH_TYPE::STATIC:
+		{
+			const RIN::StaticVertex* vertices = (const RIN::StaticVertex*)mesh.vertices.data();
+
+			// Streamed meshes only upload the detailed LODs when they are needed, so the mesh stays loaded
+			if(_scene.meshes[index].flags & SCENE_MESH_FLAG_STREAMED)
+				object = renderer->addStaticMesh(boundingSphere, vertices, mesh.vertexCounts.data(), mesh.indices.data(), mesh.indexCounts.data(), mesh.lodCount(), nullptr, 0.0f, true, mesh.sharedVertices);
+			else
+				object = renderer->addStaticMesh(boundingSphere, vertices, mesh.vertexCounts.data(), mesh.indices.data(), mesh.indexCounts.data(), mesh.lodCount(), onResident, 0.0f, false, mesh.sharedVertices);
+			break;
+		}
+		case MESH_TYPE::DYNAMIC:
+		{
+			const RIN::DynamicVertex* vertices = (const RIN::DynamicVertex*)mesh.vertices.data();
+			object = renderer->addDynamicMesh(boundingSphere, vertices, mesh.vertexCounts.data(), mesh.indices.data(), mesh.indexCounts.data(), mesh.lodCount(), onResident);
+			break;
+		}
+		case MESH_TYPE::SKINNED:
+		{
+			const RIN::SkinnedVertex* vertices = (const RIN::SkinnedVertex*)mesh.vertices.data();
+			object = renderer->addSkinnedMesh(boundingSphere, mesh.boneSpheres.data(), (uint32_t)mesh.boneSpheres.size(), vertices, mesh.vertexCounts.data(), mesh.indices.data(), mesh.indexCounts.data(), mesh.lodCount(), onResident);
+			break;
+		}
+		}
+
+		if(!object) meshFile.close();
+		break;
+	}
+	case SCENE_ASSET::ARMATURE:
+		object = renderer->addArmature((uint8_t)skeletons[index].getBoneCount());
+		break;
+	case SCENE_ASSET::STATIC_OBJECT:
+	{
+		const SceneObject& sceneObject = _scene.staticObjects[index];
+		object = renderer->addStaticObject(
+			getObject<RIN::StaticMesh>(SCENE_ASSET::MESH, sceneObject.mesh),
+			getObject<RIN::Material>(SCENE_ASSET::MATERIAL, sceneObject.material),
+			[this]() { finishObject(); }
+		);
+		break;
+	}
+	case SCENE_ASSET::DYNAMIC_OBJECT:
+	{
+		const SceneObject& sceneObject = _scene.dynamicObjects[index];
+		object = renderer->addDynamicObject(
+			getObject<RIN::DynamicMesh>(SCENE_ASSET::MESH, sceneObject.mesh),
+			getObject<RIN::Material>(SCENE_ASSET::MATERIAL, sceneObject.material),
+			[this]() { finishObject(); }
+		);
+		break;
+	}
+	case SCENE_ASSET::SKINNED_OBJECT:
+	{
+		const SceneObject& sceneObject = _scene.skinnedObjects[index];
+		object = renderer->addSkinnedObject(
+			getObject<RIN::SkinnedMesh>(SCENE_ASSET::MESH, sceneObject.mesh),
+			getObject<RIN::Armature>(SCENE_ASSET::ARMATURE, sceneObject.armature),
+			getObject<RIN::Material>(SCENE_ASSET::MATERIAL, sceneObject.material),
+			[this]() { finishObject(); }
+		);
+		break;
+	}
+	}
+
+	finishAsset(asset, object);
+}
+
+void SceneLoader::finishAsset(uint32_t asset, void* object) {
+	const SCENE_ASSET type = getAssetType(asset);
+	const uint32_t typeIndex = (uint32_t)type;
+
+	assets[asset].object = object;
+	if(object) {
+		if(!added[typeIndex]++) _stats.firstSeconds[typeIndex] = timer.elapsedSeconds();
+	} else {
+		++failures[typeIndex];
+		// Failed objects will never be resident
+		if(type >= SCENE_ASSET::STATIC_OBJECT) finishObject();
+	}
+
+	if(remaining[typeIndex]-- == 1) _stats.lastSeconds[typeIndex] = timer.elapsedSeconds();
+
+	// The dependents see the failure once they are added
+	for(uint32_t i = dependentStarts[asset]; i < dependentStarts[asset + 1]; ++i) {
+		Asset& dependent = assets[dependents[i]];
+		if(!object) dependent.failed = true;
+		if(dependent.pending-- == 1) addAsset(dependents[i]);
+	}
+
+	if(remainingAssets-- == 1) {
+		for(uint32_t i = 0; i < SCENE_ASSET_COUNT; ++i)
+			_stats.failures[i] = failures[i];
+		_stats.addedSeconds = timer.elapsedSeconds();
+	}
+}
+
+void SceneLoader::finishObject() {
+	if(remainingResident-- == 1) _stats.residentSeconds = timer.elapsedSeconds();
+}
+
+template<class T>
+T* SceneLoader::getObject(SCENE_ASSET type, uint32_t index) const {
+	if(index == SCENE_NONE) return nullptr;
+
+	return (T*)assets[getAssetIndex(type, index)].object.load();
+}
+
+void SceneLoader::update() {
+	if(skyboxSet || !_parsed || _scene.skybox[0] == SCENE_NONE) return;
+
+	RIN::Texture* skybox = getTexture(_scene.skybox[0]);
+	RIN::Texture* iblDiffuse = getTexture(_scene.skybox[1]);
+	RIN::Texture* iblSpecular = getTexture(_scene.skybox[2]);
+	if(skybox && iblDiffuse && iblSpecular) {
+		renderer->setSkybox(skybox, iblDiffuse, iblSpecular);
+		skyboxSet = true;
+	}
+}
+
+void SceneLoader::unload() {
+	if(!_parsed) return;
+
+	if(skyboxSet) {
+		renderer->clearSkybox();
+		skyboxSet = false;
+	}
+
+	// Dependents are removed before what they depend on
+	for(uint32_t i = assetOffsets[SCENE_ASSET_COUNT]; i--;) {
+		void* object = assets[i].object.exchange(nullptr);
+		if(!object) continue;
+
+		const SCENE_ASSET type = getAssetType(i);
+		const uint32_t index = i - assetOffsets[(uint32_t)type];
+		switch(type) {
+		case SCENE_ASSET::TEXTURE:
+			renderer->removeTexture((RIN::Texture*)object);
+			textureFiles[index].close();
+			break;
+		case SCENE_ASSET::MATERIAL:
+			renderer->removeMaterial((RIN::Material*)object);
+			break;
+		case SCENE_ASSET::MESH:
+			switch(_scene.meshes[index].type) {
+			case MESH_TYPE::STATIC:
+				renderer->removeStaticMesh((RIN::StaticMesh*)object);
+				break;
+			case MESH_TYPE::DYNAMIC:
+				renderer->removeDynamicMesh((RIN::DynamicMesh*)object);
+				break;
+			case MESH_TYPE::SKINNED:
+				renderer->removeSkinnedMesh((RIN::SkinnedMesh*)object);
+				break;
+			}
+			meshFiles[index].close();
+			break;
+		case SCENE_ASSET::ARMATURE:
+			renderer->removeArmature((RIN::Armature*)object);
+			break;
+		case SCENE_ASSET::STATIC_OBJECT:
+			renderer->removeStaticObject((RIN::StaticObject*)object);
+			break;
+		case SCENE_ASSET::DYNAMIC_OBJECT:
+			renderer->removeDynamicObject((RIN::DynamicObject*)object);
+			break;
+		case SCENE_ASSET::SKINNED_OBJECT:
+			renderer->removeSkinnedObject((RIN::SkinnedObject*)object);
+			break;
+		}
+	}
+
+	for(RIN::Light*& light : lights) {
+		renderer->removeLight(light);
+		light = nullptr;
+	}
+}
+
+bool SceneLoader::parsed() const {
+	return _parsed;
+}
+
+bool SceneLoader::failed() const {
+	return _failed;
+}
+
+bool SceneLoader::done() const {
+	return _failed || (_parsed && !remainingAssets);
+}
+
+bool SceneLoader::resident() const {
+	return _parsed && !remainingResident;
+}
+
+const SceneData& SceneLoader::scene() const {
+	return _scene;
+}
+
+const SceneLoadStats& SceneLoader::stats() const {
+	return _stats;
+}
+
+RIN::Texture* SceneLoader::getTexture(uint32_t index) const {
+	if(!_parsed || index >= _scene.textures.size()) return nullptr;
+
+	return getObject<RIN::Texture>(SCENE_ASSET::TEXTURE, index);
+}
+
+RIN::Material* SceneLoader::getMaterial(uint32_t index) const {
+	if(!_parsed || index >= _scene.materials.size()) return nullptr;
+
+	return getObject<RIN::Material>(SCENE_ASSET::MATERIAL, index);
+}
+
+RIN::StaticMesh* SceneLoader::getStaticMesh(uint32_t index) const {
+	if(!_parsed || index >= _scene.meshes.size() || _scene.meshes[index].type != MESH_TYPE::STATIC) return nullptr;
+
+	return getObject<RIN::StaticMesh>(SCENE_ASSET::MESH, index);
+}
+
+RIN::DynamicMesh* SceneLoader::getDynamicMesh(uint32_t index) const {
+	if(!_parsed || index >= _scene.meshes.size() || _scene.meshes[index].type != MESH_TYPE::DYNAMIC) return nullptr;
+
+	return getObject<RIN::DynamicMesh>(SCENE_ASSET::MESH, index);
+}
+
+RIN::SkinnedMesh* SceneLoader::getSkinnedMesh(uint32_t index) const {
+	if(!_parsed || index >= _scene.meshes.size() || _scene.meshes[index].type != MESH_TYPE::SKINNED) return nullptr;
+
+	return getObject<RIN::SkinnedMesh>(SCENE_ASSET::MESH, index);
+}
+
+RIN::Armature* SceneLoader::getArmature(uint32_t index) const {
+	if(!_parsed || index >= _scene.armatures.size()) return nullptr;
+
+	return getObject<RIN::Armature>(SCENE_ASSET::ARMATURE, index);
+}
+
+const RIN::Skeleton& SceneLoader::getSkeleton(uint32_t index) const {
+	return skeletons[index];
+}
+
+RIN::StaticObject* SceneLoader::getStaticObject(uint32_t index) const {
+	if(!_parsed || index >= _scene.staticObjects.size()) return nullptr;
+
+	return getObject<RIN::StaticObject>(SCENE_ASSET::STATIC_OBJECT, index);
+}
+
+RIN::DynamicObject* SceneLoader::getDynamicObject(uint32_t index) const {
+	if(!_parsed || index >= _scene.dynamicObjects.size()) return nullptr;
+
+	return getObject<RIN::DynamicObject>(SCENE_ASSET::DYNAMIC_OBJECT, index);
+}
+
+RIN::SkinnedObject* SceneLoader::getSkinnedObject(uint32_t index) const {
+	if(!_parsed || index >= _scene.skinnedObjects.size()) return nullptr;
+
+	return getObject<RIN::SkinnedObject>(SCENE_ASSET::SKINNED_OBJECT, index);
+}
+
+RIN::Light* SceneLoader::getLight(uint32_t index) const {
+	if(!_parsed || index >= lights.size()) return nullptr;
+
+	return lights[index];
+}
\ No newline at end of file
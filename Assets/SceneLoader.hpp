@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Renderer.hpp>
+#include <Skeleton.hpp>
+
+#include "FilePool.hpp"
+#include "MeshFile.hpp"
+#include "SceneFile.hpp"
+#include "TextureFile.hpp"
+#include "Timer.hpp"
+
+enum class SCENE_ASSET : uint32_t {
+	TEXTURE,
+	MATERIAL,
+	MESH,
+	ARMATURE,
+	STATIC_OBJECT,
+	DYNAMIC_OBJECT,
+	SKINNED_OBJECT
+};
+
+constexpr uint32_t SCENE_ASSET_COUNT = 7;
+
+// Seconds are measured from SceneLoader::load, the arrays are indexed by SCENE_ASSET
+struct SceneLoadStats {
+	float parseSeconds = 0.0f; // The scene file was read and parsed, every asset read is issued right after
+	uint32_t counts[SCENE_ASSET_COUNT]{};
+	uint32_t failures[SCENE_ASSET_COUNT]{}; // Assets which could not be decoded or added, or which depend on one
+	float firstSeconds[SCENE_ASSET_COUNT]{}; // The first asset of the type was added
+	float lastSeconds[SCENE_ASSET_COUNT]{}; // Every asset of the type was added or failed
+	float addedSeconds = 0.0f; // Every asset was added or failed
+	float residentSeconds = 0.0f; // Every object which was added is resident, the scene is interactive
+};
+
+/*
+Loads an .rscn scene file through a FilePool and adds it to a renderer
+
+Once the scene file is parsed, the reads of every texture, mesh and
+armature are issued at once, meshes and armatures first since generating
+LODs takes the longest, and they are decoded on the FilePool workers
+Each asset counts the assets it depends on which are not added yet, the
+worker which adds the last one adds the asset right away, so materials
+are added as soon as their textures are and objects as soon as their
+mesh, material and armature are, without waiting for the rest of the
+scene or for the next frame
+Assets which fail to decode or add fail everything which depends on them,
+the rest of the scene still loads, an asset whose file can not be read
+at all never finishes
+
+Textures, dynamic meshes and skinned meshes close their files once they
+are resident, streamed static meshes keep theirs loaded
+
+Thread Safety:
+SceneLoader::load, SceneLoader::update and SceneLoader::unload are not
+thread-safe and must be called from the thread which calls
+Renderer::update
+The getters are thread-safe, they return nullptr until the asset is added
+SceneLoader::stats is thread-safe once the scene is done and resident
+*/
+class SceneLoader {
+	struct Asset {
+		std::atomic<uint32_t> pending = 0; // Dependencies which are not added yet
+		std::atomic<bool> failed = false; // Set if a dependency failed
+		std::atomic<void*> object = nullptr;
+	};
+
+	RIN::Renderer* renderer = nullptr;
+	std::string fileName;
+	FilePool::File file;
+	SceneData _scene;
+	const LODSettings lodSettings;
+	Timer timer;
+	SceneLoadStats _stats;
+
+	std::vector<std::string> paths; // Resolved paths of the textures, meshes and armatures, in that order
+	std::unique_ptr<TextureFile[]> textureFiles;
+	std::unique_ptr<MeshFile[]> meshFiles;
+	std::unique_ptr<FilePool::File[]> armatureFiles;
+	std::unique_ptr<RIN::Skeleton[]> skeletons;
+	std::vector<RIN::Light*> lights;
+
+	// Every asset back to back, grouped by SCENE_ASSET
+	std::unique_ptr<Asset[]> assets;
+	uint32_t assetOffsets[SCENE_ASSET_COUNT + 1]{};
+	// Assets which depend on each asset, assets i depend on are dependents[dependentStarts[i], dependentStarts[i + 1])
+	std::vector<uint32_t> dependentStarts;
+	std::vector<uint32_t> dependents;
+
+	std::atomic<uint32_t> added[SCENE_ASSET_COUNT]{};
+	std::atomic<uint32_t> failures[SCENE_ASSET_COUNT]{};
+	std::atomic<uint32_t> remaining[SCENE_ASSET_COUNT]{};
+	std::atomic<uint32_t> remainingAssets = 0;
+	std::atomic<uint32_t> remainingResident = 0; // Objects which are neither resident nor failed
+	std::atomic<bool> _parsed = false;
+	std::atomic<bool> _failed = false;
+	bool skyboxSet = false;
+
+	// Called on the worker which mapped the scene file
+	void parse(FilePool& filePool);
+	uint32_t getAssetIndex(SCENE_ASSET type, uint32_t index) const;
+	SCENE_ASSET getAssetType(uint32_t asset) const;
+	// Called on the thread which finished the file or the last dependency of the asset
+	void addAsset(uint32_t asset);
+	// object is nullptr if the asset failed
+	void finishAsset(uint32_t asset, void* object);
+	void finishObject();
+	// Does not check that the scene is parsed, index may be SCENE_NONE
+	template<class T>
+	T* getObject(SCENE_ASSET type, uint32_t index) const;
+public:
+	SceneLoader() = default;
+	SceneLoader(const SceneLoader&) = delete;
+	~SceneLoader() = default;
+	/*
+	Each SceneLoader loads one scene, it must not be destroyed until the
+	file pool has finished with it, see FilePool::wait
+	*/
+	void load(FilePool& filePool, RIN::Renderer* renderer, const char* sceneFileName);
+	// Call every frame after Renderer::update, sets the skybox once its textures are added
+	void update();
+	// Removes everything the scene added from the renderer and clears the skybox if it was set, the file pool must have finished with the scene
+	void unload();
+	// True once the scene file is parsed, the scene and lights can be used from then on
+	bool parsed() const;
+	// True if the scene file is not a valid scene
+	bool failed() const;
+	// True once every asset is added or failed
+	bool done() const;
+	// True once every object which was added is resident
+	bool resident() const;
+	const SceneData& scene() const;
+	const SceneLoadStats& stats() const;
+	RIN::Texture* getTexture(uint32_t index) const;
+	RIN::Material* getMaterial(uint32_t index) const;
+	RIN::StaticMesh* getStaticMesh(uint32_t index) const;
+	RIN::DynamicMesh* getDynamicMesh(uint32_t index) const;
+	RIN::SkinnedMesh* getSkinnedMesh(uint32_t index) const;
+	RIN::Armature* getArmature(uint32_t index) const;
+	// Valid once the armature is added
+	const RIN::Skeleton& getSkeleton(uint32_t index) const;
+	RIN::StaticObject* getStaticObject(uint32_t index) const;
+	RIN::DynamicObject* getDynamicObject(uint32_t index) const;
+	RIN::SkinnedObject* getSkinnedObject(uint32_t index) const;
+	RIN::Light* getLight(uint32_t index) const;
+};
\ No newline at end of file
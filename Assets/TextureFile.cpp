@@ -0,0 +1,43 @@
+#include "TextureFile.hpp"
+
+void TextureFile::load(FilePool& filePool, const char* fileName, const callback_type& callback) {
+	close();
+
+	filePool.mapFile(fileName, file,
+		[this, callback](FilePool::File& mapped) {
+			// Called on the worker which mapped the file
+			if(!parseTexture(mapped.data(), mapped.size(), _view)) {
+				mapped.close();
+				if(callback) callback(false);
+				return;
+			}
+
+			if(!_view.contiguous) {
+				packed.resize(_view.size());
+				copyTextureData(_view, packed.data());
+				mapped.close();
+			}
+
+			_ready = true;
+			if(callback) callback(true);
+		}
+	);
+}
+
+bool TextureFile::ready() const {
+	return _ready;
+}
+
+const TextureView& TextureFile::view() const {
+	return _view;
+}
+
+const char* TextureFile::data() const {
+	return _view.contiguous ? _view.data() : packed.data();
+}
+
+void TextureFile::close() {
+	_ready = false;
+	packed = std::vector<char>();
+	file.close();
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <vector>
+
+#include "FilePool.hpp"
+#include "TextureFormat.hpp"
+
+/*
+Loads a .dds or .ktx2 texture file through a FilePool
+
+The file is mapped and parsed on the FilePool worker which mapped it,
+the texture data stays in the mapping unless the subresources are not
+in subresource order, in which case they are packed into a copy
+
+Thread Safety:
+TextureFile::ready is thread-safe
+TextureFile::view is thread-safe once the texture is ready
+TextureFile::data is thread-safe once the texture is ready
+*/
+class TextureFile {
+	FilePool::File file;
+	TextureView _view{};
+	std::vector<char> packed;
+	std::atomic<bool> _ready = false;
+public:
+	// Called on the worker with whether the texture could be parsed, it is
+	// not called if the file could not be read
+	typedef std::function<void(bool)> callback_type;
+
+	TextureFile() = default;
+	TextureFile(const TextureFile&) = delete;
+	~TextureFile() = default;
+	// The TextureFile must not be destroyed or reloaded until the file pool has finished with it
+	void load(FilePool& filePool, const char* fileName, const callback_type& callback = nullptr);
+	// Stays false if the file could not be read or parsed
+	bool ready() const;
+	const TextureView& view() const;
+	// Every subresource back to back, which can be passed to addTexture
+	const char* data() const;
+	// Call once the texture is resident
+	void close();
+};
\ No newline at end of file
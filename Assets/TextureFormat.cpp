@@ -0,0 +1,284 @@
+#include "TextureFormat.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+constexpr char DDS_MAGIC[4]{ 'D', 'D', 'S', ' ' };
+constexpr uint64_t DDS_HEADER_SIZE = 128; // Including the magic
+constexpr uint64_t DDS_DX10_HEADER_SIZE = 148;
+constexpr uint32_t DDPF_ALPHAPIXELS = 0x1;
+constexpr uint32_t DDPF_FOURCC = 0x4;
+constexpr uint32_t DDPF_RGB = 0x40;
+constexpr uint32_t DDPF_LUMINANCE = 0x20000;
+constexpr uint32_t DDSCAPS2_CUBEMAP = 0x200;
+constexpr uint32_t DDSCAPS2_CUBEMAP_ALLFACES = 0xFC00;
+constexpr uint32_t DDSCAPS2_VOLUME = 0x200000;
+constexpr uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+constexpr uint32_t DDS_RESOURCE_MISC_TEXTURECUBE = 0x4;
+
+constexpr char KTX2_IDENTIFIER[12]{ (char)0xAB, 'K', 'T', 'X', ' ', '2', '0', (char)0xBB, '\r', '\n', 0x1A, '\n' };
+constexpr uint64_t KTX2_HEADER_SIZE = 80; // Including the index
+constexpr uint64_t KTX2_LEVEL_SIZE = 24;
+
+// D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION
+constexpr uint32_t TEXTURE_MAX_DIMENSION = 16384;
+
+static uint32_t read32(const char* data) {
+	uint32_t value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+static uint64_t read64(const char* data) {
+	uint64_t value;
+	memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+static bool getDXGIFormat(uint32_t dxgiFormat, RIN::TEXTURE_FORMAT& format) {
+	// DXGI_FORMAT values
+	switch(dxgiFormat) {
+	case 61: format = RIN::TEXTURE_FORMAT::R8_UNORM; return true;
+	case 54: format = RIN::TEXTURE_FORMAT::R16_FLOAT; return true;
+	case 41: format = RIN::TEXTURE_FORMAT::R32_FLOAT; return true;
+	case 49: format = RIN::TEXTURE_FORMAT::R8G8_UNORM; return true;
+	case 34: format = RIN::TEXTURE_FORMAT::R16G16_FLOAT; return true;
+	case 16: format = RIN::TEXTURE_FORMAT::R32G32_FLOAT; return true;
+	case 28: format = RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM; return true;
+	case 29: format = RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB; return true;
+	case 87: format = RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM; return true;
+	case 91: format = RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB; return true;
+	case 10: format = RIN::TEXTURE_FORMAT::R16B16G16A16_FLOAT; return true;
+	case 2: format = RIN::TEXTURE_FORMAT::R32G32B32A32_FLOAT; return true;
+	case 77: format = RIN::TEXTURE_FORMAT::BC3_UNORM; return true;
+	case 78: format = RIN::TEXTURE_FORMAT::BC3_UNORM_SRGB; return true;
+	case 80: format = RIN::TEXTURE_FORMAT::BC4_UNORM; return true;
+	case 83: format = RIN::TEXTURE_FORMAT::BC5_UNORM; return true;
+	case 95: format = RIN::TEXTURE_FORMAT::BC6H_UFLOAT; return true;
+	case 96: format = RIN::TEXTURE_FORMAT::BC6H_FLOAT; return true;
+	case 98: format = RIN::TEXTURE_FORMAT::BC7_UNORM; return true;
+	case 99: format = RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB; return true;
+	case 71: format = RIN::TEXTURE_FORMAT::BC1_UNORM; return true;
+	case 72: format = RIN::TEXTURE_FORMAT::BC1_UNORM_SRGB; return true;
+	}
+	return false;
+}
+
+static bool getVkFormat(uint32_t vkFormat, RIN::TEXTURE_FORMAT& format) {
+	// VkFormat values
+	switch(vkFormat) {
+	case 9: format = RIN::TEXTURE_FORMAT::R8_UNORM; return true;
+	case 76: format = RIN::TEXTURE_FORMAT::R16_FLOAT; return true;
+	case 100: format = RIN::TEXTURE_FORMAT::R32_FLOAT; return true;
+	case 16: format = RIN::TEXTURE_FORMAT::R8G8_UNORM; return true;
+	case 83: format = RIN::TEXTURE_FORMAT::R16G16_FLOAT; return true;
+	case 103: format = RIN::TEXTURE_FORMAT::R32G32_FLOAT; return true;
+	case 37: format = RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM; return true;
+	case 43: format = RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB; return true;
+	case 44: format = RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM; return true;
+	case 50: format = RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB; return true;
+	case 97: format = RIN::TEXTURE_FORMAT::R16B16G16A16_FLOAT; return true;
+	case 109: format = RIN::TEXTURE_FORMAT::R32G32B32A32_FLOAT; return true;
+	case 137: format = RIN::TEXTURE_FORMAT::BC3_UNORM; return true;
+	case 138: format = RIN::TEXTURE_FORMAT::BC3_UNORM_SRGB; return true;
+	case 139: format = RIN::TEXTURE_FORMAT::BC4_UNORM; return true;
+	case 141: format = RIN::TEXTURE_FORMAT::BC5_UNORM; return true;
+	case 143: format = RIN::TEXTURE_FORMAT::BC6H_UFLOAT; return true;
+	case 144: format = RIN::TEXTURE_FORMAT::BC6H_FLOAT; return true;
+	case 145: format = RIN::TEXTURE_FORMAT::BC7_UNORM; return true;
+	case 146: format = RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB; return true;
+	case 131:
+	case 133: format = RIN::TEXTURE_FORMAT::BC1_UNORM; return true;
+	case 132:
+	case 134: format = RIN::TEXTURE_FORMAT::BC1_UNORM_SRGB; return true;
+	}
+	return false;
+}
+
+// The pixel format of a DDS file without the DX10 header extension
+static bool getLegacyFormat(const char* pixelFormat, RIN::TEXTURE_FORMAT& format) {
+	const uint32_t flags = read32(pixelFormat + 4);
+	const char* fourCC = pixelFormat + 8;
+	const uint32_t bitCount = read32(pixelFormat + 12);
+	const uint32_t redMask = read32(pixelFormat + 16);
+	const uint32_t greenMask = read32(pixelFormat + 20);
+	const uint32_t blueMask = read32(pixelFormat + 24);
+	const uint32_t alphaMask = read32(pixelFormat + 28);
+
+	if(flags & DDPF_FOURCC) {
+		if(!memcmp(fourCC, "DXT1", 4)) format = RIN::TEXTURE_FORMAT::BC1_UNORM;
+		else if(!memcmp(fourCC, "DXT4", 4) || !memcmp(fourCC, "DXT5", 4)) format = RIN::TEXTURE_FORMAT::BC3_UNORM;
+		else if(!memcmp(fourCC, "ATI1", 4) || !memcmp(fourCC, "BC4U", 4)) format = RIN::TEXTURE_FORMAT::BC4_UNORM;
+		else if(!memcmp(fourCC, "ATI2", 4) || !memcmp(fourCC, "BC5U", 4)) format = RIN::TEXTURE_FORMAT::BC5_UNORM;
+		else {
+			// D3DFORMAT values stored in place of the four character code
+			switch(read32(fourCC)) {
+			case 111: format = RIN::TEXTURE_FORMAT::R16_FLOAT; return true;
+			case 112: format = RIN::TEXTURE_FORMAT::R16G16_FLOAT; return true;
+			case 113: format = RIN::TEXTURE_FORMAT::R16B16G16A16_FLOAT; return true;
+			case 114: format = RIN::TEXTURE_FORMAT::R32_FLOAT; return true;
+			case 115: format = RIN::TEXTURE_FORMAT::R32G32_FLOAT; return true;
+			case 116: format = RIN::TEXTURE_FORMAT::R32G32B32A32_FLOAT; return true;
+			}
+			return false;
+		}
+		return true;
+	}
+
+	if(flags & DDPF_RGB && bitCount == 32 && flags & DDPF_ALPHAPIXELS) {
+		if(redMask == 0xFF && greenMask == 0xFF00 && blueMask == 0xFF0000 && alphaMask == 0xFF000000) {
+			format = RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM;
+			return true;
+		}
+		if(redMask == 0xFF0000 && greenMask == 0xFF00 && blueMask == 0xFF && alphaMask == 0xFF000000) {
+			format = RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM;
+			return true;
+		}
+		return false;
+	}
+
+	if(flags & DDPF_LUMINANCE) {
+		if(bitCount == 8 && redMask == 0xFF) {
+			format = RIN::TEXTURE_FORMAT::R8_UNORM;
+			return true;
+		}
+		// Luminance and alpha
+		if(bitCount == 16 && redMask == 0xFF && alphaMask == 0xFF00) {
+			format = RIN::TEXTURE_FORMAT::R8G8_UNORM;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool setDimensions(TextureView& view, uint32_t width, uint32_t height, uint32_t mipCount, bool cube) {
+	if(!width || !height || width > TEXTURE_MAX_DIMENSION || height > TEXTURE_MAX_DIMENSION) return false;
+	if(cube && width != height) return false;
+
+	uint32_t fullMipCount = 1;
+	for(uint32_t size = std::max(width, height); size > 1; size >>= 1)
+		++fullMipCount;
+	if(!mipCount || mipCount > fullMipCount) return false;
+
+	view.type = cube ? RIN::TEXTURE_TYPE::TEXTURE_CUBE : RIN::TEXTURE_TYPE::TEXTURE_2D;
+	view.width = width;
+	view.height = height;
+	view.mipCount = mipCount;
+	view.arraySize = cube ? 6 : 1;
+
+	for(uint32_t face = 0; face < view.arraySize; ++face) {
+		for(uint32_t mip = 0; mip < mipCount; ++mip) {
+			TextureSubresource& subresource = view.subresources[face * mipCount + mip];
+			subresource.rowPitch = RIN::Texture::getRowPitch(std::max(width >> mip, (uint32_t)1), view.format);
+			subresource.rowCount = RIN::Texture::getRowCount(std::max(height >> mip, (uint32_t)1), view.format);
+			subresource.size = subresource.rowPitch * subresource.rowCount;
+		}
+	}
+
+	return true;
+}
+
+uint64_t TextureView::size() const {
+	uint64_t size = 0;
+	for(uint32_t i = 0; i < subresourceCount(); ++i)
+		size += subresources[i].size;
+
+	return size;
+}
+
+bool parseDDS(const char* data, uint64_t size, TextureView& view) {
+	if(size < DDS_HEADER_SIZE || memcmp(data, DDS_MAGIC, sizeof(DDS_MAGIC))) return false;
+	// Header and pixel format sizes
+	if(read32(data + 4) != 124 || read32(data + 76) != 32) return false;
+
+	const uint32_t height = read32(data + 12);
+	const uint32_t width = read32(data + 16);
+	const uint32_t mipCount = std::max(read32(data + 28), (uint32_t)1);
+	const uint32_t caps2 = read32(data + 112);
+
+	bool cube;
+	uint64_t offset;
+	if(read32(data + 80) & DDPF_FOURCC && !memcmp(data + 84, "DX10", 4)) {
+		if(size < DDS_DX10_HEADER_SIZE) return false;
+		if(!getDXGIFormat(read32(data + 128), view.format)) return false;
+		// Only single 2D textures and cubes
+		if(read32(data + 132) != DDS_DIMENSION_TEXTURE2D || read32(data + 140) != 1) return false;
+
+		cube = (read32(data + 136) & DDS_RESOURCE_MISC_TEXTURECUBE) != 0;
+		offset = DDS_DX10_HEADER_SIZE;
+	} else {
+		if(!getLegacyFormat(data + 76, view.format)) return false;
+		if(caps2 & DDSCAPS2_VOLUME) return false;
+		// Cubes with missing faces are not supported
+		if(caps2 & DDSCAPS2_CUBEMAP && (caps2 & DDSCAPS2_CUBEMAP_ALLFACES) != DDSCAPS2_CUBEMAP_ALLFACES) return false;
+
+		cube = (caps2 & DDSCAPS2_CUBEMAP) != 0;
+		offset = DDS_HEADER_SIZE;
+	}
+
+	if(!setDimensions(view, width, height, mipCount, cube)) return false;
+
+	// DDS files store every mip of a face before the next face, which is the subresource order
+	for(uint32_t i = 0; i < view.subresourceCount(); ++i) {
+		TextureSubresource& subresource = view.subresources[i];
+		if(subresource.size > size - offset) return false;
+
+		subresource.data = data + offset;
+		offset += subresource.size;
+	}
+	view.contiguous = true;
+
+	return true;
+}
+
+bool parseKTX2(const char* data, uint64_t size, TextureView& view) {
+	if(size < KTX2_HEADER_SIZE || memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER))) return false;
+	if(!getVkFormat(read32(data + 12), view.format)) return false;
+
+	const uint32_t width = read32(data + 20);
+	const uint32_t height = read32(data + 24);
+	// Only single 2D textures and cubes which are not supercompressed
+	if(read32(data + 28) || read32(data + 32) > 1 || read32(data + 44)) return false;
+
+	const uint32_t faceCount = read32(data + 36);
+	if(faceCount != 1 && faceCount != 6) return false;
+
+	// A level count of 0 asks for mips to be generated, which is not supported, so only the base level is used
+	const uint32_t mipCount = std::max(read32(data + 40), (uint32_t)1);
+	if(!setDimensions(view, width, height, mipCount, faceCount == 6)) return false;
+	if(size < KTX2_HEADER_SIZE + mipCount * KTX2_LEVEL_SIZE) return false;
+
+	// Each level holds every face of one mip, the levels are not in subresource order
+	for(uint32_t mip = 0; mip < mipCount; ++mip) {
+		const char* level = data + KTX2_HEADER_SIZE + mip * KTX2_LEVEL_SIZE;
+		const uint64_t levelOffset = read64(level);
+		const uint64_t levelSize = read64(level + 8);
+		const uint64_t faceSize = view.subresources[mip].size;
+
+		if(levelOffset > size || levelSize > size - levelOffset || levelSize != faceSize * faceCount) return false;
+
+		for(uint32_t face = 0; face < faceCount; ++face)
+			view.subresources[face * mipCount + mip].data = data + levelOffset + face * faceSize;
+	}
+
+	view.contiguous = true;
+	for(uint32_t i = 1; i < view.subresourceCount(); ++i)
+		view.contiguous &= view.subresources[i].data == view.subresources[i - 1].data + view.subresources[i - 1].size;
+
+	return true;
+}
+
+bool parseTexture(const char* data, uint64_t size, TextureView& view) {
+	if(size >= sizeof(DDS_MAGIC) && !memcmp(data, DDS_MAGIC, sizeof(DDS_MAGIC))) return parseDDS(data, size, view);
+	if(size >= sizeof(KTX2_IDENTIFIER) && !memcmp(data, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER))) return parseKTX2(data, size, view);
+	return false;
+}
+
+void copyTextureData(const TextureView& view, char* textureData) {
+	for(uint32_t i = 0; i < view.subresourceCount(); ++i) {
+		const TextureSubresource& subresource = view.subresources[i];
+		memcpy(textureData, subresource.data, subresource.size);
+		textureData += subresource.size;
+	}
+}
\ No newline at end of file
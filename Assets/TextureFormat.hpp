@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+
+#include <Texture.hpp>
+
+/*
+Parses .dds and .ktx2 texture files
+
+DDS files may use the DX10 header extension or a legacy pixel format,
+KTX2 files must not be supercompressed, arrays and volume textures are
+not supported by either
+
+Parsing never allocates and never copies, the subresources point into
+the file data, so it can run wherever the file is mapped or read
+*/
+
+// D3D12_REQ_MIP_LEVELS, which covers D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION
+constexpr uint32_t TEXTURE_MAX_MIP_COUNT = 15;
+constexpr uint32_t TEXTURE_MAX_SUBRESOURCE_COUNT = TEXTURE_MAX_MIP_COUNT * 6;
+
+struct TextureSubresource {
+	const char* data;
+	uint64_t rowPitch; // Texture::getRowPitch of the mip width
+	uint32_t rowCount; // Texture::getRowCount of the mip height
+	uint64_t size;
+};
+
+struct TextureView {
+	RIN::TEXTURE_TYPE type;
+	RIN::TEXTURE_FORMAT format;
+	uint32_t width;
+	uint32_t height;
+	uint32_t mipCount;
+	uint32_t arraySize; // 6 for cubes, 1 otherwise
+	// In D3D12 subresource order, mips of the first face, then mips of the next face
+	TextureSubresource subresources[TEXTURE_MAX_SUBRESOURCE_COUNT];
+	// Set if the subresources are back to back in subresource order, which
+	// is always true for DDS files, data() can then be passed to addTexture
+	bool contiguous;
+
+	uint32_t subresourceCount() const {
+		return mipCount * arraySize;
+	}
+
+	const char* data() const {
+		return subresources[0].data;
+	}
+
+	// Size of all subresources, which is what addTexture reads
+	uint64_t size() const;
+};
+
+// Returns false if data is not a valid texture file or has an unsupported format
+bool parseDDS(const char* data, uint64_t size, TextureView& view);
+bool parseKTX2(const char* data, uint64_t size, TextureView& view);
+// Picks the parser from the file identifier
+bool parseTexture(const char* data, uint64_t size, TextureView& view);
+// Packs the subresources back to back in subresource order, textureData must hold view.size() bytes
+void copyTextureData(const TextureView& view, char* textureData);
\ No newline at end of file
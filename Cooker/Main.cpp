@@ -0,0 +1,258 @@
+// Cooks glTF 2.0 (.gltf and .glb) and OBJ models into mesh files, and armature files for skinned models
+// Every file is cooked on its own job of a thread pool, the meshes of a model are combined into one
+// Usage: Cooker [--type=static|dynamic|skinned] [--lods=<ratio>,...] [--no-lods] [--overdraw] [--shared-vertices]
+//        [--uncompressed] --output=<directory> <model or scene file or directory>...
+// The type defaults to skinned for models with a skin and static for the rest
+// LODs are generated with the ratios of LODSettings unless --lods gives others or --no-lods is set,
+// then the LODs are optimized the same way as the Optimizer tool does
+// --shared-vertices remaps the vertices of every LOD onto one set when that makes the file smaller, for static
+// meshes only
+// The files are named after the models, a skinned model also writes <name>.arm
+// JSON scenes (.json) are compiled into <name>.rscn, see parseScene, the paths in a scene are relative to the
+// scene file, so scenes are usually cooked into the directory of their source
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ThreadPool.hpp>
+
+#include <MeshCooker.hpp>
+#include <MeshFile.hpp>
+#include <MeshOptimizer.hpp>
+#include <MeshSimplifier.hpp>
+#include <ModelImport.hpp>
+#include <SceneFile.hpp>
+#include <Timer.hpp>
+
+constexpr const char* MESH_EXTENSIONS[]{ ".smesh", ".dmesh", ".skmesh" };
+
+struct CookSettings {
+	std::optional<MESH_TYPE> type;
+	bool lods = true;
+	LODSettings lodSettings;
+	bool overdraw = false;
+	bool sharedVertices = false; // Static meshes only
+	uint32_t flags = MESH_FLAG_COMPRESSED_VERTICES | MESH_FLAG_COMPRESSED_INDICES;
+	std::filesystem::path output;
+};
+
+struct CookResult {
+	bool success = false;
+	std::string log;
+};
+
+bool isModelFile(const std::filesystem::path& path) {
+	std::string extension = path.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+	return extension == ".gltf" || extension == ".glb" || extension == ".obj";
+}
+
+bool isSceneFile(const std::filesystem::path& path) {
+	std::string extension = path.extension().string();
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+	return extension == ".json";
+}
+
+// Parses the ratios of --lods=<ratio>,...
+bool parseLODRatios(const char* ratios, LODSettings& settings) {
+	settings.lodCount = 1;
+	while(*ratios) {
+		if(settings.lodCount == RIN::LOD_COUNT) return false;
+
+		char* end;
+		const float ratio = strtof(ratios, &end);
+		if(end == ratios || ratio <= 0.0f || ratio > 1.0f) return false;
+		settings.ratios[settings.lodCount++] = ratio;
+
+		ratios = end;
+		if(*ratios == ',') ++ratios;
+	}
+
+	return settings.lodCount > 1;
+}
+
+bool writeFile(const std::filesystem::path& path, const std::vector<char>& data) {
+	std::ofstream output(path, std::ios::binary);
+	output.write(data.data(), data.size());
+	return (bool)output;
+}
+
+// Runs on the thread pool, the log is printed once every file is cooked
+void cookModel(const std::filesystem::path& path, const CookSettings& settings, CookResult& result) {
+	std::ostringstream log;
+	log << path.filename().string() << std::endl;
+
+	ImportedModel model;
+	if(!importModel(path, model)) {
+		log << "  Invalid or unsupported model" << std::endl;
+		result.log = log.str();
+		return;
+	}
+
+	const MESH_TYPE type = settings.type.value_or(model.bones.empty() ? MESH_TYPE::STATIC : MESH_TYPE::SKINNED);
+	if(type == MESH_TYPE::SKINNED && model.bones.empty()) {
+		log << "  Model does not have a skin" << std::endl;
+		result.log = log.str();
+		return;
+	}
+
+	// Skinned meshes leave out the meshes which are not bound to the skin
+	std::vector<ImportedMesh> meshes;
+	for(ImportedMesh& mesh : model.meshes)
+		if(type != MESH_TYPE::SKINNED || !mesh.boneWeights.empty()) meshes.push_back(std::move(mesh));
+
+	MeshData mesh;
+	if(!cookMesh(meshes.data(), (uint32_t)meshes.size(), type, mesh)) {
+		log << "  Model does not have any triangles" << std::endl;
+		result.log = log.str();
+		return;
+	}
+
+	const std::vector<float> errors = settings.lods ? generateLODs(mesh, settings.lodSettings) : std::vector<float>(1);
+	if(settings.sharedVertices && type == MESH_TYPE::STATIC) optimizeMeshShared(mesh, settings.overdraw, settings.flags);
+	else optimizeMesh(mesh, settings.overdraw);
+
+	const std::string name = path.stem().string();
+	std::vector<char> file;
+	writeMesh(mesh, settings.flags, file);
+	if(!writeFile(settings.output / (name + MESH_EXTENSIONS[(uint32_t)type]), file)) {
+		log << "  Failed to write " << name << MESH_EXTENSIONS[(uint32_t)type] << std::endl;
+		result.log = log.str();
+		return;
+	}
+
+	log << "  " << MESH_EXTENSIONS[(uint32_t)type] << ", bounding sphere <" << mesh.boundingSphere[0] << ", ";
+	log << mesh.boundingSphere[1] << ", " << mesh.boundingSphere[2] << ">, r: " << mesh.boundingSphere[3];
+	if(mesh.sharedVertices) log << ", " << mesh.vertexCounts[0] << " shared vertices";
+	log << std::endl;
+	for(uint32_t i = 0; i < mesh.lodCount(); ++i) {
+		log << "  LOD " << i << ": " << mesh.vertexCounts[i] << " vertices, " << mesh.indexCounts[i] / 3 << " triangles";
+		if(i) log << ", error " << errors[i];
+		log << std::endl;
+	}
+
+	if(type == MESH_TYPE::SKINNED) {
+		file.clear();
+		writeArmature(model.bones.data(), (uint32_t)model.bones.size(), file);
+		if(!writeFile(settings.output / (name + ".arm"), file)) {
+			log << "  Failed to write " << name << ".arm" << std::endl;
+			result.log = log.str();
+			return;
+		}
+
+		log << "  .arm, " << model.bones.size() << " bones" << std::endl;
+	}
+
+	result.success = true;
+	result.log = log.str();
+}
+
+// Runs on the thread pool, the log is printed once every file is cooked
+void cookScene(const std::filesystem::path& path, const CookSettings& settings, CookResult& result) {
+	std::ostringstream log;
+	log << path.filename().string() << std::endl;
+
+	std::ifstream stream(path, std::ios::binary);
+	const std::vector<char> source((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	SceneData scene;
+	if(!parseScene(source.data(), source.size(), scene)) {
+		log << "  Invalid scene" << std::endl;
+		result.log = log.str();
+		return;
+	}
+
+	const std::string name = path.stem().string();
+	std::vector<char> file;
+	writeScene(scene, file);
+	if(!writeFile(settings.output / (name + ".rscn"), file)) {
+		log << "  Failed to write " << name << ".rscn" << std::endl;
+		result.log = log.str();
+		return;
+	}
+
+	log << "  .rscn, " << scene.textures.size() << " textures, " << scene.materials.size() << " materials, ";
+	log << scene.meshes.size() << " meshes, " << scene.armatures.size() << " armatures, ";
+	log << scene.staticObjects.size() + scene.dynamicObjects.size() + scene.skinnedObjects.size() << " objects, ";
+	log << scene.lights.size() << " lights" << std::endl;
+
+	result.success = true;
+	result.log = log.str();
+}
+
+int main(int argc, char** argv) {
+	CookSettings settings;
+	std::vector<std::filesystem::path> inputs;
+	for(int i = 1; i < argc; ++i) {
+		if(!strcmp(argv[i], "--type=static")) settings.type = MESH_TYPE::STATIC;
+		else if(!strcmp(argv[i], "--type=dynamic")) settings.type = MESH_TYPE::DYNAMIC;
+		else if(!strcmp(argv[i], "--type=skinned")) settings.type = MESH_TYPE::SKINNED;
+		else if(!strncmp(argv[i], "--lods=", 7)) {
+			if(!parseLODRatios(argv[i] + 7, settings.lodSettings)) {
+				std::cerr << "Invalid LOD ratios " << argv[i] + 7 << std::endl;
+				return 1;
+			}
+		} else if(!strcmp(argv[i], "--no-lods")) settings.lods = false;
+		else if(!strcmp(argv[i], "--overdraw")) settings.overdraw = true;
+		else if(!strcmp(argv[i], "--shared-vertices")) settings.sharedVertices = true;
+		else if(!strcmp(argv[i], "--uncompressed")) settings.flags = 0;
+		else if(!strncmp(argv[i], "--output=", 9)) settings.output = argv[i] + 9;
+		else inputs.push_back(argv[i]);
+	}
+
+	if(inputs.empty() || settings.output.empty()) {
+		std::cerr << "Usage: Cooker [--type=static|dynamic|skinned] [--lods=<ratio>,...] [--no-lods] [--overdraw] [--shared-vertices] [--uncompressed] ";
+		std::cerr << "--output=<directory> <model or scene file or directory>..." << std::endl;
+		return 1;
+	}
+
+	if(!std::filesystem::is_directory(settings.output)) {
+		std::cerr << settings.output.string() << " is not a directory" << std::endl;
+		return 1;
+	}
+
+	// Sorted by name so the output is deterministic
+	std::vector<std::filesystem::path> paths;
+	for(const std::filesystem::path& input : inputs) {
+		if(std::filesystem::is_directory(input)) {
+			for(const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(input))
+				if(entry.is_regular_file() && (isModelFile(entry.path()) || isSceneFile(entry.path()))) paths.push_back(entry.path());
+		} else if(isModelFile(input) || isSceneFile(input)) paths.push_back(input);
+		else {
+			std::cerr << input.string() << " is not a model or scene file or directory" << std::endl;
+			return 1;
+		}
+	}
+	std::sort(paths.begin(), paths.end());
+
+	Timer timer;
+	std::vector<CookResult> results(paths.size());
+	{
+		RIN::ThreadPool threadPool;
+		for(size_t i = 0; i < paths.size(); ++i)
+			threadPool.enqueueJob([&paths, &settings, &results, i]() {
+				if(isSceneFile(paths[i])) cookScene(paths[i], settings, results[i]);
+				else cookModel(paths[i], settings, results[i]);
+			});
+		threadPool.wait();
+	}
+
+	uint32_t failed = 0;
+	for(const CookResult& result : results) {
+		std::cout << result.log;
+		if(!result.success) ++failed;
+	}
+
+	std::cout << "Cooked " << paths.size() - failed << " of " << paths.size() << " files in " << timer.elapsedSeconds() << " seconds" << std::endl;
+
+	return failed ? 1 : 0;
+}
\ No newline at end of file
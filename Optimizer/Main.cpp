@@ -0,0 +1,155 @@
+// Reorders the triangles and vertices of mesh files for the vertex cache and vertex fetch,
+// and optionally for overdraw, writing them back in place with the same flags
+// Prints the ACMR and ATVR of every LOD before and after
+// Usage: Optimizer [--overdraw] [--lods[=<ratio>,...]] [--shared-vertices] [--report] <mesh file or directory>...
+// --lods generates the LODs a file is missing, the ratios are the triangle counts of LOD 1 onwards
+// relative to LOD 0, the defaults are those of LODSettings
+// --shared-vertices makes the LODs of static meshes share one set of vertices when that makes the file smaller,
+// files which already share stay shared
+// --report only prints the statistics and leaves the files alone
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <MeshFile.hpp>
+#include <MeshOptimizer.hpp>
+#include <MeshSimplifier.hpp>
+
+bool isMeshFile(const std::filesystem::path& path) {
+	std::string extension = path.extension().string();
+	return extension == ".smesh" || extension == ".dmesh" || extension == ".skmesh";
+}
+
+// Parses the ratios of --lods=<ratio>,...
+bool parseLODRatios(const char* ratios, LODSettings& settings) {
+	settings.lodCount = 1;
+	while(*ratios) {
+		if(settings.lodCount == RIN::LOD_COUNT) return false;
+
+		char* end;
+		const float ratio = strtof(ratios, &end);
+		if(end == ratios || ratio <= 0.0f || ratio > 1.0f) return false;
+		settings.ratios[settings.lodCount++] = ratio;
+
+		ratios = end;
+		if(*ratios == ',') ++ratios;
+	}
+
+	return settings.lodCount > 1;
+}
+
+std::vector<VertexCacheStats> getLODStats(const MeshData& mesh) {
+	std::vector<VertexCacheStats> stats;
+	const uint32_t* indices = mesh.indices.data();
+	for(uint32_t i = 0; i < mesh.lodCount(); ++i) {
+		stats.push_back(getVertexCacheStats(indices, mesh.indexCounts[i], mesh.vertexCounts[i]));
+		indices += mesh.indexCounts[i];
+	}
+
+	return stats;
+}
+
+int main(int argc, char** argv) {
+	bool overdraw = false, lods = false, sharedVertices = false, report = false;
+	LODSettings lodSettings;
+	std::vector<std::filesystem::path> inputs;
+	for(int i = 1; i < argc; ++i) {
+		if(!strcmp(argv[i], "--overdraw")) overdraw = true;
+		else if(!strcmp(argv[i], "--lods")) lods = true;
+		else if(!strncmp(argv[i], "--lods=", 7)) {
+			lods = true;
+			if(!parseLODRatios(argv[i] + 7, lodSettings)) {
+				std::cerr << "Invalid LOD ratios " << argv[i] + 7 << std::endl;
+				return 1;
+			}
+		} else if(!strcmp(argv[i], "--shared-vertices")) sharedVertices = true;
+		else if(!strcmp(argv[i], "--report")) report = true;
+		else inputs.push_back(argv[i]);
+	}
+
+	if(inputs.empty()) {
+		std::cerr << "Usage: Optimizer [--overdraw] [--lods[=<ratio>,...]] [--shared-vertices] [--report] <mesh file or directory>..." << std::endl;
+		return 1;
+	}
+
+	// Sorted by name so the output is deterministic
+	std::vector<std::filesystem::path> paths;
+	for(const std::filesystem::path& input : inputs) {
+		if(std::filesystem::is_directory(input)) {
+			for(const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(input))
+				if(entry.is_regular_file() && isMeshFile(entry.path())) paths.push_back(entry.path());
+		} else if(isMeshFile(input)) paths.push_back(input);
+		else {
+			std::cerr << input.string() << " is not a mesh file or directory" << std::endl;
+			return 1;
+		}
+	}
+	std::sort(paths.begin(), paths.end());
+
+	for(const std::filesystem::path& path : paths) {
+		std::ifstream input(path, std::ios::binary | std::ios::ate);
+		if(!input.is_open()) {
+			std::cerr << "Failed to open " << path.string() << std::endl;
+			return 1;
+		}
+
+		std::vector<char> file(input.tellg());
+		input.seekg(0);
+		input.read(file.data(), file.size());
+		input.close();
+
+		MeshData mesh;
+		if(!readMesh(file.data(), file.size(), mesh)) {
+			std::cerr << "Invalid mesh " << path.string() << std::endl;
+			return 1;
+		}
+
+		// Keep the compression flags of the file
+		MeshHeader header;
+		memcpy(&header, file.data(), sizeof(header));
+
+		const std::vector<VertexCacheStats> before = getLODStats(mesh);
+		const uint32_t lodCount = mesh.lodCount();
+		const std::vector<float> errors = lods ? generateLODs(mesh, lodSettings) : std::vector<float>(lodCount);
+		// The renderer only shares the vertices of static meshes
+		if(sharedVertices && mesh.type == MESH_TYPE::STATIC) optimizeMeshShared(mesh, overdraw, header.flags);
+		else optimizeMesh(mesh, overdraw);
+		const std::vector<VertexCacheStats> after = getLODStats(mesh);
+
+		std::cout << path.filename().string();
+		if(mesh.sharedVertices) std::cout << ", " << mesh.vertexCounts[0] << " shared vertices";
+		std::cout << std::endl;
+		for(uint32_t i = 0; i < lodCount; ++i) {
+			std::cout << "  LOD " << i << ": ";
+			std::cout << "ACMR " << before[i].acmr << " -> " << after[i].acmr << ", ";
+			std::cout << "ATVR " << before[i].atvr << " -> " << after[i].atvr << std::endl;
+		}
+		// Generated LODs have no before, they are already optimized
+		for(uint32_t i = lodCount; i < mesh.lodCount(); ++i) {
+			std::cout << "  LOD " << i << ": generated, " << mesh.indexCounts[i] / 3 << " triangles, ";
+			std::cout << "error " << errors[i] << ", ACMR " << after[i].acmr << ", ATVR " << after[i].atvr << std::endl;
+		}
+
+		if(report) continue;
+
+		file.clear();
+		writeMesh(mesh, header.flags, file);
+
+		std::ofstream output(path, std::ios::binary);
+		output.write(file.data(), file.size());
+		if(!output) {
+			std::cerr << "Failed to write " << path.string() << std::endl;
+			return 1;
+		}
+	}
+
+	std::cout << (report ? "Checked " : "Optimized ") << paths.size() << " meshes" << std::endl;
+
+	return 0;
+}
\ No newline at end of file
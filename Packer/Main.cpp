@@ -0,0 +1,75 @@
+// Packs every file of a directory into an .rpak archive
+// Usage: Packer <input directory> <output file>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Pack.hpp>
+#include <TextureFormat.hpp>
+
+int main(int argc, char** argv) {
+	if(argc != 3) {
+		std::cerr << "Usage: Packer <input directory> <output file>" << std::endl;
+		return 1;
+	}
+
+	const std::filesystem::path root = argv[1];
+	if(!std::filesystem::is_directory(root)) {
+		std::cerr << root.string() << " is not a directory" << std::endl;
+		return 1;
+	}
+
+	// Read every file, sorted by name so the archive is deterministic
+	std::vector<std::filesystem::path> paths;
+	for(const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(root))
+		// Never pack archives, which also skips the output if it is inside the input directory
+		if(entry.is_regular_file() && entry.path().extension() != ".rpak") paths.push_back(entry.path());
+	std::sort(paths.begin(), paths.end());
+
+	std::vector<PackFile> files(paths.size());
+	for(size_t i = 0; i < paths.size(); ++i) {
+		PackFile& file = files[i];
+		file.name = std::filesystem::relative(paths[i], root).generic_string();
+
+		std::ifstream stream(paths[i], std::ios::binary | std::ios::ate);
+		if(!stream.is_open()) {
+			std::cerr << "Failed to open " << paths[i].string() << std::endl;
+			return 1;
+		}
+
+		file.data.resize(stream.tellg());
+		stream.seekg(0);
+		stream.read(file.data.data(), file.data.size());
+
+		file.type = getPackEntryType(paths[i]);
+
+		TextureView view;
+		if(file.type == PACK_ENTRY_TYPE::TEXTURE && !parseTexture(file.data.data(), file.data.size(), view)) {
+			std::cerr << "Unsupported texture " << file.name << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<char> archive;
+	writePack(files.data(), (uint32_t)files.size(), archive);
+
+	std::ofstream stream(argv[2], std::ios::binary);
+	if(!stream.is_open()) {
+		std::cerr << "Failed to open " << argv[2] << std::endl;
+		return 1;
+	}
+
+	stream.write(archive.data(), archive.size());
+	if(!stream) {
+		std::cerr << "Failed to write " << argv[2] << std::endl;
+		return 1;
+	}
+
+	std::cout << "Packed " << files.size() << " files, " << archive.size() << " bytes" << std::endl;
+
+	return 0;
+}
\ No newline at end of file
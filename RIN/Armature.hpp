@@ -8,6 +8,8 @@ namespace RIN {
 		Bone* const bones;
 	protected:
 		bool _resident = false;
+		// Set when any of the bones on the GPU are out of date
+		bool dirty = true;
 
 		Armature(Bone* bones) :
 			bones(bones)
@@ -0,0 +1,1095 @@
+#include "BlockCompression.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <DirectXPackedVector.h>
+
+#include "Debug.hpp"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define BLOCK_COMPRESSION_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace RIN {
+	// Weight of the second endpoint out of 64 for each index
+	constexpr uint32_t BC7_WEIGHTS3[8]{ 0, 9, 18, 27, 37, 46, 55, 64 };
+	constexpr uint32_t BC7_WEIGHTS4[16]{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+	// Bit i is set if pixel i is in the second subset
+	constexpr uint16_t BC7_PARTITIONS2[64]{
+		0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+		0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+		0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+		0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+		0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+		0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+		0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+		0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+	};
+	// The pixel of the second subset whose index drops its top bit, the first subset always uses pixel 0
+	constexpr uint8_t BC7_ANCHORS2[64]{
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15,
+		15, 2, 8, 2, 2, 8, 8, 15,
+		2, 8, 2, 2, 8, 8, 2, 2,
+		15, 15, 6, 8, 2, 8, 15, 15,
+		2, 8, 2, 2, 2, 15, 15, 6,
+		6, 2, 6, 8, 15, 15, 2, 2,
+		15, 15, 15, 15, 15, 2, 2, 15
+	};
+	// Weight of the second endpoint for each BC1 index
+	constexpr float BC1_WEIGHTS[4]{ 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+	// Largest finite half
+	constexpr int32_t BC6H_MAX_HALF = 0x7BFF;
+	// Interpolated BC6H values are scaled by 31 / 32 when they are turned back into halves
+	constexpr float BC6H_UNQUANTIZE_SCALE = 32.0f / 31.0f;
+
+	// Packs a block from the least significant bit up
+	class BlockWriter {
+		uint64_t words[2]{};
+		uint32_t offset = 0;
+	public:
+		void write(uint32_t value, uint32_t bitCount) {
+			for(uint32_t i = 0; i < bitCount; ++i, ++offset)
+				words[offset >> 6] |= (uint64_t)((value >> i) & 1) << (offset & 63);
+		}
+
+		void store(char* block) const {
+			memcpy(block, words, sizeof(words));
+		}
+	};
+
+	/*
+	Fits a line through the masked pixels along their principal axis,
+	the endpoints are the extremes of the pixels projected onto it
+	*/
+	static void fitLine(const float pixels[16][4], uint32_t mask, uint32_t channelCount, float endpoints[2][4]) {
+		float mean[4]{};
+		uint32_t count = 0;
+		for(uint32_t i = 0; i < 16; ++i) {
+			if(!(mask >> i & 1)) continue;
+			for(uint32_t c = 0; c < channelCount; ++c)
+				mean[c] += pixels[i][c];
+			++count;
+		}
+		for(uint32_t c = 0; c < channelCount; ++c)
+			mean[c] /= (float)count;
+
+		float covariance[4][4]{};
+		for(uint32_t i = 0; i < 16; ++i) {
+			if(!(mask >> i & 1)) continue;
+			for(uint32_t a = 0; a < channelCount; ++a)
+				for(uint32_t b = 0; b < channelCount; ++b)
+					covariance[a][b] += (pixels[i][a] - mean[a]) * (pixels[i][b] - mean[b]);
+		}
+
+		// Power iteration, starting from the column of the channel which varies the most
+		uint32_t widest = 0;
+		for(uint32_t c = 1; c < channelCount; ++c)
+			if(covariance[c][c] > covariance[widest][widest]) widest = c;
+
+		float axis[4]{};
+		for(uint32_t c = 0; c < channelCount; ++c)
+			axis[c] = covariance[c][widest];
+
+		for(uint32_t iteration = 0; iteration < 4; ++iteration) {
+			float next[4]{};
+			float largest = 0.0f;
+			for(uint32_t a = 0; a < channelCount; ++a) {
+				for(uint32_t b = 0; b < channelCount; ++b)
+					next[a] += covariance[a][b] * axis[b];
+				largest = std::max(largest, std::fabs(next[a]));
+			}
+			if(largest == 0.0f) break;
+			for(uint32_t c = 0; c < channelCount; ++c)
+				axis[c] = next[c] / largest;
+		}
+
+		float length = 0.0f;
+		for(uint32_t c = 0; c < channelCount; ++c)
+			length += axis[c] * axis[c];
+
+		float minProjection = 0.0f, maxProjection = 0.0f;
+		if(length > 0.0f) {
+			length = 1.0f / std::sqrt(length);
+			for(uint32_t c = 0; c < channelCount; ++c)
+				axis[c] *= length;
+
+			minProjection = FLT_MAX;
+			maxProjection = -FLT_MAX;
+			for(uint32_t i = 0; i < 16; ++i) {
+				if(!(mask >> i & 1)) continue;
+				float projection = 0.0f;
+				for(uint32_t c = 0; c < channelCount; ++c)
+					projection += (pixels[i][c] - mean[c]) * axis[c];
+				minProjection = std::min(minProjection, projection);
+				maxProjection = std::max(maxProjection, projection);
+			}
+		}
+
+		for(uint32_t c = 0; c < 4; ++c) {
+			endpoints[0][c] = c < channelCount ? mean[c] + axis[c] * minProjection : 0.0f;
+			endpoints[1][c] = c < channelCount ? mean[c] + axis[c] * maxProjection : 0.0f;
+		}
+	}
+
+	/*
+	Solves for the endpoints which best fit the masked pixels given the
+	weight of the second endpoint in each pixel, returns false if every
+	pixel has the same weight
+	*/
+	static bool refineLine(const float pixels[16][4], uint32_t mask, uint32_t channelCount, const float weights[16], float endpoints[2][4]) {
+		float a = 0.0f, b = 0.0f, c = 0.0f;
+		float sum0[4]{}, sum1[4]{};
+		for(uint32_t i = 0; i < 16; ++i) {
+			if(!(mask >> i & 1)) continue;
+			const float w = weights[i];
+			const float v = 1.0f - w;
+			a += v * v;
+			b += v * w;
+			c += w * w;
+			for(uint32_t channel = 0; channel < channelCount; ++channel) {
+				sum0[channel] += v * pixels[i][channel];
+				sum1[channel] += w * pixels[i][channel];
+			}
+		}
+
+		const float determinant = a * c - b * b;
+		if(determinant < 1e-3f) return false;
+
+		const float invDeterminant = 1.0f / determinant;
+		for(uint32_t channel = 0; channel < channelCount; ++channel) {
+			endpoints[0][channel] = (c * sum0[channel] - b * sum1[channel]) * invDeterminant;
+			endpoints[1][channel] = (a * sum1[channel] - b * sum0[channel]) * invDeterminant;
+		}
+		return true;
+	}
+
+	static float clampUNORM8(float value) {
+		return std::min(std::max(value, 0.0f), 255.0f);
+	}
+
+	/*
+	Picks the nearest palette entry for each masked pixel and returns the
+	summed squared error
+	The vector path compares 4 pixels against one entry at a time and
+	keeps the first of equally near entries, as the scalar path does
+	*/
+	static uint32_t selectIndices(const uint8_t pixels[16][4], const uint8_t palette[][4], uint32_t paletteSize, uint32_t mask, uint8_t indices[16]) {
+		alignas(16) uint32_t errors[16];
+		alignas(16) uint32_t bestIndices[16];
+
+#ifdef BLOCK_COMPRESSION_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for(uint32_t i = 0; i < 16; i += 4) {
+			__m128i block = _mm_loadu_si128((const __m128i*)pixels[i]);
+			__m128i low = _mm_unpacklo_epi8(block, zero);
+			__m128i high = _mm_unpackhi_epi8(block, zero);
+
+			__m128i bestError = _mm_set1_epi32(INT32_MAX);
+			__m128i bestIndex = zero;
+			for(uint32_t j = 0; j < paletteSize; ++j) {
+				int32_t entry;
+				memcpy(&entry, palette[j], sizeof(entry));
+				__m128i color = _mm_unpacklo_epi8(_mm_set1_epi32(entry), zero);
+
+				// Each pair of lanes holds red and green then blue and alpha squared sums of a pixel
+				__m128i lowDifference = _mm_sub_epi16(low, color);
+				__m128i highDifference = _mm_sub_epi16(high, color);
+				__m128 lowSum = _mm_castsi128_ps(_mm_madd_epi16(lowDifference, lowDifference));
+				__m128 highSum = _mm_castsi128_ps(_mm_madd_epi16(highDifference, highDifference));
+				__m128i error = _mm_add_epi32(
+					_mm_castps_si128(_mm_shuffle_ps(lowSum, highSum, _MM_SHUFFLE(2, 0, 2, 0))),
+					_mm_castps_si128(_mm_shuffle_ps(lowSum, highSum, _MM_SHUFFLE(3, 1, 3, 1)))
+				);
+
+				__m128i better = _mm_cmplt_epi32(error, bestError);
+				bestError = _mm_or_si128(_mm_and_si128(better, error), _mm_andnot_si128(better, bestError));
+				bestIndex = _mm_or_si128(_mm_and_si128(better, _mm_set1_epi32((int32_t)j)), _mm_andnot_si128(better, bestIndex));
+			}
+
+			_mm_store_si128((__m128i*)(errors + i), bestError);
+			_mm_store_si128((__m128i*)(bestIndices + i), bestIndex);
+		}
+#else
+		for(uint32_t i = 0; i < 16; ++i) {
+			errors[i] = INT32_MAX;
+			bestIndices[i] = 0;
+			for(uint32_t j = 0; j < paletteSize; ++j) {
+				uint32_t error = 0;
+				for(uint32_t c = 0; c < 4; ++c) {
+					const int32_t difference = (int32_t)pixels[i][c] - (int32_t)palette[j][c];
+					error += (uint32_t)(difference * difference);
+				}
+				if(error < errors[i]) {
+					errors[i] = error;
+					bestIndices[i] = j;
+				}
+			}
+		}
+#endif
+
+		uint32_t error = 0;
+		for(uint32_t i = 0; i < 16; ++i) {
+			if(!(mask >> i & 1)) continue;
+			indices[i] = (uint8_t)bestIndices[i];
+			error += errors[i];
+		}
+		return error;
+	}
+
+	// BC1
+
+	static uint16_t quantizeRGB565(const float color[4]) {
+		const uint32_t r = (uint32_t)std::nearbyint(clampUNORM8(color[0]) * (31.0f / 255.0f));
+		const uint32_t g = (uint32_t)std::nearbyint(clampUNORM8(color[1]) * (63.0f / 255.0f));
+		const uint32_t b = (uint32_t)std::nearbyint(clampUNORM8(color[2]) * (31.0f / 255.0f));
+		return (uint16_t)(r << 11 | g << 5 | b);
+	}
+
+	static void unquantizeRGB565(uint16_t color, uint8_t unquantized[4]) {
+		const uint32_t r = color >> 11, g = color >> 5 & 0x3F, b = color & 0x1F;
+		unquantized[0] = (uint8_t)(r << 3 | r >> 2);
+		unquantized[1] = (uint8_t)(g << 2 | g >> 4);
+		unquantized[2] = (uint8_t)(b << 3 | b >> 2);
+		unquantized[3] = 255;
+	}
+
+	// Orders the colors for the 4 color mode and returns the error
+	static uint32_t encodeBC1(const uint8_t pixels[16][4], const float endpoints[2][4], uint16_t colors[2], uint8_t indices[16]) {
+		colors[0] = quantizeRGB565(endpoints[0]);
+		colors[1] = quantizeRGB565(endpoints[1]);
+		if(colors[0] < colors[1]) std::swap(colors[0], colors[1]);
+
+		uint8_t palette[4][4];
+		unquantizeRGB565(colors[0], palette[0]);
+		unquantizeRGB565(colors[1], palette[1]);
+		for(uint32_t c = 0; c < 3; ++c) {
+			palette[2][c] = (uint8_t)((2 * palette[0][c] + palette[1][c]) / 3);
+			palette[3][c] = (uint8_t)((palette[0][c] + 2 * palette[1][c]) / 3);
+		}
+		palette[2][3] = palette[3][3] = 255;
+
+		// Equal colors select the 3 color mode, where only the first index is shared
+		return selectIndices(pixels, palette, colors[0] == colors[1] ? 1 : 4, 0xFFFF, indices);
+	}
+
+	void compressBC1Block(const uint8_t pixels[16][4], char* block) {
+		uint8_t opaque[16][4];
+		float values[16][4];
+		for(uint32_t i = 0; i < 16; ++i) {
+			for(uint32_t c = 0; c < 3; ++c) {
+				opaque[i][c] = pixels[i][c];
+				values[i][c] = pixels[i][c];
+			}
+			opaque[i][3] = 255;
+			values[i][3] = 0.0f;
+		}
+
+		float endpoints[2][4];
+		fitLine(values, 0xFFFF, 3, endpoints);
+
+		uint16_t colors[2];
+		uint8_t indices[16];
+		uint32_t error = encodeBC1(opaque, endpoints, colors, indices);
+
+		float weights[16];
+		for(uint32_t i = 0; i < 16; ++i)
+			weights[i] = BC1_WEIGHTS[indices[i]];
+
+		uint16_t refinedColors[2];
+		uint8_t refinedIndices[16];
+		if(error && refineLine(values, 0xFFFF, 3, weights, endpoints) && encodeBC1(opaque, endpoints, refinedColors, refinedIndices) < error) {
+			memcpy(colors, refinedColors, sizeof(colors));
+			memcpy(indices, refinedIndices, sizeof(indices));
+		}
+
+		uint32_t indexBits = 0;
+		for(uint32_t i = 0; i < 16; ++i)
+			indexBits |= (uint32_t)indices[i] << (i * 2);
+
+		memcpy(block, colors, 4);
+		memcpy(block + 4, &indexBits, 4);
+	}
+
+	// BC4 and BC5
+
+	// endpoint0 must not be less than endpoint1, returns the error
+	static uint32_t encodeBC4(const uint8_t values[16], uint32_t endpoint0, uint32_t endpoint1, uint8_t indices[16]) {
+		// Index 0 and 1 are the endpoints, the rest step from the first to the second
+		uint8_t palette[8];
+		palette[0] = (uint8_t)endpoint0;
+		palette[1] = (uint8_t)endpoint1;
+		for(uint32_t i = 1; i < 7; ++i)
+			palette[i + 1] = (uint8_t)(((7 - i) * endpoint0 + i * endpoint1 + 3) / 7);
+
+		alignas(16) uint16_t differences[16];
+		alignas(16) uint16_t bestIndices[16];
+
+#ifdef BLOCK_COMPRESSION_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		__m128i block = _mm_loadu_si128((const __m128i*)values);
+		__m128i low = _mm_unpacklo_epi8(block, zero);
+		__m128i high = _mm_unpackhi_epi8(block, zero);
+
+		__m128i lowBest = _mm_set1_epi16(INT16_MAX), highBest = lowBest;
+		__m128i lowIndex = zero, highIndex = zero;
+		for(uint32_t i = 0; i < 8; ++i) {
+			__m128i value = _mm_set1_epi16(palette[i]);
+			__m128i index = _mm_set1_epi16((int16_t)i);
+
+			__m128i lowDifference = _mm_sub_epi16(_mm_max_epi16(low, value), _mm_min_epi16(low, value));
+			__m128i better = _mm_cmplt_epi16(lowDifference, lowBest);
+			lowBest = _mm_or_si128(_mm_and_si128(better, lowDifference), _mm_andnot_si128(better, lowBest));
+			lowIndex = _mm_or_si128(_mm_and_si128(better, index), _mm_andnot_si128(better, lowIndex));
+
+			__m128i highDifference = _mm_sub_epi16(_mm_max_epi16(high, value), _mm_min_epi16(high, value));
+			better = _mm_cmplt_epi16(highDifference, highBest);
+			highBest = _mm_or_si128(_mm_and_si128(better, highDifference), _mm_andnot_si128(better, highBest));
+			highIndex = _mm_or_si128(_mm_and_si128(better, index), _mm_andnot_si128(better, highIndex));
+		}
+
+		_mm_store_si128((__m128i*)differences, lowBest);
+		_mm_store_si128((__m128i*)(differences + 8), highBest);
+		_mm_store_si128((__m128i*)bestIndices, lowIndex);
+		_mm_store_si128((__m128i*)(bestIndices + 8), highIndex);
+#else
+		for(uint32_t i = 0; i < 16; ++i) {
+			differences[i] = INT16_MAX;
+			bestIndices[i] = 0;
+			for(uint32_t j = 0; j < 8; ++j) {
+				const uint16_t difference = (uint16_t)std::abs((int32_t)values[i] - (int32_t)palette[j]);
+				if(difference < differences[i]) {
+					differences[i] = difference;
+					bestIndices[i] = (uint16_t)j;
+				}
+			}
+		}
+#endif
+
+		uint32_t error = 0;
+		for(uint32_t i = 0; i < 16; ++i) {
+			indices[i] = (uint8_t)bestIndices[i];
+			error += (uint32_t)differences[i] * differences[i];
+		}
+		return error;
+	}
+
+	void compressBC4Block(const uint8_t pixels[16][4], uint32_t channel, char* block) {
+		uint8_t values[16];
+		float refineValues[16][4]{};
+		uint32_t endpoint0 = 0, endpoint1 = 255;
+		for(uint32_t i = 0; i < 16; ++i) {
+			values[i] = pixels[i][channel];
+			refineValues[i][0] = values[i];
+			endpoint0 = std::max(endpoint0, (uint32_t)values[i]);
+			endpoint1 = std::min(endpoint1, (uint32_t)values[i]);
+		}
+
+		uint8_t indices[16];
+		uint32_t error = encodeBC4(values, endpoint0, endpoint1, indices);
+
+		if(error) {
+			float weights[16];
+			for(uint32_t i = 0; i < 16; ++i)
+				weights[i] = indices[i] < 2 ? (float)indices[i] : (float)(indices[i] - 1) / 7.0f;
+
+			float endpoints[2][4];
+			if(refineLine(refineValues, 0xFFFF, 1, weights, endpoints)) {
+				uint32_t refined0 = (uint32_t)std::nearbyint(clampUNORM8(endpoints[0][0]));
+				uint32_t refined1 = (uint32_t)std::nearbyint(clampUNORM8(endpoints[1][0]));
+				if(refined0 < refined1) std::swap(refined0, refined1);
+
+				uint8_t refinedIndices[16];
+				if(refined0 != refined1) {
+					uint32_t refinedError = encodeBC4(values, refined0, refined1, refinedIndices);
+					if(refinedError < error) {
+						endpoint0 = refined0;
+						endpoint1 = refined1;
+						memcpy(indices, refinedIndices, sizeof(indices));
+					}
+				}
+			}
+		}
+
+		uint64_t indexBits = 0;
+		for(uint32_t i = 0; i < 16; ++i)
+			indexBits |= (uint64_t)indices[i] << (i * 3);
+
+		block[0] = (char)endpoint0;
+		block[1] = (char)endpoint1;
+		memcpy(block + 2, &indexBits, 6);
+	}
+
+	void compressBC5Block(const uint8_t pixels[16][4], char* block) {
+		compressBC4Block(pixels, 0, block);
+		compressBC4Block(pixels, 1, block + 8);
+	}
+
+	// BC7
+
+	struct BC7Mode6 {
+		uint8_t endpoints[2][4]; // 7 bits
+		uint32_t pBits[2];
+		uint8_t indices[16];
+	};
+
+	struct BC7Mode1 {
+		uint32_t partition;
+		uint8_t endpoints[2][2][3]; // 6 bits, by subset
+		uint32_t pBits[2]; // By subset
+		uint8_t indices[16];
+	};
+
+	static uint8_t interpolateBC7(uint32_t endpoint0, uint32_t endpoint1, uint32_t weight) {
+		return (uint8_t)(((64 - weight) * endpoint0 + weight * endpoint1 + 32) >> 6);
+	}
+
+	// Mode 6 endpoints are 7 bits per channel with a p-bit of their own as the lowest bit
+	static void quantizeBC7Mode6(const float endpoint[4], uint8_t quantized[4], uint32_t& pBit) {
+		float bestError = FLT_MAX;
+		for(uint32_t p = 0; p < 2; ++p) {
+			uint8_t candidate[4];
+			float error = 0.0f;
+			for(uint32_t c = 0; c < 4; ++c) {
+				const float value = clampUNORM8(endpoint[c]);
+				candidate[c] = (uint8_t)std::min(std::max(std::nearbyint((value - (float)p) * 0.5f), 0.0f), 127.0f);
+				const float difference = (float)(candidate[c] << 1 | p) - value;
+				error += difference * difference;
+			}
+			if(error < bestError) {
+				bestError = error;
+				memcpy(quantized, candidate, 4);
+				pBit = p;
+			}
+		}
+	}
+
+	static uint32_t encodeBC7Mode6(const uint8_t pixels[16][4], const float endpoints[2][4], BC7Mode6& mode) {
+		quantizeBC7Mode6(endpoints[0], mode.endpoints[0], mode.pBits[0]);
+		quantizeBC7Mode6(endpoints[1], mode.endpoints[1], mode.pBits[1]);
+
+		uint8_t palette[16][4];
+		for(uint32_t i = 0; i < 16; ++i)
+			for(uint32_t c = 0; c < 4; ++c)
+				palette[i][c] = interpolateBC7(mode.endpoints[0][c] << 1 | mode.pBits[0], mode.endpoints[1][c] << 1 | mode.pBits[1], BC7_WEIGHTS4[i]);
+
+		return selectIndices(pixels, palette, 16, 0xFFFF, mode.indices);
+	}
+
+	static void writeBC7Mode6(BC7Mode6& mode, char* block) {
+		// The index of pixel 0 drops its top bit
+		if(mode.indices[0] >= 8) {
+			std::swap(mode.endpoints[0], mode.endpoints[1]);
+			std::swap(mode.pBits[0], mode.pBits[1]);
+			for(uint32_t i = 0; i < 16; ++i)
+				mode.indices[i] = (uint8_t)(15 - mode.indices[i]);
+		}
+
+		BlockWriter writer;
+		writer.write(0x40, 7);
+		for(uint32_t c = 0; c < 4; ++c) {
+			writer.write(mode.endpoints[0][c], 7);
+			writer.write(mode.endpoints[1][c], 7);
+		}
+		writer.write(mode.pBits[0], 1);
+		writer.write(mode.pBits[1], 1);
+		for(uint32_t i = 0; i < 16; ++i)
+			writer.write(mode.indices[i], i ? 4 : 3);
+		writer.store(block);
+	}
+
+	// Mode 1 endpoints are 6 bits per channel with a p-bit shared by the subset, expanded from 7 bits to 8
+	static uint8_t unquantizeBC7Mode1(uint32_t quantized, uint32_t pBit) {
+		const uint32_t value = quantized << 1 | pBit;
+		return (uint8_t)(value << 1 | value >> 6);
+	}
+
+	static void quantizeBC7Mode1(const float endpoints[2][4], uint8_t quantized[2][3], uint32_t& pBit) {
+		float bestError = FLT_MAX;
+		for(uint32_t p = 0; p < 2; ++p) {
+			uint8_t candidate[2][3];
+			float error = 0.0f;
+			for(uint32_t e = 0; e < 2; ++e) {
+				for(uint32_t c = 0; c < 3; ++c) {
+					// The expansion is not linear, so check both neighbours of the estimate
+					const float value = clampUNORM8(endpoints[e][c]);
+					const int32_t estimate = (int32_t)std::floor((value * (127.0f / 255.0f) - (float)p) * 0.5f);
+					float bestDifference = FLT_MAX;
+					for(int32_t q = std::max(estimate, 0); q <= std::min(estimate + 1, 63); ++q) {
+						const float difference = std::fabs((float)unquantizeBC7Mode1(q, p) - value);
+						if(difference < bestDifference) {
+							bestDifference = difference;
+							candidate[e][c] = (uint8_t)q;
+						}
+					}
+					error += bestDifference * bestDifference;
+				}
+			}
+			if(error < bestError) {
+				bestError = error;
+				memcpy(quantized, candidate, sizeof(candidate));
+				pBit = p;
+			}
+		}
+	}
+
+	// Encodes the masked pixels as one subset of a mode 1 block, returns the error
+	static uint32_t encodeBC7Mode1Subset(
+		const uint8_t pixels[16][4],
+		uint32_t mask,
+		const float endpoints[2][4],
+		uint8_t quantized[2][3],
+		uint32_t& pBit,
+		uint8_t indices[16]
+	) {
+		quantizeBC7Mode1(endpoints, quantized, pBit);
+
+		uint8_t palette[8][4];
+		for(uint32_t i = 0; i < 8; ++i) {
+			for(uint32_t c = 0; c < 3; ++c)
+				palette[i][c] = interpolateBC7(unquantizeBC7Mode1(quantized[0][c], pBit), unquantizeBC7Mode1(quantized[1][c], pBit), BC7_WEIGHTS3[i]);
+			palette[i][3] = 255;
+		}
+
+		return selectIndices(pixels, palette, 8, mask, indices);
+	}
+
+	// Residual of the best line through a subset, from its sums of r, g, b, rr, gg, bb, rg, rb and gb
+	static float getLineError(const float moments[9], uint32_t count) {
+		if(!count) return 0.0f;
+
+		const float invCount = 1.0f / (float)count;
+		const float scatter[3][3]{
+			{ moments[3] - moments[0] * moments[0] * invCount, moments[6] - moments[0] * moments[1] * invCount, moments[7] - moments[0] * moments[2] * invCount },
+			{ moments[6] - moments[0] * moments[1] * invCount, moments[4] - moments[1] * moments[1] * invCount, moments[8] - moments[1] * moments[2] * invCount },
+			{ moments[7] - moments[0] * moments[2] * invCount, moments[8] - moments[1] * moments[2] * invCount, moments[5] - moments[2] * moments[2] * invCount }
+		};
+
+		/*
+		Estimates the largest eigenvalue from one step of power iteration,
+		starting from the column of the channel which varies the most,
+		uM^2u / uMu lies between the Rayleigh quotient and the eigenvalue
+		*/
+		uint32_t widest = 0;
+		for(uint32_t c = 1; c < 3; ++c)
+			if(scatter[c][c] > scatter[widest][widest]) widest = c;
+
+		const float* axis = scatter[widest];
+		float next[3]{};
+		for(uint32_t a = 0; a < 3; ++a)
+			for(uint32_t b = 0; b < 3; ++b)
+				next[a] += scatter[a][b] * axis[b];
+
+		const float denominator = axis[0] * next[0] + axis[1] * next[1] + axis[2] * next[2];
+		const float eigenvalue = denominator > 0.0f ? (next[0] * next[0] + next[1] * next[1] + next[2] * next[2]) / denominator : 0.0f;
+
+		return scatter[0][0] + scatter[1][1] + scatter[2][2] - eigenvalue;
+	}
+
+	// Picks the mode 1 partition whose subsets lie closest to a line each
+	static uint32_t pickBC7Partition(const float pixels[16][4]) {
+		float moments[16][9];
+		float total[9]{};
+		for(uint32_t i = 0; i < 16; ++i) {
+			const float r = pixels[i][0], g = pixels[i][1], b = pixels[i][2];
+			const float pixelMoments[9]{ r, g, b, r * r, g * g, b * b, r * g, r * b, g * b };
+			for(uint32_t m = 0; m < 9; ++m) {
+				moments[i][m] = pixelMoments[m];
+				total[m] += pixelMoments[m];
+			}
+		}
+
+		uint32_t bestPartition = 0;
+		float bestError = FLT_MAX;
+		for(uint32_t partition = 0; partition < 64; ++partition) {
+			const uint32_t mask = BC7_PARTITIONS2[partition];
+
+			float subsets[2][9]{};
+			for(uint32_t pixels = mask; pixels; pixels &= pixels - 1) {
+				const uint32_t i = (uint32_t)std::countr_zero(pixels);
+				for(uint32_t m = 0; m < 9; ++m)
+					subsets[1][m] += moments[i][m];
+			}
+			for(uint32_t m = 0; m < 9; ++m)
+				subsets[0][m] = total[m] - subsets[1][m];
+
+			const uint32_t count = (uint32_t)std::popcount(mask);
+			const float error = getLineError(subsets[0], 16 - count) + getLineError(subsets[1], count);
+			if(error < bestError) {
+				bestError = error;
+				bestPartition = partition;
+			}
+		}
+
+		return bestPartition;
+	}
+
+	static uint32_t encodeBC7Mode1(const uint8_t pixels[16][4], const float values[16][4], BC7Mode1& mode) {
+		mode.partition = pickBC7Partition(values);
+
+		uint32_t error = 0;
+		for(uint32_t subset = 0; subset < 2; ++subset) {
+			const uint32_t mask = subset ? BC7_PARTITIONS2[mode.partition] : ~BC7_PARTITIONS2[mode.partition] & 0xFFFF;
+
+			float endpoints[2][4];
+			fitLine(values, mask, 3, endpoints);
+			uint32_t subsetError = encodeBC7Mode1Subset(pixels, mask, endpoints, mode.endpoints[subset], mode.pBits[subset], mode.indices);
+
+			float weights[16];
+			for(uint32_t i = 0; i < 16; ++i)
+				weights[i] = (mask >> i & 1) ? (float)BC7_WEIGHTS3[mode.indices[i]] / 64.0f : 0.0f;
+
+			uint8_t refinedEndpoints[2][3];
+			uint32_t refinedPBit;
+			uint8_t refinedIndices[16];
+			if(subsetError && refineLine(values, mask, 3, weights, endpoints)) {
+				uint32_t refinedError = encodeBC7Mode1Subset(pixels, mask, endpoints, refinedEndpoints, refinedPBit, refinedIndices);
+				if(refinedError < subsetError) {
+					subsetError = refinedError;
+					memcpy(mode.endpoints[subset], refinedEndpoints, sizeof(refinedEndpoints));
+					mode.pBits[subset] = refinedPBit;
+					for(uint32_t i = 0; i < 16; ++i)
+						if(mask >> i & 1) mode.indices[i] = refinedIndices[i];
+				}
+			}
+
+			error += subsetError;
+		}
+
+		return error;
+	}
+
+	static void writeBC7Mode1(BC7Mode1& mode, char* block) {
+		// The index of each subset's anchor pixel drops its top bit
+		const uint32_t anchors[2]{ 0, BC7_ANCHORS2[mode.partition] };
+		for(uint32_t subset = 0; subset < 2; ++subset) {
+			if(mode.indices[anchors[subset]] < 4) continue;
+
+			std::swap(mode.endpoints[subset][0], mode.endpoints[subset][1]);
+			for(uint32_t i = 0; i < 16; ++i)
+				if((BC7_PARTITIONS2[mode.partition] >> i & 1) == subset) mode.indices[i] = (uint8_t)(7 - mode.indices[i]);
+		}
+
+		BlockWriter writer;
+		writer.write(0x2, 2);
+		writer.write(mode.partition, 6);
+		for(uint32_t c = 0; c < 3; ++c)
+			for(uint32_t subset = 0; subset < 2; ++subset)
+				for(uint32_t e = 0; e < 2; ++e)
+					writer.write(mode.endpoints[subset][e][c], 6);
+		writer.write(mode.pBits[0], 1);
+		writer.write(mode.pBits[1], 1);
+		for(uint32_t i = 0; i < 16; ++i)
+			writer.write(mode.indices[i], i == anchors[0] || i == anchors[1] ? 2 : 3);
+		writer.store(block);
+	}
+
+	void compressBC7Block(const uint8_t pixels[16][4], char* block) {
+		float values[16][4];
+		bool opaque = true;
+		for(uint32_t i = 0; i < 16; ++i) {
+			for(uint32_t c = 0; c < 4; ++c)
+				values[i][c] = pixels[i][c];
+			opaque = opaque && pixels[i][3] == 255;
+		}
+
+		float endpoints[2][4];
+		fitLine(values, 0xFFFF, 4, endpoints);
+
+		BC7Mode6 mode6;
+		uint32_t error = encodeBC7Mode6(pixels, endpoints, mode6);
+
+		float weights[16];
+		for(uint32_t i = 0; i < 16; ++i)
+			weights[i] = (float)BC7_WEIGHTS4[mode6.indices[i]] / 64.0f;
+
+		BC7Mode6 refined;
+		if(error && refineLine(values, 0xFFFF, 4, weights, endpoints)) {
+			uint32_t refinedError = encodeBC7Mode6(pixels, endpoints, refined);
+			if(refinedError < error) {
+				error = refinedError;
+				mode6 = refined;
+			}
+		}
+
+		// Mode 1 has no alpha, but splits the block in two
+		if(opaque && error) {
+			BC7Mode1 mode1;
+			if(encodeBC7Mode1(pixels, values, mode1) < error) {
+				writeBC7Mode1(mode1, block);
+				return;
+			}
+		}
+
+		writeBC7Mode6(mode6, block);
+	}
+
+	// BC6H
+
+	// The signed integer whose bits BC6H interpolates
+	static int32_t getBC6HValue(uint16_t half) {
+		const int32_t magnitude = std::min((int32_t)(half & 0x7FFF), BC6H_MAX_HALF);
+		return half & 0x8000 ? -magnitude : magnitude;
+	}
+
+	// Signed 10-bit endpoints unquantize to 16 bits
+	static int32_t unquantizeBC6H(int32_t quantized) {
+		int32_t magnitude = std::abs(quantized);
+		if(magnitude >= 511) magnitude = 0x7FFF;
+		else if(magnitude) magnitude = ((magnitude << 15) + 0x4000) >> 9;
+		return quantized < 0 ? -magnitude : magnitude;
+	}
+
+	// Scales an interpolated value back into the range of getBC6HValue
+	static int32_t finishBC6H(int32_t value) {
+		return value < 0 ? -((-value * 31) >> 5) : (value * 31) >> 5;
+	}
+
+	static int32_t quantizeBC6H(float value) {
+		const float magnitude = std::min(std::fabs(value), (float)0x7FFF);
+		// Unquantized endpoints are 0 and then steps of 64 starting at 96
+		const int32_t estimate = std::min(std::max((int32_t)((magnitude - 32.0f) / 64.0f), 0), 510);
+		const int32_t quantized = std::fabs((float)unquantizeBC6H(estimate) - magnitude) <= std::fabs((float)unquantizeBC6H(estimate + 1) - magnitude) ? estimate : estimate + 1;
+		return value < 0.0f ? -quantized : quantized;
+	}
+
+	struct BC6HMode11 {
+		int32_t endpoints[2][3]; // Signed 10 bits
+		uint8_t indices[16];
+	};
+
+	// values holds the pixels by channel, returns the error
+	static float encodeBC6HMode11(const float values[3][16], const float endpoints[2][4], BC6HMode11& mode) {
+		int32_t unquantized[2][3];
+		for(uint32_t e = 0; e < 2; ++e) {
+			for(uint32_t c = 0; c < 3; ++c) {
+				mode.endpoints[e][c] = quantizeBC6H(endpoints[e][c]);
+				unquantized[e][c] = unquantizeBC6H(mode.endpoints[e][c]);
+			}
+		}
+
+		float palette[16][3];
+		for(uint32_t i = 0; i < 16; ++i)
+			for(uint32_t c = 0; c < 3; ++c)
+				palette[i][c] = (float)finishBC6H(((64 - (int32_t)BC7_WEIGHTS4[i]) * unquantized[0][c] + (int32_t)BC7_WEIGHTS4[i] * unquantized[1][c] + 32) >> 6);
+
+		alignas(16) float errors[16];
+		alignas(16) int32_t bestIndices[16];
+
+#ifdef BLOCK_COMPRESSION_SSE2
+		for(uint32_t i = 0; i < 16; i += 4) {
+			__m128 r = _mm_loadu_ps(values[0] + i);
+			__m128 g = _mm_loadu_ps(values[1] + i);
+			__m128 b = _mm_loadu_ps(values[2] + i);
+
+			__m128 bestError = _mm_set1_ps(FLT_MAX);
+			__m128 bestIndex = _mm_setzero_ps();
+			for(uint32_t j = 0; j < 16; ++j) {
+				__m128 dr = _mm_sub_ps(r, _mm_set1_ps(palette[j][0]));
+				__m128 dg = _mm_sub_ps(g, _mm_set1_ps(palette[j][1]));
+				__m128 db = _mm_sub_ps(b, _mm_set1_ps(palette[j][2]));
+				__m128 error = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+
+				__m128 better = _mm_cmplt_ps(error, bestError);
+				bestError = _mm_or_ps(_mm_and_ps(better, error), _mm_andnot_ps(better, bestError));
+				bestIndex = _mm_or_ps(_mm_and_ps(better, _mm_castsi128_ps(_mm_set1_epi32((int32_t)j))), _mm_andnot_ps(better, bestIndex));
+			}
+
+			_mm_store_ps(errors + i, bestError);
+			_mm_store_si128((__m128i*)(bestIndices + i), _mm_castps_si128(bestIndex));
+		}
+#else
+		for(uint32_t i = 0; i < 16; ++i) {
+			errors[i] = FLT_MAX;
+			bestIndices[i] = 0;
+			for(uint32_t j = 0; j < 16; ++j) {
+				const float dr = values[0][i] - palette[j][0];
+				const float dg = values[1][i] - palette[j][1];
+				const float db = values[2][i] - palette[j][2];
+				const float error = dr * dr + dg * dg + db * db;
+				if(error < errors[i]) {
+					errors[i] = error;
+					bestIndices[i] = (int32_t)j;
+				}
+			}
+		}
+#endif
+
+		float error = 0.0f;
+		for(uint32_t i = 0; i < 16; ++i) {
+			mode.indices[i] = (uint8_t)bestIndices[i];
+			error += errors[i];
+		}
+		return error;
+	}
+
+	void compressBC6HBlock(const uint16_t pixels[16][3], char* block) {
+		// The line is fit to the values before the interpolated result is scaled down
+		float values[3][16];
+		float scaled[16][4]{};
+		for(uint32_t i = 0; i < 16; ++i) {
+			for(uint32_t c = 0; c < 3; ++c) {
+				values[c][i] = (float)getBC6HValue(pixels[i][c]);
+				scaled[i][c] = values[c][i] * BC6H_UNQUANTIZE_SCALE;
+			}
+		}
+
+		float endpoints[2][4];
+		fitLine(scaled, 0xFFFF, 3, endpoints);
+
+		BC6HMode11 mode;
+		float error = encodeBC6HMode11(values, endpoints, mode);
+
+		float weights[16];
+		for(uint32_t i = 0; i < 16; ++i)
+			weights[i] = (float)BC7_WEIGHTS4[mode.indices[i]] / 64.0f;
+
+		BC6HMode11 refined;
+		if(error > 0.0f && refineLine(scaled, 0xFFFF, 3, weights, endpoints) && encodeBC6HMode11(values, endpoints, refined) < error)
+			mode = refined;
+
+		// The index of pixel 0 drops its top bit
+		if(mode.indices[0] >= 8) {
+			std::swap(mode.endpoints[0], mode.endpoints[1]);
+			for(uint32_t i = 0; i < 16; ++i)
+				mode.indices[i] = (uint8_t)(15 - mode.indices[i]);
+		}
+
+		BlockWriter writer;
+		writer.write(0x03, 5);
+		for(uint32_t e = 0; e < 2; ++e)
+			for(uint32_t c = 0; c < 3; ++c)
+				writer.write((uint32_t)mode.endpoints[e][c] & 0x3FF, 10);
+		for(uint32_t i = 0; i < 16; ++i)
+			writer.write(mode.indices[i], i ? 4 : 3);
+		writer.store(block);
+	}
+
+	// Textures
+
+	TEXTURE_FORMAT getCompressedFormat(TEXTURE_FORMAT format) {
+		switch(format) {
+		case TEXTURE_FORMAT::R8_UNORM:
+			return TEXTURE_FORMAT::BC4_UNORM;
+		case TEXTURE_FORMAT::R8G8_UNORM:
+			return TEXTURE_FORMAT::BC5_UNORM;
+		case TEXTURE_FORMAT::R8G8B8A8_UNORM:
+		case TEXTURE_FORMAT::B8G8R8A8_UNORM:
+			return TEXTURE_FORMAT::BC7_UNORM;
+		case TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB:
+		case TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB:
+			return TEXTURE_FORMAT::BC7_UNORM_SRGB;
+		case TEXTURE_FORMAT::R16B16G16A16_FLOAT:
+		case TEXTURE_FORMAT::R32G32B32A32_FLOAT:
+			return TEXTURE_FORMAT::BC6H_FLOAT;
+		default:
+			return format;
+		}
+	}
+
+	bool canCompress(TEXTURE_FORMAT format, TEXTURE_FORMAT compressedFormat) {
+		switch(format) {
+		case TEXTURE_FORMAT::R8G8B8A8_UNORM:
+		case TEXTURE_FORMAT::B8G8R8A8_UNORM:
+			return compressedFormat == TEXTURE_FORMAT::BC1_UNORM || compressedFormat == TEXTURE_FORMAT::BC7_UNORM;
+		case TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB:
+		case TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB:
+			return compressedFormat == TEXTURE_FORMAT::BC1_UNORM_SRGB || compressedFormat == TEXTURE_FORMAT::BC7_UNORM_SRGB;
+		default:
+			return compressedFormat != format && compressedFormat == getCompressedFormat(format);
+		}
+	}
+
+	// Gathers a block of 8-bit pixels as RGBA, missing channels are 0 and missing alpha is opaque
+	static void loadBlock(TEXTURE_FORMAT format, const char* data, uint64_t rowPitch, uint32_t width, uint32_t height, uint32_t x, uint32_t y, uint8_t pixels[16][4]) {
+		for(uint32_t i = 0; i < 16; ++i) {
+			const uint32_t pixelX = std::min(x + (i & 3), width - 1);
+			const uint32_t pixelY = std::min(y + (i >> 2), height - 1);
+			const uint8_t* row = (const uint8_t*)data + pixelY * rowPitch;
+
+			switch(format) {
+			case TEXTURE_FORMAT::R8_UNORM:
+				pixels[i][0] = row[pixelX];
+				pixels[i][1] = 0;
+				pixels[i][2] = 0;
+				pixels[i][3] = 255;
+				break;
+			case TEXTURE_FORMAT::R8G8_UNORM:
+				pixels[i][0] = row[pixelX * 2];
+				pixels[i][1] = row[pixelX * 2 + 1];
+				pixels[i][2] = 0;
+				pixels[i][3] = 255;
+				break;
+			case TEXTURE_FORMAT::B8G8R8A8_UNORM:
+			case TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB:
+				pixels[i][0] = row[pixelX * 4 + 2];
+				pixels[i][1] = row[pixelX * 4 + 1];
+				pixels[i][2] = row[pixelX * 4];
+				pixels[i][3] = row[pixelX * 4 + 3];
+				break;
+			default:
+				memcpy(pixels[i], row + pixelX * 4, 4);
+				break;
+			}
+		}
+	}
+
+	// Gathers a block of floating point pixels as RGB halves
+	static void loadBlock(TEXTURE_FORMAT format, const char* data, uint64_t rowPitch, uint32_t width, uint32_t height, uint32_t x, uint32_t y, uint16_t pixels[16][3]) {
+		for(uint32_t i = 0; i < 16; ++i) {
+			const uint32_t pixelX = std::min(x + (i & 3), width - 1);
+			const uint32_t pixelY = std::min(y + (i >> 2), height - 1);
+			const char* row = data + pixelY * rowPitch;
+
+			if(format == TEXTURE_FORMAT::R32G32B32A32_FLOAT) {
+				float pixel[3];
+				memcpy(pixel, row + pixelX * 16, sizeof(pixel));
+				for(uint32_t c = 0; c < 3; ++c)
+					pixels[i][c] = DirectX::PackedVector::XMConvertFloatToHalf(pixel[c]);
+			} else memcpy(pixels[i], row + pixelX * 8, sizeof(pixels[i]));
+		}
+	}
+
+	void compressBlockRows(
+		TEXTURE_FORMAT format,
+		TEXTURE_FORMAT compressedFormat,
+		uint32_t width,
+		uint32_t height,
+		const char* data,
+		uint32_t firstRow,
+		uint32_t rowCount,
+		char* compressedData
+	) {
+		if(!canCompress(format, compressedFormat)) RIN_ERROR("Texture format cannot be compressed to this format");
+
+		const uint64_t rowPitch = Texture::getRowPitch(width, format);
+		const uint64_t compressedRowPitch = Texture::getRowPitch(width, compressedFormat);
+		const uint64_t blockSize = Texture::getRowPitch(1, compressedFormat);
+		const uint32_t blockCount = (width + 3) / 4;
+
+		for(uint32_t row = firstRow; row < firstRow + rowCount; ++row) {
+			char* block = compressedData + row * compressedRowPitch;
+			for(uint32_t x = 0; x < blockCount; ++x, block += blockSize) {
+				if(compressedFormat == TEXTURE_FORMAT::BC6H_FLOAT) {
+					uint16_t pixels[16][3];
+					loadBlock(format, data, rowPitch, width, height, x * 4, row * 4, pixels);
+					compressBC6HBlock(pixels, block);
+					continue;
+				}
+
+				uint8_t pixels[16][4];
+				loadBlock(format, data, rowPitch, width, height, x * 4, row * 4, pixels);
+
+				switch(compressedFormat) {
+				case TEXTURE_FORMAT::BC1_UNORM:
+				case TEXTURE_FORMAT::BC1_UNORM_SRGB:
+					compressBC1Block(pixels, block);
+					break;
+				case TEXTURE_FORMAT::BC4_UNORM:
+					compressBC4Block(pixels, 0, block);
+					break;
+				case TEXTURE_FORMAT::BC5_UNORM:
+					compressBC5Block(pixels, block);
+					break;
+				default:
+					compressBC7Block(pixels, block);
+					break;
+				}
+			}
+		}
+	}
+
+	void compressTexture(
+		ThreadPool& threadPool,
+		TEXTURE_FORMAT format,
+		TEXTURE_FORMAT compressedFormat,
+		uint32_t width,
+		uint32_t height,
+		uint32_t arraySize,
+		uint32_t mipCount,
+		const char* data,
+		char* compressedData
+	) {
+		if(!canCompress(format, compressedFormat)) RIN_ERROR("Texture format cannot be compressed to this format");
+
+		struct Subresource {
+			const char* data;
+			char* compressedData;
+			uint32_t width;
+			uint32_t height;
+			uint32_t firstRow; // Of all block rows in the texture
+		};
+
+		/*
+		Shared with the jobs, which may only start after the texture is done,
+		they then find no rows left and never touch the texture data
+		*/
+		struct Compression {
+			TEXTURE_FORMAT format;
+			TEXTURE_FORMAT compressedFormat;
+			std::vector<Subresource> subresources;
+			uint32_t rowCount = 0;
+			std::atomic<uint32_t> nextRow = 0;
+			std::atomic<uint32_t> doneRowCount = 0;
+		};
+
+		std::shared_ptr<Compression> compression = std::make_shared<Compression>();
+		compression->format = format;
+		compression->compressedFormat = compressedFormat;
+
+		for(uint32_t slice = 0; slice < arraySize; ++slice) {
+			for(uint32_t mip = 0; mip < mipCount; ++mip) {
+				const uint32_t mipWidth = std::max(width >> mip, (uint32_t)1);
+				const uint32_t mipHeight = std::max(height >> mip, (uint32_t)1);
+				compression->subresources.push_back({ data, compressedData, mipWidth, mipHeight, compression->rowCount });
+
+				const uint32_t rowCount = Texture::getRowCount(mipHeight, compressedFormat);
+				compression->rowCount += rowCount;
+				data += Texture::getRowPitch(mipWidth, format) * mipHeight;
+				compressedData += Texture::getRowPitch(mipWidth, compressedFormat) * rowCount;
+			}
+		}
+
+		auto work = [compression]() {
+			for(uint32_t row; (row = compression->nextRow++) < compression->rowCount;) {
+				const Subresource& subresource = *(std::upper_bound(
+					compression->subresources.begin(),
+					compression->subresources.end(),
+					row,
+					[](uint32_t row, const Subresource& subresource) {
+						return row < subresource.firstRow;
+					}
+				) - 1);
+
+				compressBlockRows(
+					compression->format,
+					compression->compressedFormat,
+					subresource.width,
+					subresource.height,
+					subresource.data,
+					row - subresource.firstRow,
+					1,
+					subresource.compressedData
+				);
+
+				if(++compression->doneRowCount == compression->rowCount) compression->doneRowCount.notify_all();
+			}
+		};
+
+		const uint32_t helperCount = std::min(threadPool.numThreads, compression->rowCount - 1);
+		for(uint32_t i = 0; i < helperCount; ++i)
+			threadPool.enqueueJob(work);
+		work();
+
+		for(uint32_t doneRowCount; (doneRowCount = compression->doneRowCount) != compression->rowCount;)
+			compression->doneRowCount.wait(doneRowCount);
+	}
+}
\ No newline at end of file
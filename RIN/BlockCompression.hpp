@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Texture.hpp"
+#include "ThreadPool.hpp"
+
+namespace RIN {
+	/*
+	CPU block compression for textures which are generated at runtime
+
+	Every encoder is single pass with one least squares refinement of the
+	endpoints, which trades some quality for speed
+	BC1 ignores alpha
+	BC4 and BC5 only use the 8 value mode
+	BC6H only uses mode 11, 10-bit endpoints with a single region
+	BC7 uses mode 6 and, for opaque blocks, mode 1 with the partition which
+	best fits two lines
+
+	Blocks which run over the edge of the texture repeat the edge pixels
+
+	Thread Safety:
+	All functions are thread-safe
+	*/
+
+	// Pixels are RGBA, row by row
+	void compressBC1Block(const uint8_t pixels[16][4], char* block);
+	void compressBC4Block(const uint8_t pixels[16][4], uint32_t channel, char* block);
+	// Red and green
+	void compressBC5Block(const uint8_t pixels[16][4], char* block);
+	void compressBC7Block(const uint8_t pixels[16][4], char* block);
+	// Pixels are RGB halves, row by row, infinities and NaNs are clamped to the largest half
+	void compressBC6HBlock(const uint16_t pixels[16][3], char* block);
+
+	// Returns the format addTexture compresses format to, or format if it is not compressed
+	TEXTURE_FORMAT getCompressedFormat(TEXTURE_FORMAT format);
+	/*
+	Returns true if format can be compressed to compressedFormat
+	R8_UNORM to BC4_UNORM
+	R8G8_UNORM to BC5_UNORM
+	R8G8B8A8_UNORM and B8G8R8A8_UNORM to BC1_UNORM or BC7_UNORM
+	R8G8B8A8_UNORM_SRGB and B8G8R8A8_UNORM_SRGB to BC1_UNORM_SRGB or BC7_UNORM_SRGB
+	R16B16G16A16_FLOAT and R32G32B32A32_FLOAT to BC6H_FLOAT
+	*/
+	bool canCompress(TEXTURE_FORMAT format, TEXTURE_FORMAT compressedFormat);
+	// Compresses the block rows [firstRow, firstRow + rowCount) of a single subresource
+	void compressBlockRows(
+		TEXTURE_FORMAT format,
+		TEXTURE_FORMAT compressedFormat,
+		uint32_t width,
+		uint32_t height,
+		const char* data,
+		uint32_t firstRow,
+		uint32_t rowCount,
+		char* compressedData
+	);
+	/*
+	Compresses every subresource of a texture laid out as addTexture takes it,
+	compressedData must hold Texture::getSize of the compressed format
+	The block rows are spread over the thread pool, the calling thread works
+	through them as well and returns once every row is done, so it may be
+	called from a job or while the thread pool is busy
+	*/
+	void compressTexture(
+		ThreadPool& threadPool,
+		TEXTURE_FORMAT format,
+		TEXTURE_FORMAT compressedFormat,
+		uint32_t width,
+		uint32_t height,
+		uint32_t arraySize,
+		uint32_t mipCount,
+		const char* data,
+		char* compressedData
+	);
+}
\ No newline at end of file
@@ -8,6 +8,8 @@ namespace RIN {
 
 		alignas(16) DirectX::XMMATRIX worldMatrix = DirectX::XMMatrixIdentity();
 		alignas(16) DirectX::XMMATRIX invWorldMatrix = DirectX::XMMatrixIdentity();
+		// Dirty flag of the armature which owns this bone
+		bool* armatureDirty = nullptr;
 
 		Bone() = default;
 		Bone(const Bone&) = delete;
@@ -16,6 +18,7 @@ namespace RIN {
 		void XM_CALLCONV setWorldMatrix(DirectX::FXMMATRIX M) {
 			worldMatrix = M;
 			invWorldMatrix = DirectX::XMMatrixInverse(nullptr, M);
+			if(armatureDirty) *armatureDirty = true;
 		}
 
 		DirectX::XMMATRIX getWorldMatrix() const {
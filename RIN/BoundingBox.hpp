@@ -0,0 +1,15 @@
+#pragma once
+
+#include <DirectXMath.h>
+
+namespace RIN {
+	struct BoundingBox {
+		const DirectX::XMFLOAT3 min;
+		const DirectX::XMFLOAT3 max;
+
+		BoundingBox(DirectX::XMFLOAT3 min, DirectX::XMFLOAT3 max) :
+			min(min),
+			max(max)
+		{}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,414 @@
+#include "Bounds.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define BOUNDS_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace RIN {
+	// The axes and the diagonals of a cube, extreme points are found along both ends of each
+	constexpr uint32_t EXTREME_DIRECTION_COUNT = 7;
+	constexpr float EXTREME_DIRECTIONS[EXTREME_DIRECTION_COUNT][3]{
+		{ 1.0f, 0.0f, 0.0f },
+		{ 0.0f, 1.0f, 0.0f },
+		{ 0.0f, 0.0f, 1.0f },
+		{ 1.0f, 1.0f, 1.0f },
+		{ 1.0f, 1.0f, -1.0f },
+		{ 1.0f, -1.0f, 1.0f },
+		{ 1.0f, -1.0f, -1.0f }
+	};
+	// Each refinement pass starts from the best sphere with its radius scaled by this
+	constexpr float REFINE_SHRINK_FACTOR = 0.95f;
+
+	struct Sphere {
+		float x;
+		float y;
+		float z;
+		float radius;
+	};
+
+	static void loadPosition(const char* vertices, uint64_t index, uint32_t stride, float* position) {
+		memcpy(position, vertices + index * stride, sizeof(float) * 3);
+	}
+
+	// Grows the sphere just enough to also enclose p, the old sphere stays inside the new one
+	static void growSphere(Sphere& sphere, const float* p) {
+		const float dx = p[0] - sphere.x, dy = p[1] - sphere.y, dz = p[2] - sphere.z;
+		const float distanceSquared = dx * dx + dy * dy + dz * dz;
+		if(distanceSquared <= sphere.radius * sphere.radius) return;
+
+		const float distance = std::sqrt(distanceSquared);
+		const float radius = (sphere.radius + distance) * 0.5f;
+		const float scale = (radius - sphere.radius) / distance;
+		sphere.x += dx * scale;
+		sphere.y += dy * scale;
+		sphere.z += dz * scale;
+		sphere.radius = radius;
+	}
+
+#ifdef BOUNDS_SSE2
+	/*
+	Loads the positions of 4 vertices so that each register holds one
+	component of every vertex, 16 bytes are read from the start of each
+	vertex so the stride must be at least 16
+	*/
+	static void loadPositions(const char* block, uint32_t stride, __m128& x, __m128& y, __m128& z) {
+		x = _mm_loadu_ps((const float*)block);
+		y = _mm_loadu_ps((const float*)(block + stride));
+		z = _mm_loadu_ps((const float*)(block + stride * 2));
+		__m128 unused = _mm_loadu_ps((const float*)(block + stride * 3));
+		_MM_TRANSPOSE4_PS(x, y, z, unused);
+	}
+
+	static __m128 getDistanceSquared(__m128 x, __m128 y, __m128 z, const Sphere& sphere) {
+		const __m128 dx = _mm_sub_ps(x, _mm_set1_ps(sphere.x));
+		const __m128 dy = _mm_sub_ps(y, _mm_set1_ps(sphere.y));
+		const __m128 dz = _mm_sub_ps(z, _mm_set1_ps(sphere.z));
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+	}
+
+	static __m128i selectIndices(__m128 mask, __m128i a, __m128i b) {
+		const __m128i integerMask = _mm_castps_si128(mask);
+		return _mm_or_si128(_mm_and_si128(integerMask, a), _mm_andnot_si128(integerMask, b));
+	}
+#endif
+
+	// Grows the sphere over the vertices in [begin, end)
+	static void growSphere(Sphere& sphere, const char* vertices, uint64_t begin, uint64_t end, uint32_t stride) {
+		uint64_t i = begin;
+
+	#ifdef BOUNDS_SSE2
+		// Most vertices are already inside, so only blocks with a vertex outside are grown one by one
+		if(stride >= 16) {
+			for(; i + 4 <= end; i += 4) {
+				__m128 x, y, z;
+				loadPositions(vertices + i * stride, stride, x, y, z);
+
+				const __m128 outside = _mm_cmpgt_ps(getDistanceSquared(x, y, z, sphere), _mm_set1_ps(sphere.radius * sphere.radius));
+				if(!_mm_movemask_ps(outside)) continue;
+
+				for(uint64_t k = i; k < i + 4; ++k) {
+					float position[3];
+					loadPosition(vertices, k, stride, position);
+					growSphere(sphere, position);
+				}
+			}
+		}
+	#endif
+
+		for(; i < end; ++i) {
+			float position[3];
+			loadPosition(vertices, i, stride, position);
+			growSphere(sphere, position);
+		}
+	}
+
+	static float getMaxDistanceSquared(const char* vertices, uint64_t vertexCount, uint32_t stride, const Sphere& center) {
+		float maxDistanceSquared = 0.0f;
+		uint64_t i = 0;
+
+	#ifdef BOUNDS_SSE2
+		if(stride >= 16) {
+			__m128 maxima = _mm_setzero_ps();
+			for(; i + 4 <= vertexCount; i += 4) {
+				__m128 x, y, z;
+				loadPositions(vertices + i * stride, stride, x, y, z);
+				maxima = _mm_max_ps(maxima, getDistanceSquared(x, y, z, center));
+			}
+
+			float lanes[4];
+			_mm_storeu_ps(lanes, maxima);
+			maxDistanceSquared = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+		}
+	#endif
+
+		for(; i < vertexCount; ++i) {
+			float p[3];
+			loadPosition(vertices, i, stride, p);
+			const float dx = p[0] - center.x, dy = p[1] - center.y, dz = p[2] - center.z;
+			maxDistanceSquared = std::max(maxDistanceSquared, dx * dx + dy * dy + dz * dz);
+		}
+
+		return maxDistanceSquared;
+	}
+
+	// Indices of the vertices with the smallest and largest projection onto each extreme direction
+	static void findExtremePoints(const char* vertices, uint64_t vertexCount, uint32_t stride, uint64_t minima[], uint64_t maxima[]) {
+		float minProjections[EXTREME_DIRECTION_COUNT], maxProjections[EXTREME_DIRECTION_COUNT];
+		for(uint32_t d = 0; d < EXTREME_DIRECTION_COUNT; ++d) {
+			minProjections[d] = INFINITY;
+			maxProjections[d] = -INFINITY;
+			minima[d] = maxima[d] = 0;
+		}
+
+		uint64_t i = 0;
+
+	#ifdef BOUNDS_SSE2
+		// The lanes hold 32-bit indices
+		if(stride >= 16 && vertexCount <= INT32_MAX) {
+			__m128 minValues[EXTREME_DIRECTION_COUNT], maxValues[EXTREME_DIRECTION_COUNT];
+			__m128i minIndices[EXTREME_DIRECTION_COUNT], maxIndices[EXTREME_DIRECTION_COUNT];
+			for(uint32_t d = 0; d < EXTREME_DIRECTION_COUNT; ++d) {
+				minValues[d] = _mm_set1_ps(INFINITY);
+				maxValues[d] = _mm_set1_ps(-INFINITY);
+				minIndices[d] = maxIndices[d] = _mm_setzero_si128();
+			}
+
+			__m128i indices = _mm_setr_epi32(0, 1, 2, 3);
+			for(; i + 4 <= vertexCount; i += 4) {
+				__m128 x, y, z;
+				loadPositions(vertices + i * stride, stride, x, y, z);
+
+				for(uint32_t d = 0; d < EXTREME_DIRECTION_COUNT; ++d) {
+					const float* direction = EXTREME_DIRECTIONS[d];
+					const __m128 projection = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(x, _mm_set1_ps(direction[0])),
+						_mm_mul_ps(y, _mm_set1_ps(direction[1]))),
+						_mm_mul_ps(z, _mm_set1_ps(direction[2]))
+					);
+
+					const __m128 smaller = _mm_cmplt_ps(projection, minValues[d]);
+					minValues[d] = _mm_min_ps(projection, minValues[d]);
+					minIndices[d] = selectIndices(smaller, indices, minIndices[d]);
+
+					const __m128 larger = _mm_cmpgt_ps(projection, maxValues[d]);
+					maxValues[d] = _mm_max_ps(projection, maxValues[d]);
+					maxIndices[d] = selectIndices(larger, indices, maxIndices[d]);
+				}
+
+				indices = _mm_add_epi32(indices, _mm_set1_epi32(4));
+			}
+
+			for(uint32_t d = 0; d < EXTREME_DIRECTION_COUNT; ++d) {
+				float minLanes[4], maxLanes[4];
+				int32_t minLaneIndices[4], maxLaneIndices[4];
+				_mm_storeu_ps(minLanes, minValues[d]);
+				_mm_storeu_ps(maxLanes, maxValues[d]);
+				_mm_storeu_si128((__m128i*)minLaneIndices, minIndices[d]);
+				_mm_storeu_si128((__m128i*)maxLaneIndices, maxIndices[d]);
+
+				for(uint32_t lane = 0; lane < 4; ++lane) {
+					if(minLanes[lane] < minProjections[d]) {
+						minProjections[d] = minLanes[lane];
+						minima[d] = (uint64_t)minLaneIndices[lane];
+					}
+					if(maxLanes[lane] > maxProjections[d]) {
+						maxProjections[d] = maxLanes[lane];
+						maxima[d] = (uint64_t)maxLaneIndices[lane];
+					}
+				}
+			}
+		}
+	#endif
+
+		for(; i < vertexCount; ++i) {
+			float p[3];
+			loadPosition(vertices, i, stride, p);
+			for(uint32_t d = 0; d < EXTREME_DIRECTION_COUNT; ++d) {
+				const float* direction = EXTREME_DIRECTIONS[d];
+				const float projection = p[0] * direction[0] + p[1] * direction[1] + p[2] * direction[2];
+				if(projection < minProjections[d]) {
+					minProjections[d] = projection;
+					minima[d] = i;
+				}
+				if(projection > maxProjections[d]) {
+					maxProjections[d] = projection;
+					maxima[d] = i;
+				}
+			}
+		}
+	}
+
+	static void getBoxExtents(const char* vertices, uint64_t vertexCount, uint32_t stride, float* min, float* max) {
+		loadPosition(vertices, 0, stride, min);
+		memcpy(max, min, sizeof(float) * 3);
+		uint64_t i = 1;
+
+	#ifdef BOUNDS_SSE2
+		if(stride >= 16) {
+			__m128 minX = _mm_set1_ps(min[0]), minY = _mm_set1_ps(min[1]), minZ = _mm_set1_ps(min[2]);
+			__m128 maxX = minX, maxY = minY, maxZ = minZ;
+			for(; i + 4 <= vertexCount; i += 4) {
+				__m128 x, y, z;
+				loadPositions(vertices + i * stride, stride, x, y, z);
+				minX = _mm_min_ps(minX, x);
+				minY = _mm_min_ps(minY, y);
+				minZ = _mm_min_ps(minZ, z);
+				maxX = _mm_max_ps(maxX, x);
+				maxY = _mm_max_ps(maxY, y);
+				maxZ = _mm_max_ps(maxZ, z);
+			}
+
+			float lanes[6][4];
+			_mm_storeu_ps(lanes[0], minX);
+			_mm_storeu_ps(lanes[1], minY);
+			_mm_storeu_ps(lanes[2], minZ);
+			_mm_storeu_ps(lanes[3], maxX);
+			_mm_storeu_ps(lanes[4], maxY);
+			_mm_storeu_ps(lanes[5], maxZ);
+			for(uint32_t axis = 0; axis < 3; ++axis) {
+				min[axis] = *std::min_element(lanes[axis], lanes[axis] + 4);
+				max[axis] = *std::max_element(lanes[axis + 3], lanes[axis + 3] + 4);
+			}
+		}
+	#endif
+
+		for(; i < vertexCount; ++i) {
+			float p[3];
+			loadPosition(vertices, i, stride, p);
+			for(uint32_t axis = 0; axis < 3; ++axis) {
+				min[axis] = std::min(min[axis], p[axis]);
+				max[axis] = std::max(max[axis], p[axis]);
+			}
+		}
+	}
+
+	static Sphere getBoundingSphere(const char* vertices, uint64_t vertexCount, uint32_t stride) {
+		// Start from the most distant pair of extreme points
+		uint64_t minima[EXTREME_DIRECTION_COUNT], maxima[EXTREME_DIRECTION_COUNT];
+		findExtremePoints(vertices, vertexCount, stride, minima, maxima);
+
+		Sphere sphere{};
+		float maxDistanceSquared = -1.0f;
+		for(uint32_t d = 0; d < EXTREME_DIRECTION_COUNT; ++d) {
+			float a[3], b[3];
+			loadPosition(vertices, minima[d], stride, a);
+			loadPosition(vertices, maxima[d], stride, b);
+
+			const float dx = b[0] - a[0], dy = b[1] - a[1], dz = b[2] - a[2];
+			const float distanceSquared = dx * dx + dy * dy + dz * dz;
+			if(distanceSquared > maxDistanceSquared) {
+				maxDistanceSquared = distanceSquared;
+				sphere = { (a[0] + b[0]) * 0.5f, (a[1] + b[1]) * 0.5f, (a[2] + b[2]) * 0.5f, std::sqrt(distanceSquared) * 0.5f };
+			}
+		}
+
+		growSphere(sphere, vertices, 0, vertexCount, stride);
+
+		// Shrink and grow back, starting from a different vertex each time
+		Sphere best = sphere;
+		for(uint32_t i = 0; i < BOUNDING_SPHERE_REFINE_ITERATIONS; ++i) {
+			sphere = best;
+			sphere.radius *= REFINE_SHRINK_FACTOR;
+
+			const uint64_t start = vertexCount * (i + 1) / (BOUNDING_SPHERE_REFINE_ITERATIONS + 1);
+			growSphere(sphere, vertices, start, vertexCount, stride);
+			growSphere(sphere, vertices, 0, start, stride);
+			if(sphere.radius < best.radius) best = sphere;
+		}
+
+		// The sphere around the center of the bounding box is smaller for some shapes, boxes in particular
+		float min[3], max[3];
+		getBoxExtents(vertices, vertexCount, stride, min, max);
+		const Sphere boxSphere{ (min[0] + max[0]) * 0.5f, (min[1] + max[1]) * 0.5f, (min[2] + max[2]) * 0.5f, 0.0f };
+
+		// Rounding while growing can leave vertices just outside, so the radius is measured again
+		const float radiusSquared = getMaxDistanceSquared(vertices, vertexCount, stride, best);
+		const float boxRadiusSquared = getMaxDistanceSquared(vertices, vertexCount, stride, boxSphere);
+		if(boxRadiusSquared < radiusSquared) best = boxSphere;
+		best.radius = std::sqrt(std::min(radiusSquared, boxRadiusSquared));
+
+		return best;
+	}
+
+	// xyz is the transformed center, w the scaled radius
+	static DirectX::XMVECTOR XM_CALLCONV getPosedSphere(DirectX::FXMVECTOR sphere, const DirectX::XMMATRIX& M) {
+		// The rows of a row vector matrix are the transformed axes
+		const DirectX::XMVECTOR scaleSquared = DirectX::XMVectorMax(
+			DirectX::XMVector3LengthSq(M.r[0]),
+			DirectX::XMVectorMax(DirectX::XMVector3LengthSq(M.r[1]), DirectX::XMVector3LengthSq(M.r[2]))
+		);
+		const DirectX::XMVECTOR radius = DirectX::XMVectorMultiply(DirectX::XMVectorSplatW(sphere), DirectX::XMVectorSqrt(scaleSquared));
+
+		return DirectX::XMVectorSelect(radius, DirectX::XMVector3Transform(sphere, M), DirectX::XMVectorSelectControl(1, 1, 1, 0));
+	}
+
+	BoundingBox computeBoundingBox(const void* vertices, uint64_t vertexCount, uint32_t stride) {
+		float min[3], max[3];
+		getBoxExtents((const char*)vertices, vertexCount, stride, min, max);
+		return BoundingBox({ min[0], min[1], min[2] }, { max[0], max[1], max[2] });
+	}
+
+	BoundingSphere computeBoundingSphere(const void* vertices, uint64_t vertexCount, uint32_t stride) {
+		const Sphere sphere = getBoundingSphere((const char*)vertices, vertexCount, stride);
+		return BoundingSphere(sphere.x, sphere.y, sphere.z, sphere.radius);
+	}
+
+	void computeBoneBoundingSpheres(const SkinnedVertex* vertices, uint64_t vertexCount, uint32_t boneCount, DirectX::XMFLOAT4* spheres) {
+		// Bucket the positions by bone, a vertex goes into the bucket of every bone it has a weight in
+		std::vector<uint64_t> offsets(boneCount + 1);
+		for(uint64_t i = 0; i < vertexCount; ++i) {
+			const uint8_t* indices = &vertices[i].boneIndices.x;
+			const uint8_t* weights = &vertices[i].boneWeights.x;
+			for(uint32_t k = 0; k < 4; ++k)
+				if(weights[k] && indices[k] < boneCount) ++offsets[indices[k] + 1];
+		}
+		for(uint32_t i = 0; i < boneCount; ++i)
+			offsets[i + 1] += offsets[i];
+
+		// Padded to 16 bytes so the buckets take the vector path
+		std::vector<DirectX::XMFLOAT4> positions(offsets[boneCount]);
+		std::vector<uint64_t> next(offsets.begin(), offsets.end() - 1);
+		for(uint64_t i = 0; i < vertexCount; ++i) {
+			const DirectX::XMFLOAT3& position = vertices[i].position;
+			const uint8_t* indices = &vertices[i].boneIndices.x;
+			const uint8_t* weights = &vertices[i].boneWeights.x;
+			for(uint32_t k = 0; k < 4; ++k)
+				if(weights[k] && indices[k] < boneCount) positions[next[indices[k]]++] = { position.x, position.y, position.z, 0.0f };
+		}
+
+		for(uint32_t i = 0; i < boneCount; ++i) {
+			const uint64_t count = offsets[i + 1] - offsets[i];
+			if(!count) {
+				spheres[i] = { 0.0f, 0.0f, 0.0f, -1.0f };
+				continue;
+			}
+
+			const Sphere sphere = getBoundingSphere((const char*)(positions.data() + offsets[i]), count, sizeof(DirectX::XMFLOAT4));
+			spheres[i] = { sphere.x, sphere.y, sphere.z, sphere.radius };
+		}
+	}
+
+	BoundingSphere computePosedBoundingSphere(const DirectX::XMFLOAT4* boneSpheres, uint32_t boneCount, const DirectX::XMMATRIX* boneMatrices, uint64_t boneMatrixStride) {
+		const char* matrices = (const char*)boneMatrices;
+
+		// Box around the posed spheres
+		DirectX::XMVECTOR min = DirectX::XMVectorReplicate(FLT_MAX);
+		DirectX::XMVECTOR max = DirectX::XMVectorReplicate(-FLT_MAX);
+		bool used = false;
+		for(uint32_t i = 0; i < boneCount; ++i) {
+			if(boneSpheres[i].w < 0.0f) continue;
+
+			const DirectX::XMMATRIX& M = *(const DirectX::XMMATRIX*)(matrices + i * boneMatrixStride);
+			const DirectX::XMVECTOR sphere = getPosedSphere(DirectX::XMLoadFloat4(boneSpheres + i), M);
+			const DirectX::XMVECTOR radius = DirectX::XMVectorSplatW(sphere);
+			min = DirectX::XMVectorMin(min, DirectX::XMVectorSubtract(sphere, radius));
+			max = DirectX::XMVectorMax(max, DirectX::XMVectorAdd(sphere, radius));
+			used = true;
+		}
+
+		if(!used) return BoundingSphere(0.0f, 0.0f, 0.0f, 0.0f);
+
+		// Transforming the spheres again is cheaper than staging them
+		const DirectX::XMVECTOR center = DirectX::XMVectorScale(DirectX::XMVectorAdd(min, max), 0.5f);
+		DirectX::XMVECTOR radius = DirectX::XMVectorZero();
+		for(uint32_t i = 0; i < boneCount; ++i) {
+			if(boneSpheres[i].w < 0.0f) continue;
+
+			const DirectX::XMMATRIX& M = *(const DirectX::XMMATRIX*)(matrices + i * boneMatrixStride);
+			const DirectX::XMVECTOR sphere = getPosedSphere(DirectX::XMLoadFloat4(boneSpheres + i), M);
+			const DirectX::XMVECTOR distance = DirectX::XMVector3Length(DirectX::XMVectorSubtract(sphere, center));
+			radius = DirectX::XMVectorMax(radius, DirectX::XMVectorAdd(distance, DirectX::XMVectorSplatW(sphere)));
+		}
+
+		DirectX::XMFLOAT3 c;
+		DirectX::XMStoreFloat3(&c, center);
+		return BoundingSphere(c, DirectX::XMVectorGetX(radius));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+#include <DirectXMath.h>
+
+#include "BoundingBox.hpp"
+#include "BoundingSphere.hpp"
+#include "VertexData.hpp"
+
+namespace RIN {
+	/*
+	Bounding volumes of vertex arrays
+
+	Positions are the first 3 floats of each vertex, so any of the vertex
+	types can be passed in with its size as the stride
+
+	Spheres start from Ritter's sphere around the most distant pair of
+	extreme points along 7 directions, then are refined the way Larsson
+	describes, shrinking the sphere and growing it back over the vertices
+	from a different starting point, keeping the smallest
+	The radius is the distance to the farthest vertex from the final
+	center, so every vertex is inside, and is usually within a few percent
+	of the minimal sphere
+
+	Blocks of 4 vertices are tested at once with SSE2 where it is available
+	Posed spheres are computed with DirectXMath, one bone at a time
+
+	Thread Safety:
+	All functions are thread-safe
+	*/
+
+	constexpr uint32_t BOUNDING_SPHERE_REFINE_ITERATIONS = 8;
+
+	// The vertex count must be greater than 0
+	BoundingBox computeBoundingBox(const void* vertices, uint64_t vertexCount, uint32_t stride);
+	// The vertex count must be greater than 0
+	BoundingSphere computeBoundingSphere(const void* vertices, uint64_t vertexCount, uint32_t stride);
+
+	/*
+	The sphere of each bone encloses the vertices the bone has a weight in,
+	in the space of the mesh, so posing the bone carries the sphere with it
+	spheres must hold boneCount elements, xyz is the center and w the radius,
+	bones which no vertex uses get a radius of -1
+	*/
+	void computeBoneBoundingSpheres(const SkinnedVertex* vertices, uint64_t vertexCount, uint32_t boneCount, DirectX::XMFLOAT4* spheres);
+
+	/*
+	Encloses the spheres of computeBoneBoundingSpheres once they are carried
+	by the bones, each center is transformed by the matrix of its bone and
+	each radius is scaled by the largest scale of the matrix
+	The sphere is centered on the box around the posed spheres
+	boneMatrices are boneMatrixStride bytes apart so that the matrices can
+	be read in place from the bones of an armature
+	Returns a sphere of radius 0 at the origin if no bone is used
+	*/
+	BoundingSphere computePosedBoundingSphere(const DirectX::XMFLOAT4* boneSpheres, uint32_t boneCount, const DirectX::XMMATRIX* boneMatrices, uint64_t boneMatrixStride);
+}
\ No newline at end of file
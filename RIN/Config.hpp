@@ -12,21 +12,27 @@ namespace RIN {
 	struct Config {
 		RENDER_ENGINE engine = RENDER_ENGINE::D3D12;
 		uint64_t uploadStreamSize = 0; // Streaming budget for each frame in bytes
+		uint64_t uploadReserveSize = 0; // Upload memory which can be reserved and written directly in bytes
 		uint32_t staticVertexCount = 0;
+		bool quantizeStaticVertices = false; // Stores static vertices as 16 byte QuantizedStaticVertex instead of 28 byte StaticVertex
 		uint32_t staticIndexCount = 0;
+		uint32_t staticIndex16Count = 0; // For LODs with at most 65536 vertices, which fall back to 32-bit indices once these run out
 		uint32_t staticMeshCount = 0;
 		uint32_t staticObjectCount = 0;
 		uint32_t dynamicVertexCount = 0;
 		uint32_t dynamicIndexCount = 0;
+		uint32_t dynamicIndex16Count = 0;
 		uint32_t dynamicMeshCount = 0;
 		uint32_t dynamicObjectCount = 0;
 		uint32_t skinnedVertexCount = 0;
 		uint32_t skinnedIndexCount = 0;
+		uint32_t skinnedIndex16Count = 0;
 		uint32_t skinnedMeshCount = 0;
 		uint32_t skinnedObjectCount = 0;
 		uint32_t boneCount = 0;
 		uint32_t armatureCount = 0;
 		uint64_t texturesSize = 0; // Cumulative size of all textures in bytes
+		uint64_t textureStreamBudget = 0; // Memory streamed textures may use in bytes, 0 to only be limited by texturesSize
 		uint32_t textureCount = 0;
 		uint32_t materialCount = 0;
 		uint32_t lightCount = 0;
@@ -1,5 +1,6 @@
 #include "SceneObject.hlsli"
 #include "Camera.hlsli"
+#include "LODSelection.hlsli"
 
 struct Size {
 	uint2 size;
@@ -7,6 +8,7 @@ struct Size {
 
 struct SkinnedCommand {
 	uint objectID;
+	IndexBufferView indexBufferView;
 	struct {
 		uint indexCountPerInstance;
 		uint instanceCount;
@@ -18,20 +20,20 @@ struct SkinnedCommand {
 
 ConstantBuffer<Size> depthHierarchySize : register(b0);
 StructuredBuffer<SkinnedObject> skinnedObjectBuffer : register(t0);
-StructuredBuffer<Bone> boneBuffer : register(t1);
 AppendStructuredBuffer<SkinnedCommand> skinnedCommandBuffer : register(u0);
 ConstantBuffer<Camera> cameraBuffer : register(b1);
-Texture2D<float> depthHierarchy : register(t2);
+Texture2D<float> depthHierarchy : register(t1);
 SamplerState depthHierarchySampler : register(s0);
+ConstantBuffer<IndexBuffers> indexBuffers : register(b2);
 
 [RootSignature(
 	"RootFlags(0),"\
 	"RootConstants(num32BitConstants = 2, b0),"\
 	"SRV(t0),"\
-	"SRV(t1),"\
 	"DescriptorTable(UAV(u0)),"\
 	"CBV(b1),"\
-	"DescriptorTable(SRV(t2)),"\
+	"DescriptorTable(SRV(t1)),"\
+	"RootConstants(num32BitConstants = 8, b2),"\
 	"StaticSampler("\
 		"s0,"\
 		"filter = FILTER_MAXIMUM_MIN_MAG_LINEAR_MIP_POINT,"\
@@ -46,20 +48,11 @@ void main(
 ) {
 	SkinnedObject object = skinnedObjectBuffer[index.x];
 	if(getObjectFlagShowField(object.flags)) {
-		float4x4 worldMatrix = boneBuffer[object.boneIndex].worldMatrix;
-
-		float3 a = float3(worldMatrix[0].xyz);
-		float a2 = dot(a, a);
-		float3 b = float3(worldMatrix[1].xyz);
-		float b2 = dot(b, b);
-		float3 c = float3(worldMatrix[2].xyz);
-		float c2 = dot(c, c);
-
-		float radius = object.boundingSphere.radius * sqrt(max(a2, max(b2, c2)));
+		// The bounds of the pose are computed on the CPU in world space
+		float radius = object.boundingSphere.radius;
 
 		// Transform to view space
-		float4 worldCenter = mul(worldMatrix, float4(object.boundingSphere.center, 1.0f));
-		float3 viewCenter = mul(cameraBuffer.viewMatrix, worldCenter).xyz;
+		float3 viewCenter = mul(cameraBuffer.viewMatrix, float4(object.boundingSphere.center, 1.0f)).xyz;
 
 		// Frustum culling
 		bool visible = inFrustum(
@@ -96,10 +89,12 @@ void main(
 				// LOD selection
 				float dist = length(viewCenter) - radius;
 
-				uint lod = dist < 5.0f ? 0 : (dist < 10.0f ? 1 : 2);
+				uint lod = selectLOD(dist);
 
 				SkinnedCommand command;
 				command.objectID = index.x;
+				if(getObjectFlagIndex16Field(object.flags, lod)) command.indexBufferView = indexBuffers.index16;
+				else command.indexBufferView = indexBuffers.index32;
 				command.drawIndexed.indexCountPerInstance = object.lods[lod].indexCount;
 				command.drawIndexed.instanceCount = 1;
 				command.drawIndexed.startIndexLocation = object.lods[lod].startIndex;
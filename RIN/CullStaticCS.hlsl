@@ -1,5 +1,6 @@
 #include "SceneObject.hlsli"
 #include "Camera.hlsli"
+#include "LODSelection.hlsli"
 
 struct Size {
 	uint2 size;
@@ -7,6 +8,7 @@ struct Size {
 
 struct StaticCommand {
 	uint objectID;
+	IndexBufferView indexBufferView;
 	struct {
 		uint indexCountPerInstance;
 		uint instanceCount;
@@ -22,6 +24,7 @@ AppendStructuredBuffer<StaticCommand> staticCommandBuffer : register(u0);
 ConstantBuffer<Camera> cameraBuffer : register(b1);
 Texture2D<float> depthHierarchy : register(t1);
 SamplerState depthHierarchySampler : register(s0);
+ConstantBuffer<IndexBuffers> indexBuffers : register(b2);
 
 [RootSignature(
 	"RootFlags(0),"\
@@ -30,6 +33,7 @@ SamplerState depthHierarchySampler : register(s0);
 	"DescriptorTable(UAV(u0)),"\
 	"CBV(b1),"\
 	"DescriptorTable(SRV(t1)),"\
+	"RootConstants(num32BitConstants = 8, b2),"\
 	"StaticSampler("\
 		"s0,"\
 		"filter = FILTER_MAXIMUM_MIN_MAG_LINEAR_MIP_POINT,"\
@@ -97,10 +101,12 @@ void main(
 				// LOD selection
 				float dist = length(viewCenter) - radius;
 
-				uint lod = dist < 5.0f ? 0 : (dist < 10.0f ? 1 : 2);
+				uint lod = selectLOD(dist);
 
 				StaticCommand command;
 				command.objectID = index.x;
+				if(getObjectFlagIndex16Field(object.flags, lod)) command.indexBufferView = indexBuffers.index16;
+				else command.indexBufferView = indexBuffers.index32;
 				command.drawIndexed.indexCountPerInstance = object.lods[lod].indexCount;
 				command.drawIndexed.instanceCount = 1;
 				command.drawIndexed.startIndexLocation = object.lods[lod].startIndex;
@@ -2,17 +2,19 @@
 
 // Library
 #include <iostream>
+#include <type_traits>
 #ifdef RIN_DEBUG
 #include <sstream>
 #endif
 
-// Shaders
+// Shaders, generated from the HLSL by the FxCompile step of RIN.vcxproj
 #include "shaders/DepthMIPCS.h"
 #include "shaders/CullStaticCS.h"
 #include "shaders/CullDynamicCS.h"
 #include "shaders/CullSkinnedCS.h"
 #include "shaders/LightClusterCS.h"
 #include "shaders/PBRStaticVS.h"
+#include "shaders/PBRStaticQuantizedVS.h"
 #include "shaders/PBRDynamicVS.h"
 #include "shaders/PBRSkinnedVS.h"
 #include "shaders/PBRPS.h"
@@ -28,11 +30,16 @@
 // Project
 #include "Error.hpp"
 #include "D3D12ShaderData.hpp"
+#include "IndexData.hpp"
+#include "BlockCompression.hpp"
+#include "Bounds.hpp"
+#include "LODSelection.hlsli"
 
 constexpr DXGI_FORMAT BACK_BUFFER_FORMAT = DXGI_FORMAT_R8G8B8A8_UNORM;
 constexpr DXGI_FORMAT DEPTH_FORMAT_DSV = DXGI_FORMAT_D32_FLOAT;
 constexpr DXGI_FORMAT DEPTH_FORMAT_SRV = DXGI_FORMAT_R32_FLOAT;
 constexpr DXGI_FORMAT INDEX_FORMAT = DXGI_FORMAT_R32_UINT;
+constexpr DXGI_FORMAT INDEX16_FORMAT = DXGI_FORMAT_R16_UINT;
 
 // (Sync) For copying camera data, static and dynamic object data, and light data
 constexpr uint32_t COPY_QUEUE_CAMERA_STATIC_DYNAMIC_SKINNED_OB_LB_INDEX = 0;
@@ -44,9 +51,9 @@ constexpr uint32_t COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX = 2;
 constexpr uint32_t COPY_QUEUE_TEXTURE_INDEX = 3;
 
 constexpr uint32_t CULL_THREAD_GROUP_SIZE = 128;
-constexpr uint32_t SCENE_STATIC_COMMAND_SIZE = sizeof(uint32_t) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
-constexpr uint32_t SCENE_DYNAMIC_COMMAND_SIZE = sizeof(uint32_t) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
-constexpr uint32_t SCENE_SKINNED_COMMAND_SIZE = sizeof(uint32_t) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
+constexpr uint32_t SCENE_STATIC_COMMAND_SIZE = sizeof(uint32_t) + sizeof(D3D12_INDEX_BUFFER_VIEW) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
+constexpr uint32_t SCENE_DYNAMIC_COMMAND_SIZE = sizeof(uint32_t) + sizeof(D3D12_INDEX_BUFFER_VIEW) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
+constexpr uint32_t SCENE_SKINNED_COMMAND_SIZE = sizeof(uint32_t) + sizeof(D3D12_INDEX_BUFFER_VIEW) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS);
 constexpr uint32_t UAV_COUNTER_SIZE = sizeof(uint32_t);
 
 static_assert(SCENE_STATIC_COMMAND_SIZE >= UAV_COUNTER_SIZE, "SCENE_STATIC_COMMAND_SIZE cannot be less than UAV_COUNTER_SIZE");
@@ -106,29 +113,46 @@ constexpr uint32_t DEBUG_QUERY_PIPELINE_COUNT = 3;
 #endif
 
 namespace RIN {
+	static uint64_t getStaticVertexSize(const Config& config) {
+		return config.quantizeStaticVertices ? sizeof(QuantizedStaticVertex) : sizeof(StaticVertex);
+	}
+
 	D3D12Renderer::D3D12Renderer(HWND hwnd, const Config& config, const Settings& settings) :
 		Renderer(config, settings),
 		hwnd(hwnd),
 		hwndStyle(GetWindowLong(hwnd, GWL_STYLE)),
 		uploadStreamAllocator(config.uploadStreamSize),
-		sceneStaticVertexAllocator(config.staticVertexCount * sizeof(StaticVertex)),
+		uploadStreamChunker(config.uploadStreamSize, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT),
+		uploadReserveAllocator(config.uploadReserveSize),
+		sceneStaticVertexAllocator(config.staticVertexCount * getStaticVertexSize(config)),
 		sceneStaticIndexAllocator(config.staticIndexCount * sizeof(index_type)),
+		sceneStaticIndex16Allocator(config.staticIndex16Count * sizeof(uint16_t)),
 		sceneDynamicVertexAllocator(config.dynamicVertexCount * sizeof(DynamicVertex)),
 		sceneDynamicIndexAllocator(config.dynamicIndexCount * sizeof(index_type)),
+		sceneDynamicIndex16Allocator(config.dynamicIndex16Count * sizeof(uint16_t)),
 		sceneSkinnedVertexAllocator(config.skinnedVertexCount * sizeof(SkinnedVertex)),
 		sceneSkinnedIndexAllocator(config.skinnedIndexCount * sizeof(index_type)),
+		sceneSkinnedIndex16Allocator(config.skinnedIndex16Count * sizeof(uint16_t)),
 		sceneBoneAllocator(config.boneCount),
 		sceneTextureAllocator(ALIGN_TO(config.texturesSize, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT)),
 		sceneStaticMeshPool(config.staticMeshCount),
 		sceneStaticObjectPool(config.staticObjectCount),
 		sceneDynamicMeshPool(config.dynamicMeshCount),
 		sceneDynamicObjectPool(config.dynamicObjectCount),
+		sceneDynamicObjectRemoved(new bool[config.dynamicObjectCount]{}),
 		sceneSkinnedMeshPool(config.skinnedMeshCount),
 		sceneSkinnedObjectPool(config.skinnedObjectCount),
+		sceneSkinnedObjectRemoved(new bool[config.skinnedObjectCount]{}),
 		sceneArmaturePool(config.armatureCount),
 		sceneTexturePool(config.textureCount),
 		sceneMaterialPool(config.materialCount),
 		sceneLightPool(config.lightCount),
+		sceneTextureStreamer(
+			config.textureStreamBudget ? config.textureStreamBudget : config.texturesSize,
+			TEXTURE_STREAM_EVICT_FRAMES,
+			TEXTURE_STREAM_TAIL_SIZE
+		),
+		sceneTextureStreams(new TextureStreamer::Entry[config.textureCount]{}),
 		sceneBones(new Bone[config.boneCount]{})
 	{
 		// Make sure that every call which can fail calls destroy()
@@ -144,6 +168,9 @@ namespace RIN {
 		if(sceneStaticIndexAllocator.getSize() > UINT_MAX) RIN_ERROR("Scene static index buffer size exceeded UINT_MAX");
 		if(sceneDynamicIndexAllocator.getSize() > UINT_MAX) RIN_ERROR("Scene dynamic index buffer size exceeded UINT_MAX");
 		if(sceneSkinnedIndexAllocator.getSize() > UINT_MAX) RIN_ERROR("Scene skinned index buffer size exceeded UINT_MAX");
+		if(sceneStaticIndex16Allocator.getSize() > UINT_MAX) RIN_ERROR("Scene static 16-bit index buffer size exceeded UINT_MAX");
+		if(sceneDynamicIndex16Allocator.getSize() > UINT_MAX) RIN_ERROR("Scene dynamic 16-bit index buffer size exceeded UINT_MAX");
+		if(sceneSkinnedIndex16Allocator.getSize() > UINT_MAX) RIN_ERROR("Scene skinned 16-bit index buffer size exceeded UINT_MAX");
 
 		// DRAW_INDEXED_ARGUMENTS has an int32 index offset, so we can't allow the full uint32 range
 		if(config.staticVertexCount > INT32_MAX) RIN_ERROR("Maximum allowable static vertex count is INT32_MAX");
@@ -152,6 +179,11 @@ namespace RIN {
 		if(config.staticObjectCount % CULL_THREAD_GROUP_SIZE) RIN_ERROR("Static object count must be a multiple of 128");
 		if(config.dynamicObjectCount % CULL_THREAD_GROUP_SIZE) RIN_ERROR("Dynamic object count must be a multiple of 128");
 		if(config.skinnedObjectCount % CULL_THREAD_GROUP_SIZE) RIN_ERROR("Skinned object count must be a multiple of 128");
+		// Narrowed index chunks must not split an index
+		if(config.uploadStreamSize % sizeof(uint16_t)) RIN_ERROR("Upload stream size must be a multiple of 2");
+		// Quantized vertex chunks must not split a vertex
+		if(config.quantizeStaticVertices && config.uploadStreamSize % sizeof(QuantizedStaticVertex))
+			RIN_ERROR("Upload stream size must be a multiple of 16 when quantizing static vertices");
 
 		if(settings.backBufferCount < 2) RIN_ERROR("Back buffer count must be at least 2");
 
@@ -402,7 +434,10 @@ namespace RIN {
 		uploadDynamicObjectOffset = uploadCameraOffset + uploadCameraSize;
 		const uint64_t uploadDynamicObjectSize = config.dynamicObjectCount * sizeof(D3D12DynamicObjectData);
 
-		uploadBoneOffset = uploadDynamicObjectOffset + uploadDynamicObjectSize;
+		uploadSkinnedObjectOffset = uploadDynamicObjectOffset + uploadDynamicObjectSize;
+		const uint64_t uploadSkinnedObjectSize = config.skinnedObjectCount * sizeof(D3D12SkinnedObjectData);
+
+		uploadBoneOffset = uploadSkinnedObjectOffset + uploadSkinnedObjectSize;
 		const uint64_t uploadBoneSize = config.boneCount * sizeof(D3D12BoneData);
 
 		uploadLightOffset = uploadBoneOffset + uploadBoneSize;
@@ -413,6 +448,11 @@ namespace RIN {
 		if(UINT64_MAX - uploadStreamOffset < config.uploadStreamSize)
 			RIN_ERROR("Upload buffer size exceeded UINT64_MAX");
 
+		uploadReserveOffset = uploadStreamOffset + config.uploadStreamSize;
+
+		if(UINT64_MAX - uploadReserveOffset < config.uploadReserveSize)
+			RIN_ERROR("Upload buffer size exceeded UINT64_MAX");
+
 		// Create a committed upload resource
 		D3D12_HEAP_PROPERTIES heapProperties{};
 		heapProperties.Type = D3D12_HEAP_TYPE_UPLOAD;
@@ -424,7 +464,7 @@ namespace RIN {
 		D3D12_RESOURCE_DESC resourceDesc{};
 		resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
 		resourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
-		resourceDesc.Width = uploadStreamOffset + config.uploadStreamSize;
+		resourceDesc.Width = uploadReserveOffset + config.uploadReserveSize;
 		resourceDesc.Height = 1;
 		resourceDesc.DepthOrArraySize = 1;
 		resourceDesc.MipLevels = 1;
@@ -747,12 +787,13 @@ namespace RIN {
 		RIN_DEBUG_NAME(sceneStaticRootSignature, "Scene Static Root Signature");
 		
 		// Create static scene rendering command signature
-		D3D12_INDIRECT_ARGUMENT_DESC sceneStaticIndirectArguments[2]{};
+		D3D12_INDIRECT_ARGUMENT_DESC sceneStaticIndirectArguments[3]{};
 		sceneStaticIndirectArguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
 		sceneStaticIndirectArguments[0].Constant.RootParameterIndex = 0;
 		sceneStaticIndirectArguments[0].Constant.DestOffsetIn32BitValues = 0;
 		sceneStaticIndirectArguments[0].Constant.Num32BitValuesToSet = 1;
-		sceneStaticIndirectArguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+		sceneStaticIndirectArguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+		sceneStaticIndirectArguments[2].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
 
 		D3D12_COMMAND_SIGNATURE_DESC commandSignature{};
 		commandSignature.ByteStride = SCENE_STATIC_COMMAND_SIZE;
@@ -788,10 +829,40 @@ namespace RIN {
 		staticPBRInputElementDescs[2].InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA;
 		staticPBRInputElementDescs[2].InstanceDataStepRate = 0;
 
+		// Quantized vertices pack the normal and tangent into NORMAL and the texture coordinates into TEXCOORD
+		D3D12_INPUT_ELEMENT_DESC staticQuantizedPBRInputElementDescs[3]{};
+		staticQuantizedPBRInputElementDescs[0].SemanticName = "POSITION";
+		staticQuantizedPBRInputElementDescs[0].SemanticIndex = 0;
+		staticQuantizedPBRInputElementDescs[0].Format = DXGI_FORMAT_R16G16B16A16_SNORM;
+		staticQuantizedPBRInputElementDescs[0].InputSlot = 0;
+		staticQuantizedPBRInputElementDescs[0].AlignedByteOffset = 0;
+		staticQuantizedPBRInputElementDescs[0].InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA;
+		staticQuantizedPBRInputElementDescs[0].InstanceDataStepRate = 0;
+		staticQuantizedPBRInputElementDescs[1].SemanticName = "NORMAL";
+		staticQuantizedPBRInputElementDescs[1].SemanticIndex = 0;
+		staticQuantizedPBRInputElementDescs[1].Format = DXGI_FORMAT_R8G8B8A8_SNORM;
+		staticQuantizedPBRInputElementDescs[1].InputSlot = 0;
+		staticQuantizedPBRInputElementDescs[1].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+		staticQuantizedPBRInputElementDescs[1].InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA;
+		staticQuantizedPBRInputElementDescs[1].InstanceDataStepRate = 0;
+		staticQuantizedPBRInputElementDescs[2].SemanticName = "TEXCOORD";
+		staticQuantizedPBRInputElementDescs[2].SemanticIndex = 0;
+		staticQuantizedPBRInputElementDescs[2].Format = DXGI_FORMAT_R16G16_FLOAT;
+		staticQuantizedPBRInputElementDescs[2].InputSlot = 0;
+		staticQuantizedPBRInputElementDescs[2].AlignedByteOffset = D3D12_APPEND_ALIGNED_ELEMENT;
+		staticQuantizedPBRInputElementDescs[2].InputSlotClass = D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA;
+		staticQuantizedPBRInputElementDescs[2].InstanceDataStepRate = 0;
+
 		D3D12_GRAPHICS_PIPELINE_STATE_DESC scenePipelineStateDesc{};
 		scenePipelineStateDesc.pRootSignature = nullptr;
-		scenePipelineStateDesc.VS.pShaderBytecode = RINShaderBytesPBRStaticVS;
-		scenePipelineStateDesc.VS.BytecodeLength = sizeof(RINShaderBytesPBRStaticVS);
+		// PBRStaticQuantizedVS.hlsl has the same root signature as PBRStaticVS.hlsl
+		if(config.quantizeStaticVertices) {
+			scenePipelineStateDesc.VS.pShaderBytecode = RINShaderBytesPBRStaticQuantizedVS;
+			scenePipelineStateDesc.VS.BytecodeLength = sizeof(RINShaderBytesPBRStaticQuantizedVS);
+		} else {
+			scenePipelineStateDesc.VS.pShaderBytecode = RINShaderBytesPBRStaticVS;
+			scenePipelineStateDesc.VS.BytecodeLength = sizeof(RINShaderBytesPBRStaticVS);
+		}
 		scenePipelineStateDesc.PS.pShaderBytecode = RINShaderBytesPBRPS;
 		scenePipelineStateDesc.PS.BytecodeLength = sizeof(RINShaderBytesPBRPS);
 		scenePipelineStateDesc.BlendState.AlphaToCoverageEnable = false;
@@ -832,8 +903,13 @@ namespace RIN {
 		scenePipelineStateDesc.DepthStencilState.BackFace.StencilDepthFailOp = D3D12_STENCIL_OP_KEEP;
 		scenePipelineStateDesc.DepthStencilState.BackFace.StencilPassOp = D3D12_STENCIL_OP_KEEP;
 		scenePipelineStateDesc.DepthStencilState.BackFace.StencilFunc = D3D12_COMPARISON_FUNC_ALWAYS;
-		scenePipelineStateDesc.InputLayout.pInputElementDescs = staticPBRInputElementDescs;
-		scenePipelineStateDesc.InputLayout.NumElements = _countof(staticPBRInputElementDescs);
+		if(config.quantizeStaticVertices) {
+			scenePipelineStateDesc.InputLayout.pInputElementDescs = staticQuantizedPBRInputElementDescs;
+			scenePipelineStateDesc.InputLayout.NumElements = _countof(staticQuantizedPBRInputElementDescs);
+		} else {
+			scenePipelineStateDesc.InputLayout.pInputElementDescs = staticPBRInputElementDescs;
+			scenePipelineStateDesc.InputLayout.NumElements = _countof(staticPBRInputElementDescs);
+		}
 		scenePipelineStateDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
 		scenePipelineStateDesc.NumRenderTargets = 1;
 		scenePipelineStateDesc.RTVFormats[0] = BACK_BUFFER_FORMAT;
@@ -854,12 +930,13 @@ namespace RIN {
 		RIN_DEBUG_NAME(sceneDynamicRootSignature, "Scene Dynamic Root Signature");
 
 		// Create dynamic scene rendering command signature
-		D3D12_INDIRECT_ARGUMENT_DESC sceneDynamicIndirectArguments[2]{};
+		D3D12_INDIRECT_ARGUMENT_DESC sceneDynamicIndirectArguments[3]{};
 		sceneDynamicIndirectArguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
 		sceneDynamicIndirectArguments[0].Constant.RootParameterIndex = 0;
 		sceneDynamicIndirectArguments[0].Constant.DestOffsetIn32BitValues = 0;
 		sceneDynamicIndirectArguments[0].Constant.Num32BitValuesToSet = 1;
-		sceneDynamicIndirectArguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+		sceneDynamicIndirectArguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+		sceneDynamicIndirectArguments[2].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
 
 		commandSignature.ByteStride = SCENE_DYNAMIC_COMMAND_SIZE;
 		commandSignature.NumArgumentDescs = _countof(sceneDynamicIndirectArguments);
@@ -912,12 +989,13 @@ namespace RIN {
 		RIN_DEBUG_NAME(sceneSkinnedRootSignature, "Scene Skinned Root Signature");
 
 		// Create skinned scene rendering command signature
-		D3D12_INDIRECT_ARGUMENT_DESC sceneSkinnedIndirectArguments[2]{};
+		D3D12_INDIRECT_ARGUMENT_DESC sceneSkinnedIndirectArguments[3]{};
 		sceneSkinnedIndirectArguments[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
 		sceneSkinnedIndirectArguments[0].Constant.RootParameterIndex = 0;
 		sceneSkinnedIndirectArguments[0].Constant.DestOffsetIn32BitValues = 0;
 		sceneSkinnedIndirectArguments[0].Constant.Num32BitValuesToSet = 1;
-		sceneSkinnedIndirectArguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+		sceneSkinnedIndirectArguments[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+		sceneSkinnedIndirectArguments[2].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
 
 		commandSignature.ByteStride = SCENE_SKINNED_COMMAND_SIZE;
 		commandSignature.NumArgumentDescs = _countof(sceneSkinnedIndirectArguments);
@@ -1223,13 +1301,13 @@ namespace RIN {
 		const uint64_t skinnedVertexBufferSize = ALIGN_TO(sceneSkinnedVertexAllocator.getSize(), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
 
 		const uint64_t staticIndexBufferOffset = skinnedVertexBufferOffset + skinnedVertexBufferSize;
-		const uint64_t staticIndexBufferSize = ALIGN_TO(sceneStaticIndexAllocator.getSize(), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+		const uint64_t staticIndexBufferSize = ALIGN_TO(sceneStaticIndexAllocator.getSize() + sceneStaticIndex16Allocator.getSize(), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
 
 		const uint64_t dynamicIndexBufferOffset = staticIndexBufferOffset + staticIndexBufferSize;
-		const uint64_t dynamicIndexBufferSize = ALIGN_TO(sceneDynamicIndexAllocator.getSize(), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+		const uint64_t dynamicIndexBufferSize = ALIGN_TO(sceneDynamicIndexAllocator.getSize() + sceneDynamicIndex16Allocator.getSize(), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
 
 		const uint64_t skinnedIndexBufferOffset = dynamicIndexBufferOffset + dynamicIndexBufferSize;
-		const uint64_t skinnedIndexBufferSize = ALIGN_TO(sceneSkinnedIndexAllocator.getSize(), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+		const uint64_t skinnedIndexBufferSize = ALIGN_TO(sceneSkinnedIndexAllocator.getSize() + sceneSkinnedIndex16Allocator.getSize(), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
 
 		const uint64_t staticObjectBufferOffset = skinnedIndexBufferOffset + skinnedIndexBufferSize;
 		const uint64_t staticObjectBufferSize = ALIGN_TO(config.staticObjectCount * sizeof(D3D12StaticObjectData), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
@@ -1588,7 +1666,7 @@ namespace RIN {
 		// Create scene static vbv
 		sceneStaticVBV.BufferLocation = sceneStaticVertexBuffer->GetGPUVirtualAddress();
 		sceneStaticVBV.SizeInBytes = (uint32_t)sceneStaticVertexAllocator.getSize();
-		sceneStaticVBV.StrideInBytes = sizeof(StaticVertex);
+		sceneStaticVBV.StrideInBytes = (uint32_t)getStaticVertexSize(config);
 
 		// Create scene dynamic vbv
 		sceneDynamicVBV.BufferLocation = sceneDynamicVertexBuffer->GetGPUVirtualAddress();
@@ -1605,15 +1683,30 @@ namespace RIN {
 		sceneStaticIBV.SizeInBytes = (uint32_t)sceneStaticIndexAllocator.getSize();
 		sceneStaticIBV.Format = INDEX_FORMAT;
 
+		// Create scene static 16-bit ibv
+		sceneStaticIBV16.BufferLocation = sceneStaticIBV.BufferLocation + sceneStaticIndexAllocator.getSize();
+		sceneStaticIBV16.SizeInBytes = (uint32_t)sceneStaticIndex16Allocator.getSize();
+		sceneStaticIBV16.Format = INDEX16_FORMAT;
+
 		// Create scene dynamic ibv
 		sceneDynamicIBV.BufferLocation = sceneDynamicIndexBuffer->GetGPUVirtualAddress();
 		sceneDynamicIBV.SizeInBytes = (uint32_t)sceneDynamicIndexAllocator.getSize();
 		sceneDynamicIBV.Format = INDEX_FORMAT;
 
+		// Create scene dynamic 16-bit ibv
+		sceneDynamicIBV16.BufferLocation = sceneDynamicIBV.BufferLocation + sceneDynamicIndexAllocator.getSize();
+		sceneDynamicIBV16.SizeInBytes = (uint32_t)sceneDynamicIndex16Allocator.getSize();
+		sceneDynamicIBV16.Format = INDEX16_FORMAT;
+
 		// Create scene skinned ibv
 		sceneSkinnedIBV.BufferLocation = sceneSkinnedIndexBuffer->GetGPUVirtualAddress();
 		sceneSkinnedIBV.SizeInBytes = (uint32_t)sceneSkinnedIndexAllocator.getSize();
 		sceneSkinnedIBV.Format = INDEX_FORMAT;
+
+		// Create scene skinned 16-bit ibv
+		sceneSkinnedIBV16.BufferLocation = sceneSkinnedIBV.BufferLocation + sceneSkinnedIndexAllocator.getSize();
+		sceneSkinnedIBV16.SizeInBytes = (uint32_t)sceneSkinnedIndex16Allocator.getSize();
+		sceneSkinnedIBV16.Format = INDEX16_FORMAT;
 		
 		// Get allocation info
 		D3D12_RESOURCE_DESC resourceDescs[2]{};
@@ -2481,6 +2574,9 @@ namespace RIN {
 		cullStaticCommandList->SetComputeRootDescriptorTable(2, getSceneDescHeapGPUHandle(SCENE_STATIC_COMMAND_BUFFER_UAV_OFFSET));
 		cullStaticCommandList->SetComputeRootConstantBufferView(3, sceneCameraBuffer->GetGPUVirtualAddress());
 		cullStaticCommandList->SetComputeRootDescriptorTable(4, getSceneDescHeapGPUHandle(SCENE_DEPTH_HIERARCHY_SRV_OFFSET));
+		// The commands set the index buffer of the LOD they draw
+		D3D12_INDEX_BUFFER_VIEW indexBufferViews[2]{ sceneStaticIBV, sceneStaticIBV16 };
+		cullStaticCommandList->SetComputeRoot32BitConstants(5, sizeof(indexBufferViews) / sizeof(uint32_t), indexBufferViews, 0);
 
 		// Reset uav counter
 		cullStaticCommandList->CopyBufferRegion(sceneStaticCommandBuffer, 0, sceneZeroBuffer, 0, UAV_COUNTER_SIZE);
@@ -2522,6 +2618,8 @@ namespace RIN {
 		cullDynamicCommandList->SetComputeRootDescriptorTable(2, getSceneDescHeapGPUHandle(SCENE_DYNAMIC_COMMAND_BUFFER_UAV_OFFSET));
 		cullDynamicCommandList->SetComputeRootConstantBufferView(3, sceneCameraBuffer->GetGPUVirtualAddress());
 		cullDynamicCommandList->SetComputeRootDescriptorTable(4, getSceneDescHeapGPUHandle(SCENE_DEPTH_HIERARCHY_SRV_OFFSET));
+		D3D12_INDEX_BUFFER_VIEW indexBufferViews[2]{ sceneDynamicIBV, sceneDynamicIBV16 };
+		cullDynamicCommandList->SetComputeRoot32BitConstants(5, sizeof(indexBufferViews) / sizeof(uint32_t), indexBufferViews, 0);
 
 		// Reset uav counter
 		cullDynamicCommandList->CopyBufferRegion(sceneDynamicCommandBuffer, 0, sceneZeroBuffer, 0, UAV_COUNTER_SIZE);
@@ -2560,10 +2658,11 @@ namespace RIN {
 		uint32_t size[2]{ sceneDepthHierarchyWidth, sceneDepthHierarchyHeight };
 		cullSkinnedCommandList->SetComputeRoot32BitConstants(0, 2, size, 0);
 		cullSkinnedCommandList->SetComputeRootShaderResourceView(1, sceneSkinnedObjectBuffer->GetGPUVirtualAddress());
-		cullSkinnedCommandList->SetComputeRootShaderResourceView(2, sceneBoneBuffer->GetGPUVirtualAddress());
-		cullSkinnedCommandList->SetComputeRootDescriptorTable(3, getSceneDescHeapGPUHandle(SCENE_SKINNED_COMMAND_BUFFER_UAV_OFFSET));
-		cullSkinnedCommandList->SetComputeRootConstantBufferView(4, sceneCameraBuffer->GetGPUVirtualAddress());
-		cullSkinnedCommandList->SetComputeRootDescriptorTable(5, getSceneDescHeapGPUHandle(SCENE_DEPTH_HIERARCHY_SRV_OFFSET));
+		cullSkinnedCommandList->SetComputeRootDescriptorTable(2, getSceneDescHeapGPUHandle(SCENE_SKINNED_COMMAND_BUFFER_UAV_OFFSET));
+		cullSkinnedCommandList->SetComputeRootConstantBufferView(3, sceneCameraBuffer->GetGPUVirtualAddress());
+		cullSkinnedCommandList->SetComputeRootDescriptorTable(4, getSceneDescHeapGPUHandle(SCENE_DEPTH_HIERARCHY_SRV_OFFSET));
+		D3D12_INDEX_BUFFER_VIEW indexBufferViews[2]{ sceneSkinnedIBV, sceneSkinnedIBV16 };
+		cullSkinnedCommandList->SetComputeRoot32BitConstants(5, sizeof(indexBufferViews) / sizeof(uint32_t), indexBufferViews, 0);
 
 		// Reset uav counter
 		cullSkinnedCommandList->CopyBufferRegion(sceneSkinnedCommandBuffer, 0, sceneZeroBuffer, 0, UAV_COUNTER_SIZE);
@@ -2650,7 +2749,6 @@ namespace RIN {
 		// Input-Assembler
 		sceneStaticCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 		sceneStaticCommandList->IASetVertexBuffers(0, 1, &sceneStaticVBV);
-		sceneStaticCommandList->IASetIndexBuffer(&sceneStaticIBV);
 
 		// Raster State
 		sceneStaticCommandList->RSSetViewports(1, &sceneBackBufferViewport);
@@ -2710,7 +2808,6 @@ namespace RIN {
 		// Input-Assembler
 		sceneDynamicCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 		sceneDynamicCommandList->IASetVertexBuffers(0, 1, &sceneDynamicVBV);
-		sceneDynamicCommandList->IASetIndexBuffer(&sceneDynamicIBV);
 
 		// Raster State
 		sceneDynamicCommandList->RSSetViewports(1, &sceneBackBufferViewport);
@@ -2767,7 +2864,6 @@ namespace RIN {
 		// Input-Assembler
 		sceneSkinnedCommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 		sceneSkinnedCommandList->IASetVertexBuffers(0, 1, &sceneSkinnedVBV);
-		sceneSkinnedCommandList->IASetIndexBuffer(&sceneSkinnedIBV);
 
 		// Raster State
 		sceneSkinnedCommandList->RSSetViewports(1, &sceneBackBufferViewport);
@@ -2942,6 +3038,7 @@ namespace RIN {
 		RIN_DEBUG_NAME(commandList, "Upload Stream Command List");
 
 		bool worked = true;
+		std::vector<UploadStreamRequest> runRequests;
 		
 		while(true) {
 			uploadStreamBarrier.arrive_and_wait(); // Barrier 1
@@ -2959,6 +3056,8 @@ namespace RIN {
 
 			while(true) {
 				upload_stream_job_type job;
+				ID3D12Resource* runBuffer = nullptr;
+				UploadCoalescer::Run run;
 
 				// Enter critical section
 				uploadStreamMutex.lock();
@@ -2982,14 +3081,52 @@ namespace RIN {
 				}
 
 				// Update state under the mutex
-				uploadStreamBudget -= uploadStreamQueue.front().size;
-				job = uploadStreamQueue.front().job;
-				uploadStreamQueue.pop();
+				if(uploadStreamQueue.front().buffer) {
+					runBuffer = uploadStreamQueue.front().buffer;
+
+					// Take every following request which continues the run so
+					// that they can be staged contiguously and copied at once
+					while(!uploadStreamQueue.empty()) {
+						UploadStreamRequest& request = uploadStreamQueue.front();
+						if(request.copyQueueIndex != copyQueueIndex || request.size > uploadStreamBudget) break;
+						if(!run.append(request.buffer, request.bufferOffset, request.size)) break;
+
+						uploadStreamBudget -= request.size;
+						runRequests.push_back(std::move(request));
+						uploadStreamQueue.pop();
+					}
+				} else {
+					uploadStreamBudget -= uploadStreamQueue.front().size;
+					job = uploadStreamQueue.front().job;
+					uploadStreamQueue.pop();
+				}
 
 				// Exit critical section
 				uploadStreamMutex.unlock();
 
-				job(commandList);
+				if(runBuffer) {
+					auto uploadAlloc = uploadStreamAllocator.allocate(run.size);
+					if(!uploadAlloc) RIN_ERROR("Upload buffer anomaly: out of upload stream space");
+
+					commandList->CopyBufferRegion(
+						runBuffer,
+						run.offset,
+						uploadBuffer,
+						uploadStreamOffset + uploadAlloc->start,
+						run.size
+					);
+
+					char* uploadData = uploadBufferData + uploadStreamOffset + uploadAlloc->start;
+					for(UploadStreamRequest& request : runRequests) {
+						request.write(uploadData);
+						uploadData += request.size;
+					}
+
+					uploadStreamCoalescer.record(run);
+					runRequests.clear();
+				} else {
+					job(commandList);
+				}
 				worked = true;
 			}
 
@@ -3009,15 +3146,336 @@ namespace RIN {
 		commandList->Release();
 	}
 
+	void D3D12Renderer::enqueueBufferUpload(
+		ID3D12Resource* buffer,
+		uint64_t bufferOffset,
+		const char* data,
+		uint64_t size,
+		uint32_t copyQueueIndex,
+		bool* resident
+	) {
+		// Must be called from inside the upload stream critical section
+		std::vector<UploadChunker::BufferChunk> chunks = uploadStreamChunker.chunkBuffer(size);
+
+		if(acquireUploadReservation(data, size)) {
+			// The data is already in upload memory, so copy straight from it
+			// The chunks still count against the budget to pace the copies
+			const uint64_t uploadOffset = data - uploadBufferData;
+
+			for(size_t i = 0; i < chunks.size(); ++i) {
+				UploadChunker::BufferChunk chunk = chunks[i];
+				bool finalChunk = i == chunks.size() - 1;
+
+				uploadStreamQueue.push(
+					{
+						[this, buffer, bufferOffset, uploadOffset, data, chunk, finalChunk, resident](ID3D12GraphicsCommandList* commandList) {
+							commandList->CopyBufferRegion(
+								buffer,
+								bufferOffset + chunk.offset,
+								uploadBuffer,
+								uploadOffset + chunk.offset,
+								chunk.size
+							);
+
+							if(finalChunk) {
+								completeUploadReservation(data);
+								if(resident) *resident = true;
+							}
+						},
+						chunk.size,
+						copyQueueIndex
+					}
+				);
+			}
+
+			return;
+		}
+
+		for(size_t i = 0; i < chunks.size(); ++i) {
+			UploadChunker::BufferChunk chunk = chunks[i];
+			bool* finalResident = i == chunks.size() - 1 ? resident : nullptr;
+
+			uploadStreamQueue.push(
+				{
+					nullptr,
+					chunk.size,
+					copyQueueIndex,
+					[data, chunk, finalResident](char* uploadData) {
+						memcpy(uploadData, data + chunk.offset, chunk.size);
+
+						// Only flip residency once the final chunk is recorded
+						if(finalResident) *finalResident = true;
+					},
+					buffer,
+					bufferOffset + chunk.offset
+				}
+			);
+		}
+	}
+
+	void D3D12Renderer::enqueueIndexUpload(
+		ID3D12Resource* buffer,
+		uint64_t bufferOffset,
+		const char* indices,
+		uint64_t indexCount,
+		bool index16,
+		uint32_t copyQueueIndex,
+		bool* resident
+	) {
+		// Must be called from inside the upload stream critical section
+		if(!index16) {
+			enqueueBufferUpload(buffer, bufferOffset, indices, indexCount * sizeof(index_type), copyQueueIndex, resident);
+			return;
+		}
+
+		// Chunked by the narrowed size, which is even since the upload stream size is
+		std::vector<UploadChunker::BufferChunk> chunks = uploadStreamChunker.chunkBuffer(indexCount * sizeof(uint16_t));
+
+		for(size_t i = 0; i < chunks.size(); ++i) {
+			UploadChunker::BufferChunk chunk = chunks[i];
+			bool* finalResident = i == chunks.size() - 1 ? resident : nullptr;
+
+			uploadStreamQueue.push(
+				{
+					nullptr,
+					chunk.size,
+					copyQueueIndex,
+					[indices, chunk, finalResident](char* uploadData) {
+						narrowIndices(
+							(const index_type*)indices + chunk.offset / sizeof(uint16_t),
+							chunk.size / sizeof(uint16_t),
+							(uint16_t*)uploadData
+						);
+
+						// Only flip residency once the final chunk is recorded
+						if(finalResident) *finalResident = true;
+					},
+					buffer,
+					bufferOffset + chunk.offset
+				}
+			);
+		}
+	}
+
+	void D3D12Renderer::enqueueQuantizedVertexUpload(
+		ID3D12Resource* buffer,
+		uint64_t bufferOffset,
+		const char* vertices,
+		uint64_t vertexCount,
+		const BoundingSphere& boundingSphere,
+		uint32_t copyQueueIndex,
+		bool* resident
+	) {
+		// Must be called from inside the upload stream critical section
+		// Chunked by the quantized size, which never splits a vertex since the upload stream size is a multiple of it
+		std::vector<UploadChunker::BufferChunk> chunks = uploadStreamChunker.chunkBuffer(vertexCount * sizeof(QuantizedStaticVertex));
+
+		for(size_t i = 0; i < chunks.size(); ++i) {
+			UploadChunker::BufferChunk chunk = chunks[i];
+			bool* finalResident = i == chunks.size() - 1 ? resident : nullptr;
+
+			uploadStreamQueue.push(
+				{
+					nullptr,
+					chunk.size,
+					copyQueueIndex,
+					[vertices, boundingSphere, chunk, finalResident](char* uploadData) {
+						quantizeStaticVertices(
+							(const StaticVertex*)vertices + chunk.offset / sizeof(QuantizedStaticVertex),
+							chunk.size / sizeof(QuantizedStaticVertex),
+							boundingSphere,
+							(QuantizedStaticVertex*)uploadData
+						);
+
+						// Only flip residency once the final chunk is recorded
+						if(finalResident) *finalResident = true;
+					},
+					buffer,
+					bufferOffset + chunk.offset
+				}
+			);
+		}
+	}
+
+	void D3D12Renderer::enqueueTextureUpload(
+		ID3D12Resource* resource,
+		DXGI_FORMAT dxgiFormat,
+		const char* textureData,
+		std::vector<UploadChunker::TextureChunk>& chunks,
+		bool* resident,
+		std::shared_ptr<const char[]> ownedData
+	) {
+		// Must be called from inside the upload stream critical section
+		// Split the texture by subresource and row range so that each chunk fits in a single frame
+		for(size_t i = 0; i < chunks.size(); ++i) {
+			uint64_t chunkSize = chunks[i].size;
+			bool* finalResident = i == chunks.size() - 1 ? resident : nullptr;
+
+			uploadStreamQueue.push(
+				{
+					[this, chunk = std::move(chunks[i]), textureData, ownedData, finalResident, resource, dxgiFormat](ID3D12GraphicsCommandList* commandList) {
+						// Chunk size includes extra space to ensure we can align the texture data
+						auto uploadAlloc = uploadStreamAllocator.allocate(chunk.size);
+						if(!uploadAlloc) RIN_ERROR("Upload texture anomaly: out of upload stream space");
+
+						uint64_t alignedStart = ALIGN_TO(uploadStreamOffset + uploadAlloc->start, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+						D3D12_TEXTURE_COPY_LOCATION copyDest{};
+						copyDest.pResource = resource;
+						copyDest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+
+						D3D12_TEXTURE_COPY_LOCATION copySrc{};
+						copySrc.pResource = uploadBuffer;
+						copySrc.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+						copySrc.PlacedFootprint.Footprint.Format = dxgiFormat;
+						copySrc.PlacedFootprint.Footprint.Depth = 1;
+
+						for(const UploadChunker::TextureRegion& region : chunk.regions) {
+							// Upload
+							copyDest.SubresourceIndex = region.subresource;
+							copySrc.PlacedFootprint.Offset = alignedStart + region.uploadOffset;
+							copySrc.PlacedFootprint.Footprint.Width = region.width;
+							copySrc.PlacedFootprint.Footprint.Height = region.height;
+							copySrc.PlacedFootprint.Footprint.RowPitch = (uint32_t)region.alignedPitch;
+
+							commandList->CopyTextureRegion(&copyDest, 0, region.y, 0, &copySrc, nullptr);
+
+							// Copy
+							char* alignedData = uploadBufferData + alignedStart + region.uploadOffset;
+							const char* regionData = textureData + region.dataOffset;
+							// Rows which are already pitch aligned, such as those of packed textures, are copied at once
+							if(region.pitch == region.alignedPitch) memcpy(alignedData, regionData, region.pitch * region.rowCount);
+							else {
+								for(uint32_t row = 0; row < region.rowCount; ++row) {
+									memcpy(alignedData, regionData, region.pitch);
+									alignedData += region.alignedPitch;
+									regionData += region.pitch;
+								}
+							}
+						}
+
+						// Only flip residency once the final chunk is recorded
+						if(finalResident) *finalResident = true;
+					},
+					chunkSize,
+					COPY_QUEUE_TEXTURE_INDEX
+				}
+			);
+		}
+	}
+
+	bool D3D12Renderer::acquireUploadReservation(const char* data, uint64_t size) {
+		if(!isUploadReserved(data)) return false;
+
+		const uint64_t offset = data - (uploadBufferData + uploadReserveOffset);
+
+		// Critical section
+		std::lock_guard<std::mutex> lock(uploadReserveMutex);
+
+		// Find the reservation starting at or before the data
+		auto it = uploadReservations.upper_bound(offset);
+		if(it == uploadReservations.begin()) return false;
+		--it;
+
+		UploadReservation& reservation = it->second;
+		if(reservation.committed || offset + size > it->first + reservation.size) {
+			RIN_DEBUG_ERROR("Upload data is not inside of an uncommitted reservation");
+			return false;
+		}
+
+		++reservation.pendingCopies;
+
+		return true;
+	}
+
+	bool D3D12Renderer::isUploadReserved(const char* data) const {
+		const char* reserveData = uploadBufferData + uploadReserveOffset;
+		return data >= reserveData && data < reserveData + config.uploadReserveSize;
+	}
+
+	void D3D12Renderer::completeUploadReservation(const char* data) {
+		const uint64_t offset = data - (uploadBufferData + uploadReserveOffset);
+
+		// Critical section
+		std::lock_guard<std::mutex> lock(uploadReserveMutex);
+
+		auto it = --uploadReservations.upper_bound(offset);
+		--it->second.pendingCopies;
+		uploadReserveRetired.push_back(it->first);
+	}
+
+	void D3D12Renderer::releaseUploadReservations() {
+		// Critical section
+		std::lock_guard<std::mutex> lock(uploadReserveMutex);
+
+		// The copies recorded last frame have completed by now
+		for(uint64_t start : uploadReserveRetired) {
+			auto it = uploadReservations.find(start);
+			if(it == uploadReservations.end()) continue;
+
+			const UploadReservation& reservation = it->second;
+			if(reservation.committed && !reservation.pendingCopies) {
+				uploadReserveAllocator.free(FreeListAllocator::Allocation(start, reservation.size));
+				uploadReservations.erase(it);
+			}
+		}
+
+		uploadReserveRetired.clear();
+	}
+
+	void D3D12Renderer::enqueueResidencyCallback(residency_callback_type onResident) {
+		// Requests of a batch are taken in order, so this is recorded after
+		// every copy pushed into the batch before it, and called once the copy
+		// queues are waited on
+		// Batches are served by priority, so earlier batches of a lower
+		// priority may not be recorded yet, requests which depend on other
+		// uploads must be in the same batch as them
+		uploadStreamQueue.push(
+			{
+				[this, onResident = std::move(onResident)](ID3D12GraphicsCommandList*) {
+					// Critical section
+					std::lock_guard<std::mutex> lock(uploadResidencyMutex);
+
+					uploadResidencyCallbacks.push_back(onResident);
+				},
+				0,
+				COPY_QUEUE_CAMERA_STATIC_DYNAMIC_SKINNED_OB_LB_INDEX
+			}
+		);
+	}
+
+	void D3D12Renderer::invokeResidencyCallbacks() {
+		std::vector<residency_callback_type> callbacks;
+
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadResidencyMutex);
+
+			callbacks.swap(uploadResidencyCallbacks);
+		}
+
+		// Called outside of the critical section so that they can add more uploads
+		for(residency_callback_type& callback : callbacks)
+			callback();
+	}
+
 	void D3D12Renderer::destroyDeadTextures() {
 		for(uint32_t i = 0; i < config.textureCount; ++i) {
 			D3D12Texture* texture = sceneTexturePool.at(i);
 			if(texture) {
-				if(texture->dead && texture->resident()) {
+				// Wait for any streaming change to be swapped in
+				if(texture->dead && texture->resident() && !texture->streamResource) {
 					texture->resource->Release();
 
 					sceneTextureAllocator.free(texture->textureAlloc);
 
+					if(texture->streamData) {
+						// Critical section
+						std::lock_guard<std::mutex> lock(sceneTextureStreamMutex);
+
+						sceneTextureStreams[i] = {};
+					}
+
 					sceneTexturePool.remove(texture);
 				}
 			}
@@ -3072,201 +3530,748 @@ namespace RIN {
 			return DXGI_FORMAT_BC5_UNORM;
 		case TEXTURE_FORMAT::BC6H_FLOAT:
 			return DXGI_FORMAT_BC6H_SF16;
+		case TEXTURE_FORMAT::BC6H_UFLOAT:
+			return DXGI_FORMAT_BC6H_UF16;
 		case TEXTURE_FORMAT::BC7_UNORM:
 			return DXGI_FORMAT_BC7_UNORM;
 		case TEXTURE_FORMAT::BC7_UNORM_SRGB:
 			return DXGI_FORMAT_BC7_UNORM_SRGB;
+		case TEXTURE_FORMAT::BC1_UNORM:
+			return DXGI_FORMAT_BC1_UNORM;
+		case TEXTURE_FORMAT::BC1_UNORM_SRGB:
+			return DXGI_FORMAT_BC1_UNORM_SRGB;
 		}
 		return DXGI_FORMAT_UNKNOWN;
 	}
 
-	void D3D12Renderer::wait() {
-		HRESULT result;
-
-		// Signal copy queues
-		for(uint32_t i = 0; i < COPY_QUEUE_COUNT; ++i) {
-			result = copyQueues[i]->Signal(copyFences[i], ++copyFenceValues[i]);
-			if(FAILED(result)) RIN_ERROR("Failed to signal copy queue");
-		}
+	void D3D12Renderer::streamTextures() {
+		const uint64_t frame = ++sceneTextureStreamFrame;
 
-		// No need to signal graphics queue as it was already signaled at the end of the frame
-		result = graphicsFence->SetEventOnCompletion(graphicsFenceValue, nullptr);
-		if(FAILED(result)) RIN_ERROR("Failed to wait for graphics queue");
+		// Critical section
+		std::lock_guard<std::mutex> lock(sceneTextureStreamMutex);
+
+		TextureStreamer::Entry* entries = sceneTextureStreams.get();
+		for(uint32_t i = 0; i < config.textureCount; ++i)
+			entries[i].desiredMip = entries[i].tailMip;
+
+		// Estimate the screen space size of every object from its bounding sphere
+		const DirectX::XMVECTOR cameraPosition = sceneCamera.getPosition();
+		const float pixelScale = DirectX::XMVectorGetY(sceneCamera.projMatrix.r[1]) * settings.backBufferHeight;
+
+		auto request = [&](const Material* material, DirectX::FXMVECTOR center, float radius) {
+			float distance = DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(center, cameraPosition))) - radius;
+			float projectedSize = radius * pixelScale / std::max(distance, sceneCamera.nearZ);
+
+			const Texture* textures[]{
+				material->baseColor,
+				material->normal,
+				material->roughnessAO,
+				material->metallic,
+				material->height,
+				material->special
+			};
+			for(const Texture* texture : textures) {
+				if(!texture) continue;
 
-		// No need to signal compute queue as it was already signaled at the end of the frame
-		result = computeFence->SetEventOnCompletion(computeFenceValue, nullptr);
-		if(FAILED(result)) RIN_ERROR("Failed to wait for compute queue");
+				// The textures will always be this derived type
+				TextureStreamer::Entry& entry = entries[sceneTexturePool.getIndex((D3D12Texture*)texture)];
+				if(!entry.width) continue;
 
-		// Wait for copy queues to finish
-		result = device->SetEventOnMultipleFenceCompletion(copyFences, copyFenceValues, COPY_QUEUE_COUNT, D3D12_MULTIPLE_FENCE_WAIT_FLAG_ALL, nullptr);
-		if(FAILED(result)) RIN_ERROR("Failed to wait for copy queues");
-	}
+				entry.desiredMip = std::min(entry.desiredMip, TextureStreamer::getDesiredMip(entry.width, entry.height, entry.mipCount, projectedSize));
+			}
+		};
 
-	Camera& D3D12Renderer::getCamera() {
-		return sceneCamera;
-	}
+		// Scale the radius by the largest axis scale of the world matrix
+		auto getRadius = [](DirectX::FXMMATRIX worldMatrix, float radius) {
+			float a2 = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(worldMatrix.r[0]));
+			float b2 = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(worldMatrix.r[1]));
+			float c2 = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(worldMatrix.r[2]));
 
-	const Camera& D3D12Renderer::getCamera() const {
-		return sceneCamera;
-	}
+			return radius * sqrtf(std::max(a2, std::max(b2, c2)));
+		};
 
-	StaticMesh* D3D12Renderer::addStaticMesh(
-		const BoundingSphere& boundingSphere,
-		const StaticVertex* vertices,
-		const uint32_t* vertexCounts,
-		const index_type* indices,
-		const uint32_t* indexCounts,
-		uint32_t lodCount
-	) {
-		// Validation
-		if(!lodCount) RIN_ERROR("LOD count must not be 0");
+		for(uint32_t i = 0; i < config.staticObjectCount; ++i) {
+			StaticObject* object = sceneStaticObjectPool.at(i);
+			if(!object || !object->resident()) continue;
 
-		if(lodCount > LOD_COUNT) {
-			RIN_DEBUG_INFO("LOD count larger than supported, ignoring extra LODs");
-			lodCount = LOD_COUNT;
+			// Static meshes are in world space
+			const BoundingSphere& boundingSphere = ((D3D12StaticMesh*)object->mesh)->boundingSphere;
+			request(object->material, DirectX::XMLoadFloat3(&boundingSphere.center), boundingSphere.radius);
 		}
 
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			if(!vertexCounts[i]) RIN_ERROR("Vertex count must not be 0");
+		for(uint32_t i = 0; i < config.dynamicObjectCount; ++i) {
+			DynamicObject* object = sceneDynamicObjectPool.at(i);
+			if(!object || !object->resident()) continue;
 
-			if(vertexCounts[i] * sizeof(StaticVertex) > config.uploadStreamSize) {
-				RIN_DEBUG_ERROR("Static vertex upload too large");
-				return nullptr;
-			}
+			const BoundingSphere& boundingSphere = ((D3D12DynamicMesh*)object->mesh)->boundingSphere;
+			DirectX::XMVECTOR center = DirectX::XMVector3Transform(DirectX::XMLoadFloat3(&boundingSphere.center), object->worldMatrix);
+			request(object->material, center, getRadius(object->worldMatrix, boundingSphere.radius));
 		}
 
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			if(!indexCounts[i]) RIN_ERROR("Index count must not be 0");
+		for(uint32_t i = 0; i < config.skinnedObjectCount; ++i) {
+			SkinnedObject* object = sceneSkinnedObjectPool.at(i);
+			if(!object || !object->resident()) continue;
 
-			if(indexCounts[i] * sizeof(index_type) > config.uploadStreamSize) {
-				RIN_DEBUG_ERROR("Static index upload too large");
-				return nullptr;
-			}
+			// Bounds of the pose from the last update, like in the skinned cull pass
+			const BoundingSphere boundingSphere = object->getBoundingSphere();
+			request(object->material, DirectX::XMLoadFloat3(&boundingSphere.center), boundingSphere.radius);
 		}
 
-		// Create mesh
-		D3D12StaticMesh* mesh = sceneStaticMeshPool.insert(boundingSphere);
-		if(!mesh) return nullptr;
-
-		// Make all allocations
-		bool failedAlloc = false;
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			auto vertexAlloc = sceneStaticVertexAllocator.allocate(vertexCounts[i] * sizeof(StaticVertex));
-			if(!vertexAlloc) {
-				failedAlloc = true;
-				break;
-			}
-
-			auto indexAlloc = sceneStaticIndexAllocator.allocate(indexCounts[i] * sizeof(index_type));
-			if(!indexAlloc) {
-				failedAlloc = true;
-				sceneStaticVertexAllocator.free(vertexAlloc);
-				break;
+		// Dead textures keep what they have until they are destroyed
+		for(uint32_t i = 0; i < config.textureCount; ++i) {
+			D3D12Texture* texture = sceneTexturePool.at(i);
+			if(texture && texture->dead) entries[i].desiredMip = entries[i].residentMip;
+		}
+
+		sceneTextureStreamer.update(entries, config.textureCount, frame, sceneTextureStreamChanges);
+
+		for(const TextureStreamer::Change& change : sceneTextureStreamChanges) {
+			TextureStreamer::Entry& entry = entries[change.index];
+			D3D12Texture* texture = sceneTexturePool.at(change.index);
+
+			const uint32_t width = std::max(entry.width >> change.mip, (uint32_t)1);
+			const uint32_t height = std::max(entry.height >> change.mip, (uint32_t)1);
+			const uint32_t mipCount = entry.mipCount - change.mip;
+			DXGI_FORMAT dxgiFormat = getFormat(entry.format);
+
+			D3D12_RESOURCE_DESC resourceDesc{};
+			resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+			resourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+			resourceDesc.Width = width;
+			resourceDesc.Height = height;
+			resourceDesc.DepthOrArraySize = 1;
+			resourceDesc.MipLevels = mipCount;
+			resourceDesc.Format = dxgiFormat;
+			resourceDesc.SampleDesc.Count = 1;
+			resourceDesc.SampleDesc.Quality = 0;
+			resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+			resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+			D3D12_RESOURCE_ALLOCATION_INFO heapInfo = device->GetResourceAllocationInfo(0, 1, &resourceDesc);
+
+			// The texture heap can be full even when the budget is not
+			auto textureAlloc = sceneTextureAllocator.allocate(heapInfo.SizeInBytes);
+			if(!textureAlloc) {
+				entry.pending = false;
+				continue;
 			}
 
-			mesh->lods[i].emplace(vertexAlloc.value(), indexAlloc.value());
-		}
-
-		// Cleanup
-		if(failedAlloc) {
-			for(uint32_t i = 0; i < lodCount; ++i) {
-				if(mesh->lods[i]) {
-					sceneStaticVertexAllocator.free(mesh->lods[i]->vertexAlloc);
-					sceneStaticIndexAllocator.free(mesh->lods[i]->indexAlloc);
-				}
-			}
+			ID3D12Resource* resource;
+			HRESULT result = device->CreatePlacedResource(
+				sceneTextureHeap,
+				sceneTextureOffset + textureAlloc->start,
+				&resourceDesc,
+				D3D12_RESOURCE_STATE_COMMON,
+				nullptr,
+				IID_PPV_ARGS(&resource)
+			);
+			if(FAILED(result)) RIN_ERROR("Failed to create streamed texture");
 
-			sceneStaticMeshPool.remove(mesh);
+			texture->streamResource = resource;
+			texture->streamAlloc = textureAlloc;
+			texture->streamMip = change.mip;
 
-			return nullptr;
-		}
+			// Critical section
+			std::lock_guard<std::mutex> uploadLock(uploadStreamMutex);
+			uploadStreamQueue.beginBatch(0.0f);
 
-		// Critical section
-		std::lock_guard<std::mutex> lock(uploadStreamMutex);
+			if(change.mip < entry.residentMip) {
+				// Enqueue upload of the new detailed mips
+				const char* data = texture->streamData +
+					TextureStreamer::getSize(entry.format, entry.width, entry.height, entry.mipCount, 0) -
+					TextureStreamer::getSize(entry.format, entry.width, entry.height, entry.mipCount, change.mip);
+				std::vector<UploadChunker::TextureChunk> chunks = uploadStreamChunker.chunkTexture(entry.format, width, height, 1, entry.residentMip - change.mip);
 
-		const StaticVertex* lodVertices = vertices;
-		const index_type* lodIndices = indices;
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			FreeListAllocator::Allocation vertexAlloc = mesh->lods[i]->vertexAlloc;
-			FreeListAllocator::Allocation indexAlloc = mesh->lods[i]->indexAlloc;
+				enqueueTextureUpload(resource, dxgiFormat, data, chunks, nullptr);
+			}
 
-			// Enqueue vertex upload
+			// Enqueue copy of the mips which are kept
+			// This goes on the sync queue since the old texture may be in use until the frame is done
+			const uint32_t keptMip = std::max(change.mip, entry.residentMip);
 			uploadStreamQueue.push(
 				{
-					[this, vertexAlloc, lodVertices](ID3D12GraphicsCommandList* commandList) {
-						auto uploadAlloc = uploadStreamAllocator.allocate(vertexAlloc.size);
-						if(!uploadAlloc) RIN_ERROR("Upload static vertices anomaly: out of upload stream space");
-
-						commandList->CopyBufferRegion(
-							sceneStaticVertexBuffer,
-							vertexAlloc.start,
-							uploadBuffer,
-							uploadStreamOffset + uploadAlloc->start,
-							vertexAlloc.size
-						);
+					[texture, oldResource = texture->resource, resource, keptMip, newMip = change.mip, oldMip = entry.residentMip, endMip = entry.mipCount](ID3D12GraphicsCommandList* commandList) {
+						D3D12_TEXTURE_COPY_LOCATION copyDest{};
+						copyDest.pResource = resource;
+						copyDest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
 
-						memcpy(uploadBufferData + uploadStreamOffset + uploadAlloc->start, lodVertices, vertexAlloc.size);
-					},
-					vertexAlloc.size,
-					COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX
-				}
-			);
+						D3D12_TEXTURE_COPY_LOCATION copySrc{};
+						copySrc.pResource = oldResource;
+						copySrc.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
 
-			// Enqueue index upload
-			bool finalUpload = i == lodCount - 1;
-			uploadStreamQueue.push(
-				{
-					[this, indexAlloc, lodIndices, finalUpload, mesh](ID3D12GraphicsCommandList* commandList) {
-						auto uploadAlloc = uploadStreamAllocator.allocate(indexAlloc.size);
-						if(!uploadAlloc) RIN_ERROR("Upload static indices anomaly: out of upload stream space");
-
-						commandList->CopyBufferRegion(
-							sceneStaticIndexBuffer,
-							indexAlloc.start,
-							uploadBuffer,
-							uploadStreamOffset + uploadAlloc->start,
-							indexAlloc.size
-						);
+						for(uint32_t mip = keptMip; mip < endMip; ++mip) {
+							copyDest.SubresourceIndex = mip - newMip;
+							copySrc.SubresourceIndex = mip - oldMip;
 
-						memcpy(uploadBufferData + uploadStreamOffset + uploadAlloc->start, lodIndices, indexAlloc.size);
+							commandList->CopyTextureRegion(&copyDest, 0, 0, 0, &copySrc, nullptr);
+						}
 
-						if(finalUpload) mesh->_resident = true;
+						// Swapped in by render() once the copies are complete
+						texture->streamReady = true;
 					},
-					indexAlloc.size,
-					COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX
+					0,
+					COPY_QUEUE_CAMERA_STATIC_DYNAMIC_SKINNED_OB_LB_INDEX
 				}
 			);
-
-			lodVertices += vertexCounts[i];
-			lodIndices += indexCounts[i];
 		}
 
-		return mesh;
+		sceneTextureStreamChanges.clear();
 	}
 
-	void D3D12Renderer::removeStaticMesh(StaticMesh* m) {
-		if(!m) return;
+	void D3D12Renderer::swapStreamedTextures() {
+		// Critical section
+		std::lock_guard<std::mutex> lock(sceneTextureStreamMutex);
 
-		D3D12StaticMesh* mesh = (D3D12StaticMesh*)m;
+		for(uint32_t i = 0; i < config.textureCount; ++i) {
+			D3D12Texture* texture = sceneTexturePool.at(i);
+			if(!texture || !texture->streamReady) continue;
+
+			// The previous frame is finished, so the old texture is no longer in use
+			texture->resource->Release();
+			sceneTextureAllocator.free(texture->textureAlloc);
+
+			texture->resource = texture->streamResource;
+			texture->textureAlloc = texture->streamAlloc.value();
+			texture->streamResource = nullptr;
+			texture->streamAlloc.reset();
+			texture->streamReady = false;
+
+			TextureStreamer::Entry& entry = sceneTextureStreams[i];
+			entry.residentMip = texture->streamMip;
+			entry.pending = false;
+
+			// Point the srv at the new texture
+			D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+			srvDesc.Format = getFormat(texture->format);
+			srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+			srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+			srvDesc.Texture2D.MostDetailedMip = 0;
+			srvDesc.Texture2D.MipLevels = entry.mipCount - entry.residentMip;
+			srvDesc.Texture2D.PlaneSlice = 0;
+			srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
 
-		for(uint32_t i = 0; i < LOD_COUNT; ++i) {
-			if(mesh->lods[i]) {
-				sceneStaticVertexAllocator.free(mesh->lods[i]->vertexAlloc);
-				sceneStaticIndexAllocator.free(mesh->lods[i]->indexAlloc);
-			}
+			device->CreateShaderResourceView(texture->resource, &srvDesc, getSceneDescHeapCPUHandle(SCENE_TEXTURE_SRV_OFFSET + i));
 		}
-
-		// Do this after freeing the allocations so that another thread does
-		// not write over the lods if it gets a pointer that aliases this one
-		sceneStaticMeshPool.remove(mesh);
 	}
 
-	StaticObject* D3D12Renderer::addStaticObject(StaticMesh* mesh, Material* material) {
-		if(!mesh || !material) return nullptr;
+	/*
+	Points every LOD at the closest resident LOD, preferring less detailed
+	ones, so that objects never draw a LOD which is not uploaded
+	Returns false if none of the LODs are resident
+	Bit i of index16 is set if LOD i is drawn with 16-bit indices
+	*/
+	template<class LOD> bool getLODData(const std::optional<LOD>* lods, uint64_t vertexSize, D3D12LODData* lodData, uint32_t& index16) {
+		index16 = 0;
 
-		StaticObject* object = sceneStaticObjectPool.insert(mesh, material);
+		for(uint32_t i = 0; i < LOD_COUNT; ++i) {
+			const LOD* lod = nullptr;
+			for(uint32_t j = i; j < LOD_COUNT && !lod; ++j)
+				if(lods[j] && lods[j]->resident) lod = &lods[j].value();
+			for(uint32_t j = i; j-- > 0 && !lod;)
+				if(lods[j] && lods[j]->resident) lod = &lods[j].value();
 
-		updateStaticObject(object);
+			if(!lod) return false;
+
+			const uint64_t indexSize = lod->index16 ? sizeof(uint16_t) : sizeof(index_type);
+			lodData[i].startIndex = (uint32_t)(lod->indexAlloc.start / indexSize);
+			lodData[i].indexCount = (uint32_t)(lod->indexAlloc.size / indexSize);
+			lodData[i].vertexOffset = (uint32_t)(lod->vertexAlloc.start / vertexSize);
+			if(lod->index16) index16 |= 1 << i;
+		}
+
+		return true;
+	}
+
+	/*
+	Allocates the indices of a LOD from the 16-bit arena if the LOD can use
+	16-bit indices, falling back to the 32-bit arena if it is out of space
+	indexSize is the size of the 32-bit indices
+	*/
+	FreeListAllocator::allocation_type allocateLODIndices(
+		FreeListAllocator& indexAllocator,
+		FreeListAllocator& index16Allocator,
+		uint64_t indexSize,
+		bool canIndex16,
+		bool& index16
+	) {
+		if(canIndex16) {
+			auto indexAlloc = index16Allocator.allocate(indexSize / 2);
+			if(indexAlloc) {
+				index16 = true;
+				return indexAlloc;
+			}
+		}
+
+		index16 = false;
+		return indexAllocator.allocate(indexSize);
+	}
+
+	template<class Mesh> void D3D12Renderer::enqueueMeshLODUpload(
+		Mesh* mesh,
+		uint32_t lod,
+		ID3D12Resource* vertexBuffer,
+		ID3D12Resource* indexBuffer,
+		uint64_t index16Offset,
+		uint32_t vertexCopyQueueIndex,
+		uint32_t indexCopyQueueIndex
+	) {
+		// Must be called from inside the upload stream critical section
+		auto& meshLOD = mesh->lods[lod].value();
+
+		// Enqueue vertex upload
+		bool quantized = false;
+		uint64_t vertexOffset = 0; // In the vertex buffer, from the start of the allocation
+		uint64_t vertexSize = meshLOD.vertexAlloc.size;
+		if constexpr(std::is_same_v<Mesh, D3D12StaticMesh>) {
+			quantized = config.quantizeStaticVertices;
+
+			// Only the shared vertices past the ones already uploaded are needed
+			if(mesh->sharedVertices) {
+				vertexOffset = mesh->sharedVertexUploadSize;
+				vertexSize = mesh->lodVertexSizes[lod] > vertexOffset ? mesh->lodVertexSizes[lod] - vertexOffset : 0;
+				mesh->sharedVertexUploadSize = vertexOffset + vertexSize;
+			}
+		}
+
+		if(quantized && vertexSize) {
+			// The vertices are quantized from full size static vertices
+			const uint64_t sourceOffset = vertexOffset / sizeof(QuantizedStaticVertex) * sizeof(StaticVertex);
+
+			enqueueQuantizedVertexUpload(
+				vertexBuffer,
+				meshLOD.vertexAlloc.start + vertexOffset,
+				mesh->lodVertices[lod] + sourceOffset,
+				vertexSize / sizeof(QuantizedStaticVertex),
+				mesh->boundingSphere,
+				vertexCopyQueueIndex,
+				nullptr
+			);
+		} else if(vertexSize) {
+			enqueueBufferUpload(
+				vertexBuffer,
+				meshLOD.vertexAlloc.start + vertexOffset,
+				mesh->lodVertices[lod] + vertexOffset,
+				vertexSize,
+				vertexCopyQueueIndex,
+				nullptr
+			);
+		}
+
+		// Enqueue index upload
+		enqueueIndexUpload(
+			indexBuffer,
+			(meshLOD.index16 ? index16Offset : 0) + meshLOD.indexAlloc.start,
+			mesh->lodIndices[lod],
+			mesh->lodIndexSizes[lod] / sizeof(index_type),
+			meshLOD.index16,
+			indexCopyQueueIndex,
+			&meshLOD.resident
+		);
+
+		// Objects using the mesh can be drawn once the least detailed LOD is uploaded
+		if(lod == mesh->lodCount - 1) {
+			uploadStreamQueue.push(
+				{
+					[mesh](ID3D12GraphicsCommandList* commandList) {
+						mesh->_resident = true;
+					},
+					0,
+					indexCopyQueueIndex
+				}
+			);
+		}
+	}
+
+	template<class Mesh> void D3D12Renderer::streamMeshLODs(
+		DynamicPool<Mesh>& meshPool,
+		uint32_t meshCount,
+		FreeListAllocator& vertexAllocator,
+		FreeListAllocator& indexAllocator,
+		FreeListAllocator& index16Allocator,
+		ID3D12Resource* vertexBuffer,
+		ID3D12Resource* indexBuffer,
+		uint32_t vertexCopyQueueIndex,
+		uint32_t indexCopyQueueIndex
+	) {
+		bool evicted = false;
+
+		// Shared vertices belong to the mesh, so its LODs only stream their indices
+		auto sharesVertices = [](Mesh* mesh) {
+			if constexpr(std::is_same_v<Mesh, D3D12StaticMesh>) return mesh->sharedVertices;
+			else return false;
+		};
+
+		for(uint32_t i = 0; i < meshCount; ++i) {
+			Mesh* mesh = meshPool.at(i);
+			if(!mesh || !mesh->streamed || !mesh->resident()) continue;
+
+			// Stream in from the least detailed missing LOD up
+			for(uint32_t j = mesh->lodCount - 1; j-- > mesh->desiredLOD;) {
+				if(mesh->lods[j]) continue;
+
+				// Shared vertices are allocated with the mesh
+				FreeListAllocator::allocation_type vertexAlloc;
+				if constexpr(std::is_same_v<Mesh, D3D12StaticMesh>) vertexAlloc = mesh->sharedVertexAlloc;
+				if(!sharesVertices(mesh)) vertexAlloc = vertexAllocator.allocate(mesh->lodVertexSizes[j]);
+
+				bool index16;
+				auto indexAlloc = allocateLODIndices(indexAllocator, index16Allocator, mesh->lodIndexSizes[j], mesh->lodIndex16[j], index16);
+				if(!vertexAlloc || !indexAlloc) {
+					if(vertexAlloc && !sharesVertices(mesh)) vertexAllocator.free(vertexAlloc);
+					if(indexAlloc) (index16 ? index16Allocator : indexAllocator).free(indexAlloc);
+
+					/*
+					Out of space, so evict every LOD which is more detailed than
+					needed, the memory is freed once the objects using the LODs
+					have been updated, so this is retried on a later frame
+					*/
+					if(!evicted) {
+						for(uint32_t k = 0; k < meshCount; ++k) {
+							Mesh* other = meshPool.at(k);
+							if(!other || !other->streamed) continue;
+
+							for(uint32_t l = 0; l < other->desiredLOD; ++l) {
+								if(!other->lods[l] || !other->lods[l]->resident) continue;
+
+								if(!sharesVertices(other)) sceneMeshLODEvictions.push_back({ &vertexAllocator, other->lods[l]->vertexAlloc });
+								sceneMeshLODEvictions.push_back({ other->lods[l]->index16 ? &index16Allocator : &indexAllocator, other->lods[l]->indexAlloc });
+								other->lods[l].reset();
+							}
+						}
+
+						evicted = true;
+					}
+
+					break;
+				}
+
+				mesh->lods[j].emplace(vertexAlloc.value(), indexAlloc.value(), index16);
+
+				// Critical section
+				std::lock_guard<std::mutex> lock(uploadStreamMutex);
+				uploadStreamQueue.beginBatch(0.0f);
+
+				enqueueMeshLODUpload(mesh, j, vertexBuffer, indexBuffer, indexAllocator.getSize(), vertexCopyQueueIndex, indexCopyQueueIndex);
+			}
+		}
+	}
+
+	void D3D12Renderer::streamMeshes() {
+		// Find the meshes whose resident LODs changed since their objects were uploaded
+		auto updateLODMask = [](auto* mesh) {
+			uint32_t lodMask = 0;
+			for(uint32_t i = 0; i < LOD_COUNT; ++i)
+				if(mesh->lods[i] && mesh->lods[i]->resident) lodMask |= 1 << i;
+
+			mesh->lodsChanged = lodMask != mesh->lodMask;
+			mesh->lodMask = lodMask;
+			mesh->desiredLOD = mesh->lodCount - 1;
+		};
+
+		for(uint32_t i = 0; i < config.staticMeshCount; ++i)
+			if(D3D12StaticMesh* mesh = sceneStaticMeshPool.at(i)) updateLODMask(mesh);
+		for(uint32_t i = 0; i < config.dynamicMeshCount; ++i)
+			if(D3D12DynamicMesh* mesh = sceneDynamicMeshPool.at(i)) updateLODMask(mesh);
+		for(uint32_t i = 0; i < config.skinnedMeshCount; ++i)
+			if(D3D12SkinnedMesh* mesh = sceneSkinnedMeshPool.at(i)) updateLODMask(mesh);
+
+		// Update the objects of those meshes and of materials which became resident, and find the LODs the objects need
+		// Object writes are served ahead of the uploads they depend on, so they are hidden until those are resident
+		const DirectX::XMVECTOR cameraPosition = sceneCamera.getPosition();
+
+		auto getDistance = [&](DirectX::FXMVECTOR center, float radius) {
+			return DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(center, cameraPosition))) - radius;
+		};
+
+		// Scale the radius by the largest axis scale of the world matrix
+		auto getRadius = [](DirectX::FXMMATRIX worldMatrix, float radius) {
+			float a2 = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(worldMatrix.r[0]));
+			float b2 = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(worldMatrix.r[1]));
+			float c2 = DirectX::XMVectorGetX(DirectX::XMVector3LengthSq(worldMatrix.r[2]));
+
+			return radius * sqrtf(std::max(a2, std::max(b2, c2)));
+		};
+
+		for(uint32_t i = 0; i < config.staticObjectCount; ++i) {
+			StaticObject* object = sceneStaticObjectPool.at(i);
+			if(!object) continue;
+
+			// The mesh will always be this derived type
+			D3D12StaticMesh* mesh = (D3D12StaticMesh*)object->mesh;
+			const bool materialResident = object->material->resident();
+			if(mesh->lodsChanged || materialResident != object->materialResident) sceneStaticObjectUpdates.push_back(object);
+			object->materialResident = materialResident;
+
+			// Static meshes are in world space
+			const BoundingSphere& boundingSphere = mesh->boundingSphere;
+			float distance = getDistance(DirectX::XMLoadFloat3(&boundingSphere.center), boundingSphere.radius);
+			mesh->desiredLOD = std::min(mesh->desiredLOD, selectLOD(distance));
+		}
+
+		for(uint32_t i = 0; i < config.dynamicObjectCount; ++i) {
+			DynamicObject* object = sceneDynamicObjectPool.at(i);
+			if(!object) continue;
+
+			// The mesh will always be this derived type
+			D3D12DynamicMesh* mesh = (D3D12DynamicMesh*)object->mesh;
+			if(mesh->lodsChanged) object->dirty = true;
+
+			const BoundingSphere& boundingSphere = mesh->boundingSphere;
+			DirectX::XMVECTOR center = DirectX::XMVector3Transform(DirectX::XMLoadFloat3(&boundingSphere.center), object->worldMatrix);
+			float distance = getDistance(center, getRadius(object->worldMatrix, boundingSphere.radius));
+			mesh->desiredLOD = std::min(mesh->desiredLOD, selectLOD(distance));
+		}
+
+		for(uint32_t i = 0; i < config.skinnedObjectCount; ++i) {
+			SkinnedObject* object = sceneSkinnedObjectPool.at(i);
+			if(!object) continue;
+
+			// The mesh will always be this derived type
+			D3D12SkinnedMesh* mesh = (D3D12SkinnedMesh*)object->mesh;
+			const bool materialResident = object->material->resident();
+			if(mesh->lodsChanged || materialResident != object->materialResident) updateSkinnedObject(object);
+			object->materialResident = materialResident;
+
+			// Bounds of the pose from the last update, like in the skinned cull pass
+			const BoundingSphere boundingSphere = object->getBoundingSphere();
+			float distance = getDistance(DirectX::XMLoadFloat3(&boundingSphere.center), boundingSphere.radius);
+			mesh->desiredLOD = std::min(mesh->desiredLOD, selectLOD(distance));
+		}
+
+		/*
+		Free the LODs evicted on the previous frame once the objects above no
+		longer use them, the static objects are rewritten in the same batch
+		as the callback which frees them, so they are recorded before it
+		Dynamic and skinned objects are rewritten by the update command list
+		of this frame, which render waits on before calling the callback
+		*/
+		if(!sceneStaticObjectUpdates.empty() || !sceneMeshLODEvictions.empty()) {
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadStreamMutex);
+			uploadStreamQueue.beginBatch(upload_stream_queue_type::IMMEDIATE);
+
+			for(StaticObject* object : sceneStaticObjectUpdates)
+				enqueueStaticObjectUpload(object);
+
+			if(!sceneMeshLODEvictions.empty()) {
+				enqueueResidencyCallback([evictions = std::move(sceneMeshLODEvictions)]() {
+					for(const auto& [allocator, allocation] : evictions)
+						allocator->free(allocation);
+				});
+			}
+
+			sceneStaticObjectUpdates.clear();
+			sceneMeshLODEvictions.clear();
+		}
+
+		// Stream in the LODs which are needed
+		streamMeshLODs(
+			sceneStaticMeshPool,
+			config.staticMeshCount,
+			sceneStaticVertexAllocator,
+			sceneStaticIndexAllocator,
+			sceneStaticIndex16Allocator,
+			sceneStaticVertexBuffer,
+			sceneStaticIndexBuffer,
+			COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX,
+			COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX
+		);
+		streamMeshLODs(
+			sceneDynamicMeshPool,
+			config.dynamicMeshCount,
+			sceneDynamicVertexAllocator,
+			sceneDynamicIndexAllocator,
+			sceneDynamicIndex16Allocator,
+			sceneDynamicVertexBuffer,
+			sceneDynamicIndexBuffer,
+			COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX,
+			COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX
+		);
+		streamMeshLODs(
+			sceneSkinnedMeshPool,
+			config.skinnedMeshCount,
+			sceneSkinnedVertexAllocator,
+			sceneSkinnedIndexAllocator,
+			sceneSkinnedIndex16Allocator,
+			sceneSkinnedVertexBuffer,
+			sceneSkinnedIndexBuffer,
+			COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX,
+			COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX
+		);
+	}
+
+	void D3D12Renderer::wait() {
+		HRESULT result;
+
+		// Signal copy queues
+		for(uint32_t i = 0; i < COPY_QUEUE_COUNT; ++i) {
+			result = copyQueues[i]->Signal(copyFences[i], ++copyFenceValues[i]);
+			if(FAILED(result)) RIN_ERROR("Failed to signal copy queue");
+		}
+
+		// No need to signal graphics queue as it was already signaled at the end of the frame
+		result = graphicsFence->SetEventOnCompletion(graphicsFenceValue, nullptr);
+		if(FAILED(result)) RIN_ERROR("Failed to wait for graphics queue");
+
+		// No need to signal compute queue as it was already signaled at the end of the frame
+		result = computeFence->SetEventOnCompletion(computeFenceValue, nullptr);
+		if(FAILED(result)) RIN_ERROR("Failed to wait for compute queue");
+
+		// Wait for copy queues to finish
+		result = device->SetEventOnMultipleFenceCompletion(copyFences, copyFenceValues, COPY_QUEUE_COUNT, D3D12_MULTIPLE_FENCE_WAIT_FLAG_ALL, nullptr);
+		if(FAILED(result)) RIN_ERROR("Failed to wait for copy queues");
+	}
+
+	Camera& D3D12Renderer::getCamera() {
+		return sceneCamera;
+	}
+
+	const Camera& D3D12Renderer::getCamera() const {
+		return sceneCamera;
+	}
+
+	StaticMesh* D3D12Renderer::addStaticMesh(
+		const BoundingSphere& boundingSphere,
+		const StaticVertex* vertices,
+		const uint32_t* vertexCounts,
+		const index_type* indices,
+		const uint32_t* indexCounts,
+		uint32_t lodCount,
+		residency_callback_type onResident,
+		float priority,
+		bool streamed,
+		bool sharedVertices
+	) {
+		// Validation
+		if(!lodCount) RIN_ERROR("LOD count must not be 0");
+
+		if(lodCount > LOD_COUNT) {
+			RIN_DEBUG_INFO("LOD count larger than supported, ignoring extra LODs");
+			lodCount = LOD_COUNT;
+		}
+
+		for(uint32_t i = 0; i < lodCount; ++i) {
+			if(!vertexCounts[i]) RIN_ERROR("Vertex count must not be 0");
+			if(!indexCounts[i]) RIN_ERROR("Index count must not be 0");
+			if(sharedVertices && i && vertexCounts[i] > vertexCounts[i - 1]) RIN_ERROR("Shared vertex counts must not increase with the LOD");
+		}
+
+		// Quantizing vertices in reserved upload memory would read from it
+		if(config.quantizeStaticVertices && isUploadReserved((const char*)vertices))
+			RIN_ERROR("Static vertices must not be in reserved upload memory when quantizing static vertices");
+
+		// Create mesh
+		D3D12StaticMesh* mesh = sceneStaticMeshPool.insert(boundingSphere, lodCount);
+		if(!mesh) return nullptr;
+
+		mesh->streamed = streamed;
+		mesh->sharedVertices = sharedVertices;
+
+		const StaticVertex* lodVertices = vertices;
+		const index_type* lodIndices = indices;
+		for(uint32_t i = 0; i < lodCount; ++i) {
+			mesh->lodVertices[i] = (const char*)lodVertices;
+			mesh->lodIndices[i] = (const char*)lodIndices;
+			mesh->lodVertexSizes[i] = vertexCounts[i] * getStaticVertexSize(config);
+			mesh->lodIndexSizes[i] = indexCounts[i] * sizeof(index_type);
+			// Narrowing indices in reserved upload memory would read from it
+			mesh->lodIndex16[i] = vertexCounts[i] <= INDEX16_VERTEX_COUNT && !isUploadReserved((const char*)lodIndices);
+
+			// Every LOD starts at the shared vertices
+			if(!sharedVertices) lodVertices += vertexCounts[i];
+			lodIndices += indexCounts[i];
+		}
+
+		// Streamed meshes only need their least detailed LOD up front
+		const uint32_t firstLOD = streamed ? lodCount - 1 : 0;
+
+		// Make all allocations, shared vertices are allocated once for every LOD
+		bool failedAlloc = false;
+		if(sharedVertices) {
+			mesh->sharedVertexAlloc = sceneStaticVertexAllocator.allocate(mesh->lodVertexSizes[0]);
+			failedAlloc = !mesh->sharedVertexAlloc;
+		}
+
+		for(uint32_t i = firstLOD; i < lodCount && !failedAlloc; ++i) {
+			auto vertexAlloc = sharedVertices ? mesh->sharedVertexAlloc : sceneStaticVertexAllocator.allocate(mesh->lodVertexSizes[i]);
+			if(!vertexAlloc) {
+				failedAlloc = true;
+				break;
+			}
+
+			bool index16;
+			auto indexAlloc = allocateLODIndices(sceneStaticIndexAllocator, sceneStaticIndex16Allocator, mesh->lodIndexSizes[i], mesh->lodIndex16[i], index16);
+			if(!indexAlloc) {
+				failedAlloc = true;
+				if(!sharedVertices) sceneStaticVertexAllocator.free(vertexAlloc);
+				break;
+			}
+
+			mesh->lods[i].emplace(vertexAlloc.value(), indexAlloc.value(), index16);
+		}
+
+		// Cleanup
+		if(failedAlloc) {
+			for(uint32_t i = 0; i < lodCount; ++i) {
+				if(mesh->lods[i]) {
+					if(!sharedVertices) sceneStaticVertexAllocator.free(mesh->lods[i]->vertexAlloc);
+					(mesh->lods[i]->index16 ? sceneStaticIndex16Allocator : sceneStaticIndexAllocator).free(mesh->lods[i]->indexAlloc);
+				}
+			}
+
+			if(mesh->sharedVertexAlloc) sceneStaticVertexAllocator.free(mesh->sharedVertexAlloc);
+
+			sceneStaticMeshPool.remove(mesh);
+
+			return nullptr;
+		}
+
+		// Critical section
+		std::lock_guard<std::mutex> lock(uploadStreamMutex);
+		uploadStreamQueue.beginBatch(priority);
+
+		// Enqueue uploads from the least detailed LOD up so that objects can be drawn early
+		for(uint32_t i = lodCount; i-- > firstLOD;)
+			enqueueMeshLODUpload(mesh, i, sceneStaticVertexBuffer, sceneStaticIndexBuffer, sceneStaticIndexAllocator.getSize(), COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX, COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX);
+
+		if(onResident) enqueueResidencyCallback(std::move(onResident));
+
+		return mesh;
+	}
+
+	void D3D12Renderer::removeStaticMesh(StaticMesh* m) {
+		if(!m) return;
+
+		D3D12StaticMesh* mesh = (D3D12StaticMesh*)m;
+
+		for(uint32_t i = 0; i < LOD_COUNT; ++i) {
+			if(mesh->lods[i]) {
+				if(!mesh->sharedVertices) sceneStaticVertexAllocator.free(mesh->lods[i]->vertexAlloc);
+				(mesh->lods[i]->index16 ? sceneStaticIndex16Allocator : sceneStaticIndexAllocator).free(mesh->lods[i]->indexAlloc);
+			}
+		}
+
+		if(mesh->sharedVertexAlloc) sceneStaticVertexAllocator.free(mesh->sharedVertexAlloc);
+
+		// Do this after freeing the allocations so that another thread does
+		// not write over the lods if it gets a pointer that aliases this one
+		sceneStaticMeshPool.remove(mesh);
+	}
+
+	StaticObject* D3D12Renderer::addStaticObject(StaticMesh* mesh, Material* material, residency_callback_type onResident) {
+		if(!mesh || !material) return nullptr;
+
+		StaticObject* object = sceneStaticObjectPool.insert(mesh, material);
+
+		updateStaticObject(object);
+
+		if(object && onResident) {
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadStreamMutex);
+			uploadStreamQueue.beginBatch(upload_stream_queue_type::IMMEDIATE);
+
+			enqueueResidencyCallback(std::move(onResident));
+		}
 
 		return object;
 	}
@@ -3277,6 +4282,7 @@ namespace RIN {
 		{
 			// Critical section
 			std::lock_guard<std::mutex> lock(uploadStreamMutex);
+			uploadStreamQueue.beginBatch(upload_stream_queue_type::IMMEDIATE);
 
 			// Enqueue object removal
 			uploadStreamQueue.push(
@@ -3308,23 +4314,21 @@ namespace RIN {
 
 		// Enter critical section
 		std::lock_guard<std::mutex> lock(uploadStreamMutex);
+		uploadStreamQueue.beginBatch(upload_stream_queue_type::IMMEDIATE);
 
+		enqueueStaticObjectUpload(object);
+	}
+
+	void D3D12Renderer::enqueueStaticObjectUpload(StaticObject* object) {
 		// Enqueue object upload
+		// Objects in adjacent slots are coalesced into a single copy
 		uploadStreamQueue.push(
 			{
-				[this, object](ID3D12GraphicsCommandList* commandList) {
-					auto uploadAlloc = uploadStreamAllocator.allocate(sizeof(D3D12StaticObjectData));
-					if(!uploadAlloc) RIN_ERROR("Upload static object anomaly: out of upload stream space");
-
-					commandList->CopyBufferRegion(
-						sceneStaticObjectBuffer,
-						sceneStaticObjectPool.getIndex(object) * sizeof(D3D12StaticObjectData),
-						uploadBuffer,
-						uploadStreamOffset + uploadAlloc->start,
-						sizeof(D3D12StaticObjectData)
-					);
-
-					D3D12StaticObjectData* objectData = (D3D12StaticObjectData*)(uploadBufferData + uploadStreamOffset + uploadAlloc->start);
+				nullptr,
+				sizeof(D3D12StaticObjectData),
+				COPY_QUEUE_CAMERA_STATIC_DYNAMIC_SKINNED_OB_LB_INDEX,
+				[this, object](char* uploadData) {
+					D3D12StaticObjectData* objectData = (D3D12StaticObjectData*)uploadData;
 
 					// The mesh will always be this derived type
 					D3D12StaticMesh* objectMesh = (D3D12StaticMesh*)object->mesh;
@@ -3332,18 +4336,12 @@ namespace RIN {
 					objectData->boundingSphere.center = objectMesh->boundingSphere.center;
 					objectData->boundingSphere.radius = objectMesh->boundingSphere.radius;
 
-					// All guaranteed to have at least lod 0
-					D3D12StaticMesh::LOD lod = objectMesh->lods[0].value();
-					// Populate LOD data
-					for(uint32_t i = 0; i < LOD_COUNT; ++i) {
-						if(i && objectMesh->lods[i]) lod = objectMesh->lods[i].value();
+					Material* material = object->material;
 
-						objectData->lods[i].startIndex = (uint32_t)(lod.indexAlloc.start / sizeof(index_type));
-						objectData->lods[i].indexCount = (uint32_t)(lod.indexAlloc.size / sizeof(index_type));
-						objectData->lods[i].vertexOffset = (uint32_t)(lod.vertexAlloc.start / sizeof(StaticVertex));
-					}
+					// Populate LOD data, objects are hidden until a LOD of their mesh and their textures are resident
+					uint32_t index16;
+					bool show = getLODData(objectMesh->lods, getStaticVertexSize(config), objectData->lods, index16) && material->resident();
 
-					Material* material = object->material;
 					// The textures will always be this derived type
 					objectData->material.baseColorID = sceneTexturePool.getIndex((D3D12Texture*)material->baseColor);
 					objectData->material.normalID = sceneTexturePool.getIndex((D3D12Texture*)material->normal);
@@ -3352,13 +4350,14 @@ namespace RIN {
 					objectData->material.heightID = sceneTexturePool.getIndex((D3D12Texture*)material->height);
 					if(material->special) objectData->material.specialID = sceneTexturePool.getIndex((D3D12Texture*)material->special);
 
-					objectData->flags.show = 1;
+					objectData->flags.show = show;
+					objectData->flags.index16 = index16;
 					objectData->flags.materialType = (uint32_t)material->type;
 
 					object->_resident = true;
 				},
-				sizeof(D3D12StaticObjectData),
-				COPY_QUEUE_CAMERA_STATIC_DYNAMIC_SKINNED_OB_LB_INDEX
+				sceneStaticObjectBuffer,
+				sceneStaticObjectPool.getIndex(object) * sizeof(D3D12StaticObjectData)
 			}
 		);
 	}
@@ -3369,7 +4368,10 @@ namespace RIN {
 		const uint32_t* vertexCounts,
 		const index_type* indices,
 		const uint32_t* indexCounts,
-		uint32_t lodCount
+		uint32_t lodCount,
+		residency_callback_type onResident,
+		float priority,
+		bool streamed
 	) {
 		// Validation
 		if(!lodCount) RIN_ERROR("LOD count must not be 0");
@@ -3381,43 +4383,50 @@ namespace RIN {
 
 		for(uint32_t i = 0; i < lodCount; ++i) {
 			if(!vertexCounts[i]) RIN_ERROR("Vertex count must not be 0");
-
-			if(vertexCounts[i] * sizeof(DynamicVertex) > config.uploadStreamSize) {
-				RIN_DEBUG_ERROR("Dynamic vertex upload too large");
-				return nullptr;
-			}
+			if(!indexCounts[i]) RIN_ERROR("Index count must not be 0");
 		}
 
+		// Create mesh
+		D3D12DynamicMesh* mesh = sceneDynamicMeshPool.insert(boundingSphere, lodCount);
+		if(!mesh) return nullptr;
+
+		mesh->streamed = streamed;
+
+		const DynamicVertex* lodVertices = vertices;
+		const index_type* lodIndices = indices;
 		for(uint32_t i = 0; i < lodCount; ++i) {
-			if(!indexCounts[i]) RIN_ERROR("Index count must not be 0");
+			mesh->lodVertices[i] = (const char*)lodVertices;
+			mesh->lodIndices[i] = (const char*)lodIndices;
+			mesh->lodVertexSizes[i] = vertexCounts[i] * sizeof(DynamicVertex);
+			mesh->lodIndexSizes[i] = indexCounts[i] * sizeof(index_type);
+			// Narrowing indices in reserved upload memory would read from it
+			mesh->lodIndex16[i] = vertexCounts[i] <= INDEX16_VERTEX_COUNT && !isUploadReserved((const char*)lodIndices);
 
-			if(indexCounts[i] * sizeof(index_type) > config.uploadStreamSize) {
-				RIN_DEBUG_ERROR("Dynamic index upload too large");
-				return nullptr;
-			}
+			lodVertices += vertexCounts[i];
+			lodIndices += indexCounts[i];
 		}
 
-		// Create mesh
-		D3D12DynamicMesh* mesh = sceneDynamicMeshPool.insert(boundingSphere);
-		if(!mesh) return nullptr;
+		// Streamed meshes only need their least detailed LOD up front
+		const uint32_t firstLOD = streamed ? lodCount - 1 : 0;
 
 		// Make all allocations
 		bool failedAlloc = false;
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			auto vertexAlloc = sceneDynamicVertexAllocator.allocate(vertexCounts[i] * sizeof(DynamicVertex));
+		for(uint32_t i = firstLOD; i < lodCount; ++i) {
+			auto vertexAlloc = sceneDynamicVertexAllocator.allocate(mesh->lodVertexSizes[i]);
 			if(!vertexAlloc) {
 				failedAlloc = true;
 				break;
 			}
 
-			auto indexAlloc = sceneDynamicIndexAllocator.allocate(indexCounts[i] * sizeof(index_type));
+			bool index16;
+			auto indexAlloc = allocateLODIndices(sceneDynamicIndexAllocator, sceneDynamicIndex16Allocator, mesh->lodIndexSizes[i], mesh->lodIndex16[i], index16);
 			if(!indexAlloc) {
 				failedAlloc = true;
 				sceneDynamicVertexAllocator.free(vertexAlloc);
 				break;
 			}
 
-			mesh->lods[i].emplace(vertexAlloc.value(), indexAlloc.value());
+			mesh->lods[i].emplace(vertexAlloc.value(), indexAlloc.value(), index16);
 		}
 
 		// Cleanup
@@ -3425,7 +4434,7 @@ namespace RIN {
 			for(uint32_t i = 0; i < lodCount; ++i) {
 				if(mesh->lods[i]) {
 					sceneDynamicVertexAllocator.free(mesh->lods[i]->vertexAlloc);
-					sceneDynamicIndexAllocator.free(mesh->lods[i]->indexAlloc);
+					(mesh->lods[i]->index16 ? sceneDynamicIndex16Allocator : sceneDynamicIndexAllocator).free(mesh->lods[i]->indexAlloc);
 				}
 			}
 
@@ -3436,63 +4445,13 @@ namespace RIN {
 
 		// Critical section
 		std::lock_guard<std::mutex> lock(uploadStreamMutex);
+		uploadStreamQueue.beginBatch(priority);
 
-		const DynamicVertex* lodVertices = vertices;
-		const index_type* lodIndices = indices;
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			FreeListAllocator::Allocation vertexAlloc = mesh->lods[i]->vertexAlloc;
-			FreeListAllocator::Allocation indexAlloc = mesh->lods[i]->indexAlloc;
-
-			// Enqueue vertex upload
-			uploadStreamQueue.push(
-				{
-					[this, vertexAlloc, lodVertices](ID3D12GraphicsCommandList* commandList) {
-						auto uploadAlloc = uploadStreamAllocator.allocate(vertexAlloc.size);
-						if(!uploadAlloc) RIN_ERROR("Upload dynamic vertices anomaly: out of upload stream space");
-
-						commandList->CopyBufferRegion(
-							sceneDynamicVertexBuffer,
-							vertexAlloc.start,
-							uploadBuffer,
-							uploadStreamOffset + uploadAlloc->start,
-							vertexAlloc.size
-						);
-
-						memcpy(uploadBufferData + uploadStreamOffset + uploadAlloc->start, lodVertices, vertexAlloc.size);
-					},
-					vertexAlloc.size,
-					COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX
-				}
-			);
+		// Enqueue uploads from the least detailed LOD up so that objects can be drawn early
+		for(uint32_t i = lodCount; i-- > firstLOD;)
+			enqueueMeshLODUpload(mesh, i, sceneDynamicVertexBuffer, sceneDynamicIndexBuffer, sceneDynamicIndexAllocator.getSize(), COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX, COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX);
 
-			// Enqueue index upload
-			bool finalUpload = i == lodCount - 1;
-			uploadStreamQueue.push(
-				{
-					[this, indexAlloc, lodIndices, finalUpload, mesh](ID3D12GraphicsCommandList* commandList) {
-						auto uploadAlloc = uploadStreamAllocator.allocate(indexAlloc.size);
-						if(!uploadAlloc) RIN_ERROR("Upload dynamic indices anomaly: out of upload stream space");
-
-						commandList->CopyBufferRegion(
-							sceneDynamicIndexBuffer,
-							indexAlloc.start,
-							uploadBuffer,
-							uploadStreamOffset + uploadAlloc->start,
-							indexAlloc.size
-						);
-
-						memcpy(uploadBufferData + uploadStreamOffset + uploadAlloc->start, lodIndices, indexAlloc.size);
-
-						if(finalUpload) mesh->_resident = true;
-					},
-					indexAlloc.size,
-					COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX
-				}
-			);
-
-			lodVertices += vertexCounts[i];
-			lodIndices += indexCounts[i];
-		}
+		if(onResident) enqueueResidencyCallback(std::move(onResident));
 
 		return mesh;
 	}
@@ -3505,7 +4464,7 @@ namespace RIN {
 		for(uint32_t i = 0; i < LOD_COUNT; ++i) {
 			if(mesh->lods[i]) {
 				sceneDynamicVertexAllocator.free(mesh->lods[i]->vertexAlloc);
-				sceneDynamicIndexAllocator.free(mesh->lods[i]->indexAlloc);
+				(mesh->lods[i]->index16 ? sceneDynamicIndex16Allocator : sceneDynamicIndexAllocator).free(mesh->lods[i]->indexAlloc);
 			}
 		}
 
@@ -3514,7 +4473,7 @@ namespace RIN {
 		sceneDynamicMeshPool.remove(mesh);
 	}
 
-	DynamicObject* D3D12Renderer::addDynamicObject(DynamicMesh* mesh, Material* material) {
+	DynamicObject* D3D12Renderer::addDynamicObject(DynamicMesh* mesh, Material* material, residency_callback_type onResident) {
 		if(!mesh || !material) return nullptr;
 
 		DynamicObject* object = sceneDynamicObjectPool.insert(mesh, material);
@@ -3522,22 +4481,43 @@ namespace RIN {
 		
 		object->_resident = true;
 
+		// Dynamic objects are written every update, so there is nothing to wait for
+		if(onResident) {
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadResidencyMutex);
+
+			uploadResidencyCallbacks.push_back(std::move(onResident));
+		}
+
 		return object;
 	}
 
 	void D3D12Renderer::removeDynamicObject(DynamicObject* object) {
 		if(!object) return;
 
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(sceneDynamicObjectMutex);
+
+			// The slot is hidden on the next update unless it is reused by then
+			sceneDynamicObjectRemovals.push_back(sceneDynamicObjectPool.getIndex(object));
+		}
+
 		sceneDynamicObjectPool.remove(object);
 	}
 
 	SkinnedMesh* D3D12Renderer::addSkinnedMesh(
 		const BoundingSphere& boundingSphere,
+		const DirectX::XMFLOAT4* boneSpheres,
+		uint32_t boneCount,
 		const SkinnedVertex* vertices,
 		const uint32_t* vertexCounts,
 		const index_type* indices,
 		const uint32_t* indexCounts,
-		uint32_t lodCount
+		uint32_t lodCount,
+		residency_callback_type onResident,
+		float priority,
+		bool streamed
 	) {
 		// Validation
 		if(!lodCount) RIN_ERROR("LOD count must not be 0");
@@ -3549,43 +4529,53 @@ namespace RIN {
 
 		for(uint32_t i = 0; i < lodCount; ++i) {
 			if(!vertexCounts[i]) RIN_ERROR("Vertex count must not be 0");
-
-			if(vertexCounts[i] * sizeof(SkinnedVertex) > config.uploadStreamSize) {
-				RIN_DEBUG_ERROR("Skinned vertex upload too large");
-				return nullptr;
-			}
+			if(!indexCounts[i]) RIN_ERROR("Index count must not be 0");
 		}
 
+		// Create mesh
+		D3D12SkinnedMesh* mesh = sceneSkinnedMeshPool.insert(boundingSphere, lodCount, boneCount ? boneCount : 1);
+		if(!mesh) return nullptr;
+
+		mesh->streamed = streamed;
+
+		if(boneCount) std::copy(boneSpheres, boneSpheres + boneCount, mesh->boneSpheres.get());
+		else mesh->boneSpheres[0] = { boundingSphere.center.x, boundingSphere.center.y, boundingSphere.center.z, boundingSphere.radius };
+
+		const SkinnedVertex* lodVertices = vertices;
+		const index_type* lodIndices = indices;
 		for(uint32_t i = 0; i < lodCount; ++i) {
-			if(!indexCounts[i]) RIN_ERROR("Index count must not be 0");
+			mesh->lodVertices[i] = (const char*)lodVertices;
+			mesh->lodIndices[i] = (const char*)lodIndices;
+			mesh->lodVertexSizes[i] = vertexCounts[i] * sizeof(SkinnedVertex);
+			mesh->lodIndexSizes[i] = indexCounts[i] * sizeof(index_type);
+			// Narrowing indices in reserved upload memory would read from it
+			mesh->lodIndex16[i] = vertexCounts[i] <= INDEX16_VERTEX_COUNT && !isUploadReserved((const char*)lodIndices);
 
-			if(indexCounts[i] * sizeof(index_type) > config.uploadStreamSize) {
-				RIN_DEBUG_ERROR("Skinned index upload too large");
-				return nullptr;
-			}
+			lodVertices += vertexCounts[i];
+			lodIndices += indexCounts[i];
 		}
 
-		// Create mesh
-		D3D12SkinnedMesh* mesh = sceneSkinnedMeshPool.insert(boundingSphere);
-		if(!mesh) return nullptr;
+		// Streamed meshes only need their least detailed LOD up front
+		const uint32_t firstLOD = streamed ? lodCount - 1 : 0;
 
 		// Make all allocations
 		bool failedAlloc = false;
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			auto vertexAlloc = sceneSkinnedVertexAllocator.allocate(vertexCounts[i] * sizeof(SkinnedVertex));
+		for(uint32_t i = firstLOD; i < lodCount; ++i) {
+			auto vertexAlloc = sceneSkinnedVertexAllocator.allocate(mesh->lodVertexSizes[i]);
 			if(!vertexAlloc) {
 				failedAlloc = true;
 				break;
 			}
 
-			auto indexAlloc = sceneSkinnedIndexAllocator.allocate(indexCounts[i] * sizeof(index_type));
+			bool index16;
+			auto indexAlloc = allocateLODIndices(sceneSkinnedIndexAllocator, sceneSkinnedIndex16Allocator, mesh->lodIndexSizes[i], mesh->lodIndex16[i], index16);
 			if(!indexAlloc) {
 				failedAlloc = true;
 				sceneSkinnedVertexAllocator.free(vertexAlloc);
 				break;
 			}
 
-			mesh->lods[i].emplace(vertexAlloc.value(), indexAlloc.value());
+			mesh->lods[i].emplace(vertexAlloc.value(), indexAlloc.value(), index16);
 		}
 
 		// Cleanup
@@ -3593,7 +4583,7 @@ namespace RIN {
 			for(uint32_t i = 0; i < lodCount; ++i) {
 				if(mesh->lods[i]) {
 					sceneSkinnedVertexAllocator.free(mesh->lods[i]->vertexAlloc);
-					sceneSkinnedIndexAllocator.free(mesh->lods[i]->indexAlloc);
+					(mesh->lods[i]->index16 ? sceneSkinnedIndex16Allocator : sceneSkinnedIndexAllocator).free(mesh->lods[i]->indexAlloc);
 				}
 			}
 
@@ -3604,63 +4594,13 @@ namespace RIN {
 
 		// Critical section
 		std::lock_guard<std::mutex> lock(uploadStreamMutex);
+		uploadStreamQueue.beginBatch(priority);
 
-		const SkinnedVertex* lodVertices = vertices;
-		const index_type* lodIndices = indices;
-		for(uint32_t i = 0; i < lodCount; ++i) {
-			FreeListAllocator::Allocation vertexAlloc = mesh->lods[i]->vertexAlloc;
-			FreeListAllocator::Allocation indexAlloc = mesh->lods[i]->indexAlloc;
-
-			// Enqueue vertex upload
-			uploadStreamQueue.push(
-				{
-					[this, vertexAlloc, lodVertices](ID3D12GraphicsCommandList* commandList) {
-						auto uploadAlloc = uploadStreamAllocator.allocate(vertexAlloc.size);
-						if(!uploadAlloc) RIN_ERROR("Upload skinned vertices anomaly: out of upload stream space");
-
-						commandList->CopyBufferRegion(
-							sceneSkinnedVertexBuffer,
-							vertexAlloc.start,
-							uploadBuffer,
-							uploadStreamOffset + uploadAlloc->start,
-							vertexAlloc.size
-						);
-
-						memcpy(uploadBufferData + uploadStreamOffset + uploadAlloc->start, lodVertices, vertexAlloc.size);
-					},
-					vertexAlloc.size,
-					COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX
-				}
-			);
-
-			// Enqueue index upload
-			bool finalUpload = i == lodCount - 1;
-			uploadStreamQueue.push(
-				{
-					[this, indexAlloc, lodIndices, finalUpload, mesh](ID3D12GraphicsCommandList* commandList) {
-						auto uploadAlloc = uploadStreamAllocator.allocate(indexAlloc.size);
-						if(!uploadAlloc) RIN_ERROR("Upload skinned indices anomaly: out of upload stream space");
-
-						commandList->CopyBufferRegion(
-							sceneSkinnedIndexBuffer,
-							indexAlloc.start,
-							uploadBuffer,
-							uploadStreamOffset + uploadAlloc->start,
-							indexAlloc.size
-						);
-
-						memcpy(uploadBufferData + uploadStreamOffset + uploadAlloc->start, lodIndices, indexAlloc.size);
-
-						if(finalUpload) mesh->_resident = true;
-					},
-					indexAlloc.size,
-					COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX
-				}
-			);
+		// Enqueue uploads from the least detailed LOD up so that objects can be drawn early
+		for(uint32_t i = lodCount; i-- > firstLOD;)
+			enqueueMeshLODUpload(mesh, i, sceneSkinnedVertexBuffer, sceneSkinnedIndexBuffer, sceneSkinnedIndexAllocator.getSize(), COPY_QUEUE_DYNAMIC_SKINNED_VB_STATIC_IB_INDEX, COPY_QUEUE_STATIC_VB_DYNAMIC_SKINNED_IB_INDEX);
 
-			lodVertices += vertexCounts[i];
-			lodIndices += indexCounts[i];
-		}
+		if(onResident) enqueueResidencyCallback(std::move(onResident));
 
 		return mesh;
 	}
@@ -3673,7 +4613,7 @@ namespace RIN {
 		for(uint32_t i = 0; i < LOD_COUNT; ++i) {
 			if(mesh->lods[i]) {
 				sceneSkinnedVertexAllocator.free(mesh->lods[i]->vertexAlloc);
-				sceneSkinnedIndexAllocator.free(mesh->lods[i]->indexAlloc);
+				(mesh->lods[i]->index16 ? sceneSkinnedIndex16Allocator : sceneSkinnedIndexAllocator).free(mesh->lods[i]->indexAlloc);
 			}
 		}
 
@@ -3682,112 +4622,47 @@ namespace RIN {
 		sceneSkinnedMeshPool.remove(mesh);
 	}
 
-	SkinnedObject* D3D12Renderer::addSkinnedObject(SkinnedMesh* mesh, Armature* armature, Material* material) {
-		if(!mesh || !armature || !material) return nullptr;
-
-		SkinnedObject* object = sceneSkinnedObjectPool.insert(mesh, armature, material);
-
-		updateSkinnedObject(object);
-
-		return object;
-	}
-
-	void D3D12Renderer::removeSkinnedObject(SkinnedObject* object) {
-		if(!object) return;
-
-		{
-			// Critical section
-			std::lock_guard<std::mutex> lock(uploadStreamMutex);
-
-			// Enqueue object removal
-			uploadStreamQueue.push(
-				{
-					[this, object](ID3D12GraphicsCommandList* commandList) {
-						// Zero the object out
-						commandList->CopyBufferRegion(
-							sceneSkinnedObjectBuffer,
-							sceneSkinnedObjectPool.getIndex(object) * sizeof(D3D12SkinnedObjectData),
-							sceneZeroBuffer,
-							0,
-							sizeof(D3D12SkinnedObjectData)
-						);
-					},
-					0,
-					COPY_QUEUE_CAMERA_STATIC_DYNAMIC_SKINNED_OB_LB_INDEX
-				}
-			);
-		}
-
-		// Need to remove from the pool only after pushing to the queue
-		// so that if any other thread claims the object in the same spot
-		// any updates to its data on the GPU are serialized after the remove
-		sceneSkinnedObjectPool.remove(object);
-	}
-
-	void D3D12Renderer::updateSkinnedObject(SkinnedObject* object) {
-		if(!object) return;
-
-		// Enter critical section
-		std::lock_guard<std::mutex> lock(uploadStreamMutex);
-
-		// Enqueue object upload
-		uploadStreamQueue.push(
-			{
-				[this, object](ID3D12GraphicsCommandList* commandList) {
-					auto uploadAlloc = uploadStreamAllocator.allocate(sizeof(D3D12SkinnedObjectData));
-					if(!uploadAlloc) RIN_ERROR("Upload skinned object anomaly: out of upload stream space");
+	SkinnedObject* D3D12Renderer::addSkinnedObject(SkinnedMesh* mesh, Armature* armature, Material* material, residency_callback_type onResident) {
+		if(!mesh || !armature || !material) return nullptr;
 
-					commandList->CopyBufferRegion(
-						sceneSkinnedObjectBuffer,
-						sceneSkinnedObjectPool.getIndex(object) * sizeof(D3D12SkinnedObjectData),
-						uploadBuffer,
-						uploadStreamOffset + uploadAlloc->start,
-						sizeof(D3D12SkinnedObjectData)
-					);
+		SkinnedObject* object = sceneSkinnedObjectPool.insert(mesh, armature, material);
+		if(!object) return nullptr;
 
-					D3D12SkinnedObjectData* objectData = (D3D12SkinnedObjectData*)(uploadBufferData + uploadStreamOffset + uploadAlloc->start);
+		object->_resident = true;
 
-					// The mesh will always be this derived type
-					D3D12SkinnedMesh* objectMesh = (D3D12SkinnedMesh*)object->mesh;
+		// Skinned objects are written every update, so there is nothing to wait for
+		if(onResident) {
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadResidencyMutex);
 
-					objectData->boundingSphere.center = objectMesh->boundingSphere.center;
-					objectData->boundingSphere.radius = objectMesh->boundingSphere.radius;
+			uploadResidencyCallbacks.push_back(std::move(onResident));
+		}
 
-					// All guaranteed to have at least lod 0
-					D3D12SkinnedMesh::LOD lod = objectMesh->lods[0].value();
-					// Populate LOD data
-					for(uint32_t i = 0; i < LOD_COUNT; ++i) {
-						if(i && objectMesh->lods[i]) lod = objectMesh->lods[i].value();
+		return object;
+	}
 
-						objectData->lods[i].startIndex = (uint32_t)(lod.indexAlloc.start / sizeof(index_type));
-						objectData->lods[i].indexCount = (uint32_t)(lod.indexAlloc.size / sizeof(index_type));
-						objectData->lods[i].vertexOffset = (uint32_t)(lod.vertexAlloc.start / sizeof(SkinnedVertex));
-					}
+	void D3D12Renderer::removeSkinnedObject(SkinnedObject* object) {
+		if(!object) return;
 
-					Material* material = object->material;
-					// The textures will always be this derived type
-					objectData->material.baseColorID = sceneTexturePool.getIndex((D3D12Texture*)material->baseColor);
-					objectData->material.normalID = sceneTexturePool.getIndex((D3D12Texture*)material->normal);
-					objectData->material.roughnessAOID = sceneTexturePool.getIndex((D3D12Texture*)material->roughnessAO);
-					if(material->metallic) objectData->material.metallicID = sceneTexturePool.getIndex((D3D12Texture*)material->metallic);
-					objectData->material.heightID = sceneTexturePool.getIndex((D3D12Texture*)material->height);
-					if(material->special) objectData->material.specialID = sceneTexturePool.getIndex((D3D12Texture*)material->special);
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(sceneSkinnedObjectMutex);
+
+			// The slot is hidden on the next update unless it is reused by then
+			sceneSkinnedObjectRemovals.push_back(sceneSkinnedObjectPool.getIndex(object));
+		}
 
-					// The armature will always be this derived type
-					objectData->boneIndex = (uint32_t)((D3D12Armature*)object->armature)->boneAlloc.start;
+		sceneSkinnedObjectPool.remove(object);
+	}
 
-					objectData->flags.show = 1;
-					objectData->flags.materialType = (uint32_t)material->type;
+	void D3D12Renderer::updateSkinnedObject(SkinnedObject* object) {
+		if(!object) return;
 
-					object->_resident = true;
-				},
-				sizeof(D3D12SkinnedObjectData),
-				COPY_QUEUE_CAMERA_STATIC_DYNAMIC_SKINNED_OB_LB_INDEX
-			}
-		);
+		// Rewritten on the next update along with the objects whose bounds moved
+		object->dirty = true;
 	}
 
-	Armature* D3D12Renderer::addArmature(uint8_t boneCount) {
+	Armature* D3D12Renderer::addArmature(uint8_t boneCount, residency_callback_type onResident) {
 		auto boneAlloc = sceneBoneAllocator.allocate(boneCount);
 		if(!boneAlloc) return nullptr;
 
@@ -3797,8 +4672,20 @@ namespace RIN {
 			return nullptr;
 		}
 
+		// Bones mark the armature dirty when they are changed
+		for(uint32_t i = 0; i < boneCount; ++i)
+			armature->bones[i].armatureDirty = &armature->dirty;
+
 		armature->_resident = true;
 
+		// Bones are written every update, so there is nothing to wait for
+		if(onResident) {
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadResidencyMutex);
+
+			uploadResidencyCallbacks.push_back(std::move(onResident));
+		}
+
 		return armature;
 	}
 
@@ -3820,12 +4707,22 @@ namespace RIN {
 		uint32_t width,
 		uint32_t height,
 		uint32_t mipCount,
-		const char* textureData
+		const char* textureData,
+		residency_callback_type onResident,
+		float priority,
+		bool compress
 	) {
 		// Validation
 		if(!width) RIN_ERROR("Texture width cannot be 0");
 		if(!height) RIN_ERROR("Texture height cannot be 0");
 		if(!mipCount) RIN_ERROR("Texture MIP count cannot be 0");
+
+		// Rows are repitched while staging, which would read back upload memory
+		const char* reserveData = uploadBufferData + uploadReserveOffset;
+		if(textureData >= reserveData && textureData < reserveData + config.uploadReserveSize) {
+			RIN_DEBUG_ERROR("Textures cannot be uploaded from reserved upload memory");
+			return nullptr;
+		}
 		
 		// It seems that _Ceiling_of_log_2(1) returns 1 instead of 0, so this is a workaround
 		uint32_t maxDim = std::max(width, height);
@@ -3842,6 +4739,28 @@ namespace RIN {
 			break;
 		}
 
+		// The compressed copy is owned by the upload chunks, so it is freed once the last one is recorded
+		std::shared_ptr<const char[]> compressedData;
+		const TEXTURE_FORMAT compressedFormat = getCompressedFormat(format);
+		const bool compressed = compress && compressedFormat != format;
+		// The top mip of a block compressed texture must be a whole number of blocks
+		if(compressed && (width % Texture::getBlockWidth(compressedFormat) || height % Texture::getBlockWidth(compressedFormat)))
+			RIN_ERROR("Compressed texture width and height must be multiples of the block size");
+		if(compressed) {
+			char* data = new char[Texture::getSize(width, height, arraySize, mipCount, compressedFormat)];
+			compressedData.reset(data);
+			compressTexture(threadPool, format, compressedFormat, width, height, arraySize, mipCount, textureData, data);
+
+			format = compressedFormat;
+			textureData = data;
+		}
+
+		std::vector<UploadChunker::TextureChunk> chunks = uploadStreamChunker.chunkTexture(format, width, height, arraySize, mipCount);
+		if(chunks.empty()) {
+			RIN_DEBUG_ERROR("Texture row too large for the upload stream");
+			return nullptr;
+		}
+
 		// Get allocation info
 		DXGI_FORMAT dxgiFormat = getFormat(format);
 
@@ -3908,71 +4827,119 @@ namespace RIN {
 		
 		// Critical section
 		std::lock_guard<std::mutex> lock(uploadStreamMutex);
+		uploadStreamQueue.beginBatch(priority);
 
 		// Enqueue texture upload
-		uploadStreamQueue.push(
-			{
-				[this, format, width, height, arraySize, mipCount, textureData, alignedTextureSize, texture, resource, dxgiFormat](ID3D12GraphicsCommandList* commandList) mutable {
-					// Texture data must be aligned, so allocate extra space to ensure we can align it
-					auto uploadAlloc = uploadStreamAllocator.allocate(alignedTextureSize + D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
-					if(!uploadAlloc) RIN_ERROR("Upload texture anomaly: out of upload stream space");
-
-					uint64_t alignedStart = ALIGN_TO(uploadStreamOffset + uploadAlloc->start, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
-
-					char* alignedData = uploadBufferData + alignedStart;
-
-					D3D12_TEXTURE_COPY_LOCATION copyDest{};
-					copyDest.pResource = resource;
-					copyDest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
-					copyDest.SubresourceIndex = 0;
-
-					D3D12_TEXTURE_COPY_LOCATION copySrc{};
-					copySrc.pResource = uploadBuffer;
-					copySrc.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
-					copySrc.PlacedFootprint.Offset = alignedStart;
-					copySrc.PlacedFootprint.Footprint.Format = dxgiFormat;
-					copySrc.PlacedFootprint.Footprint.Depth = 1;
-
-					uint32_t blockWidth = Texture::getBlockWidth(format);
-					uint32_t blockHeight = Texture::getBlockHeight(format);
-
-					for(uint16_t slice = 0; slice < arraySize; ++slice) {
-						for(uint32_t mip = 0; mip < mipCount; ++mip) {
-							uint32_t sliceWidth = std::max(width >> mip, (uint32_t)1);
-							uint32_t sliceHeight = std::max(height >> mip, (uint32_t)1);
-							uint64_t pitch = Texture::getRowPitch(sliceWidth, format);
-							uint64_t alignedPitch = ALIGN_TO(pitch, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
-							uint64_t rowCount = Texture::getRowCount(sliceHeight, format);
-							uint64_t mipSize = alignedPitch * rowCount;
+		enqueueTextureUpload(resource, dxgiFormat, textureData, chunks, &texture->_resident, std::move(compressedData));
 
-							// Upload
-							copySrc.PlacedFootprint.Footprint.Width = ALIGN_TO(sliceWidth, blockWidth);
-							copySrc.PlacedFootprint.Footprint.Height = ALIGN_TO(sliceHeight, blockHeight);
-							copySrc.PlacedFootprint.Footprint.RowPitch = (uint32_t)alignedPitch;
+		if(onResident) enqueueResidencyCallback(std::move(onResident));
 
-							commandList->CopyTextureRegion(&copyDest, 0, 0, 0, &copySrc, nullptr);
+		return texture;
+	}
+
+	Texture* D3D12Renderer::addStreamedTexture(
+		TEXTURE_FORMAT format,
+		uint32_t width,
+		uint32_t height,
+		uint32_t mipCount,
+		const char* textureData,
+		residency_callback_type onResident
+	) {
+		// Validation
+		if(!width) RIN_ERROR("Texture width cannot be 0");
+		if(!height) RIN_ERROR("Texture height cannot be 0");
+		if(!mipCount) RIN_ERROR("Texture MIP count cannot be 0");
 
-							++copyDest.SubresourceIndex;
+		// It seems that _Ceiling_of_log_2(1) returns 1 instead of 0, so this is a workaround
+		uint32_t maxDim = std::max(width, height);
+		if(maxDim == 1) mipCount = 1;
+		else mipCount = std::min(mipCount, (uint32_t)std::_Ceiling_of_log_2(maxDim) + 1);
 
-							copySrc.PlacedFootprint.Offset += ALIGN_TO(mipSize, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+		// Streamed mips start their own resources, which must be a whole number of blocks
+		if(width % Texture::getBlockWidth(format) || height % Texture::getBlockHeight(format)) RIN_ERROR("Streamed texture width and height must be multiples of the block size");
 
-							// Copy
-							for(uint32_t row = 0; row < rowCount; ++row) {
-								memcpy(alignedData, textureData, pitch);
-								alignedData += alignedPitch;
-								textureData += pitch;
-							}
+		// Every mip must be able to stream in later
+		if(uploadStreamChunker.chunkTexture(format, width, height, 1, 1).empty()) {
+			RIN_DEBUG_ERROR("Texture row too large for the upload stream");
+			return nullptr;
+		}
 
-							alignedData += mipSize % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT;
-						}
-					}
+		const uint32_t tailMip = sceneTextureStreamer.getTailMip(format, width, height, mipCount);
+		const uint32_t tailWidth = std::max(width >> tailMip, (uint32_t)1);
+		const uint32_t tailHeight = std::max(height >> tailMip, (uint32_t)1);
+		std::vector<UploadChunker::TextureChunk> chunks = uploadStreamChunker.chunkTexture(format, tailWidth, tailHeight, 1, mipCount - tailMip);
 
-					texture->_resident = true;
-				},
-				alignedTextureSize,
-				COPY_QUEUE_TEXTURE_INDEX
-			}
+		// Get allocation info
+		DXGI_FORMAT dxgiFormat = getFormat(format);
+
+		D3D12_RESOURCE_DESC resourceDesc{};
+		resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+		resourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+		resourceDesc.Width = tailWidth;
+		resourceDesc.Height = tailHeight;
+		resourceDesc.DepthOrArraySize = 1;
+		resourceDesc.MipLevels = mipCount - tailMip;
+		resourceDesc.Format = dxgiFormat;
+		resourceDesc.SampleDesc.Count = 1;
+		resourceDesc.SampleDesc.Quality = 0;
+		resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+		resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+
+		D3D12_RESOURCE_ALLOCATION_INFO heapInfo = device->GetResourceAllocationInfo(0, 1, &resourceDesc);
+
+		// Make allocation
+		auto textureAlloc = sceneTextureAllocator.allocate(heapInfo.SizeInBytes);
+		if(!textureAlloc) return nullptr;
+
+		// Create texture
+		ID3D12Resource* resource;
+		HRESULT result = device->CreatePlacedResource(
+			sceneTextureHeap,
+			sceneTextureOffset + textureAlloc->start,
+			&resourceDesc,
+			D3D12_RESOURCE_STATE_COMMON,
+			nullptr,
+			IID_PPV_ARGS(&resource)
 		);
+		if(FAILED(result)) RIN_ERROR("Failed to create texture");
+
+		D3D12Texture* texture = sceneTexturePool.insert(TEXTURE_TYPE::TEXTURE_2D, format, textureAlloc.value(), resource);
+		if(!texture) {
+			resource->Release();
+			sceneTextureAllocator.free(textureAlloc);
+			return nullptr;
+		}
+
+		texture->streamData = textureData;
+
+		// Create srv
+		D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
+		srvDesc.Format = dxgiFormat;
+		srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+		srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+		srvDesc.Texture2D.MostDetailedMip = 0;
+		srvDesc.Texture2D.MipLevels = mipCount - tailMip;
+		srvDesc.Texture2D.PlaneSlice = 0;
+		srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
+
+		device->CreateShaderResourceView(resource, &srvDesc, getSceneDescHeapCPUHandle(SCENE_TEXTURE_SRV_OFFSET + sceneTexturePool.getIndex(texture)));
+
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(sceneTextureStreamMutex);
+
+			sceneTextureStreams[sceneTexturePool.getIndex(texture)] = { width, height, mipCount, format, tailMip, tailMip, tailMip, 0, false, tailMip };
+		}
+
+		// Critical section
+		std::lock_guard<std::mutex> lock(uploadStreamMutex);
+		uploadStreamQueue.beginBatch(0.0f);
+
+		// Enqueue upload of the least detailed mips
+		const uint64_t tailOffset = TextureStreamer::getSize(format, width, height, mipCount, 0) - TextureStreamer::getSize(format, width, height, mipCount, tailMip);
+		enqueueTextureUpload(resource, dxgiFormat, textureData + tailOffset, chunks, &texture->_resident);
+
+		if(onResident) enqueueResidencyCallback(std::move(onResident));
 
 		return texture;
 	}
@@ -4032,6 +4999,7 @@ namespace RIN {
 		case TEXTURE_FORMAT::R16B16G16A16_FLOAT:
 		case TEXTURE_FORMAT::R32G32B32A32_FLOAT:
 		case TEXTURE_FORMAT::BC6H_FLOAT:
+		case TEXTURE_FORMAT::BC6H_UFLOAT:
 			break;
 		default:
 			RIN_ERROR("Invalid skybox texture format");
@@ -4041,6 +5009,7 @@ namespace RIN {
 		case TEXTURE_FORMAT::R16B16G16A16_FLOAT:
 		case TEXTURE_FORMAT::R32G32B32A32_FLOAT:
 		case TEXTURE_FORMAT::BC6H_FLOAT:
+		case TEXTURE_FORMAT::BC6H_UFLOAT:
 			break;
 		default:
 			RIN_ERROR("Invalid IBL diffuse texture format");
@@ -4050,6 +5019,7 @@ namespace RIN {
 		case TEXTURE_FORMAT::R16B16G16A16_FLOAT:
 		case TEXTURE_FORMAT::R32G32B32A32_FLOAT:
 		case TEXTURE_FORMAT::BC6H_FLOAT:
+		case TEXTURE_FORMAT::BC6H_UFLOAT:
 			break;
 		default:
 			RIN_ERROR("Invalid IBL specular texture format");
@@ -4112,14 +5082,34 @@ namespace RIN {
 		skyboxDirty = true;
 	}
 
-	void D3D12Renderer::uploadDynamicObjectHelper(uint32_t startIndex, uint32_t endIndex) {
-		D3D12DynamicObjectData* dataStart = (D3D12DynamicObjectData*)(uploadBufferData + uploadDynamicObjectOffset);
+	void D3D12Renderer::uploadDynamicObjectHelper(uint32_t startIndex, uint32_t endIndex, std::vector<UploadScatterCopy>& copies) {
+		// Only dirty objects and removed slots are written, packed at the start of
+		// this range's upload memory, then scattered with one copy per run of slots
+		const uint64_t rangeUploadOffset = uploadDynamicObjectOffset + startIndex * sizeof(D3D12DynamicObjectData);
+		D3D12DynamicObjectData* objectData = (D3D12DynamicObjectData*)(uploadBufferData + rangeUploadOffset);
+		uint64_t runUploadOffset = rangeUploadOffset;
+		UploadCoalescer::Run run;
 
 		for(uint32_t i = startIndex; i < endIndex; ++i) {
 			DynamicObject* object = sceneDynamicObjectPool.at(i);
-			D3D12DynamicObjectData* objectData = dataStart + i;
 
-			if(object && object->resident()) {
+			// Objects which are not resident yet stay dirty until they are
+			bool write = object && object->dirty && object->resident();
+			if(!write && !sceneDynamicObjectRemoved[i]) continue;
+
+			sceneDynamicObjectRemoved[i] = false;
+
+			const uint64_t bufferOffset = i * sizeof(D3D12DynamicObjectData);
+			if(!run.append(sceneDynamicObjectBuffer, bufferOffset, sizeof(D3D12DynamicObjectData))) {
+				copies.push_back({ run.offset, runUploadOffset, run.size });
+				uploadStreamCoalescer.record(run);
+
+				runUploadOffset += run.size;
+				run = {};
+				run.append(sceneDynamicObjectBuffer, bufferOffset, sizeof(D3D12DynamicObjectData));
+			}
+
+			if(write) {
 				DirectX::XMStoreFloat4x4A(&objectData->worldMatrix, object->worldMatrix);
 				DirectX::XMStoreFloat4x4A(&objectData->invWorldMatrix, object->invWorldMatrix);
 
@@ -4129,18 +5119,12 @@ namespace RIN {
 				objectData->boundingSphere.center = mesh->boundingSphere.center;
 				objectData->boundingSphere.radius = mesh->boundingSphere.radius;
 
-				// All guaranteed to have at least lod 0
-				D3D12DynamicMesh::LOD lod = mesh->lods[0].value();
-				// Populate LOD data
-				for(uint32_t i = 0; i < LOD_COUNT; ++i) {
-					if(i && mesh->lods[i]) lod = mesh->lods[i].value();
+				Material* material = object->material;
 
-					objectData->lods[i].startIndex = (uint32_t)(lod.indexAlloc.start / sizeof(index_type));
-					objectData->lods[i].indexCount = (uint32_t)(lod.indexAlloc.size / sizeof(index_type));
-					objectData->lods[i].vertexOffset = (uint32_t)(lod.vertexAlloc.start / sizeof(DynamicVertex));
-				}
+				// Populate LOD data, objects are hidden until a LOD of their mesh and their textures are resident
+				uint32_t index16;
+				bool show = getLODData(mesh->lods, sizeof(DynamicVertex), objectData->lods, index16) && material->resident();
 
-				Material* material = object->material;
 				// The textures will always be this derived type
 				objectData->material.baseColorID = sceneTexturePool.getIndex((D3D12Texture*)material->baseColor);
 				objectData->material.normalID = sceneTexturePool.getIndex((D3D12Texture*)material->normal);
@@ -4149,21 +5133,157 @@ namespace RIN {
 				objectData->material.heightID = sceneTexturePool.getIndex((D3D12Texture*)material->height);
 				if(material->special) objectData->material.specialID = sceneTexturePool.getIndex((D3D12Texture*)material->special);
 
-				objectData->flags.show = 1;
+				objectData->flags.show = show;
+				objectData->flags.index16 = index16;
 				objectData->flags.materialType = (uint32_t)material->type;
+
+				object->dirty = false;
 			} else objectData->flags.data = 0;
+
+			++objectData;
+		}
+
+		if(run.requestCount) {
+			copies.push_back({ run.offset, runUploadOffset, run.size });
+			uploadStreamCoalescer.record(run);
+		}
+	}
+
+	void D3D12Renderer::writeSkinnedObjectData(SkinnedObject* object, D3D12SkinnedObjectData* objectData) {
+		// The mesh will always be this derived type
+		D3D12SkinnedMesh* mesh = (D3D12SkinnedMesh*)object->mesh;
+
+		// Already in world space, so the cull pass does not need the bones
+		objectData->boundingSphere.center = { object->boundingSphere.x, object->boundingSphere.y, object->boundingSphere.z };
+		objectData->boundingSphere.radius = object->boundingSphere.w;
+
+		Material* material = object->material;
+
+		// Populate LOD data, objects are hidden until a LOD of their mesh and their textures are resident
+		uint32_t index16;
+		bool show = getLODData(mesh->lods, sizeof(SkinnedVertex), objectData->lods, index16) && material->resident();
+
+		// The textures will always be this derived type
+		objectData->material.baseColorID = sceneTexturePool.getIndex((D3D12Texture*)material->baseColor);
+		objectData->material.normalID = sceneTexturePool.getIndex((D3D12Texture*)material->normal);
+		objectData->material.roughnessAOID = sceneTexturePool.getIndex((D3D12Texture*)material->roughnessAO);
+		if(material->metallic) objectData->material.metallicID = sceneTexturePool.getIndex((D3D12Texture*)material->metallic);
+		objectData->material.heightID = sceneTexturePool.getIndex((D3D12Texture*)material->height);
+		if(material->special) objectData->material.specialID = sceneTexturePool.getIndex((D3D12Texture*)material->special);
+
+		// The armature will always be this derived type
+		objectData->boneIndex = (uint32_t)((D3D12Armature*)object->armature)->boneAlloc.start;
+
+		objectData->flags.show = show;
+		objectData->flags.index16 = index16;
+		objectData->flags.materialType = (uint32_t)material->type;
+	}
+
+	bool D3D12Renderer::updateSkinnedObjectBounds(SkinnedObject* object) {
+		// The mesh and armature will always be these derived types
+		D3D12SkinnedMesh* mesh = (D3D12SkinnedMesh*)object->mesh;
+		D3D12Armature* armature = (D3D12Armature*)object->armature;
+
+		// Bones the armature does not have are left out
+		const uint32_t boneCount = std::min(mesh->boneCount, (uint32_t)armature->boneAlloc.size);
+		const BoundingSphere boundingSphere = computePosedBoundingSphere(mesh->boneSpheres.get(), boneCount, &armature->bones[0].worldMatrix, sizeof(Bone));
+
+		DirectX::XMFLOAT4& sphere = object->boundingSphere;
+		if(
+			sphere.x == boundingSphere.center.x &&
+			sphere.y == boundingSphere.center.y &&
+			sphere.z == boundingSphere.center.z &&
+			sphere.w == boundingSphere.radius
+		) return false;
+
+		sphere = { boundingSphere.center.x, boundingSphere.center.y, boundingSphere.center.z, boundingSphere.radius };
+
+		return true;
+	}
+
+	void D3D12Renderer::uploadSkinnedObjectHelper(uint32_t startIndex, uint32_t endIndex, std::vector<UploadScatterCopy>& copies) {
+		// Bounds are recomputed from the bones every update, the objects which
+		// are dirty or whose bounds moved and removed slots are packed at the
+		// start of this range's upload memory, then scattered with one copy
+		// per run of slots
+		// This is the only place skinned object data is written, so the
+		// bounds are never read while they are computed
+		const uint64_t rangeUploadOffset = uploadSkinnedObjectOffset + startIndex * sizeof(D3D12SkinnedObjectData);
+		D3D12SkinnedObjectData* objectData = (D3D12SkinnedObjectData*)(uploadBufferData + rangeUploadOffset);
+		uint64_t runUploadOffset = rangeUploadOffset;
+		UploadCoalescer::Run run;
+
+		for(uint32_t i = startIndex; i < endIndex; ++i) {
+			SkinnedObject* object = sceneSkinnedObjectPool.at(i);
+
+			// Objects which are not resident yet stay dirty until they are
+			bool write = false;
+			if(object && object->resident()) {
+				const bool moved = updateSkinnedObjectBounds(object);
+				write = object->dirty.exchange(false) || moved;
+			}
+			if(!write && !sceneSkinnedObjectRemoved[i]) continue;
+
+			sceneSkinnedObjectRemoved[i] = false;
+
+			const uint64_t bufferOffset = i * sizeof(D3D12SkinnedObjectData);
+			if(!run.append(sceneSkinnedObjectBuffer, bufferOffset, sizeof(D3D12SkinnedObjectData))) {
+				copies.push_back({ run.offset, runUploadOffset, run.size });
+				uploadStreamCoalescer.record(run);
+
+				runUploadOffset += run.size;
+				run = {};
+				run.append(sceneSkinnedObjectBuffer, bufferOffset, sizeof(D3D12SkinnedObjectData));
+			}
+
+			if(write) writeSkinnedObjectData(object, objectData);
+			else objectData->flags.data = 0;
+
+			++objectData;
+		}
+
+		if(run.requestCount) {
+			copies.push_back({ run.offset, runUploadOffset, run.size });
+			uploadStreamCoalescer.record(run);
 		}
 	}
 
-	void D3D12Renderer::uploadBoneHelper(uint32_t startIndex, uint32_t endIndex) {
+	void D3D12Renderer::uploadBoneHelper(uint32_t startIndex, uint32_t endIndex, std::vector<UploadScatterCopy>& copies) {
+		// Bones are staged at the same offsets they have in the bone buffer,
+		// only the live ranges of dirty armatures are written and copied
 		D3D12BoneData* dataStart = (D3D12BoneData*)(uploadBufferData + uploadBoneOffset);
+		UploadCoalescer::Run run;
 
 		for(uint32_t i = startIndex; i < endIndex; ++i) {
-			Bone* bone = sceneBones + i;
-			D3D12BoneData* boneData = dataStart + i;
+			D3D12Armature* armature = sceneArmaturePool.at(i);
+			if(!armature || !armature->dirty || !armature->resident()) continue;
+
+			const FreeListAllocator::Allocation& boneAlloc = armature->boneAlloc;
+			const uint64_t bufferOffset = boneAlloc.start * sizeof(D3D12BoneData);
+			const uint64_t size = boneAlloc.size * sizeof(D3D12BoneData);
+			if(!run.append(sceneBoneBuffer, bufferOffset, size)) {
+				copies.push_back({ run.offset, uploadBoneOffset + run.offset, run.size });
+				uploadStreamCoalescer.record(run);
+
+				run = {};
+				run.append(sceneBoneBuffer, bufferOffset, size);
+			}
+
+			// Clear first so that changes made while writing are not lost
+			armature->dirty = false;
+
+			for(uint64_t j = boneAlloc.start; j < boneAlloc.start + boneAlloc.size; ++j) {
+				Bone* bone = sceneBones + j;
+				D3D12BoneData* boneData = dataStart + j;
+
+				DirectX::XMStoreFloat4x4A(&boneData->worldMatrix, bone->worldMatrix);
+				DirectX::XMStoreFloat4x4A(&boneData->invWorldMatrix, bone->invWorldMatrix);
+			}
+		}
 
-			DirectX::XMStoreFloat4x4A(&boneData->worldMatrix, bone->worldMatrix);
-			DirectX::XMStoreFloat4x4A(&boneData->invWorldMatrix, bone->invWorldMatrix);
+		if(run.requestCount) {
+			copies.push_back({ run.offset, uploadBoneOffset + run.offset, run.size });
+			uploadStreamCoalescer.record(run);
 		}
 	}
 
@@ -4184,10 +5304,57 @@ namespace RIN {
 		}
 	}
 
+	std::span<char> D3D12Renderer::reserveUpload(uint64_t size) {
+		auto reserveAlloc = uploadReserveAllocator.allocate(size);
+		if(!reserveAlloc) return {};
+
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadReserveMutex);
+
+			uploadReservations.insert({ reserveAlloc->start, { reserveAlloc->size, 0, false } });
+		}
+
+		return { uploadBufferData + uploadReserveOffset + reserveAlloc->start, reserveAlloc->size };
+	}
+
+	void D3D12Renderer::commitUpload(std::span<char> upload) {
+		if(upload.empty()) return;
+
+		const uint64_t offset = upload.data() - (uploadBufferData + uploadReserveOffset);
+
+		// Critical section
+		std::lock_guard<std::mutex> lock(uploadReserveMutex);
+
+		auto it = uploadReservations.find(offset);
+		if(it == uploadReservations.end() || it->second.committed) {
+			RIN_DEBUG_ERROR("Committed upload was not reserved");
+			return;
+		}
+
+		// Freed on the next frame once the pending copies are complete
+		it->second.committed = true;
+		uploadReserveRetired.push_back(offset);
+	}
+
 	void D3D12Renderer::update() {
 		// Permit new uploads to be scheduled
 		uploadStreamAllocator.free();
 
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(uploadStreamMutex);
+
+			// Age the pending uploads so that none of them starve
+			uploadStreamQueue.nextFrame();
+		}
+
+		// Request the mips of streamed textures which are needed this frame
+		streamTextures();
+
+		// Update the objects of meshes whose LODs changed and stream LODs in and out
+		streamMeshes();
+
 		// No other thread has the mutex so this is safe
 		uploadStreamBudget = uploadStreamAllocator.getSize();
 
@@ -4227,24 +5394,6 @@ namespace RIN {
 		cameraData->clusterConstantA = sceneCamera.clusterConstantA;
 		cameraData->clusterConstantB = sceneCamera.clusterConstantB;
 
-		// Upload dynamic objects
-		uploadUpdateCommandList->CopyBufferRegion(
-			sceneDynamicObjectBuffer,
-			0,
-			uploadBuffer,
-			uploadDynamicObjectOffset,
-			config.dynamicObjectCount * sizeof(D3D12DynamicObjectData)
-		);
-
-		// Upload bones
-		uploadUpdateCommandList->CopyBufferRegion(
-			sceneBoneBuffer,
-			0,
-			uploadBuffer,
-			uploadBoneOffset,
-			config.boneCount * sizeof(D3D12BoneData)
-		);
-
 		// Upload lights
 		uploadUpdateCommandList->CopyBufferRegion(
 			sceneLightBuffer,
@@ -4257,20 +5406,64 @@ namespace RIN {
 		// Exclude the current thread to avoid an extra context switch
 		const uint32_t spareThreads = COPY_QUEUE_COUNT >= threadPool.numThreads ? 0 : threadPool.numThreads - COPY_QUEUE_COUNT - 1;
 
+		// Mark removed dynamic object slots so they are hidden
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(sceneDynamicObjectMutex);
+
+			for(uint32_t index : sceneDynamicObjectRemovals)
+				sceneDynamicObjectRemoved[index] = true;
+
+			sceneDynamicObjectRemovals.clear();
+		}
+
+		// Mark removed skinned object slots so they are hidden
+		{
+			// Critical section
+			std::lock_guard<std::mutex> lock(sceneSkinnedObjectMutex);
+
+			for(uint32_t index : sceneSkinnedObjectRemovals)
+				sceneSkinnedObjectRemoved[index] = true;
+
+			sceneSkinnedObjectRemovals.clear();
+		}
+
+		if(uploadDynamicObjectCopies.size() < spareThreads + 1)
+			uploadDynamicObjectCopies.resize(spareThreads + 1);
+
 		const uint32_t dynamicObjectStep = config.dynamicObjectCount / (spareThreads + 1);
 		uint32_t dynamicObjectStartIndex = 0;
 		for(uint32_t i = 0; i < spareThreads; ++i) {
 			const uint32_t dynamicObjectEndIndex = dynamicObjectStartIndex + dynamicObjectStep;
-			threadPool.enqueueJob([this, dynamicObjectStartIndex, dynamicObjectEndIndex]() { uploadDynamicObjectHelper(dynamicObjectStartIndex, dynamicObjectEndIndex); });
+			std::vector<UploadScatterCopy>* copies = &uploadDynamicObjectCopies[i];
+			threadPool.enqueueJob([this, dynamicObjectStartIndex, dynamicObjectEndIndex, copies]() { uploadDynamicObjectHelper(dynamicObjectStartIndex, dynamicObjectEndIndex, *copies); });
 			dynamicObjectStartIndex = dynamicObjectEndIndex;
 		}
 
-		const uint32_t boneStep = config.boneCount / (spareThreads + 1);
-		uint32_t boneStartIndex = 0;
+		if(uploadSkinnedObjectCopies.size() < spareThreads + 1)
+			uploadSkinnedObjectCopies.resize(spareThreads + 1);
+
+		// Skinned objects are bounded by the bones as they are now, so
+		// they can be split up independently of the armatures
+		const uint32_t skinnedObjectStep = config.skinnedObjectCount / (spareThreads + 1);
+		uint32_t skinnedObjectStartIndex = 0;
+		for(uint32_t i = 0; i < spareThreads; ++i) {
+			const uint32_t skinnedObjectEndIndex = skinnedObjectStartIndex + skinnedObjectStep;
+			std::vector<UploadScatterCopy>* copies = &uploadSkinnedObjectCopies[i];
+			threadPool.enqueueJob([this, skinnedObjectStartIndex, skinnedObjectEndIndex, copies]() { uploadSkinnedObjectHelper(skinnedObjectStartIndex, skinnedObjectEndIndex, *copies); });
+			skinnedObjectStartIndex = skinnedObjectEndIndex;
+		}
+
+		if(uploadBoneCopies.size() < spareThreads + 1)
+			uploadBoneCopies.resize(spareThreads + 1);
+
+		const uint32_t armatureStep = config.armatureCount / (spareThreads + 1);
+		uint32_t armatureStartIndex = 0;
 		for(uint32_t i = 0; i < spareThreads; ++i) {
-			const uint32_t boneEndIndex = boneStartIndex + boneStep;
-			threadPool.enqueueJob([this, boneStartIndex, boneEndIndex]() { uploadBoneHelper(boneStartIndex, boneEndIndex); });
-			boneStartIndex = boneEndIndex;
+			const uint32_t armatureEndIndex = armatureStartIndex + armatureStep;
+			std::vector<UploadScatterCopy>* copies = &uploadBoneCopies[i];
+			threadPool.enqueueJob([this, armatureStartIndex, armatureEndIndex, copies]() { uploadBoneHelper(armatureStartIndex, armatureEndIndex, *copies); });
+			armatureStartIndex = armatureEndIndex;
 		}
 
 		const uint32_t lightStep = config.lightCount / (spareThreads + 1);
@@ -4281,12 +5474,58 @@ namespace RIN {
 			lightStartIndex = lightEndIndex;
 		}
 
-		uploadDynamicObjectHelper(dynamicObjectStartIndex, config.dynamicObjectCount);
-		uploadBoneHelper(boneStartIndex, config.boneCount);
+		uploadDynamicObjectHelper(dynamicObjectStartIndex, config.dynamicObjectCount, uploadDynamicObjectCopies[spareThreads]);
+		uploadSkinnedObjectHelper(skinnedObjectStartIndex, config.skinnedObjectCount, uploadSkinnedObjectCopies[spareThreads]);
+		uploadBoneHelper(armatureStartIndex, config.armatureCount, uploadBoneCopies[spareThreads]);
 		uploadLightHelper(lightStartIndex, config.lightCount);
 
 		if(spareThreads) threadPool.wait();
 
+		// Scatter dynamic objects
+		for(std::vector<UploadScatterCopy>& copies : uploadDynamicObjectCopies) {
+			for(const UploadScatterCopy& copy : copies) {
+				uploadUpdateCommandList->CopyBufferRegion(
+					sceneDynamicObjectBuffer,
+					copy.bufferOffset,
+					uploadBuffer,
+					copy.uploadOffset,
+					copy.size
+				);
+			}
+
+			copies.clear();
+		}
+
+		// Scatter skinned objects
+		for(std::vector<UploadScatterCopy>& copies : uploadSkinnedObjectCopies) {
+			for(const UploadScatterCopy& copy : copies) {
+				uploadUpdateCommandList->CopyBufferRegion(
+					sceneSkinnedObjectBuffer,
+					copy.bufferOffset,
+					uploadBuffer,
+					copy.uploadOffset,
+					copy.size
+				);
+			}
+
+			copies.clear();
+		}
+
+		// Scatter bones
+		for(std::vector<UploadScatterCopy>& copies : uploadBoneCopies) {
+			for(const UploadScatterCopy& copy : copies) {
+				uploadUpdateCommandList->CopyBufferRegion(
+					sceneBoneBuffer,
+					copy.bufferOffset,
+					uploadBuffer,
+					copy.uploadOffset,
+					copy.size
+				);
+			}
+
+			copies.clear();
+		}
+
 		// Submit command list
 		result = uploadUpdateCommandList->Close();
 		if(FAILED(result)) RIN_ERROR("Failed to close upload update command list");
@@ -4296,6 +5535,10 @@ namespace RIN {
 		uploadStreamBarrier.arrive_and_wait(); // Barrier 2
 	}
 
+	UploadStats D3D12Renderer::getUploadStats() const {
+		return uploadStreamCoalescer.getStats();
+	}
+
 	void D3D12Renderer::render() {
 		HRESULT result;
 
@@ -4319,6 +5562,12 @@ namespace RIN {
 
 		// Release all of the dead textures since the previous frame is finished
 		destroyDeadTextures();
+		// Swap in streamed textures whose copies are finished
+		swapStreamedTextures();
+		// Release committed reservations whose copies are finished
+		releaseUploadReservations();
+		// Notify completed uploads
+		invokeResidencyCallbacks();
 
 		// Record commands
 		if(skyboxDirty) {
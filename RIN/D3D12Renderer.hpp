@@ -8,12 +8,18 @@
 #include <d3d12.h>
 #include <dxgi1_4.h>
 #include <barrier>
+#include <memory>
+#include <map>
 
 #include "Renderer.hpp"
 #include "Debug.hpp"
 #include "ThreadPool.hpp"
 #include "FreeListAllocator.hpp"
 #include "BumpAllocator.hpp"
+#include "UploadChunker.hpp"
+#include "UploadCoalescer.hpp"
+#include "UploadScheduler.hpp"
+#include "TextureStreamer.hpp"
 #include "Pool.hpp"
 #include "D3D12Camera.hpp"
 #include "D3D12StaticMesh.hpp"
@@ -23,6 +29,8 @@
 #include "D3D12Texture.hpp"
 
 namespace RIN {
+	struct D3D12SkinnedObjectData;
+
 	class D3D12Renderer : public Renderer {
 		friend Renderer* Renderer::create(HWND, const Config&, const Settings&);
 		friend void Renderer::destroy(Renderer*) noexcept;
@@ -34,11 +42,49 @@ namespace RIN {
 		static constexpr uint32_t COPY_QUEUE_COUNT = 4;
 
 		typedef std::function<void(ID3D12GraphicsCommandList*)> upload_stream_job_type;
+		// Writes size bytes of request data into upload memory
+		typedef std::function<void(char*)> upload_stream_write_type;
 
+		/*
+		Requests with a buffer set are buffer uploads, their data is
+		produced by write and the copy is issued by the upload stream,
+		which lets contiguous uploads to the same buffer share a copy
+		Otherwise job records the whole request
+		*/
 		struct UploadStreamRequest {
 			upload_stream_job_type job;
 			uint64_t size;
 			uint32_t copyQueueIndex;
+			upload_stream_write_type write;
+			ID3D12Resource* buffer{};
+			uint64_t bufferOffset{};
+		};
+
+		/*
+		Reserved upload memory is freed once it has been committed and
+		every copy reading from it has completed
+		*/
+		struct UploadReservation {
+			uint64_t size;
+			uint32_t pendingCopies;
+			bool committed;
+		};
+
+		typedef UploadScheduler<UploadStreamRequest> upload_stream_queue_type;
+
+		// Mips at most this large are always resident for streamed textures
+		static constexpr uint32_t TEXTURE_STREAM_TAIL_SIZE = 128;
+		// Frames a streamed mip may go unused before it is evicted
+		static constexpr uint64_t TEXTURE_STREAM_EVICT_FRAMES = 120;
+
+		// Frames an upload may wait before it is served regardless of priority
+		static constexpr uint64_t UPLOAD_STREAM_MAX_WAIT_FRAMES = 30;
+
+		// A copy from packed upload memory to a range of a buffer
+		struct UploadScatterCopy {
+			uint64_t bufferOffset;
+			uint64_t uploadOffset;
+			uint64_t size;
 		};
 
 		HWND hwnd;
@@ -89,7 +135,9 @@ namespace RIN {
 
 		NOTE:
 		It is important that no upload submission span more than
-		a single frame because large copies will delay rendering
+		a single frame because large copies will delay rendering,
+		so uploads larger than the upload stream are split into
+		chunks which are submitted over several frames
 
 		NEVER read from uploadBufferData because it points to mapped
 		memory and reads from it are extremely slow on the CPU
@@ -102,19 +150,35 @@ namespace RIN {
 		char* uploadBufferData{};
 		uint64_t uploadCameraOffset;
 		uint64_t uploadDynamicObjectOffset;
+		uint64_t uploadSkinnedObjectOffset;
 		uint64_t uploadBoneOffset;
 		uint64_t uploadLightOffset;
 		uint64_t uploadStreamOffset;
+		uint64_t uploadReserveOffset;
 		// Upload stream
 		ID3D12CommandAllocator* uploadUpdateCommandAllocator{};
 		ID3D12GraphicsCommandList* uploadUpdateCommandList{};
 		BumpAllocator uploadStreamAllocator;
+		UploadChunker uploadStreamChunker;
+		UploadCoalescer uploadStreamCoalescer;
 		std::mutex uploadStreamMutex;
 		std::barrier<> uploadStreamBarrier{ COPY_QUEUE_COUNT + 1 };
 		std::thread uploadStreamThreads[COPY_QUEUE_COUNT]{};
-		std::queue<UploadStreamRequest> uploadStreamQueue;
+		upload_stream_queue_type uploadStreamQueue{ UPLOAD_STREAM_MAX_WAIT_FRAMES };
 		uint64_t uploadStreamBudget{};
 		bool uploadStreamTerminate = false;
+		// One list per update thread
+		std::vector<std::vector<UploadScatterCopy>> uploadDynamicObjectCopies;
+		std::vector<std::vector<UploadScatterCopy>> uploadSkinnedObjectCopies;
+		std::vector<std::vector<UploadScatterCopy>> uploadBoneCopies;
+		// Upload reservations
+		FreeListAllocator uploadReserveAllocator;
+		std::mutex uploadReserveMutex;
+		std::map<uint64_t, UploadReservation> uploadReservations; // Keyed by offset in the reserve region
+		std::vector<uint64_t> uploadReserveRetired; // Reservations which might be ready to free
+		// Residency callbacks
+		std::mutex uploadResidencyMutex;
+		std::vector<residency_callback_type> uploadResidencyCallbacks; // Called on the next render()
 
 		// Scene
 		ID3D12DescriptorHeap* sceneDescHeap{};
@@ -204,8 +268,11 @@ namespace RIN {
 		D3D12_VERTEX_BUFFER_VIEW sceneDynamicVBV{};
 		D3D12_VERTEX_BUFFER_VIEW sceneSkinnedVBV{};
 		D3D12_INDEX_BUFFER_VIEW sceneStaticIBV{};
+		D3D12_INDEX_BUFFER_VIEW sceneStaticIBV16{};
 		D3D12_INDEX_BUFFER_VIEW sceneDynamicIBV{};
+		D3D12_INDEX_BUFFER_VIEW sceneDynamicIBV16{};
 		D3D12_INDEX_BUFFER_VIEW sceneSkinnedIBV{};
+		D3D12_INDEX_BUFFER_VIEW sceneSkinnedIBV16{};
 		ID3D12Heap* sceneTextureHeap{};
 		uint64_t sceneTextureOffset;
 		ID3D12Resource* sceneDFGLUT{};
@@ -214,10 +281,13 @@ namespace RIN {
 
 		FreeListAllocator sceneStaticVertexAllocator;
 		FreeListAllocator sceneStaticIndexAllocator;
+		FreeListAllocator sceneStaticIndex16Allocator; // Placed after the 32-bit indices in the index buffer
 		FreeListAllocator sceneDynamicVertexAllocator;
 		FreeListAllocator sceneDynamicIndexAllocator;
+		FreeListAllocator sceneDynamicIndex16Allocator;
 		FreeListAllocator sceneSkinnedVertexAllocator;
 		FreeListAllocator sceneSkinnedIndexAllocator;
+		FreeListAllocator sceneSkinnedIndex16Allocator;
 		FreeListAllocator sceneBoneAllocator;
 		FreeListAllocator sceneTextureAllocator;
 
@@ -226,13 +296,28 @@ namespace RIN {
 		DynamicPool<StaticObject> sceneStaticObjectPool;
 		DynamicPool<D3D12DynamicMesh> sceneDynamicMeshPool;
 		DynamicPool<DynamicObject> sceneDynamicObjectPool;
+		std::mutex sceneDynamicObjectMutex;
+		std::vector<uint32_t> sceneDynamicObjectRemovals; // Guarded by sceneDynamicObjectMutex
+		std::unique_ptr<bool[]> sceneDynamicObjectRemoved; // Slots which must be hidden on the next update
 		DynamicPool<D3D12SkinnedMesh> sceneSkinnedMeshPool;
 		DynamicPool<SkinnedObject> sceneSkinnedObjectPool;
+		std::mutex sceneSkinnedObjectMutex;
+		std::vector<uint32_t> sceneSkinnedObjectRemovals; // Guarded by sceneSkinnedObjectMutex
+		std::unique_ptr<bool[]> sceneSkinnedObjectRemoved; // Slots which must be hidden on the next update
 		DynamicPool<D3D12Armature> sceneArmaturePool;
 		DynamicPool<D3D12Texture> sceneTexturePool;
 		DynamicPool<Material> sceneMaterialPool;
 		DynamicPool<Light> sceneLightPool;
 		bool skyboxDirty = true;
+		// Texture streaming
+		TextureStreamer sceneTextureStreamer;
+		std::mutex sceneTextureStreamMutex;
+		std::unique_ptr<TextureStreamer::Entry[]> sceneTextureStreams; // Indexed like sceneTexturePool
+		std::vector<TextureStreamer::Change> sceneTextureStreamChanges;
+		uint64_t sceneTextureStreamFrame = 0;
+		// Mesh streaming
+		std::vector<std::pair<FreeListAllocator*, FreeListAllocator::Allocation>> sceneMeshLODEvictions; // Freed once no object uses them
+		std::vector<StaticObject*> sceneStaticObjectUpdates; // Rewritten in the same batch as the evictions are freed
 		Bone* sceneBones;
 
 		// Initialization
@@ -263,10 +348,85 @@ namespace RIN {
 
 		// Upload stream
 		void uploadStreamWork(uint32_t copyQueueIndex);
-		void uploadDynamicObjectHelper(uint32_t startIndex, uint32_t endIndex);
-		void uploadBoneHelper(uint32_t startIndex, uint32_t endIndex);
+		void enqueueBufferUpload(
+			ID3D12Resource* buffer,
+			uint64_t bufferOffset,
+			const char* data,
+			uint64_t size,
+			uint32_t copyQueueIndex,
+			bool* resident
+		);
+		// Narrows the indices while copying them to upload memory if index16 is set
+		void enqueueIndexUpload(
+			ID3D12Resource* buffer,
+			uint64_t bufferOffset,
+			const char* indices,
+			uint64_t indexCount,
+			bool index16,
+			uint32_t copyQueueIndex,
+			bool* resident
+		);
+		// Quantizes the static vertices while copying them to upload memory
+		void enqueueQuantizedVertexUpload(
+			ID3D12Resource* buffer,
+			uint64_t bufferOffset,
+			const char* vertices,
+			uint64_t vertexCount,
+			const BoundingSphere& boundingSphere,
+			uint32_t copyQueueIndex,
+			bool* resident
+		);
+		void uploadDynamicObjectHelper(uint32_t startIndex, uint32_t endIndex, std::vector<UploadScatterCopy>& copies);
+		void writeSkinnedObjectData(SkinnedObject* object, D3D12SkinnedObjectData* objectData);
+		// Returns false if the bounds of the object did not change
+		bool updateSkinnedObjectBounds(SkinnedObject* object);
+		void uploadSkinnedObjectHelper(uint32_t startIndex, uint32_t endIndex, std::vector<UploadScatterCopy>& copies);
+		void uploadBoneHelper(uint32_t startIndex, uint32_t endIndex, std::vector<UploadScatterCopy>& copies);
 		void uploadLightHelper(uint32_t startIndex, uint32_t endIndex);
+		void enqueueTextureUpload(
+			ID3D12Resource* resource,
+			DXGI_FORMAT dxgiFormat,
+			const char* textureData,
+			std::vector<UploadChunker::TextureChunk>& chunks,
+			bool* resident,
+			std::shared_ptr<const char[]> ownedData = nullptr
+		);
+		// Returns true if the data lies in a reservation, which is then kept
+		// alive until completeUploadReservation is called with the same data
+		bool acquireUploadReservation(const char* data, uint64_t size);
+		bool isUploadReserved(const char* data) const;
+		void completeUploadReservation(const char* data);
+		void releaseUploadReservations();
+		// Must be called from inside the upload stream critical section after
+		// every request of the upload has been enqueued in the same batch
+		void enqueueResidencyCallback(residency_callback_type onResident);
+		// Must be called from inside the upload stream critical section
+		void enqueueStaticObjectUpload(StaticObject* object);
+		void invokeResidencyCallbacks();
 		void destroyDeadTextures();
+		void streamTextures();
+		void swapStreamedTextures();
+		template<class Mesh> void enqueueMeshLODUpload(
+			Mesh* mesh,
+			uint32_t lod,
+			ID3D12Resource* vertexBuffer,
+			ID3D12Resource* indexBuffer,
+			uint64_t index16Offset,
+			uint32_t vertexCopyQueueIndex,
+			uint32_t indexCopyQueueIndex
+		);
+		template<class Mesh> void streamMeshLODs(
+			DynamicPool<Mesh>& meshPool,
+			uint32_t meshCount,
+			FreeListAllocator& vertexAllocator,
+			FreeListAllocator& indexAllocator,
+			FreeListAllocator& index16Allocator,
+			ID3D12Resource* vertexBuffer,
+			ID3D12Resource* indexBuffer,
+			uint32_t vertexCopyQueueIndex,
+			uint32_t indexCopyQueueIndex
+		);
+		void streamMeshes();
 
 		// Misc
 		D3D12_CPU_DESCRIPTOR_HANDLE getSceneDescHeapCPUHandle(uint32_t offset);
@@ -285,10 +445,14 @@ namespace RIN {
 			const uint32_t* vertexCounts,
 			const index_type* indices,
 			const uint32_t* indexCounts,
-			uint32_t lodCount
+			uint32_t lodCount,
+			residency_callback_type onResident,
+			float priority,
+			bool streamed,
+			bool sharedVertices
 		) override;
 		void removeStaticMesh(StaticMesh* mesh) override;
-		StaticObject* addStaticObject(StaticMesh* mesh, Material* material) override;
+		StaticObject* addStaticObject(StaticMesh* mesh, Material* material, residency_callback_type onResident) override;
 		void removeStaticObject(StaticObject* object) override;
 		void updateStaticObject(StaticObject* object) override;
 		DynamicMesh* addDynamicMesh(
@@ -297,24 +461,32 @@ namespace RIN {
 			const uint32_t* vertexCounts,
 			const index_type* indices,
 			const uint32_t* indexCounts,
-			uint32_t lodCount
+			uint32_t lodCount,
+			residency_callback_type onResident,
+			float priority,
+			bool streamed
 		) override;
 		void removeDynamicMesh(DynamicMesh* mesh) override;
-		DynamicObject* addDynamicObject(DynamicMesh* mesh, Material* material) override;
+		DynamicObject* addDynamicObject(DynamicMesh* mesh, Material* material, residency_callback_type onResident) override;
 		void removeDynamicObject(DynamicObject* object) override;
 		SkinnedMesh* addSkinnedMesh(
 			const BoundingSphere& boundingSphere,
+			const DirectX::XMFLOAT4* boneSpheres,
+			uint32_t boneCount,
 			const SkinnedVertex* vertices,
 			const uint32_t* vertexCounts,
 			const index_type* indices,
 			const uint32_t* indexCounts,
-			uint32_t lodCount
+			uint32_t lodCount,
+			residency_callback_type onResident,
+			float priority,
+			bool streamed
 		) override;
 		void removeSkinnedMesh(SkinnedMesh* mesh) override;
-		SkinnedObject* addSkinnedObject(SkinnedMesh* mesh, Armature* armature, Material* material) override;
+		SkinnedObject* addSkinnedObject(SkinnedMesh* mesh, Armature* armature, Material* material, residency_callback_type onResident) override;
 		void removeSkinnedObject(SkinnedObject* object) override;
 		void updateSkinnedObject(SkinnedObject* object) override;
-		Armature* addArmature(uint8_t boneCount) override;
+		Armature* addArmature(uint8_t boneCount, residency_callback_type onResident) override;
 		void removeArmature(Armature* armature) override;
 		// Setting mipCount to -1 will use the full mip chain
 		Texture* addTexture(
@@ -323,7 +495,18 @@ namespace RIN {
 			uint32_t width,
 			uint32_t height,
 			uint32_t mipCount,
-			const char* textureData
+			const char* textureData,
+			residency_callback_type onResident,
+			float priority,
+			bool compress
+		) override;
+		Texture* addStreamedTexture(
+			TEXTURE_FORMAT format,
+			uint32_t width,
+			uint32_t height,
+			uint32_t mipCount,
+			const char* textureData,
+			residency_callback_type onResident
 		) override;
 		void removeTexture(Texture* texture) override;
 		Material* addMaterial(
@@ -340,10 +523,16 @@ namespace RIN {
 		void removeLight(Light* light) override;
 		void setSkybox(Texture* skybox, Texture* iblDiffuse, Texture* iblSpecular) override;
 		void clearSkybox() override;
+		// Zero-copy uploading
+		std::span<char> reserveUpload(uint64_t size) override;
+		void commitUpload(std::span<char> upload) override;
 		// GUI
 		// Update and upload commit
 		void update() override;
 
+		// Statistics
+		UploadStats getUploadStats() const override;
+
 		// Rendering
 		void render() override;
 		void resizeSwapChain() override;
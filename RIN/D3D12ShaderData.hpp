@@ -49,7 +49,8 @@ namespace RIN {
 		uint32_t data;
 		struct {
 			uint32_t show : 1;
-			uint32_t materialType : 31;
+			uint32_t index16 : LOD_COUNT; // Bit i is set if LOD i uses 16-bit indices
+			uint32_t materialType : 31 - LOD_COUNT;
 		};
 	};
 
@@ -84,7 +85,7 @@ namespace RIN {
 	Aligned to float4
 	*/
 	struct alignas(16) D3D12SkinnedObjectData {
-		D3D12BoundingSphereData boundingSphere;
+		D3D12BoundingSphereData boundingSphere; // World space bounds of the current pose
 		D3D12LODData lods[LOD_COUNT];
 		D3D12MaterialData material;
 		uint32_t boneIndex;
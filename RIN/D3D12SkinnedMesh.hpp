@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+
+#include <DirectXMath.h>
+
 #include "SkinnedMesh.hpp"
 #include "FreeListAllocator.hpp"
 #include "Config.hpp"
@@ -14,16 +18,38 @@ namespace RIN {
 		struct LOD {
 			FreeListAllocator::Allocation vertexAlloc;
 			FreeListAllocator::Allocation indexAlloc;
+			bool index16; // Set if indexAlloc is in the 16-bit index arena
+			bool resident = false; // Set once the LOD is uploaded
 
-			LOD(FreeListAllocator::Allocation& vertexAlloc, FreeListAllocator::Allocation& indexAlloc) :
+			LOD(FreeListAllocator::Allocation& vertexAlloc, FreeListAllocator::Allocation& indexAlloc, bool index16) :
 				vertexAlloc(vertexAlloc),
-				indexAlloc(indexAlloc) {}
+				indexAlloc(indexAlloc),
+				index16(index16) {}
 		};
 
-		std::optional<LOD> lods[LOD_COUNT];
-
-		D3D12SkinnedMesh(const BoundingSphere& boundingSphere) :
-			SkinnedMesh(boundingSphere)
+		std::optional<LOD> lods[LOD_COUNT]{};
+		uint32_t lodCount;
+		uint32_t lodMask = 0; // Resident LODs the objects using the mesh were last uploaded with
+		uint32_t desiredLOD = 0; // Most detailed LOD needed by any object using the mesh
+		bool lodsChanged = false;
+		// Data of every LOD, only valid after the initial upload if the
+		// mesh is streamed, which lets the detailed LODs stream in and out
+		bool streamed = false;
+		const char* lodVertices[LOD_COUNT]{};
+		const char* lodIndices[LOD_COUNT]{};
+		uint64_t lodVertexSizes[LOD_COUNT]{};
+		uint64_t lodIndexSizes[LOD_COUNT]{}; // Size of the 32-bit indices
+		bool lodIndex16[LOD_COUNT]{}; // Set if the LOD can use 16-bit indices
+		// Bounds of the vertices of each bone in mesh space, they are carried
+		// by the bones of an armature to bound the objects using the mesh
+		std::unique_ptr<DirectX::XMFLOAT4[]> boneSpheres;
+		uint32_t boneCount;
+
+		D3D12SkinnedMesh(const BoundingSphere& boundingSphere, uint32_t lodCount, uint32_t boneCount) :
+			SkinnedMesh(boundingSphere),
+			lodCount(lodCount),
+			boneSpheres(new DirectX::XMFLOAT4[boneCount]),
+			boneCount(boneCount)
 		{}
 
 		D3D12SkinnedMesh(const D3D12SkinnedMesh&) = delete;
@@ -12,19 +12,42 @@ namespace RIN {
 		friend class DynamicPool<D3D12StaticMesh>;
 
 		struct LOD {
-			FreeListAllocator::Allocation vertexAlloc;
+			FreeListAllocator::Allocation vertexAlloc; // sharedVertexAlloc if the mesh shares its vertices
 			FreeListAllocator::Allocation indexAlloc;
+			bool index16; // Set if indexAlloc is in the 16-bit index arena
+			bool resident = false; // Set once the LOD is uploaded
 
-			LOD(FreeListAllocator::Allocation& vertexAlloc, FreeListAllocator::Allocation& indexAlloc) :
+			LOD(FreeListAllocator::Allocation& vertexAlloc, FreeListAllocator::Allocation& indexAlloc, bool index16) :
 				vertexAlloc(vertexAlloc),
-				indexAlloc(indexAlloc)
+				indexAlloc(indexAlloc),
+				index16(index16)
 			{}
 		};
 
 		std::optional<LOD> lods[LOD_COUNT]{};
-
-		D3D12StaticMesh(const BoundingSphere& boundingSphere) :
-			StaticMesh(boundingSphere)
+		uint32_t lodCount;
+		uint32_t lodMask = 0; // Resident LODs the objects using the mesh were last uploaded with
+		uint32_t desiredLOD = 0; // Most detailed LOD needed by any object using the mesh
+		bool lodsChanged = false;
+		// Data of every LOD, only valid after the initial upload if the
+		// mesh is streamed, which lets the detailed LODs stream in and out
+		bool streamed = false;
+		const char* lodVertices[LOD_COUNT]{};
+		const char* lodIndices[LOD_COUNT]{};
+		uint64_t lodVertexSizes[LOD_COUNT]{};
+		uint64_t lodIndexSizes[LOD_COUNT]{}; // Size of the 32-bit indices
+		bool lodIndex16[LOD_COUNT]{}; // Set if the LOD can use 16-bit indices
+		// Set if the LODs index into one set of vertices, LOD i only uses the
+		// first lodVertexSizes[i] bytes of it, the set is allocated with the
+		// mesh and uploaded as far as the LODs need it, only the indices of
+		// the LODs are evicted
+		bool sharedVertices = false;
+		FreeListAllocator::allocation_type sharedVertexAlloc;
+		uint64_t sharedVertexUploadSize = 0;
+
+		D3D12StaticMesh(const BoundingSphere& boundingSphere, uint32_t lodCount) :
+			StaticMesh(boundingSphere),
+			lodCount(lodCount)
 		{}
 
 		D3D12StaticMesh(const D3D12StaticMesh&) = delete;
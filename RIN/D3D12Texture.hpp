@@ -12,9 +12,15 @@ namespace RIN {
 		friend class D3D12Renderer;
 		friend class DynamicPool<D3D12Texture>;
 
-		const FreeListAllocator::Allocation textureAlloc;
+		FreeListAllocator::Allocation textureAlloc;
 		ID3D12Resource* resource;
 		bool dead = false;
+		// Streaming
+		const char* streamData = nullptr; // Full mip chain, only set for streamed textures
+		ID3D12Resource* streamResource{}; // Replaces resource once streamReady is set
+		FreeListAllocator::allocation_type streamAlloc;
+		uint32_t streamMip = 0; // Most detailed mip of streamResource
+		bool streamReady = false;
 
 		D3D12Texture(TEXTURE_TYPE type, TEXTURE_FORMAT format, FreeListAllocator::Allocation& textureAlloc, ID3D12Resource* resource) :
 			Texture(type, format),
@@ -15,8 +15,10 @@ namespace RIN {
 		DynamicMesh(const DynamicMesh&) = delete;
 		virtual ~DynamicMesh() = 0;
 	public:
-		// Check this to determine if it is safe to free the
-		// buffers used to create the mesh
+		// Set once the least detailed LOD is uploaded, objects using the
+		// mesh are drawn from then on, while the more detailed LODs are
+		// still read from the buffers used to create the mesh, so those
+		// are only safe to free once its residency callback is called
 		bool resident() const {
 			return _resident;
 		}
@@ -17,6 +17,8 @@ namespace RIN {
 		DynamicMesh* mesh;
 		Material* material;
 		bool _resident = false;
+		// Set when the object data on the GPU is out of date
+		bool dirty = true;
 
 		DynamicObject(DynamicMesh* mesh, Material* material) :
 			mesh(mesh),
@@ -30,17 +32,20 @@ namespace RIN {
 			if(!mesh) return;
 
 			DynamicObject::mesh = mesh;
+			dirty = true;
 		}
 
 		virtual void setMaterial(Material* material) {
 			if(!material) return;
 			
 			DynamicObject::material = material;
+			dirty = true;
 		}
 
 		virtual void XM_CALLCONV setWorldMatrix(DirectX::FXMMATRIX M) {
 			worldMatrix = M;
 			invWorldMatrix = DirectX::XMMatrixInverse(nullptr, M);
+			dirty = true;
 		}
 
 		DirectX::XMMATRIX getWorldMatrix() const {
@@ -0,0 +1,34 @@
+#include "IndexData.hpp"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define INDEX_DATA_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace RIN {
+	void narrowIndices(const uint32_t* indices, uint64_t indexCount, uint16_t* narrowed) {
+		uint64_t i = 0;
+
+	#ifdef INDEX_DATA_SSE2
+		/*
+		SSE2 can only pack with signed saturation, so the indices are
+		biased into the int16 range, packed, and the bias is flipped back
+		*/
+		const __m128i bias32 = _mm_set1_epi32(0x8000);
+		const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+
+		for(; i + 16 <= indexCount; i += 16) {
+			__m128i a = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(indices + i)), bias32);
+			__m128i b = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(indices + i + 4)), bias32);
+			__m128i c = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(indices + i + 8)), bias32);
+			__m128i d = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(indices + i + 12)), bias32);
+
+			_mm_storeu_si128((__m128i*)(narrowed + i), _mm_xor_si128(_mm_packs_epi32(a, b), bias16));
+			_mm_storeu_si128((__m128i*)(narrowed + i + 8), _mm_xor_si128(_mm_packs_epi32(c, d), bias16));
+		}
+	#endif
+
+		for(; i < indexCount; ++i)
+			narrowed[i] = (uint16_t)indices[i];
+	}
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RIN {
+	// LODs with at most this many vertices are drawn with 16-bit indices
+	constexpr uint32_t INDEX16_VERTEX_COUNT = 65536;
+
+	// Every index must be less than INDEX16_VERTEX_COUNT
+	void narrowIndices(const uint32_t* indices, uint64_t indexCount, uint16_t* narrowed);
+}
\ No newline at end of file
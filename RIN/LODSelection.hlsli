@@ -0,0 +1,22 @@
+#pragma once
+
+/*
+Included by the cull shaders and by the renderer, so that the LOD the GPU
+draws and the LOD the CPU streams in are chosen the same way
+dist is from the camera to the surface of the bounding sphere
+*/
+
+#ifdef __cplusplus
+#define LOD_UINT uint32_t
+#else
+#define LOD_UINT uint
+#endif
+
+static const float LOD_DISTANCE_1 = 5.0f; // LOD 0 is drawn closer than this
+static const float LOD_DISTANCE_2 = 10.0f; // LOD 1 is drawn closer than this, LOD 2 past it
+
+inline LOD_UINT selectLOD(float dist) {
+	return dist < LOD_DISTANCE_1 ? 0 : (dist < LOD_DISTANCE_2 ? 1 : 2);
+}
+
+#undef LOD_UINT
\ No newline at end of file
@@ -105,6 +105,8 @@ namespace RIN {
 			case TEXTURE_FORMAT::BC3_UNORM_SRGB:
 			case TEXTURE_FORMAT::BC7_UNORM:
 			case TEXTURE_FORMAT::BC7_UNORM_SRGB:
+			case TEXTURE_FORMAT::BC1_UNORM:
+			case TEXTURE_FORMAT::BC1_UNORM_SRGB:
 				break;
 			default:
 				RIN_ERROR("Invalid material base color texture format");
@@ -179,6 +181,8 @@ namespace RIN {
 				case TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB:
 				case TEXTURE_FORMAT::R16B16G16A16_FLOAT:
 				case TEXTURE_FORMAT::R32G32B32A32_FLOAT:
+				case TEXTURE_FORMAT::BC1_UNORM:
+				case TEXTURE_FORMAT::BC1_UNORM_SRGB:
 				case TEXTURE_FORMAT::BC3_UNORM:
 				case TEXTURE_FORMAT::BC3_UNORM_SRGB:
 				case TEXTURE_FORMAT::BC7_UNORM:
@@ -0,0 +1,79 @@
+#include "PBRInputs.hlsli"
+#include "SceneObject.hlsli"
+#include "Camera.hlsli"
+
+struct RootConstants {
+	uint objectID;
+};
+
+ConstantBuffer<RootConstants> rootConstants : register(b0);
+ConstantBuffer<Camera> cameraBuffer : register(b1);
+StructuredBuffer<StaticObject> staticObjectBuffer : register(t0);
+
+[RootSignature(
+	"RootFlags("\
+		"ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT |"\
+		"DENY_HULL_SHADER_ROOT_ACCESS |"\
+		"DENY_DOMAIN_SHADER_ROOT_ACCESS |"\
+		"DENY_GEOMETRY_SHADER_ROOT_ACCESS"\
+	"),"\
+	"RootConstants(num32BitConstants = 1, b0, visibility = SHADER_VISIBILITY_VERTEX),"\
+	"RootConstants(num32BitConstants = 1, b0, visibility = SHADER_VISIBILITY_PIXEL),"\
+	"CBV(b1),"\
+	"SRV(t0, visibility = SHADER_VISIBILITY_VERTEX),"\
+	"SRV(t0, visibility = SHADER_VISIBILITY_PIXEL),"\
+	"SRV(t1, visibility = SHADER_VISIBILITY_PIXEL),"\
+	"DescriptorTable("\
+		"SRV(t2),"\
+		"SRV(t3, offset = 2, flags = DESCRIPTORS_VOLATILE | DATA_STATIC_WHILE_SET_AT_EXECUTE),"\
+		"SRV(t4, offset = 3, flags = DESCRIPTORS_VOLATILE | DATA_STATIC_WHILE_SET_AT_EXECUTE),"\
+		"SRV(t0, offset = 4, numDescriptors = unbounded, space = 1, flags = DESCRIPTORS_VOLATILE | DATA_STATIC_WHILE_SET_AT_EXECUTE),"\
+		"visibility = SHADER_VISIBILITY_PIXEL"
+	"),"\
+	"StaticSampler(s0, visibility = SHADER_VISIBILITY_PIXEL),"\
+	"StaticSampler("\
+		"s1,"\
+		"filter = FILTER_MIN_MAG_MIP_LINEAR,"\
+		"visibility = SHADER_VISIBILITY_PIXEL"\
+	"),"\
+	"StaticSampler("\
+		"s2,"\
+		"filter = FILTER_MIN_MAG_LINEAR_MIP_POINT,"\
+		"addressU = TEXTURE_ADDRESS_CLAMP,"\
+		"addressV = TEXTURE_ADDRESS_CLAMP,"\
+		"addressW = TEXTURE_ADDRESS_CLAMP,"\
+		"visibility = SHADER_VISIBILITY_PIXEL"\
+	")"
+)]
+// Inverse of the octahedral encoding in VertexData.cpp
+float3 decodeOctahedral(float2 encoded) {
+	float3 direction = float3(encoded, 1.0f - abs(encoded.x) - abs(encoded.y));
+	float fold = saturate(-direction.z);
+	direction.xy += direction.xy >= 0.0f ? -fold : fold;
+
+	return normalize(direction);
+}
+
+PBRInput main(
+	float4 position : POSITION, // float4((position - center) / radius, 0)
+	float4 normalTangent : NORMAL, // float4(octahedral normal, octahedral tangent)
+	float2 tex : TEXCOORD
+) {
+	StaticObject object = staticObjectBuffer[rootConstants.objectID];
+
+	// Static objects use the bounding sphere of their mesh
+	float3 worldPos = object.boundingSphere.center + position.xyz * object.boundingSphere.radius;
+	float3 normal = decodeOctahedral(normalTangent.xy);
+	float3 tangent = decodeOctahedral(normalTangent.zw);
+
+	PBRInput output;
+	output.position = mul(cameraBuffer.viewProjMatrix, float4(worldPos, 1.0f));
+	output.clipPos = output.position;
+	output.worldPos = worldPos;
+	output.tbn = float3x3(tangent, cross(normal, tangent), normal); // This is a row-major row vector matrix (x * A)
+	output.tex = tex;
+	output.material = object.material;
+	output.flags = object.flags;
+
+	return output;
+}
\ No newline at end of file
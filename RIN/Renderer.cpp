@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "Renderer.hpp"
 #include "Error.hpp"
 #include "Debug.hpp"
@@ -35,6 +37,14 @@ namespace RIN {
 		if(!settings.backBufferCount) RIN_ERROR("Back buffer count must not be 0");
 	}
 
+	float Renderer::getUploadPriority(const BoundingSphere& bounds) const {
+		DirectX::XMVECTOR center = DirectX::XMLoadFloat3(&bounds.center);
+		float distance = DirectX::XMVectorGetX(DirectX::XMVector3Length(DirectX::XMVectorSubtract(center, getCamera().getPosition())));
+
+		// Closer objects have higher priorities, 0 is the highest
+		return -std::max(distance - bounds.radius, 0.0f);
+	}
+
 	Renderer* Renderer::create(HWND hwnd, const Config& config, const Settings& settings) {
 		Renderer* renderer = nullptr;
 
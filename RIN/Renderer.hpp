@@ -3,6 +3,8 @@
 #define NOMINMAX
 
 #include <Windows.h>
+#include <span>
+#include <functional>
 
 #include "Config.hpp"
 #include "Settings.hpp"
@@ -18,6 +20,7 @@
 #include "Material.hpp"
 #include "Light.hpp"
 #include "Armature.hpp"
+#include "UploadStats.hpp"
 
 /*
 Using DirectXMath
@@ -57,11 +60,24 @@ be no issues
 
 namespace RIN {
 	typedef uint32_t index_type;
+	// Called once the last copy of an upload has completed on the GPU
+	typedef std::function<void()> residency_callback_type;
 
 	/*
 	update() must only be called after construction or after render()
 	render() must only be called after update()
-	
+
+	The add functions which take a residency callback call it from
+	render() once the upload is complete, so it may free the source data
+	or create dependent objects instead of polling resident()
+
+	Meshes and textures are uploaded in order of priority, higher first,
+	uploads which wait too long are served first regardless of priority
+	The default priority of 0 is served as soon as possible, in order
+	Objects are uploaded ahead of the meshes and textures they use, they are
+	hidden until a LOD of their mesh and every texture of their material is
+	resident
+		
 	Thread Safety:
 	Renderer::create is not thread-safe
 	Renderer::destroy is not thread-safe
@@ -83,13 +99,18 @@ namespace RIN {
 	Renderer::addArmature is thread-safe
 	Renderer::removeArmature is thread-safe
 	Renderer::addTexture is thread-safe
+	Renderer::addStreamedTexture is thread-safe
 	Renderer::removeTexture is thread-safe
 	Renderer::addMaterial is thread-safe
 	Renderer::removeMaterial is thread-safe
 	Renderer::addLight is thread-safe
 	Renderer::removeLight is thread-safe
 	Renderer::setSkybox is not thread-safe
+	Renderer::reserveUpload is thread-safe
+	Renderer::commitUpload is thread-safe
+	Renderer::getUploadPriority is not thread-safe
 	Renderer::update is not thread-safe
+	Renderer::getUploadStats is thread-safe
 	Renderer::render is not thread-safe
 	Renderer::resizeSwapChain is not thread-safe
 	Renderer::toggleFullScreen is not thread-safe
@@ -116,16 +137,40 @@ namespace RIN {
 		// Scene
 		virtual Camera& getCamera() = 0;
 		virtual const Camera& getCamera() const = 0;
+		/*
+		LODs are uploaded from the least detailed one up, the mesh is
+		resident once the least detailed LOD is, and objects draw the
+		closest resident LOD until the LOD they need arrives
+		If streamed is set, only the least detailed LOD is uploaded up
+		front, the others are streamed in once an object using the mesh
+		is close enough to draw them and may be evicted again when the
+		mesh buffers run out of space, so the data must stay valid until
+		the mesh is removed
+		The indices of LODs with at most 65536 vertices are narrowed to
+		16-bit indices as they are uploaded, unless they were written to
+		reserved upload memory, which is never read back
+		If Config::quantizeStaticVertices is set, the vertices are
+		quantized as they are uploaded, so they must lie inside the
+		bounding sphere and must not be in reserved upload memory
+		If sharedVertices is set, the LODs index into one set of
+		vertexCounts[0] vertices, which is ordered so that LOD i only uses
+		the first vertexCounts[i] of them, it takes one vertex allocation
+		and streaming only moves the indices of the LODs
+		*/
 		virtual StaticMesh* addStaticMesh(
 			const BoundingSphere& boundingSphere,
 			const StaticVertex* vertices,
 			const uint32_t* vertexCounts,
 			const index_type* indices,
 			const uint32_t* indexCounts,
-			uint32_t lodCount
+			uint32_t lodCount,
+			residency_callback_type onResident = nullptr,
+			float priority = 0.0f,
+			bool streamed = false,
+			bool sharedVertices = false
 		) = 0;
 		virtual void removeStaticMesh(StaticMesh* mesh) = 0;
-		virtual StaticObject* addStaticObject(StaticMesh* mesh, Material* material) = 0;
+		virtual StaticObject* addStaticObject(StaticMesh* mesh, Material* material, residency_callback_type onResident = nullptr) = 0;
 		virtual void removeStaticObject(StaticObject* object) = 0;
 		virtual void updateStaticObject(StaticObject* object) = 0;
 		virtual DynamicMesh* addDynamicMesh(
@@ -134,33 +179,75 @@ namespace RIN {
 			const uint32_t* vertexCounts,
 			const index_type* indices,
 			const uint32_t* indexCounts,
-			uint32_t lodCount
+			uint32_t lodCount,
+			residency_callback_type onResident = nullptr,
+			float priority = 0.0f,
+			bool streamed = false
 		) = 0;
 		virtual void removeDynamicMesh(DynamicMesh* mesh) = 0;
-		virtual DynamicObject* addDynamicObject(DynamicMesh* mesh, Material* material) = 0;
+		virtual DynamicObject* addDynamicObject(DynamicMesh* mesh, Material* material, residency_callback_type onResident = nullptr) = 0;
 		virtual void removeDynamicObject(DynamicObject* object) = 0;
+		/*
+		boneSpheres holds the sphere of each bone from
+		computeBoneBoundingSpheres, they are copied, objects using the mesh
+		are bounded by the spheres carried by the bones of their armature
+		If boneCount is 0, the bounding sphere is carried by the first bone
+		*/
 		virtual SkinnedMesh* addSkinnedMesh(
 			const BoundingSphere& boundingSphere,
+			const DirectX::XMFLOAT4* boneSpheres,
+			uint32_t boneCount,
 			const SkinnedVertex* vertices,
 			const uint32_t* vertexCounts,
 			const index_type* indices,
 			const uint32_t* indexCounts,
-			uint32_t lodCount
+			uint32_t lodCount,
+			residency_callback_type onResident = nullptr,
+			float priority = 0.0f,
+			bool streamed = false
 		) = 0;
 		virtual void removeSkinnedMesh(SkinnedMesh* mesh) = 0;
-		virtual SkinnedObject* addSkinnedObject(SkinnedMesh* mesh, Armature* armature, Material* material) = 0;
+		virtual SkinnedObject* addSkinnedObject(SkinnedMesh* mesh, Armature* armature, Material* material, residency_callback_type onResident = nullptr) = 0;
 		virtual void removeSkinnedObject(SkinnedObject* object) = 0;
 		virtual void updateSkinnedObject(SkinnedObject* object) = 0;
-		virtual Armature* addArmature(uint8_t boneCount) = 0;
+		virtual Armature* addArmature(uint8_t boneCount, residency_callback_type onResident = nullptr) = 0;
 		virtual void removeArmature(Armature* armature) = 0;
-		// Setting mipCount to -1 will use the full mip chain
+		/*
+		Setting mipCount to -1 will use the full mip chain
+		If compress is set, the texture is block compressed to
+		getCompressedFormat(format) on the thread pool before this returns,
+		textureData can then be freed right away, formats without a block
+		compressed counterpart are uploaded as they are, the width and height
+		of textures which are compressed must be multiples of 4
+		*/
 		virtual Texture* addTexture(
 			TEXTURE_TYPE type,
 			TEXTURE_FORMAT format,
 			uint32_t width,
 			uint32_t height,
 			uint32_t mipCount,
-			const char* textureData
+			const char* textureData,
+			residency_callback_type onResident = nullptr,
+			float priority = 0.0f,
+			bool compress = false
+		) = 0;
+		/*
+		Only the least detailed mips are uploaded up front, more detailed mips
+		are streamed in and out depending on how large the objects using the
+		texture are on screen, within Config::textureStreamBudget
+		textureData must contain the full mip chain and stay valid until
+		the texture is removed, the texture is resident once the least
+		detailed mips are
+		Block compressed textures must be a whole number of blocks wide and
+		high, their mips which are not stay resident with the least detailed
+		*/
+		virtual Texture* addStreamedTexture(
+			TEXTURE_FORMAT format,
+			uint32_t width,
+			uint32_t height,
+			uint32_t mipCount,
+			const char* textureData,
+			residency_callback_type onResident = nullptr
 		) = 0;
 		virtual void removeTexture(Texture* texture) = 0;
 		virtual Material* addMaterial(
@@ -177,9 +264,21 @@ namespace RIN {
 		virtual void removeLight(Light*) = 0;
 		virtual void setSkybox(Texture* skybox, Texture* iblDiffuse, Texture* iblSpecular) = 0;
 		virtual void clearSkybox() = 0;
+		// Upload priority for an asset used by an object with these world space bounds
+		float getUploadPriority(const BoundingSphere& bounds) const;
+		// Zero-copy uploading
+		// Returns upload memory which mesh data can be written to directly and
+		// then passed to the add functions, the span is empty if there is no space
+		virtual std::span<char> reserveUpload(uint64_t size) = 0;
+		// Call once every add function reading from the span has been called,
+		// the memory is reclaimed once those uploads are complete
+		virtual void commitUpload(std::span<char> upload) = 0;
 		// Update and commit upload
 		virtual void update() = 0;
 
+		// Statistics
+		virtual UploadStats getUploadStats() const = 0;
+
 		// Rendering
 		virtual void render() = 0;
 		virtual void resizeSwapChain() = 0;
@@ -44,7 +44,7 @@ struct DynamicObject {
 };
 
 struct SkinnedObject {
-	BoundingSphere boundingSphere;
+	BoundingSphere boundingSphere; // World space bounds of the current pose
 	LOD lods[LOD_COUNT];
 	Material material;
 	uint boneIndex;
@@ -56,10 +56,27 @@ uint getObjectFlagShowField(uint flags) {
 	return flags & 1;
 }
 
+uint getObjectFlagIndex16Field(uint flags, uint lod) {
+	return (flags >> (1 + lod)) & 1;
+}
+
 uint getObjectFlagMaterialTypeField(uint flags) {
-	return flags >> 1;
+	return flags >> (1 + LOD_COUNT);
 }
 
+// Matches D3D12_INDEX_BUFFER_VIEW
+struct IndexBufferView {
+	uint2 bufferLocation;
+	uint sizeInBytes;
+	uint format;
+};
+
+// Views of the 32-bit and 16-bit index arenas
+struct IndexBuffers {
+	IndexBufferView index32;
+	IndexBufferView index16;
+};
+
 struct Bone {
 	float4x4 worldMatrix;
 	float4x4 invWorldMatrix;
@@ -0,0 +1,150 @@
+#include "Skeleton.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace RIN {
+	static DirectX::XMMATRIX readMatrix(const char* data) {
+		// The matrices of the file are not aligned
+		DirectX::XMFLOAT4X4 matrix;
+		memcpy(&matrix, data, sizeof(matrix));
+		return DirectX::XMLoadFloat4x4(&matrix);
+	}
+
+	bool Skeleton::load(const char* data, uint64_t size) {
+		constexpr uint64_t MATRIX_SIZE = sizeof(DirectX::XMFLOAT4X4);
+		constexpr uint64_t BONE_SIZE = sizeof(uint8_t) * 2 + MATRIX_SIZE;
+
+		boneCount = 0;
+		matrices.reset();
+		indices.reset();
+
+		if(size < sizeof(uint8_t) + MATRIX_SIZE) return false;
+
+		const uint32_t count = (uint8_t)data[0];
+		if(!count || size != sizeof(uint8_t) + MATRIX_SIZE + (count - 1) * BONE_SIZE) return false;
+
+		// Offset of each bone in the file and its parent, the root is its own parent
+		uint64_t offsets[MAX_BONE_COUNT];
+		uint8_t parents[MAX_BONE_COUNT];
+		bool found[MAX_BONE_COUNT]{};
+		offsets[0] = sizeof(uint8_t);
+		parents[0] = 0;
+		found[0] = true;
+
+		const char* bone = data + sizeof(uint8_t) + MATRIX_SIZE;
+		for(uint32_t i = 1; i < count; ++i, bone += BONE_SIZE) {
+			const uint8_t index = (uint8_t)bone[0];
+			const uint8_t parent = (uint8_t)bone[1];
+			if(index >= count || found[index] || parent >= count || parent == index) return false;
+
+			offsets[index] = bone + sizeof(uint8_t) * 2 - data;
+			parents[index] = parent;
+			found[index] = true;
+		}
+
+		// Children of each bone, bucketed by parent
+		uint8_t childStarts[MAX_BONE_COUNT + 1]{};
+		uint8_t children[MAX_BONE_COUNT];
+		for(uint32_t i = 1; i < count; ++i)
+			++childStarts[parents[i] + 1];
+		for(uint32_t i = 0; i < count; ++i)
+			childStarts[i + 1] += childStarts[i];
+		{
+			uint8_t cursors[MAX_BONE_COUNT];
+			memcpy(cursors, childStarts, count);
+			for(uint32_t i = 1; i < count; ++i)
+				children[cursors[parents[i]]++] = (uint8_t)i;
+		}
+
+		// Breadth first from the root, bones which are not reached are part of a cycle
+		uint8_t order[MAX_BONE_COUNT];
+		uint8_t sorted[MAX_BONE_COUNT]; // Sorted index of each bone
+		uint32_t sortedCount = 1;
+		order[0] = 0;
+		sorted[0] = 0;
+		for(uint32_t i = 0; i < sortedCount; ++i) {
+			const uint8_t parent = order[i];
+			for(uint32_t j = childStarts[parent]; j < childStarts[parent + 1]; ++j) {
+				sorted[children[j]] = (uint8_t)sortedCount;
+				order[sortedCount++] = children[j];
+			}
+		}
+
+		if(sortedCount != count) return false;
+
+		std::unique_ptr<DirectX::XMMATRIX[]> newMatrices(new DirectX::XMMATRIX[count * 2]);
+		std::unique_ptr<uint8_t[]> newIndices(new uint8_t[count * 2]);
+		for(uint32_t i = 0; i < count; ++i) {
+			const uint8_t index = order[i];
+			const DirectX::XMMATRIX restMatrix = readMatrix(data + offsets[index]);
+
+			DirectX::XMVECTOR determinant;
+			const DirectX::XMMATRIX invRestMatrix = DirectX::XMMatrixInverse(&determinant, restMatrix);
+			const float d = DirectX::XMVectorGetX(determinant);
+			if(d == 0.0f || !std::isfinite(d)) return false;
+
+			newMatrices[i] = restMatrix;
+			newMatrices[count + i] = invRestMatrix;
+			newIndices[i] = sorted[parents[index]];
+			newIndices[count + i] = index;
+		}
+
+		boneCount = count;
+		matrices = std::move(newMatrices);
+		indices = std::move(newIndices);
+
+		return true;
+	}
+
+	uint32_t Skeleton::getBoneCount() const {
+		return boneCount;
+	}
+
+	const uint8_t* Skeleton::getParents() const {
+		return indices.get();
+	}
+
+	const uint8_t* Skeleton::getBoneIndices() const {
+		return indices.get() + boneCount;
+	}
+
+	const DirectX::XMMATRIX* Skeleton::getRestMatrices() const {
+		return matrices.get();
+	}
+
+	const DirectX::XMMATRIX* Skeleton::getInvRestMatrices() const {
+		return matrices.get() + boneCount;
+	}
+
+	DirectX::XMMATRIX Skeleton::getPoseMatrix(uint32_t bone, const DirectX::XMMATRIX* localMatrices) const {
+		if(!localMatrices) return DirectX::XMMatrixIdentity();
+
+		const DirectX::XMMATRIX& localMatrix = localMatrices[indices[boneCount + bone]];
+		return DirectX::XMMatrixMultiply(DirectX::XMMatrixMultiply(matrices[boneCount + bone], localMatrix), matrices[bone]);
+	}
+
+	void XM_CALLCONV Skeleton::computeWorldMatrices(DirectX::FXMMATRIX rootMatrix, const DirectX::XMMATRIX* localMatrices, DirectX::XMMATRIX* worldMatrices) const {
+		if(!boneCount) return;
+
+		const uint8_t* parents = getParents();
+		const uint8_t* boneIndices = getBoneIndices();
+
+		worldMatrices[boneIndices[0]] = DirectX::XMMatrixMultiply(getPoseMatrix(0, localMatrices), rootMatrix);
+		for(uint32_t i = 1; i < boneCount; ++i)
+			worldMatrices[boneIndices[i]] = DirectX::XMMatrixMultiply(getPoseMatrix(i, localMatrices), worldMatrices[boneIndices[parents[i]]]);
+	}
+
+	void XM_CALLCONV Skeleton::pose(DirectX::FXMMATRIX rootMatrix, const DirectX::XMMATRIX* localMatrices, Armature* armature) const {
+		if(!boneCount) return;
+
+		const uint8_t* parents = getParents();
+		const uint8_t* boneIndices = getBoneIndices();
+		Bone* bones = armature->bones;
+
+		// Parents are posed first, so their world matrices are already in the bones
+		bones[boneIndices[0]].setWorldMatrix(DirectX::XMMatrixMultiply(getPoseMatrix(0, localMatrices), rootMatrix));
+		for(uint32_t i = 1; i < boneCount; ++i)
+			bones[boneIndices[i]].setWorldMatrix(DirectX::XMMatrixMultiply(getPoseMatrix(i, localMatrices), bones[boneIndices[parents[i]]].getWorldMatrix()));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <DirectXMath.h>
+
+#include "Armature.hpp"
+
+namespace RIN {
+	/*
+	Bone hierarchy of an armature, loaded from a .arm file
+
+	Layout of a .arm file
+
+	Bone count (uint8)
+	Rest matrix of bone 0, the root (float4x4)
+	Every other bone, in any order
+		Bone index (uint8)
+		Parent index (uint8)
+		Rest matrix (float4x4)
+
+	Rest matrices take a bone to model space at rest, they are row-major
+	row vector matrices (x * A) like the rest of DirectXMath
+
+	The bones are sorted so that parents come before their children and
+	stored as arrays in that order, the parents are indices into the same
+	order and the bone indices map each bone back to its bone in the
+	armature, which is in file order
+	Loading makes one allocation for the matrices and one for the indices,
+	a skeleton does not change once it is loaded, so one skeleton can pose
+	any number of armatures
+
+	A bone is posed as invRestMatrix * localMatrix * restMatrix * parent,
+	so a local matrix transforms the bone as if its tail was at the
+	origin, the same way as SceneGraph::BoneNode::setBoneSpaceTansform,
+	and identity local matrices give the rest pose
+	The root takes rootMatrix as its parent, which places the armature
+
+	Thread Safety:
+	Skeleton::load is not thread-safe
+	The rest of the functions are thread-safe
+	*/
+	class Skeleton {
+		uint32_t boneCount = 0;
+		// Rest matrices followed by inverse rest matrices
+		std::unique_ptr<DirectX::XMMATRIX[]> matrices;
+		// Parents followed by bone indices
+		std::unique_ptr<uint8_t[]> indices;
+
+		DirectX::XMMATRIX getPoseMatrix(uint32_t bone, const DirectX::XMMATRIX* localMatrices) const;
+	public:
+		static constexpr uint32_t MAX_BONE_COUNT = UINT8_MAX;
+
+		Skeleton() = default;
+		Skeleton(const Skeleton&) = delete;
+		~Skeleton() = default;
+		/*
+		Returns false if data is not a valid .arm file, which leaves the
+		skeleton empty
+		Every bone must have a parent which leads back to the root and a rest
+		matrix which can be inverted
+		*/
+		bool load(const char* data, uint64_t size);
+		// 0 if the skeleton is empty
+		uint32_t getBoneCount() const;
+		// In sorted order, the root is first and is its own parent
+		const uint8_t* getParents() const;
+		const uint8_t* getBoneIndices() const;
+		const DirectX::XMMATRIX* getRestMatrices() const;
+		const DirectX::XMMATRIX* getInvRestMatrices() const;
+		/*
+		localMatrices are indexed by the bones of the armature and may be
+		nullptr for the rest pose
+		worldMatrices must hold getBoneCount() matrices and are indexed by
+		the bones of the armature
+		*/
+		void XM_CALLCONV computeWorldMatrices(DirectX::FXMMATRIX rootMatrix, const DirectX::XMMATRIX* localMatrices, DirectX::XMMATRIX* worldMatrices) const;
+		// Writes the world matrices straight to the bones, the armature must have getBoneCount() bones
+		void XM_CALLCONV pose(DirectX::FXMMATRIX rootMatrix, const DirectX::XMMATRIX* localMatrices, Armature* armature) const;
+	};
+}
\ No newline at end of file
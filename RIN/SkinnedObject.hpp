@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+
+#include <DirectXMath.h>
+
 #include "SkinnedMesh.hpp"
 #include "Armature.hpp"
 #include "Material.hpp"
@@ -14,7 +18,16 @@ namespace RIN {
 		SkinnedMesh* mesh;
 		Armature* armature;
 		Material* material;
+		// Sphere around the posed mesh in world space, xyz is the center
+		// and w the radius, computed from the bones every update
+		DirectX::XMFLOAT4 boundingSphere{};
 		bool _resident = false;
+		// Set when the object data on the GPU is out of date, the object is
+		// only written by the update, so this is all updateSkinnedObject does
+		std::atomic<bool> dirty = true;
+		// Whether the material was resident the last time the object was uploaded,
+		// objects are hidden until it is and are uploaded again once it is
+		bool materialResident = false;
 
 		SkinnedObject(SkinnedMesh* mesh, Armature* armature, Material* material) :
 			mesh(mesh),
@@ -43,6 +56,11 @@ namespace RIN {
 			SkinnedObject::material = material;
 		}
 
+		// The bounds of the pose from the last update
+		BoundingSphere getBoundingSphere() const {
+			return BoundingSphere(boundingSphere.x, boundingSphere.y, boundingSphere.z, boundingSphere.w);
+		}
+
 		// This implies that its mesh, armature, and material are resident too
 		bool resident() const {
 			return _resident && mesh->resident() && armature->resident() && material->resident();
@@ -13,6 +13,9 @@ namespace RIN {
 		StaticMesh* mesh;
 		Material* material;
 		bool _resident = false;
+		// Whether the material was resident the last time the object was uploaded,
+		// objects are hidden until it is and are uploaded again once it is
+		bool materialResident = false;
 
 		StaticObject(StaticMesh* mesh, Material* material) :
 			mesh(mesh),
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 
 namespace RIN {
@@ -25,9 +26,12 @@ namespace RIN {
 		BC3_UNORM_SRGB, // Block compressed RGBA
 		BC4_UNORM, // Block compressed R
 		BC5_UNORM, // Block compressed RG
-		BC6H_FLOAT, // Block compressed RGB
+		BC6H_FLOAT, // Block compressed signed RGB
 		BC7_UNORM, // Block compressed RGBA
-		BC7_UNORM_SRGB // Block compressed RGBA
+		BC7_UNORM_SRGB, // Block compressed RGBA
+		BC1_UNORM, // Block compressed RGB
+		BC1_UNORM_SRGB, // Block compressed RGB
+		BC6H_UFLOAT // Block compressed unsigned RGB
 	};
 
 	class Texture {
@@ -77,10 +81,13 @@ namespace RIN {
 			case TEXTURE_FORMAT::BC3_UNORM_SRGB:
 			case TEXTURE_FORMAT::BC5_UNORM:
 			case TEXTURE_FORMAT::BC6H_FLOAT:
+			case TEXTURE_FORMAT::BC6H_UFLOAT:
 			case TEXTURE_FORMAT::BC7_UNORM:
 			case TEXTURE_FORMAT::BC7_UNORM_SRGB:
 				return std::max((uint64_t)1, ((uint64_t)width + 3) / 4) * 16;
 			case TEXTURE_FORMAT::BC4_UNORM:
+			case TEXTURE_FORMAT::BC1_UNORM:
+			case TEXTURE_FORMAT::BC1_UNORM_SRGB:
 				return std::max((uint64_t)1, ((uint64_t)width + 3) / 4) * 8;
 			}
 			return 0;
@@ -106,8 +113,11 @@ namespace RIN {
 			case TEXTURE_FORMAT::BC4_UNORM:
 			case TEXTURE_FORMAT::BC5_UNORM:
 			case TEXTURE_FORMAT::BC6H_FLOAT:
+			case TEXTURE_FORMAT::BC6H_UFLOAT:
 			case TEXTURE_FORMAT::BC7_UNORM:
 			case TEXTURE_FORMAT::BC7_UNORM_SRGB:
+			case TEXTURE_FORMAT::BC1_UNORM:
+			case TEXTURE_FORMAT::BC1_UNORM_SRGB:
 				return (height + 3) / 4;
 			}
 			return 0;
@@ -134,8 +144,11 @@ namespace RIN {
 			case TEXTURE_FORMAT::BC4_UNORM:
 			case TEXTURE_FORMAT::BC5_UNORM:
 			case TEXTURE_FORMAT::BC6H_FLOAT:
+			case TEXTURE_FORMAT::BC6H_UFLOAT:
 			case TEXTURE_FORMAT::BC7_UNORM:
 			case TEXTURE_FORMAT::BC7_UNORM_SRGB:
+			case TEXTURE_FORMAT::BC1_UNORM:
+			case TEXTURE_FORMAT::BC1_UNORM_SRGB:
 				return 4;
 			}
 			return 0;
@@ -162,13 +175,24 @@ namespace RIN {
 			case TEXTURE_FORMAT::BC4_UNORM:
 			case TEXTURE_FORMAT::BC5_UNORM:
 			case TEXTURE_FORMAT::BC6H_FLOAT:
+			case TEXTURE_FORMAT::BC6H_UFLOAT:
 			case TEXTURE_FORMAT::BC7_UNORM:
 			case TEXTURE_FORMAT::BC7_UNORM_SRGB:
+			case TEXTURE_FORMAT::BC1_UNORM:
+			case TEXTURE_FORMAT::BC1_UNORM_SRGB:
 				return 4;
 			}
 			return 0;
 		}
 
+		// Size of every subresource packed back to back in subresource order
+		static uint64_t getSize(uint32_t width, uint32_t height, uint32_t arraySize, uint32_t mipCount, TEXTURE_FORMAT format) {
+			uint64_t size = 0;
+			for(uint32_t mip = 0; mip < mipCount; ++mip)
+				size += getRowPitch(std::max(width >> mip, (uint32_t)1), format) * getRowCount(std::max(height >> mip, (uint32_t)1), format);
+			return size * arraySize;
+		}
+
 		uint64_t getRowPitch(uint32_t width) {
 			return getRowPitch(width, format);
 		}
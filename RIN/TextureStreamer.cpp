@@ -0,0 +1,132 @@
+#include "TextureStreamer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace RIN {
+	TextureStreamer::TextureStreamer(uint64_t budget, uint64_t evictFrames, uint32_t tailSize) :
+		budget(budget),
+		evictFrames(evictFrames),
+		tailSize(tailSize)
+	{}
+
+	uint64_t TextureStreamer::getSize(TEXTURE_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount, uint32_t mip) {
+		uint64_t size = 0;
+		for(uint32_t i = mip; i < mipCount; ++i) {
+			uint32_t mipWidth = std::max(width >> i, (uint32_t)1);
+			uint32_t mipHeight = std::max(height >> i, (uint32_t)1);
+			size += Texture::getRowPitch(mipWidth, format) * Texture::getRowCount(mipHeight, format);
+		}
+
+		return size;
+	}
+
+	uint32_t TextureStreamer::getTailMip(TEXTURE_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount) const {
+		// The most detailed mip of a block compressed resource must be a whole number of blocks
+		auto isBlockAligned = [&](uint32_t mip) {
+			return
+				!(std::max(width >> mip, (uint32_t)1) % Texture::getBlockWidth(format)) &&
+				!(std::max(height >> mip, (uint32_t)1) % Texture::getBlockHeight(format));
+		};
+
+		uint32_t mip = 0;
+		while(mip < mipCount - 1 && std::max(width >> mip, height >> mip) > tailSize && isBlockAligned(mip + 1))
+			++mip;
+
+		return mip;
+	}
+
+	uint32_t TextureStreamer::getDesiredMip(uint32_t width, uint32_t height, uint32_t mipCount, float projectedSize) {
+		if(projectedSize <= 0.0f) return mipCount - 1;
+
+		// Texels of mip 0 covering each pixel along the longest side
+		float ratio = std::max(width, height) / projectedSize;
+		if(ratio <= 1.0f) return 0;
+
+		float mip = std::floor(std::log2(ratio));
+		if(mip >= (float)(mipCount - 1)) return mipCount - 1;
+
+		return (uint32_t)mip;
+	}
+
+	void TextureStreamer::update(Entry* entries, uint32_t entryCount, uint64_t frame, std::vector<Change>& changes) const {
+		auto getEntrySize = [](const Entry& entry, uint32_t mip) {
+			return getSize(entry.format, entry.width, entry.height, entry.mipCount, mip);
+		};
+
+		// Memory in use, and the part of it pending evictions will free once they are applied
+		uint64_t used = 0, released = 0;
+		for(uint32_t i = 0; i < entryCount; ++i) {
+			Entry& entry = entries[i];
+			if(!entry.width) continue;
+
+			if(entry.pending) {
+				used += getEntrySize(entry, std::min(entry.residentMip, entry.pendingMip));
+				if(entry.pendingMip > entry.residentMip) released += getEntrySize(entry, entry.residentMip) - getEntrySize(entry, entry.pendingMip);
+			} else used += getEntrySize(entry, entry.residentMip);
+
+			if(entry.desiredMip <= entry.residentMip) entry.usedFrame = frame;
+		}
+
+		// Returns false if the entry has no mips which are not needed
+		auto evict = [&](uint32_t index) {
+			Entry& entry = entries[index];
+			uint32_t mip = std::min(entry.desiredMip, entry.tailMip);
+			if(mip <= entry.residentMip) return false;
+
+			released += getEntrySize(entry, entry.residentMip) - getEntrySize(entry, mip);
+			entry.pending = true;
+			entry.pendingMip = mip;
+			changes.push_back({ index, mip });
+
+			return true;
+		};
+
+		// Evict mips which have not been needed for a while
+		for(uint32_t i = 0; i < entryCount; ++i) {
+			const Entry& entry = entries[i];
+			if(!entry.width || entry.pending) continue;
+
+			if(frame - entry.usedFrame >= evictFrames) evict(i);
+		}
+
+		// Upgrade the entries missing the most mips first
+		std::vector<uint32_t> upgrades;
+		for(uint32_t i = 0; i < entryCount; ++i) {
+			const Entry& entry = entries[i];
+			if(entry.width && !entry.pending && entry.desiredMip < entry.residentMip)
+				upgrades.push_back(i);
+		}
+
+		std::stable_sort(upgrades.begin(), upgrades.end(), [entries](uint32_t a, uint32_t b) {
+			return entries[a].residentMip - entries[a].desiredMip > entries[b].residentMip - entries[b].desiredMip;
+		});
+
+		for(uint32_t index : upgrades) {
+			Entry& entry = entries[index];
+			uint64_t size = getEntrySize(entry, entry.desiredMip) - getEntrySize(entry, entry.residentMip);
+
+			// Make room by evicting the least recently needed mips, the upgrade
+			// waits until the evictions are applied
+			while(used - released + size > budget) {
+				uint32_t lru = entryCount;
+				for(uint32_t i = 0; i < entryCount; ++i) {
+					const Entry& other = entries[i];
+					if(!other.width || other.pending || std::min(other.desiredMip, other.tailMip) <= other.residentMip) continue;
+
+					if(lru == entryCount || other.usedFrame < entries[lru].usedFrame) lru = i;
+				}
+
+				if(lru == entryCount) break;
+				evict(lru);
+			}
+
+			if(used + size > budget) continue;
+
+			used += size;
+			entry.pending = true;
+			entry.pendingMip = entry.desiredMip;
+			changes.push_back({ index, entry.desiredMip });
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Texture.hpp"
+
+namespace RIN {
+	/*
+	Decides which mips of streamed textures should be resident
+
+	The least detailed mips, up to the tail mip, are always resident,
+	more detailed mips are requested from the desired mip, which is
+	estimated from the screen space size of the objects using the
+	texture, mips which have not been needed for evictFrames frames
+	are evicted, and upgrades never exceed the memory budget, evicting
+	the least recently needed mips first if they would
+	Pending changes count as the larger of the two resources, since the
+	old one is kept until the new one is swapped in, so the memory an
+	eviction frees is only available once its change is applied
+
+	This does not depend on the graphics API, applying the changes
+	is left to the renderer
+
+	Thread Safety:
+	TextureStreamer::getSize is thread-safe
+	TextureStreamer::getTailMip is thread-safe
+	TextureStreamer::getDesiredMip is thread-safe
+	TextureStreamer::update is not thread-safe
+	*/
+	class TextureStreamer {
+		const uint64_t budget;
+		const uint64_t evictFrames;
+		const uint32_t tailSize;
+	public:
+		struct Entry {
+			uint32_t width; // Width of mip 0, 0 if the entry is unused
+			uint32_t height; // Height of mip 0
+			uint32_t mipCount;
+			TEXTURE_FORMAT format;
+			uint32_t tailMip; // Least detailed mip which is always resident
+			uint32_t residentMip; // Most detailed resident mip
+			uint32_t desiredMip; // Set every frame before update
+			uint64_t usedFrame; // Last frame the most detailed resident mip was needed
+			bool pending; // Set while a change is being applied
+			uint32_t pendingMip; // Most detailed resident mip once the pending change is applied
+		};
+
+		struct Change {
+			uint32_t index;
+			uint32_t mip; // New most detailed resident mip
+		};
+
+		TextureStreamer(uint64_t budget, uint64_t evictFrames, uint32_t tailSize);
+		TextureStreamer(const TextureStreamer&) = delete;
+		~TextureStreamer() = default;
+		// Tightly packed size of the mips from mip to the end of the chain
+		static uint64_t getSize(TEXTURE_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount, uint32_t mip);
+		/*
+		Block compressed textures stop at the last mip which is a whole number
+		of blocks, so every mip from 0 to the tail mip can start a resource
+		*/
+		uint32_t getTailMip(TEXTURE_FORMAT format, uint32_t width, uint32_t height, uint32_t mipCount) const;
+		// projectedSize is the size of the object on screen in pixels
+		static uint32_t getDesiredMip(uint32_t width, uint32_t height, uint32_t mipCount, float projectedSize);
+		// Marks the entries of the returned changes as pending
+		void update(Entry* entries, uint32_t entryCount, uint64_t frame, std::vector<Change>& changes) const;
+	};
+}
\ No newline at end of file
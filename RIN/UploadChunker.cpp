@@ -0,0 +1,102 @@
+#include "UploadChunker.hpp"
+
+#include <algorithm>
+
+namespace RIN {
+	static uint64_t alignTo(uint64_t x, uint64_t alignment) {
+		return (x + alignment - 1) / alignment * alignment;
+	}
+
+	UploadChunker::UploadChunker(uint64_t chunkSize, uint64_t pitchAlignment, uint64_t placementAlignment) :
+		chunkSize(chunkSize),
+		pitchAlignment(pitchAlignment),
+		placementAlignment(placementAlignment)
+	{}
+
+	std::vector<UploadChunker::BufferChunk> UploadChunker::chunkBuffer(uint64_t size) const {
+		std::vector<BufferChunk> chunks;
+		chunks.reserve((size + chunkSize - 1) / chunkSize);
+
+		for(uint64_t offset = 0; offset < size; offset += chunkSize)
+			chunks.push_back({ offset, std::min(chunkSize, size - offset) });
+
+		return chunks;
+	}
+
+	std::vector<UploadChunker::TextureChunk> UploadChunker::chunkTexture(
+		TEXTURE_FORMAT format,
+		uint32_t width,
+		uint32_t height,
+		uint16_t arraySize,
+		uint32_t mipCount
+	) const {
+		std::vector<TextureChunk> chunks;
+
+		// Reserve space to align the start of the chunk
+		if(chunkSize <= placementAlignment) return chunks;
+		const uint64_t capacity = chunkSize - placementAlignment;
+
+		uint32_t blockWidth = Texture::getBlockWidth(format);
+		uint32_t blockHeight = Texture::getBlockHeight(format);
+
+		TextureChunk chunk{};
+		uint64_t dataOffset = 0;
+		uint32_t subresource = 0;
+
+		for(uint16_t slice = 0; slice < arraySize; ++slice) {
+			for(uint32_t mip = 0; mip < mipCount; ++mip, ++subresource) {
+				uint32_t sliceWidth = std::max(width >> mip, (uint32_t)1);
+				uint32_t sliceHeight = std::max(height >> mip, (uint32_t)1);
+				uint64_t pitch = Texture::getRowPitch(sliceWidth, format);
+				uint64_t alignedPitch = alignTo(pitch, pitchAlignment);
+				uint32_t rowCount = Texture::getRowCount(sliceHeight, format);
+
+				uint32_t row = 0;
+				while(row < rowCount) {
+					// Each region starts on a placement boundary
+					uint64_t uploadOffset = alignTo(chunk.size, placementAlignment);
+					uint64_t rowsFit = uploadOffset < capacity ? (capacity - uploadOffset) / alignedPitch : 0;
+
+					if(!rowsFit) {
+						// A single row will never fit
+						if(chunk.regions.empty()) return {};
+
+						chunk.size += placementAlignment;
+						chunks.push_back(std::move(chunk));
+						chunk = {};
+						continue;
+					}
+
+					uint32_t regionRows = (uint32_t)std::min(rowsFit, (uint64_t)(rowCount - row));
+
+					TextureRegion region{};
+					region.subresource = subresource;
+					region.y = row * blockHeight;
+					region.width = (uint32_t)alignTo(sliceWidth, blockWidth);
+					region.height = regionRows * blockHeight;
+					region.rowCount = regionRows;
+					region.pitch = pitch;
+					region.alignedPitch = alignedPitch;
+					region.dataOffset = dataOffset;
+					region.uploadOffset = uploadOffset;
+					chunk.regions.push_back(region);
+
+					chunk.size = uploadOffset + regionRows * alignedPitch;
+					dataOffset += regionRows * pitch;
+					row += regionRows;
+				}
+			}
+		}
+
+		if(!chunk.regions.empty()) {
+			chunk.size += placementAlignment;
+			chunks.push_back(std::move(chunk));
+		}
+
+		return chunks;
+	}
+
+	uint64_t UploadChunker::getChunkSize() const {
+		return chunkSize;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Texture.hpp"
+
+namespace RIN {
+	/*
+	Splits uploads which are too large to fit in a single frame of the
+	upload stream into chunks which can be spread across several frames
+
+	Buffers are split into byte ranges, textures are split by subresource
+	and then by row range, so that every chunk fits in chunkSize bytes
+	of upload memory, including the slack needed to align its start
+
+	This does not depend on the graphics API, alignment requirements
+	are passed in by the renderer
+
+	Thread Safety:
+	UploadChunker::chunkBuffer is thread-safe
+	UploadChunker::chunkTexture is thread-safe
+	UploadChunker::getChunkSize is thread-safe
+	*/
+	class UploadChunker {
+		const uint64_t chunkSize;
+		const uint64_t pitchAlignment;
+		const uint64_t placementAlignment;
+	public:
+		struct BufferChunk {
+			uint64_t offset; // Offset from the start of the source and destination
+			uint64_t size;
+		};
+
+		// A range of rows of a single subresource
+		struct TextureRegion {
+			uint32_t subresource;
+			uint32_t y; // First texel row in the subresource, always a multiple of the block height
+			uint32_t width; // Footprint width in texels
+			uint32_t height; // Footprint height in texels
+			uint32_t rowCount; // Row count in blocks
+			uint64_t pitch; // Tightly packed row pitch of the source data
+			uint64_t alignedPitch; // Row pitch in upload memory
+			uint64_t dataOffset; // Offset from the start of the source data
+			uint64_t uploadOffset; // Offset from the aligned start of the chunk
+		};
+
+		struct TextureChunk {
+			std::vector<TextureRegion> regions;
+			uint64_t size; // Upload memory required, including alignment slack
+		};
+
+		UploadChunker(uint64_t chunkSize, uint64_t pitchAlignment, uint64_t placementAlignment);
+		UploadChunker(const UploadChunker&) = delete;
+		~UploadChunker() = default;
+		std::vector<BufferChunk> chunkBuffer(uint64_t size) const;
+		// Returns no chunks if a single row of the texture does not fit in a chunk
+		std::vector<TextureChunk> chunkTexture(
+			TEXTURE_FORMAT format,
+			uint32_t width,
+			uint32_t height,
+			uint16_t arraySize,
+			uint32_t mipCount
+		) const;
+		uint64_t getChunkSize() const;
+	};
+}
\ No newline at end of file
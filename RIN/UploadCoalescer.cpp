@@ -0,0 +1,36 @@
+#include "UploadCoalescer.hpp"
+
+namespace RIN {
+	bool UploadCoalescer::Run::append(const void* destination, uint64_t offset, uint64_t size) {
+		if(!destination) return false;
+
+		if(!requestCount) {
+			Run::destination = destination;
+			Run::offset = offset;
+		} else if(destination != Run::destination || offset != Run::offset + Run::size) {
+			return false;
+		}
+
+		Run::size += size;
+		++requestCount;
+
+		return true;
+	}
+
+	UploadCoalescer::UploadCoalescer() : copyCount(0), requestCount(0) {}
+
+	void UploadCoalescer::record(const Run& run) {
+		if(!run.requestCount) return;
+
+		// The counters are only read for statistics so relaxed is enough
+		copyCount.fetch_add(1, std::memory_order_relaxed);
+		requestCount.fetch_add(run.requestCount, std::memory_order_relaxed);
+	}
+
+	UploadStats UploadCoalescer::getStats() const {
+		UploadStats stats;
+		stats.copyCount = copyCount.load(std::memory_order_relaxed);
+		stats.requestCount = requestCount.load(std::memory_order_relaxed);
+		return stats;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+
+#include "UploadStats.hpp"
+
+namespace RIN {
+	/*
+	Batches buffer uploads whose destination ranges are contiguous in
+	the same buffer so that they can be staged contiguously and issued
+	as a single copy
+
+	Destinations are opaque, the renderer passes in its buffer pointers
+
+	Thread Safety:
+	UploadCoalescer::Run::append is not thread-safe
+	UploadCoalescer::record is thread-safe
+	UploadCoalescer::getStats is thread-safe
+	*/
+	class UploadCoalescer {
+		std::atomic_uint64_t copyCount;
+		std::atomic_uint64_t requestCount;
+	public:
+		struct Run {
+			const void* destination = nullptr;
+			uint64_t offset = 0;
+			uint64_t size = 0;
+			uint32_t requestCount = 0;
+
+			// Returns false and leaves the run unchanged if the range does not
+			// start where the run ends in the same destination
+			bool append(const void* destination, uint64_t offset, uint64_t size);
+		};
+
+		UploadCoalescer();
+		UploadCoalescer(const UploadCoalescer&) = delete;
+		~UploadCoalescer() = default;
+		// Call once for every copy issued
+		void record(const Run& run);
+		UploadStats getStats() const;
+	};
+}
\ No newline at end of file
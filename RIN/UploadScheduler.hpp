@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <queue>
+#include <set>
+#include <utility>
+
+namespace RIN {
+	/*
+	Orders upload requests by priority instead of submission order
+
+	Requests are grouped into batches, one for each upload, and the
+	requests of a batch are always served in the order they were pushed
+	Batches are served from the highest priority down, equal priorities
+	are served in submission order
+
+	A batch which has waited at least maxWaitFrames frames is served
+	before any other batch so that low priorities are never starved
+
+	Thread Safety:
+	UploadScheduler is not thread-safe
+	*/
+	template<class T> class UploadScheduler {
+		struct Batch {
+			float priority;
+			uint64_t frame; // Frame the batch was submitted on
+			std::queue<T> requests;
+		};
+
+		const uint64_t maxWaitFrames;
+		uint64_t frame = 0;
+		uint64_t sequence = 0;
+		uint64_t current = 0; // Batch which requests are pushed into
+		float currentPriority = 0.0f;
+		bool currentOpen = false;
+		// Keyed by sequence, which is also the order the batches are starved in
+		std::map<uint64_t, Batch> batches;
+		// Negated priority so that the highest priority comes first
+		std::set<std::pair<float, uint64_t>> order;
+
+		typename std::map<uint64_t, Batch>::iterator select() {
+			auto oldest = batches.begin();
+			if(frame - oldest->second.frame >= maxWaitFrames) return oldest;
+
+			return batches.find(order.begin()->second);
+		}
+	public:
+		// Served before every other priority, in submission order
+		static constexpr float IMMEDIATE = std::numeric_limits<float>::infinity();
+
+		UploadScheduler(uint64_t maxWaitFrames) :
+			maxWaitFrames(maxWaitFrames)
+		{}
+
+		UploadScheduler(const UploadScheduler&) = delete;
+		~UploadScheduler() = default;
+
+		// Following pushes go into a new batch with this priority
+		void beginBatch(float priority) {
+			currentPriority = priority;
+			currentOpen = false;
+		}
+
+		void push(T request) {
+			// The batch is only created once it has a request, and it is
+			// recreated if it was served completely in the meantime
+			auto it = currentOpen ? batches.find(current) : batches.end();
+			if(it == batches.end()) {
+				current = sequence++;
+				currentOpen = true;
+				it = batches.emplace(current, Batch{ currentPriority, frame, {} }).first;
+				order.insert({ -currentPriority, current });
+			}
+
+			it->second.requests.push(std::move(request));
+		}
+
+		bool empty() const {
+			return batches.empty();
+		}
+
+		// Must not be called when empty
+		T& front() {
+			return select()->second.requests.front();
+		}
+
+		// Must not be called when empty
+		void pop() {
+			auto it = select();
+			it->second.requests.pop();
+
+			if(it->second.requests.empty()) {
+				order.erase({ -it->second.priority, it->first });
+				batches.erase(it);
+			}
+		}
+
+		// Ages every batch by a frame
+		void nextFrame() {
+			++frame;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RIN {
+	// Cumulative upload stream counters since the renderer was created
+	struct UploadStats {
+		uint64_t copyCount = 0; // Buffer copies issued on the copy queues
+		uint64_t requestCount = 0; // Buffer upload requests served by those copies
+	};
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include "VertexData.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define VERTEX_DATA_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace RIN {
+	static_assert(sizeof(StaticVertex) == 28, "StaticVertex layout changed");
+	static_assert(sizeof(QuantizedStaticVertex) == 16, "QuantizedStaticVertex must stay 16 bytes");
+
+	constexpr float SNORM16_SCALE = 32767.0f;
+	constexpr float SNORM8_SCALE = 127.0f;
+	// 2^112, rebiases a half exponent which was shifted into a float
+	constexpr uint32_t HALF_EXPONENT_SCALE = 0x77800000;
+
+	/*
+	The scalar functions mirror the vector path operation for operation,
+	so the results do not depend on how the vertices fall into blocks
+	*/
+	static float halfToFloat(uint16_t half) {
+		uint32_t bits = (uint32_t)(half & 0x7FFF) << 13;
+		float value, scale;
+		memcpy(&value, &bits, sizeof(value));
+		memcpy(&scale, &HALF_EXPONENT_SCALE, sizeof(scale));
+		value *= scale;
+
+		memcpy(&bits, &value, sizeof(bits));
+		bits |= (uint32_t)(half & 0x8000) << 16;
+		memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	static int32_t quantizeSNORM(float value, float scale) {
+		return (int32_t)std::nearbyint(std::min(std::max(value, -1.0f), 1.0f) * scale);
+	}
+
+	static void encodeOctahedral(float x, float y, float z, int8_t* encoded) {
+		// Project onto the octahedron
+		float sum = std::fabs(x) + std::fabs(y) + std::fabs(z);
+		float invSum = sum > 0.0f ? 1.0f / sum : 0.0f;
+		x *= invSum;
+		y *= invSum;
+		z *= invSum;
+
+		// Fold the lower hemisphere over the diagonals
+		if(z < 0.0f) {
+			float foldX = (1.0f - std::fabs(y)) * std::copysign(1.0f, x);
+			float foldY = (1.0f - std::fabs(x)) * std::copysign(1.0f, y);
+			x = foldX;
+			y = foldY;
+		}
+
+		encoded[0] = (int8_t)quantizeSNORM(x, SNORM8_SCALE);
+		encoded[1] = (int8_t)quantizeSNORM(y, SNORM8_SCALE);
+	}
+
+#ifdef VERTEX_DATA_SSE2
+	static __m128 halfToFloat(__m128i halves) {
+		__m128i bits = _mm_slli_epi32(_mm_and_si128(halves, _mm_set1_epi32(0x7FFF)), 13);
+		__m128 value = _mm_mul_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(_mm_set1_epi32(HALF_EXPONENT_SCALE)));
+		__m128i sign = _mm_slli_epi32(_mm_and_si128(halves, _mm_set1_epi32(0x8000)), 16);
+		return _mm_or_ps(value, _mm_castsi128_ps(sign));
+	}
+
+	static __m128i quantizeSNORM(__m128 value, float scale) {
+		value = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+		return _mm_cvtps_epi32(_mm_mul_ps(value, _mm_set1_ps(scale)));
+	}
+
+	// Returns the x and y SNORM8 bytes of each lane in the low 16 bits
+	static __m128i encodeOctahedral(__m128 x, __m128 y, __m128 z) {
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		__m128 sum = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(signMask, x), _mm_andnot_ps(signMask, y)), _mm_andnot_ps(signMask, z));
+		__m128 invSum = _mm_and_ps(_mm_div_ps(one, sum), _mm_cmpgt_ps(sum, _mm_setzero_ps()));
+		x = _mm_mul_ps(x, invSum);
+		y = _mm_mul_ps(y, invSum);
+		z = _mm_mul_ps(z, invSum);
+
+		__m128 foldX = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, y)), _mm_or_ps(one, _mm_and_ps(signMask, x)));
+		__m128 foldY = _mm_mul_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, x)), _mm_or_ps(one, _mm_and_ps(signMask, y)));
+		__m128 lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+		x = _mm_or_ps(_mm_and_ps(lower, foldX), _mm_andnot_ps(lower, x));
+		y = _mm_or_ps(_mm_and_ps(lower, foldY), _mm_andnot_ps(lower, y));
+
+		__m128i encodedX = _mm_and_si128(quantizeSNORM(x, SNORM8_SCALE), _mm_set1_epi32(0xFF));
+		__m128i encodedY = _mm_and_si128(quantizeSNORM(y, SNORM8_SCALE), _mm_set1_epi32(0xFF));
+		return _mm_or_si128(encodedX, _mm_slli_epi32(encodedY, 8));
+	}
+#endif
+
+	void quantizeStaticVertices(
+		const StaticVertex* vertices,
+		uint64_t vertexCount,
+		const BoundingSphere& boundingSphere,
+		QuantizedStaticVertex* quantized
+	) {
+		const float invRadius = boundingSphere.radius > 0.0f ? 1.0f / boundingSphere.radius : 0.0f;
+		uint64_t i = 0;
+
+	#ifdef VERTEX_DATA_SSE2
+		/*
+		Blocks of 4 vertices are transposed so that each register holds
+		one component of every vertex, the halves are widened in pairs
+		of rows since the 16 bytes after the position cover all 8 of them
+		*/
+		const __m128 centerX = _mm_set1_ps(boundingSphere.center.x);
+		const __m128 centerY = _mm_set1_ps(boundingSphere.center.y);
+		const __m128 centerZ = _mm_set1_ps(boundingSphere.center.z);
+		const __m128 scale = _mm_set1_ps(invRadius);
+		const __m128i zero = _mm_setzero_si128();
+
+		for(; i + 4 <= vertexCount; i += 4) {
+			const char* block = (const char*)(vertices + i);
+
+			__m128 positionX = _mm_loadu_ps((const float*)block);
+			__m128 positionY = _mm_loadu_ps((const float*)(block + sizeof(StaticVertex)));
+			__m128 positionZ = _mm_loadu_ps((const float*)(block + sizeof(StaticVertex) * 2));
+			__m128 unused = _mm_loadu_ps((const float*)(block + sizeof(StaticVertex) * 3));
+			_MM_TRANSPOSE4_PS(positionX, positionY, positionZ, unused);
+
+			// normal.xyz, tex.x and tangent.xyz, tex.y of each vertex
+			__m128 normalX, normalY, normalZ, tangentX, tangentY, tangentZ;
+			{
+				__m128i halves[4];
+				for(uint32_t k = 0; k < 4; ++k)
+					halves[k] = _mm_loadu_si128((const __m128i*)(block + sizeof(StaticVertex) * k + offsetof(StaticVertex, normalX)));
+
+				normalX = halfToFloat(_mm_unpacklo_epi16(halves[0], zero));
+				normalY = halfToFloat(_mm_unpacklo_epi16(halves[1], zero));
+				normalZ = halfToFloat(_mm_unpacklo_epi16(halves[2], zero));
+				unused = halfToFloat(_mm_unpacklo_epi16(halves[3], zero));
+				_MM_TRANSPOSE4_PS(normalX, normalY, normalZ, unused);
+
+				tangentX = halfToFloat(_mm_unpackhi_epi16(halves[0], zero));
+				tangentY = halfToFloat(_mm_unpackhi_epi16(halves[1], zero));
+				tangentZ = halfToFloat(_mm_unpackhi_epi16(halves[2], zero));
+				unused = halfToFloat(_mm_unpackhi_epi16(halves[3], zero));
+				_MM_TRANSPOSE4_PS(tangentX, tangentY, tangentZ, unused);
+			}
+
+			__m128i x = quantizeSNORM(_mm_mul_ps(_mm_sub_ps(positionX, centerX), scale), SNORM16_SCALE);
+			__m128i y = quantizeSNORM(_mm_mul_ps(_mm_sub_ps(positionY, centerY), scale), SNORM16_SCALE);
+			__m128i z = quantizeSNORM(_mm_mul_ps(_mm_sub_ps(positionZ, centerZ), scale), SNORM16_SCALE);
+
+			// Interleave back into x, y, z, 0 per vertex
+			__m128i xy = _mm_packs_epi32(x, y);
+			__m128i z0 = _mm_packs_epi32(z, zero);
+			__m128i xz = _mm_unpacklo_epi16(xy, z0);
+			__m128i yw = _mm_unpackhi_epi16(xy, z0);
+			__m128i positions01 = _mm_unpacklo_epi16(xz, yw);
+			__m128i positions23 = _mm_unpackhi_epi16(xz, yw);
+
+			_mm_storel_epi64((__m128i*)quantized[i].position, positions01);
+			_mm_storel_epi64((__m128i*)quantized[i + 1].position, _mm_srli_si128(positions01, 8));
+			_mm_storel_epi64((__m128i*)quantized[i + 2].position, positions23);
+			_mm_storel_epi64((__m128i*)quantized[i + 3].position, _mm_srli_si128(positions23, 8));
+
+			__m128i directions = _mm_or_si128(
+				encodeOctahedral(normalX, normalY, normalZ),
+				_mm_slli_epi32(encodeOctahedral(tangentX, tangentY, tangentZ), 16)
+			);
+
+			uint32_t packed[4];
+			_mm_storeu_si128((__m128i*)packed, directions);
+			for(uint32_t k = 0; k < 4; ++k) {
+				QuantizedStaticVertex& vertex = quantized[i + k];
+				memcpy(vertex.normal, packed + k, sizeof(uint32_t));
+				vertex.texX = vertices[i + k].texX;
+				vertex.texY = vertices[i + k].texY;
+			}
+		}
+	#endif
+
+		for(; i < vertexCount; ++i) {
+			const StaticVertex& vertex = vertices[i];
+			QuantizedStaticVertex& output = quantized[i];
+
+			output.position[0] = (int16_t)quantizeSNORM((vertex.position.x - boundingSphere.center.x) * invRadius, SNORM16_SCALE);
+			output.position[1] = (int16_t)quantizeSNORM((vertex.position.y - boundingSphere.center.y) * invRadius, SNORM16_SCALE);
+			output.position[2] = (int16_t)quantizeSNORM((vertex.position.z - boundingSphere.center.z) * invRadius, SNORM16_SCALE);
+			output.position[3] = 0;
+
+			encodeOctahedral(halfToFloat(vertex.normalX), halfToFloat(vertex.normalY), halfToFloat(vertex.normalZ), output.normal);
+			encodeOctahedral(halfToFloat(vertex.tangentX), halfToFloat(vertex.tangentY), halfToFloat(vertex.tangentZ), output.tangent);
+			output.texX = vertex.texX;
+			output.texY = vertex.texY;
+		}
+	}
+}
\ No newline at end of file
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstdint>
+
 #include <DirectXMath.h>
 #include <DirectXPackedVector.h>
 
+#include "BoundingSphere.hpp"
+
 namespace RIN {
 	// Vertex definitions
 	// These are used to enforce that meshes which are created
@@ -46,4 +50,27 @@ namespace RIN {
 		DirectX::PackedVector::XMUBYTE4 boneIndices;
 		DirectX::PackedVector::XMUBYTEN4 boneWeights;
 	};
+
+	/*
+	Compact layout of a StaticVertex, used when Config::quantizeStaticVertices is set
+
+	The position is stored relative to the bounding sphere of the mesh,
+	so the precision scales with the size of the mesh, the normal and
+	tangent are octahedral encoded, the texture coordinates are unchanged
+	*/
+	struct QuantizedStaticVertex {
+		int16_t position[4]; // SNORM (position - center) / radius, w is unused
+		int8_t normal[2]; // SNORM octahedral
+		int8_t tangent[2]; // SNORM octahedral
+		DirectX::PackedVector::HALF texX;
+		DirectX::PackedVector::HALF texY;
+	};
+
+	// The vertices must lie inside the bounding sphere, normals and tangents must be finite
+	void quantizeStaticVertices(
+		const StaticVertex* vertices,
+		uint64_t vertexCount,
+		const BoundingSphere& boundingSphere,
+		QuantizedStaticVertex* quantized
+	);
 }
\ No newline at end of file
@@ -1,1341 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-; shader hash: 4c1d0f2fbb6c00dce8ff330347ee983e
-;
-; Pipeline Runtime Information: 
-;
-;
-;
-; Buffer Definitions:
-;
-; cbuffer depthHierarchySize
-; {
-;
-;   struct depthHierarchySize
-;   {
-;
-;       struct struct.Size
-;       {
-;
-;           uint2 size;                               ; Offset:    0
-;       
-;       } depthHierarchySize;                         ; Offset:    0
-;
-;   
-;   } depthHierarchySize;                             ; Offset:    0 Size:     8
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for dynamicObjectBuffer
-; {
-;
-;   struct dx.alignment.legacy.struct.DynamicObject
-;   {
-;
-;       column_major float4x4 worldMatrix;            ; Offset:    0
-;       column_major float4x4 invWorldMatrix;         ; Offset:   64
-;       struct struct.BoundingSphere
-;       {
-;
-;           float3 center;                            ; Offset:  128
-;           float radius;                             ; Offset:  140
-;       
-;       } boundingSphere;                             ; Offset:  128
-;
-;       struct struct.LOD
-;       {
-;
-;           uint startIndex;                          ; Offset:  144
-;           uint indexCount;                          ; Offset:  148
-;           uint vertexOffset;                        ; Offset:  152
-;       
-;       } lods[3];;                                   ; Offset:  144
-;
-;       struct struct.Material
-;       {
-;
-;           uint baseColorID;                         ; Offset:  180
-;           uint normalID;                            ; Offset:  184
-;           uint roughnessAOID;                       ; Offset:  188
-;           uint metallicID;                          ; Offset:  192
-;           uint heightID;                            ; Offset:  196
-;           uint specialID;                           ; Offset:  200
-;       
-;       } material;                                   ; Offset:  180
-;
-;       uint flags;                                   ; Offset:  204
-;   
-;   } $Element;                                       ; Offset:    0 Size:   208
-;
-; }
-;
-; Resource bind info for dynamicCommandBuffer
-; {
-;
-;   struct struct.DynamicCommand
-;   {
-;
-;       uint objectID;                                ; Offset:    0
-;       struct struct.anon
-;       {
-;
-;           uint indexCountPerInstance;               ; Offset:    4
-;           uint instanceCount;                       ; Offset:    8
-;           uint startIndexLocation;                  ; Offset:   12
-;           int baseVertexLocation;                   ; Offset:   16
-;           uint startInstanceLocation;               ; Offset:   20
-;       
-;       } drawIndexed;                                ; Offset:    4
-;
-;   
-;   } $Element;                                       ; Offset:    0 Size:    24
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; depthHierarchySize                cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; depthHierarchySampler             sampler      NA          NA      S0             s0     1
-; dynamicObjectBuffer               texture  struct         r/o      T0             t0     1
-; depthHierarchy                    texture     f32          2d      T1             t1     1
-; dynamicCommandBuffer                  UAV  struct     r/w+cnt      U0             u0     1
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%"dx.alignment.legacy.class.StructuredBuffer<DynamicObject>" = type { %dx.alignment.legacy.struct.DynamicObject }
-%dx.alignment.legacy.struct.DynamicObject = type { [4 x <4 x float>], [4 x <4 x float>], %struct.BoundingSphere, [3 x %struct.LOD], %struct.Material, i32 }
-%struct.BoundingSphere = type { <3 x float>, float }
-%struct.LOD = type { i32, i32, i32 }
-%struct.Material = type { i32, i32, i32, i32, i32, i32 }
-%"class.Texture2D<float>" = type { float, %"class.Texture2D<float>::mips_type" }
-%"class.Texture2D<float>::mips_type" = type { i32 }
-%"class.AppendStructuredBuffer<DynamicCommand>" = type { %struct.DynamicCommand }
-%struct.DynamicCommand = type { i32, %struct.anon }
-%struct.anon = type { i32, i32, i32, i32, i32 }
-%depthHierarchySize = type { %struct.Size }
-%struct.Size = type { <2 x i32> }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-%struct.SamplerState = type { i32 }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 1, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %5 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %6 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %7 = call i32 @dx.op.threadId.i32(i32 93, i32 0)  ; ThreadId(component)
-  %8 = alloca [3 x i32], align 4
-  %9 = alloca [3 x i32], align 4
-  %10 = alloca [3 x i32], align 4
-  %11 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 0)  ; BufferLoad(srv,index,wot)
-  %12 = extractvalue %dx.types.ResRet.f32 %11, 0
-  %13 = extractvalue %dx.types.ResRet.f32 %11, 1
-  %14 = extractvalue %dx.types.ResRet.f32 %11, 2
-  %15 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 16)  ; BufferLoad(srv,index,wot)
-  %16 = extractvalue %dx.types.ResRet.f32 %15, 0
-  %17 = extractvalue %dx.types.ResRet.f32 %15, 1
-  %18 = extractvalue %dx.types.ResRet.f32 %15, 2
-  %19 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 32)  ; BufferLoad(srv,index,wot)
-  %20 = extractvalue %dx.types.ResRet.f32 %19, 0
-  %21 = extractvalue %dx.types.ResRet.f32 %19, 1
-  %22 = extractvalue %dx.types.ResRet.f32 %19, 2
-  %23 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 48)  ; BufferLoad(srv,index,wot)
-  %24 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 128)  ; BufferLoad(srv,index,wot)
-  %25 = extractvalue %dx.types.ResRet.f32 %24, 0
-  %26 = extractvalue %dx.types.ResRet.f32 %24, 1
-  %27 = extractvalue %dx.types.ResRet.f32 %24, 2
-  %28 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 140)  ; BufferLoad(srv,index,wot)
-  %29 = getelementptr [3 x i32], [3 x i32]* %8, i32 0, i32 0
-  %30 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 0
-  %31 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 0
-  %32 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 144)  ; BufferLoad(srv,index,wot)
-  %33 = extractvalue %dx.types.ResRet.i32 %32, 0
-  store i32 %33, i32* %29, align 4
-  %34 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 148)  ; BufferLoad(srv,index,wot)
-  %35 = extractvalue %dx.types.ResRet.i32 %34, 0
-  store i32 %35, i32* %30, align 4
-  %36 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 152)  ; BufferLoad(srv,index,wot)
-  %37 = extractvalue %dx.types.ResRet.i32 %36, 0
-  store i32 %37, i32* %31, align 4
-  %38 = getelementptr [3 x i32], [3 x i32]* %8, i32 0, i32 1
-  %39 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 1
-  %40 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 1
-  %41 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 156)  ; BufferLoad(srv,index,wot)
-  %42 = extractvalue %dx.types.ResRet.i32 %41, 0
-  store i32 %42, i32* %38, align 4
-  %43 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 160)  ; BufferLoad(srv,index,wot)
-  %44 = extractvalue %dx.types.ResRet.i32 %43, 0
-  store i32 %44, i32* %39, align 4
-  %45 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 164)  ; BufferLoad(srv,index,wot)
-  %46 = extractvalue %dx.types.ResRet.i32 %45, 0
-  store i32 %46, i32* %40, align 4
-  %47 = getelementptr [3 x i32], [3 x i32]* %8, i32 0, i32 2
-  %48 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 2
-  %49 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 2
-  %50 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 168)  ; BufferLoad(srv,index,wot)
-  %51 = extractvalue %dx.types.ResRet.i32 %50, 0
-  store i32 %51, i32* %47, align 4
-  %52 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 172)  ; BufferLoad(srv,index,wot)
-  %53 = extractvalue %dx.types.ResRet.i32 %52, 0
-  store i32 %53, i32* %48, align 4
-  %54 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 176)  ; BufferLoad(srv,index,wot)
-  %55 = extractvalue %dx.types.ResRet.i32 %54, 0
-  store i32 %55, i32* %49, align 4
-  %56 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 204)  ; BufferLoad(srv,index,wot)
-  %57 = extractvalue %dx.types.ResRet.i32 %56, 0
-  %58 = and i32 %57, 1
-  %59 = icmp eq i32 %58, 0
-  br i1 %59, label %252, label %60
-
-; <label>:60                                      ; preds = %0
-  %61 = extractvalue %dx.types.ResRet.f32 %28, 0
-  %62 = extractvalue %dx.types.ResRet.f32 %23, 3
-  %63 = extractvalue %dx.types.ResRet.f32 %23, 2
-  %64 = extractvalue %dx.types.ResRet.f32 %23, 1
-  %65 = extractvalue %dx.types.ResRet.f32 %23, 0
-  %66 = extractvalue %dx.types.ResRet.f32 %19, 3
-  %67 = extractvalue %dx.types.ResRet.f32 %15, 3
-  %68 = extractvalue %dx.types.ResRet.f32 %11, 3
-  %69 = call float @dx.op.dot3.f32(i32 55, float %12, float %16, float %20, float %12, float %16, float %20)  ; Dot3(ax,ay,az,bx,by,bz)
-  %70 = call float @dx.op.dot3.f32(i32 55, float %13, float %17, float %21, float %13, float %17, float %21)  ; Dot3(ax,ay,az,bx,by,bz)
-  %71 = call float @dx.op.dot3.f32(i32 55, float %14, float %18, float %22, float %14, float %18, float %22)  ; Dot3(ax,ay,az,bx,by,bz)
-  %72 = call float @dx.op.binary.f32(i32 35, float %70, float %71)  ; FMax(a,b)
-  %73 = call float @dx.op.binary.f32(i32 35, float %69, float %72)  ; FMax(a,b)
-  %74 = call float @dx.op.unary.f32(i32 24, float %73)  ; Sqrt(value)
-  %75 = fmul fast float %74, %61
-  %76 = fmul fast float %25, %12
-  %77 = call float @dx.op.tertiary.f32(i32 46, float %16, float %26, float %76)  ; FMad(a,b,c)
-  %78 = call float @dx.op.tertiary.f32(i32 46, float %20, float %27, float %77)  ; FMad(a,b,c)
-  %79 = fadd fast float %78, %65
-  %80 = fmul fast float %25, %13
-  %81 = call float @dx.op.tertiary.f32(i32 46, float %17, float %26, float %80)  ; FMad(a,b,c)
-  %82 = call float @dx.op.tertiary.f32(i32 46, float %21, float %27, float %81)  ; FMad(a,b,c)
-  %83 = fadd fast float %82, %64
-  %84 = fmul fast float %25, %14
-  %85 = call float @dx.op.tertiary.f32(i32 46, float %18, float %26, float %84)  ; FMad(a,b,c)
-  %86 = call float @dx.op.tertiary.f32(i32 46, float %22, float %27, float %85)  ; FMad(a,b,c)
-  %87 = fadd fast float %86, %63
-  %88 = fmul fast float %25, %68
-  %89 = call float @dx.op.tertiary.f32(i32 46, float %67, float %26, float %88)  ; FMad(a,b,c)
-  %90 = call float @dx.op.tertiary.f32(i32 46, float %66, float %27, float %89)  ; FMad(a,b,c)
-  %91 = fadd fast float %90, %62
-  %92 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %93 = extractvalue %dx.types.CBufRet.f32 %92, 0
-  %94 = extractvalue %dx.types.CBufRet.f32 %92, 1
-  %95 = extractvalue %dx.types.CBufRet.f32 %92, 2
-  %96 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 1)  ; CBufferLoadLegacy(handle,regIndex)
-  %97 = extractvalue %dx.types.CBufRet.f32 %96, 0
-  %98 = extractvalue %dx.types.CBufRet.f32 %96, 1
-  %99 = extractvalue %dx.types.CBufRet.f32 %96, 2
-  %100 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 2)  ; CBufferLoadLegacy(handle,regIndex)
-  %101 = extractvalue %dx.types.CBufRet.f32 %100, 0
-  %102 = extractvalue %dx.types.CBufRet.f32 %100, 1
-  %103 = extractvalue %dx.types.CBufRet.f32 %100, 2
-  %104 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 3)  ; CBufferLoadLegacy(handle,regIndex)
-  %105 = extractvalue %dx.types.CBufRet.f32 %104, 0
-  %106 = extractvalue %dx.types.CBufRet.f32 %104, 1
-  %107 = extractvalue %dx.types.CBufRet.f32 %104, 2
-  %108 = fmul fast float %93, %79
-  %109 = call float @dx.op.tertiary.f32(i32 46, float %97, float %83, float %108)  ; FMad(a,b,c)
-  %110 = call float @dx.op.tertiary.f32(i32 46, float %101, float %87, float %109)  ; FMad(a,b,c)
-  %111 = call float @dx.op.tertiary.f32(i32 46, float %105, float %91, float %110)  ; FMad(a,b,c)
-  %112 = fmul fast float %94, %79
-  %113 = call float @dx.op.tertiary.f32(i32 46, float %98, float %83, float %112)  ; FMad(a,b,c)
-  %114 = call float @dx.op.tertiary.f32(i32 46, float %102, float %87, float %113)  ; FMad(a,b,c)
-  %115 = call float @dx.op.tertiary.f32(i32 46, float %106, float %91, float %114)  ; FMad(a,b,c)
-  %116 = fmul fast float %95, %79
-  %117 = call float @dx.op.tertiary.f32(i32 46, float %99, float %83, float %116)  ; FMad(a,b,c)
-  %118 = call float @dx.op.tertiary.f32(i32 46, float %103, float %87, float %117)  ; FMad(a,b,c)
-  %119 = call float @dx.op.tertiary.f32(i32 46, float %107, float %91, float %118)  ; FMad(a,b,c)
-  %120 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %121 = extractvalue %dx.types.CBufRet.f32 %120, 1
-  %122 = extractvalue %dx.types.CBufRet.f32 %120, 0
-  %123 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 17)  ; CBufferLoadLegacy(handle,regIndex)
-  %124 = extractvalue %dx.types.CBufRet.f32 %123, 3
-  %125 = extractvalue %dx.types.CBufRet.f32 %123, 2
-  %126 = extractvalue %dx.types.CBufRet.f32 %123, 1
-  %127 = extractvalue %dx.types.CBufRet.f32 %123, 0
-  %128 = call float @dx.op.unary.f32(i32 6, float %111)  ; FAbs(value)
-  %129 = call float @dx.op.unary.f32(i32 6, float %115)  ; FAbs(value)
-  %130 = call float @dx.op.dot3.f32(i32 55, float %127, float 0.000000e+00, float %126, float %128, float %129, float %119)  ; Dot3(ax,ay,az,bx,by,bz)
-  %131 = fsub fast float -0.000000e+00, %75
-  %132 = fcmp fast oge float %130, %131
-  %133 = call float @dx.op.dot3.f32(i32 55, float 0.000000e+00, float %125, float %124, float %128, float %129, float %119)  ; Dot3(ax,ay,az,bx,by,bz)
-  %134 = fcmp fast oge float %133, %131
-  %135 = and i1 %132, %134
-  %136 = fsub fast float %119, %75
-  %137 = fcmp fast ole float %136, %122
-  %138 = and i1 %137, %135
-  %139 = fadd fast float %119, %75
-  %140 = fcmp fast oge float %139, %121
-  %141 = and i1 %140, %138
-  %142 = zext i1 %141 to i32
-  br i1 %141, label %143, label %252
-
-; <label>:143                                     ; preds = %60
-  %144 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 4)  ; CBufferLoadLegacy(handle,regIndex)
-  %145 = extractvalue %dx.types.CBufRet.f32 %144, 0
-  %146 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 5)  ; CBufferLoadLegacy(handle,regIndex)
-  %147 = extractvalue %dx.types.CBufRet.f32 %146, 1
-  %148 = fcmp fast ult float %139, %122
-  br i1 %148, label %149, label %183
-
-; <label>:149                                     ; preds = %143
-  %150 = call float @dx.op.dot2.f32(i32 54, float %111, float %119, float %111, float %119)  ; Dot2(ax,ay,bx,by)
-  %151 = fmul fast float %75, %75
-  %152 = fsub fast float %150, %151
-  %153 = call float @dx.op.unary.f32(i32 24, float %152)  ; Sqrt(value)
-  %154 = fmul fast float %153, %111
-  %155 = call float @dx.op.tertiary.f32(i32 46, float %75, float %119, float %154)  ; FMad(a,b,c)
-  %156 = fmul fast float %75, %111
-  %157 = fsub fast float -0.000000e+00, %156
-  %158 = call float @dx.op.tertiary.f32(i32 46, float %153, float %119, float %157)  ; FMad(a,b,c)
-  %159 = call float @dx.op.tertiary.f32(i32 46, float %131, float %119, float %154)  ; FMad(a,b,c)
-  %160 = call float @dx.op.tertiary.f32(i32 46, float %153, float %119, float %156)  ; FMad(a,b,c)
-  %161 = call float @dx.op.dot2.f32(i32 54, float %115, float %119, float %115, float %119)  ; Dot2(ax,ay,bx,by)
-  %162 = fsub fast float %161, %151
-  %163 = call float @dx.op.unary.f32(i32 24, float %162)  ; Sqrt(value)
-  %164 = fmul fast float %163, %115
-  %165 = call float @dx.op.tertiary.f32(i32 46, float %75, float %119, float %164)  ; FMad(a,b,c)
-  %166 = fmul fast float %75, %115
-  %167 = fsub fast float -0.000000e+00, %166
-  %168 = call float @dx.op.tertiary.f32(i32 46, float %163, float %119, float %167)  ; FMad(a,b,c)
-  %169 = call float @dx.op.tertiary.f32(i32 46, float %131, float %119, float %164)  ; FMad(a,b,c)
-  %170 = call float @dx.op.tertiary.f32(i32 46, float %163, float %119, float %166)  ; FMad(a,b,c)
-  %171 = fmul fast float %155, %145
-  %172 = fsub fast float -0.000000e+00, %158
-  %173 = fdiv fast float %171, %172
-  %174 = fmul fast float %159, %145
-  %175 = fsub fast float -0.000000e+00, %160
-  %176 = fdiv fast float %174, %175
-  %177 = fmul fast float %165, %147
-  %178 = fsub fast float -0.000000e+00, %168
-  %179 = fdiv fast float %177, %178
-  %180 = fmul fast float %169, %147
-  %181 = fsub fast float -0.000000e+00, %170
-  %182 = fdiv fast float %180, %181
-  br label %183
-
-; <label>:183                                     ; preds = %149, %143
-  %184 = phi i1 [ true, %149 ], [ false, %143 ]
-  %185 = phi float [ %173, %149 ], [ undef, %143 ]
-  %186 = phi float [ %179, %149 ], [ undef, %143 ]
-  %187 = phi float [ %176, %149 ], [ undef, %143 ]
-  %188 = phi float [ %182, %149 ], [ undef, %143 ]
-  br i1 %184, label %189, label %230
-
-; <label>:189                                     ; preds = %183
-  %190 = fmul fast float %185, 5.000000e-01
-  %191 = fmul fast float %186, 5.000000e-01
-  %192 = fmul fast float %187, 5.000000e-01
-  %193 = fmul fast float %188, 5.000000e-01
-  %194 = fadd fast float %190, 5.000000e-01
-  %195 = fsub fast float 5.000000e-01, %191
-  %196 = fadd fast float %192, 5.000000e-01
-  %197 = fsub fast float 5.000000e-01, %193
-  %198 = call float @dx.op.unary.f32(i32 7, float %194)  ; Saturate(value)
-  %199 = call float @dx.op.unary.f32(i32 7, float %195)  ; Saturate(value)
-  %200 = call float @dx.op.unary.f32(i32 7, float %196)  ; Saturate(value)
-  %201 = call float @dx.op.unary.f32(i32 7, float %197)  ; Saturate(value)
-  %202 = fsub fast float %200, %198
-  %203 = fsub fast float %201, %199
-  %204 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %6, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %205 = extractvalue %dx.types.CBufRet.i32 %204, 0
-  %206 = extractvalue %dx.types.CBufRet.i32 %204, 1
-  %207 = uitofp i32 %205 to float
-  %208 = uitofp i32 %206 to float
-  %209 = fmul fast float %207, %202
-  %210 = fmul fast float %208, %203
-  %211 = call float @dx.op.binary.f32(i32 35, float %209, float %210)  ; FMax(a,b)
-  %212 = call float @dx.op.unary.f32(i32 23, float %211)  ; Log(value)
-  %213 = call float @dx.op.unary.f32(i32 28, float %212)  ; Round_pi(value)
-  %214 = fadd fast float %200, %198
-  %215 = fadd fast float %201, %199
-  %216 = fmul fast float %214, 5.000000e-01
-  %217 = fmul fast float %215, 5.000000e-01
-  %218 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %2, %dx.types.Handle %4, float %216, float %217, float undef, float undef, i32 0, i32 0, i32 undef, float %213)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %219 = extractvalue %dx.types.ResRet.f32 %218, 0
-  %220 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %221 = extractvalue %dx.types.CBufRet.f32 %220, 2
-  %222 = fsub fast float -0.000000e+00, %221
-  %223 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %224 = extractvalue %dx.types.CBufRet.f32 %223, 2
-  %225 = fdiv fast float %224, %139
-  %226 = fsub fast float %222, %225
-  %227 = fadd fast float %219, 0x3EE4F8B580000000
-  %228 = fcmp fast ole float %226, %227
-  %229 = zext i1 %228 to i32
-  br label %230
-
-; <label>:230                                     ; preds = %189, %183
-  %231 = phi i32 [ %229, %189 ], [ %142, %183 ]
-  %232 = icmp eq i32 %231, 0
-  br i1 %232, label %252, label %233
-
-; <label>:233                                     ; preds = %230
-  %234 = fmul fast float %111, %111
-  %235 = fmul fast float %115, %115
-  %236 = fadd fast float %235, %234
-  %237 = fmul fast float %119, %119
-  %238 = fadd fast float %236, %237
-  %239 = call float @dx.op.unary.f32(i32 24, float %238)  ; Sqrt(value)
-  %240 = fsub fast float %239, %75
-  %241 = fcmp fast olt float %240, 5.000000e+00
-  %242 = fcmp fast olt float %240, 1.000000e+01
-  %243 = select i1 %242, i32 1, i32 2
-  %244 = select i1 %241, i32 0, i32 %243
-  %245 = getelementptr inbounds [3 x i32], [3 x i32]* %9, i32 0, i32 %244
-  %246 = load i32, i32* %245, align 4, !tbaa !21
-  %247 = getelementptr inbounds [3 x i32], [3 x i32]* %8, i32 0, i32 %244
-  %248 = load i32, i32* %247, align 4, !tbaa !21
-  %249 = getelementptr inbounds [3 x i32], [3 x i32]* %10, i32 0, i32 %244
-  %250 = load i32, i32* %249, align 4, !tbaa !21
-  %251 = call i32 @dx.op.bufferUpdateCounter(i32 70, %dx.types.Handle %1, i8 1)  ; BufferUpdateCounter(uav,inc)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %251, i32 0, i32 %7, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %251, i32 4, i32 %246, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %251, i32 8, i32 1, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %251, i32 12, i32 %248, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %251, i32 16, i32 %250, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %251, i32 20, i32 0, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  br label %252
-
-; <label>:252                                     ; preds = %233, %230, %60, %0
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.threadId.i32(i32, i32) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot3.f32(i32, float, float, float, float, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.binary.f32(i32, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32, float) #1
-
-; Function Attrs: nounwind
-declare i32 @dx.op.bufferUpdateCounter(i32, %dx.types.Handle, i8) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot2.f32(i32, float, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind
-declare void @dx.op.bufferStore.i32(i32, %dx.types.Handle, i32, i32, i32, i32, i32, i32, i8) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind readonly }
-attributes #2 = { nounwind }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.entryPoints = !{!18}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"cs", i32 6, i32 0}
-!4 = !{!5, !10, !13, !16}
-!5 = !{!6, !8}
-!6 = !{i32 0, %"dx.alignment.legacy.class.StructuredBuffer<DynamicObject>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 208}
-!8 = !{i32 1, %"class.Texture2D<float>"* undef, !"", i32 0, i32 1, i32 1, i32 2, i32 0, !9}
-!9 = !{i32 0, i32 9}
-!10 = !{!11}
-!11 = !{i32 0, %"class.AppendStructuredBuffer<DynamicCommand>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i1 false, i1 true, i1 false, !12}
-!12 = !{i32 1, i32 24}
-!13 = !{!14, !15}
-!14 = !{i32 0, %depthHierarchySize* undef, !"", i32 0, i32 0, i32 1, i32 8, null}
-!15 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!16 = !{!17}
-!17 = !{i32 0, %struct.SamplerState* undef, !"", i32 0, i32 0, i32 1, i32 0, null}
-!18 = !{void ()* @main, !"main", null, !4, !19}
-!19 = !{i32 0, i64 16, i32 4, !20}
-!20 = !{i32 128, i32 1, i32 1}
-!21 = !{!22, !22, i64 0}
-!22 = !{!"int", !23, i64 0}
-!23 = !{!"omnipotent char", !24, i64 0}
-!24 = !{!"Simple C/C++ TBAA"}
-
-#endif
-
-const unsigned char RINShaderBytesCullDynamicCS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x12, 0xae, 0x5e, 0x8e, 0xa7, 0xd7, 0x8e, 0xd9,
-  0x20, 0xdd, 0x0a, 0x7f, 0x38, 0xb7, 0xf5, 0xe5, 0x01, 0x00, 0x00, 0x00,
-  0x70, 0x25, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0x14, 0x01, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x5c, 0x13, 0x00, 0x00,
-  0x78, 0x13, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x4f, 0x53, 0x47, 0x31, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x50, 0x53, 0x56, 0x30, 0x9c, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x54, 0x53, 0x30, 0xec, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x94, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x54, 0x41, 0x54, 0x4c, 0x11, 0x00, 0x00,
-  0x60, 0x00, 0x05, 0x00, 0x53, 0x04, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c,
-  0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x34, 0x11, 0x00, 0x00,
-  0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0x4a, 0x04, 0x00, 0x00,
-  0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39,
-  0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62,
-  0x80, 0x1c, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14,
-  0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20,
-  0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90,
-  0x91, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a,
-  0x04, 0x39, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d,
-  0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x01, 0xd5, 0x06, 0x62,
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x00, 0x49, 0x18, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00,
-  0x32, 0x22, 0xc8, 0x09, 0x20, 0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84,
-  0x04, 0x93, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c,
-  0x0b, 0x84, 0xe4, 0x4c, 0x10, 0xa8, 0xc2, 0x1c, 0x01, 0x18, 0xdc, 0x22,
-  0x4d, 0x11, 0x25, 0x4c, 0x3e, 0xd0, 0x38, 0x0d, 0x2a, 0x00, 0x00, 0x00,
-  0x00, 0x70, 0x95, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x1d, 0xd6, 0x00, 0x0c,
-  0x22, 0x70, 0x0e, 0xc3, 0x00, 0xcd, 0x80, 0x04, 0x40, 0x60, 0x26, 0x36,
-  0x18, 0x07, 0x76, 0x08, 0x87, 0x79, 0x98, 0x07, 0x37, 0x08, 0x05, 0x78,
-  0x80, 0x87, 0x72, 0x70, 0x07, 0x72, 0x98, 0x05, 0x7a, 0x90, 0x87, 0x7a,
-  0x18, 0x07, 0x7a, 0xa8, 0x07, 0x79, 0x28, 0x07, 0x72, 0x10, 0x85, 0x7a,
-  0x30, 0x07, 0x73, 0x28, 0x07, 0x79, 0xe0, 0x03, 0x52, 0xc8, 0x07, 0x77,
-  0x08, 0x87, 0x76, 0x48, 0x87, 0x71, 0x18, 0x85, 0x77, 0x68, 0x87, 0x76,
-  0x08, 0x07, 0x77, 0x20, 0x07, 0x3f, 0x40, 0x81, 0x80, 0x06, 0x33, 0x00,
-  0x33, 0x85, 0xc1, 0x38, 0xb0, 0x43, 0x38, 0xcc, 0xc3, 0x3c, 0xb8, 0x01,
-  0x2d, 0x94, 0x03, 0x3e, 0xd0, 0x43, 0x3d, 0xc8, 0x43, 0x39, 0xc8, 0x01,
-  0x29, 0xf0, 0x81, 0x39, 0xb0, 0xc3, 0x3b, 0x84, 0x03, 0x3d, 0xf8, 0x81,
-  0x1e, 0xe8, 0x41, 0x3b, 0xa4, 0x03, 0x3c, 0xcc, 0xc3, 0x2f, 0xd0, 0x43,
-  0x3e, 0xc0, 0x43, 0x39, 0xa0, 0x00, 0x30, 0x93, 0x35, 0x0e, 0xec, 0x10,
-  0x0e, 0xf3, 0x30, 0x0f, 0x6e, 0x40, 0x0b, 0xe5, 0x80, 0x0f, 0xf4, 0x50,
-  0x0f, 0xf2, 0x50, 0x0e, 0x72, 0x40, 0x0a, 0x7c, 0x60, 0x0e, 0xec, 0xf0,
-  0x0e, 0xe1, 0x40, 0x0f, 0x7e, 0x80, 0x84, 0x82, 0x81, 0x0e, 0x37, 0x49,
-  0x53, 0x44, 0x09, 0x93, 0xcf, 0x02, 0xcc, 0xb3, 0x10, 0x11, 0x3b, 0x01,
-  0x13, 0x81, 0x02, 0x00, 0x25, 0x86, 0x11, 0x04, 0xe0, 0x16, 0x69, 0x8a,
-  0x28, 0x61, 0xf2, 0x59, 0x24, 0x23, 0x50, 0xb0, 0x38, 0x69, 0x20, 0x9e,
-  0xe9, 0x08, 0x11, 0x22, 0x02, 0x22, 0xe1, 0xc0, 0x58, 0x24, 0x23, 0x50,
-  0xc0, 0xa0, 0xc6, 0x30, 0x02, 0x51, 0x24, 0xc1, 0x63, 0x18, 0x61, 0x28,
-  0x2e, 0x0c, 0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68, 0x18, 0xa2, 0x99, 0xfc,
-  0x85, 0x30, 0x00, 0x01, 0xf3, 0xa5, 0x29, 0xa2, 0x84, 0xc9, 0xe7, 0x00,
-  0x86, 0x88, 0x00, 0xe4, 0x40, 0x20, 0x10, 0x48, 0xa4, 0x50, 0x28, 0x14,
-  0x0a, 0x85, 0x42, 0xa1, 0x70, 0x60, 0x30, 0x5c, 0x3e, 0xb0, 0x20, 0x46,
-  0xc3, 0x10, 0xcd, 0xe4, 0x2f, 0x84, 0x01, 0x08, 0x98, 0x2f, 0x00, 0x0c,
-  0x11, 0x01, 0x1b, 0x55, 0x14, 0x44, 0x84, 0x02, 0x09, 0x4d, 0xae, 0x92,
-  0xa6, 0x88, 0x12, 0x26, 0x7f, 0x73, 0xa8, 0x66, 0x40, 0x1a, 0x83, 0x7d,
-  0x0e, 0x22, 0x22, 0x90, 0x10, 0x29, 0x9c, 0x22, 0x4d, 0x11, 0x25, 0x4c,
-  0x7e, 0x89, 0x76, 0x68, 0x00, 0x00, 0x00, 0x39, 0x60, 0xb9, 0x47, 0x9a,
-  0x22, 0x4a, 0x98, 0x7c, 0x13, 0x98, 0x88, 0x08, 0x01, 0x16, 0x64, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x70, 0x68, 0x30, 0x5c, 0x3e, 0xb0, 0x20, 0x46,
-  0xc3, 0x10, 0xcd, 0xe4, 0x2f, 0x84, 0x01, 0x08, 0x98, 0x2f, 0x4d, 0x11,
-  0x25, 0x4c, 0x7e, 0x87, 0x35, 0x00, 0x83, 0x08, 0x68, 0x90, 0x10, 0xc2,
-  0x84, 0x0c, 0x08, 0xa4, 0x72, 0xc1, 0x00, 0x66, 0xca, 0x03, 0x72, 0xc0,
-  0x07, 0x37, 0x08, 0x07, 0x76, 0x48, 0x87, 0x73, 0x70, 0x87, 0x76, 0x28,
-  0x07, 0x77, 0xa0, 0x07, 0x37, 0x60, 0x87, 0x72, 0x38, 0x87, 0x70, 0x18,
-  0x87, 0x7c, 0x70, 0x83, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70,
-  0x83, 0x59, 0xa0, 0x07, 0x79, 0xa8, 0x87, 0x71, 0xa0, 0x87, 0x7a, 0x90,
-  0x87, 0x72, 0x20, 0x07, 0x51, 0xa8, 0x07, 0x73, 0x30, 0x87, 0x72, 0x90,
-  0x07, 0x3e, 0x20, 0x85, 0x7c, 0x70, 0x87, 0x70, 0x68, 0x87, 0x74, 0x18,
-  0x87, 0x57, 0x10, 0x07, 0x75, 0x28, 0x87, 0x71, 0xa0, 0x07, 0x3f, 0x40,
-  0x41, 0x86, 0x34, 0x23, 0x00, 0x25, 0xe0, 0x50, 0xa7, 0x0c, 0x00, 0x00,
-  0x80, 0x3e, 0x05, 0x29, 0x00, 0x0a, 0x85, 0x42, 0xa1, 0x50, 0xa0, 0x50,
-  0x19, 0x0a, 0x80, 0x02, 0x8d, 0x0a, 0x51, 0x00, 0x14, 0x0a, 0x54, 0xba,
-  0x69, 0xb8, 0xfc, 0x09, 0x7b, 0x08, 0xc9, 0x5f, 0x09, 0x69, 0x25, 0x26,
-  0xbf, 0xb8, 0x6d, 0x54, 0x14, 0x0a, 0x85, 0x02, 0x60, 0x8e, 0x00, 0x21,
-  0xd4, 0x3d, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 0x48, 0x7e, 0x08, 0x34, 0xc3,
-  0x42, 0xa0, 0x20, 0x55, 0x98, 0x13, 0x40, 0xa5, 0x2a, 0x14, 0x0a, 0x05,
-  0x00, 0x00, 0x50, 0xa0, 0x55, 0x21, 0x00, 0x00, 0x15, 0x8a, 0x5a, 0xc5,
-  0x28, 0x00, 0x0a, 0x85, 0x42, 0x81, 0x5e, 0x47, 0x0d, 0x97, 0x3f, 0x61,
-  0x0f, 0x21, 0xf9, 0xdc, 0x46, 0x15, 0x2b, 0x31, 0xf9, 0xc8, 0x6d, 0x23,
-  0x02, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x03, 0xa8, 0x00, 0x24, 0x3b, 0x6a,
-  0xb8, 0xfc, 0x09, 0x7b, 0x08, 0xc9, 0xe7, 0x36, 0xaa, 0x58, 0x89, 0xc9,
-  0x2f, 0x6e, 0x1b, 0x11, 0x85, 0x42, 0xa1, 0x50, 0x08, 0x1a, 0x40, 0x05,
-  0xa0, 0x5a, 0x29, 0x0a, 0x80, 0x42, 0xa1, 0x40, 0xb7, 0x39, 0x82, 0xa0,
-  0x18, 0x2a, 0x00, 0x0a, 0x00, 0xc8, 0x91, 0xee, 0xa6, 0xe1, 0xf2, 0x27,
-  0xec, 0x21, 0x24, 0x7f, 0x25, 0xa4, 0x95, 0x98, 0x7c, 0xe4, 0xb6, 0x51,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0x52, 0xf0, 0x00, 0x2a, 0x00, 0x80, 0x7a,
-  0xa5, 0x38, 0x01, 0x54, 0x00, 0x00, 0xfd, 0x8a, 0xc2, 0x01, 0xa8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x40, 0x51, 0x70, 0x20, 0xe0, 0x2c, 0x61, 0x01,
-  0x24, 0xc9, 0x67, 0x80, 0x29, 0x42, 0x2e, 0xbf, 0x58, 0x1c, 0x60, 0xf2,
-  0x71, 0x1f, 0x47, 0x01, 0xe4, 0x28, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x3b,
-  0xac, 0x01, 0x18, 0x44, 0x40, 0x83, 0x84, 0x10, 0x26, 0x64, 0x10, 0x89,
-  0x95, 0x0b, 0x06, 0x30, 0x53, 0x19, 0x8c, 0x03, 0x3b, 0x84, 0xc3, 0x3c,
-  0xcc, 0x83, 0x1b, 0xcc, 0x02, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d,
-  0xd4, 0x83, 0x3c, 0x94, 0x03, 0x39, 0x88, 0x42, 0x3d, 0x98, 0x83, 0x39,
-  0x94, 0x83, 0x3c, 0xf0, 0x01, 0x29, 0xe4, 0x83, 0x3b, 0x84, 0x43, 0x3b,
-  0xa4, 0xc3, 0x38, 0xbc, 0x82, 0x38, 0xa8, 0x43, 0x39, 0x8c, 0x03, 0x3d,
-  0xf8, 0x01, 0x0a, 0x8a, 0xd7, 0x48, 0x53, 0x44, 0x09, 0x93, 0xcf, 0x01,
-  0x0c, 0x11, 0x01, 0xc8, 0x21, 0x12, 0x89, 0xc4, 0x48, 0xa1, 0x50, 0x28,
-  0x14, 0x0a, 0x85, 0x42, 0xe1, 0x18, 0x01, 0x60, 0x88, 0x08, 0xd8, 0xa8,
-  0xa2, 0x20, 0x22, 0x14, 0x1c, 0xe7, 0x08, 0x40, 0x01, 0x00, 0x00, 0x00,
-  0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79,
-  0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e,
-  0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07,
-  0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07,
-  0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a, 0x0f, 0xa4, 0x90, 0x21, 0x23,
-  0x45, 0x44, 0x00, 0x8e, 0x01, 0x00, 0xf3, 0x0c, 0x00, 0x98, 0x69, 0x00,
-  0xc0, 0x6c, 0x03, 0x00, 0xe0, 0x14, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x86,
-  0x3c, 0x1d, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x79, 0x3e, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0xf2, 0x84, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0c, 0x79, 0xc6, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x65, 0x00, 0x04, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x9e, 0x35, 0x00, 0x02,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f, 0x1b,
-  0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90,
-  0xe7, 0x0d, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0xc8, 0x23, 0x07, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0xe4, 0xa9, 0x03, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0xdc, 0x01, 0x10, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0xf4, 0x00, 0x08, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x7d, 0x00,
-  0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x9e,
-  0x3f, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x21, 0x4f, 0x28, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x16, 0x08, 0x2d, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x1c,
-  0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x02,
-  0x94, 0xc0, 0x08, 0x40, 0x31, 0x14, 0x46, 0x81, 0x0e, 0x14, 0x41, 0x49,
-  0x14, 0x4c, 0x41, 0x14, 0x38, 0x41, 0x19, 0x94, 0x43, 0x29, 0x14, 0xee,
-  0x40, 0x21, 0x14, 0x60, 0x40, 0x01, 0x0a, 0x14, 0xa8, 0x40, 0x01, 0x0e,
-  0x14, 0xec, 0x40, 0x81, 0x14, 0x4a, 0x21, 0x15, 0x20, 0x41, 0x61, 0x12,
-  0x14, 0x28, 0x41, 0xa1, 0x12, 0x14, 0x2c, 0x41, 0xe1, 0x12, 0x14, 0x30,
-  0x41, 0x21, 0x13, 0x14, 0x34, 0x41, 0x61, 0x13, 0x14, 0x6f, 0x00, 0x25,
-  0x0b, 0x84, 0x72, 0x35, 0x30, 0x02, 0x40, 0x84, 0x19, 0x00, 0x2a, 0xcc,
-  0x00, 0x90, 0x61, 0x06, 0x80, 0x0e, 0x33, 0x00, 0x84, 0x98, 0x01, 0x20,
-  0xc5, 0x0c, 0x00, 0x31, 0x66, 0x00, 0xa8, 0x31, 0x03, 0x40, 0x8e, 0x19,
-  0x00, 0x92, 0xcc, 0x00, 0xd0, 0x64, 0x06, 0x80, 0x28, 0x33, 0x00, 0x54,
-  0x99, 0x01, 0x20, 0xcb, 0x0c, 0x00, 0x61, 0x66, 0x00, 0x28, 0x33, 0x03,
-  0x40, 0x9a, 0x19, 0x00, 0xda, 0xcc, 0x00, 0xd0, 0x60, 0x06, 0x80, 0x04,
-  0x33, 0x00, 0x54, 0x9c, 0x01, 0x20, 0xe3, 0x0c, 0x00, 0x1d, 0x67, 0x00,
-  0x08, 0x39, 0x03, 0x40, 0x81, 0x19, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0xe5, 0x01, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44,
-  0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b,
-  0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b,
-  0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81,
-  0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04,
-  0xa0, 0x9a, 0x20, 0x00, 0xd6, 0x06, 0x61, 0x20, 0x36, 0x08, 0x04, 0x41,
-  0x61, 0x6c, 0x6e, 0x82, 0x00, 0x5c, 0x1b, 0x86, 0x03, 0x21, 0x26, 0x08,
-  0xdb, 0x2a, 0x70, 0x22, 0xcb, 0x73, 0x0b, 0x6b, 0x4b, 0x1b, 0x7b, 0x12,
-  0x53, 0x2b, 0x1b, 0xa3, 0x13, 0xaa, 0x33, 0x33, 0x2b, 0x93, 0x9b, 0x20,
-  0x00, 0xd8, 0x04, 0x01, 0xc8, 0x36, 0x08, 0x43, 0xb3, 0x21, 0x21, 0x94,
-  0x85, 0x20, 0x06, 0x86, 0x70, 0x26, 0x08, 0x88, 0x1f, 0xd0, 0x21, 0x2b,
-  0x83, 0xa3, 0x43, 0x43, 0x4a, 0x2b, 0x93, 0x0b, 0x93, 0x1b, 0x43, 0xcb,
-  0x9b, 0x20, 0x00, 0xda, 0x04, 0x01, 0xd8, 0x36, 0x08, 0xc4, 0xb4, 0x21,
-  0x19, 0xa0, 0x88, 0x18, 0x06, 0x89, 0xa0, 0x36, 0x08, 0x4f, 0x35, 0x41,
-  0x20, 0xf4, 0x80, 0x14, 0x59, 0x9e, 0x5b, 0x58, 0x5b, 0xda, 0xd8, 0xd0,
-  0x5b, 0x5b, 0x5b, 0x98, 0x1b, 0x99, 0x50, 0x9d, 0x99, 0x59, 0x99, 0xdc,
-  0x04, 0x21, 0x0f, 0xf2, 0x60, 0x82, 0x90, 0x07, 0x78, 0x30, 0x41, 0x00,
-  0xb8, 0x0d, 0xc2, 0xb0, 0x6d, 0x58, 0x88, 0x0b, 0x23, 0x88, 0x81, 0xc9,
-  0xb4, 0x8c, 0xdb, 0x10, 0x74, 0x13, 0x04, 0x47, 0x14, 0x28, 0x91, 0x95,
-  0xc1, 0xd1, 0xa1, 0x21, 0xa5, 0x95, 0xc9, 0x85, 0xc9, 0x8d, 0xa1, 0xe5,
-  0x4d, 0xa5, 0xe9, 0x95, 0x4d, 0x10, 0x80, 0x6e, 0x03, 0x42, 0x7c, 0x60,
-  0x40, 0x10, 0x43, 0x18, 0x00, 0x13, 0x04, 0xaa, 0x14, 0xc8, 0x8c, 0x85,
-  0xb5, 0x95, 0xc9, 0x85, 0x09, 0xd5, 0x99, 0x99, 0x95, 0xc9, 0x4d, 0x10,
-  0x00, 0x6f, 0x03, 0x32, 0x8c, 0x01, 0x19, 0x10, 0xc3, 0x50, 0x06, 0xc0,
-  0x06, 0x41, 0x0c, 0xcc, 0x60, 0x82, 0xa0, 0xfc, 0x01, 0x2b, 0xb2, 0x32,
-  0x38, 0x3a, 0x34, 0xa4, 0xb4, 0x32, 0xb9, 0x30, 0xb9, 0x31, 0xb4, 0xbc,
-  0xa9, 0xb0, 0x36, 0x38, 0xb6, 0x32, 0xb9, 0x0d, 0x08, 0x81, 0x06, 0x69,
-  0x40, 0x10, 0x03, 0x01, 0x6c, 0x08, 0xd4, 0x60, 0x03, 0x61, 0x79, 0x67,
-  0xb0, 0x06, 0x13, 0x04, 0x06, 0x14, 0x48, 0xcc, 0xa5, 0xe9, 0x95, 0x4d,
-  0x10, 0x80, 0x6f, 0x82, 0x00, 0x80, 0xc1, 0x04, 0x01, 0x08, 0x83, 0x0d,
-  0x06, 0xe2, 0x06, 0x6f, 0x40, 0xc0, 0x41, 0x1c, 0x6c, 0x10, 0xc2, 0x40,
-  0x0e, 0x26, 0x08, 0xa6, 0xf0, 0x0a, 0x13, 0x04, 0x40, 0x0c, 0x18, 0xa0,
-  0x6d, 0x20, 0x10, 0x3b, 0x78, 0x03, 0x62, 0x82, 0x50, 0x0a, 0xae, 0xb0,
-  0x41, 0x20, 0xf0, 0x60, 0x43, 0x90, 0x07, 0x1b, 0x04, 0x42, 0x0f, 0x36,
-  0x0c, 0x75, 0x70, 0x07, 0x7b, 0xc0, 0xe5, 0xee, 0x4d, 0x8e, 0x8d, 0xac,
-  0x29, 0x8c, 0x4e, 0x2e, 0x0d, 0x6f, 0x82, 0x00, 0x8c, 0xc1, 0x86, 0xc1,
-  0x0f, 0xfc, 0x40, 0xda, 0x80, 0x20, 0x7d, 0x20, 0xfd, 0xc1, 0x1b, 0x10,
-  0x70, 0x30, 0xd1, 0x49, 0x73, 0xb3, 0xbb, 0x7a, 0x93, 0x63, 0x23, 0x6b,
-  0x0a, 0xa3, 0x93, 0x4b, 0xc3, 0x9b, 0x20, 0x00, 0x64, 0xb0, 0x01, 0x41,
-  0x42, 0x41, 0xfa, 0x83, 0x37, 0x10, 0x05, 0x38, 0x98, 0xe8, 0x88, 0xbd,
-  0xd5, 0xb9, 0x91, 0xa5, 0xb9, 0x9d, 0x4d, 0xc1, 0xa1, 0x95, 0xc9, 0x95,
-  0x4d, 0x10, 0x80, 0x32, 0xd8, 0x40, 0x20, 0xa4, 0xf0, 0x06, 0xa5, 0x40,
-  0x82, 0xed, 0x8d, 0x6c, 0x6e, 0x82, 0x00, 0x98, 0xc1, 0x06, 0x02, 0x39,
-  0x85, 0x37, 0x40, 0x05, 0x22, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61,
-  0x6c, 0x13, 0x04, 0xe0, 0x0c, 0x36, 0x10, 0x88, 0x2a, 0xbc, 0xc1, 0x2a,
-  0xb0, 0x30, 0x63, 0x0b, 0x3b, 0x9b, 0x9b, 0x20, 0x00, 0x68, 0xb0, 0xc1,
-  0x40, 0x5a, 0xe1, 0x0d, 0x5c, 0x01, 0x0e, 0xe2, 0x60, 0xc3, 0x51, 0x07,
-  0xa0, 0x30, 0x0a, 0xa6, 0x90, 0x0a, 0xac, 0xf0, 0x0a, 0x13, 0x84, 0xca,
-  0x14, 0x26, 0x08, 0x40, 0x1a, 0xd0, 0x18, 0x2b, 0x73, 0xa3, 0x2b, 0x93,
-  0xdb, 0x60, 0x20, 0xb3, 0xf0, 0x06, 0x04, 0x1c, 0x4c, 0x34, 0xe4, 0xc2,
-  0xc8, 0xd2, 0xea, 0xe6, 0x36, 0x18, 0x48, 0x2d, 0xbc, 0x01, 0x03, 0x07,
-  0xd3, 0x86, 0x41, 0x16, 0x68, 0xc1, 0x16, 0x26, 0x08, 0xd6, 0x29, 0x50,
-  0x99, 0xa3, 0x0b, 0x93, 0xa3, 0x4b, 0x72, 0x23, 0x2b, 0xc3, 0xdb, 0x60,
-  0x20, 0xb9, 0xf0, 0x06, 0x04, 0x1c, 0xc4, 0x01, 0x95, 0x34, 0x37, 0xb2,
-  0x32, 0xbc, 0xa1, 0xb7, 0x3a, 0x37, 0xba, 0x0d, 0x06, 0xb2, 0x0b, 0x6f,
-  0xe0, 0x07, 0x70, 0x10, 0x07, 0x64, 0xec, 0xca, 0xe4, 0xe8, 0xca, 0xf0,
-  0x9e, 0xcc, 0xcc, 0xe6, 0xca, 0xe8, 0x36, 0x18, 0x48, 0x2f, 0xbc, 0x41,
-  0x18, 0xc0, 0x41, 0x1c, 0x6c, 0x20, 0x18, 0x5d, 0xe0, 0x05, 0x5f, 0x98,
-  0x20, 0x60, 0xa8, 0xc0, 0x45, 0x2c, 0x6c, 0xae, 0x6c, 0xe8, 0x8d, 0xed,
-  0x4d, 0x2e, 0x89, 0x68, 0x83, 0x81, 0x84, 0xc3, 0x1b, 0x10, 0x70, 0x10,
-  0x07, 0x44, 0xdc, 0xde, 0xe4, 0xda, 0xc2, 0xd8, 0x92, 0x88, 0x36, 0x18,
-  0xc8, 0x38, 0xbc, 0x81, 0x1f, 0xc0, 0x41, 0x1c, 0xb0, 0x91, 0x7b, 0xab,
-  0x3b, 0x43, 0x73, 0x2b, 0x9b, 0x9b, 0x0b, 0x7a, 0x4a, 0x22, 0xda, 0x60,
-  0x20, 0xe5, 0xf0, 0x06, 0x61, 0x00, 0x07, 0x71, 0x40, 0xa5, 0xad, 0x8c,
-  0x2e, 0x8c, 0x8d, 0x2d, 0x6d, 0x2c, 0x89, 0x68, 0x83, 0x81, 0x9c, 0xc3,
-  0x1b, 0x30, 0x70, 0x10, 0x07, 0x44, 0xd0, 0xca, 0xd2, 0xce, 0xd0, 0xe8,
-  0x92, 0x88, 0x36, 0x18, 0x48, 0x3a, 0xbc, 0x81, 0x2c, 0xc0, 0x41, 0x1c,
-  0x30, 0x99, 0x83, 0x2b, 0x1b, 0x4b, 0x0b, 0x63, 0x4b, 0x22, 0x9a, 0x20,
-  0x00, 0x6a, 0xb0, 0xc1, 0x40, 0xd6, 0xe1, 0x0d, 0xd8, 0x01, 0x0e, 0xe2,
-  0x60, 0xc3, 0xb1, 0x89, 0x03, 0x39, 0x98, 0x03, 0x3a, 0xa8, 0x43, 0x3b,
-  0x4c, 0x10, 0x06, 0x56, 0x98, 0x20, 0x00, 0x6b, 0x30, 0x41, 0x10, 0x5a,
-  0x61, 0x83, 0x40, 0xc4, 0xc3, 0x86, 0x40, 0x1e, 0x36, 0x08, 0xc4, 0x3c,
-  0x6c, 0x18, 0xe0, 0xe1, 0x0e, 0xe8, 0x81, 0xc8, 0x9b, 0x98, 0x5a, 0xd9,
-  0x18, 0x5d, 0x12, 0xd1, 0x06, 0x03, 0xb1, 0x87, 0x37, 0x20, 0xe0, 0x20,
-  0x0e, 0xb8, 0x90, 0xc9, 0x85, 0xdd, 0x25, 0xb9, 0x91, 0x95, 0xe1, 0x95,
-  0x91, 0x6d, 0x20, 0x10, 0x7c, 0x78, 0x03, 0x59, 0xd8, 0x30, 0xc0, 0xc3,
-  0x3d, 0xe4, 0xc3, 0x04, 0x21, 0x90, 0x05, 0x56, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x50, 0x65, 0x72, 0x49, 0x6e, 0x73,
-  0x74, 0x61, 0x6e, 0x63, 0x65, 0x1b, 0x0c, 0x84, 0x1f, 0xde, 0x80, 0x80,
-  0x83, 0x38, 0x60, 0x93, 0xe6, 0x36, 0x47, 0x17, 0xe6, 0x36, 0x56, 0x36,
-  0xf4, 0x56, 0xe7, 0x46, 0xb7, 0xc1, 0x40, 0xfc, 0xe1, 0x0d, 0xfc, 0x00,
-  0x0e, 0xe2, 0x80, 0xd2, 0x1c, 0x5d, 0x98, 0x1c, 0x5d, 0x92, 0x1b, 0x59,
-  0x19, 0x1e, 0xd3, 0xdb, 0x58, 0x18, 0x5d, 0xda, 0x9b, 0xdb, 0x06, 0x03,
-  0x01, 0x89, 0x37, 0x08, 0x03, 0x38, 0x88, 0x03, 0x4a, 0x62, 0x61, 0x73,
-  0x65, 0x56, 0x65, 0x72, 0x74, 0x65, 0x78, 0x4c, 0x6f, 0x63, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x1b, 0x0c, 0x44, 0x24, 0xde, 0x80, 0x81, 0x03, 0x3f,
-  0x60, 0x35, 0x47, 0x17, 0x26, 0x47, 0x97, 0xe4, 0x36, 0x47, 0x17, 0xe6,
-  0x36, 0x56, 0xc6, 0xf4, 0x36, 0x16, 0x46, 0x97, 0xf6, 0xe6, 0xb6, 0xc1,
-  0x40, 0x48, 0xe2, 0x0d, 0x64, 0x01, 0x0e, 0xe2, 0x60, 0x83, 0xc1, 0x0e,
-  0xfd, 0xf0, 0x0f, 0x21, 0x31, 0x12, 0x25, 0x31, 0x41, 0x38, 0x05, 0x58,
-  0xa0, 0x62, 0x97, 0x56, 0x76, 0xd7, 0x14, 0x46, 0x27, 0x97, 0x86, 0xb7,
-  0x01, 0x41, 0x50, 0x42, 0xfa, 0x83, 0x37, 0x20, 0xe0, 0x60, 0xa2, 0x02,
-  0x27, 0xf7, 0xa6, 0xd6, 0x14, 0x46, 0x27, 0x97, 0x86, 0xb7, 0x01, 0x41,
-  0x54, 0x42, 0xfa, 0x83, 0x37, 0x10, 0x05, 0x38, 0x98, 0xd8, 0xa4, 0xb9,
-  0xd9, 0x41, 0xc9, 0xbd, 0xa9, 0x35, 0x85, 0xd1, 0xc9, 0xa5, 0xe1, 0x6d,
-  0x40, 0x10, 0x96, 0x90, 0xfe, 0xe0, 0x0d, 0x4a, 0x01, 0x0e, 0x26, 0x3a,
-  0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x4d, 0x61, 0x74, 0x72,
-  0x69, 0x78, 0x1b, 0x10, 0xc4, 0x25, 0xa4, 0x3f, 0x78, 0x83, 0x55, 0x80,
-  0x83, 0x89, 0x08, 0xdc, 0xdb, 0x5c, 0x1a, 0x5d, 0xda, 0x9b, 0xdb, 0x04,
-  0x01, 0x60, 0x83, 0x0d, 0x06, 0x02, 0x13, 0x6f, 0x10, 0x13, 0x70, 0x30,
-  0x11, 0x81, 0x0b, 0x23, 0x23, 0x4b, 0x73, 0x3b, 0x83, 0x99, 0x20, 0x00,
-  0x6d, 0xb0, 0xc1, 0x40, 0x66, 0xe2, 0x0d, 0x68, 0x02, 0x0e, 0x26, 0x26,
-  0x66, 0x72, 0x75, 0x73, 0x74, 0x75, 0x6d, 0x58, 0x58, 0x13, 0x04, 0xc0,
-  0x0d, 0x36, 0x18, 0x88, 0x4d, 0xbc, 0xc1, 0x4d, 0xc0, 0xc1, 0xc4, 0xc4,
-  0x4c, 0xae, 0x6e, 0x8e, 0xae, 0xae, 0x0d, 0x4b, 0x6b, 0x82, 0x00, 0xbc,
-  0xc1, 0x06, 0x03, 0xc9, 0x89, 0x37, 0xd0, 0x09, 0x38, 0x98, 0x98, 0x98,
-  0xc9, 0xd5, 0xcd, 0xd1, 0xd5, 0xb5, 0x65, 0x65, 0x4d, 0x10, 0x00, 0x38,
-  0xd8, 0x60, 0x20, 0x3c, 0xf1, 0x06, 0x3d, 0x01, 0x07, 0x13, 0x13, 0x33,
-  0xb9, 0xba, 0x39, 0xba, 0xba, 0xb6, 0x2c, 0xad, 0x09, 0x02, 0x10, 0x07,
-  0x1b, 0x0c, 0xe4, 0x27, 0xde, 0x00, 0x2c, 0xe0, 0x60, 0x62, 0xe1, 0x56,
-  0x16, 0x26, 0xa7, 0x35, 0x41, 0x00, 0xe4, 0x60, 0x83, 0x81, 0x88, 0xc5,
-  0x1b, 0x8c, 0x05, 0x1c, 0x4c, 0x24, 0xcc, 0xc2, 0xe4, 0xb4, 0x26, 0x08,
-  0xc0, 0x1c, 0x6c, 0x30, 0x90, 0xb2, 0x78, 0x03, 0xb3, 0x80, 0x83, 0x89,
-  0xd0, 0x18, 0x5b, 0xdd, 0x1c, 0x5d, 0x99, 0xdc, 0xd0, 0x9b, 0xdb, 0x1c,
-  0x5d, 0x98, 0x1b, 0x5d, 0xd0, 0x04, 0x01, 0xa0, 0x83, 0x0d, 0x06, 0x82,
-  0x16, 0x6f, 0x90, 0x16, 0x70, 0x30, 0x11, 0x1a, 0x63, 0xab, 0x9b, 0xa3,
-  0x2b, 0x93, 0x1b, 0x7a, 0x73, 0x9b, 0xa3, 0x0b, 0x73, 0xa3, 0x13, 0x9a,
-  0x20, 0x00, 0x75, 0xb0, 0xc1, 0x40, 0xd6, 0xe2, 0x0d, 0xd8, 0x02, 0x0e,
-  0xa6, 0x0d, 0x4f, 0x19, 0xa4, 0xc4, 0x4a, 0xb4, 0xc4, 0x4b, 0xc8, 0x44,
-  0x4d, 0xe0, 0xc4, 0x4e, 0xf8, 0x44, 0x58, 0x90, 0xc5, 0x59, 0xa8, 0x45,
-  0x5b, 0x4c, 0x10, 0x8e, 0x3e, 0xd8, 0x60, 0x20, 0x76, 0xf0, 0x06, 0x04,
-  0x1c, 0x4c, 0x24, 0xda, 0xd2, 0xe0, 0xe6, 0x36, 0x10, 0x48, 0x5c, 0xbc,
-  0x81, 0x2c, 0x4c, 0x10, 0x8a, 0x3d, 0xd8, 0x20, 0x10, 0x73, 0xb1, 0x21,
-  0xa0, 0x8b, 0x0d, 0x02, 0x51, 0x17, 0x1b, 0x08, 0x76, 0x80, 0x0b, 0xb9,
-  0xb0, 0x8b, 0x09, 0x82, 0xc1, 0x07, 0x34, 0xd0, 0xc2, 0xdc, 0xc8, 0xd8,
-  0xca, 0x36, 0x18, 0x48, 0x5e, 0xbc, 0x01, 0x01, 0x07, 0x71, 0xb0, 0x41,
-  0xf0, 0x03, 0xbd, 0x98, 0x20, 0x34, 0xa1, 0xb0, 0x81, 0x40, 0xc0, 0xe0,
-  0x0d, 0x88, 0x0d, 0x42, 0x18, 0xf4, 0xc5, 0x04, 0x01, 0x15, 0x62, 0x61,
-  0x03, 0x81, 0x90, 0xc1, 0x1b, 0x10, 0x1b, 0x84, 0x32, 0x00, 0x8d, 0x09,
-  0x82, 0x34, 0x0a, 0x13, 0x84, 0x89, 0x14, 0x26, 0x08, 0x59, 0x2a, 0x4c,
-  0x10, 0x34, 0x55, 0xd8, 0x50, 0x06, 0x44, 0x1b, 0xcc, 0x01, 0x1d, 0xf0,
-  0x01, 0x1e, 0xc0, 0x42, 0x2c, 0xdc, 0x02, 0x2e, 0xfc, 0x02, 0x38, 0xb8,
-  0xc3, 0x3b, 0xd4, 0x43, 0x3c, 0xe8, 0xc3, 0x3e, 0x98, 0xc4, 0x49, 0xb8,
-  0xc5, 0x5b, 0xdc, 0x05, 0x5e, 0xec, 0x05, 0x5f, 0xf8, 0xc5, 0x5f, 0x84,
-  0x86, 0x68, 0xb8, 0xc5, 0x68, 0x84, 0x06, 0x69, 0xc0, 0x42, 0x69, 0xf0,
-  0xc1, 0x04, 0xc1, 0x33, 0x36, 0x00, 0x1b, 0x06, 0x02, 0x35, 0x50, 0x63,
-  0x43, 0x90, 0x1a, 0x1b, 0x86, 0xe1, 0x34, 0x54, 0x83, 0x44, 0x5b, 0x58,
-  0x9a, 0xdb, 0x04, 0x21, 0x15, 0xee, 0x60, 0xc3, 0x50, 0x0a, 0xc3, 0xb0,
-  0x81, 0x20, 0x5a, 0xc3, 0x0f, 0x5c, 0x63, 0x43, 0x71, 0x1a, 0xac, 0x01,
-  0xb0, 0xc1, 0x6b, 0x30, 0x0a, 0x93, 0x93, 0x0b, 0xcb, 0xfb, 0x62, 0x7b,
-  0x1b, 0x0b, 0x63, 0xfb, 0x12, 0xcb, 0xa3, 0x2b, 0x9b, 0x23, 0x14, 0x26,
-  0x27, 0x17, 0x96, 0xf7, 0xc5, 0xf6, 0x36, 0x16, 0xc6, 0xf6, 0xc5, 0x46,
-  0x36, 0x47, 0x47, 0x23, 0x8c, 0xee, 0xad, 0x2d, 0x6d, 0x8c, 0x88, 0x98,
-  0x5c, 0x98, 0xdb, 0x18, 0x5a, 0xd9, 0x1c, 0x0d, 0x33, 0xb6, 0xb7, 0x30,
-  0xba, 0xb9, 0x09, 0x02, 0x60, 0x07, 0x2c, 0xd2, 0xdc, 0xe6, 0xe8, 0xe6,
-  0x48, 0xa4, 0xb9, 0xd1, 0xcd, 0x11, 0xa1, 0x2b, 0xc3, 0xfb, 0x62, 0x7b,
-  0x0b, 0x23, 0x23, 0x42, 0x57, 0x86, 0xf7, 0xe5, 0xf6, 0x26, 0xd7, 0xc6,
-  0x84, 0xae, 0x0c, 0xef, 0x6b, 0x8e, 0xee, 0x4d, 0xae, 0x8c, 0x45, 0x5d,
-  0x9a, 0x1b, 0xdd, 0xdc, 0x06, 0x2b, 0x36, 0xe0, 0x41, 0x36, 0x98, 0xd9,
-  0x18, 0x68, 0x23, 0x0e, 0x6a, 0xc3, 0x36, 0x6e, 0x83, 0x26, 0x70, 0x43,
-  0xca, 0x0d, 0x59, 0xd0, 0x8d, 0x61, 0x37, 0x10, 0xde, 0x40, 0xaa, 0xb0,
-  0xb1, 0xd9, 0xb5, 0xb9, 0xa4, 0x91, 0x95, 0xb9, 0xd1, 0x4d, 0x09, 0x82,
-  0x2a, 0x64, 0x78, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x53,
-  0x02, 0xa2, 0x09, 0x19, 0x9e, 0x8b, 0x5d, 0x18, 0x9b, 0x5d, 0x99, 0xdc,
-  0x94, 0xa0, 0xa8, 0x43, 0x86, 0xe7, 0x32, 0x87, 0x16, 0x46, 0x56, 0x26,
-  0xd7, 0xf4, 0x46, 0x56, 0xc6, 0x36, 0x25, 0x40, 0xca, 0x90, 0xe1, 0xb9,
-  0xc8, 0x95, 0xcd, 0xbd, 0xd5, 0xc9, 0x8d, 0x95, 0xcd, 0x4d, 0x09, 0xd6,
-  0xa0, 0x12, 0x19, 0x9e, 0x0b, 0x5d, 0x1e, 0x5c, 0x59, 0x90, 0x9b, 0xdb,
-  0x1b, 0x5d, 0x18, 0x5d, 0xda, 0x9b, 0xdb, 0xdc, 0x14, 0xa1, 0x34, 0x54,
-  0xa3, 0x0e, 0x19, 0x9e, 0x4b, 0x99, 0x1b, 0x9d, 0x5c, 0x1e, 0xd4, 0x5b,
-  0x9a, 0x1b, 0xdd, 0xdc, 0x94, 0xe0, 0x35, 0xba, 0x90, 0xe1, 0xb9, 0x8c,
-  0xbd, 0xd5, 0xb9, 0xd1, 0x95, 0xc9, 0xcd, 0x4d, 0x09, 0x78, 0x03, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c,
-  0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3,
-  0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6,
-  0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e,
-  0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43,
-  0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03,
-  0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48,
-  0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20,
-  0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e,
-  0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d,
-  0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89,
-  0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83,
-  0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68,
-  0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90,
-  0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78,
-  0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98,
-  0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5,
-  0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c,
-  0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c,
-  0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43,
-  0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43,
-  0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82,
-  0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70,
-  0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8,
-  0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2,
-  0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00,
-  0x71, 0x20, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x15, 0x40, 0x06, 0x81,
-  0x1f, 0xb9, 0x0c, 0xa7, 0xa3, 0x91, 0xe9, 0xb2, 0x3c, 0x2c, 0x1f, 0xa3,
-  0xf3, 0x40, 0xe0, 0xcc, 0xfa, 0x23, 0x51, 0xcb, 0x78, 0x7a, 0x5d, 0x5e,
-  0x96, 0x11, 0x81, 0x4d, 0x20, 0x30, 0x58, 0x02, 0x6a, 0x10, 0xf8, 0x91,
-  0xcb, 0x70, 0x3a, 0x1a, 0x99, 0x2e, 0xcb, 0xc3, 0xf2, 0x31, 0x3a, 0x3f,
-  0x0d, 0xb7, 0xe1, 0xec, 0xb2, 0x1c, 0x08, 0x9c, 0x55, 0xa7, 0xe1, 0x36,
-  0x9c, 0x5d, 0x96, 0x4f, 0xe9, 0x61, 0x7a, 0x19, 0x08, 0x0c, 0x16, 0xc0,
-  0x29, 0x04, 0x7e, 0xe4, 0xbc, 0x3b, 0xdc, 0x4e, 0x8f, 0x87, 0xef, 0x76,
-  0x3b, 0xec, 0x26, 0x0b, 0xeb, 0x66, 0x73, 0x59, 0x0e, 0x04, 0xce, 0xac,
-  0x3f, 0x52, 0x10, 0x0e, 0x2f, 0xbb, 0xc9, 0x53, 0xba, 0xbc, 0x3e, 0xa6,
-  0xd7, 0xe5, 0x65, 0xb2, 0xb0, 0x6e, 0x36, 0x97, 0xe5, 0xc0, 0x2a, 0x31,
-  0xef, 0x0e, 0xb7, 0xd3, 0xe3, 0xe1, 0xbb, 0xdd, 0x0e, 0xbb, 0xc9, 0x40,
-  0x20, 0x10, 0x18, 0xac, 0x02, 0x53, 0x08, 0xfc, 0xc8, 0x79, 0x77, 0xb8,
-  0x9d, 0x1e, 0x3f, 0xc5, 0xea, 0xf2, 0x98, 0x2e, 0xac, 0x9b, 0xcd, 0x65,
-  0x39, 0x10, 0x38, 0xb3, 0xfe, 0x48, 0x53, 0xba, 0xbc, 0x3e, 0xa6, 0xd7,
-  0xe5, 0x65, 0xb2, 0xb0, 0x6e, 0x36, 0x97, 0xe5, 0xc0, 0x2a, 0x31, 0xef,
-  0x0e, 0xb7, 0xd3, 0xe3, 0xa7, 0x58, 0x5d, 0x1e, 0xd3, 0x81, 0x40, 0x20,
-  0x30, 0xf8, 0x65, 0x97, 0xcf, 0xe1, 0x71, 0xde, 0x08, 0x26, 0x01, 0x60,
-  0x88, 0x08, 0xd8, 0xa8, 0xa2, 0x20, 0xa2, 0x7f, 0x21, 0x0c, 0x40, 0xc0,
-  0x6c, 0x40, 0x1a, 0x88, 0x67, 0x3a, 0x42, 0x84, 0x88, 0x80, 0x48, 0x38,
-  0x30, 0x16, 0xc9, 0x08, 0x53, 0x80, 0x86, 0xcb, 0x77, 0x1e, 0x3f, 0x40,
-  0x1a, 0x20, 0xc2, 0xfc, 0xe2, 0xb6, 0x6d, 0x82, 0x1a, 0x2e, 0xdf, 0x79,
-  0xfc, 0x80, 0x2a, 0x0a, 0x22, 0x2a, 0x1d, 0x60, 0xf0, 0x8b, 0xdb, 0x36,
-  0x09, 0x6a, 0xb8, 0x7c, 0xe7, 0xf1, 0x03, 0xaa, 0x28, 0x88, 0xa8, 0x74,
-  0x80, 0xc1, 0x47, 0x6e, 0xdb, 0x28, 0xaa, 0xe1, 0xf2, 0x9d, 0xc7, 0x0f,
-  0xa8, 0xa2, 0x20, 0x22, 0x76, 0x72, 0x22, 0xc2, 0x47, 0x6e, 0xdb, 0x18,
-  0xb2, 0xe1, 0xf2, 0x9d, 0xc7, 0x0f, 0xa8, 0xa2, 0x20, 0x22, 0xf7, 0x19,
-  0x80, 0x89, 0xe0, 0x1c, 0xaa, 0x99, 0x88, 0xc8, 0x1e, 0xb6, 0xe1, 0xf2,
-  0x9d, 0xc7, 0x17, 0x02, 0xaa, 0x28, 0x88, 0xa8, 0x74, 0x80, 0xa1, 0x24,
-  0x0c, 0x40, 0xc0, 0xfc, 0xe2, 0xb6, 0xcd, 0x61, 0x1b, 0x2e, 0xdf, 0x79,
-  0x7c, 0x21, 0xa0, 0x8a, 0x82, 0x88, 0x4a, 0x07, 0x18, 0x4a, 0xc2, 0x00,
-  0x04, 0xcc, 0x47, 0x6e, 0xdb, 0x22, 0xa4, 0xe1, 0xf2, 0x9d, 0xc7, 0x17,
-  0x22, 0x02, 0x98, 0x88, 0x10, 0x68, 0x86, 0x85, 0xb0, 0x06, 0x67, 0xb8,
-  0x7c, 0xe7, 0xf1, 0x07, 0x67, 0xb2, 0xfd, 0xe2, 0xb6, 0x0d, 0xc1, 0x19,
-  0x2e, 0xdf, 0x79, 0xfc, 0xc1, 0x99, 0x6e, 0xbf, 0xb8, 0x6d, 0x5b, 0xa8,
-  0x86, 0xcb, 0x77, 0x1e, 0x5f, 0x02, 0x98, 0x67, 0x21, 0x4a, 0xa2, 0x22,
-  0x16, 0xbf, 0xb8, 0x6d, 0x83, 0x90, 0x86, 0xcb, 0x77, 0x1e, 0x7f, 0x22,
-  0xa2, 0x09, 0x01, 0x22, 0xcc, 0x2f, 0x6e, 0xdb, 0x0e, 0xa4, 0xe1, 0xf2,
-  0x9d, 0xc7, 0x9f, 0x8e, 0x88, 0x00, 0x06, 0x71, 0xf0, 0x91, 0xdb, 0xb6,
-  0x84, 0x67, 0xb8, 0x7c, 0xe7, 0xf1, 0xa9, 0x06, 0x88, 0x30, 0xbf, 0xb8,
-  0x6d, 0x33, 0x20, 0x18, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x41, 0x53, 0x48, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x4c, 0x1d, 0x0f, 0x2f, 0xbb, 0x6c, 0x00, 0xdc, 0xe8, 0xff, 0x33, 0x03,
-  0x47, 0xee, 0x98, 0x3e, 0x44, 0x58, 0x49, 0x4c, 0xf0, 0x11, 0x00, 0x00,
-  0x60, 0x00, 0x05, 0x00, 0x7c, 0x04, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c,
-  0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xd8, 0x11, 0x00, 0x00,
-  0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0x73, 0x04, 0x00, 0x00,
-  0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39,
-  0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62,
-  0x80, 0x1c, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14,
-  0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20,
-  0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90,
-  0x91, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a,
-  0x04, 0x39, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d,
-  0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x01, 0xd5, 0x06, 0x62,
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x00, 0x49, 0x18, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
-  0x32, 0x22, 0xc8, 0x09, 0x20, 0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84,
-  0x04, 0x93, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c,
-  0x0b, 0x84, 0xe4, 0x4c, 0x10, 0xa4, 0xc2, 0x08, 0x40, 0x09, 0x00, 0x14,
-  0x98, 0x23, 0x00, 0x83, 0x32, 0x0c, 0x06, 0x03, 0x22, 0xcc, 0x00, 0x14,
-  0xc4, 0x30, 0x30, 0x18, 0x0c, 0x06, 0x83, 0x81, 0x0e, 0x65, 0x30, 0x0c,
-  0x0c, 0x94, 0x28, 0x84, 0x61, 0x60, 0x30, 0xd0, 0xe2, 0xa6, 0xe1, 0xf2,
-  0x27, 0xec, 0x21, 0x24, 0x7f, 0x25, 0xa4, 0x95, 0x98, 0xfc, 0xe2, 0xb6,
-  0x51, 0x61, 0x30, 0x18, 0x0c, 0x83, 0x39, 0x02, 0x84, 0x1c, 0xf7, 0x0c,
-  0x97, 0x3f, 0x61, 0x0f, 0x21, 0xf9, 0x21, 0xd0, 0x0c, 0x0b, 0x81, 0x82,
-  0x47, 0x61, 0x1a, 0x03, 0x08, 0xc4, 0x60, 0x30, 0x18, 0x06, 0x83, 0x81,
-  0x81, 0x22, 0x85, 0x18, 0x0c, 0x20, 0x0e, 0x9a, 0x14, 0xc3, 0x30, 0x30,
-  0x18, 0x0c, 0x06, 0xaa, 0x1c, 0x35, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4,
-  0x73, 0x1b, 0x55, 0xac, 0xc4, 0xe4, 0x23, 0xb7, 0x8d, 0x88, 0xc1, 0x60,
-  0x30, 0x28, 0xc4, 0x65, 0x00, 0x19, 0x10, 0xe6, 0xa8, 0xe1, 0xf2, 0x27,
-  0xec, 0x21, 0x24, 0x9f, 0xdb, 0xa8, 0x62, 0x25, 0x26, 0xbf, 0xb8, 0x6d,
-  0x44, 0x18, 0x0c, 0x06, 0x43, 0x21, 0x34, 0x03, 0xc8, 0x80, 0x36, 0xa5,
-  0x30, 0x0c, 0x0c, 0x06, 0x03, 0x75, 0xe6, 0x08, 0x82, 0x62, 0x40, 0x06,
-  0x8e, 0xc1, 0xe0, 0x43, 0xa0, 0x9b, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90,
-  0xfc, 0x95, 0x90, 0x56, 0x62, 0xf2, 0x91, 0xdb, 0x46, 0xc5, 0x60, 0x30,
-  0x18, 0x0c, 0x4a, 0x21, 0x1a, 0x40, 0x06, 0x03, 0x1a, 0x95, 0xa2, 0x31,
-  0x80, 0x0c, 0x06, 0x54, 0x2a, 0x0a, 0x60, 0x00, 0x19, 0x0c, 0x06, 0x83,
-  0xc1, 0xc0, 0x41, 0xa7, 0x81, 0x80, 0x61, 0x04, 0xc2, 0x48, 0x02, 0xd5,
-  0x30, 0xc2, 0x60, 0x5c, 0x25, 0x4d, 0x11, 0x25, 0x4c, 0xfe, 0xe6, 0x50,
-  0xcd, 0x80, 0x34, 0x06, 0xfb, 0x1c, 0x44, 0x44, 0x20, 0x81, 0x65, 0x38,
-  0x45, 0x9a, 0x22, 0x4a, 0x98, 0xfc, 0x12, 0xed, 0xd0, 0x30, 0x18, 0x0c,
-  0x72, 0xc0, 0x75, 0x8f, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x26, 0x30, 0x11,
-  0x11, 0x02, 0x2c, 0xc8, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0xe0, 0xd0, 0x60,
-  0xb8, 0x7c, 0x60, 0x41, 0x8c, 0x86, 0x21, 0x9a, 0xc9, 0x5f, 0x08, 0x03,
-  0x10, 0x30, 0x5f, 0x9a, 0x22, 0x4a, 0x98, 0xfc, 0x0e, 0x6b, 0x00, 0x06,
-  0x11, 0xd0, 0x20, 0x21, 0x84, 0x09, 0x19, 0xab, 0x55, 0xeb, 0x05, 0x1b,
-  0xcc, 0x94, 0x07, 0xe4, 0x80, 0x0f, 0x6e, 0x10, 0x0e, 0xec, 0x90, 0x0e,
-  0xe7, 0xe0, 0x0e, 0xed, 0x50, 0x0e, 0xee, 0x40, 0x0f, 0x6e, 0xc0, 0x0e,
-  0xe5, 0x70, 0x0e, 0xe1, 0x30, 0x0e, 0xf9, 0xe0, 0x06, 0xe3, 0xc0, 0x0e,
-  0xe1, 0x30, 0x0f, 0xf3, 0xe0, 0x06, 0xb3, 0x40, 0x0f, 0xf2, 0x50, 0x0f,
-  0xe3, 0x40, 0x0f, 0xf5, 0x20, 0x0f, 0xe5, 0x40, 0x0e, 0xa2, 0x50, 0x0f,
-  0xe6, 0x60, 0x0e, 0xe5, 0x20, 0x0f, 0x7c, 0x40, 0x0a, 0xf9, 0xe0, 0x0e,
-  0xe1, 0xd0, 0x0e, 0xe9, 0x30, 0x0e, 0xaf, 0x20, 0x0e, 0xea, 0x50, 0x0e,
-  0xe3, 0x40, 0x0f, 0x7e, 0x80, 0x82, 0x18, 0xc9, 0x66, 0x0a, 0x83, 0x71,
-  0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70, 0x03, 0x5a, 0x28, 0x07, 0x7c,
-  0xa0, 0x87, 0x7a, 0x90, 0x87, 0x72, 0x90, 0x03, 0x52, 0xe0, 0x03, 0x73,
-  0x60, 0x87, 0x77, 0x08, 0x07, 0x7a, 0xf0, 0x03, 0x3d, 0xd0, 0x83, 0x76,
-  0x48, 0x07, 0x78, 0x98, 0x87, 0x5f, 0xa0, 0x87, 0x7c, 0x80, 0x87, 0x72,
-  0x40, 0xc1, 0x60, 0x26, 0x6b, 0x1c, 0xd8, 0x21, 0x1c, 0xe6, 0x61, 0x1e,
-  0xdc, 0x80, 0x16, 0xca, 0x01, 0x1f, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c,
-  0xe4, 0x80, 0x14, 0xf8, 0xc0, 0x1c, 0xd8, 0xe1, 0x1d, 0xc2, 0x81, 0x1e,
-  0xfc, 0x00, 0x09, 0x06, 0x1a, 0xd5, 0x6e, 0x91, 0xa6, 0x88, 0x12, 0x26,
-  0x1f, 0x68, 0x9c, 0x06, 0x15, 0x83, 0xc1, 0x60, 0x30, 0xb8, 0x4a, 0x9a,
-  0x22, 0x4a, 0x98, 0xfc, 0x0e, 0x6b, 0x00, 0x06, 0x11, 0x38, 0x87, 0x61,
-  0x80, 0x66, 0x40, 0xc2, 0xe0, 0x36, 0x13, 0x1b, 0x8c, 0x03, 0x3b, 0x84,
-  0xc3, 0x3c, 0xcc, 0x83, 0x1b, 0x84, 0x02, 0x3c, 0xc0, 0x43, 0x39, 0xb8,
-  0x03, 0x39, 0xcc, 0x02, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xd4,
-  0x83, 0x3c, 0x94, 0x03, 0x39, 0x88, 0x42, 0x3d, 0x98, 0x83, 0x39, 0x94,
-  0x83, 0x3c, 0xf0, 0x01, 0x29, 0xe4, 0x83, 0x3b, 0x84, 0x43, 0x3b, 0xa4,
-  0xc3, 0x38, 0x8c, 0xc2, 0x3b, 0xb4, 0x43, 0x3b, 0x84, 0x83, 0x3b, 0x90,
-  0x83, 0x1f, 0xa0, 0x00, 0x47, 0xb9, 0x61, 0x04, 0x61, 0xb8, 0x45, 0x9a,
-  0x22, 0x4a, 0x98, 0x7c, 0x16, 0xc9, 0x08, 0x14, 0xec, 0x4e, 0x1a, 0x88,
-  0x67, 0x3a, 0x42, 0x84, 0x88, 0x80, 0x48, 0x38, 0x30, 0x16, 0xc9, 0x08,
-  0x14, 0xf0, 0xa8, 0x77, 0x61, 0x30, 0x5c, 0x3e, 0xb0, 0x20, 0x46, 0xc3,
-  0x10, 0xcd, 0xe4, 0x2f, 0x84, 0x01, 0x08, 0x98, 0x2f, 0x4d, 0x11, 0x25,
-  0x4c, 0x3e, 0x07, 0x30, 0x44, 0x04, 0x20, 0x67, 0xb5, 0x5a, 0xad, 0x58,
-  0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x86, 0x03, 0x83, 0xe1, 0xf2,
-  0x81, 0x05, 0x31, 0x1a, 0x86, 0x68, 0x26, 0x7f, 0x21, 0x0c, 0x40, 0xc0,
-  0x7c, 0x01, 0x60, 0x88, 0x08, 0xd8, 0xa8, 0xa2, 0x20, 0x22, 0x14, 0xfc,
-  0x08, 0x78, 0x93, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x2c, 0xc0, 0x3c, 0x0b,
-  0x11, 0xb1, 0x13, 0x30, 0x11, 0x28, 0x18, 0x90, 0x70, 0x8e, 0x00, 0x14,
-  0x72, 0x60, 0x40, 0x45, 0x1a, 0x4c, 0x01, 0x00, 0x13, 0x14, 0x72, 0xc0,
-  0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0,
-  0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d,
-  0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74,
-  0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6,
-  0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78,
-  0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76,
-  0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x86, 0x3c, 0x04, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x0e, 0x20, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x24, 0x40, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x59, 0x80, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x13, 0x01, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x67, 0x02,
-  0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f,
-  0x05, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
-  0x1e, 0x0c, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x86, 0x3c, 0x1b, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0c, 0x79, 0x3a, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x18, 0xf2, 0x80, 0x01, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0xc6, 0x00, 0x08, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x65, 0x00, 0x04, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x9e, 0x33, 0x00,
-  0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2c, 0x10,
-  0x12, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90,
-  0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x1a, 0x94, 0xc0, 0x08, 0x40,
-  0x31, 0x14, 0x46, 0x81, 0x0e, 0x14, 0x41, 0x49, 0x14, 0x4c, 0x41, 0x14,
-  0x38, 0x41, 0x21, 0x14, 0xa0, 0x00, 0x7d, 0x46, 0x00, 0x6a, 0x80, 0x88,
-  0x23, 0x00, 0x05, 0x42, 0xba, 0x19, 0x00, 0xf2, 0xcd, 0x00, 0x50, 0x70,
-  0x06, 0x80, 0x86, 0x33, 0x00, 0x64, 0x9b, 0x01, 0xa0, 0xd9, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
-  0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b,
-  0x73, 0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99,
-  0x71, 0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62,
-  0x2a, 0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73,
-  0x0b, 0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x84, 0xe1, 0x99, 0x20, 0x0c,
-  0xd0, 0x06, 0x61, 0x20, 0x26, 0x08, 0x43, 0xb4, 0x41, 0x18, 0x0c, 0x0a,
-  0x63, 0x73, 0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08, 0x73, 0x40, 0x06, 0x04,
-  0x26, 0x08, 0x83, 0x34, 0x41, 0x18, 0xa6, 0x0d, 0xc2, 0xd0, 0x6c, 0x48,
-  0x08, 0x65, 0x21, 0x88, 0x81, 0x21, 0x9c, 0x09, 0x82, 0x1d, 0x8c, 0xc1,
-  0x04, 0x61, 0xa0, 0x26, 0x08, 0x43, 0xb5, 0x41, 0x20, 0xa4, 0x0d, 0xc9,
-  0x00, 0x2d, 0xc4, 0x30, 0x44, 0xc4, 0xb4, 0x41, 0x78, 0xa8, 0x09, 0x82,
-  0x1e, 0x7c, 0x13, 0x84, 0x6f, 0x9b, 0x20, 0x7c, 0xdc, 0x04, 0x61, 0xb0,
-  0x36, 0x08, 0x43, 0xb6, 0x61, 0x21, 0xac, 0x85, 0x20, 0x06, 0xe6, 0xc2,
-  0x2e, 0x6d, 0x43, 0xb0, 0x4d, 0x10, 0xfc, 0x00, 0x0c, 0x26, 0x08, 0xc3,
-  0xb5, 0x01, 0x21, 0xba, 0x85, 0x20, 0x06, 0x0f, 0x98, 0x20, 0x84, 0x42,
-  0x18, 0x4c, 0x10, 0x06, 0x6c, 0x03, 0x32, 0x80, 0xc1, 0x42, 0x0c, 0x43,
-  0x18, 0x00, 0x1b, 0x84, 0x4f, 0x0c, 0x26, 0x08, 0xa3, 0x20, 0x06, 0x1b,
-  0x10, 0x82, 0x0c, 0x16, 0x82, 0x18, 0x08, 0x60, 0x43, 0x50, 0x06, 0x1b,
-  0x88, 0x8a, 0x1b, 0x03, 0x33, 0x98, 0x20, 0x08, 0x00, 0x89, 0xb6, 0xb0,
-  0x34, 0xb7, 0x09, 0x02, 0x29, 0x78, 0x13, 0x84, 0x21, 0x9b, 0x20, 0x0c,
-  0xda, 0x86, 0x81, 0x0d, 0x86, 0x61, 0x03, 0x41, 0xa8, 0xc1, 0x1a, 0xb4,
-  0xc1, 0x86, 0x02, 0x0d, 0xd2, 0x00, 0x38, 0x03, 0x37, 0xe0, 0x90, 0xe6,
-  0x46, 0xc7, 0xe7, 0xad, 0xcd, 0x2d, 0x0d, 0xee, 0x8d, 0xae, 0xcc, 0x8d,
-  0x0e, 0x64, 0x0c, 0x2d, 0x4c, 0x8e, 0xd1, 0x54, 0x5a, 0x1b, 0x1c, 0x5b,
-  0x19, 0xc8, 0xd0, 0xcb, 0xd0, 0xca, 0x0a, 0x08, 0x95, 0x50, 0x50, 0xd0,
-  0x86, 0x40, 0x0e, 0x26, 0x08, 0xa4, 0xd0, 0x6d, 0x18, 0xe2, 0x60, 0x0e,
-  0xe8, 0x60, 0xc3, 0x00, 0x07, 0x75, 0x40, 0x07, 0x1b, 0x06, 0x3b, 0xb0,
-  0x03, 0x3a, 0xa8, 0xc2, 0xc6, 0x66, 0xd7, 0xe6, 0x92, 0x46, 0x56, 0xe6,
-  0x46, 0x37, 0x25, 0x08, 0xaa, 0x90, 0xe1, 0xb9, 0xd8, 0x95, 0xc9, 0xcd,
-  0xa5, 0xbd, 0xb9, 0x4d, 0x09, 0x88, 0x26, 0x64, 0x78, 0x2e, 0x76, 0x61,
-  0x6c, 0x76, 0x65, 0x72, 0x53, 0x02, 0xa3, 0x0e, 0x19, 0x9e, 0xcb, 0x1c,
-  0x5a, 0x18, 0x59, 0x99, 0x5c, 0xd3, 0x1b, 0x59, 0x19, 0xdb, 0x94, 0x00,
-  0x29, 0x43, 0x86, 0xe7, 0x22, 0x57, 0x36, 0xf7, 0x56, 0x27, 0x37, 0x56,
-  0x36, 0x37, 0x25, 0x30, 0x83, 0x3a, 0x64, 0x78, 0x2e, 0x65, 0x6e, 0x74,
-  0x72, 0x79, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x53, 0x02, 0x37, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c,
-  0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3,
-  0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6,
-  0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e,
-  0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43,
-  0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03,
-  0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48,
-  0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20,
-  0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e,
-  0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d,
-  0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89,
-  0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83,
-  0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68,
-  0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90,
-  0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78,
-  0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98,
-  0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5,
-  0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c,
-  0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c,
-  0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43,
-  0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43,
-  0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82,
-  0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70,
-  0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8,
-  0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2,
-  0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00,
-  0x71, 0x20, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x46, 0x00, 0x0d, 0x97,
-  0xef, 0x3c, 0x7e, 0x80, 0x34, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x5b, 0x03,
-  0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0,
-  0xe0, 0x17, 0xb7, 0x6d, 0x0c, 0xd4, 0x70, 0xf9, 0xce, 0xe3, 0x07, 0x54,
-  0x51, 0x10, 0x51, 0xe9, 0x00, 0x83, 0x8f, 0xdc, 0xb6, 0x39, 0x54, 0xc3,
-  0xe5, 0x3b, 0x8f, 0x1f, 0x50, 0x45, 0x41, 0x44, 0xec, 0xe4, 0x44, 0x84,
-  0x8f, 0xdc, 0xb6, 0x19, 0x64, 0xc3, 0xe5, 0x3b, 0x8f, 0x1f, 0x50, 0x45,
-  0x41, 0x44, 0xee, 0x33, 0x00, 0x13, 0xc1, 0x39, 0x54, 0x33, 0x11, 0x91,
-  0x25, 0x6c, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x04, 0x54, 0x51, 0x10, 0x51,
-  0xe9, 0x00, 0x43, 0x49, 0x18, 0x80, 0x80, 0xf9, 0xc5, 0x6d, 0x1b, 0xc2,
-  0x36, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x40, 0x15, 0x05, 0x11, 0x95, 0x0e,
-  0x30, 0x94, 0x84, 0x01, 0x08, 0x98, 0x8f, 0xdc, 0xb6, 0x2d, 0x48, 0xc3,
-  0xe5, 0x3b, 0x8f, 0x2f, 0x44, 0x04, 0x30, 0x11, 0x21, 0xd0, 0x0c, 0x0b,
-  0x61, 0x07, 0xce, 0x70, 0xf9, 0xce, 0xe3, 0x0f, 0xce, 0x64, 0xfb, 0xc5,
-  0x6d, 0x9b, 0x80, 0x33, 0x5c, 0xbe, 0xf3, 0xf8, 0x83, 0x33, 0xdd, 0x7e,
-  0x71, 0xdb, 0x56, 0x50, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x04, 0x30, 0xcf,
-  0x42, 0x94, 0x44, 0x45, 0x2c, 0x7e, 0x71, 0xdb, 0xa6, 0x20, 0x0d, 0x97,
-  0xef, 0x3c, 0xfe, 0x44, 0x44, 0x13, 0x02, 0x44, 0x98, 0x5f, 0xdc, 0xb6,
-  0x05, 0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x1d, 0x11, 0x01, 0x0c, 0xe2,
-  0xe0, 0x23, 0xb7, 0x6d, 0x03, 0xcf, 0x70, 0xf9, 0xce, 0xe3, 0x53, 0x0d,
-  0x10, 0x61, 0x7e, 0x71, 0xdb, 0x06, 0x40, 0x30, 0x00, 0xd2, 0x00, 0x00,
-  0x61, 0x20, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x13, 0x04, 0x49, 0x2c,
-  0x10, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x34, 0x28, 0xae, 0x19,
-  0x80, 0x42, 0x0c, 0x28, 0xbb, 0x92, 0x2b, 0xc5, 0x80, 0x72, 0x2b, 0x87,
-  0x32, 0x2a, 0x90, 0x62, 0x2b, 0xdd, 0x80, 0x02, 0x2a, 0xb0, 0xc2, 0x14,
-  0x28, 0x50, 0x81, 0x42, 0x15, 0x28, 0x58, 0x81, 0xc2, 0x15, 0x28, 0x60,
-  0x81, 0x42, 0x16, 0x28, 0x68, 0x81, 0xc2, 0x16, 0x28, 0x70, 0x81, 0xc2,
-  0x1c, 0x28, 0x83, 0x22, 0x29, 0x91, 0x52, 0x28, 0x97, 0xc2, 0x29, 0xbe,
-  0x62, 0x0c, 0x28, 0x14, 0x72, 0x94, 0x41, 0x11, 0x8c, 0x00, 0x94, 0x00,
-  0x19, 0xc6, 0x08, 0xd8, 0x36, 0x7e, 0xe5, 0x6d, 0x8c, 0x00, 0x04, 0x41,
-  0x50, 0x05, 0x83, 0x31, 0x02, 0x10, 0x04, 0x41, 0x19, 0x0c, 0x46, 0x00,
-  0x66, 0x00, 0xc6, 0x08, 0x40, 0x10, 0x04, 0x41, 0x50, 0x18, 0x23, 0x00,
-  0x41, 0x10, 0x84, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x23, 0x06, 0x09, 0x00,
-  0x82, 0x60, 0x00, 0x06, 0xa7, 0x90, 0x06, 0x88, 0x28, 0x88, 0xc2, 0x1d,
-  0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x01, 0x18, 0xa0, 0x82, 0x1a, 0x28,
-  0xa4, 0x40, 0x0a, 0x78, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x60,
-  0x90, 0x0a, 0x6b, 0xb0, 0x90, 0x02, 0x29, 0xe4, 0xc1, 0x88, 0x41, 0x02,
-  0x80, 0x20, 0x18, 0x80, 0x81, 0x2a, 0xb0, 0x81, 0x53, 0x0a, 0xa5, 0xa0,
-  0x07, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x00, 0x06, 0xab, 0xd0, 0x06,
-  0xce, 0x29, 0x9c, 0xc2, 0x1e, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x01,
-  0x18, 0xb0, 0x82, 0x1b, 0x3c, 0xa7, 0x70, 0x0a, 0x7c, 0x30, 0x62, 0x60,
-  0x00, 0x20, 0x08, 0x06, 0xc4, 0x2d, 0xa0, 0x01, 0x2a, 0xcc, 0x44, 0x94,
-  0xc2, 0xf0, 0x8c, 0xc2, 0x4c, 0x44, 0x29, 0x0c, 0xcf, 0x28, 0xcc, 0x44,
-  0x94, 0xc2, 0xf0, 0x8c, 0xc2, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x94,
-  0xc1, 0x2b, 0xd4, 0x01, 0x42, 0xb0, 0xc2, 0x68, 0x42, 0x00, 0x8c, 0x26,
-  0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x41,
-  0x19, 0xcc, 0x42, 0x1e, 0x30, 0x88, 0x1c, 0x8c, 0x26, 0x04, 0xc0, 0x68,
-  0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18,
-  0x94, 0xc1, 0x2d, 0xf4, 0x01, 0xc4, 0xcc, 0xc1, 0x68, 0x42, 0x00, 0x8c,
-  0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82,
-  0x41, 0x19, 0xec, 0x42, 0x28, 0x50, 0x90, 0x1d, 0x8c, 0x18, 0x20, 0x00,
-  0x08, 0x82, 0x41, 0x19, 0xf0, 0x82, 0x28, 0x54, 0xd1, 0x2b, 0x8c, 0x26,
-  0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x88, 0x01, 0x02,
-  0x80, 0x20, 0x18, 0x94, 0x01, 0x38, 0x98, 0x42, 0x56, 0xe9, 0xc1, 0x2a,
-  0x0e, 0x95, 0x2f, 0xf8, 0xc2, 0x2a, 0x0e, 0xd5, 0x2f, 0xfc, 0xc2, 0x2a,
-  0x0e, 0x15, 0x38, 0x80, 0xc3, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c,
-  0x41, 0x39, 0xa8, 0x42, 0x97, 0xf5, 0xc1, 0x68, 0x42, 0x00, 0x0c, 0x1b,
-  0x10, 0x45, 0x30, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06,
-  0xe7, 0xc0, 0x0a, 0xdf, 0xe6, 0x07, 0xa3, 0x09, 0x01, 0x30, 0x6c, 0x40,
-  0x18, 0xc1, 0x00, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18, 0xa4,
-  0x83, 0x2b, 0x84, 0x41, 0xf7, 0x07, 0xa3, 0x09, 0x01, 0x30, 0x6c, 0x40,
-  0x1c, 0xc1, 0x00, 0xac, 0xe2, 0xe0, 0x9d, 0x03, 0x3a, 0xac, 0xe2, 0xe0,
-  0xa1, 0x43, 0x3a, 0xac, 0xe2, 0xe0, 0xa5, 0x83, 0x3a, 0x8c, 0x18, 0x20,
-  0x00, 0x08, 0x82, 0xc1, 0x18, 0xb8, 0xc3, 0x2c, 0x98, 0x81, 0x18, 0x8c,
-  0xc2, 0x68, 0x42, 0x00, 0x0c, 0x1b, 0x10, 0x45, 0x30, 0x00, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0xf0, 0x50, 0x0b, 0x68, 0x40, 0x06,
-  0xa4, 0x30, 0x9a, 0x10, 0x00, 0xc3, 0x06, 0x84, 0x11, 0x0c, 0xc0, 0x88,
-  0x01, 0x02, 0x80, 0x20, 0x18, 0x8c, 0x81, 0x3c, 0xdc, 0x82, 0x1a, 0x98,
-  0x41, 0x29, 0x8c, 0x26, 0x04, 0xc0, 0xb0, 0x01, 0x71, 0x04, 0x03, 0xb0,
-  0x8a, 0xc3, 0x19, 0xc0, 0x03, 0x3b, 0xac, 0xe2, 0x70, 0x06, 0xf1, 0xd0,
-  0x0e, 0xab, 0x38, 0x9c, 0x81, 0x3c, 0xb8, 0xc3, 0x88, 0x01, 0x02, 0x80,
-  0x20, 0x18, 0x8c, 0xc1, 0x3d, 0xf0, 0xc2, 0x1b, 0xac, 0x41, 0x2a, 0x8c,
-  0x26, 0x04, 0xc0, 0xb0, 0x01, 0x51, 0x04, 0x03, 0x30, 0x62, 0x80, 0x00,
-  0x20, 0x08, 0x06, 0x63, 0x90, 0x0f, 0xbe, 0x10, 0x07, 0x6d, 0xa0, 0x0a,
-  0xa3, 0x09, 0x01, 0x30, 0x6c, 0x40, 0x18, 0xc1, 0x00, 0x8c, 0x18, 0x20,
-  0x00, 0x08, 0x82, 0xc1, 0x18, 0xec, 0x03, 0x38, 0xcc, 0xc1, 0x1b, 0xac,
-  0xc2, 0x68, 0x42, 0x00, 0x0c, 0x1b, 0x10, 0x47, 0x30, 0x00, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0xfd, 0x20, 0x0e, 0x75, 0x10, 0x07,
-  0xac, 0x30, 0x9a, 0x10, 0x00, 0x15, 0xf0, 0x83, 0x0e, 0x37, 0x04, 0xfc,
-  0x00, 0x06, 0xb3, 0x0c, 0x48, 0x10, 0x8c, 0x26, 0x80, 0x01, 0x30, 0x9a,
-  0x60, 0x06, 0xc3, 0x68, 0xc2, 0x19, 0x08, 0xa3, 0x09, 0x68, 0x10, 0x8c,
-  0x26, 0xa4, 0x01, 0x30, 0x9a, 0xe0, 0x06, 0xc3, 0x68, 0xc2, 0x1c, 0x0c,
-  0xa3, 0x09, 0x78, 0x30, 0x8c, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1, 0x31,
-  0x13, 0xea, 0x80, 0x07, 0x74, 0x00, 0x07, 0x78, 0x40, 0x07, 0x70, 0x30,
-  0x62, 0xb0, 0x00, 0x20, 0x08, 0x06, 0x07, 0x4d, 0xac, 0x03, 0x1e, 0xd0,
-  0x01, 0x1c, 0xe0, 0x01, 0x1d, 0xc0, 0xc1, 0x88, 0xc1, 0x02, 0x80, 0x20,
-  0x18, 0x1c, 0x35, 0xc1, 0x0e, 0x78, 0x40, 0x07, 0x70, 0x80, 0x07, 0x74,
-  0x00, 0x07, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xb0, 0xd0, 0xc4, 0x3a,
-  0x08, 0xc1, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x2c, 0x35, 0xc1, 0x0e,
-  0x44, 0x30, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06, 0xc9, 0x4d, 0x90, 0x44,
-  0x60, 0x81, 0x23, 0x1f, 0x93, 0x83, 0x3f, 0x90, 0xcf, 0x88, 0x01, 0x02,
-  0x80, 0x20, 0x18, 0x74, 0x33, 0x81, 0x0f, 0x7c, 0x20, 0x07, 0xc1, 0x88,
-  0x01, 0x02, 0x80, 0x20, 0x18, 0x74, 0x34, 0x91, 0x0f, 0x79, 0x20, 0x07,
-  0x81, 0x05, 0x0e, 0x74, 0xcc, 0x0e, 0x44, 0x41, 0x3e, 0x23, 0x06, 0x08,
-  0x00, 0x82, 0x60, 0xd0, 0xdd, 0x04, 0x3f, 0xfc, 0x81, 0x1d, 0x04, 0x23,
-  0x06, 0x08, 0x00, 0x82, 0x60, 0xd0, 0xe1, 0x44, 0x3f, 0xf0, 0x81, 0x1d,
-  0x04, 0x16, 0x4c, 0xd0, 0x31, 0x3d, 0x28, 0x05, 0xf9, 0x8c, 0x18, 0x20,
-  0x00, 0x08, 0x82, 0x41, 0xb7, 0x13, 0x20, 0x21, 0x0a, 0x7a, 0x10, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0xc7, 0x13, 0x21, 0xf1, 0x07, 0x7a,
-  0x10, 0x58, 0x80, 0x41, 0xc7, 0xfc, 0x80, 0x92, 0xcf, 0x88, 0x01, 0x02,
-  0x80, 0x20, 0x18, 0x74, 0x3f, 0x41, 0x12, 0x96, 0x1f, 0x04, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0xd0, 0x81, 0x45, 0x49, 0x60, 0x7e, 0x10, 0x58,
-  0xd0, 0x41, 0x67, 0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0xb6, 0xb1, 0x20,
-  0x09, 0x5b, 0xe0, 0x89, 0xd1, 0x84, 0x00, 0x18, 0x4d, 0x10, 0x82, 0xd1,
-  0x84, 0x41, 0x18, 0x31, 0x38, 0x00, 0x10, 0x04, 0x83, 0xed, 0x2c, 0x50,
-  0x42, 0x17, 0xc2, 0x62, 0x34, 0x21, 0x00, 0x46, 0x13, 0x84, 0x60, 0x34,
-  0x61, 0x10, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0x60, 0x5b, 0x0b, 0x96,
-  0xf0, 0x05, 0xb0, 0x18, 0x4d, 0x08, 0x80, 0xd1, 0x04, 0x21, 0x18, 0x4d,
-  0x18, 0x84, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0xd8, 0xde, 0x02, 0x26,
-  0xc4, 0x41, 0x1f, 0x46, 0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13,
-  0x06, 0xc1, 0x9e, 0x4e, 0x3e, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0xd0,
-  0xcd, 0x05, 0x4e, 0x30, 0x5a, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06,
-  0x1d, 0x5d, 0xe4, 0x44, 0x72, 0x05, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60,
-  0xd0, 0xd5, 0x85, 0x4e, 0x18, 0x54, 0x60, 0x52, 0x18, 0xc8, 0x67, 0xc4,
-  0x00, 0x01, 0x40, 0x10, 0x0c, 0xba, 0xbb, 0xe0, 0x89, 0xc7, 0x0b, 0x46,
-  0x0c, 0x10, 0x00, 0x04, 0xc1, 0xa0, 0xc3, 0x8b, 0x9e, 0x60, 0xb6, 0x60,
-  0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0xba, 0xbc, 0xf0, 0x89, 0x04, 0x0b,
-  0xac, 0x2a, 0x03, 0xf9, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0xb7,
-  0x17, 0x60, 0x21, 0x89, 0x41, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06,
-  0x1d, 0x5f, 0x84, 0xc5, 0xf3, 0x05, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60,
-  0xd0, 0xf5, 0x85, 0x58, 0x30, 0x5c, 0x30, 0x62, 0x70, 0x00, 0x20, 0x08,
-  0x06, 0xdb, 0x5f, 0x80, 0x85, 0x3c, 0xa4, 0xc4, 0x68, 0x42, 0x10, 0x8c,
-  0x26, 0x08, 0xc0, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x6c, 0xa2, 0x31,
-  0x16, 0xf5, 0xb0, 0x12, 0xa3, 0x09, 0xc1, 0x30, 0x9a, 0x20, 0x08, 0xa3,
-  0x09, 0x43, 0x30, 0x9a, 0x40, 0x00, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60,
-  0x90, 0xb4, 0xc6, 0x5f, 0x44, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60, 0x90,
-  0xb8, 0x06, 0x68, 0x38, 0x23, 0x06, 0x0b, 0x00, 0x82, 0x60, 0x70, 0xc0,
-  0xc6, 0x59, 0x0c, 0x24, 0x41, 0x08, 0xc1, 0x62, 0x23, 0x81, 0x07, 0xf1,
-  0x19, 0x8e, 0x10, 0x82, 0xe1, 0x1b, 0x31, 0x58, 0x00, 0x10, 0x04, 0x83,
-  0x63, 0x36, 0xd4, 0xe2, 0x24, 0x90, 0xa4, 0x20, 0x9c, 0xe1, 0x88, 0x60,
-  0x18, 0xbe, 0x1a, 0x02, 0xb5, 0xa8, 0x0f, 0xe2, 0x33, 0x1c, 0x11, 0x3c,
-  0xc5, 0x57, 0xc1, 0xa0, 0x46, 0x81, 0x02, 0x7c, 0x86, 0x23, 0x82, 0x69,
-  0xf8, 0x2a, 0x18, 0xf4, 0x82, 0x41, 0xcc, 0x32, 0x08, 0x88, 0x30, 0x62,
-  0x70, 0x00, 0x20, 0x08, 0x06, 0x9b, 0x6d, 0xdc, 0x45, 0x4a, 0x98, 0xc6,
-  0x68, 0x42, 0x00, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1, 0x86, 0x1b,
-  0x79, 0xb1, 0x12, 0x60, 0x31, 0x9a, 0x10, 0x04, 0xc3, 0x11, 0x48, 0xc6,
-  0x7c, 0xb3, 0x0c, 0x03, 0x11, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x41,
-  0xd5, 0x1b, 0x75, 0x51, 0x06, 0x5d, 0x19, 0x74, 0xa6, 0x0a, 0xaa, 0x20,
-  0x1f, 0x13, 0x82, 0xf8, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0x42,
-  0x1e, 0xb1, 0x11, 0x58, 0x90, 0x06, 0xf2, 0x19, 0x31, 0x40, 0x00, 0x10,
-  0x04, 0x83, 0xee, 0x37, 0x48, 0xc3, 0x15, 0xc4, 0x20, 0xb0, 0x57, 0x58,
-  0x03, 0xf9, 0xd8, 0x4e, 0x04, 0xf1, 0x19, 0x31, 0x40, 0x00, 0x10, 0x04,
-  0x83, 0x4e, 0x3c, 0x4e, 0xa3, 0x28, 0x83, 0x60, 0xc4, 0x00, 0x01, 0x40,
-  0x10, 0x0c, 0xba, 0xf1, 0x40, 0x0d, 0xcd, 0x0c, 0x8a, 0x11, 0x03, 0x04,
-  0x00, 0x41, 0x30, 0xe8, 0xc8, 0x23, 0x35, 0x8e, 0x33, 0x20, 0x46, 0x0c,
-  0x12, 0x00, 0x04, 0xc1, 0xa0, 0x42, 0x0f, 0xd0, 0x60, 0x03, 0x34, 0x60,
-  0x03, 0x34, 0xb0, 0x60, 0x89, 0xcf, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18,
-  0x24, 0xee, 0xb1, 0x1b, 0x81, 0x05, 0x6f, 0x20, 0x9f, 0x11, 0x03, 0x04,
-  0x00, 0x41, 0x30, 0xe8, 0xd2, 0xc3, 0x35, 0x70, 0x81, 0x0d, 0x02, 0xcb,
-  0x85, 0x38, 0x90, 0x8f, 0x95, 0x45, 0x10, 0x9f, 0x11, 0x03, 0x04, 0x00,
-  0x41, 0x30, 0xe8, 0xd8, 0x23, 0x36, 0x8a, 0x37, 0x08, 0x46, 0x0c, 0x10,
-  0x00, 0x04, 0xc1, 0xa0, 0x6b, 0x0f, 0xd9, 0x20, 0x03, 0x38, 0x28, 0x46,
-  0x0c, 0x10, 0x00, 0x04, 0xc1, 0xa0, 0x73, 0x8f, 0xd9, 0x38, 0xe2, 0x80,
-  0x30, 0x28, 0x93, 0x8f, 0xa9, 0x85, 0x13, 0x1f, 0x13, 0x02, 0xfa, 0xd8,
-  0xc3, 0xc9, 0xc7, 0xda, 0xe2, 0x89, 0x8f, 0x09, 0x01, 0x7d, 0x8c, 0xe9,
-  0xe4, 0x63, 0x70, 0xa1, 0xc4, 0xc7, 0x84, 0x80, 0x3e, 0xb6, 0x80, 0x81,
-  0x7c, 0x6c, 0x2e, 0x96, 0xf8, 0x98, 0x10, 0xd0, 0x67, 0x96, 0x80, 0x18,
-  0xa8, 0xf8, 0x64, 0x67, 0xa0, 0x1d, 0x61, 0xa0, 0xc2, 0xb0, 0x06, 0x77,
-  0x11, 0x06, 0x2a, 0x0c, 0x66, 0x80, 0x17, 0x61, 0xa0, 0xc2, 0xa0, 0x06,
-  0x79, 0x11, 0x06, 0x2a, 0x0c, 0x65, 0xa0, 0x17, 0x61, 0x96, 0xa1, 0x30,
-  0x0a, 0x23, 0xf2, 0x42, 0x3e, 0x46, 0xe8, 0x85, 0x7c, 0x8c, 0xd8, 0x0b,
-  0xf9, 0x18, 0xc1, 0x17, 0xf2, 0x31, 0xa2, 0x2f, 0xe0, 0x63, 0x7e, 0x41,
-  0xc4, 0xc7, 0x88, 0xbf, 0x80, 0x8f, 0x81, 0x06, 0x11, 0x9f, 0x11, 0x03,
-  0x03, 0x00, 0x41, 0x30, 0x48, 0x5e, 0xc4, 0x3c, 0x88, 0x11, 0x03, 0x03,
-  0x00, 0x41, 0x30, 0x48, 0x60, 0xe4, 0x3c, 0x88, 0x11, 0x03, 0x03, 0x00,
-  0x41, 0x30, 0x48, 0x62, 0x04, 0x3d, 0x88, 0x11, 0x03, 0x03, 0x00, 0x41,
-  0x30, 0x48, 0x64, 0x24, 0x3d, 0x08, 0x13, 0x88, 0xf8, 0x98, 0x40, 0xc4,
-  0x67, 0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0x30, 0x18, 0x81, 0x8f, 0xd0,
-  0x40, 0x91, 0xd1, 0x84, 0x00, 0x18, 0x4d, 0x10, 0x82, 0x13, 0x0c, 0x75,
-  0x82, 0xa1, 0x4c, 0x38, 0xe4, 0x63, 0xc2, 0x21, 0x9f, 0x11, 0x83, 0x03,
-  0x00, 0x41, 0x30, 0x58, 0x76, 0x44, 0x3e, 0x84, 0x60, 0xc4, 0xc0, 0x00,
-  0x40, 0x10, 0x0c, 0x92, 0x1e, 0xf1, 0x8d, 0x60, 0xc4, 0xc0, 0x00, 0x40,
-  0x10, 0x0c, 0x12, 0x1f, 0xf1, 0x8d, 0xc0, 0x1c, 0x08, 0x3e, 0xe6, 0x40,
-  0xf0, 0x31, 0x61, 0x36, 0xe4, 0x63, 0x02, 0x6d, 0xc8, 0x67, 0xc4, 0xe0,
-  0x01, 0x40, 0x10, 0x0c, 0xa2, 0x30, 0x11, 0x8f, 0xd9, 0x88, 0x0d, 0x21,
-  0xb8, 0x8d, 0xdb, 0xb0, 0x11, 0x1b, 0x01, 0x91, 0x62, 0x34, 0x21, 0x00,
-  0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0x60, 0xfb, 0x11, 0x10, 0x91, 0x8d,
-  0x1b, 0x19, 0x4d, 0x08, 0x04, 0xd3, 0x8d, 0x20, 0x3e, 0x23, 0x06, 0x07,
-  0x00, 0x82, 0x60, 0xb0, 0x89, 0xc9, 0x88, 0xd4, 0xc6, 0x7f, 0x8c, 0x26,
-  0x04, 0x82, 0x05, 0xb2, 0x40, 0x1f, 0x23, 0x82, 0xf8, 0x18, 0x42, 0x1e,
-  0xf0, 0x19, 0x8e, 0x10, 0x82, 0xe2, 0xbb, 0x60, 0x10, 0xb3, 0x04, 0xc6,
-  0x40, 0xc5, 0x20, 0x14, 0x68, 0x41, 0x0c, 0x37, 0x04, 0x63, 0x02, 0x06,
-  0xb3, 0x0c, 0xc8, 0x11, 0x58, 0x3d, 0xd4, 0x83, 0x7c, 0x4c, 0x1e, 0xe4,
-  0x41, 0x3e, 0x16, 0x08, 0xf0, 0x31, 0x78, 0x80, 0x07, 0xf9, 0x98, 0x10,
-  0xc0, 0x67, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x12, 0x3b, 0x19, 0x93,
-  0xc0, 0x82, 0x9f, 0x88, 0xcf, 0x70, 0x44, 0xf0, 0x1e, 0xc4, 0x37, 0x1c,
-  0x21, 0xbc, 0x07, 0xf1, 0x4d, 0x37, 0xb8, 0x49, 0x9a, 0x04, 0xd3, 0x0d,
-  0x6e, 0x12, 0x0c, 0xbb, 0x38, 0x94, 0xc7, 0x9b, 0x04, 0x14, 0x0c, 0xc6,
-  0x2e, 0x0e, 0xe8, 0x11, 0x27, 0x03, 0x05, 0x83, 0xb1, 0x8b, 0x03, 0x7a,
-  0xcc, 0x49, 0x41, 0xc1, 0x60, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1,
-  0xf4, 0x27, 0x20, 0x32, 0x1f, 0xfb, 0x31, 0x62, 0xd0, 0x00, 0x20, 0x08,
-  0x06, 0x67, 0x80, 0x27, 0x3c, 0x42, 0x1f, 0x81, 0x9d, 0xb8, 0x07, 0x98,
-  0x80, 0x09, 0x98, 0xf0, 0xc7, 0x88, 0x41, 0x03, 0x80, 0x20, 0x18, 0x9c,
-  0x01, 0x9e, 0xf0, 0x08, 0x7d, 0x04, 0x6d, 0x62, 0x80, 0x09, 0x98, 0x80,
-  0x09, 0x7f, 0x8c, 0x18, 0x34, 0x00, 0x08, 0x82, 0xc1, 0x19, 0xe0, 0x09,
-  0x8f, 0xd0, 0x47, 0xf0, 0x26, 0x77, 0x02, 0x26, 0x60, 0x02, 0x26, 0xfc,
-  0x31, 0x62, 0xd0, 0x00, 0x20, 0x08, 0x06, 0x67, 0x80, 0x27, 0x3c, 0x42,
-  0x1f, 0x01, 0x9d, 0x10, 0x60, 0x02, 0x26, 0x60, 0xc2, 0x1f, 0x23, 0x06,
-  0x0d, 0x00, 0x82, 0x60, 0x70, 0x06, 0x78, 0xc2, 0x23, 0xf4, 0x11, 0xe0,
-  0x88, 0x00, 0x26, 0x60, 0x02, 0x26, 0xfc, 0x31, 0x62, 0xd0, 0x00, 0x20,
-  0x08, 0x06, 0x67, 0x80, 0x27, 0x3c, 0x42, 0x1f, 0x01, 0x88, 0xd8, 0x09,
-  0x98, 0x80, 0x09, 0x98, 0xf0, 0xc7, 0x2c, 0x01, 0x82, 0x01, 0x31, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x5b, 0x06, 0xff, 0x08, 0xec, 0x60, 0xcb, 0x00,
-  0x22, 0x81, 0x1d, 0x6c, 0x19, 0x44, 0x24, 0xb0, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
@@ -1,1389 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-; shader hash: 227838ea135e86326be348690bc54df2
-;
-; Pipeline Runtime Information: 
-;
-;
-;
-; Buffer Definitions:
-;
-; cbuffer depthHierarchySize
-; {
-;
-;   struct depthHierarchySize
-;   {
-;
-;       struct struct.Size
-;       {
-;
-;           uint2 size;                               ; Offset:    0
-;       
-;       } depthHierarchySize;                         ; Offset:    0
-;
-;   
-;   } depthHierarchySize;                             ; Offset:    0 Size:     8
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for skinnedObjectBuffer
-; {
-;
-;   struct struct.SkinnedObject
-;   {
-;
-;       struct struct.BoundingSphere
-;       {
-;
-;           float3 center;                            ; Offset:    0
-;           float radius;                             ; Offset:   12
-;       
-;       } boundingSphere;                             ; Offset:    0
-;
-;       struct struct.LOD
-;       {
-;
-;           uint startIndex;                          ; Offset:   16
-;           uint indexCount;                          ; Offset:   20
-;           uint vertexOffset;                        ; Offset:   24
-;       
-;       } lods[3];;                                   ; Offset:   16
-;
-;       struct struct.Material
-;       {
-;
-;           uint baseColorID;                         ; Offset:   52
-;           uint normalID;                            ; Offset:   56
-;           uint roughnessAOID;                       ; Offset:   60
-;           uint metallicID;                          ; Offset:   64
-;           uint heightID;                            ; Offset:   68
-;           uint specialID;                           ; Offset:   72
-;       
-;       } material;                                   ; Offset:   52
-;
-;       uint boneIndex;                               ; Offset:   76
-;       uint flags;                                   ; Offset:   80
-;       float3 padding;                               ; Offset:   84
-;   
-;   } $Element;                                       ; Offset:    0 Size:    96
-;
-; }
-;
-; Resource bind info for boneBuffer
-; {
-;
-;   struct dx.alignment.legacy.struct.Bone
-;   {
-;
-;       column_major float4x4 worldMatrix;            ; Offset:    0
-;       column_major float4x4 invWorldMatrix;         ; Offset:   64
-;   
-;   } $Element;                                       ; Offset:    0 Size:   128
-;
-; }
-;
-; Resource bind info for skinnedCommandBuffer
-; {
-;
-;   struct struct.SkinnedCommand
-;   {
-;
-;       uint objectID;                                ; Offset:    0
-;       struct struct.anon
-;       {
-;
-;           uint indexCountPerInstance;               ; Offset:    4
-;           uint instanceCount;                       ; Offset:    8
-;           uint startIndexLocation;                  ; Offset:   12
-;           int baseVertexLocation;                   ; Offset:   16
-;           uint startInstanceLocation;               ; Offset:   20
-;       
-;       } drawIndexed;                                ; Offset:    4
-;
-;   
-;   } $Element;                                       ; Offset:    0 Size:    24
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; depthHierarchySize                cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; depthHierarchySampler             sampler      NA          NA      S0             s0     1
-; skinnedObjectBuffer               texture  struct         r/o      T0             t0     1
-; boneBuffer                        texture  struct         r/o      T1             t1     1
-; depthHierarchy                    texture     f32          2d      T2             t2     1
-; skinnedCommandBuffer                  UAV  struct     r/w+cnt      U0             u0     1
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%"class.StructuredBuffer<SkinnedObject>" = type { %struct.SkinnedObject }
-%struct.SkinnedObject = type { %struct.BoundingSphere, [3 x %struct.LOD], %struct.Material, i32, i32, <3 x float> }
-%struct.BoundingSphere = type { <3 x float>, float }
-%struct.LOD = type { i32, i32, i32 }
-%struct.Material = type { i32, i32, i32, i32, i32, i32 }
-%"dx.alignment.legacy.class.StructuredBuffer<Bone>" = type { %dx.alignment.legacy.struct.Bone }
-%dx.alignment.legacy.struct.Bone = type { [4 x <4 x float>], [4 x <4 x float>] }
-%"class.Texture2D<float>" = type { float, %"class.Texture2D<float>::mips_type" }
-%"class.Texture2D<float>::mips_type" = type { i32 }
-%"class.AppendStructuredBuffer<SkinnedCommand>" = type { %struct.SkinnedCommand }
-%struct.SkinnedCommand = type { i32, %struct.anon }
-%struct.anon = type { i32, i32, i32, i32, i32 }
-%depthHierarchySize = type { %struct.Size }
-%struct.Size = type { <2 x i32> }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-%struct.SamplerState = type { i32 }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 1, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 2, i32 2, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %5 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %6 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %7 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %8 = call i32 @dx.op.threadId.i32(i32 93, i32 0)  ; ThreadId(component)
-  %9 = alloca [3 x i32], align 4
-  %10 = alloca [3 x i32], align 4
-  %11 = alloca [3 x i32], align 4
-  %12 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %4, i32 %8, i32 0)  ; BufferLoad(srv,index,wot)
-  %13 = extractvalue %dx.types.ResRet.f32 %12, 0
-  %14 = extractvalue %dx.types.ResRet.f32 %12, 1
-  %15 = extractvalue %dx.types.ResRet.f32 %12, 2
-  %16 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %4, i32 %8, i32 12)  ; BufferLoad(srv,index,wot)
-  %17 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 0
-  %18 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 0
-  %19 = getelementptr [3 x i32], [3 x i32]* %11, i32 0, i32 0
-  %20 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 16)  ; BufferLoad(srv,index,wot)
-  %21 = extractvalue %dx.types.ResRet.i32 %20, 0
-  store i32 %21, i32* %17, align 4
-  %22 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 20)  ; BufferLoad(srv,index,wot)
-  %23 = extractvalue %dx.types.ResRet.i32 %22, 0
-  store i32 %23, i32* %18, align 4
-  %24 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 24)  ; BufferLoad(srv,index,wot)
-  %25 = extractvalue %dx.types.ResRet.i32 %24, 0
-  store i32 %25, i32* %19, align 4
-  %26 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 1
-  %27 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 1
-  %28 = getelementptr [3 x i32], [3 x i32]* %11, i32 0, i32 1
-  %29 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 28)  ; BufferLoad(srv,index,wot)
-  %30 = extractvalue %dx.types.ResRet.i32 %29, 0
-  store i32 %30, i32* %26, align 4
-  %31 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 32)  ; BufferLoad(srv,index,wot)
-  %32 = extractvalue %dx.types.ResRet.i32 %31, 0
-  store i32 %32, i32* %27, align 4
-  %33 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 36)  ; BufferLoad(srv,index,wot)
-  %34 = extractvalue %dx.types.ResRet.i32 %33, 0
-  store i32 %34, i32* %28, align 4
-  %35 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 2
-  %36 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 2
-  %37 = getelementptr [3 x i32], [3 x i32]* %11, i32 0, i32 2
-  %38 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 40)  ; BufferLoad(srv,index,wot)
-  %39 = extractvalue %dx.types.ResRet.i32 %38, 0
-  store i32 %39, i32* %35, align 4
-  %40 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 44)  ; BufferLoad(srv,index,wot)
-  %41 = extractvalue %dx.types.ResRet.i32 %40, 0
-  store i32 %41, i32* %36, align 4
-  %42 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 48)  ; BufferLoad(srv,index,wot)
-  %43 = extractvalue %dx.types.ResRet.i32 %42, 0
-  store i32 %43, i32* %37, align 4
-  %44 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 76)  ; BufferLoad(srv,index,wot)
-  %45 = extractvalue %dx.types.ResRet.i32 %44, 0
-  %46 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %8, i32 80)  ; BufferLoad(srv,index,wot)
-  %47 = extractvalue %dx.types.ResRet.i32 %46, 0
-  %48 = and i32 %47, 1
-  %49 = icmp eq i32 %48, 0
-  br i1 %49, label %255, label %50
-
-; <label>:50                                      ; preds = %0
-  %51 = extractvalue %dx.types.ResRet.f32 %16, 0
-  %52 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %45, i32 0)  ; BufferLoad(srv,index,wot)
-  %53 = extractvalue %dx.types.ResRet.f32 %52, 0
-  %54 = extractvalue %dx.types.ResRet.f32 %52, 1
-  %55 = extractvalue %dx.types.ResRet.f32 %52, 2
-  %56 = extractvalue %dx.types.ResRet.f32 %52, 3
-  %57 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %45, i32 16)  ; BufferLoad(srv,index,wot)
-  %58 = extractvalue %dx.types.ResRet.f32 %57, 0
-  %59 = extractvalue %dx.types.ResRet.f32 %57, 1
-  %60 = extractvalue %dx.types.ResRet.f32 %57, 2
-  %61 = extractvalue %dx.types.ResRet.f32 %57, 3
-  %62 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %45, i32 32)  ; BufferLoad(srv,index,wot)
-  %63 = extractvalue %dx.types.ResRet.f32 %62, 0
-  %64 = extractvalue %dx.types.ResRet.f32 %62, 1
-  %65 = extractvalue %dx.types.ResRet.f32 %62, 2
-  %66 = extractvalue %dx.types.ResRet.f32 %62, 3
-  %67 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %45, i32 48)  ; BufferLoad(srv,index,wot)
-  %68 = extractvalue %dx.types.ResRet.f32 %67, 0
-  %69 = extractvalue %dx.types.ResRet.f32 %67, 1
-  %70 = extractvalue %dx.types.ResRet.f32 %67, 2
-  %71 = extractvalue %dx.types.ResRet.f32 %67, 3
-  %72 = call float @dx.op.dot3.f32(i32 55, float %53, float %58, float %63, float %53, float %58, float %63)  ; Dot3(ax,ay,az,bx,by,bz)
-  %73 = call float @dx.op.dot3.f32(i32 55, float %54, float %59, float %64, float %54, float %59, float %64)  ; Dot3(ax,ay,az,bx,by,bz)
-  %74 = call float @dx.op.dot3.f32(i32 55, float %55, float %60, float %65, float %55, float %60, float %65)  ; Dot3(ax,ay,az,bx,by,bz)
-  %75 = call float @dx.op.binary.f32(i32 35, float %73, float %74)  ; FMax(a,b)
-  %76 = call float @dx.op.binary.f32(i32 35, float %72, float %75)  ; FMax(a,b)
-  %77 = call float @dx.op.unary.f32(i32 24, float %76)  ; Sqrt(value)
-  %78 = fmul fast float %77, %51
-  %79 = fmul fast float %53, %13
-  %80 = call float @dx.op.tertiary.f32(i32 46, float %58, float %14, float %79)  ; FMad(a,b,c)
-  %81 = call float @dx.op.tertiary.f32(i32 46, float %63, float %15, float %80)  ; FMad(a,b,c)
-  %82 = fadd fast float %81, %68
-  %83 = fmul fast float %54, %13
-  %84 = call float @dx.op.tertiary.f32(i32 46, float %59, float %14, float %83)  ; FMad(a,b,c)
-  %85 = call float @dx.op.tertiary.f32(i32 46, float %64, float %15, float %84)  ; FMad(a,b,c)
-  %86 = fadd fast float %85, %69
-  %87 = fmul fast float %55, %13
-  %88 = call float @dx.op.tertiary.f32(i32 46, float %60, float %14, float %87)  ; FMad(a,b,c)
-  %89 = call float @dx.op.tertiary.f32(i32 46, float %65, float %15, float %88)  ; FMad(a,b,c)
-  %90 = fadd fast float %89, %70
-  %91 = fmul fast float %56, %13
-  %92 = call float @dx.op.tertiary.f32(i32 46, float %61, float %14, float %91)  ; FMad(a,b,c)
-  %93 = call float @dx.op.tertiary.f32(i32 46, float %66, float %15, float %92)  ; FMad(a,b,c)
-  %94 = fadd fast float %93, %71
-  %95 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %96 = extractvalue %dx.types.CBufRet.f32 %95, 0
-  %97 = extractvalue %dx.types.CBufRet.f32 %95, 1
-  %98 = extractvalue %dx.types.CBufRet.f32 %95, 2
-  %99 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 1)  ; CBufferLoadLegacy(handle,regIndex)
-  %100 = extractvalue %dx.types.CBufRet.f32 %99, 0
-  %101 = extractvalue %dx.types.CBufRet.f32 %99, 1
-  %102 = extractvalue %dx.types.CBufRet.f32 %99, 2
-  %103 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 2)  ; CBufferLoadLegacy(handle,regIndex)
-  %104 = extractvalue %dx.types.CBufRet.f32 %103, 0
-  %105 = extractvalue %dx.types.CBufRet.f32 %103, 1
-  %106 = extractvalue %dx.types.CBufRet.f32 %103, 2
-  %107 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 3)  ; CBufferLoadLegacy(handle,regIndex)
-  %108 = extractvalue %dx.types.CBufRet.f32 %107, 0
-  %109 = extractvalue %dx.types.CBufRet.f32 %107, 1
-  %110 = extractvalue %dx.types.CBufRet.f32 %107, 2
-  %111 = fmul fast float %96, %82
-  %112 = call float @dx.op.tertiary.f32(i32 46, float %100, float %86, float %111)  ; FMad(a,b,c)
-  %113 = call float @dx.op.tertiary.f32(i32 46, float %104, float %90, float %112)  ; FMad(a,b,c)
-  %114 = call float @dx.op.tertiary.f32(i32 46, float %108, float %94, float %113)  ; FMad(a,b,c)
-  %115 = fmul fast float %97, %82
-  %116 = call float @dx.op.tertiary.f32(i32 46, float %101, float %86, float %115)  ; FMad(a,b,c)
-  %117 = call float @dx.op.tertiary.f32(i32 46, float %105, float %90, float %116)  ; FMad(a,b,c)
-  %118 = call float @dx.op.tertiary.f32(i32 46, float %109, float %94, float %117)  ; FMad(a,b,c)
-  %119 = fmul fast float %98, %82
-  %120 = call float @dx.op.tertiary.f32(i32 46, float %102, float %86, float %119)  ; FMad(a,b,c)
-  %121 = call float @dx.op.tertiary.f32(i32 46, float %106, float %90, float %120)  ; FMad(a,b,c)
-  %122 = call float @dx.op.tertiary.f32(i32 46, float %110, float %94, float %121)  ; FMad(a,b,c)
-  %123 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %124 = extractvalue %dx.types.CBufRet.f32 %123, 1
-  %125 = extractvalue %dx.types.CBufRet.f32 %123, 0
-  %126 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 17)  ; CBufferLoadLegacy(handle,regIndex)
-  %127 = extractvalue %dx.types.CBufRet.f32 %126, 3
-  %128 = extractvalue %dx.types.CBufRet.f32 %126, 2
-  %129 = extractvalue %dx.types.CBufRet.f32 %126, 1
-  %130 = extractvalue %dx.types.CBufRet.f32 %126, 0
-  %131 = call float @dx.op.unary.f32(i32 6, float %114)  ; FAbs(value)
-  %132 = call float @dx.op.unary.f32(i32 6, float %118)  ; FAbs(value)
-  %133 = call float @dx.op.dot3.f32(i32 55, float %130, float 0.000000e+00, float %129, float %131, float %132, float %122)  ; Dot3(ax,ay,az,bx,by,bz)
-  %134 = fsub fast float -0.000000e+00, %78
-  %135 = fcmp fast oge float %133, %134
-  %136 = call float @dx.op.dot3.f32(i32 55, float 0.000000e+00, float %128, float %127, float %131, float %132, float %122)  ; Dot3(ax,ay,az,bx,by,bz)
-  %137 = fcmp fast oge float %136, %134
-  %138 = and i1 %135, %137
-  %139 = fsub fast float %122, %78
-  %140 = fcmp fast ole float %139, %125
-  %141 = and i1 %140, %138
-  %142 = fadd fast float %122, %78
-  %143 = fcmp fast oge float %142, %124
-  %144 = and i1 %143, %141
-  %145 = zext i1 %144 to i32
-  br i1 %144, label %146, label %255
-
-; <label>:146                                     ; preds = %50
-  %147 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 4)  ; CBufferLoadLegacy(handle,regIndex)
-  %148 = extractvalue %dx.types.CBufRet.f32 %147, 0
-  %149 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 5)  ; CBufferLoadLegacy(handle,regIndex)
-  %150 = extractvalue %dx.types.CBufRet.f32 %149, 1
-  %151 = fcmp fast ult float %142, %125
-  br i1 %151, label %152, label %186
-
-; <label>:152                                     ; preds = %146
-  %153 = call float @dx.op.dot2.f32(i32 54, float %114, float %122, float %114, float %122)  ; Dot2(ax,ay,bx,by)
-  %154 = fmul fast float %78, %78
-  %155 = fsub fast float %153, %154
-  %156 = call float @dx.op.unary.f32(i32 24, float %155)  ; Sqrt(value)
-  %157 = fmul fast float %156, %114
-  %158 = call float @dx.op.tertiary.f32(i32 46, float %78, float %122, float %157)  ; FMad(a,b,c)
-  %159 = fmul fast float %78, %114
-  %160 = fsub fast float -0.000000e+00, %159
-  %161 = call float @dx.op.tertiary.f32(i32 46, float %156, float %122, float %160)  ; FMad(a,b,c)
-  %162 = call float @dx.op.tertiary.f32(i32 46, float %134, float %122, float %157)  ; FMad(a,b,c)
-  %163 = call float @dx.op.tertiary.f32(i32 46, float %156, float %122, float %159)  ; FMad(a,b,c)
-  %164 = call float @dx.op.dot2.f32(i32 54, float %118, float %122, float %118, float %122)  ; Dot2(ax,ay,bx,by)
-  %165 = fsub fast float %164, %154
-  %166 = call float @dx.op.unary.f32(i32 24, float %165)  ; Sqrt(value)
-  %167 = fmul fast float %166, %118
-  %168 = call float @dx.op.tertiary.f32(i32 46, float %78, float %122, float %167)  ; FMad(a,b,c)
-  %169 = fmul fast float %78, %118
-  %170 = fsub fast float -0.000000e+00, %169
-  %171 = call float @dx.op.tertiary.f32(i32 46, float %166, float %122, float %170)  ; FMad(a,b,c)
-  %172 = call float @dx.op.tertiary.f32(i32 46, float %134, float %122, float %167)  ; FMad(a,b,c)
-  %173 = call float @dx.op.tertiary.f32(i32 46, float %166, float %122, float %169)  ; FMad(a,b,c)
-  %174 = fmul fast float %158, %148
-  %175 = fsub fast float -0.000000e+00, %161
-  %176 = fdiv fast float %174, %175
-  %177 = fmul fast float %162, %148
-  %178 = fsub fast float -0.000000e+00, %163
-  %179 = fdiv fast float %177, %178
-  %180 = fmul fast float %168, %150
-  %181 = fsub fast float -0.000000e+00, %171
-  %182 = fdiv fast float %180, %181
-  %183 = fmul fast float %172, %150
-  %184 = fsub fast float -0.000000e+00, %173
-  %185 = fdiv fast float %183, %184
-  br label %186
-
-; <label>:186                                     ; preds = %152, %146
-  %187 = phi i1 [ true, %152 ], [ false, %146 ]
-  %188 = phi float [ %176, %152 ], [ undef, %146 ]
-  %189 = phi float [ %182, %152 ], [ undef, %146 ]
-  %190 = phi float [ %179, %152 ], [ undef, %146 ]
-  %191 = phi float [ %185, %152 ], [ undef, %146 ]
-  br i1 %187, label %192, label %233
-
-; <label>:192                                     ; preds = %186
-  %193 = fmul fast float %188, 5.000000e-01
-  %194 = fmul fast float %189, 5.000000e-01
-  %195 = fmul fast float %190, 5.000000e-01
-  %196 = fmul fast float %191, 5.000000e-01
-  %197 = fadd fast float %193, 5.000000e-01
-  %198 = fsub fast float 5.000000e-01, %194
-  %199 = fadd fast float %195, 5.000000e-01
-  %200 = fsub fast float 5.000000e-01, %196
-  %201 = call float @dx.op.unary.f32(i32 7, float %197)  ; Saturate(value)
-  %202 = call float @dx.op.unary.f32(i32 7, float %198)  ; Saturate(value)
-  %203 = call float @dx.op.unary.f32(i32 7, float %199)  ; Saturate(value)
-  %204 = call float @dx.op.unary.f32(i32 7, float %200)  ; Saturate(value)
-  %205 = fsub fast float %203, %201
-  %206 = fsub fast float %204, %202
-  %207 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %7, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %208 = extractvalue %dx.types.CBufRet.i32 %207, 0
-  %209 = extractvalue %dx.types.CBufRet.i32 %207, 1
-  %210 = uitofp i32 %208 to float
-  %211 = uitofp i32 %209 to float
-  %212 = fmul fast float %210, %205
-  %213 = fmul fast float %211, %206
-  %214 = call float @dx.op.binary.f32(i32 35, float %212, float %213)  ; FMax(a,b)
-  %215 = call float @dx.op.unary.f32(i32 23, float %214)  ; Log(value)
-  %216 = call float @dx.op.unary.f32(i32 28, float %215)  ; Round_pi(value)
-  %217 = fadd fast float %203, %201
-  %218 = fadd fast float %204, %202
-  %219 = fmul fast float %217, 5.000000e-01
-  %220 = fmul fast float %218, 5.000000e-01
-  %221 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %2, %dx.types.Handle %5, float %219, float %220, float undef, float undef, i32 0, i32 0, i32 undef, float %216)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %222 = extractvalue %dx.types.ResRet.f32 %221, 0
-  %223 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %224 = extractvalue %dx.types.CBufRet.f32 %223, 2
-  %225 = fsub fast float -0.000000e+00, %224
-  %226 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %6, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %227 = extractvalue %dx.types.CBufRet.f32 %226, 2
-  %228 = fdiv fast float %227, %142
-  %229 = fsub fast float %225, %228
-  %230 = fadd fast float %222, 0x3EE4F8B580000000
-  %231 = fcmp fast ole float %229, %230
-  %232 = zext i1 %231 to i32
-  br label %233
-
-; <label>:233                                     ; preds = %192, %186
-  %234 = phi i32 [ %232, %192 ], [ %145, %186 ]
-  %235 = icmp eq i32 %234, 0
-  br i1 %235, label %255, label %236
-
-; <label>:236                                     ; preds = %233
-  %237 = fmul fast float %114, %114
-  %238 = fmul fast float %118, %118
-  %239 = fadd fast float %238, %237
-  %240 = fmul fast float %122, %122
-  %241 = fadd fast float %239, %240
-  %242 = call float @dx.op.unary.f32(i32 24, float %241)  ; Sqrt(value)
-  %243 = fsub fast float %242, %78
-  %244 = fcmp fast olt float %243, 5.000000e+00
-  %245 = fcmp fast olt float %243, 1.000000e+01
-  %246 = select i1 %245, i32 1, i32 2
-  %247 = select i1 %244, i32 0, i32 %246
-  %248 = getelementptr inbounds [3 x i32], [3 x i32]* %10, i32 0, i32 %247
-  %249 = load i32, i32* %248, align 4, !tbaa !23
-  %250 = getelementptr inbounds [3 x i32], [3 x i32]* %9, i32 0, i32 %247
-  %251 = load i32, i32* %250, align 4, !tbaa !23
-  %252 = getelementptr inbounds [3 x i32], [3 x i32]* %11, i32 0, i32 %247
-  %253 = load i32, i32* %252, align 4, !tbaa !23
-  %254 = call i32 @dx.op.bufferUpdateCounter(i32 70, %dx.types.Handle %1, i8 1)  ; BufferUpdateCounter(uav,inc)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %254, i32 0, i32 %8, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %254, i32 4, i32 %249, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %254, i32 8, i32 1, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %254, i32 12, i32 %251, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %254, i32 16, i32 %253, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %254, i32 20, i32 0, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  br label %255
-
-; <label>:255                                     ; preds = %236, %233, %50, %0
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.threadId.i32(i32, i32) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot3.f32(i32, float, float, float, float, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.binary.f32(i32, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32, float) #1
-
-; Function Attrs: nounwind
-declare i32 @dx.op.bufferUpdateCounter(i32, %dx.types.Handle, i8) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot2.f32(i32, float, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind
-declare void @dx.op.bufferStore.i32(i32, %dx.types.Handle, i32, i32, i32, i32, i32, i32, i8) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind readonly }
-attributes #2 = { nounwind }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.entryPoints = !{!20}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"cs", i32 6, i32 0}
-!4 = !{!5, !12, !15, !18}
-!5 = !{!6, !8, !10}
-!6 = !{i32 0, %"class.StructuredBuffer<SkinnedObject>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 96}
-!8 = !{i32 1, %"dx.alignment.legacy.class.StructuredBuffer<Bone>"* undef, !"", i32 0, i32 1, i32 1, i32 12, i32 0, !9}
-!9 = !{i32 1, i32 128}
-!10 = !{i32 2, %"class.Texture2D<float>"* undef, !"", i32 0, i32 2, i32 1, i32 2, i32 0, !11}
-!11 = !{i32 0, i32 9}
-!12 = !{!13}
-!13 = !{i32 0, %"class.AppendStructuredBuffer<SkinnedCommand>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i1 false, i1 true, i1 false, !14}
-!14 = !{i32 1, i32 24}
-!15 = !{!16, !17}
-!16 = !{i32 0, %depthHierarchySize* undef, !"", i32 0, i32 0, i32 1, i32 8, null}
-!17 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!18 = !{!19}
-!19 = !{i32 0, %struct.SamplerState* undef, !"", i32 0, i32 0, i32 1, i32 0, null}
-!20 = !{void ()* @main, !"main", null, !4, !21}
-!21 = !{i32 0, i64 16, i32 4, !22}
-!22 = !{i32 128, i32 1, i32 1}
-!23 = !{!24, !24, i64 0}
-!24 = !{!"int", !25, i64 0}
-!25 = !{!"omnipotent char", !26, i64 0}
-!26 = !{!"Simple C/C++ TBAA"}
-
-#endif
-
-const unsigned char RINShaderBytesCullSkinnedCS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x77, 0x9f, 0xb7, 0x02, 0x25, 0xbd, 0xcd, 0x7a,
-  0x27, 0xf8, 0x95, 0x3b, 0xb3, 0xd0, 0xef, 0x96, 0x01, 0x00, 0x00, 0x00,
-  0xb8, 0x26, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0x24, 0x01, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x60, 0x14, 0x00, 0x00,
-  0x7c, 0x14, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x4f, 0x53, 0x47, 0x31, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x50, 0x53, 0x56, 0x30, 0xac, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x52, 0x54, 0x53, 0x30, 0x04, 0x01, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x94, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x54, 0x41, 0x54,
-  0x28, 0x12, 0x00, 0x00, 0x60, 0x00, 0x05, 0x00, 0x8a, 0x04, 0x00, 0x00,
-  0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x10, 0x12, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00,
-  0x81, 0x04, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49,
-  0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19,
-  0x1e, 0x04, 0x8b, 0x62, 0x80, 0x1c, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42,
-  0xe4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x72, 0x88,
-  0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42,
-  0xe4, 0x48, 0x0e, 0x90, 0x91, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c,
-  0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x39, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07,
-  0x40, 0x02, 0xa8, 0x0d, 0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20,
-  0x01, 0xd5, 0x06, 0x62, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x00,
-  0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42,
-  0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00,
-  0xf0, 0x00, 0x00, 0x00, 0x32, 0x22, 0xc8, 0x09, 0x20, 0x64, 0x85, 0x04,
-  0x93, 0x23, 0xa4, 0x84, 0x04, 0x93, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14,
-  0x12, 0x4c, 0x8e, 0x8c, 0x0b, 0x84, 0xe4, 0x4c, 0x10, 0xb4, 0xc2, 0x0c,
-  0xc0, 0x30, 0xc2, 0x00, 0x5c, 0x25, 0x4d, 0x11, 0x25, 0x4c, 0xfe, 0xe6,
-  0x50, 0xcd, 0x80, 0x34, 0x06, 0xfb, 0x1c, 0x44, 0x44, 0x20, 0x21, 0x00,
-  0x98, 0x23, 0x00, 0x83, 0x53, 0xa4, 0x29, 0xa2, 0x84, 0xc9, 0x2f, 0xd1,
-  0x0e, 0x0d, 0x83, 0xc1, 0x20, 0x07, 0x08, 0xf7, 0x48, 0x53, 0x44, 0x09,
-  0x93, 0x6f, 0x02, 0x13, 0x11, 0x21, 0xc0, 0x82, 0x8c, 0xc1, 0x60, 0x30,
-  0x18, 0x0c, 0x8e, 0x92, 0xa6, 0x88, 0x12, 0x26, 0x9f, 0x55, 0x90, 0xa6,
-  0x21, 0x06, 0x34, 0x48, 0x08, 0x61, 0x42, 0x86, 0xa0, 0x60, 0x18, 0x0c,
-  0x02, 0x33, 0x95, 0xc1, 0x38, 0xb0, 0x43, 0x38, 0xcc, 0xc3, 0x3c, 0xb8,
-  0xc1, 0x2c, 0xd0, 0x83, 0x3c, 0xd4, 0xc3, 0x38, 0xd0, 0x43, 0x3d, 0xc8,
-  0x43, 0x39, 0x90, 0x83, 0x28, 0xd4, 0x83, 0x39, 0x98, 0x43, 0x39, 0xc8,
-  0x03, 0x1f, 0xcc, 0xc2, 0x3a, 0xa4, 0x83, 0x3b, 0xb8, 0x43, 0x39, 0x90,
-  0xc3, 0x2b, 0x88, 0x83, 0x3a, 0x94, 0xc3, 0x38, 0xd0, 0x83, 0x1f, 0xa0,
-  0xe0, 0x40, 0x88, 0x5b, 0xa4, 0x29, 0xa2, 0x84, 0xc9, 0x07, 0x1a, 0xa7,
-  0x41, 0xc5, 0x60, 0x30, 0x18, 0x0c, 0xae, 0x92, 0xa6, 0x88, 0x12, 0x26,
-  0x9f, 0x55, 0x90, 0xa6, 0x21, 0x06, 0xce, 0x61, 0x18, 0xa0, 0x19, 0x90,
-  0x30, 0x50, 0xcc, 0xc4, 0x06, 0xe3, 0xc0, 0x0e, 0xe1, 0x30, 0x0f, 0xf3,
-  0xe0, 0x06, 0xa1, 0x00, 0x0f, 0xf0, 0x50, 0x0e, 0xee, 0x40, 0x0e, 0xb3,
-  0x40, 0x0f, 0xf2, 0x50, 0x0f, 0xe3, 0x40, 0x0f, 0xf5, 0x20, 0x0f, 0xe5,
-  0x40, 0x0e, 0xa2, 0x50, 0x0f, 0xe6, 0x60, 0x0e, 0xe5, 0x20, 0x0f, 0x7c,
-  0x30, 0x0b, 0xeb, 0x90, 0x0e, 0xee, 0xe0, 0x0e, 0xe5, 0x40, 0x0e, 0xa3,
-  0xf0, 0x0e, 0xed, 0xd0, 0x0e, 0xe1, 0xe0, 0x0e, 0xe4, 0xe0, 0x07, 0x28,
-  0x58, 0x10, 0x63, 0xa6, 0x30, 0x18, 0x07, 0x76, 0x08, 0x87, 0x79, 0x98,
-  0x07, 0x37, 0xa0, 0x85, 0x72, 0xc0, 0x07, 0x7a, 0xa8, 0x07, 0x79, 0x28,
-  0x07, 0x39, 0x20, 0x05, 0x3e, 0x30, 0x07, 0x76, 0x78, 0x87, 0x70, 0xa0,
-  0x07, 0x3f, 0xd0, 0x03, 0x3d, 0x68, 0x87, 0x74, 0x80, 0x87, 0x79, 0xf8,
-  0x05, 0x7a, 0xc8, 0x07, 0x78, 0x28, 0x07, 0x14, 0x0c, 0x66, 0xb2, 0xc6,
-  0x81, 0x1d, 0xc2, 0x61, 0x1e, 0xe6, 0xc1, 0x0d, 0x68, 0xa1, 0x1c, 0xf0,
-  0x81, 0x1e, 0xea, 0x41, 0x1e, 0xca, 0x41, 0x0e, 0x48, 0x81, 0x0f, 0xcc,
-  0x81, 0x1d, 0xde, 0x21, 0x1c, 0xe8, 0xc1, 0x0f, 0x90, 0x00, 0x70, 0xd0,
-  0xe3, 0x26, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x59, 0x80, 0x79, 0x16, 0x22,
-  0x62, 0x27, 0x60, 0x22, 0x50, 0x30, 0xa0, 0xc8, 0x30, 0x82, 0x30, 0xdc,
-  0x22, 0x4d, 0x11, 0x25, 0x4c, 0x3e, 0x8b, 0x64, 0x04, 0x0a, 0x26, 0x27,
-  0x0d, 0xc4, 0x33, 0x1d, 0x21, 0x42, 0x44, 0x40, 0x24, 0x1c, 0x18, 0x8b,
-  0x64, 0x04, 0x0a, 0x28, 0x54, 0x19, 0x46, 0x20, 0x80, 0x24, 0xb8, 0x5c,
-  0x18, 0x0c, 0x97, 0x0f, 0x2c, 0x88, 0xd1, 0x30, 0x44, 0x33, 0xf9, 0x0b,
-  0x61, 0x00, 0x02, 0xe6, 0x4b, 0x53, 0x44, 0x09, 0x93, 0xcf, 0x01, 0x0c,
-  0x11, 0x01, 0xc8, 0xc1, 0x60, 0x30, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xe0, 0xc0, 0x60, 0xb8, 0x7c, 0x60, 0x41, 0x8c, 0x86,
-  0x21, 0x9a, 0xc9, 0x5f, 0x08, 0x03, 0x10, 0x30, 0x5f, 0x00, 0x18, 0x22,
-  0x02, 0x36, 0xaa, 0x28, 0x88, 0x08, 0x05, 0x19, 0xd2, 0xdc, 0x37, 0x5c,
-  0x3e, 0xb0, 0x20, 0x46, 0xc3, 0x10, 0xcd, 0xe4, 0x2f, 0x84, 0x01, 0x08,
-  0x98, 0x2f, 0x4d, 0x11, 0x25, 0x4c, 0xfe, 0xe6, 0x34, 0x04, 0x12, 0x30,
-  0x98, 0x99, 0xe0, 0x80, 0x1c, 0xf0, 0xc1, 0x0d, 0xc2, 0x81, 0x1d, 0xd2,
-  0xe1, 0x1c, 0xdc, 0xa1, 0x1d, 0xca, 0xc1, 0x1d, 0xe8, 0xc1, 0x0d, 0xd8,
-  0xa1, 0x1c, 0xce, 0x21, 0x1c, 0xc6, 0x21, 0x1f, 0xdc, 0x60, 0x1c, 0xd8,
-  0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x60, 0x16, 0xe8, 0x41, 0x1e, 0xea,
-  0x61, 0x1c, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xc8, 0x41, 0x14, 0xea,
-  0xc1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0x81, 0x0f, 0x44, 0xe1, 0x1d, 0xdc,
-  0xa1, 0x1c, 0xfc, 0x00, 0x05, 0x1c, 0xea, 0x8c, 0x00, 0x94, 0xe0, 0x43,
-  0xa0, 0x32, 0x0c, 0x06, 0x03, 0x12, 0x15, 0x04, 0x30, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x48, 0x65, 0x00, 0x0c, 0x00, 0x64, 0x2a, 0x04, 0x60,
-  0x00, 0x00, 0x10, 0xea, 0xa6, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x7f,
-  0x25, 0xa4, 0x95, 0x98, 0xfc, 0xe2, 0xb6, 0x51, 0x01, 0x00, 0x00, 0x00,
-  0x83, 0x39, 0x02, 0x84, 0x56, 0xf7, 0x0c, 0x97, 0x3f, 0x61, 0x0f, 0x21,
-  0xf9, 0x21, 0xd0, 0x0c, 0x0b, 0x81, 0x02, 0x56, 0x61, 0x54, 0x83, 0x56,
-  0x0b, 0x00, 0x00, 0x00, 0x06, 0x83, 0x01, 0x80, 0x5c, 0x85, 0x18, 0x0c,
-  0x5a, 0x2b, 0x82, 0x15, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1d,
-  0x35, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4, 0x73, 0x1b, 0x55, 0xac, 0xc4,
-  0xe4, 0x23, 0xb7, 0x8d, 0x88, 0xc1, 0x60, 0x30, 0x28, 0x04, 0x6d, 0xd0,
-  0x1a, 0x50, 0xed, 0xa8, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x9f, 0xdb,
-  0xa8, 0x62, 0x25, 0x26, 0xbf, 0xb8, 0x6d, 0x44, 0x00, 0x00, 0x00, 0x40,
-  0x21, 0x6e, 0x83, 0xd6, 0x80, 0x70, 0xa5, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0xe9, 0xe6, 0x08, 0x82, 0x62, 0xb4, 0x06, 0xab, 0xc1, 0x80, 0x47, 0xbd,
-  0x9b, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc, 0x95, 0x90, 0x56, 0x62,
-  0xf2, 0x91, 0xdb, 0x46, 0xc5, 0x60, 0x30, 0x18, 0x0c, 0x4a, 0xf1, 0x1b,
-  0xb4, 0x06, 0x03, 0x02, 0x96, 0x42, 0x35, 0x68, 0x0d, 0x06, 0x24, 0x2c,
-  0xca, 0x67, 0xd0, 0x1a, 0x0c, 0x06, 0x83, 0xc1, 0x60, 0x45, 0xc4, 0x81,
-  0x80, 0xb3, 0x84, 0x05, 0x90, 0x24, 0x9f, 0x01, 0xa6, 0x08, 0xb9, 0xfc,
-  0x62, 0x71, 0x80, 0xc9, 0xc7, 0x7d, 0x1c, 0x05, 0x98, 0x5b, 0xa4, 0x29,
-  0xa2, 0x84, 0xc9, 0xdf, 0x9c, 0x86, 0x40, 0xc2, 0xf1, 0x38, 0x13, 0x37,
-  0x0e, 0xec, 0x10, 0x0e, 0xf3, 0x30, 0x0f, 0x6e, 0x30, 0x0b, 0xf4, 0x20,
-  0x0f, 0xf5, 0x30, 0x0e, 0xf4, 0x50, 0x0f, 0xf2, 0x50, 0x0e, 0xe4, 0x20,
-  0x0a, 0xf5, 0x60, 0x0e, 0xe6, 0x50, 0x0e, 0xf2, 0xc0, 0x07, 0xa2, 0xf0,
-  0x0e, 0xee, 0x50, 0x0e, 0x7e, 0x80, 0x02, 0xe4, 0x35, 0xd2, 0x14, 0x51,
-  0xc2, 0xe4, 0x73, 0x00, 0x43, 0x44, 0x00, 0x72, 0x8e, 0xc7, 0xe3, 0x31,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x46, 0x00, 0x18,
-  0x22, 0x02, 0x36, 0xaa, 0x28, 0x88, 0x08, 0x05, 0xca, 0x39, 0x02, 0x50,
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87,
-  0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50,
-  0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0,
-  0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10,
-  0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0,
-  0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a, 0x0f,
-  0xa4, 0x90, 0x21, 0x23, 0x45, 0x44, 0x00, 0xa2, 0x01, 0x00, 0x93, 0x0d,
-  0x00, 0x98, 0x6f, 0x00, 0xc0, 0x8c, 0x03, 0x00, 0x66, 0x1d, 0x00, 0x00,
-  0xb5, 0x00, 0x00, 0xd8, 0x05, 0x00, 0x30, 0xe4, 0x01, 0x03, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x88, 0x01,
-  0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79,
-  0xc8, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x86, 0x3c, 0x66, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x43, 0x1e, 0x34, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x21, 0x8f, 0x1b, 0x00, 0x01, 0x20, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x07, 0x0e, 0x80, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x23, 0x07, 0x40,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0xa9,
-  0x03, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0xf2, 0xe0, 0x01, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0c, 0x79, 0xf4, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x86, 0x3c, 0x7d, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x50, 0x00, 0x02, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x8f, 0x28, 0x00, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x87, 0x14,
-  0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0b,
-  0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x1c,
-  0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x62,
-  0x16, 0x08, 0xf1, 0x6a, 0x80, 0x06, 0x25, 0x30, 0x02, 0x50, 0x0c, 0x85,
-  0x51, 0xc0, 0x01, 0x05, 0x28, 0x50, 0x04, 0x25, 0x51, 0x30, 0x05, 0x51,
-  0xe0, 0x04, 0x65, 0x50, 0x0e, 0xa5, 0x50, 0xd8, 0x01, 0x05, 0x52, 0x80,
-  0x01, 0x05, 0x1b, 0x50, 0xb8, 0x01, 0x85, 0x50, 0x28, 0x85, 0x54, 0x80,
-  0x03, 0x05, 0x48, 0x50, 0x98, 0x04, 0x05, 0x4a, 0x50, 0xa8, 0x04, 0x05,
-  0x4b, 0x50, 0xb8, 0x04, 0x05, 0x4c, 0x50, 0xc8, 0x04, 0x05, 0x4d, 0x50,
-  0xd8, 0x04, 0xc5, 0x1b, 0x50, 0x9e, 0x04, 0x25, 0x42, 0xbc, 0x11, 0x00,
-  0x32, 0xcc, 0x00, 0xd0, 0x61, 0x06, 0x80, 0x10, 0x33, 0x00, 0x94, 0x98,
-  0x01, 0x20, 0xc5, 0x0c, 0x00, 0x2d, 0x66, 0x00, 0x88, 0x31, 0x03, 0x40,
-  0x8d, 0x19, 0x00, 0x72, 0xcc, 0x00, 0xd0, 0x63, 0x06, 0x80, 0x20, 0x33,
-  0x00, 0x24, 0x99, 0x01, 0x20, 0xca, 0x0c, 0x00, 0x55, 0x66, 0x00, 0xc8,
-  0x32, 0x03, 0x40, 0x99, 0x19, 0x00, 0xd2, 0xcc, 0x00, 0xd0, 0x66, 0x06,
-  0x80, 0x38, 0x33, 0x00, 0xd4, 0x99, 0x01, 0x20, 0xcf, 0x0c, 0x00, 0x11,
-  0x66, 0x00, 0x48, 0x30, 0x03, 0x40, 0xc8, 0x19, 0x00, 0x4a, 0xce, 0x00,
-  0x90, 0x72, 0x06, 0x80, 0x96, 0x33, 0x00, 0x04, 0x98, 0x01, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90,
-  0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1,
-  0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41,
-  0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a,
-  0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9,
-  0x10, 0x04, 0x13, 0x84, 0x01, 0x9b, 0x20, 0x0c, 0xd9, 0x06, 0x61, 0x20,
-  0x36, 0x08, 0x04, 0x41, 0x61, 0x6c, 0x6e, 0x82, 0x30, 0x68, 0x1b, 0x86,
-  0x03, 0x21, 0x26, 0x08, 0x09, 0x28, 0x70, 0x9a, 0x5b, 0x4b, 0x73, 0x73,
-  0x2b, 0x23, 0x7b, 0x12, 0x53, 0x2b, 0x1b, 0xa3, 0x13, 0xaa, 0x33, 0x33,
-  0x2b, 0x93, 0x9b, 0x20, 0x0c, 0xdb, 0x04, 0x61, 0xe0, 0x36, 0x08, 0x43,
-  0xb3, 0x21, 0x21, 0x94, 0x85, 0x20, 0x06, 0x86, 0x70, 0x26, 0x08, 0x5e,
-  0x2c, 0x50, 0x11, 0x7b, 0x73, 0x2b, 0x13, 0xaa, 0x33, 0x33, 0x2b, 0x93,
-  0x9b, 0x20, 0x0c, 0xdd, 0x06, 0x61, 0x90, 0x36, 0x24, 0x03, 0x14, 0x11,
-  0xc3, 0xc0, 0x10, 0xd3, 0x04, 0x61, 0xf0, 0x26, 0x08, 0xd0, 0x29, 0xd0,
-  0x21, 0x2b, 0x83, 0xa3, 0x43, 0x43, 0x4a, 0x2b, 0x93, 0x0b, 0x93, 0x1b,
-  0x43, 0xcb, 0x9b, 0x20, 0x0c, 0xdf, 0x06, 0x81, 0xc0, 0x36, 0x24, 0x95,
-  0x75, 0x11, 0xd5, 0x50, 0x11, 0xd9, 0x86, 0xe1, 0xa1, 0xb4, 0x09, 0x42,
-  0x43, 0x0a, 0xa4, 0xe6, 0xd6, 0xd2, 0xdc, 0xdc, 0xca, 0xc8, 0x86, 0xde,
-  0xda, 0xda, 0xc2, 0xdc, 0xc8, 0x84, 0xea, 0xcc, 0xcc, 0xca, 0xe4, 0x26,
-  0x08, 0x7c, 0xc0, 0x07, 0x13, 0x04, 0x3e, 0xb8, 0x26, 0x08, 0x03, 0x18,
-  0x6c, 0x10, 0x06, 0x30, 0xd8, 0xb0, 0x10, 0x5c, 0x47, 0x10, 0x03, 0xe3,
-  0x7d, 0x5e, 0x18, 0x6c, 0x08, 0xc4, 0x60, 0x82, 0x60, 0xad, 0x02, 0x25,
-  0xb2, 0x32, 0x38, 0x3a, 0x34, 0xa4, 0xb4, 0x32, 0xb9, 0x30, 0xb9, 0x31,
-  0xb4, 0xbc, 0xa9, 0x34, 0xbd, 0xb2, 0x09, 0xc2, 0x10, 0x06, 0x1b, 0x10,
-  0x82, 0x0c, 0xca, 0x80, 0x20, 0x06, 0x33, 0x00, 0x26, 0x08, 0x9b, 0x2b,
-  0x90, 0x19, 0x0b, 0x6b, 0x2b, 0x93, 0x0b, 0x13, 0xaa, 0x33, 0x33, 0x2b,
-  0x93, 0x9b, 0x20, 0x0c, 0x62, 0xb0, 0x01, 0x19, 0xd0, 0x20, 0x0d, 0x88,
-  0x61, 0x50, 0x03, 0x60, 0x83, 0x70, 0x06, 0x6b, 0x30, 0x41, 0x90, 0x50,
-  0x81, 0x15, 0x59, 0x19, 0x1c, 0x1d, 0x1a, 0x52, 0x5a, 0x99, 0x5c, 0x98,
-  0xdc, 0x18, 0x5a, 0xde, 0x54, 0x58, 0x1b, 0x1c, 0x5b, 0x99, 0xdc, 0x06,
-  0x84, 0x68, 0x03, 0x37, 0x20, 0x88, 0x81, 0x00, 0x36, 0x04, 0x6f, 0xb0,
-  0x81, 0xd8, 0xc6, 0x80, 0x0d, 0xe0, 0x60, 0x82, 0x40, 0xa5, 0x02, 0x89,
-  0xb9, 0x34, 0xbd, 0xb2, 0x09, 0xc2, 0x30, 0x06, 0x13, 0x84, 0x81, 0x0c,
-  0x26, 0x08, 0x43, 0x19, 0x6c, 0x30, 0x90, 0x39, 0xa0, 0x03, 0xa2, 0x0e,
-  0xec, 0x60, 0x83, 0x60, 0x06, 0x77, 0x30, 0x41, 0x40, 0xfe, 0x60, 0x82,
-  0x30, 0x98, 0x01, 0x03, 0xb4, 0x0d, 0x04, 0xb2, 0x07, 0x74, 0x40, 0x4c,
-  0x10, 0x0e, 0x3f, 0xd8, 0x20, 0x10, 0x7d, 0xb0, 0x21, 0xf0, 0x83, 0x0d,
-  0x02, 0xf1, 0x07, 0x1b, 0x06, 0x3d, 0xe0, 0x03, 0x50, 0xa0, 0x23, 0xf6,
-  0x56, 0xe7, 0x46, 0x96, 0xe6, 0x76, 0x36, 0x05, 0x87, 0x56, 0x26, 0x57,
-  0xb6, 0x81, 0x40, 0x44, 0x81, 0x0e, 0x08, 0x12, 0x6c, 0x6f, 0x64, 0x73,
-  0x13, 0x84, 0xe1, 0x0c, 0x36, 0x10, 0x08, 0x29, 0xd0, 0x41, 0x29, 0x10,
-  0x69, 0x0b, 0xa3, 0x2b, 0x93, 0x4b, 0x0b, 0x63, 0x9b, 0x20, 0x0c, 0x68,
-  0xb0, 0x81, 0x40, 0x4e, 0x81, 0x0e, 0x50, 0x81, 0x89, 0xd8, 0x9b, 0x5b,
-  0x59, 0x92, 0x1b, 0x59, 0x19, 0xde, 0x04, 0x61, 0x48, 0x83, 0x0d, 0x06,
-  0xa2, 0x0a, 0x74, 0xb0, 0x0a, 0x75, 0x60, 0x07, 0x2c, 0xcc, 0xd8, 0xc2,
-  0xce, 0xe6, 0x26, 0x08, 0x83, 0x1a, 0x6c, 0x30, 0x90, 0x56, 0xa0, 0x03,
-  0x57, 0xa8, 0x03, 0x3b, 0xe0, 0x01, 0x17, 0x46, 0x46, 0x96, 0xe6, 0x76,
-  0xb6, 0xc1, 0x40, 0x60, 0x81, 0x0e, 0x9a, 0x3a, 0xc0, 0x36, 0x1c, 0x7a,
-  0x30, 0x0a, 0xa6, 0x90, 0x0a, 0xac, 0xf0, 0x0a, 0xb1, 0x30, 0x41, 0x10,
-  0x66, 0x81, 0xc6, 0x58, 0x99, 0x1b, 0x5d, 0x99, 0xdc, 0x06, 0x03, 0xa1,
-  0x05, 0x3a, 0x20, 0xea, 0x00, 0xa3, 0x21, 0x17, 0x46, 0x96, 0x56, 0x37,
-  0xb7, 0xc1, 0x40, 0x6c, 0x81, 0x0e, 0x98, 0x3a, 0xc0, 0x36, 0x0c, 0xa5,
-  0x50, 0x0b, 0xb7, 0x30, 0x41, 0x20, 0x64, 0x81, 0xca, 0x1c, 0x5d, 0x98,
-  0x1c, 0x5d, 0x92, 0x1b, 0x59, 0x19, 0xde, 0x06, 0x03, 0xd1, 0x05, 0x3a,
-  0x20, 0xea, 0xc0, 0x0e, 0xa8, 0xa4, 0xb9, 0x91, 0x95, 0xe1, 0x0d, 0xbd,
-  0xd5, 0xb9, 0xd1, 0x4d, 0x10, 0x86, 0x35, 0xd8, 0x60, 0x20, 0xbc, 0x40,
-  0x07, 0xbd, 0x50, 0x07, 0x76, 0x40, 0xc6, 0xae, 0x4c, 0x8e, 0xae, 0x0c,
-  0xef, 0xc9, 0xcc, 0x6c, 0xae, 0x8c, 0x6e, 0x83, 0x81, 0xfc, 0x02, 0x1d,
-  0x98, 0x41, 0x1d, 0xd8, 0xc1, 0x06, 0x82, 0xd9, 0x05, 0x5f, 0x00, 0x87,
-  0x09, 0x82, 0xd1, 0x07, 0x5c, 0xc4, 0xc2, 0xe6, 0xca, 0x86, 0xde, 0xd8,
-  0xde, 0xe4, 0x92, 0x88, 0x36, 0x18, 0xc8, 0x38, 0xd0, 0x01, 0x51, 0x07,
-  0x76, 0x40, 0xc4, 0xed, 0x4d, 0xae, 0x2d, 0x8c, 0x2d, 0x89, 0x68, 0x83,
-  0x81, 0x94, 0x03, 0x1d, 0xf4, 0x42, 0x1d, 0xd8, 0x01, 0x1b, 0xb9, 0xb7,
-  0xba, 0x33, 0x34, 0xb7, 0xb2, 0xb9, 0xb9, 0xa0, 0xa7, 0x24, 0xa2, 0x0d,
-  0x06, 0x72, 0x0e, 0x74, 0x60, 0x06, 0x75, 0x60, 0x07, 0x54, 0xda, 0xca,
-  0xe8, 0xc2, 0xd8, 0xd8, 0xd2, 0xc6, 0x92, 0x88, 0x36, 0x18, 0x48, 0x3a,
-  0xd0, 0x01, 0x53, 0x07, 0x76, 0x40, 0x04, 0xad, 0x2c, 0xed, 0x0c, 0x8d,
-  0x2e, 0x89, 0x68, 0x83, 0x81, 0xac, 0x03, 0x1d, 0x94, 0x42, 0x1d, 0xd8,
-  0x01, 0x93, 0x39, 0xb8, 0xb2, 0xb1, 0xb4, 0x30, 0xb6, 0x24, 0xa2, 0x09,
-  0xc2, 0xc0, 0x06, 0x1b, 0x0c, 0xa4, 0x1d, 0xe8, 0xc0, 0x1d, 0xea, 0xc0,
-  0x0e, 0x36, 0x1c, 0x60, 0x40, 0x0e, 0xe6, 0x80, 0x0e, 0xea, 0xc0, 0x0e,
-  0xef, 0x30, 0x41, 0x48, 0x85, 0x5a, 0x98, 0x20, 0xa0, 0x02, 0x2d, 0x6c,
-  0x10, 0x08, 0x79, 0xd8, 0x10, 0xcc, 0xc3, 0x06, 0x81, 0xa0, 0x87, 0x0d,
-  0x83, 0xc4, 0x07, 0xf5, 0xc0, 0xe5, 0xee, 0x4d, 0x8e, 0x8d, 0xac, 0x29,
-  0x8c, 0x4e, 0x2e, 0x0d, 0x6f, 0xc3, 0xd0, 0x0b, 0xbd, 0x50, 0x6d, 0x40,
-  0x90, 0x7b, 0xa8, 0xf0, 0x81, 0x0e, 0x88, 0x3a, 0xc0, 0xe8, 0xa4, 0xb9,
-  0xd9, 0x5d, 0xbd, 0xc9, 0xb1, 0x91, 0x35, 0x85, 0xd1, 0xc9, 0xa5, 0xe1,
-  0x6d, 0x40, 0x10, 0x7d, 0xa8, 0xf0, 0x81, 0x0e, 0x50, 0xa1, 0x0e, 0xb0,
-  0x0d, 0x83, 0x94, 0x0f, 0xfb, 0x30, 0x41, 0x60, 0x46, 0x61, 0x82, 0x30,
-  0xb4, 0xc1, 0x04, 0x61, 0x11, 0x85, 0x0d, 0x02, 0xf1, 0x0f, 0x1b, 0x02,
-  0x90, 0xd8, 0x20, 0x10, 0x21, 0xb1, 0x61, 0xf0, 0x07, 0x3e, 0x10, 0x09,
-  0x22, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x49, 0x44, 0x1b, 0x0c, 0x84,
-  0x24, 0xe8, 0x80, 0xa8, 0x03, 0x3b, 0xe0, 0x42, 0x26, 0x17, 0x76, 0x97,
-  0xe4, 0x46, 0x56, 0x86, 0x57, 0x46, 0xb6, 0x81, 0x40, 0x4c, 0x82, 0x0e,
-  0x4a, 0x61, 0xc3, 0xe0, 0x0f, 0x25, 0x71, 0x12, 0x13, 0x04, 0x25, 0x14,
-  0x58, 0xa5, 0xb9, 0x91, 0x95, 0xe1, 0x0d, 0xbd, 0xd5, 0xb9, 0xd1, 0x41,
-  0x95, 0xc9, 0x25, 0xb9, 0xcd, 0xd1, 0x85, 0xb9, 0x8d, 0x95, 0x6d, 0x30,
-  0x10, 0x95, 0xa0, 0x03, 0xa2, 0x0e, 0xec, 0x80, 0x4d, 0x9a, 0xdb, 0x1c,
-  0x5d, 0x98, 0xdb, 0x58, 0xd9, 0xd0, 0x5b, 0x9d, 0x1b, 0xdd, 0x06, 0x03,
-  0x61, 0x09, 0x3a, 0xe8, 0x85, 0x3a, 0xb0, 0x03, 0x4a, 0x73, 0x74, 0x61,
-  0x72, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x4c, 0x6f, 0x63, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x1b, 0x0c, 0xc4, 0x25, 0xe8, 0xc0, 0x0c, 0xea, 0xc0,
-  0x0e, 0x28, 0x89, 0x85, 0xcd, 0x95, 0x59, 0x95, 0xc9, 0xd1, 0x95, 0xe1,
-  0x31, 0xbd, 0x8d, 0x85, 0xd1, 0xa5, 0xbd, 0xb9, 0x6d, 0x30, 0x10, 0x98,
-  0xa0, 0x03, 0xa6, 0x0e, 0x7a, 0x81, 0xd5, 0x1c, 0x5d, 0x98, 0x1c, 0x5d,
-  0x92, 0xdb, 0x1c, 0x5d, 0x98, 0xdb, 0x58, 0x19, 0xd3, 0xdb, 0x58, 0x18,
-  0x5d, 0xda, 0x9b, 0xdb, 0x06, 0x03, 0x91, 0x09, 0x3a, 0x28, 0x85, 0x3a,
-  0xb0, 0x83, 0x0d, 0x86, 0x3b, 0xac, 0x44, 0x4b, 0xbc, 0x44, 0x4c, 0xcc,
-  0xc4, 0x04, 0x41, 0x15, 0x6c, 0x81, 0x8a, 0x5d, 0x5a, 0xd9, 0x5d, 0x53,
-  0x18, 0x9d, 0x5c, 0x1a, 0xde, 0x06, 0x04, 0xb1, 0x89, 0x0a, 0x1f, 0xe8,
-  0x80, 0xa8, 0x03, 0x8c, 0x0a, 0x9c, 0xdc, 0x9b, 0x5a, 0x53, 0x18, 0x9d,
-  0x5c, 0x1a, 0xde, 0x06, 0x04, 0xc1, 0x89, 0x0a, 0x1f, 0xe8, 0x00, 0x15,
-  0xea, 0x00, 0x63, 0x93, 0xe6, 0x66, 0x07, 0x25, 0xf7, 0xa6, 0xd6, 0x14,
-  0x46, 0x27, 0x97, 0x86, 0xb7, 0x01, 0x41, 0x74, 0xa2, 0xc2, 0x07, 0x3a,
-  0x90, 0xea, 0x00, 0xa3, 0x63, 0x97, 0x56, 0x76, 0x07, 0x25, 0xf7, 0xa6,
-  0xd6, 0x14, 0x46, 0x27, 0x97, 0x86, 0x37, 0x41, 0x18, 0xdc, 0x60, 0x03,
-  0x82, 0xf0, 0x44, 0x85, 0x0f, 0x74, 0xd0, 0x13, 0x75, 0x80, 0x11, 0x81,
-  0x7b, 0x9b, 0x4b, 0xa3, 0x4b, 0x7b, 0x73, 0x9b, 0x20, 0x0c, 0x6f, 0xb0,
-  0xc1, 0x40, 0x7e, 0x82, 0x0e, 0xc0, 0xa2, 0x0e, 0x30, 0x22, 0x70, 0x61,
-  0x64, 0x64, 0x69, 0x6e, 0x67, 0x30, 0x13, 0x84, 0x01, 0x0e, 0x36, 0x18,
-  0x88, 0x58, 0xd0, 0xc1, 0x58, 0xd4, 0x01, 0xc6, 0xc4, 0x4c, 0xae, 0x6e,
-  0x8e, 0xae, 0xae, 0x0d, 0x0b, 0x6b, 0x82, 0x30, 0xc4, 0xc1, 0x06, 0x03,
-  0x29, 0x0b, 0x3a, 0x30, 0x8b, 0x3a, 0xc0, 0x98, 0x98, 0xc9, 0xd5, 0xcd,
-  0xd1, 0xd5, 0xb5, 0x61, 0x69, 0x4d, 0x10, 0x06, 0x39, 0xd8, 0x60, 0x20,
-  0x68, 0x41, 0x07, 0x69, 0x51, 0x07, 0x18, 0x13, 0x33, 0xb9, 0xba, 0x39,
-  0xba, 0xba, 0xb6, 0xac, 0xac, 0x09, 0xc2, 0x30, 0x07, 0x1b, 0x0c, 0x64,
-  0x2d, 0xe8, 0x80, 0x2d, 0xea, 0x00, 0x63, 0x62, 0x26, 0x57, 0x37, 0x47,
-  0x57, 0xd7, 0x96, 0xa5, 0x35, 0x41, 0x18, 0xe8, 0x60, 0x83, 0x81, 0xb8,
-  0x05, 0x1d, 0xbc, 0x45, 0x1d, 0x60, 0x2c, 0xdc, 0xca, 0xc2, 0xe4, 0xb4,
-  0x26, 0x08, 0x43, 0x1d, 0x6c, 0x30, 0x90, 0xb8, 0xa0, 0x03, 0xb9, 0xa8,
-  0x03, 0x8c, 0x84, 0x59, 0x98, 0x9c, 0xd6, 0x04, 0x61, 0xb0, 0x83, 0x0d,
-  0x06, 0x42, 0x17, 0x74, 0x50, 0x17, 0x75, 0x80, 0x11, 0x1a, 0x63, 0xab,
-  0x9b, 0xa3, 0x2b, 0x93, 0x1b, 0x7a, 0x73, 0x9b, 0xa3, 0x0b, 0x73, 0xa3,
-  0x0b, 0x9a, 0x20, 0x0c, 0x77, 0xb0, 0xc1, 0x40, 0xee, 0x82, 0x0e, 0xf0,
-  0xa2, 0x0e, 0x30, 0x42, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x43,
-  0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x42, 0x13, 0x84, 0x01, 0x0f,
-  0x36, 0x18, 0x88, 0x5e, 0xd0, 0xc1, 0x5e, 0xd4, 0x01, 0xb6, 0xe1, 0x51,
-  0x83, 0x9b, 0xc8, 0x89, 0x9d, 0xf0, 0x89, 0xb0, 0x20, 0x8b, 0xb3, 0x50,
-  0x8b, 0xb6, 0x80, 0x8b, 0xb9, 0xb0, 0x8b, 0xbc, 0xe0, 0x8b, 0x09, 0xc2,
-  0x63, 0x0a, 0x1b, 0x0c, 0x64, 0x0f, 0xe8, 0x80, 0xa8, 0x03, 0x8c, 0x44,
-  0x5b, 0x1a, 0xdc, 0xdc, 0x06, 0x02, 0x01, 0x0d, 0x3a, 0x28, 0x85, 0x09,
-  0x02, 0x80, 0x0b, 0x1b, 0x04, 0x42, 0x34, 0x36, 0x04, 0xa3, 0xb1, 0x41,
-  0x20, 0x48, 0x63, 0x03, 0xe1, 0x0e, 0x7f, 0x11, 0x1a, 0xa5, 0x31, 0x41,
-  0x70, 0x4a, 0x81, 0x06, 0x5a, 0x98, 0x1b, 0x19, 0x5b, 0xd9, 0x06, 0x03,
-  0x41, 0x0d, 0x3a, 0x20, 0xea, 0xc0, 0x0e, 0x36, 0x08, 0xbd, 0x90, 0x1a,
-  0x13, 0x84, 0x4a, 0x15, 0x36, 0x10, 0x48, 0x19, 0xd0, 0x01, 0xb1, 0x41,
-  0x30, 0x03, 0xd6, 0x98, 0x20, 0xac, 0xc2, 0x2d, 0x6c, 0x20, 0x90, 0x34,
-  0xa0, 0x03, 0x62, 0x83, 0xa0, 0x06, 0xaf, 0x31, 0x41, 0xc8, 0x58, 0x61,
-  0x82, 0xa0, 0xb5, 0xc2, 0x04, 0x81, 0x7b, 0x85, 0x09, 0x42, 0x07, 0x0b,
-  0x1b, 0xd2, 0x80, 0x90, 0x03, 0x3c, 0xc8, 0x83, 0x50, 0xe8, 0x03, 0x59,
-  0x98, 0x05, 0x5c, 0xc8, 0x85, 0x70, 0x10, 0x07, 0x78, 0x88, 0x07, 0x7b,
-  0x90, 0x07, 0x7e, 0xe8, 0x87, 0x91, 0xf8, 0x07, 0x94, 0x48, 0x09, 0x9a,
-  0xa8, 0x89, 0xbe, 0xf0, 0x0b, 0xd3, 0x38, 0x0d, 0xd5, 0x58, 0x8d, 0xd6,
-  0x70, 0x0d, 0xd8, 0x88, 0x8d, 0xbe, 0x90, 0x0d, 0xd8, 0x98, 0x0d, 0x7e,
-  0xa0, 0x0d, 0x7b, 0x98, 0x20, 0x84, 0xc1, 0xb1, 0x01, 0xd8, 0x30, 0x10,
-  0xb7, 0x71, 0x1b, 0x1b, 0x02, 0xdc, 0xd8, 0x30, 0x0c, 0xb6, 0x91, 0x1b,
-  0x24, 0xda, 0xc2, 0xd2, 0xdc, 0x26, 0x08, 0xac, 0x60, 0x6d, 0x18, 0xa4,
-  0x61, 0xd8, 0x40, 0x10, 0xbc, 0xd1, 0x0b, 0xbd, 0xb1, 0xa1, 0xb0, 0x8d,
-  0xdd, 0x00, 0xe2, 0xc0, 0x37, 0x18, 0x85, 0xc9, 0xc9, 0x85, 0xe5, 0x7d,
-  0xb1, 0xbd, 0x8d, 0x85, 0xb1, 0x7d, 0x89, 0xe5, 0xd1, 0x95, 0xcd, 0x11,
-  0x0a, 0x93, 0x93, 0x0b, 0xcb, 0xfb, 0x62, 0x7b, 0x1b, 0x0b, 0x63, 0xfb,
-  0x62, 0x23, 0x9b, 0xa3, 0xa3, 0x11, 0x46, 0xf7, 0xd6, 0x96, 0x36, 0x46,
-  0x44, 0x4c, 0x2e, 0xcc, 0x6d, 0x0c, 0xad, 0x6c, 0x8e, 0x86, 0x19, 0xdb,
-  0x5b, 0x18, 0xdd, 0xdc, 0x04, 0x61, 0xc8, 0x03, 0x16, 0x69, 0x6e, 0x73,
-  0x74, 0x73, 0x13, 0x84, 0x41, 0x0f, 0x48, 0xa4, 0xb9, 0xd1, 0xcd, 0x11,
-  0xa1, 0x2b, 0xc3, 0xfb, 0x62, 0x7b, 0x0b, 0x23, 0x9b, 0x20, 0x0c, 0x7b,
-  0x40, 0x84, 0xae, 0x0c, 0xef, 0xcb, 0xed, 0x4d, 0xae, 0x8d, 0x09, 0x5d,
-  0x19, 0xde, 0xd7, 0x1c, 0xdd, 0x9b, 0x5c, 0x19, 0x8b, 0xba, 0x34, 0x37,
-  0xba, 0xb9, 0x0d, 0x16, 0x78, 0xf8, 0x43, 0x78, 0x30, 0xe2, 0x31, 0x8c,
-  0x87, 0x1d, 0x90, 0x47, 0x79, 0x98, 0xc7, 0x79, 0xa0, 0x47, 0x95, 0x1e,
-  0xea, 0xb1, 0x1e, 0x03, 0x7b, 0x20, 0xed, 0x81, 0x54, 0x61, 0x63, 0xb3,
-  0x6b, 0x73, 0x49, 0x23, 0x2b, 0x73, 0xa3, 0x9b, 0x12, 0x04, 0x55, 0xc8,
-  0xf0, 0x5c, 0xec, 0xca, 0xe4, 0xe6, 0xd2, 0xde, 0xdc, 0xa6, 0x04, 0x44,
-  0x13, 0x32, 0x3c, 0x17, 0xbb, 0x30, 0x36, 0xbb, 0x32, 0xb9, 0x29, 0x41,
-  0x51, 0x87, 0x0c, 0xcf, 0x65, 0x0e, 0x2d, 0x8c, 0xac, 0x4c, 0xae, 0xe9,
-  0x8d, 0xac, 0x8c, 0x6d, 0x4a, 0x80, 0x94, 0x21, 0xc3, 0x73, 0x91, 0x2b,
-  0x9b, 0x7b, 0xab, 0x93, 0x1b, 0x2b, 0x9b, 0x9b, 0x12, 0xc0, 0x41, 0x25,
-  0x32, 0x3c, 0x17, 0xba, 0x3c, 0xb8, 0xb2, 0x20, 0x37, 0xb7, 0x37, 0xba,
-  0x30, 0xba, 0xb4, 0x37, 0xb7, 0xb9, 0x29, 0x02, 0x6d, 0xe4, 0x46, 0x1d,
-  0x32, 0x3c, 0x97, 0x32, 0x37, 0x3a, 0xb9, 0x3c, 0xa8, 0xb7, 0x34, 0x37,
-  0xba, 0xb9, 0x29, 0x81, 0x6f, 0x74, 0x21, 0xc3, 0x73, 0x19, 0x7b, 0xab,
-  0x73, 0xa3, 0x2b, 0x93, 0x9b, 0x9b, 0x12, 0xb4, 0x07, 0x00, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c,
-  0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3,
-  0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6,
-  0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e,
-  0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43,
-  0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03,
-  0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48,
-  0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20,
-  0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e,
-  0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d,
-  0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89,
-  0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83,
-  0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68,
-  0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90,
-  0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78,
-  0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98,
-  0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5,
-  0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c,
-  0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c,
-  0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43,
-  0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43,
-  0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82,
-  0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70,
-  0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8,
-  0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2,
-  0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00,
-  0x71, 0x20, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x65, 0x40, 0x07, 0x81,
-  0x9f, 0xf8, 0xed, 0x2e, 0x0b, 0xeb, 0x66, 0x73, 0x59, 0x0e, 0x04, 0xce,
-  0xac, 0x3f, 0xd2, 0x94, 0x2e, 0xaf, 0x8f, 0xe9, 0x75, 0x79, 0x99, 0x2c,
-  0xac, 0x9b, 0xcd, 0x65, 0x39, 0xb0, 0x2a, 0x7c, 0xbb, 0xcb, 0x40, 0x20,
-  0x10, 0x18, 0xfc, 0xb2, 0xcb, 0xe7, 0xf0, 0x38, 0x5f, 0x02, 0x64, 0x10,
-  0xf8, 0x91, 0xcb, 0x70, 0x3a, 0x1a, 0x99, 0x2e, 0xcb, 0xc3, 0xf2, 0x31,
-  0x3a, 0x0f, 0x04, 0xce, 0xac, 0x3f, 0x12, 0xb5, 0x8c, 0xa7, 0xd7, 0xe5,
-  0x65, 0x19, 0x11, 0xd8, 0x04, 0x02, 0x83, 0x35, 0xa0, 0x06, 0x81, 0x1f,
-  0xb9, 0x0c, 0xa7, 0xa3, 0x91, 0xe9, 0xb2, 0x3c, 0x2c, 0x1f, 0xa3, 0xf3,
-  0xd3, 0x70, 0x1b, 0xce, 0x2e, 0xcb, 0x81, 0xc0, 0x59, 0x75, 0x1a, 0x6e,
-  0xc3, 0xd9, 0x65, 0xf9, 0x94, 0x1e, 0xa6, 0x97, 0x81, 0xc0, 0x60, 0x05,
-  0x9c, 0x42, 0xe0, 0x37, 0x5f, 0xa7, 0xdd, 0xee, 0x32, 0x79, 0xf8, 0x6e,
-  0xb7, 0xc3, 0x6e, 0xb2, 0xb0, 0x6e, 0x36, 0x97, 0xe5, 0x40, 0xe0, 0xcc,
-  0xfa, 0x23, 0x05, 0xe1, 0xf0, 0xb2, 0x9b, 0x3c, 0xa5, 0xcb, 0xeb, 0x63,
-  0x7a, 0x5d, 0x5e, 0x26, 0x0b, 0xeb, 0x66, 0x73, 0x59, 0x0e, 0xac, 0x4e,
-  0xd7, 0x69, 0xb7, 0xbb, 0x4c, 0x1e, 0xbe, 0xdb, 0xed, 0xb0, 0x9b, 0x0c,
-  0x04, 0x02, 0x81, 0xc1, 0x02, 0xf8, 0x83, 0xc0, 0x6f, 0xbe, 0x4e, 0xbb,
-  0xdd, 0x65, 0xf2, 0x53, 0xac, 0x2e, 0x8f, 0xe9, 0xc2, 0xba, 0xd9, 0x5c,
-  0x96, 0x03, 0x81, 0x33, 0xeb, 0x8f, 0x34, 0xa5, 0xcb, 0xeb, 0x63, 0x7a,
-  0x5d, 0x5e, 0x26, 0x0b, 0xeb, 0x66, 0x73, 0x59, 0x0e, 0xac, 0x4e, 0xd7,
-  0x69, 0xb7, 0xbb, 0x4c, 0x7e, 0x8a, 0xd5, 0xe5, 0x31, 0x1d, 0x08, 0x04,
-  0x02, 0x83, 0x56, 0x30, 0x09, 0x00, 0x43, 0x44, 0xc0, 0x46, 0x15, 0x05,
-  0x11, 0xfd, 0x0b, 0x61, 0x00, 0x02, 0x66, 0x04, 0xd2, 0x40, 0x3c, 0xd3,
-  0x11, 0x22, 0x44, 0x04, 0x44, 0xc2, 0x81, 0xb1, 0x48, 0x46, 0xd8, 0x02,
-  0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0xd2, 0x00, 0x11, 0xe6, 0x17, 0xb7,
-  0x6d, 0x14, 0xd4, 0x70, 0xf9, 0xce, 0xe3, 0x07, 0x54, 0x51, 0x10, 0x51,
-  0xe9, 0x00, 0x83, 0x5f, 0xdc, 0xb6, 0x4d, 0x50, 0xc3, 0xe5, 0x3b, 0x8f,
-  0x1f, 0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x3e, 0x72, 0xdb, 0x56,
-  0x51, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x40, 0x15, 0x05, 0x11, 0xb1, 0x93,
-  0x13, 0x11, 0x3e, 0x72, 0xdb, 0xd6, 0x90, 0x0d, 0x97, 0xef, 0x3c, 0x7e,
-  0x40, 0x15, 0x05, 0x11, 0xb9, 0xcf, 0x00, 0x4c, 0x04, 0xe7, 0x50, 0xcd,
-  0x44, 0x44, 0x06, 0xb1, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x50, 0x45,
-  0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25, 0x61, 0x00, 0x02, 0xe6, 0x17, 0xb7,
-  0x6d, 0x0f, 0xdb, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x01, 0x55, 0x14, 0x44,
-  0x54, 0x3a, 0xc0, 0x50, 0x12, 0x06, 0x20, 0x60, 0x3e, 0x72, 0xdb, 0x26,
-  0x21, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x11, 0xc0, 0x44, 0x84, 0x40,
-  0x33, 0x2c, 0x84, 0x39, 0x38, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x38, 0x93,
-  0xed, 0x17, 0xb7, 0x6d, 0x09, 0xce, 0x70, 0xf9, 0xce, 0xe3, 0x0f, 0xce,
-  0x74, 0xfb, 0xc5, 0x6d, 0x1b, 0x43, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x12,
-  0xc0, 0x3c, 0x0b, 0x51, 0x12, 0x15, 0xb1, 0xf8, 0xc5, 0x6d, 0x5b, 0x84,
-  0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x13, 0x11, 0x4d, 0x08, 0x10, 0x61, 0x7e,
-  0x71, 0xdb, 0x86, 0x20, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0x74, 0x44, 0x04,
-  0x30, 0x88, 0x83, 0x8f, 0xdc, 0xb6, 0x29, 0x3c, 0xc3, 0xe5, 0x3b, 0x8f,
-  0x4f, 0x35, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0xdb, 0x01, 0xc1, 0x00, 0x48,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x78, 0x38, 0xea,
-  0x13, 0x5e, 0x86, 0x32, 0x6b, 0xe3, 0x48, 0x69, 0x0b, 0xc5, 0x4d, 0xf2,
-  0x44, 0x58, 0x49, 0x4c, 0x34, 0x12, 0x00, 0x00, 0x60, 0x00, 0x05, 0x00,
-  0x8d, 0x04, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x1c, 0x12, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde,
-  0x21, 0x0c, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91,
-  0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c,
-  0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x1c, 0x45, 0x02,
-  0x42, 0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b,
-  0x0a, 0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5,
-  0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x91, 0x23, 0xc4, 0x50,
-  0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x39, 0x46, 0x06,
-  0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff,
-  0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x86, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0x03, 0x20, 0x01, 0xd5, 0x06, 0x62, 0xf8, 0xff, 0xff, 0xff,
-  0xff, 0x01, 0x90, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x89, 0x20, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x32, 0x22, 0xc8, 0x09,
-  0x20, 0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84, 0x04, 0x93, 0x23, 0xe3,
-  0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c, 0x0b, 0x84, 0xe4, 0x4c,
-  0x10, 0xb0, 0xc2, 0x08, 0x40, 0x09, 0x00, 0x14, 0x98, 0x23, 0x00, 0x83,
-  0x32, 0x0c, 0x06, 0x03, 0x22, 0xcc, 0x00, 0x14, 0xc4, 0x30, 0x30, 0x18,
-  0x0c, 0x06, 0x83, 0x81, 0x0e, 0x65, 0x30, 0x0c, 0x0c, 0x94, 0x28, 0x84,
-  0x61, 0x60, 0x30, 0xd0, 0xe2, 0xa6, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24,
-  0x7f, 0x25, 0xa4, 0x95, 0x98, 0xfc, 0xe2, 0xb6, 0x51, 0x61, 0x30, 0x18,
-  0x0c, 0x83, 0x39, 0x02, 0x84, 0x1c, 0xf7, 0x0c, 0x97, 0x3f, 0x61, 0x0f,
-  0x21, 0xf9, 0x21, 0xd0, 0x0c, 0x0b, 0x81, 0x82, 0x47, 0x61, 0x1a, 0x03,
-  0x08, 0xc4, 0x60, 0x30, 0x18, 0x06, 0x83, 0x81, 0x81, 0x22, 0x85, 0x18,
-  0x0c, 0x20, 0x0e, 0x9a, 0x14, 0xc3, 0x30, 0x30, 0x18, 0x0c, 0x06, 0xaa,
-  0x1c, 0x35, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4, 0x73, 0x1b, 0x55, 0xac,
-  0xc4, 0xe4, 0x23, 0xb7, 0x8d, 0x88, 0xc1, 0x60, 0x30, 0x28, 0xc4, 0x65,
-  0x00, 0x19, 0x10, 0xe6, 0xa8, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x9f,
-  0xdb, 0xa8, 0x62, 0x25, 0x26, 0xbf, 0xb8, 0x6d, 0x44, 0x18, 0x0c, 0x06,
-  0x43, 0x21, 0x34, 0x03, 0xc8, 0x80, 0x36, 0xa5, 0x30, 0x0c, 0x0c, 0x06,
-  0x03, 0x75, 0xe6, 0x08, 0x82, 0x62, 0x40, 0x06, 0x8e, 0xc1, 0xe0, 0x43,
-  0xa0, 0x9b, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc, 0x95, 0x90, 0x56,
-  0x62, 0xf2, 0x91, 0xdb, 0x46, 0xc5, 0x60, 0x30, 0x18, 0x0c, 0x4a, 0x21,
-  0x1a, 0x40, 0x06, 0x03, 0x1a, 0x95, 0xa2, 0x31, 0x80, 0x0c, 0x06, 0x54,
-  0x2a, 0x0a, 0x60, 0x00, 0x19, 0x0c, 0x06, 0x83, 0xc1, 0xc0, 0x41, 0xa7,
-  0x81, 0x80, 0x61, 0x84, 0xc1, 0xb8, 0x4a, 0x9a, 0x22, 0x4a, 0x98, 0xfc,
-  0xcd, 0xa1, 0x9a, 0x01, 0x69, 0x0c, 0xf6, 0x39, 0x88, 0x88, 0x40, 0x82,
-  0xca, 0x70, 0x8a, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x25, 0xda, 0xa1, 0x61,
-  0x30, 0x18, 0xe4, 0x00, 0xeb, 0x1e, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x4d,
-  0x60, 0x22, 0x22, 0x04, 0x58, 0x90, 0x31, 0x18, 0x0c, 0x06, 0x83, 0xc1,
-  0x51, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0xb3, 0x0a, 0xd2, 0x34, 0xc4, 0x80,
-  0x06, 0x09, 0x21, 0x4c, 0xc8, 0x58, 0xb5, 0x5c, 0x83, 0x81, 0x6a, 0xa6,
-  0x32, 0x18, 0x07, 0x76, 0x08, 0x87, 0x79, 0x98, 0x07, 0x37, 0x98, 0x05,
-  0x7a, 0x90, 0x87, 0x7a, 0x18, 0x07, 0x7a, 0xa8, 0x07, 0x79, 0x28, 0x07,
-  0x72, 0x10, 0x85, 0x7a, 0x30, 0x07, 0x73, 0x28, 0x07, 0x79, 0xe0, 0x83,
-  0x59, 0x58, 0x87, 0x74, 0x70, 0x07, 0x77, 0x28, 0x07, 0x72, 0x78, 0x05,
-  0x71, 0x50, 0x87, 0x72, 0x18, 0x07, 0x7a, 0xf0, 0x03, 0x14, 0xbc, 0x08,
-  0x36, 0x8c, 0x40, 0x18, 0x49, 0x20, 0xbb, 0x6f, 0xb8, 0x7c, 0x60, 0x41,
-  0x8c, 0x86, 0x21, 0x9a, 0xc9, 0x5f, 0x08, 0x03, 0x10, 0x30, 0x5f, 0x9a,
-  0x22, 0x4a, 0x98, 0xfc, 0xcd, 0x69, 0x08, 0x24, 0xcc, 0x66, 0x33, 0xc1,
-  0x01, 0x39, 0xe0, 0x83, 0x1b, 0x84, 0x03, 0x3b, 0xa4, 0xc3, 0x39, 0xb8,
-  0x43, 0x3b, 0x94, 0x83, 0x3b, 0xd0, 0x83, 0x1b, 0xb0, 0x43, 0x39, 0x9c,
-  0x43, 0x38, 0x8c, 0x43, 0x3e, 0xb8, 0xc1, 0x38, 0xb0, 0x43, 0x38, 0xcc,
-  0xc3, 0x3c, 0xb8, 0xc1, 0x2c, 0xd0, 0x83, 0x3c, 0xd4, 0xc3, 0x38, 0xd0,
-  0x43, 0x3d, 0xc8, 0x43, 0x39, 0x90, 0x83, 0x28, 0xd4, 0x83, 0x39, 0x98,
-  0x43, 0x39, 0xc8, 0x03, 0x1f, 0x88, 0xc2, 0x3b, 0xb8, 0x43, 0x39, 0xf8,
-  0x01, 0x0a, 0x68, 0x54, 0x9b, 0x29, 0x0c, 0xc6, 0x81, 0x1d, 0xc2, 0x61,
-  0x1e, 0xe6, 0xc1, 0x0d, 0x68, 0xa1, 0x1c, 0xf0, 0x81, 0x1e, 0xea, 0x41,
-  0x1e, 0xca, 0x41, 0x0e, 0x48, 0x81, 0x0f, 0xcc, 0x81, 0x1d, 0xde, 0x21,
-  0x1c, 0xe8, 0xc1, 0x0f, 0xf4, 0x40, 0x0f, 0xda, 0x21, 0x1d, 0xe0, 0x61,
-  0x1e, 0x7e, 0x81, 0x1e, 0xf2, 0x01, 0x1e, 0xca, 0x01, 0x05, 0x83, 0x99,
-  0xac, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70, 0x03, 0x5a, 0x28,
-  0x07, 0x7c, 0xa0, 0x87, 0x7a, 0x90, 0x87, 0x72, 0x90, 0x03, 0x52, 0xe0,
-  0x03, 0x73, 0x60, 0x87, 0x77, 0x08, 0x07, 0x7a, 0xf0, 0x03, 0x24, 0x18,
-  0x6e, 0x84, 0xbb, 0x45, 0x9a, 0x22, 0x4a, 0x98, 0x7c, 0xa0, 0x71, 0x1a,
-  0x54, 0x0c, 0x06, 0x83, 0xc1, 0xe0, 0x2a, 0x69, 0x8a, 0x28, 0x61, 0xf2,
-  0x59, 0x05, 0x69, 0x1a, 0x62, 0xe0, 0x1c, 0x86, 0x01, 0x9a, 0x01, 0x09,
-  0x03, 0xdd, 0x4c, 0x6c, 0x30, 0x0e, 0xec, 0x10, 0x0e, 0xf3, 0x30, 0x0f,
-  0x6e, 0x10, 0x0a, 0xf0, 0x00, 0x0f, 0xe5, 0xe0, 0x0e, 0xe4, 0x30, 0x0b,
-  0xf4, 0x20, 0x0f, 0xf5, 0x30, 0x0e, 0xf4, 0x50, 0x0f, 0xf2, 0x50, 0x0e,
-  0xe4, 0x20, 0x0a, 0xf5, 0x60, 0x0e, 0xe6, 0x50, 0x0e, 0xf2, 0xc0, 0x07,
-  0xb3, 0xb0, 0x0e, 0xe9, 0xe0, 0x0e, 0xee, 0x50, 0x0e, 0xe4, 0x30, 0x0a,
-  0xef, 0xd0, 0x0e, 0xed, 0x10, 0x0e, 0xee, 0x40, 0x0e, 0x7e, 0x80, 0x82,
-  0x1d, 0xf1, 0x86, 0x11, 0x84, 0xe1, 0x16, 0x69, 0x8a, 0x28, 0x61, 0xf2,
-  0x59, 0x24, 0x23, 0x50, 0xe0, 0x3b, 0x69, 0x20, 0x9e, 0xe9, 0x08, 0x11,
-  0x22, 0x02, 0x22, 0xe1, 0xc0, 0x58, 0x24, 0x23, 0x50, 0xf0, 0x23, 0xe0,
-  0x85, 0xc1, 0x70, 0xf9, 0xc0, 0x82, 0x18, 0x0d, 0x43, 0x34, 0x93, 0xbf,
-  0x10, 0x06, 0x20, 0x60, 0xbe, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x1c, 0xc0,
-  0x10, 0x11, 0x80, 0x9c, 0xd9, 0x6c, 0x36, 0x53, 0x19, 0x0c, 0x06, 0x83,
-  0xc1, 0x60, 0x30, 0x18, 0x0e, 0x0c, 0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68,
-  0x18, 0xa2, 0x99, 0xfc, 0x85, 0x30, 0x00, 0x01, 0xf3, 0x05, 0x80, 0x21,
-  0x22, 0x60, 0xa3, 0x8a, 0x82, 0x88, 0x50, 0x20, 0xa4, 0xe1, 0x4d, 0xd2,
-  0x14, 0x51, 0xc2, 0xe4, 0xb3, 0x00, 0xf3, 0x2c, 0x44, 0xc4, 0x4e, 0xc0,
-  0x44, 0xa0, 0x60, 0x40, 0xc5, 0x39, 0x02, 0x50, 0xc8, 0x81, 0x01, 0x21,
-  0x69, 0x30, 0x05, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87,
-  0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50,
-  0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0,
-  0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10,
-  0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0,
-  0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86,
-  0x3c, 0x04, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x79, 0x0e, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0xf2, 0x24, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0xe4, 0x59, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x60, 0xc8, 0x13, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x67, 0x02, 0x02, 0x60, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f, 0x05, 0x04, 0x40, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x0c, 0x08, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x1b, 0x10,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x3a,
-  0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2,
-  0x80, 0x01, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x79, 0xc6, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x86, 0x3c, 0x65, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x43, 0x9e, 0x33, 0x00, 0x02, 0x60, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2c, 0x10, 0x12, 0x00, 0x00, 0x00,
-  0x32, 0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47,
-  0xc6, 0x04, 0x43, 0x1a, 0x94, 0xc0, 0x08, 0x40, 0x31, 0x14, 0x46, 0x01,
-  0x07, 0x14, 0xa0, 0x40, 0x11, 0x94, 0x44, 0xc1, 0x14, 0x44, 0x81, 0x13,
-  0x14, 0x02, 0x7d, 0x46, 0x00, 0x6a, 0x80, 0x8e, 0x23, 0x00, 0x05, 0x42,
-  0xb9, 0x19, 0x00, 0xea, 0xcd, 0x00, 0x50, 0x70, 0x06, 0x80, 0x88, 0x33,
-  0x00, 0x64, 0x9c, 0x01, 0x20, 0xdb, 0x0c, 0x00, 0xc5, 0x66, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90,
-  0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1,
-  0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41,
-  0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a,
-  0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9,
-  0x10, 0x04, 0x13, 0x84, 0xe1, 0x99, 0x20, 0x0c, 0xd0, 0x06, 0x61, 0x20,
-  0x26, 0x08, 0x43, 0xb4, 0x41, 0x18, 0x0c, 0x0a, 0x63, 0x73, 0x1b, 0x06,
-  0xc4, 0x20, 0x26, 0x08, 0x71, 0x50, 0x06, 0x04, 0x26, 0x08, 0x83, 0x34,
-  0x41, 0x18, 0xa6, 0x0d, 0xc2, 0xd0, 0x6c, 0x48, 0x08, 0x65, 0x21, 0x88,
-  0x81, 0x21, 0x9c, 0x09, 0x82, 0x1d, 0x90, 0xc1, 0x04, 0x61, 0xa0, 0x36,
-  0x08, 0x43, 0xb4, 0x21, 0x19, 0xa0, 0x85, 0x18, 0x06, 0x86, 0x90, 0x26,
-  0x08, 0x43, 0x35, 0x41, 0xc8, 0x83, 0x6f, 0x82, 0x30, 0x58, 0x1b, 0x04,
-  0xc2, 0xda, 0x90, 0x50, 0xd5, 0x42, 0x50, 0x03, 0x45, 0x5c, 0x1b, 0x86,
-  0x67, 0xc2, 0x26, 0x08, 0x7d, 0x00, 0x06, 0x13, 0x84, 0x6f, 0x9b, 0x20,
-  0x7c, 0xdc, 0x04, 0x61, 0xb8, 0x36, 0x08, 0x43, 0xb7, 0x61, 0x21, 0xb4,
-  0x85, 0x20, 0x06, 0x66, 0xe3, 0x36, 0x6f, 0x43, 0xf0, 0x4d, 0x10, 0x42,
-  0x21, 0x0c, 0x26, 0x08, 0x03, 0xb6, 0x01, 0x21, 0xc2, 0x60, 0x21, 0x88,
-  0x41, 0x0c, 0x80, 0x09, 0x02, 0x29, 0x88, 0xc1, 0x04, 0x61, 0xc8, 0x36,
-  0x20, 0x03, 0x19, 0x2c, 0xc4, 0x30, 0x94, 0x01, 0xb0, 0x41, 0x18, 0x03,
-  0x33, 0x98, 0x20, 0x98, 0xc2, 0x18, 0x6c, 0x40, 0x08, 0x34, 0x58, 0x08,
-  0x62, 0x20, 0x80, 0x0d, 0x41, 0x1a, 0x6c, 0x20, 0x32, 0x30, 0x38, 0x03,
-  0x35, 0x98, 0x20, 0x08, 0x00, 0x89, 0xb6, 0xb0, 0x34, 0xb7, 0x09, 0xc2,
-  0x29, 0x78, 0x13, 0x84, 0x41, 0xdb, 0x30, 0x44, 0xc3, 0xb0, 0x81, 0x20,
-  0xdc, 0xe0, 0x0d, 0xe0, 0x60, 0x43, 0xc1, 0x06, 0x6d, 0x00, 0xac, 0x41,
-  0x1c, 0x70, 0x48, 0x73, 0xa3, 0xe3, 0xf3, 0xd6, 0xe6, 0x96, 0x06, 0xf7,
-  0x46, 0x57, 0xe6, 0x46, 0x07, 0x32, 0x86, 0x16, 0x26, 0xc7, 0x68, 0x2a,
-  0xad, 0x0d, 0x8e, 0xad, 0x0c, 0x64, 0xe8, 0x65, 0x68, 0x65, 0x05, 0x84,
-  0x4a, 0x28, 0x28, 0x68, 0x43, 0x50, 0x07, 0x13, 0x84, 0x53, 0xe8, 0x36,
-  0x0c, 0x74, 0x60, 0x07, 0x77, 0xb0, 0x61, 0x98, 0x03, 0x3c, 0xb8, 0x83,
-  0x0d, 0x43, 0x1e, 0xe4, 0xc1, 0x1d, 0x54, 0x61, 0x63, 0xb3, 0x6b, 0x73,
-  0x49, 0x23, 0x2b, 0x73, 0xa3, 0x9b, 0x12, 0x04, 0x55, 0xc8, 0xf0, 0x5c,
-  0xec, 0xca, 0xe4, 0xe6, 0xd2, 0xde, 0xdc, 0xa6, 0x04, 0x44, 0x13, 0x32,
-  0x3c, 0x17, 0xbb, 0x30, 0x36, 0xbb, 0x32, 0xb9, 0x29, 0x81, 0x51, 0x87,
-  0x0c, 0xcf, 0x65, 0x0e, 0x2d, 0x8c, 0xac, 0x4c, 0xae, 0xe9, 0x8d, 0xac,
-  0x8c, 0x6d, 0x4a, 0x80, 0x94, 0x21, 0xc3, 0x73, 0x91, 0x2b, 0x9b, 0x7b,
-  0xab, 0x93, 0x1b, 0x2b, 0x9b, 0x9b, 0x12, 0xa8, 0x41, 0x1d, 0x32, 0x3c,
-  0x97, 0x32, 0x37, 0x3a, 0xb9, 0x3c, 0xa8, 0xb7, 0x34, 0x37, 0xba, 0xb9,
-  0x29, 0x41, 0x1c, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73,
-  0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e,
-  0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30,
-  0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8,
-  0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b,
-  0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76,
-  0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e,
-  0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e,
-  0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61,
-  0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4,
-  0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76,
-  0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37,
-  0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76,
-  0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71,
-  0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e,
-  0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1,
-  0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61,
-  0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90,
-  0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8,
-  0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc,
-  0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4,
-  0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19,
-  0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06,
-  0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f,
-  0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x80, 0x34, 0x40, 0x84, 0xf9,
-  0xc5, 0x6d, 0x5b, 0x03, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0x55, 0x14,
-  0x44, 0x54, 0x3a, 0xc0, 0xe0, 0x17, 0xb7, 0x6d, 0x0c, 0xd4, 0x70, 0xf9,
-  0xce, 0xe3, 0x07, 0x54, 0x51, 0x10, 0x51, 0xe9, 0x00, 0x83, 0x8f, 0xdc,
-  0xb6, 0x39, 0x54, 0xc3, 0xe5, 0x3b, 0x8f, 0x1f, 0x50, 0x45, 0x41, 0x44,
-  0xec, 0xe4, 0x44, 0x84, 0x8f, 0xdc, 0xb6, 0x19, 0x64, 0xc3, 0xe5, 0x3b,
-  0x8f, 0x1f, 0x50, 0x45, 0x41, 0x44, 0xee, 0x33, 0x00, 0x13, 0xc1, 0x39,
-  0x54, 0x33, 0x11, 0x91, 0x25, 0x6c, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x04,
-  0x54, 0x51, 0x10, 0x51, 0xe9, 0x00, 0x43, 0x49, 0x18, 0x80, 0x80, 0xf9,
-  0xc5, 0x6d, 0x1b, 0xc2, 0x36, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x40, 0x15,
-  0x05, 0x11, 0x95, 0x0e, 0x30, 0x94, 0x84, 0x01, 0x08, 0x98, 0x8f, 0xdc,
-  0xb6, 0x2d, 0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x44, 0x04, 0x30, 0x11,
-  0x21, 0xd0, 0x0c, 0x0b, 0x61, 0x07, 0xce, 0x70, 0xf9, 0xce, 0xe3, 0x0f,
-  0xce, 0x64, 0xfb, 0xc5, 0x6d, 0x9b, 0x80, 0x33, 0x5c, 0xbe, 0xf3, 0xf8,
-  0x83, 0x33, 0xdd, 0x7e, 0x71, 0xdb, 0x56, 0x50, 0x0d, 0x97, 0xef, 0x3c,
-  0xbe, 0x04, 0x30, 0xcf, 0x42, 0x94, 0x44, 0x45, 0x2c, 0x7e, 0x71, 0xdb,
-  0xa6, 0x20, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0x44, 0x44, 0x13, 0x02, 0x44,
-  0x98, 0x5f, 0xdc, 0xb6, 0x05, 0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x1d,
-  0x11, 0x01, 0x0c, 0xe2, 0xe0, 0x23, 0xb7, 0x6d, 0x03, 0xcf, 0x70, 0xf9,
-  0xce, 0xe3, 0x53, 0x0d, 0x10, 0x61, 0x7e, 0x71, 0xdb, 0x06, 0x40, 0x30,
-  0x00, 0xd2, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00,
-  0x13, 0x04, 0x49, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x34, 0x28, 0xae, 0x19, 0x80, 0x42, 0x0c, 0x28, 0xbb, 0x92, 0x2b, 0xc5,
-  0x80, 0x72, 0x2b, 0x87, 0x02, 0x29, 0xa3, 0x42, 0x29, 0x9c, 0x02, 0x2a,
-  0xb0, 0x62, 0x2b, 0xdd, 0x80, 0x42, 0x2a, 0xa8, 0xc2, 0x2a, 0xcc, 0x80,
-  0x02, 0x0d, 0x28, 0x83, 0x22, 0x29, 0x91, 0x52, 0x28, 0x97, 0xe2, 0x2b,
-  0xc6, 0x00, 0x72, 0x94, 0x41, 0x11, 0x8c, 0x00, 0x94, 0x00, 0x19, 0xc6,
-  0x08, 0xd8, 0x36, 0x7e, 0xe5, 0x6d, 0x8c, 0x00, 0x04, 0x41, 0x50, 0x05,
-  0x83, 0x31, 0x02, 0x10, 0x04, 0x41, 0x19, 0x0c, 0x46, 0x00, 0x66, 0x00,
-  0xc6, 0x08, 0x40, 0x10, 0x04, 0x41, 0x50, 0x18, 0x23, 0x00, 0x41, 0x10,
-  0x84, 0x3f, 0x00, 0x00, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x00, 0x06,
-  0xa2, 0x30, 0x06, 0x48, 0x1f, 0xf4, 0x81, 0x1c, 0x8c, 0x18, 0x24, 0x00,
-  0x08, 0x82, 0x01, 0x18, 0x8c, 0x02, 0x19, 0x28, 0x79, 0x90, 0x07, 0x73,
-  0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x60, 0x40, 0x0a, 0x65, 0xb0,
-  0x80, 0x02, 0x28, 0xd0, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x80,
-  0x41, 0x29, 0x98, 0x01, 0x03, 0x0a, 0xa0, 0x50, 0x07, 0x23, 0x06, 0x09,
-  0x00, 0x82, 0x60, 0x00, 0x06, 0xa6, 0x70, 0x06, 0x4f, 0x28, 0x84, 0x82,
-  0x1d, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x01, 0x18, 0x9c, 0x02, 0x1a,
-  0x3c, 0xa3, 0x30, 0x0a, 0x77, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06,
-  0x60, 0x80, 0x0a, 0x69, 0x00, 0x8d, 0xc2, 0x28, 0xe0, 0xc1, 0x88, 0x81,
-  0x01, 0x80, 0x20, 0x18, 0x10, 0xb3, 0xf0, 0x91, 0xc2, 0x4c, 0x04, 0x2a,
-  0x0c, 0xcf, 0x28, 0xcc, 0x44, 0xa0, 0xc2, 0xf0, 0x8c, 0xc2, 0x4c, 0x04,
-  0x2a, 0x0c, 0xcf, 0x28, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0x19,
-  0xac, 0x02, 0x1c, 0x20, 0x04, 0x2a, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82,
-  0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x94,
-  0xc1, 0x2b, 0xd0, 0x01, 0x83, 0xa8, 0xc2, 0x42, 0x0e, 0x48, 0x2b, 0xb4,
-  0xc2, 0x42, 0x0e, 0x88, 0x2b, 0xb8, 0xc2, 0x42, 0x0e, 0xc8, 0x2b, 0xbc,
-  0xc2, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c, 0x01, 0x2d, 0xe0, 0x01,
-  0xc4, 0xc8, 0xc1, 0x68, 0x42, 0x00, 0x0c, 0x1b, 0x10, 0x45, 0x30, 0x00,
-  0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0xb6, 0xa0, 0x07, 0x92,
-  0x23, 0x07, 0xa3, 0x09, 0x01, 0x30, 0x6c, 0x40, 0x18, 0xc1, 0x00, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18, 0xe0, 0x02, 0x1f, 0x50, 0x50,
-  0x2b, 0x8c, 0x26, 0x04, 0xc0, 0xb0, 0x01, 0x71, 0x04, 0x03, 0xb0, 0x90,
-  0x43, 0x64, 0x0b, 0xb7, 0xb0, 0x90, 0x43, 0x74, 0x0b, 0xb8, 0xb0, 0x90,
-  0x43, 0x84, 0x0b, 0xb9, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x63,
-  0xd0, 0x0b, 0xa1, 0x90, 0x55, 0x78, 0x30, 0x9a, 0x10, 0x00, 0xc3, 0x06,
-  0x44, 0x11, 0x0c, 0xc0, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c, 0xc1,
-  0x2f, 0x8c, 0xc2, 0x76, 0xe5, 0xc1, 0x68, 0x42, 0x00, 0x0c, 0x1b, 0x10,
-  0x46, 0x30, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0xe1,
-  0x50, 0x0a, 0x5d, 0x76, 0x07, 0xa3, 0x09, 0x01, 0x30, 0x6c, 0x40, 0x1c,
-  0xc1, 0x00, 0x2c, 0xe4, 0xa0, 0xfd, 0x82, 0x2e, 0x2c, 0xe4, 0xa0, 0x81,
-  0xc3, 0x2e, 0x2c, 0xe4, 0xa0, 0x85, 0x03, 0x2f, 0x8c, 0x18, 0x20, 0x00,
-  0x08, 0x82, 0xc1, 0x18, 0x98, 0x83, 0x2a, 0x88, 0x81, 0xb7, 0x07, 0xa3,
-  0x09, 0x01, 0x30, 0x6c, 0x40, 0x14, 0xc1, 0x00, 0x8c, 0x18, 0x20, 0x00,
-  0x08, 0x82, 0xc1, 0x18, 0xa0, 0x03, 0x2b, 0x90, 0x01, 0x18, 0xf0, 0xc1,
-  0x68, 0x42, 0x00, 0x0c, 0x1b, 0x10, 0x46, 0x30, 0x00, 0x23, 0x06, 0x08,
-  0x00, 0x82, 0x60, 0x30, 0x06, 0xea, 0xe0, 0x0a, 0x66, 0x20, 0x06, 0xa3,
-  0x30, 0x9a, 0x10, 0x00, 0xc3, 0x06, 0xc4, 0x11, 0x0c, 0xc0, 0x88, 0x01,
-  0x02, 0x80, 0x20, 0x18, 0x8c, 0x01, 0x3b, 0xc0, 0x02, 0x1a, 0x90, 0xc1,
-  0x1f, 0x8c, 0x26, 0x04, 0xc0, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c,
-  0x81, 0x3b, 0xc8, 0x82, 0x1a, 0x98, 0x01, 0x28, 0x8c, 0x26, 0x04, 0x40,
-  0x05, 0xed, 0xa0, 0xc3, 0x0d, 0x41, 0x3b, 0x80, 0xc1, 0x2c, 0x03, 0x12,
-  0x04, 0xa3, 0x09, 0x62, 0x00, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x41,
-  0x19, 0xc8, 0xc3, 0x2d, 0xc0, 0x81, 0xf1, 0x0e, 0xa3, 0x09, 0x01, 0x30,
-  0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30, 0x9a, 0x40, 0x0c, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0x50, 0x06, 0xf7, 0xc0, 0x0b, 0x75, 0xb0, 0xd8,
-  0xc2, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c,
-  0x26, 0x10, 0xc3, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x94, 0x01, 0x3f,
-  0x84, 0x83, 0x1e, 0x40, 0xb7, 0x30, 0x9a, 0x10, 0x00, 0xa3, 0x09, 0x42,
-  0x30, 0x9a, 0x30, 0x08, 0xa3, 0x09, 0xc4, 0x30, 0x62, 0x80, 0x00, 0x20,
-  0x08, 0x06, 0x65, 0x10, 0x12, 0xe6, 0xf0, 0x07, 0xd5, 0x2e, 0x8c, 0x26,
-  0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x68, 0x02, 0x31,
-  0x8c, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1, 0x11, 0x13, 0xe7, 0x30, 0x39,
-  0xc9, 0xe4, 0x24, 0x23, 0x06, 0x0b, 0x00, 0x82, 0x60, 0x70, 0xc8, 0x04,
-  0x3a, 0x4c, 0x4e, 0x32, 0x39, 0xc9, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18,
-  0x1c, 0x33, 0x91, 0x0e, 0x93, 0x93, 0x4c, 0x4e, 0x32, 0x62, 0x70, 0x00,
-  0x20, 0x08, 0x06, 0x8b, 0x4c, 0x9c, 0x83, 0x10, 0x8c, 0x18, 0x1c, 0x00,
-  0x08, 0x82, 0xc1, 0x32, 0x13, 0xe8, 0x40, 0x04, 0x23, 0x06, 0x06, 0x00,
-  0x82, 0x60, 0x90, 0xd4, 0x44, 0x48, 0x04, 0x16, 0x6c, 0xf2, 0x31, 0x2d,
-  0x14, 0xe4, 0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x5d, 0x4c, 0xd4,
-  0x83, 0x15, 0x0a, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x74, 0x32,
-  0x61, 0x0f, 0x52, 0x28, 0x04, 0x16, 0x38, 0xd0, 0xb1, 0xae, 0x14, 0xe4,
-  0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x5d, 0x4d, 0xe4, 0x43, 0x56,
-  0x0a, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x74, 0x36, 0xa1, 0x0f,
-  0x55, 0x29, 0x04, 0x16, 0x44, 0xd0, 0x31, 0x30, 0x48, 0x05, 0xf9, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0x97, 0x13, 0xfd, 0xc0, 0xa5, 0x42,
-  0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x9d, 0x4e, 0xf8, 0x03, 0x96,
-  0x0a, 0x81, 0x05, 0x14, 0x74, 0x6c, 0x0c, 0x5a, 0x41, 0x3e, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0xd0, 0xf5, 0x44, 0x48, 0x7c, 0xad, 0x10, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0xe7, 0x13, 0x22, 0xb1, 0xb5, 0x42,
-  0x60, 0xc1, 0x05, 0x9d, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0xd8, 0xc2,
-  0x22, 0x24, 0x70, 0x41, 0x27, 0x46, 0x13, 0x02, 0x60, 0x34, 0x41, 0x08,
-  0x46, 0x13, 0x06, 0x61, 0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0xb6, 0xb2,
-  0x28, 0x09, 0x5e, 0xf8, 0x89, 0xd1, 0x84, 0x00, 0x18, 0x4d, 0x10, 0x82,
-  0xd1, 0x84, 0x41, 0x18, 0x31, 0x38, 0x00, 0x10, 0x04, 0x83, 0x2d, 0x2d,
-  0x52, 0x02, 0x1c, 0x7a, 0x62, 0x34, 0x21, 0x00, 0x46, 0x13, 0x84, 0x60,
-  0x34, 0x61, 0x10, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0x60, 0x6b, 0x8b,
-  0x96, 0x20, 0x87, 0x7d, 0x18, 0x4d, 0x08, 0x80, 0xd1, 0x04, 0x21, 0x18,
-  0x4d, 0x18, 0x04, 0x7b, 0x3a, 0xf9, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82,
-  0x41, 0x17, 0x17, 0x35, 0xc1, 0x68, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20,
-  0x18, 0x74, 0x72, 0x61, 0x13, 0xc9, 0x15, 0x8c, 0x18, 0x20, 0x00, 0x08,
-  0x82, 0x41, 0x37, 0x17, 0x37, 0x61, 0x50, 0x81, 0x49, 0x61, 0x20, 0x9f,
-  0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xe8, 0xea, 0x22, 0x27, 0x1e, 0x2f,
-  0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0xce, 0x2e, 0x74, 0x82, 0xd9,
-  0x82, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xe8, 0xee, 0x62, 0x27, 0x12,
-  0x2c, 0xb0, 0xaa, 0x0c, 0xe4, 0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06,
-  0x5d, 0x5e, 0xf4, 0x84, 0x24, 0x06, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20,
-  0x18, 0x74, 0x7a, 0xe1, 0x13, 0xcf, 0x17, 0x8c, 0x18, 0x20, 0x00, 0x08,
-  0x82, 0x41, 0xb7, 0x17, 0x3f, 0xc1, 0x70, 0xc1, 0x88, 0xc1, 0x01, 0x80,
-  0x20, 0x18, 0x6c, 0x7d, 0xd1, 0x13, 0xf4, 0xa0, 0x12, 0xa3, 0x09, 0x41,
-  0x30, 0x9a, 0x20, 0x00, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xb0, 0x81,
-  0x06, 0x58, 0xdc, 0x03, 0x4b, 0x8c, 0x26, 0x04, 0xc3, 0x68, 0x82, 0x20,
-  0x8c, 0x26, 0x0c, 0xc1, 0x68, 0x02, 0x01, 0x8c, 0x18, 0x18, 0x00, 0x08,
-  0x82, 0x41, 0xb2, 0x1a, 0x7d, 0x11, 0x8d, 0x18, 0x18, 0x00, 0x08, 0x82,
-  0x41, 0xc2, 0x1a, 0x7e, 0xe1, 0x8c, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1,
-  0xe1, 0x1a, 0x64, 0x31, 0x9c, 0x04, 0x21, 0x04, 0x8b, 0x99, 0x04, 0x1e,
-  0xc4, 0x67, 0x38, 0x42, 0x08, 0x86, 0x6f, 0xc4, 0x60, 0x01, 0x40, 0x10,
-  0x0c, 0x8e, 0xd8, 0x38, 0x0b, 0x95, 0x40, 0x92, 0x82, 0x70, 0x86, 0x23,
-  0x82, 0x61, 0xf8, 0x6a, 0x08, 0xd4, 0xa2, 0x3e, 0x88, 0xcf, 0x70, 0x44,
-  0xf0, 0x14, 0x5f, 0x05, 0x83, 0x1a, 0x05, 0x0a, 0xf0, 0x19, 0x8e, 0x08,
-  0xa6, 0xe1, 0xab, 0x60, 0xd0, 0x0b, 0x06, 0x31, 0xcb, 0x20, 0x20, 0xc2,
-  0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x6c, 0xb4, 0x41, 0x17, 0x2b, 0x31,
-  0x1a, 0xa3, 0x09, 0x01, 0x30, 0x62, 0x70, 0x00, 0x20, 0x08, 0x06, 0x9b,
-  0x6d, 0xd8, 0x45, 0x4b, 0x84, 0xc5, 0x68, 0x42, 0x10, 0x0c, 0x47, 0x20,
-  0x19, 0xf3, 0xcd, 0x32, 0x0c, 0x44, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08,
-  0x06, 0xd5, 0x6e, 0xb8, 0x45, 0x19, 0x74, 0x65, 0xd0, 0x99, 0x2a, 0xa8,
-  0x82, 0x7c, 0x4c, 0x08, 0xe2, 0x33, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06,
-  0x89, 0x78, 0xb8, 0x46, 0x60, 0x41, 0x1a, 0xc8, 0x67, 0xc4, 0x00, 0x01,
-  0x40, 0x10, 0x0c, 0xba, 0xde, 0x08, 0x0d, 0x57, 0x10, 0x83, 0xc0, 0x5e,
-  0x61, 0x0d, 0xe4, 0x63, 0x3e, 0x11, 0xc4, 0x67, 0xc4, 0x00, 0x01, 0x40,
-  0x10, 0x0c, 0x3a, 0xf0, 0x20, 0x8d, 0xa2, 0x0c, 0x82, 0x11, 0x03, 0x04,
-  0x00, 0x41, 0x30, 0xe8, 0xc2, 0xa3, 0x34, 0x34, 0x33, 0x28, 0x46, 0x0c,
-  0x10, 0x00, 0x04, 0xc1, 0xa0, 0x13, 0x0f, 0xd3, 0x38, 0xce, 0x80, 0x18,
-  0x31, 0x48, 0x00, 0x10, 0x04, 0x83, 0xca, 0x3c, 0xf2, 0x82, 0x0d, 0xd0,
-  0x80, 0x0d, 0xd0, 0xc0, 0x82, 0x25, 0x3e, 0x23, 0x06, 0x06, 0x00, 0x82,
-  0x60, 0x90, 0xb0, 0x07, 0x6e, 0x04, 0x16, 0xbc, 0x81, 0x7c, 0x46, 0x0c,
-  0x10, 0x00, 0x04, 0xc1, 0xa0, 0x3b, 0x8f, 0xd5, 0xc0, 0x05, 0x36, 0x08,
-  0x2c, 0x17, 0xe2, 0x40, 0x3e, 0x86, 0x16, 0x41, 0x7c, 0x46, 0x0c, 0x10,
-  0x00, 0x04, 0xc1, 0xa0, 0x53, 0x0f, 0xd7, 0x28, 0xde, 0x20, 0x18, 0x31,
-  0x40, 0x00, 0x10, 0x04, 0x83, 0x6e, 0x3d, 0x5e, 0x83, 0x0c, 0xe0, 0xa0,
-  0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0x8e, 0x3d, 0x60, 0xe3, 0x88,
-  0x03, 0xc2, 0xa0, 0x4c, 0x3e, 0xd6, 0x16, 0x4e, 0x7c, 0x4c, 0x08, 0xe8,
-  0x63, 0x0f, 0x27, 0x1f, 0x83, 0x8b, 0x27, 0x3e, 0x26, 0x04, 0xf4, 0x31,
-  0xa6, 0x93, 0x8f, 0xcd, 0x85, 0x12, 0x1f, 0x13, 0x02, 0xfa, 0xd8, 0x02,
-  0x06, 0xf2, 0x31, 0xbb, 0x58, 0xe2, 0x63, 0x42, 0x40, 0x9f, 0x59, 0x02,
-  0x62, 0xa0, 0xe2, 0x73, 0x9d, 0x01, 0x76, 0x84, 0x81, 0x0a, 0xc3, 0x1a,
-  0xe8, 0x45, 0x18, 0xa8, 0x30, 0x98, 0xc1, 0x5e, 0x84, 0x81, 0x0a, 0x83,
-  0x1a, 0xf0, 0x45, 0x18, 0xa8, 0x30, 0x94, 0x41, 0x5f, 0x84, 0x59, 0x86,
-  0xc2, 0x28, 0x8c, 0xe0, 0x0b, 0xf9, 0x18, 0xd1, 0x17, 0xf2, 0x31, 0xc2,
-  0x2f, 0xe4, 0x63, 0xc4, 0x5f, 0xc8, 0xc7, 0x08, 0xd0, 0x80, 0x8f, 0x85,
-  0x06, 0x11, 0x1f, 0x23, 0x44, 0x03, 0x3e, 0x36, 0x1a, 0x44, 0x7c, 0x46,
-  0x0c, 0x0c, 0x00, 0x04, 0xc1, 0x20, 0x69, 0x91, 0xf1, 0x20, 0x46, 0x0c,
-  0x0c, 0x00, 0x04, 0xc1, 0x20, 0x71, 0x11, 0xf2, 0x20, 0x46, 0x0c, 0x0c,
-  0x00, 0x04, 0xc1, 0x20, 0x79, 0x91, 0xf2, 0x20, 0x46, 0x0c, 0x0c, 0x00,
-  0x04, 0xc1, 0x20, 0x81, 0x11, 0xf3, 0x20, 0x4c, 0x20, 0xe2, 0x63, 0x02,
-  0x11, 0x9f, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0xc0, 0x5c, 0xa4, 0x3d,
-  0x46, 0xc3, 0x44, 0x46, 0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x4e, 0x30,
-  0xd4, 0x09, 0x86, 0x32, 0xe1, 0x90, 0x8f, 0x09, 0x87, 0x7c, 0x46, 0x0c,
-  0x0e, 0x00, 0x04, 0xc1, 0x60, 0xc9, 0x11, 0xf7, 0x10, 0x82, 0x11, 0x03,
-  0x03, 0x00, 0x41, 0x30, 0x48, 0x76, 0xe4, 0x37, 0x82, 0x11, 0x03, 0x03,
-  0x00, 0x41, 0x30, 0x48, 0x78, 0xc4, 0x3d, 0x02, 0x73, 0x20, 0xf8, 0x98,
-  0x03, 0xc1, 0xc7, 0x04, 0xdb, 0x90, 0x8f, 0x09, 0xb7, 0x21, 0x9f, 0x11,
-  0x83, 0x07, 0x00, 0x41, 0x30, 0x88, 0x7e, 0x84, 0x3c, 0x6c, 0x63, 0x36,
-  0x84, 0x40, 0x37, 0x74, 0x83, 0x46, 0x68, 0xa4, 0x3f, 0x8a, 0xd1, 0x84,
-  0x00, 0x18, 0x31, 0x38, 0x00, 0x10, 0x04, 0x83, 0xad, 0x47, 0xfa, 0x83,
-  0x36, 0x6a, 0x64, 0x34, 0x21, 0x10, 0xac, 0x37, 0x82, 0xf8, 0x8c, 0x18,
-  0x1c, 0x00, 0x08, 0x82, 0xc1, 0x06, 0x26, 0x20, 0x72, 0x1b, 0xfc, 0x31,
-  0x9a, 0x10, 0x08, 0x16, 0xc8, 0x02, 0x7d, 0x8c, 0x08, 0xe2, 0x63, 0xc8,
-  0x79, 0xc0, 0x67, 0x38, 0x42, 0x08, 0x8a, 0xef, 0x82, 0x41, 0xcc, 0x12,
-  0x18, 0x03, 0x15, 0x83, 0x50, 0xa0, 0x05, 0x31, 0xdc, 0x10, 0x84, 0x09,
-  0x18, 0xcc, 0x32, 0x20, 0x47, 0x60, 0xf5, 0x50, 0x0f, 0xf2, 0x31, 0x79,
-  0x90, 0x07, 0xf9, 0x58, 0x20, 0xc0, 0xc7, 0xe0, 0x01, 0x1e, 0xe4, 0x63,
-  0x42, 0x00, 0x9f, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 0x48, 0xe8, 0x04,
-  0x4c, 0x02, 0x0b, 0x7e, 0x22, 0x3e, 0xc3, 0x11, 0x81, 0x7c, 0x10, 0xdf,
-  0x70, 0x84, 0x20, 0x1f, 0xc4, 0x37, 0xdd, 0xc0, 0x26, 0x66, 0x12, 0x4c,
-  0x37, 0xb0, 0x49, 0x30, 0x6c, 0xe4, 0x70, 0x1e, 0x6d, 0x12, 0x50, 0x30,
-  0x18, 0x1b, 0x39, 0xa8, 0xc7, 0x9b, 0x0c, 0x14, 0x0c, 0xc6, 0x46, 0x0e,
-  0xea, 0x11, 0x27, 0x05, 0x05, 0x83, 0x31, 0x62, 0x70, 0x00, 0x20, 0x08,
-  0x06, 0x53, 0x9f, 0x88, 0x88, 0x7d, 0xf8, 0xc7, 0x88, 0x41, 0x03, 0x80,
-  0x20, 0x18, 0x9c, 0x81, 0x9d, 0xe4, 0xc8, 0x7d, 0x04, 0x74, 0x02, 0x1f,
-  0x3d, 0xd2, 0x23, 0x3d, 0xf2, 0x1f, 0x23, 0x06, 0x0d, 0x00, 0x82, 0x60,
-  0x70, 0x06, 0x76, 0x92, 0x23, 0xf7, 0x11, 0xa8, 0x89, 0xd1, 0x23, 0x3d,
-  0xd2, 0x23, 0xff, 0x31, 0x62, 0xd0, 0x00, 0x20, 0x08, 0x06, 0x67, 0x60,
-  0x27, 0x39, 0x72, 0x1f, 0x01, 0x9b, 0xd4, 0x49, 0x8f, 0xf4, 0x48, 0x8f,
-  0xfc, 0xc7, 0x88, 0x41, 0x03, 0x80, 0x20, 0x18, 0x9c, 0x81, 0x9d, 0xe4,
-  0xc8, 0x7d, 0x04, 0x72, 0x42, 0xf4, 0x48, 0x8f, 0xf4, 0xc8, 0x7f, 0x8c,
-  0x18, 0x34, 0x00, 0x08, 0x82, 0xc1, 0x19, 0xd8, 0x49, 0x8e, 0xdc, 0x47,
-  0x60, 0x23, 0x42, 0x8f, 0xf4, 0x48, 0x8f, 0xfc, 0xc7, 0x88, 0x41, 0x03,
-  0x80, 0x20, 0x18, 0x9c, 0x81, 0x9d, 0xe4, 0xc8, 0x7d, 0x04, 0x34, 0x42,
-  0x27, 0x3d, 0xd2, 0x23, 0x3d, 0xf2, 0x1f, 0xb3, 0x04, 0x08, 0x06, 0xc4,
-  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x5b, 0x86, 0x10, 0x09,
-  0xf2, 0x60, 0xcb, 0x30, 0x22, 0x41, 0x1e, 0x6c, 0x19, 0x4a, 0x24, 0xc8,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
@@ -1,1239 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-; shader hash: 1f447675a360980464487cd86a46217f
-;
-; Pipeline Runtime Information: 
-;
-;
-;
-; Buffer Definitions:
-;
-; cbuffer depthHierarchySize
-; {
-;
-;   struct depthHierarchySize
-;   {
-;
-;       struct struct.Size
-;       {
-;
-;           uint2 size;                               ; Offset:    0
-;       
-;       } depthHierarchySize;                         ; Offset:    0
-;
-;   
-;   } depthHierarchySize;                             ; Offset:    0 Size:     8
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for staticObjectBuffer
-; {
-;
-;   struct struct.StaticObject
-;   {
-;
-;       struct struct.BoundingSphere
-;       {
-;
-;           float3 center;                            ; Offset:    0
-;           float radius;                             ; Offset:   12
-;       
-;       } boundingSphere;                             ; Offset:    0
-;
-;       struct struct.LOD
-;       {
-;
-;           uint startIndex;                          ; Offset:   16
-;           uint indexCount;                          ; Offset:   20
-;           uint vertexOffset;                        ; Offset:   24
-;       
-;       } lods[3];;                                   ; Offset:   16
-;
-;       struct struct.Material
-;       {
-;
-;           uint baseColorID;                         ; Offset:   52
-;           uint normalID;                            ; Offset:   56
-;           uint roughnessAOID;                       ; Offset:   60
-;           uint metallicID;                          ; Offset:   64
-;           uint heightID;                            ; Offset:   68
-;           uint specialID;                           ; Offset:   72
-;       
-;       } material;                                   ; Offset:   52
-;
-;       uint flags;                                   ; Offset:   76
-;   
-;   } $Element;                                       ; Offset:    0 Size:    80
-;
-; }
-;
-; Resource bind info for staticCommandBuffer
-; {
-;
-;   struct struct.StaticCommand
-;   {
-;
-;       uint objectID;                                ; Offset:    0
-;       struct struct.anon
-;       {
-;
-;           uint indexCountPerInstance;               ; Offset:    4
-;           uint instanceCount;                       ; Offset:    8
-;           uint startIndexLocation;                  ; Offset:   12
-;           int baseVertexLocation;                   ; Offset:   16
-;           uint startInstanceLocation;               ; Offset:   20
-;       
-;       } drawIndexed;                                ; Offset:    4
-;
-;   
-;   } $Element;                                       ; Offset:    0 Size:    24
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; depthHierarchySize                cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; depthHierarchySampler             sampler      NA          NA      S0             s0     1
-; staticObjectBuffer                texture  struct         r/o      T0             t0     1
-; depthHierarchy                    texture     f32          2d      T1             t1     1
-; staticCommandBuffer                   UAV  struct     r/w+cnt      U0             u0     1
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%"class.StructuredBuffer<StaticObject>" = type { %struct.StaticObject }
-%struct.StaticObject = type { %struct.BoundingSphere, [3 x %struct.LOD], %struct.Material, i32 }
-%struct.BoundingSphere = type { <3 x float>, float }
-%struct.LOD = type { i32, i32, i32 }
-%struct.Material = type { i32, i32, i32, i32, i32, i32 }
-%"class.Texture2D<float>" = type { float, %"class.Texture2D<float>::mips_type" }
-%"class.Texture2D<float>::mips_type" = type { i32 }
-%"class.AppendStructuredBuffer<StaticCommand>" = type { %struct.StaticCommand }
-%struct.StaticCommand = type { i32, %struct.anon }
-%struct.anon = type { i32, i32, i32, i32, i32 }
-%depthHierarchySize = type { %struct.Size }
-%struct.Size = type { <2 x i32> }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-%struct.SamplerState = type { i32 }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 1, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %5 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %6 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %7 = call i32 @dx.op.threadId.i32(i32 93, i32 0)  ; ThreadId(component)
-  %8 = alloca [3 x i32], align 4
-  %9 = alloca [3 x i32], align 4
-  %10 = alloca [3 x i32], align 4
-  %11 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 0)  ; BufferLoad(srv,index,wot)
-  %12 = extractvalue %dx.types.ResRet.f32 %11, 0
-  %13 = extractvalue %dx.types.ResRet.f32 %11, 1
-  %14 = extractvalue %dx.types.ResRet.f32 %11, 2
-  %15 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %3, i32 %7, i32 12)  ; BufferLoad(srv,index,wot)
-  %16 = extractvalue %dx.types.ResRet.f32 %15, 0
-  %17 = getelementptr [3 x i32], [3 x i32]* %8, i32 0, i32 0
-  %18 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 0
-  %19 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 0
-  %20 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 16)  ; BufferLoad(srv,index,wot)
-  %21 = extractvalue %dx.types.ResRet.i32 %20, 0
-  store i32 %21, i32* %17, align 4
-  %22 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 20)  ; BufferLoad(srv,index,wot)
-  %23 = extractvalue %dx.types.ResRet.i32 %22, 0
-  store i32 %23, i32* %18, align 4
-  %24 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 24)  ; BufferLoad(srv,index,wot)
-  %25 = extractvalue %dx.types.ResRet.i32 %24, 0
-  store i32 %25, i32* %19, align 4
-  %26 = getelementptr [3 x i32], [3 x i32]* %8, i32 0, i32 1
-  %27 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 1
-  %28 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 1
-  %29 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 28)  ; BufferLoad(srv,index,wot)
-  %30 = extractvalue %dx.types.ResRet.i32 %29, 0
-  store i32 %30, i32* %26, align 4
-  %31 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 32)  ; BufferLoad(srv,index,wot)
-  %32 = extractvalue %dx.types.ResRet.i32 %31, 0
-  store i32 %32, i32* %27, align 4
-  %33 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 36)  ; BufferLoad(srv,index,wot)
-  %34 = extractvalue %dx.types.ResRet.i32 %33, 0
-  store i32 %34, i32* %28, align 4
-  %35 = getelementptr [3 x i32], [3 x i32]* %8, i32 0, i32 2
-  %36 = getelementptr [3 x i32], [3 x i32]* %9, i32 0, i32 2
-  %37 = getelementptr [3 x i32], [3 x i32]* %10, i32 0, i32 2
-  %38 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 40)  ; BufferLoad(srv,index,wot)
-  %39 = extractvalue %dx.types.ResRet.i32 %38, 0
-  store i32 %39, i32* %35, align 4
-  %40 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 44)  ; BufferLoad(srv,index,wot)
-  %41 = extractvalue %dx.types.ResRet.i32 %40, 0
-  store i32 %41, i32* %36, align 4
-  %42 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 48)  ; BufferLoad(srv,index,wot)
-  %43 = extractvalue %dx.types.ResRet.i32 %42, 0
-  store i32 %43, i32* %37, align 4
-  %44 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %3, i32 %7, i32 76)  ; BufferLoad(srv,index,wot)
-  %45 = extractvalue %dx.types.ResRet.i32 %44, 0
-  %46 = and i32 %45, 1
-  %47 = icmp eq i32 %46, 0
-  br i1 %47, label %209, label %48
-
-; <label>:48                                      ; preds = %0
-  %49 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %50 = extractvalue %dx.types.CBufRet.f32 %49, 0
-  %51 = extractvalue %dx.types.CBufRet.f32 %49, 1
-  %52 = extractvalue %dx.types.CBufRet.f32 %49, 2
-  %53 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 1)  ; CBufferLoadLegacy(handle,regIndex)
-  %54 = extractvalue %dx.types.CBufRet.f32 %53, 0
-  %55 = extractvalue %dx.types.CBufRet.f32 %53, 1
-  %56 = extractvalue %dx.types.CBufRet.f32 %53, 2
-  %57 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 2)  ; CBufferLoadLegacy(handle,regIndex)
-  %58 = extractvalue %dx.types.CBufRet.f32 %57, 0
-  %59 = extractvalue %dx.types.CBufRet.f32 %57, 1
-  %60 = extractvalue %dx.types.CBufRet.f32 %57, 2
-  %61 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 3)  ; CBufferLoadLegacy(handle,regIndex)
-  %62 = extractvalue %dx.types.CBufRet.f32 %61, 0
-  %63 = extractvalue %dx.types.CBufRet.f32 %61, 1
-  %64 = extractvalue %dx.types.CBufRet.f32 %61, 2
-  %65 = fmul fast float %50, %12
-  %66 = call float @dx.op.tertiary.f32(i32 46, float %54, float %13, float %65)  ; FMad(a,b,c)
-  %67 = call float @dx.op.tertiary.f32(i32 46, float %58, float %14, float %66)  ; FMad(a,b,c)
-  %68 = fadd fast float %67, %62
-  %69 = fmul fast float %51, %12
-  %70 = call float @dx.op.tertiary.f32(i32 46, float %55, float %13, float %69)  ; FMad(a,b,c)
-  %71 = call float @dx.op.tertiary.f32(i32 46, float %59, float %14, float %70)  ; FMad(a,b,c)
-  %72 = fadd fast float %71, %63
-  %73 = fmul fast float %52, %12
-  %74 = call float @dx.op.tertiary.f32(i32 46, float %56, float %13, float %73)  ; FMad(a,b,c)
-  %75 = call float @dx.op.tertiary.f32(i32 46, float %60, float %14, float %74)  ; FMad(a,b,c)
-  %76 = fadd fast float %75, %64
-  %77 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %78 = extractvalue %dx.types.CBufRet.f32 %77, 1
-  %79 = extractvalue %dx.types.CBufRet.f32 %77, 0
-  %80 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 17)  ; CBufferLoadLegacy(handle,regIndex)
-  %81 = extractvalue %dx.types.CBufRet.f32 %80, 3
-  %82 = extractvalue %dx.types.CBufRet.f32 %80, 2
-  %83 = extractvalue %dx.types.CBufRet.f32 %80, 1
-  %84 = extractvalue %dx.types.CBufRet.f32 %80, 0
-  %85 = call float @dx.op.unary.f32(i32 6, float %68)  ; FAbs(value)
-  %86 = call float @dx.op.unary.f32(i32 6, float %72)  ; FAbs(value)
-  %87 = call float @dx.op.dot3.f32(i32 55, float %84, float 0.000000e+00, float %83, float %85, float %86, float %76)  ; Dot3(ax,ay,az,bx,by,bz)
-  %88 = fsub fast float -0.000000e+00, %16
-  %89 = fcmp fast oge float %87, %88
-  %90 = call float @dx.op.dot3.f32(i32 55, float 0.000000e+00, float %82, float %81, float %85, float %86, float %76)  ; Dot3(ax,ay,az,bx,by,bz)
-  %91 = fcmp fast oge float %90, %88
-  %92 = and i1 %89, %91
-  %93 = fsub fast float %76, %16
-  %94 = fcmp fast ole float %93, %79
-  %95 = and i1 %94, %92
-  %96 = fadd fast float %76, %16
-  %97 = fcmp fast oge float %96, %78
-  %98 = and i1 %97, %95
-  %99 = zext i1 %98 to i32
-  br i1 %98, label %100, label %209
-
-; <label>:100                                     ; preds = %48
-  %101 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 4)  ; CBufferLoadLegacy(handle,regIndex)
-  %102 = extractvalue %dx.types.CBufRet.f32 %101, 0
-  %103 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 5)  ; CBufferLoadLegacy(handle,regIndex)
-  %104 = extractvalue %dx.types.CBufRet.f32 %103, 1
-  %105 = fcmp fast ult float %96, %79
-  br i1 %105, label %106, label %140
-
-; <label>:106                                     ; preds = %100
-  %107 = call float @dx.op.dot2.f32(i32 54, float %68, float %76, float %68, float %76)  ; Dot2(ax,ay,bx,by)
-  %108 = fmul fast float %16, %16
-  %109 = fsub fast float %107, %108
-  %110 = call float @dx.op.unary.f32(i32 24, float %109)  ; Sqrt(value)
-  %111 = fmul fast float %110, %68
-  %112 = call float @dx.op.tertiary.f32(i32 46, float %16, float %76, float %111)  ; FMad(a,b,c)
-  %113 = fmul fast float %16, %68
-  %114 = fsub fast float -0.000000e+00, %113
-  %115 = call float @dx.op.tertiary.f32(i32 46, float %110, float %76, float %114)  ; FMad(a,b,c)
-  %116 = call float @dx.op.tertiary.f32(i32 46, float %88, float %76, float %111)  ; FMad(a,b,c)
-  %117 = call float @dx.op.tertiary.f32(i32 46, float %110, float %76, float %113)  ; FMad(a,b,c)
-  %118 = call float @dx.op.dot2.f32(i32 54, float %72, float %76, float %72, float %76)  ; Dot2(ax,ay,bx,by)
-  %119 = fsub fast float %118, %108
-  %120 = call float @dx.op.unary.f32(i32 24, float %119)  ; Sqrt(value)
-  %121 = fmul fast float %120, %72
-  %122 = call float @dx.op.tertiary.f32(i32 46, float %16, float %76, float %121)  ; FMad(a,b,c)
-  %123 = fmul fast float %16, %72
-  %124 = fsub fast float -0.000000e+00, %123
-  %125 = call float @dx.op.tertiary.f32(i32 46, float %120, float %76, float %124)  ; FMad(a,b,c)
-  %126 = call float @dx.op.tertiary.f32(i32 46, float %88, float %76, float %121)  ; FMad(a,b,c)
-  %127 = call float @dx.op.tertiary.f32(i32 46, float %120, float %76, float %123)  ; FMad(a,b,c)
-  %128 = fmul fast float %112, %102
-  %129 = fsub fast float -0.000000e+00, %115
-  %130 = fdiv fast float %128, %129
-  %131 = fmul fast float %116, %102
-  %132 = fsub fast float -0.000000e+00, %117
-  %133 = fdiv fast float %131, %132
-  %134 = fmul fast float %122, %104
-  %135 = fsub fast float -0.000000e+00, %125
-  %136 = fdiv fast float %134, %135
-  %137 = fmul fast float %126, %104
-  %138 = fsub fast float -0.000000e+00, %127
-  %139 = fdiv fast float %137, %138
-  br label %140
-
-; <label>:140                                     ; preds = %106, %100
-  %141 = phi i1 [ true, %106 ], [ false, %100 ]
-  %142 = phi float [ %130, %106 ], [ undef, %100 ]
-  %143 = phi float [ %136, %106 ], [ undef, %100 ]
-  %144 = phi float [ %133, %106 ], [ undef, %100 ]
-  %145 = phi float [ %139, %106 ], [ undef, %100 ]
-  br i1 %141, label %146, label %187
-
-; <label>:146                                     ; preds = %140
-  %147 = fmul fast float %142, 5.000000e-01
-  %148 = fmul fast float %143, 5.000000e-01
-  %149 = fmul fast float %144, 5.000000e-01
-  %150 = fmul fast float %145, 5.000000e-01
-  %151 = fadd fast float %147, 5.000000e-01
-  %152 = fsub fast float 5.000000e-01, %148
-  %153 = fadd fast float %149, 5.000000e-01
-  %154 = fsub fast float 5.000000e-01, %150
-  %155 = call float @dx.op.unary.f32(i32 7, float %151)  ; Saturate(value)
-  %156 = call float @dx.op.unary.f32(i32 7, float %152)  ; Saturate(value)
-  %157 = call float @dx.op.unary.f32(i32 7, float %153)  ; Saturate(value)
-  %158 = call float @dx.op.unary.f32(i32 7, float %154)  ; Saturate(value)
-  %159 = fsub fast float %157, %155
-  %160 = fsub fast float %158, %156
-  %161 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %6, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %162 = extractvalue %dx.types.CBufRet.i32 %161, 0
-  %163 = extractvalue %dx.types.CBufRet.i32 %161, 1
-  %164 = uitofp i32 %162 to float
-  %165 = uitofp i32 %163 to float
-  %166 = fmul fast float %164, %159
-  %167 = fmul fast float %165, %160
-  %168 = call float @dx.op.binary.f32(i32 35, float %166, float %167)  ; FMax(a,b)
-  %169 = call float @dx.op.unary.f32(i32 23, float %168)  ; Log(value)
-  %170 = call float @dx.op.unary.f32(i32 28, float %169)  ; Round_pi(value)
-  %171 = fadd fast float %157, %155
-  %172 = fadd fast float %158, %156
-  %173 = fmul fast float %171, 5.000000e-01
-  %174 = fmul fast float %172, 5.000000e-01
-  %175 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %2, %dx.types.Handle %4, float %173, float %174, float undef, float undef, i32 0, i32 0, i32 undef, float %170)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %176 = extractvalue %dx.types.ResRet.f32 %175, 0
-  %177 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %178 = extractvalue %dx.types.CBufRet.f32 %177, 2
-  %179 = fsub fast float -0.000000e+00, %178
-  %180 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %5, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %181 = extractvalue %dx.types.CBufRet.f32 %180, 2
-  %182 = fdiv fast float %181, %96
-  %183 = fsub fast float %179, %182
-  %184 = fadd fast float %176, 0x3EE4F8B580000000
-  %185 = fcmp fast ole float %183, %184
-  %186 = zext i1 %185 to i32
-  br label %187
-
-; <label>:187                                     ; preds = %146, %140
-  %188 = phi i32 [ %186, %146 ], [ %99, %140 ]
-  %189 = icmp eq i32 %188, 0
-  br i1 %189, label %209, label %190
-
-; <label>:190                                     ; preds = %187
-  %191 = fmul fast float %68, %68
-  %192 = fmul fast float %72, %72
-  %193 = fadd fast float %192, %191
-  %194 = fmul fast float %76, %76
-  %195 = fadd fast float %193, %194
-  %196 = call float @dx.op.unary.f32(i32 24, float %195)  ; Sqrt(value)
-  %197 = fsub fast float %196, %16
-  %198 = fcmp fast olt float %197, 5.000000e+00
-  %199 = fcmp fast olt float %197, 1.000000e+01
-  %200 = select i1 %199, i32 1, i32 2
-  %201 = select i1 %198, i32 0, i32 %200
-  %202 = getelementptr inbounds [3 x i32], [3 x i32]* %9, i32 0, i32 %201
-  %203 = load i32, i32* %202, align 4, !tbaa !21
-  %204 = getelementptr inbounds [3 x i32], [3 x i32]* %8, i32 0, i32 %201
-  %205 = load i32, i32* %204, align 4, !tbaa !21
-  %206 = getelementptr inbounds [3 x i32], [3 x i32]* %10, i32 0, i32 %201
-  %207 = load i32, i32* %206, align 4, !tbaa !21
-  %208 = call i32 @dx.op.bufferUpdateCounter(i32 70, %dx.types.Handle %1, i8 1)  ; BufferUpdateCounter(uav,inc)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %208, i32 0, i32 %7, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %208, i32 4, i32 %203, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %208, i32 8, i32 1, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %208, i32 12, i32 %205, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %208, i32 16, i32 %207, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %208, i32 20, i32 0, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  br label %209
-
-; <label>:209                                     ; preds = %190, %187, %48, %0
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.threadId.i32(i32, i32) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32, float) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.binary.f32(i32, float, float) #0
-
-; Function Attrs: nounwind
-declare i32 @dx.op.bufferUpdateCounter(i32, %dx.types.Handle, i8) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot3.f32(i32, float, float, float, float, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot2.f32(i32, float, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind
-declare void @dx.op.bufferStore.i32(i32, %dx.types.Handle, i32, i32, i32, i32, i32, i32, i8) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind readonly }
-attributes #2 = { nounwind }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.entryPoints = !{!18}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"cs", i32 6, i32 0}
-!4 = !{!5, !10, !13, !16}
-!5 = !{!6, !8}
-!6 = !{i32 0, %"class.StructuredBuffer<StaticObject>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 80}
-!8 = !{i32 1, %"class.Texture2D<float>"* undef, !"", i32 0, i32 1, i32 1, i32 2, i32 0, !9}
-!9 = !{i32 0, i32 9}
-!10 = !{!11}
-!11 = !{i32 0, %"class.AppendStructuredBuffer<StaticCommand>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i1 false, i1 true, i1 false, !12}
-!12 = !{i32 1, i32 24}
-!13 = !{!14, !15}
-!14 = !{i32 0, %depthHierarchySize* undef, !"", i32 0, i32 0, i32 1, i32 8, null}
-!15 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!16 = !{!17}
-!17 = !{i32 0, %struct.SamplerState* undef, !"", i32 0, i32 0, i32 1, i32 0, null}
-!18 = !{void ()* @main, !"main", null, !4, !19}
-!19 = !{i32 0, i64 16, i32 4, !20}
-!20 = !{i32 128, i32 1, i32 1}
-!21 = !{!22, !22, i64 0}
-!22 = !{!"int", !23, i64 0}
-!23 = !{!"omnipotent char", !24, i64 0}
-!24 = !{!"Simple C/C++ TBAA"}
-
-#endif
-
-const unsigned char RINShaderBytesCullStaticCS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x8e, 0x03, 0xdd, 0xe7, 0xe1, 0x30, 0x51, 0x6a,
-  0xe5, 0x12, 0xbb, 0xc0, 0x60, 0x79, 0x51, 0x2a, 0x01, 0x00, 0x00, 0x00,
-  0xc4, 0x22, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0x14, 0x01, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x80, 0x12, 0x00, 0x00,
-  0x9c, 0x12, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x4f, 0x53, 0x47, 0x31, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x50, 0x53, 0x56, 0x30, 0x9c, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x52, 0x54, 0x53, 0x30, 0xec, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0x94, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x53, 0x54, 0x41, 0x54, 0x70, 0x10, 0x00, 0x00,
-  0x60, 0x00, 0x05, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c,
-  0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x10, 0x00, 0x00,
-  0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00,
-  0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39,
-  0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62,
-  0x80, 0x1c, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14,
-  0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20,
-  0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90,
-  0x91, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a,
-  0x04, 0x39, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d,
-  0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x01, 0xd5, 0x06, 0x62,
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x00, 0x49, 0x18, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
-  0x32, 0x22, 0xc8, 0x09, 0x20, 0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84,
-  0x04, 0x93, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c,
-  0x0b, 0x84, 0xe4, 0x4c, 0x10, 0xa0, 0xc2, 0x0c, 0xc0, 0x30, 0xc2, 0x00,
-  0x5c, 0x25, 0x4d, 0x11, 0x25, 0x4c, 0xfe, 0xe6, 0x50, 0xcd, 0x80, 0x34,
-  0x06, 0xfb, 0x1c, 0x44, 0x44, 0x20, 0x21, 0x00, 0x98, 0x23, 0x00, 0x83,
-  0x53, 0xa4, 0x29, 0xa2, 0x84, 0xc9, 0x2f, 0xd1, 0x0e, 0x0d, 0x83, 0xc1,
-  0x20, 0x07, 0x08, 0xf7, 0x48, 0x53, 0x44, 0x09, 0x93, 0x6f, 0x02, 0x13,
-  0x11, 0x21, 0xc0, 0x82, 0x8c, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x6e, 0x92,
-  0xa6, 0x88, 0x12, 0x26, 0x9f, 0x9d, 0x80, 0x09, 0x11, 0xd0, 0x20, 0x21,
-  0x84, 0x09, 0x11, 0x82, 0x82, 0x61, 0x30, 0x13, 0x19, 0x8c, 0x03, 0x3b,
-  0x84, 0xc3, 0x3c, 0xcc, 0x83, 0x1b, 0xcc, 0x02, 0x3d, 0xc8, 0x43, 0x3d,
-  0x8c, 0x03, 0x3d, 0xd4, 0x83, 0x3c, 0x94, 0x03, 0x39, 0x88, 0x42, 0x3d,
-  0x98, 0x83, 0x39, 0x94, 0x83, 0x3c, 0xf0, 0xc1, 0x2c, 0xd0, 0x43, 0x38,
-  0xd0, 0x43, 0x3a, 0x8c, 0xc3, 0x2b, 0x88, 0x83, 0x3a, 0x94, 0xc3, 0x38,
-  0xd0, 0x83, 0x1f, 0xa0, 0xe0, 0x40, 0x88, 0x5b, 0xa4, 0x29, 0xa2, 0x84,
-  0xc9, 0x07, 0x1a, 0xa7, 0x41, 0xc5, 0x60, 0x30, 0x18, 0x0c, 0x8e, 0x92,
-  0xa6, 0x88, 0x12, 0x26, 0x9f, 0x9d, 0x80, 0x09, 0x11, 0x38, 0x87, 0x61,
-  0x80, 0x66, 0x40, 0xc2, 0x40, 0x31, 0xd3, 0x1a, 0x8c, 0x03, 0x3b, 0x84,
-  0xc3, 0x3c, 0xcc, 0x83, 0x1b, 0x84, 0x02, 0x3c, 0xc0, 0x43, 0x39, 0xb8,
-  0x03, 0x39, 0xcc, 0x02, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xd4,
-  0x83, 0x3c, 0x94, 0x03, 0x39, 0x88, 0x42, 0x3d, 0x98, 0x83, 0x39, 0x94,
-  0x83, 0x3c, 0xf0, 0xc1, 0x2c, 0xd0, 0x43, 0x38, 0xd0, 0x43, 0x3a, 0x8c,
-  0xc3, 0x28, 0xbc, 0x43, 0x3b, 0xb4, 0x43, 0x38, 0xb8, 0x03, 0x39, 0xf8,
-  0x01, 0x0a, 0x16, 0xc4, 0x98, 0x29, 0x0c, 0xc6, 0x81, 0x1d, 0xc2, 0x61,
-  0x1e, 0xe6, 0xc1, 0x0d, 0x68, 0xa1, 0x1c, 0xf0, 0x81, 0x1e, 0xea, 0x41,
-  0x1e, 0xca, 0x41, 0x0e, 0x48, 0x81, 0x0f, 0xcc, 0x81, 0x1d, 0xde, 0x21,
-  0x1c, 0xe8, 0xc1, 0x0f, 0xf4, 0x40, 0x0f, 0xda, 0x21, 0x1d, 0xe0, 0x61,
-  0x1e, 0x7e, 0x81, 0x1e, 0xf2, 0x01, 0x1e, 0xca, 0x01, 0x05, 0x83, 0x99,
-  0xac, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70, 0x03, 0x5a, 0x28,
-  0x07, 0x7c, 0xa0, 0x87, 0x7a, 0x90, 0x87, 0x72, 0x90, 0x03, 0x52, 0xe0,
-  0x03, 0x73, 0x60, 0x87, 0x77, 0x08, 0x07, 0x7a, 0xf0, 0x03, 0x24, 0x00,
-  0x1c, 0xf4, 0xb8, 0x49, 0x9a, 0x22, 0x4a, 0x98, 0x7c, 0x16, 0x60, 0x9e,
-  0x85, 0x88, 0xd8, 0x09, 0x98, 0x08, 0x14, 0x0c, 0x28, 0x32, 0x8c, 0x20,
-  0x0c, 0xb7, 0x48, 0x53, 0x44, 0x09, 0x93, 0xcf, 0x22, 0x19, 0x81, 0x82,
-  0xc9, 0x49, 0x03, 0xf1, 0x4c, 0x47, 0x88, 0x10, 0x11, 0x10, 0x09, 0x07,
-  0xc6, 0x22, 0x19, 0x81, 0x02, 0x0a, 0x55, 0x86, 0x11, 0x08, 0x20, 0x09,
-  0x2e, 0x17, 0x06, 0xc3, 0xe5, 0x03, 0x0b, 0x62, 0x34, 0x0c, 0xd1, 0x4c,
-  0xfe, 0x42, 0x18, 0x80, 0x80, 0xf9, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0x73,
-  0x00, 0x43, 0x44, 0x00, 0x72, 0x30, 0x18, 0x0c, 0x26, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x30, 0x18, 0x2e, 0x1f, 0x58, 0x10,
-  0xa3, 0x61, 0x88, 0x66, 0xf2, 0x17, 0xc2, 0x00, 0x04, 0xcc, 0x17, 0x00,
-  0x86, 0x88, 0x80, 0x8d, 0x2a, 0x0a, 0x22, 0x42, 0x41, 0x86, 0x34, 0x23,
-  0x00, 0x25, 0xe0, 0x50, 0xa7, 0x0c, 0x83, 0xc1, 0x80, 0x3e, 0x65, 0x00,
-  0x0c, 0x00, 0x14, 0xba, 0x69, 0xb8, 0xfc, 0x09, 0x7b, 0x08, 0xc9, 0x5f,
-  0x09, 0x69, 0x25, 0x26, 0xbf, 0xb8, 0x6d, 0x54, 0x00, 0x00, 0x00, 0xc0,
-  0x60, 0x8e, 0x00, 0x21, 0xd2, 0x3d, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 0x48,
-  0x7e, 0x08, 0x34, 0xc3, 0x42, 0xa0, 0xa0, 0x54, 0x98, 0xd1, 0xc0, 0x64,
-  0x02, 0x00, 0x00, 0x80, 0xc1, 0x60, 0x00, 0xa0, 0x53, 0x21, 0x00, 0x03,
-  0x00, 0x80, 0x52, 0x85, 0x18, 0x0c, 0x4c, 0x24, 0x5a, 0x15, 0x04, 0x30,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x5a, 0xc5, 0x00, 0x0c, 0x00, 0x00,
-  0x00, 0x80, 0x5e, 0x47, 0x0d, 0x97, 0x3f, 0x61, 0x0f, 0x21, 0xf9, 0xdc,
-  0x46, 0x15, 0x2b, 0x31, 0xf9, 0xc8, 0x6d, 0x23, 0x62, 0x30, 0x18, 0x0c,
-  0x0a, 0x11, 0x1b, 0x98, 0x06, 0x24, 0x3b, 0x6a, 0xb8, 0xfc, 0x09, 0x7b,
-  0x08, 0xc9, 0xe7, 0x36, 0xaa, 0x58, 0x89, 0xc9, 0x2f, 0x6e, 0x1b, 0x11,
-  0x00, 0x00, 0x00, 0x50, 0x08, 0xda, 0xc0, 0x34, 0xa0, 0x5a, 0x29, 0x00,
-  0x03, 0x00, 0x00, 0x40, 0xb7, 0x39, 0x82, 0xa0, 0x18, 0xa6, 0x01, 0x69,
-  0x30, 0xc8, 0x91, 0xee, 0xa6, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x7f,
-  0x25, 0xa4, 0x95, 0x98, 0x7c, 0xe4, 0xb6, 0x51, 0x31, 0x18, 0x0c, 0x06,
-  0x83, 0x52, 0xf0, 0x06, 0xa6, 0xc1, 0x80, 0x7a, 0xa5, 0x18, 0x0d, 0x4c,
-  0x83, 0x01, 0xfd, 0x8a, 0xc2, 0x19, 0x98, 0x06, 0x83, 0xc1, 0x60, 0x30,
-  0x20, 0x51, 0x70, 0x20, 0xe0, 0x2c, 0x61, 0x01, 0x24, 0xc9, 0x67, 0x80,
-  0x29, 0x42, 0x2e, 0xbf, 0x58, 0x1c, 0x60, 0xf2, 0x71, 0x1f, 0x47, 0x01,
-  0xe6, 0x1a, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x39, 0x80, 0x21, 0x22, 0x00,
-  0x39, 0x44, 0x22, 0x91, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1c, 0x23, 0x00, 0x0c, 0x11, 0x01, 0x1b, 0x55, 0x14, 0x44, 0x84,
-  0x82, 0xe2, 0x1c, 0x01, 0x28, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0,
-  0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0,
-  0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d,
-  0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74,
-  0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6,
-  0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78,
-  0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76,
-  0x40, 0x07, 0x3a, 0x0f, 0xa4, 0x90, 0x21, 0x23, 0x45, 0x44, 0x00, 0xa2,
-  0x01, 0x00, 0x93, 0x0d, 0x00, 0x98, 0x6f, 0x00, 0xc0, 0x8c, 0x03, 0x00,
-  0x66, 0x1d, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x86, 0x3c, 0x1d, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x3e, 0x20,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x84,
-  0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-  0x79, 0xce, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x86, 0x3c, 0x69, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x43, 0x9e, 0x35, 0x00, 0x02, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f, 0x1b, 0x00, 0x01, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0xe7, 0x0d, 0x80, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x23, 0x07,
-  0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4,
-  0xa9, 0x03, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x18, 0xf2, 0xdc, 0x01, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0c, 0x79, 0xf4, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x7d, 0x00, 0x04, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x9e, 0x3f, 0x00, 0x02, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f, 0x28, 0x00,
-  0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x16, 0x08,
-  0x2c, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x1c, 0x19, 0x11, 0x4c, 0x90,
-  0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x3a, 0x16, 0x08, 0xe5, 0x6a,
-  0x80, 0x06, 0x25, 0x30, 0x02, 0x50, 0x0c, 0x85, 0x51, 0xa0, 0x01, 0x45,
-  0x50, 0x12, 0x05, 0x53, 0x10, 0x05, 0x4e, 0x50, 0x06, 0xe5, 0x50, 0x0a,
-  0x85, 0x1b, 0x50, 0x20, 0x05, 0x18, 0x50, 0xb0, 0x01, 0x85, 0x50, 0x28,
-  0x85, 0x54, 0x80, 0x02, 0x05, 0x38, 0x50, 0x80, 0x04, 0x85, 0x49, 0x50,
-  0xa0, 0x04, 0x85, 0x4a, 0x50, 0xb0, 0x04, 0x85, 0x4b, 0x50, 0xc0, 0x04,
-  0x85, 0x4c, 0x50, 0xd0, 0x04, 0x85, 0x4d, 0x50, 0xa4, 0x01, 0x25, 0x3c,
-  0x40, 0xb9, 0x11, 0x00, 0x32, 0xcc, 0x00, 0xd0, 0x61, 0x06, 0x80, 0x10,
-  0x33, 0x00, 0x94, 0x98, 0x01, 0x20, 0xc5, 0x0c, 0x00, 0x2d, 0x66, 0x00,
-  0x88, 0x31, 0x03, 0x40, 0x8d, 0x19, 0x00, 0x72, 0xcc, 0x00, 0xd0, 0x63,
-  0x06, 0x80, 0x20, 0x33, 0x00, 0x24, 0x99, 0x01, 0x20, 0xca, 0x0c, 0x00,
-  0x55, 0x66, 0x00, 0xc8, 0x32, 0x03, 0x40, 0x99, 0x19, 0x00, 0xd2, 0xcc,
-  0x00, 0xd0, 0x66, 0x06, 0x80, 0x08, 0x33, 0x00, 0x24, 0x98, 0x01, 0xa0,
-  0xe2, 0x0c, 0x00, 0x19, 0x67, 0x00, 0x08, 0x30, 0x03, 0x00, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90,
-  0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1,
-  0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41,
-  0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a,
-  0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9,
-  0x10, 0x04, 0x13, 0x84, 0xe1, 0x9a, 0x20, 0x0c, 0xd8, 0x06, 0x61, 0x20,
-  0x36, 0x08, 0x04, 0x41, 0x61, 0x6c, 0x6e, 0x82, 0x30, 0x64, 0x1b, 0x86,
-  0x03, 0x21, 0x26, 0x08, 0x49, 0x1f, 0x50, 0x9a, 0xa3, 0x0b, 0xa3, 0x4b,
-  0x1b, 0x7b, 0x12, 0x53, 0x2b, 0x1b, 0xa3, 0x13, 0xaa, 0x33, 0x33, 0x2b,
-  0x93, 0x9b, 0x20, 0x0c, 0xda, 0x04, 0x61, 0xd8, 0x36, 0x08, 0x43, 0xb3,
-  0x21, 0x21, 0x94, 0x85, 0x20, 0x06, 0x86, 0x70, 0x26, 0x08, 0x10, 0x29,
-  0xd0, 0x21, 0x2b, 0x83, 0xa3, 0x43, 0x43, 0x4a, 0x2b, 0x93, 0x0b, 0x93,
-  0x1b, 0x43, 0xcb, 0x9b, 0x20, 0x0c, 0xdc, 0x04, 0x61, 0xe8, 0x36, 0x08,
-  0xc4, 0xb4, 0x21, 0x19, 0xa0, 0x88, 0x18, 0x06, 0x89, 0xa0, 0x36, 0x08,
-  0x4f, 0x35, 0x41, 0x68, 0x42, 0x81, 0xd3, 0x1c, 0x5d, 0x18, 0x5d, 0xda,
-  0xd8, 0xd0, 0x5b, 0x5b, 0x5b, 0x98, 0x1b, 0x99, 0x50, 0x9d, 0x99, 0x59,
-  0x99, 0xdc, 0x04, 0x21, 0x0f, 0xf2, 0x60, 0x82, 0x90, 0x07, 0xd6, 0x04,
-  0x61, 0xf0, 0x36, 0x08, 0xc3, 0xb6, 0x61, 0x21, 0x2e, 0x8c, 0x20, 0x06,
-  0x26, 0xd3, 0x32, 0x6e, 0x43, 0xd0, 0x4d, 0x10, 0x2c, 0x54, 0xa0, 0x44,
-  0x56, 0x06, 0x47, 0x87, 0x86, 0x94, 0x56, 0x26, 0x17, 0x26, 0x37, 0x86,
-  0x96, 0x37, 0x95, 0xa6, 0x57, 0x36, 0x41, 0x18, 0xbe, 0x0d, 0x08, 0xf1,
-  0x81, 0x01, 0x41, 0x0c, 0x61, 0x00, 0x4c, 0x10, 0xb6, 0x55, 0x20, 0x33,
-  0x16, 0xd6, 0x56, 0x26, 0x17, 0x26, 0x54, 0x67, 0x66, 0x56, 0x26, 0x37,
-  0x41, 0x18, 0xc0, 0x60, 0x03, 0x32, 0x8c, 0x01, 0x19, 0x10, 0xc3, 0x50,
-  0x06, 0xc0, 0x06, 0x41, 0x0c, 0xcc, 0x60, 0x82, 0x20, 0x95, 0x02, 0x2b,
-  0xb2, 0x32, 0x38, 0x3a, 0x34, 0xa4, 0xb4, 0x32, 0xb9, 0x30, 0xb9, 0x31,
-  0xb4, 0xbc, 0xa9, 0xb0, 0x36, 0x38, 0xb6, 0x32, 0xb9, 0x0d, 0x08, 0x81,
-  0x06, 0x69, 0x40, 0x10, 0x03, 0x01, 0x6c, 0x08, 0xd4, 0x60, 0x03, 0x61,
-  0x79, 0x67, 0xb0, 0x06, 0x13, 0x04, 0xca, 0x14, 0x48, 0xcc, 0xa5, 0xe9,
-  0x95, 0x4d, 0x10, 0x86, 0x30, 0x98, 0x20, 0x0c, 0x62, 0x30, 0x41, 0x18,
-  0xc6, 0x60, 0x83, 0x81, 0xb8, 0xc1, 0x1b, 0x10, 0x70, 0x10, 0x07, 0x1b,
-  0x84, 0x30, 0x90, 0x83, 0x09, 0x02, 0xc2, 0x07, 0x13, 0x84, 0x81, 0x0c,
-  0x18, 0xa0, 0x6d, 0x20, 0x10, 0x3b, 0x78, 0x03, 0x62, 0x82, 0x70, 0xec,
-  0xc1, 0x06, 0x81, 0xc0, 0x83, 0x0d, 0x41, 0x1e, 0x6c, 0x10, 0x08, 0x3d,
-  0xd8, 0x30, 0xd4, 0xc1, 0x1d, 0xec, 0x01, 0x1d, 0xb1, 0xb7, 0x3a, 0x37,
-  0xb2, 0x34, 0xb7, 0xb3, 0x29, 0x38, 0xb4, 0x32, 0xb9, 0xb2, 0x0d, 0x04,
-  0xd2, 0x07, 0x6f, 0x40, 0x90, 0x60, 0x7b, 0x23, 0x9b, 0x9b, 0x20, 0x0c,
-  0x65, 0xb0, 0x81, 0x40, 0xfe, 0xe0, 0x0d, 0x40, 0x81, 0x48, 0x5b, 0x18,
-  0x5d, 0x99, 0x5c, 0x5a, 0x18, 0xdb, 0x04, 0x61, 0x30, 0x83, 0x0d, 0x04,
-  0x22, 0x0a, 0x6f, 0x30, 0x0a, 0x2c, 0xcc, 0xd8, 0xc2, 0xce, 0xe6, 0x26,
-  0x08, 0xc3, 0x19, 0x6c, 0x30, 0x90, 0x52, 0x78, 0x03, 0x53, 0x80, 0x83,
-  0x38, 0xd8, 0x50, 0xd4, 0x81, 0x1f, 0x84, 0x02, 0x29, 0x9c, 0xc2, 0x04,
-  0x41, 0x68, 0x05, 0x1a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x1b, 0x0c,
-  0x44, 0x15, 0xde, 0x80, 0x80, 0x83, 0x89, 0x86, 0x5c, 0x18, 0x59, 0x5a,
-  0xdd, 0xdc, 0x06, 0x03, 0x61, 0x85, 0x37, 0x60, 0xe0, 0x60, 0xda, 0x30,
-  0x80, 0xc2, 0x2a, 0xb4, 0xc2, 0x04, 0x81, 0x60, 0x05, 0x2a, 0x73, 0x74,
-  0x61, 0x72, 0x74, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x1b, 0x0c, 0x04, 0x16,
-  0xde, 0x80, 0x80, 0x83, 0x38, 0xa0, 0x92, 0xe6, 0x46, 0x56, 0x86, 0x37,
-  0xf4, 0x56, 0xe7, 0x46, 0x37, 0x41, 0x18, 0xd0, 0x60, 0x83, 0x81, 0xc8,
-  0xc2, 0x1b, 0xcc, 0x02, 0x1c, 0xc4, 0x01, 0x19, 0xbb, 0x32, 0x39, 0xba,
-  0x32, 0xbc, 0x27, 0x33, 0xb3, 0xb9, 0x32, 0xba, 0x0d, 0x06, 0x52, 0x0b,
-  0x6f, 0x10, 0x06, 0x70, 0x10, 0x07, 0x1b, 0x08, 0x26, 0x16, 0x68, 0xc1,
-  0x16, 0x26, 0x08, 0x86, 0x1e, 0x70, 0x11, 0x0b, 0x9b, 0x2b, 0x1b, 0x7a,
-  0x63, 0x7b, 0x93, 0x4b, 0x22, 0xda, 0x60, 0x20, 0xb9, 0xf0, 0x06, 0x04,
-  0x1c, 0xc4, 0x01, 0x11, 0xb7, 0x37, 0xb9, 0xb6, 0x30, 0xb6, 0x24, 0xa2,
-  0x0d, 0x06, 0xb2, 0x0b, 0x6f, 0x30, 0x0b, 0x70, 0x10, 0x07, 0x6c, 0xe4,
-  0xde, 0xea, 0xce, 0xd0, 0xdc, 0xca, 0xe6, 0xe6, 0x82, 0x9e, 0x92, 0x88,
-  0x36, 0x18, 0x48, 0x2f, 0xbc, 0x41, 0x18, 0xc0, 0x41, 0x1c, 0x50, 0x69,
-  0x2b, 0xa3, 0x0b, 0x63, 0x63, 0x4b, 0x1b, 0x4b, 0x22, 0xda, 0x60, 0x20,
-  0xbf, 0xf0, 0x06, 0x0c, 0x1c, 0xc4, 0x01, 0x11, 0xb4, 0xb2, 0xb4, 0x33,
-  0x34, 0xba, 0x24, 0xa2, 0x0d, 0x06, 0x12, 0x0e, 0x6f, 0x00, 0x0a, 0x70,
-  0x10, 0x07, 0x4c, 0xe6, 0xe0, 0xca, 0xc6, 0xd2, 0xc2, 0xd8, 0x92, 0x88,
-  0x26, 0x08, 0x43, 0x1a, 0x6c, 0x30, 0x90, 0x71, 0x78, 0x03, 0x72, 0x80,
-  0x83, 0x38, 0xd8, 0x70, 0x6c, 0xba, 0xc0, 0x0b, 0xbe, 0x00, 0x0e, 0xe2,
-  0x50, 0x0e, 0x13, 0x04, 0x06, 0x14, 0x26, 0x08, 0x83, 0x1a, 0x4c, 0x10,
-  0x96, 0x3f, 0xd8, 0x20, 0x10, 0xe9, 0xb0, 0x21, 0x50, 0x87, 0x0d, 0x02,
-  0xb1, 0x0e, 0x1b, 0x06, 0x74, 0xb8, 0x03, 0x76, 0x20, 0xf2, 0x26, 0xa6,
-  0x56, 0x36, 0x46, 0x97, 0x44, 0xb4, 0xc1, 0x40, 0xdc, 0xe1, 0x0d, 0x08,
-  0x38, 0x88, 0x03, 0x2e, 0x64, 0x72, 0x61, 0x77, 0x49, 0x6e, 0x64, 0x65,
-  0x78, 0x65, 0x64, 0x1b, 0x08, 0x04, 0x1e, 0xde, 0x00, 0x14, 0x36, 0x0c,
-  0xe8, 0xf0, 0x0e, 0xf1, 0x30, 0x41, 0x50, 0xfc, 0x80, 0x55, 0x9a, 0x1b,
-  0x59, 0x19, 0xde, 0xd0, 0x5b, 0x9d, 0x1b, 0x1d, 0x54, 0x99, 0x5c, 0x92,
-  0xdb, 0x1c, 0x5d, 0x98, 0xdb, 0x58, 0xd9, 0x06, 0x03, 0xa1, 0x87, 0x37,
-  0x20, 0xe0, 0x20, 0x0e, 0xd8, 0xa4, 0xb9, 0xcd, 0xd1, 0x85, 0xb9, 0x8d,
-  0x95, 0x0d, 0xbd, 0xd5, 0xb9, 0xd1, 0x6d, 0x30, 0x10, 0x7b, 0x78, 0x83,
-  0x59, 0x80, 0x83, 0x38, 0xa0, 0x34, 0x47, 0x17, 0x26, 0x47, 0x97, 0xe4,
-  0x46, 0x56, 0x86, 0xc7, 0xf4, 0x36, 0x16, 0x46, 0x97, 0xf6, 0xe6, 0xb6,
-  0xc1, 0x40, 0xf0, 0xe1, 0x0d, 0xc2, 0x00, 0x0e, 0xe2, 0x80, 0x92, 0x58,
-  0xd8, 0x5c, 0x99, 0x55, 0x99, 0x1c, 0x5d, 0x19, 0x1e, 0xd3, 0xdb, 0x58,
-  0x18, 0x5d, 0xda, 0x9b, 0xdb, 0x06, 0x03, 0xd1, 0x87, 0x37, 0x60, 0xe0,
-  0x60, 0x16, 0x58, 0xcd, 0xd1, 0x85, 0xc9, 0xd1, 0x25, 0xb9, 0xcd, 0xd1,
-  0x85, 0xb9, 0x8d, 0x95, 0x31, 0xbd, 0x8d, 0x85, 0xd1, 0xa5, 0xbd, 0xb9,
-  0x6d, 0x30, 0x10, 0x7e, 0x78, 0x03, 0x50, 0x80, 0x83, 0x38, 0xd8, 0x60,
-  0x90, 0x43, 0x3d, 0xdc, 0x43, 0x3e, 0xec, 0x43, 0x3f, 0x4c, 0x10, 0x4a,
-  0xc1, 0x15, 0xa8, 0xd8, 0xa5, 0x95, 0xdd, 0x35, 0x85, 0xd1, 0xc9, 0xa5,
-  0xe1, 0x6d, 0x18, 0x66, 0x61, 0x16, 0xa4, 0x0d, 0x08, 0x02, 0x12, 0x52,
-  0x48, 0xbc, 0x01, 0x01, 0x07, 0x13, 0x15, 0x38, 0xb9, 0x37, 0xb5, 0xa6,
-  0x30, 0x3a, 0xb9, 0x34, 0xbc, 0x0d, 0x08, 0x32, 0x12, 0x52, 0x48, 0xbc,
-  0xc1, 0x28, 0xc0, 0xc1, 0xc4, 0x26, 0xcd, 0xcd, 0x0e, 0x4a, 0xee, 0x4d,
-  0xad, 0x29, 0x8c, 0x4e, 0x2e, 0x0d, 0x6f, 0x82, 0x30, 0xac, 0xc1, 0x06,
-  0x04, 0x29, 0x09, 0x29, 0x24, 0xde, 0xc0, 0x24, 0xe0, 0x60, 0xa2, 0x63,
-  0x97, 0x56, 0x76, 0x07, 0x25, 0xf7, 0xa6, 0xd6, 0x14, 0x46, 0x27, 0x97,
-  0x86, 0x37, 0x41, 0x18, 0xd8, 0x60, 0x03, 0x82, 0xa0, 0x84, 0x14, 0x12,
-  0x6f, 0x90, 0x12, 0x70, 0x30, 0x11, 0x81, 0x7b, 0x9b, 0x4b, 0xa3, 0x4b,
-  0x7b, 0x73, 0x9b, 0x20, 0x0c, 0x6d, 0xb0, 0xc1, 0x40, 0x56, 0xe2, 0x0d,
-  0x58, 0x02, 0x0e, 0x26, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67,
-  0x30, 0x13, 0x84, 0xc1, 0x0d, 0x36, 0x18, 0x88, 0x4b, 0xbc, 0xc1, 0x4b,
-  0xc0, 0xc1, 0xc4, 0xc4, 0x4c, 0xae, 0x6e, 0x8e, 0xae, 0xae, 0x0d, 0x0b,
-  0x6b, 0x82, 0x30, 0xbc, 0xc1, 0x06, 0x03, 0x89, 0x89, 0x37, 0x90, 0x09,
-  0x38, 0x98, 0x98, 0x98, 0xc9, 0xd5, 0xcd, 0xd1, 0xd5, 0xb5, 0x61, 0x69,
-  0x4d, 0x10, 0x06, 0x38, 0xd8, 0x60, 0x20, 0x34, 0xf1, 0x06, 0x35, 0x01,
-  0x07, 0x13, 0x13, 0x33, 0xb9, 0xba, 0x39, 0xba, 0xba, 0xb6, 0xac, 0xac,
-  0x09, 0xc2, 0x10, 0x07, 0x1b, 0x0c, 0xe4, 0x26, 0xde, 0x00, 0x27, 0xe0,
-  0x60, 0x62, 0x62, 0x26, 0x57, 0x37, 0x47, 0x57, 0xd7, 0x96, 0xa5, 0x35,
-  0x41, 0x18, 0xe4, 0x60, 0x83, 0x81, 0xe8, 0xc4, 0x1b, 0xec, 0x04, 0x1c,
-  0x4c, 0x2c, 0xdc, 0xca, 0xc2, 0xe4, 0xb4, 0x26, 0x08, 0xc3, 0x1c, 0x6c,
-  0x30, 0x90, 0x9e, 0x78, 0x03, 0x9f, 0x80, 0x83, 0x89, 0x84, 0x59, 0x98,
-  0x9c, 0xd6, 0x04, 0x61, 0xa0, 0x83, 0x0d, 0x06, 0x02, 0x16, 0x6f, 0x10,
-  0x16, 0x70, 0x30, 0x11, 0x1a, 0x63, 0xab, 0x9b, 0xa3, 0x2b, 0x93, 0x1b,
-  0x7a, 0x73, 0x9b, 0xa3, 0x0b, 0x73, 0xa3, 0x0b, 0x9a, 0x20, 0x0c, 0x75,
-  0xb0, 0xc1, 0x40, 0xc6, 0xe2, 0x0d, 0xc8, 0x02, 0x0e, 0x26, 0x42, 0x63,
-  0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x74, 0x42, 0x13, 0x84, 0xc1, 0x0e, 0x36, 0x18, 0x88, 0x59, 0xbc,
-  0xc1, 0x59, 0xc0, 0xc1, 0xb4, 0xe1, 0x29, 0x03, 0x91, 0x20, 0x89, 0x93,
-  0x50, 0x89, 0x96, 0x80, 0x89, 0x99, 0xb0, 0x89, 0x9c, 0xe0, 0x89, 0x9f,
-  0x10, 0x8b, 0xb2, 0x40, 0x8b, 0x09, 0xc2, 0x33, 0x0a, 0x1b, 0x0c, 0xc4,
-  0x0e, 0xde, 0x80, 0x80, 0x83, 0x89, 0x44, 0x5b, 0x1a, 0xdc, 0xdc, 0x06,
-  0x02, 0x61, 0x8b, 0x37, 0x00, 0x85, 0x09, 0x02, 0x00, 0x0b, 0x1b, 0x04,
-  0xc2, 0x2d, 0x36, 0x04, 0x6f, 0xb1, 0x41, 0x20, 0xe0, 0x62, 0x03, 0x41,
-  0x0e, 0x6b, 0xd1, 0x16, 0x71, 0x31, 0x41, 0x70, 0x44, 0x81, 0x06, 0x5a,
-  0x98, 0x1b, 0x19, 0x5b, 0xd9, 0x06, 0x03, 0xa1, 0x8b, 0x37, 0x20, 0xe0,
-  0x20, 0x0e, 0x36, 0x08, 0xb3, 0x50, 0x17, 0x13, 0x84, 0xea, 0x14, 0x36,
-  0x10, 0x08, 0x18, 0xbc, 0x01, 0xb1, 0x41, 0x08, 0x03, 0xbc, 0x98, 0x20,
-  0x98, 0xc2, 0x2b, 0x6c, 0x20, 0x10, 0x32, 0x78, 0x03, 0x62, 0x83, 0x50,
-  0x06, 0x7b, 0x31, 0x41, 0xc8, 0x52, 0x61, 0x82, 0xa0, 0xa9, 0xc2, 0x86,
-  0x30, 0x20, 0xda, 0x60, 0x0e, 0xe8, 0x80, 0x0f, 0xf0, 0x00, 0x15, 0x52,
-  0xc1, 0x15, 0x5e, 0xe1, 0x16, 0x70, 0xc1, 0x1c, 0xce, 0xa1, 0x1d, 0xd2,
-  0x41, 0x1e, 0xe6, 0xc1, 0x1f, 0xfe, 0x21, 0x2d, 0xd4, 0x42, 0x2e, 0xe6,
-  0xc2, 0x2e, 0xee, 0x22, 0x2f, 0xf4, 0x82, 0x2f, 0xfa, 0x22, 0x2d, 0xfc,
-  0x82, 0x2f, 0x26, 0x08, 0x9e, 0xb1, 0x01, 0xd8, 0x30, 0x10, 0xa1, 0x11,
-  0x1a, 0x1b, 0x02, 0xd1, 0xd8, 0x30, 0x0c, 0xa0, 0x31, 0x1a, 0x24, 0xda,
-  0xc2, 0xd2, 0xdc, 0x26, 0x08, 0xa7, 0x50, 0x6d, 0x18, 0x4c, 0x62, 0x18,
-  0x36, 0x10, 0x84, 0x69, 0xcc, 0xc2, 0x69, 0x6c, 0x28, 0x40, 0xa3, 0x34,
-  0x00, 0x36, 0x40, 0x0d, 0x46, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x73, 0x84, 0xc2,
-  0xe4, 0xe4, 0xc2, 0xf2, 0xbe, 0xd8, 0xde, 0xc6, 0xc2, 0xd8, 0xbe, 0xd8,
-  0xc8, 0xe6, 0xe8, 0x68, 0x84, 0xd1, 0xbd, 0xb5, 0xa5, 0x8d, 0x11, 0x11,
-  0x93, 0x0b, 0x73, 0x1b, 0x43, 0x2b, 0x9b, 0xa3, 0x61, 0xc6, 0xf6, 0x16,
-  0x46, 0x37, 0x37, 0x41, 0x18, 0xee, 0x80, 0x45, 0x9a, 0xdb, 0x1c, 0xdd,
-  0xdc, 0x04, 0x61, 0xc0, 0x03, 0x12, 0x69, 0x6e, 0x74, 0x73, 0x44, 0xe8,
-  0xca, 0xf0, 0xbe, 0xd8, 0xde, 0xc2, 0xc8, 0x88, 0xd0, 0x95, 0xe1, 0x7d,
-  0xb9, 0xbd, 0xc9, 0xb5, 0x31, 0xa1, 0x2b, 0xc3, 0xfb, 0x9a, 0xa3, 0x7b,
-  0x93, 0x2b, 0x63, 0x51, 0x97, 0xe6, 0x46, 0x37, 0xb7, 0xc1, 0x52, 0x0d,
-  0x74, 0x58, 0x0d, 0x86, 0x35, 0x86, 0xd6, 0x88, 0x03, 0xd7, 0x78, 0x0d,
-  0xd8, 0x88, 0x0d, 0xd9, 0x90, 0x66, 0x83, 0xa1, 0x8d, 0xa1, 0x36, 0x10,
-  0xdb, 0x40, 0xaa, 0xb0, 0xb1, 0xd9, 0xb5, 0xb9, 0xa4, 0x91, 0x95, 0xb9,
-  0xd1, 0x4d, 0x09, 0x82, 0x2a, 0x64, 0x78, 0x2e, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x53, 0x02, 0xa2, 0x09, 0x19, 0x9e, 0x8b, 0x5d, 0x18,
-  0x9b, 0x5d, 0x99, 0xdc, 0x94, 0xa0, 0xa8, 0x43, 0x86, 0xe7, 0x32, 0x87,
-  0x16, 0x46, 0x56, 0x26, 0xd7, 0xf4, 0x46, 0x56, 0xc6, 0x36, 0x25, 0x40,
-  0xca, 0x90, 0xe1, 0xb9, 0xc8, 0x95, 0xcd, 0xbd, 0xd5, 0xc9, 0x8d, 0x95,
-  0xcd, 0x4d, 0x09, 0xd6, 0xa0, 0x12, 0x19, 0x9e, 0x0b, 0x5d, 0x1e, 0x5c,
-  0x59, 0x90, 0x9b, 0xdb, 0x1b, 0x5d, 0x18, 0x5d, 0xda, 0x9b, 0xdb, 0xdc,
-  0x14, 0xc1, 0x2f, 0x46, 0xa3, 0x0e, 0x19, 0x9e, 0x4b, 0x99, 0x1b, 0x9d,
-  0x5c, 0x1e, 0xd4, 0x5b, 0x9a, 0x1b, 0xdd, 0xdc, 0x94, 0x00, 0x35, 0xba,
-  0x90, 0xe1, 0xb9, 0x8c, 0xbd, 0xd5, 0xb9, 0xd1, 0x95, 0xc9, 0xcd, 0x4d,
-  0x09, 0x6c, 0x03, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73,
-  0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e,
-  0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30,
-  0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8,
-  0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b,
-  0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76,
-  0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e,
-  0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e,
-  0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61,
-  0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4,
-  0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76,
-  0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37,
-  0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76,
-  0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71,
-  0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e,
-  0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1,
-  0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61,
-  0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90,
-  0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8,
-  0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc,
-  0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4,
-  0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19,
-  0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06,
-  0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f,
-  0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00,
-  0x25, 0x40, 0x06, 0x81, 0x1f, 0xb9, 0x0c, 0xa7, 0xa3, 0x91, 0xe9, 0xb2,
-  0x3c, 0x2c, 0x1f, 0xa3, 0xf3, 0x40, 0xe0, 0xcc, 0xfa, 0x23, 0x51, 0xcb,
-  0x78, 0x7a, 0x5d, 0x5e, 0x96, 0x11, 0x81, 0x4d, 0x20, 0x30, 0x58, 0x03,
-  0x6a, 0x10, 0xf8, 0x91, 0xcb, 0x70, 0x3a, 0x1a, 0x99, 0x2e, 0xcb, 0xc3,
-  0xf2, 0x31, 0x3a, 0x3f, 0x0d, 0xb7, 0xe1, 0xec, 0xb2, 0x1c, 0x08, 0x9c,
-  0x55, 0xa7, 0xe1, 0x36, 0x9c, 0x5d, 0x96, 0x4f, 0xe9, 0x61, 0x7a, 0x19,
-  0x08, 0x0c, 0x56, 0x40, 0x29, 0x04, 0x7e, 0x73, 0x7a, 0x98, 0x9e, 0x1e,
-  0x0f, 0xdf, 0xed, 0x76, 0xd8, 0x4d, 0x16, 0xd6, 0xcd, 0xe6, 0xb2, 0x1c,
-  0x08, 0x9c, 0x59, 0x7f, 0xa4, 0x20, 0x1c, 0x5e, 0x76, 0x93, 0xa7, 0x74,
-  0x79, 0x7d, 0x4c, 0xaf, 0xcb, 0xcb, 0x64, 0x61, 0xdd, 0x6c, 0x2e, 0xcb,
-  0x81, 0xd5, 0x29, 0x3d, 0x4c, 0x4f, 0x8f, 0x87, 0xef, 0x76, 0x3b, 0xec,
-  0x26, 0x03, 0x81, 0x40, 0x60, 0xb0, 0x00, 0xfa, 0x20, 0xf0, 0x9b, 0xd3,
-  0xc3, 0xf4, 0xf4, 0xf8, 0x29, 0x56, 0x97, 0xc7, 0x74, 0x61, 0xdd, 0x6c,
-  0x2e, 0xcb, 0x81, 0xc0, 0x99, 0xf5, 0x47, 0x9a, 0xd2, 0xe5, 0xf5, 0x31,
-  0xbd, 0x2e, 0x2f, 0x93, 0x85, 0x75, 0xb3, 0xb9, 0x2c, 0x07, 0x56, 0xa7,
-  0xf4, 0x30, 0x3d, 0x3d, 0x7e, 0x8a, 0xd5, 0xe5, 0x31, 0x1d, 0x08, 0x04,
-  0x02, 0x83, 0x56, 0x30, 0x09, 0x00, 0x43, 0x44, 0xc0, 0x46, 0x15, 0x05,
-  0x11, 0xfd, 0x0b, 0x61, 0x00, 0x02, 0x66, 0x04, 0xd2, 0x40, 0x3c, 0xd3,
-  0x11, 0x22, 0x44, 0x04, 0x44, 0xc2, 0x81, 0xb1, 0x48, 0x46, 0x98, 0x02,
-  0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0xd2, 0x00, 0x11, 0xe6, 0x17, 0xb7,
-  0x6d, 0x13, 0xd4, 0x70, 0xf9, 0xce, 0xe3, 0x07, 0x54, 0x51, 0x10, 0x51,
-  0xe9, 0x00, 0x83, 0x5f, 0xdc, 0xb6, 0x49, 0x50, 0xc3, 0xe5, 0x3b, 0x8f,
-  0x1f, 0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x3e, 0x72, 0xdb, 0x46,
-  0x51, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x40, 0x15, 0x05, 0x11, 0xb1, 0x93,
-  0x13, 0x11, 0x3e, 0x72, 0xdb, 0xb6, 0x90, 0x0d, 0x97, 0xef, 0x3c, 0x7e,
-  0x40, 0x15, 0x05, 0x11, 0xb9, 0xcf, 0x00, 0x4c, 0x04, 0xe7, 0x50, 0xcd,
-  0x44, 0x44, 0xf6, 0xb0, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x50, 0x45,
-  0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25, 0x61, 0x00, 0x02, 0xe6, 0x17, 0xb7,
-  0x6d, 0x0e, 0xdb, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x01, 0x55, 0x14, 0x44,
-  0x54, 0x3a, 0xc0, 0x50, 0x12, 0x06, 0x20, 0x60, 0x3e, 0x72, 0xdb, 0x16,
-  0x21, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x11, 0xc0, 0x44, 0x84, 0x40,
-  0x33, 0x2c, 0x84, 0x35, 0x38, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x38, 0x93,
-  0xed, 0x17, 0xb7, 0x6d, 0x0c, 0xce, 0x70, 0xf9, 0xce, 0xe3, 0x0f, 0xce,
-  0x74, 0xfb, 0xc5, 0x6d, 0x5b, 0x42, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x12,
-  0xc0, 0x3c, 0x0b, 0x51, 0x12, 0x15, 0xb1, 0xf8, 0xc5, 0x6d, 0x1b, 0x84,
-  0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x13, 0x11, 0x4d, 0x08, 0x10, 0x61, 0x7e,
-  0x71, 0xdb, 0x76, 0x20, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0x74, 0x44, 0x04,
-  0x30, 0x88, 0x83, 0x8f, 0xdc, 0xb6, 0x21, 0x3c, 0xc3, 0xe5, 0x3b, 0x8f,
-  0x4f, 0x35, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x9b, 0x01, 0xc1, 0x00, 0x48,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x44, 0x76, 0x75,
-  0xa3, 0x60, 0x98, 0x04, 0x64, 0x48, 0x7c, 0xd8, 0x6a, 0x46, 0x21, 0x7f,
-  0x44, 0x58, 0x49, 0x4c, 0x20, 0x10, 0x00, 0x00, 0x60, 0x00, 0x05, 0x00,
-  0x08, 0x04, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde,
-  0x21, 0x0c, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91,
-  0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c,
-  0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x1c, 0x45, 0x02,
-  0x42, 0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b,
-  0x0a, 0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5,
-  0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x91, 0x23, 0xc4, 0x50,
-  0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x39, 0x46, 0x06,
-  0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff,
-  0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x86, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0x03, 0x20, 0x01, 0xd5, 0x06, 0x62, 0xf8, 0xff, 0xff, 0xff,
-  0xff, 0x01, 0x90, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x89, 0x20, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x32, 0x22, 0xc8, 0x09,
-  0x20, 0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84, 0x04, 0x93, 0x23, 0xe3,
-  0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c, 0x0b, 0x84, 0xe4, 0x4c,
-  0x10, 0xa4, 0xc2, 0x08, 0x40, 0x09, 0x00, 0x14, 0x98, 0x23, 0x00, 0x83,
-  0x32, 0x0c, 0x06, 0x03, 0x22, 0xcc, 0x00, 0x94, 0xc1, 0x30, 0x30, 0xd0,
-  0xe1, 0xa6, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x7f, 0x25, 0xa4, 0x95,
-  0x98, 0xfc, 0xe2, 0xb6, 0x51, 0x61, 0x30, 0x18, 0x0c, 0x83, 0x39, 0x02,
-  0x84, 0x14, 0xf7, 0x0c, 0x97, 0x3f, 0x61, 0x0f, 0x21, 0xf9, 0x21, 0xd0,
-  0x0c, 0x0b, 0x81, 0x82, 0x45, 0x61, 0x12, 0x03, 0x06, 0xc3, 0x60, 0x30,
-  0x18, 0x06, 0x83, 0x81, 0x81, 0x1a, 0x85, 0x30, 0x0c, 0x0c, 0x06, 0x7a,
-  0x14, 0x62, 0x30, 0x60, 0x28, 0x28, 0x52, 0x10, 0xc3, 0xc0, 0x60, 0x30,
-  0x18, 0x0c, 0x06, 0x9a, 0x14, 0xc3, 0x30, 0x30, 0x18, 0x0c, 0x06, 0xaa,
-  0x1c, 0x35, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4, 0x73, 0x1b, 0x55, 0xac,
-  0xc4, 0xe4, 0x23, 0xb7, 0x8d, 0x88, 0xc1, 0x60, 0x30, 0x28, 0xc4, 0x65,
-  0xc0, 0x18, 0x10, 0xe6, 0xa8, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x9f,
-  0xdb, 0xa8, 0x62, 0x25, 0x26, 0xbf, 0xb8, 0x6d, 0x44, 0x18, 0x0c, 0x06,
-  0x43, 0x21, 0x34, 0x03, 0xc6, 0x80, 0x36, 0xa5, 0x30, 0x0c, 0x0c, 0x06,
-  0x03, 0x75, 0xe6, 0x08, 0x82, 0x62, 0x30, 0x06, 0x8a, 0xc1, 0xe0, 0x43,
-  0xa0, 0x9b, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc, 0x95, 0x90, 0x56,
-  0x62, 0xf2, 0x91, 0xdb, 0x46, 0xc5, 0x60, 0x30, 0x18, 0x0c, 0x4a, 0x21,
-  0x1a, 0x30, 0x06, 0x03, 0x1a, 0x95, 0x22, 0x31, 0x60, 0x0c, 0x06, 0x54,
-  0x2a, 0x0a, 0x60, 0xc0, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x40, 0x41, 0xa7,
-  0x81, 0x80, 0x61, 0x84, 0xc1, 0xb8, 0x4a, 0x9a, 0x22, 0x4a, 0x98, 0xfc,
-  0xcd, 0xa1, 0x9a, 0x01, 0x69, 0x0c, 0xf6, 0x39, 0x88, 0x88, 0x40, 0x82,
-  0xca, 0x70, 0x8a, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x25, 0xda, 0xa1, 0x61,
-  0x30, 0x18, 0xe4, 0x00, 0xeb, 0x1e, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x4d,
-  0x60, 0x22, 0x22, 0x04, 0x58, 0x90, 0x31, 0x18, 0x0c, 0x06, 0x83, 0xc1,
-  0x4d, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0xb3, 0x13, 0x30, 0x21, 0x02, 0x1a,
-  0x24, 0x84, 0x30, 0x21, 0x62, 0xd5, 0x72, 0x0d, 0x66, 0x22, 0x83, 0x71,
-  0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70, 0x83, 0x59, 0xa0, 0x07, 0x79,
-  0xa8, 0x87, 0x71, 0xa0, 0x87, 0x7a, 0x90, 0x87, 0x72, 0x20, 0x07, 0x51,
-  0xa8, 0x07, 0x73, 0x30, 0x87, 0x72, 0x90, 0x07, 0x3e, 0x98, 0x05, 0x7a,
-  0x08, 0x07, 0x7a, 0x48, 0x87, 0x71, 0x78, 0x05, 0x71, 0x50, 0x87, 0x72,
-  0x18, 0x07, 0x7a, 0xf0, 0x03, 0x14, 0xbc, 0x08, 0x36, 0x53, 0x18, 0x8c,
-  0x03, 0x3b, 0x84, 0xc3, 0x3c, 0xcc, 0x83, 0x1b, 0xd0, 0x42, 0x39, 0xe0,
-  0x03, 0x3d, 0xd4, 0x83, 0x3c, 0x94, 0x83, 0x1c, 0x90, 0x02, 0x1f, 0x98,
-  0x03, 0x3b, 0xbc, 0x43, 0x38, 0xd0, 0x83, 0x1f, 0xe8, 0x81, 0x1e, 0xb4,
-  0x43, 0x3a, 0xc0, 0xc3, 0x3c, 0xfc, 0x02, 0x3d, 0xe4, 0x03, 0x3c, 0x94,
-  0x03, 0x0a, 0x06, 0x33, 0x59, 0xe3, 0xc0, 0x0e, 0xe1, 0x30, 0x0f, 0xf3,
-  0xe0, 0x06, 0xb4, 0x50, 0x0e, 0xf8, 0x40, 0x0f, 0xf5, 0x20, 0x0f, 0xe5,
-  0x20, 0x07, 0xa4, 0xc0, 0x07, 0xe6, 0xc0, 0x0e, 0xef, 0x10, 0x0e, 0xf4,
-  0xe0, 0x07, 0x48, 0x30, 0xc8, 0x68, 0x76, 0x8b, 0x34, 0x45, 0x94, 0x30,
-  0xf9, 0x40, 0xe3, 0x34, 0xa8, 0x18, 0x0c, 0x06, 0x83, 0xc1, 0x51, 0xd2,
-  0x14, 0x51, 0xc2, 0xe4, 0xb3, 0x13, 0x30, 0x21, 0x02, 0xe7, 0x30, 0x0c,
-  0xd0, 0x0c, 0x48, 0x18, 0xd4, 0x66, 0x5a, 0x83, 0x71, 0x60, 0x87, 0x70,
-  0x98, 0x87, 0x79, 0x70, 0x83, 0x50, 0x80, 0x07, 0x78, 0x28, 0x07, 0x77,
-  0x20, 0x87, 0x59, 0xa0, 0x07, 0x79, 0xa8, 0x87, 0x71, 0xa0, 0x87, 0x7a,
-  0x90, 0x87, 0x72, 0x20, 0x07, 0x51, 0xa8, 0x07, 0x73, 0x30, 0x87, 0x72,
-  0x90, 0x07, 0x3e, 0x98, 0x05, 0x7a, 0x08, 0x07, 0x7a, 0x48, 0x87, 0x71,
-  0x18, 0x85, 0x77, 0x68, 0x87, 0x76, 0x08, 0x07, 0x77, 0x20, 0x07, 0x3f,
-  0x40, 0x81, 0x8d, 0x6e, 0xc3, 0x08, 0xc2, 0x70, 0x8b, 0x34, 0x45, 0x94,
-  0x30, 0xf9, 0x2c, 0x92, 0x11, 0x28, 0xc8, 0x9d, 0x34, 0x10, 0xcf, 0x74,
-  0x84, 0x08, 0x11, 0x01, 0x91, 0x70, 0x60, 0x2c, 0x92, 0x11, 0x28, 0xd0,
-  0xd1, 0x6e, 0x18, 0x81, 0x30, 0x92, 0xa0, 0x77, 0x61, 0x30, 0x5c, 0x3e,
-  0xb0, 0x20, 0x46, 0xc3, 0x10, 0xcd, 0xe4, 0x2f, 0x84, 0x01, 0x08, 0x98,
-  0x2f, 0x4d, 0x11, 0x25, 0x4c, 0x3e, 0x07, 0x30, 0x44, 0x04, 0x20, 0xc7,
-  0xe7, 0xf3, 0xf9, 0x54, 0x06, 0x83, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x86,
-  0x03, 0x83, 0xe1, 0xf2, 0x81, 0x05, 0x31, 0x1a, 0x86, 0x68, 0x26, 0x7f,
-  0x21, 0x0c, 0x40, 0xc0, 0x7c, 0x01, 0x60, 0x88, 0x08, 0xd8, 0xa8, 0xa2,
-  0x20, 0x22, 0x14, 0xfc, 0x08, 0x78, 0x93, 0x34, 0x45, 0x94, 0x30, 0xf9,
-  0x2c, 0xc0, 0x3c, 0x0b, 0x11, 0xb1, 0x13, 0x30, 0x11, 0x28, 0x18, 0x90,
-  0x70, 0x8e, 0x00, 0x14, 0x72, 0x60, 0x40, 0x45, 0x1a, 0x4c, 0x01, 0x00,
-  0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79,
-  0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e,
-  0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07,
-  0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07,
-  0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x04, 0x10, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x0e, 0x20,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x34,
-  0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4,
-  0x79, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0xc8, 0x13, 0x01, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc0, 0x90, 0x67, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x21, 0x4f, 0x05, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x43, 0x1e, 0x0c, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x1b, 0x10, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x3a, 0x20, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x80, 0x01, 0x10, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0xc6, 0x00,
-  0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c,
-  0x65, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x43, 0x9e, 0x33, 0x00, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x2c, 0x10, 0x12, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18,
-  0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x1a,
-  0x94, 0xc0, 0x08, 0x40, 0x31, 0x14, 0x46, 0x81, 0x06, 0x14, 0x41, 0x49,
-  0x14, 0x4c, 0x41, 0x14, 0x38, 0x41, 0x21, 0x14, 0xa0, 0x00, 0x7d, 0x46,
-  0x00, 0x6a, 0x80, 0x88, 0x23, 0x00, 0x05, 0x42, 0xb8, 0x19, 0x00, 0xe2,
-  0xcd, 0x00, 0x50, 0x70, 0x06, 0x80, 0x86, 0x33, 0x00, 0x44, 0x9b, 0x01,
-  0xa0, 0xd8, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0x69, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44,
-  0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b,
-  0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b,
-  0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81,
-  0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x84,
-  0xe1, 0x99, 0x20, 0x0c, 0xd0, 0x06, 0x61, 0x20, 0x26, 0x08, 0x43, 0xb4,
-  0x41, 0x18, 0x0c, 0x0a, 0x63, 0x73, 0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08,
-  0x71, 0x40, 0x06, 0x04, 0x26, 0x08, 0x83, 0x34, 0x41, 0x18, 0xa6, 0x0d,
-  0xc2, 0xd0, 0x6c, 0x48, 0x08, 0x65, 0x21, 0x88, 0x81, 0x21, 0x9c, 0x09,
-  0x02, 0x1d, 0x8c, 0xc1, 0x04, 0x61, 0xa0, 0x26, 0x08, 0x43, 0xb5, 0x41,
-  0x20, 0xa4, 0x0d, 0xc9, 0x00, 0x2d, 0xc4, 0x30, 0x44, 0xc4, 0xb4, 0x41,
-  0x78, 0xa8, 0x09, 0x02, 0x1e, 0x7c, 0x13, 0x84, 0x6f, 0x9b, 0x20, 0x7c,
-  0xdc, 0x04, 0x61, 0xb0, 0x36, 0x08, 0x43, 0xb6, 0x61, 0x21, 0xac, 0x85,
-  0x20, 0x06, 0xe6, 0xc2, 0x2e, 0x6d, 0x43, 0xb0, 0x4d, 0x10, 0xf8, 0x00,
-  0x0c, 0x26, 0x08, 0xc3, 0xb5, 0x01, 0x21, 0xba, 0x85, 0x20, 0x06, 0x0f,
-  0x98, 0x20, 0x84, 0x42, 0x18, 0x4c, 0x10, 0x06, 0x6c, 0x03, 0x32, 0x80,
-  0xc1, 0x42, 0x0c, 0x43, 0x18, 0x00, 0x1b, 0x84, 0x4f, 0x0c, 0x26, 0x08,
-  0xa3, 0x20, 0x06, 0x1b, 0x10, 0x82, 0x0c, 0x16, 0x82, 0x18, 0x08, 0x60,
-  0x43, 0x50, 0x06, 0x1b, 0x88, 0x8a, 0x1b, 0x03, 0x33, 0x98, 0x20, 0x08,
-  0x00, 0x89, 0xb6, 0xb0, 0x34, 0xb7, 0x09, 0x02, 0x29, 0x78, 0x13, 0x84,
-  0x21, 0x9b, 0x20, 0x0c, 0xda, 0x86, 0x81, 0x0d, 0x86, 0x61, 0x03, 0x41,
-  0xa8, 0xc1, 0x1a, 0xb4, 0xc1, 0x86, 0x02, 0x0d, 0xd2, 0x00, 0x38, 0x03,
-  0x37, 0xe0, 0x90, 0xe6, 0x46, 0xc7, 0xe7, 0xad, 0xcd, 0x2d, 0x0d, 0xee,
-  0x8d, 0xae, 0xcc, 0x8d, 0x0e, 0x64, 0x0c, 0x2d, 0x4c, 0x8e, 0xd1, 0x54,
-  0x5a, 0x1b, 0x1c, 0x5b, 0x19, 0xc8, 0xd0, 0xcb, 0xd0, 0xca, 0x0a, 0x08,
-  0x95, 0x50, 0x50, 0xd0, 0x86, 0x40, 0x0e, 0x26, 0x08, 0xa4, 0xd0, 0x6d,
-  0x18, 0xe2, 0x60, 0x0e, 0xe8, 0x60, 0xc3, 0x00, 0x07, 0x75, 0x40, 0x07,
-  0x1b, 0x06, 0x3b, 0xb0, 0x03, 0x3a, 0xa8, 0xc2, 0xc6, 0x66, 0xd7, 0xe6,
-  0x92, 0x46, 0x56, 0xe6, 0x46, 0x37, 0x25, 0x08, 0xaa, 0x90, 0xe1, 0xb9,
-  0xd8, 0x95, 0xc9, 0xcd, 0xa5, 0xbd, 0xb9, 0x4d, 0x09, 0x88, 0x26, 0x64,
-  0x78, 0x2e, 0x76, 0x61, 0x6c, 0x76, 0x65, 0x72, 0x53, 0x02, 0xa3, 0x0e,
-  0x19, 0x9e, 0xcb, 0x1c, 0x5a, 0x18, 0x59, 0x99, 0x5c, 0xd3, 0x1b, 0x59,
-  0x19, 0xdb, 0x94, 0x00, 0x29, 0x43, 0x86, 0xe7, 0x22, 0x57, 0x36, 0xf7,
-  0x56, 0x27, 0x37, 0x56, 0x36, 0x37, 0x25, 0x30, 0x83, 0x3a, 0x64, 0x78,
-  0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x73,
-  0x53, 0x02, 0x37, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73,
-  0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e,
-  0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30,
-  0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8,
-  0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b,
-  0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76,
-  0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e,
-  0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e,
-  0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61,
-  0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4,
-  0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76,
-  0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37,
-  0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76,
-  0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71,
-  0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e,
-  0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1,
-  0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61,
-  0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90,
-  0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8,
-  0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc,
-  0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4,
-  0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19,
-  0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06,
-  0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f,
-  0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x80, 0x34, 0x40, 0x84, 0xf9,
-  0xc5, 0x6d, 0x5b, 0x03, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0x55, 0x14,
-  0x44, 0x54, 0x3a, 0xc0, 0xe0, 0x17, 0xb7, 0x6d, 0x0c, 0xd4, 0x70, 0xf9,
-  0xce, 0xe3, 0x07, 0x54, 0x51, 0x10, 0x51, 0xe9, 0x00, 0x83, 0x8f, 0xdc,
-  0xb6, 0x39, 0x54, 0xc3, 0xe5, 0x3b, 0x8f, 0x1f, 0x50, 0x45, 0x41, 0x44,
-  0xec, 0xe4, 0x44, 0x84, 0x8f, 0xdc, 0xb6, 0x15, 0x64, 0xc3, 0xe5, 0x3b,
-  0x8f, 0x1f, 0x50, 0x45, 0x41, 0x44, 0xee, 0x33, 0x00, 0x13, 0xc1, 0x39,
-  0x54, 0x33, 0x11, 0x91, 0x25, 0x6c, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x04,
-  0x54, 0x51, 0x10, 0x51, 0xe9, 0x00, 0x43, 0x49, 0x18, 0x80, 0x80, 0xf9,
-  0xc5, 0x6d, 0x1b, 0xc2, 0x36, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x40, 0x15,
-  0x05, 0x11, 0x95, 0x0e, 0x30, 0x94, 0x84, 0x01, 0x08, 0x98, 0x8f, 0xdc,
-  0xb6, 0x2d, 0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x44, 0x04, 0x30, 0x11,
-  0x21, 0xd0, 0x0c, 0x0b, 0x61, 0x07, 0xce, 0x70, 0xf9, 0xce, 0xe3, 0x0f,
-  0xce, 0x64, 0xfb, 0xc5, 0x6d, 0x9b, 0x81, 0x33, 0x5c, 0xbe, 0xf3, 0xf8,
-  0x83, 0x33, 0xdd, 0x7e, 0x71, 0xdb, 0x36, 0x50, 0x0d, 0x97, 0xef, 0x3c,
-  0xbe, 0x04, 0x30, 0xcf, 0x42, 0x94, 0x44, 0x45, 0x2c, 0x7e, 0x71, 0xdb,
-  0xa6, 0x20, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0x44, 0x44, 0x13, 0x02, 0x44,
-  0x98, 0x5f, 0xdc, 0xb6, 0x05, 0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x1d,
-  0x11, 0x01, 0x0c, 0xe2, 0xe0, 0x23, 0xb7, 0x6d, 0x02, 0xcf, 0x70, 0xf9,
-  0xce, 0xe3, 0x53, 0x0d, 0x10, 0x61, 0x7e, 0x71, 0xdb, 0x06, 0x40, 0x30,
-  0x00, 0xd2, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00,
-  0x13, 0x04, 0x49, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x34, 0x98, 0x01, 0x28, 0xae, 0x42, 0x0c, 0x28, 0xbb, 0x92, 0x2b, 0xc5,
-  0x80, 0x72, 0x28, 0x90, 0x42, 0x29, 0x9c, 0x72, 0x2b, 0xb6, 0xd2, 0x0d,
-  0x28, 0xa0, 0x42, 0x2a, 0xa8, 0xc2, 0x2a, 0xb0, 0xc2, 0x0c, 0x28, 0x83,
-  0x22, 0x29, 0x91, 0x52, 0x28, 0xa3, 0x72, 0x29, 0xbe, 0x62, 0x0c, 0x20,
-  0x45, 0x19, 0x14, 0xc1, 0x08, 0x40, 0x09, 0x90, 0x61, 0x8c, 0x80, 0x6d,
-  0xe3, 0x57, 0xde, 0xc6, 0x08, 0x40, 0x10, 0x04, 0x55, 0x30, 0x18, 0x23,
-  0x00, 0x41, 0x10, 0x94, 0xc1, 0x60, 0x04, 0x60, 0x06, 0x60, 0x8c, 0x00,
-  0x04, 0x41, 0x10, 0x04, 0x85, 0x31, 0x02, 0x10, 0x04, 0x41, 0xf8, 0x03,
-  0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x00, 0x06, 0xa0, 0x20, 0x06, 0xc8,
-  0x1e, 0xec, 0x01, 0x1c, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x01, 0x18,
-  0x84, 0xc2, 0x18, 0x28, 0x7d, 0xd0, 0x07, 0x71, 0x30, 0x62, 0x90, 0x00,
-  0x20, 0x08, 0x06, 0x60, 0x20, 0x0a, 0x64, 0xb0, 0xf4, 0x41, 0x1f, 0xc8,
-  0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x80, 0xc1, 0x28, 0x94, 0x81,
-  0xe3, 0x07, 0x7e, 0x30, 0x07, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x00,
-  0x06, 0xa4, 0x60, 0x06, 0x0e, 0x28, 0x80, 0x02, 0x1d, 0x8c, 0x18, 0x24,
-  0x00, 0x08, 0x82, 0x01, 0x18, 0x94, 0xc2, 0x19, 0x3c, 0xa0, 0x00, 0x0a,
-  0x75, 0x30, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06, 0x04, 0x2c, 0x80, 0x41,
-  0x28, 0xcc, 0x44, 0x94, 0xc2, 0xf0, 0x8c, 0xc2, 0x4c, 0x44, 0x29, 0x0c,
-  0xcf, 0x28, 0xcc, 0x44, 0x94, 0xc2, 0xf0, 0x8c, 0xc2, 0x88, 0x01, 0x02,
-  0x80, 0x20, 0x18, 0x94, 0x01, 0x2a, 0xb8, 0x01, 0x42, 0x94, 0xc2, 0x68,
-  0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x18, 0x20,
-  0x00, 0x08, 0x82, 0x41, 0x19, 0xb0, 0x82, 0x1c, 0x30, 0xc8, 0x29, 0x8c,
-  0x26, 0x04, 0xc0, 0x2a, 0x0e, 0xc9, 0x2a, 0xac, 0xc2, 0x2a, 0x0e, 0x09,
-  0x2b, 0xb0, 0xc2, 0x2a, 0x0e, 0x49, 0x2b, 0xb4, 0xc2, 0x88, 0x01, 0x02,
-  0x80, 0x20, 0x18, 0x8c, 0x81, 0x2c, 0xdc, 0x41, 0xd4, 0xc8, 0xc1, 0x68,
-  0x42, 0x00, 0x0c, 0x1b, 0x10, 0x45, 0x30, 0x00, 0x23, 0x06, 0x08, 0x00,
-  0x82, 0x60, 0x30, 0x06, 0xb4, 0x90, 0x07, 0xd3, 0x33, 0x07, 0xa3, 0x09,
-  0x01, 0x30, 0x6c, 0x40, 0x18, 0xc1, 0x00, 0x8c, 0x18, 0x20, 0x00, 0x08,
-  0x82, 0xc1, 0x18, 0xd8, 0xc2, 0x1e, 0x54, 0x11, 0x2b, 0x8c, 0x26, 0x04,
-  0xc0, 0xb0, 0x01, 0x71, 0x04, 0x03, 0xb0, 0x8a, 0x83, 0x44, 0x0b, 0xb5,
-  0xb0, 0x8a, 0x83, 0x54, 0x0b, 0xb6, 0xb0, 0x8a, 0x83, 0x64, 0x0b, 0xb7,
-  0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x63, 0xb0, 0x0b, 0xa0, 0xa0,
-  0x59, 0x79, 0x30, 0x9a, 0x10, 0x00, 0xc3, 0x06, 0x44, 0x11, 0x0c, 0xc0,
-  0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c, 0x41, 0x2f, 0x88, 0x02, 0x87,
-  0xdd, 0xc1, 0x68, 0x42, 0x00, 0x0c, 0x1b, 0x10, 0x46, 0x30, 0x00, 0x23,
-  0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0xbf, 0x40, 0x0a, 0x9e, 0x86,
-  0x07, 0xa3, 0x09, 0x01, 0x30, 0x6c, 0x40, 0x1c, 0xc1, 0x00, 0xac, 0xe2,
-  0xb0, 0xf5, 0x42, 0x2e, 0xac, 0xe2, 0xb0, 0xf9, 0x82, 0x2e, 0xac, 0xe2,
-  0xb0, 0xfd, 0xc2, 0x2e, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18,
-  0x90, 0x43, 0x2a, 0x8c, 0xc1, 0xc7, 0x07, 0xa3, 0x09, 0x01, 0x30, 0x6c,
-  0x40, 0x14, 0xc1, 0x00, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18,
-  0x98, 0xc3, 0x2a, 0x94, 0x41, 0x18, 0xf4, 0xc1, 0x68, 0x42, 0x00, 0x0c,
-  0x1b, 0x10, 0x46, 0x30, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30,
-  0x06, 0xe8, 0xd0, 0x0a, 0x67, 0x30, 0x06, 0x7e, 0x30, 0x9a, 0x10, 0x00,
-  0xc3, 0x06, 0xc4, 0x11, 0x0c, 0xc0, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18,
-  0x8c, 0x81, 0x3a, 0xbc, 0x42, 0x1a, 0x94, 0xc1, 0x1f, 0x8c, 0x26, 0x04,
-  0x40, 0x05, 0xe9, 0xa0, 0xc3, 0x0d, 0x41, 0x3a, 0x80, 0xc1, 0x2c, 0x03,
-  0x12, 0x04, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xb0, 0xc5, 0x83, 0x2c,
-  0xac, 0x81, 0x3a, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26,
-  0x0c, 0xc2, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x6c, 0xf5, 0x60, 0x0b,
-  0x6f, 0xf0, 0x0e, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09,
-  0x83, 0x30, 0x62, 0x70, 0x00, 0x20, 0x08, 0x06, 0x5b, 0x3e, 0xe8, 0xc2,
-  0x1c, 0xb8, 0xc3, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2,
-  0x20, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1, 0xd6, 0x0f, 0xbe, 0x70,
-  0x07, 0xae, 0x30, 0x9a, 0x10, 0x00, 0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30,
-  0x08, 0xf6, 0xd0, 0x81, 0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0xa0,
-  0x0b, 0x89, 0x72, 0x60, 0xe8, 0x20, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04,
-  0x83, 0x4e, 0x24, 0xcc, 0x21, 0xa1, 0x83, 0xc0, 0x02, 0x03, 0x3a, 0x26,
-  0xe1, 0x81, 0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0xa0, 0x2b, 0x89,
-  0x74, 0x78, 0xf0, 0x20, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0xce,
-  0x24, 0xd4, 0x81, 0xc1, 0x83, 0xc0, 0x82, 0x04, 0x3a, 0x56, 0xf1, 0x81,
-  0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0xa0, 0x4b, 0x89, 0x76, 0x90,
-  0xf8, 0x20, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0x4e, 0x25, 0xdc,
-  0xe1, 0xe1, 0x83, 0xc0, 0x02, 0x06, 0x3a, 0x23, 0x06, 0x07, 0x00, 0x82,
-  0x60, 0xb0, 0xb5, 0x84, 0x3b, 0x9c, 0x42, 0x2f, 0x8c, 0x26, 0x04, 0xc1,
-  0x68, 0x82, 0x00, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1, 0x06, 0x13,
-  0xf1, 0xa0, 0x0a, 0xbf, 0x30, 0x9a, 0x10, 0x0c, 0xa3, 0x09, 0x82, 0x30,
-  0x9a, 0x30, 0x04, 0xa3, 0x09, 0x04, 0x30, 0x62, 0x60, 0x00, 0x20, 0x08,
-  0x06, 0x07, 0x4f, 0xb4, 0x44, 0x34, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06,
-  0x47, 0x4f, 0xb8, 0x84, 0x33, 0x62, 0xb0, 0x00, 0x20, 0x08, 0x06, 0x93,
-  0x4e, 0xc4, 0xc3, 0x90, 0x0b, 0x84, 0x10, 0x2c, 0x86, 0x0b, 0xa7, 0x10,
-  0x9f, 0xe1, 0x08, 0x21, 0x18, 0xbe, 0x11, 0x83, 0x05, 0x00, 0x41, 0x30,
-  0x98, 0x7a, 0x82, 0x1e, 0x78, 0x01, 0x49, 0x0a, 0xc2, 0x19, 0x8e, 0x08,
-  0x86, 0xe1, 0xab, 0x21, 0x50, 0x8b, 0x58, 0x21, 0x3e, 0xc3, 0x11, 0xc1,
-  0x53, 0x7c, 0x15, 0x0c, 0x6a, 0xd4, 0x2b, 0xc0, 0x67, 0x38, 0x22, 0x98,
-  0x86, 0xaf, 0x82, 0x41, 0x2f, 0x18, 0xc4, 0x2c, 0x83, 0x80, 0x08, 0x23,
-  0x06, 0x07, 0x00, 0x82, 0x60, 0xb0, 0x91, 0x45, 0x49, 0xf8, 0x02, 0x4d,
-  0x8c, 0x26, 0x04, 0xc0, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x6c, 0x66,
-  0x71, 0x12, 0xe0, 0x40, 0x0f, 0xa3, 0x09, 0x41, 0x30, 0x1c, 0x81, 0x64,
-  0xcc, 0x37, 0xcb, 0x30, 0x10, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18,
-  0x54, 0x6b, 0x21, 0x12, 0x65, 0xd0, 0x95, 0x41, 0x67, 0xb9, 0x90, 0x0b,
-  0xf2, 0x31, 0x21, 0x88, 0xcf, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x1c,
-  0x73, 0xf1, 0x13, 0x81, 0x05, 0x69, 0x20, 0x9f, 0x11, 0x03, 0x04, 0x00,
-  0x41, 0x30, 0xe8, 0xda, 0x22, 0x26, 0x7a, 0x41, 0x0c, 0x02, 0xf3, 0x85,
-  0x35, 0x90, 0x8f, 0xc1, 0x43, 0x10, 0x9f, 0x11, 0x03, 0x04, 0x00, 0x41,
-  0x30, 0xe8, 0xe0, 0x82, 0x26, 0x8a, 0x32, 0x08, 0x46, 0x0c, 0x10, 0x00,
-  0x04, 0xc1, 0xa0, 0x8b, 0x8b, 0x9a, 0xd0, 0xcc, 0xa0, 0x18, 0x31, 0x40,
-  0x00, 0x10, 0x04, 0x83, 0x4e, 0x2e, 0x6c, 0xe2, 0x38, 0x03, 0x62, 0xc4,
-  0x20, 0x01, 0x40, 0x10, 0x0c, 0x2a, 0xbb, 0x68, 0x09, 0x36, 0x40, 0x03,
-  0x36, 0x40, 0x03, 0x0b, 0x96, 0xf8, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82,
-  0xc1, 0xd1, 0x17, 0x69, 0x11, 0x58, 0xf0, 0x06, 0xf2, 0x19, 0x31, 0x40,
-  0x00, 0x10, 0x04, 0x83, 0xee, 0x2e, 0x76, 0xe2, 0x1c, 0xd8, 0x20, 0x30,
-  0x74, 0x88, 0x03, 0xf9, 0x98, 0x3e, 0x04, 0xf1, 0x19, 0x31, 0x40, 0x00,
-  0x10, 0x04, 0x83, 0x4e, 0x2f, 0x7c, 0xa2, 0x78, 0x83, 0x60, 0xc4, 0x00,
-  0x01, 0x40, 0x10, 0x0c, 0xba, 0xbd, 0xf8, 0x09, 0x32, 0x80, 0x83, 0x62,
-  0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0x3a, 0xbe, 0x00, 0x8b, 0x23, 0x0e,
-  0x08, 0x83, 0x32, 0xf9, 0xd8, 0x3f, 0x38, 0xf1, 0x31, 0x21, 0xa0, 0x8f,
-  0x3d, 0x9c, 0x7c, 0x4c, 0x24, 0x9e, 0xf8, 0x98, 0x10, 0xd0, 0xc7, 0x98,
-  0x4e, 0x3e, 0x56, 0x12, 0x4a, 0x7c, 0x4c, 0x08, 0xe8, 0x63, 0x0b, 0x18,
-  0xc8, 0xc7, 0x50, 0x62, 0x89, 0x8f, 0x09, 0x01, 0x7d, 0x66, 0x09, 0x88,
-  0x81, 0x8a, 0xcf, 0x5d, 0x06, 0x78, 0x11, 0x06, 0x2a, 0x0c, 0x6b, 0xc0,
-  0x11, 0x61, 0xa0, 0xc2, 0x60, 0x06, 0x1d, 0x11, 0x06, 0x2a, 0x0c, 0x6a,
-  0xe0, 0x11, 0x61, 0xa0, 0xc2, 0x50, 0x06, 0x1f, 0x11, 0x66, 0x19, 0x0a,
-  0xa3, 0x30, 0xc2, 0x25, 0xe4, 0x63, 0xc4, 0x4b, 0xc8, 0xc7, 0x08, 0x98,
-  0x90, 0x8f, 0x11, 0x31, 0x21, 0x1f, 0x23, 0x64, 0x02, 0x3e, 0x36, 0x13,
-  0x44, 0x7c, 0x8c, 0xa0, 0x09, 0xf8, 0x58, 0x4d, 0x10, 0xf1, 0x19, 0x31,
-  0x30, 0x00, 0x10, 0x04, 0x83, 0xc3, 0x37, 0xea, 0x82, 0x18, 0x31, 0x30,
-  0x00, 0x10, 0x04, 0x83, 0xe3, 0x37, 0xec, 0x82, 0x18, 0x31, 0x30, 0x00,
-  0x10, 0x04, 0x83, 0x03, 0x3c, 0xee, 0x82, 0x18, 0x31, 0x30, 0x00, 0x10,
-  0x04, 0x83, 0x23, 0x3c, 0xf0, 0x82, 0x30, 0x81, 0x88, 0x8f, 0x09, 0x44,
-  0x7c, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0x00, 0xf3, 0x0d, 0xbf, 0xb0,
-  0x09, 0xdb, 0x18, 0x4d, 0x08, 0x80, 0xd1, 0x04, 0x21, 0x38, 0xc1, 0x50,
-  0x27, 0x18, 0xca, 0x84, 0x43, 0x3e, 0x26, 0x1c, 0xf2, 0x19, 0x31, 0x38,
-  0x00, 0x10, 0x04, 0x83, 0x27, 0x3d, 0xe2, 0x42, 0x08, 0x46, 0x0c, 0x0c,
-  0x00, 0x04, 0xc1, 0xe0, 0x60, 0x8f, 0xb8, 0x08, 0x46, 0x0c, 0x0c, 0x00,
-  0x04, 0xc1, 0xe0, 0x68, 0x8f, 0xd0, 0x08, 0xcc, 0x81, 0xe0, 0x63, 0x0e,
-  0x04, 0x1f, 0x13, 0xd0, 0x42, 0x3e, 0x26, 0xa4, 0x85, 0x7c, 0x46, 0x0c,
-  0x1e, 0x00, 0x04, 0xc1, 0xa0, 0x89, 0x0f, 0xbb, 0x40, 0x0b, 0xb3, 0x10,
-  0x02, 0xb6, 0x60, 0x0b, 0xf2, 0x20, 0x8f, 0xd7, 0x28, 0x46, 0x13, 0x02,
-  0x60, 0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0xb6, 0xf6, 0x70, 0x8d, 0xb3,
-  0x28, 0x8f, 0xd1, 0x84, 0x40, 0xb0, 0xb7, 0x08, 0xe2, 0x33, 0x62, 0x70,
-  0x00, 0x20, 0x08, 0x06, 0x1b, 0x7c, 0xc4, 0x86, 0x5a, 0xb8, 0xc6, 0x68,
-  0x42, 0x20, 0x58, 0x20, 0x0b, 0xf4, 0x31, 0x22, 0x88, 0x8f, 0x21, 0x79,
-  0x01, 0x9f, 0xe1, 0x08, 0x21, 0x28, 0xbe, 0x0b, 0x06, 0x31, 0x4b, 0x60,
-  0x0c, 0x54, 0x0c, 0x42, 0x81, 0x16, 0xc4, 0x70, 0x43, 0x10, 0x1f, 0x60,
-  0x30, 0xcb, 0x80, 0x1c, 0x81, 0xd5, 0x43, 0x3d, 0xc8, 0xc7, 0xe4, 0x41,
-  0x1e, 0xe4, 0x63, 0x81, 0x00, 0x1f, 0x83, 0x07, 0x78, 0x90, 0x8f, 0x09,
-  0x01, 0x7c, 0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1, 0xe0, 0x28, 0x91, 0xf8,
-  0x08, 0x2c, 0x70, 0x8b, 0xf8, 0x0c, 0x47, 0x04, 0xa4, 0x41, 0x7c, 0xc3,
-  0x11, 0x02, 0x69, 0x10, 0xdf, 0x74, 0x03, 0x7f, 0xdc, 0x47, 0x30, 0xdd,
-  0xc0, 0x1f, 0xc1, 0xb0, 0x8b, 0x83, 0x5e, 0xf4, 0x47, 0x40, 0xc1, 0x60,
-  0xec, 0xe2, 0xd0, 0x17, 0xff, 0x31, 0x50, 0x30, 0x18, 0xbb, 0x38, 0xf4,
-  0x45, 0x88, 0x14, 0x14, 0x0c, 0xc6, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18,
-  0x44, 0x2e, 0x42, 0x1b, 0xa8, 0x01, 0x1b, 0x23, 0x06, 0x0d, 0x00, 0x82,
-  0x60, 0x70, 0x06, 0x26, 0xa2, 0x1e, 0xa9, 0x11, 0x90, 0xc8, 0x68, 0xbc,
-  0xc7, 0x7b, 0xbc, 0x47, 0x6c, 0x8c, 0x18, 0x34, 0x00, 0x08, 0x82, 0xc1,
-  0x19, 0x98, 0x88, 0x7a, 0xa4, 0x46, 0xb0, 0x1f, 0xc6, 0x7b, 0xbc, 0xc7,
-  0x7b, 0xc4, 0xc6, 0x88, 0x41, 0x03, 0x80, 0x20, 0x18, 0x9c, 0x81, 0x89,
-  0xa8, 0x47, 0x6a, 0x04, 0xfd, 0x51, 0x22, 0xef, 0xf1, 0x1e, 0xef, 0x11,
-  0x1b, 0x23, 0x06, 0x0d, 0x00, 0x82, 0x60, 0x70, 0x06, 0x26, 0xa2, 0x1e,
-  0xa9, 0x11, 0x88, 0x08, 0xf1, 0x1e, 0xef, 0xf1, 0x1e, 0xb1, 0x31, 0x62,
-  0xd0, 0x00, 0x20, 0x08, 0x06, 0x67, 0x60, 0x22, 0xea, 0x91, 0x1a, 0x01,
-  0x7a, 0x08, 0xef, 0xf1, 0x1e, 0xef, 0x11, 0x1b, 0x23, 0x06, 0x0d, 0x00,
-  0x82, 0x60, 0x70, 0x06, 0x26, 0xa2, 0x1e, 0xa9, 0x11, 0x9c, 0x07, 0x89,
-  0xbc, 0xc7, 0x7b, 0xbc, 0x47, 0x6c, 0xcc, 0x12, 0x20, 0x18, 0x10, 0x03,
-  0x05, 0x00, 0x00, 0x00, 0x5b, 0x86, 0xd9, 0x08, 0xec, 0x60, 0xcb, 0x50,
-  0x1b, 0x81, 0x1d, 0x6c, 0x19, 0x6e, 0x23, 0xb0, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
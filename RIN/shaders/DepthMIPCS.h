@@ -1,519 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-; shader hash: 30518b738b748a0ebdd2357ddecb269a
-;
-; Pipeline Runtime Information: 
-;
-;
-;
-; Buffer Definitions:
-;
-; cbuffer childSize
-; {
-;
-;   struct childSize
-;   {
-;
-;       struct struct.Size
-;       {
-;
-;           uint2 size;                               ; Offset:    0
-;       
-;       } childSize;                                  ; Offset:    0
-;
-;   
-;   } childSize;                                      ; Offset:    0 Size:     8
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; childSize                         cbuffer      NA          NA     CB0            cb0     1
-; parentMIPSampler                  sampler      NA          NA      S0             s0     1
-; parentMIP                         texture     f32          2d      T0             t0     1
-; childMIP                              UAV     f32          2d      U0             u0     1
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%"class.Texture2D<float>" = type { float, %"class.Texture2D<float>::mips_type" }
-%"class.Texture2D<float>::mips_type" = type { i32 }
-%"class.RWTexture2D<float>" = type { float }
-%childSize = type { %struct.Size }
-%struct.Size = type { <2 x i32> }
-%struct.SamplerState = type { i32 }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 1, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %5 = call i32 @dx.op.threadId.i32(i32 93, i32 0)  ; ThreadId(component)
-  %6 = call i32 @dx.op.threadId.i32(i32 93, i32 1)  ; ThreadId(component)
-  %7 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %4, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %8 = extractvalue %dx.types.CBufRet.i32 %7, 0
-  %9 = icmp ult i32 %5, %8
-  %10 = extractvalue %dx.types.CBufRet.i32 %7, 1
-  %11 = icmp ult i32 %6, %10
-  %12 = and i1 %9, %11
-  br i1 %12, label %13, label %33
-
-; <label>:13                                      ; preds = %0
-  %14 = uitofp i32 %5 to float
-  %15 = uitofp i32 %6 to float
-  %16 = fadd fast float %14, 5.000000e-01
-  %17 = fadd fast float %15, 5.000000e-01
-  %18 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %4, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %19 = extractvalue %dx.types.CBufRet.i32 %18, 0
-  %20 = extractvalue %dx.types.CBufRet.i32 %18, 1
-  %21 = uitofp i32 %19 to float
-  %22 = uitofp i32 %20 to float
-  %23 = fdiv fast float %16, %21
-  %24 = fdiv fast float %17, %22
-  %25 = call %dx.types.ResRet.f32 @dx.op.textureGather.f32(i32 73, %dx.types.Handle %2, %dx.types.Handle %3, float %23, float %24, float undef, float undef, i32 0, i32 0, i32 0)  ; TextureGather(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,channel)
-  %26 = extractvalue %dx.types.ResRet.f32 %25, 0
-  %27 = extractvalue %dx.types.ResRet.f32 %25, 1
-  %28 = extractvalue %dx.types.ResRet.f32 %25, 2
-  %29 = extractvalue %dx.types.ResRet.f32 %25, 3
-  %30 = call float @dx.op.binary.f32(i32 35, float %28, float %29)  ; FMax(a,b)
-  %31 = call float @dx.op.binary.f32(i32 35, float %26, float %27)  ; FMax(a,b)
-  %32 = call float @dx.op.binary.f32(i32 35, float %31, float %30)  ; FMax(a,b)
-  call void @dx.op.textureStore.f32(i32 67, %dx.types.Handle %1, i32 %5, i32 %6, i32 undef, float %32, float %32, float %32, float %32, i8 15)  ; TextureStore(srv,coord0,coord1,coord2,value0,value1,value2,value3,mask)
-  br label %33
-
-; <label>:33                                      ; preds = %13, %0
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.threadId.i32(i32, i32) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.textureGather.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.binary.f32(i32, float, float) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.textureStore.f32(i32, %dx.types.Handle, i32, i32, i32, float, float, float, float, i8) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #1
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind readonly }
-attributes #2 = { nounwind }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.entryPoints = !{!14}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"cs", i32 6, i32 0}
-!4 = !{!5, !8, !10, !12}
-!5 = !{!6}
-!6 = !{i32 0, %"class.Texture2D<float>"* undef, !"", i32 0, i32 0, i32 1, i32 2, i32 0, !7}
-!7 = !{i32 0, i32 9}
-!8 = !{!9}
-!9 = !{i32 0, %"class.RWTexture2D<float>"* undef, !"", i32 0, i32 0, i32 1, i32 2, i1 false, i1 false, i1 false, !7}
-!10 = !{!11}
-!11 = !{i32 0, %childSize* undef, !"", i32 0, i32 0, i32 1, i32 8, null}
-!12 = !{!13}
-!13 = !{i32 0, %struct.SamplerState* undef, !"", i32 0, i32 0, i32 1, i32 0, null}
-!14 = !{void ()* @main, !"main", null, !4, !15}
-!15 = !{i32 4, !16}
-!16 = !{i32 32, i32 32, i32 1}
-
-#endif
-
-const unsigned char RINShaderBytesDepthMIPCS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x83, 0xb2, 0xa5, 0xed, 0xb1, 0x10, 0xb9, 0xfb,
-  0x40, 0x8c, 0x56, 0x49, 0x99, 0xe8, 0x69, 0x66, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x11, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0xf4, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xb4, 0x09, 0x00, 0x00,
-  0xd0, 0x09, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x4f, 0x53, 0x47, 0x31, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x50, 0x53, 0x56, 0x30, 0x7c, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x52, 0x54, 0x53, 0x30, 0xbc, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x54, 0x41, 0x54,
-  0xf4, 0x07, 0x00, 0x00, 0x60, 0x00, 0x05, 0x00, 0xfd, 0x01, 0x00, 0x00,
-  0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xdc, 0x07, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00,
-  0xf4, 0x01, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49,
-  0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19,
-  0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42,
-  0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62, 0x88,
-  0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42,
-  0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c,
-  0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07,
-  0x40, 0x02, 0xa8, 0x0d, 0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20,
-  0x01, 0xd5, 0x06, 0x62, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x00,
-  0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42,
-  0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00,
-  0x53, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 0x04,
-  0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14,
-  0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 0x8c, 0xc1, 0x0c,
-  0xc0, 0x1c, 0x01, 0x18, 0xcc, 0x14, 0x06, 0xe3, 0xc0, 0x0e, 0xe1, 0x30,
-  0x0f, 0xf3, 0xe0, 0x06, 0xb4, 0x50, 0x0e, 0xf8, 0x40, 0x0f, 0xf5, 0x20,
-  0x0f, 0xe5, 0x20, 0x07, 0xa4, 0xc0, 0x07, 0xe6, 0xc0, 0x0e, 0xef, 0x10,
-  0x0e, 0xf4, 0xe0, 0x07, 0x7a, 0xa0, 0x07, 0xed, 0x90, 0x0e, 0xf0, 0x30,
-  0x0f, 0xbf, 0x40, 0x0f, 0xf9, 0x00, 0x0f, 0xe5, 0x80, 0x82, 0x60, 0x26,
-  0x6b, 0x1c, 0xd8, 0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x80, 0x16, 0xca,
-  0x01, 0x1f, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xe4, 0x80, 0x14, 0xf8,
-  0xc0, 0x1c, 0xd8, 0xe1, 0x1d, 0xc2, 0x81, 0x1e, 0xfc, 0x00, 0x09, 0x80,
-  0x40, 0xc3, 0x4c, 0xd8, 0x38, 0xb0, 0x43, 0x38, 0xcc, 0xc3, 0x3c, 0xb8,
-  0x81, 0x2c, 0xdc, 0x02, 0x2d, 0x94, 0x03, 0x3e, 0xd0, 0x43, 0x3d, 0xc8,
-  0x43, 0x39, 0xc8, 0x01, 0x29, 0xf0, 0x81, 0x39, 0xb0, 0xc3, 0x3b, 0x84,
-  0x03, 0x3d, 0xf8, 0x01, 0x0a, 0x00, 0x2a, 0x6e, 0x92, 0xa6, 0x88, 0x12,
-  0x26, 0x9f, 0x05, 0x98, 0x67, 0x21, 0x22, 0x76, 0x02, 0x26, 0x02, 0x05,
-  0x01, 0x1d, 0xc3, 0x08, 0x42, 0x70, 0x8b, 0x34, 0x45, 0x94, 0x30, 0xf9,
-  0x2c, 0x92, 0x11, 0x28, 0x48, 0x2e, 0x11, 0x0e, 0x64, 0x19, 0x58, 0x24,
-  0x23, 0x50, 0xa0, 0xd0, 0x32, 0x02, 0x50, 0x82, 0x86, 0x9c, 0x32, 0x04,
-  0x41, 0x40, 0xd0, 0x4d, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 0x48, 0xfe, 0x4a,
-  0x48, 0x2b, 0x31, 0xf9, 0xc5, 0x6d, 0xa3, 0x02, 0x00, 0x00, 0x20, 0x98,
-  0x23, 0x40, 0x68, 0xba, 0x67, 0xb8, 0xfc, 0x09, 0x7b, 0x08, 0xc9, 0x0f,
-  0x81, 0x66, 0x58, 0x08, 0x14, 0x50, 0x65, 0x91, 0x82, 0xaa, 0x02, 0x00,
-  0x00, 0x08, 0x82, 0x80, 0xac, 0x42, 0x00, 0x01, 0x00, 0x10, 0x56, 0x96,
-  0x26, 0xa8, 0x82, 0x20, 0x00, 0x00, 0x00, 0x98, 0x48, 0x3b, 0x6a, 0xb8,
-  0xfc, 0x09, 0x7b, 0x08, 0xc9, 0xe7, 0x36, 0xaa, 0x58, 0x89, 0xc9, 0x47,
-  0x6e, 0x1b, 0x11, 0x41, 0x10, 0x04, 0x85, 0xe0, 0x82, 0x2a, 0xa0, 0x6e,
-  0x8e, 0x20, 0x28, 0x46, 0x15, 0x4c, 0x41, 0xf0, 0x11, 0x38, 0x10, 0x00,
-  0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79,
-  0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e,
-  0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07,
-  0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07,
-  0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a, 0x0f, 0x84, 0x90, 0x21, 0x23,
-  0x45, 0x44, 0x00, 0xce, 0x00, 0x80, 0x59, 0x03, 0x00, 0xe6, 0x0d, 0x00,
-  0x98, 0x3b, 0x00, 0x80, 0x21, 0x8f, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x08, 0x08, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x16, 0x10, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x30, 0x20, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x68, 0x40,
-  0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0xe9,
-  0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8,
-  0x03, 0x06, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x90, 0x05, 0x02, 0x00, 0x13, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18,
-  0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0xfa,
-  0x46, 0x00, 0x28, 0x28, 0x81, 0x11, 0x80, 0x62, 0x28, 0x82, 0x92, 0x28,
-  0x88, 0x32, 0x28, 0x87, 0x52, 0x28, 0x94, 0x02, 0x29, 0x84, 0x02, 0x2a,
-  0x8b, 0x32, 0x22, 0x61, 0x06, 0x80, 0x86, 0x19, 0x00, 0x22, 0x66, 0x00,
-  0xa8, 0x98, 0x01, 0x20, 0x63, 0x06, 0x80, 0x90, 0x19, 0x00, 0x52, 0x66,
-  0x00, 0x68, 0x99, 0x01, 0x20, 0x66, 0x06, 0x80, 0x80, 0x19, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90,
-  0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1,
-  0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41,
-  0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a,
-  0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9,
-  0x10, 0x04, 0x13, 0x84, 0x80, 0x99, 0x20, 0x04, 0xcd, 0x06, 0x61, 0x20,
-  0x36, 0x08, 0x04, 0x41, 0x61, 0x6c, 0x6e, 0x82, 0x10, 0x38, 0x1b, 0x86,
-  0x03, 0x21, 0x26, 0x08, 0x44, 0xc7, 0x04, 0x2e, 0x4c, 0xae, 0xcc, 0x8d,
-  0xae, 0x29, 0x09, 0x6a, 0x82, 0x10, 0x3c, 0x13, 0x84, 0x00, 0xda, 0x20,
-  0x10, 0xcd, 0x86, 0x84, 0x50, 0x16, 0x82, 0x18, 0x18, 0xc2, 0xd9, 0x10,
-  0x3c, 0x13, 0x04, 0xe3, 0x23, 0x32, 0x86, 0x96, 0xc6, 0x46, 0xd6, 0x94,
-  0x04, 0x35, 0x41, 0xf8, 0x96, 0x0d, 0x0b, 0x11, 0x49, 0x04, 0x31, 0x30,
-  0xd3, 0x34, 0x39, 0x1b, 0x02, 0x6a, 0x82, 0xc0, 0x8c, 0x01, 0x93, 0x31,
-  0xb4, 0x34, 0x36, 0xb2, 0xa9, 0x34, 0xbd, 0xb2, 0x09, 0x42, 0x10, 0x6d,
-  0x40, 0x08, 0xeb, 0x22, 0x88, 0x01, 0x03, 0x36, 0x04, 0xd9, 0x04, 0x01,
-  0x01, 0x03, 0x42, 0x70, 0x61, 0x72, 0x65, 0x6e, 0x74, 0x4d, 0x49, 0x50,
-  0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x1b, 0x10, 0x62, 0xe3, 0x08,
-  0x62, 0x20, 0x80, 0x0d, 0x41, 0xb7, 0x81, 0x80, 0x2a, 0xcd, 0x9b, 0x20,
-  0x28, 0x61, 0x40, 0x62, 0x2e, 0x4d, 0xaf, 0x6c, 0x82, 0x10, 0x48, 0x13,
-  0x84, 0x60, 0x9a, 0x20, 0x04, 0xd4, 0x06, 0x03, 0x09, 0x03, 0x31, 0x20,
-  0xc6, 0x80, 0x0c, 0x36, 0x08, 0x58, 0x19, 0x4c, 0x10, 0x06, 0x6e, 0x82,
-  0x10, 0x54, 0x0c, 0xd0, 0x36, 0x18, 0x48, 0x1a, 0x88, 0x01, 0x31, 0x06,
-  0x0d, 0x89, 0xb6, 0x34, 0xb8, 0xb9, 0x09, 0x42, 0x60, 0x6d, 0x20, 0x90,
-  0x35, 0x10, 0x03, 0x36, 0x98, 0x20, 0x00, 0x64, 0xb0, 0x41, 0x20, 0xdc,
-  0x60, 0x43, 0xf0, 0x06, 0x1b, 0x04, 0x02, 0x0e, 0x36, 0x10, 0x68, 0xa0,
-  0x06, 0x6d, 0x10, 0x07, 0x13, 0x04, 0x61, 0x9b, 0x20, 0x04, 0x17, 0x0d,
-  0xb4, 0x30, 0x37, 0x32, 0xb6, 0xb2, 0x0d, 0x06, 0x52, 0x07, 0x62, 0x40,
-  0x8c, 0x01, 0x19, 0x6c, 0x10, 0xe8, 0xc0, 0x0e, 0x26, 0x08, 0x85, 0xb7,
-  0x61, 0xa0, 0x03, 0x35, 0x88, 0x83, 0x09, 0xc2, 0x22, 0x06, 0x1b, 0x08,
-  0xe4, 0x12, 0x03, 0x62, 0x83, 0x80, 0xed, 0xc1, 0x86, 0x85, 0x00, 0x03,
-  0x33, 0x38, 0x03, 0x39, 0x98, 0x83, 0x3b, 0xc0, 0x83, 0x3c, 0xd0, 0x03,
-  0x3e, 0x98, 0x20, 0x3c, 0xc4, 0x06, 0x60, 0xc3, 0x40, 0xfc, 0xc1, 0x1f,
-  0x6c, 0x08, 0x40, 0x61, 0xc3, 0x30, 0xf8, 0x41, 0x28, 0x90, 0x68, 0x0b,
-  0x4b, 0x73, 0x9b, 0x20, 0x04, 0xd8, 0x86, 0x81, 0x14, 0x48, 0x61, 0xd8,
-  0x20, 0xd0, 0x41, 0x29, 0x6c, 0x28, 0xfc, 0x60, 0x14, 0x80, 0xcf, 0x14,
-  0x88, 0x88, 0xc9, 0x85, 0xb9, 0x8d, 0xa1, 0x95, 0xcd, 0xd1, 0x30, 0x63,
-  0x7b, 0x0b, 0xa3, 0x9b, 0x9b, 0x20, 0x04, 0x19, 0x8b, 0x34, 0xb7, 0x39,
-  0xba, 0xb9, 0x09, 0x42, 0xa0, 0x91, 0x48, 0x73, 0xa3, 0x9b, 0x23, 0x42,
-  0x57, 0x86, 0xf7, 0xe5, 0xf6, 0x26, 0xd7, 0xc6, 0x84, 0xae, 0x0c, 0xef,
-  0x6b, 0x8e, 0xee, 0x4d, 0xae, 0x8c, 0x45, 0x5d, 0x9a, 0x1b, 0xdd, 0xdc,
-  0x06, 0x07, 0x15, 0x86, 0x54, 0x50, 0x85, 0x55, 0x60, 0x85, 0x56, 0x60,
-  0x5c, 0x61, 0x78, 0x85, 0x01, 0x16, 0x86, 0x2a, 0x6c, 0x6c, 0x76, 0x6d,
-  0x2e, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x53, 0x82, 0xa0, 0x0a, 0x19, 0x9e,
-  0x8b, 0x5d, 0x99, 0xdc, 0x5c, 0xda, 0x9b, 0xdb, 0x94, 0x80, 0x68, 0x42,
-  0x86, 0xe7, 0x62, 0x17, 0xc6, 0x66, 0x57, 0x26, 0x37, 0x25, 0x28, 0xea,
-  0x90, 0xe1, 0xb9, 0xcc, 0xa1, 0x85, 0x91, 0x95, 0xc9, 0x35, 0xbd, 0x91,
-  0x95, 0xb1, 0x4d, 0x09, 0x90, 0x32, 0x64, 0x78, 0x2e, 0x72, 0x65, 0x73,
-  0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x53, 0x02, 0xaf, 0x12, 0x19, 0x9e,
-  0x0b, 0x5d, 0x1e, 0x5c, 0x59, 0x90, 0x9b, 0xdb, 0x1b, 0x5d, 0x18, 0x5d,
-  0xda, 0x9b, 0xdb, 0xdc, 0x14, 0x81, 0x0f, 0x42, 0xa1, 0x0e, 0x19, 0x9e,
-  0x4b, 0x99, 0x1b, 0x9d, 0x5c, 0x1e, 0xd4, 0x5b, 0x9a, 0x1b, 0xdd, 0xdc,
-  0x94, 0xc0, 0x14, 0xba, 0x90, 0xe1, 0xb9, 0x8c, 0xbd, 0xd5, 0xb9, 0xd1,
-  0x95, 0xc9, 0xcd, 0x4d, 0x09, 0x60, 0x01, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66,
-  0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07,
-  0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10,
-  0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce,
-  0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b,
-  0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c,
-  0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07,
-  0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11,
-  0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0,
-  0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8,
-  0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b,
-  0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b,
-  0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87,
-  0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07,
-  0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87,
-  0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81,
-  0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30,
-  0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4,
-  0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca,
-  0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39,
-  0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b,
-  0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b,
-  0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87,
-  0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20,
-  0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90,
-  0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0x15, 0x00, 0x06, 0x81, 0xdf, 0x18, 0x9d, 0x66,
-  0x93, 0x9b, 0x49, 0x28, 0x10, 0x38, 0xb3, 0xfe, 0x48, 0xd2, 0x2b, 0xb5,
-  0x8c, 0xa7, 0xd7, 0xe5, 0x65, 0x19, 0x11, 0xd8, 0x04, 0x02, 0x83, 0x05,
-  0xf0, 0x05, 0x7e, 0xf0, 0xb0, 0xbc, 0xec, 0xa6, 0x37, 0x93, 0x50, 0x20,
-  0x70, 0x66, 0xfd, 0x91, 0xa8, 0x65, 0x3c, 0xbd, 0x2e, 0x2f, 0xcb, 0x88,
-  0xc0, 0x26, 0x10, 0x18, 0x2c, 0x81, 0x32, 0x08, 0xfc, 0xe0, 0x61, 0x79,
-  0xd9, 0x4d, 0x6f, 0x26, 0xa1, 0xd3, 0x70, 0x1b, 0xce, 0x2e, 0xcb, 0x81,
-  0xc0, 0x59, 0x75, 0x1a, 0x6e, 0xc3, 0xd9, 0x65, 0xf9, 0x94, 0x1e, 0xa6,
-  0x97, 0x81, 0xc0, 0xa0, 0x0d, 0x24, 0xc2, 0x81, 0x2c, 0x03, 0x8b, 0x64,
-  0x84, 0x1d, 0x40, 0xc3, 0xe5, 0x3b, 0x8f, 0x1f, 0x20, 0x0d, 0x10, 0x61,
-  0x7e, 0x71, 0xdb, 0x96, 0xb0, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x50,
-  0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25, 0x61, 0x00, 0x02, 0xe6, 0x23,
-  0xb7, 0x6d, 0x0a, 0xd2, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x11, 0x01, 0x4c,
-  0x44, 0x08, 0x34, 0xc3, 0x42, 0x98, 0xc1, 0x35, 0x5c, 0xbe, 0xf3, 0xf8,
-  0x13, 0x71, 0x4d, 0x54, 0x44, 0x80, 0xc0, 0x74, 0x10, 0x91, 0x5f, 0xdc,
-  0xb6, 0x21, 0x58, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x11, 0xd7, 0x44, 0x45,
-  0x04, 0x3b, 0x39, 0x11, 0xe1, 0x17, 0xb7, 0x6d, 0x05, 0xd2, 0x70, 0xf9,
-  0xce, 0xe3, 0x4f, 0x47, 0x44, 0x00, 0x83, 0x38, 0xf8, 0xc8, 0x6d, 0x1b,
-  0x01, 0xc1, 0x00, 0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x41, 0x53, 0x48, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x51, 0x8b, 0x73, 0x8b, 0x74, 0x8a, 0x0e, 0xbd, 0xd2, 0x35, 0x7d,
-  0xde, 0xcb, 0x26, 0x9a, 0x44, 0x58, 0x49, 0x4c, 0x34, 0x07, 0x00, 0x00,
-  0x60, 0x00, 0x05, 0x00, 0xcd, 0x01, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c,
-  0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x07, 0x00, 0x00,
-  0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00,
-  0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39,
-  0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62,
-  0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14,
-  0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20,
-  0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90,
-  0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a,
-  0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d,
-  0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x01, 0xd5, 0x06, 0x62,
-  0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x00, 0x49, 0x18, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06,
-  0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-  0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 0x04, 0x13, 0x23, 0xa4, 0x84,
-  0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c,
-  0x0b, 0x84, 0xc4, 0x4c, 0x10, 0x90, 0xc1, 0x08, 0x40, 0x09, 0x00, 0x0a,
-  0xe6, 0x08, 0xc0, 0xa0, 0x0c, 0xc3, 0x30, 0x10, 0x31, 0x03, 0x70, 0xd3,
-  0x70, 0xf9, 0x13, 0xf6, 0x10, 0x92, 0xbf, 0x12, 0xd2, 0x4a, 0x4c, 0x7e,
-  0x71, 0xdb, 0xa8, 0x30, 0x0c, 0xc3, 0x18, 0xe6, 0x08, 0x10, 0x42, 0xee,
-  0x19, 0x2e, 0x7f, 0xc2, 0x1e, 0x42, 0xf2, 0x43, 0xa0, 0x19, 0x16, 0x02,
-  0x05, 0x49, 0x59, 0x8e, 0x41, 0x51, 0x0c, 0xc3, 0x30, 0x86, 0x61, 0xa0,
-  0xa5, 0x10, 0xc6, 0x60, 0x18, 0xd4, 0x94, 0x05, 0x18, 0x94, 0x61, 0x18,
-  0x0c, 0xc3, 0x30, 0x10, 0x7a, 0x8e, 0x1a, 0x2e, 0x7f, 0xc2, 0x1e, 0x42,
-  0xf2, 0xb9, 0x8d, 0x2a, 0x56, 0x62, 0xf2, 0x91, 0xdb, 0x46, 0xc4, 0x30,
-  0x0c, 0x43, 0x21, 0xa2, 0x41, 0x19, 0x48, 0x9a, 0x23, 0x08, 0x8a, 0xa1,
-  0x0c, 0xc8, 0x30, 0x50, 0x54, 0x0d, 0x04, 0xcc, 0x14, 0x06, 0xe3, 0xc0,
-  0x0e, 0xe1, 0x30, 0x0f, 0xf3, 0xe0, 0x06, 0xb4, 0x50, 0x0e, 0xf8, 0x40,
-  0x0f, 0xf5, 0x20, 0x0f, 0xe5, 0x20, 0x07, 0xa4, 0xc0, 0x07, 0xe6, 0xc0,
-  0x0e, 0xef, 0x10, 0x0e, 0xf4, 0xe0, 0x07, 0x7a, 0xa0, 0x07, 0xed, 0x90,
-  0x0e, 0xf0, 0x30, 0x0f, 0xbf, 0x40, 0x0f, 0xf9, 0x00, 0x0f, 0xe5, 0x80,
-  0x82, 0x61, 0x26, 0x6b, 0x1c, 0xd8, 0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc,
-  0x80, 0x16, 0xca, 0x01, 0x1f, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xe4,
-  0x80, 0x14, 0xf8, 0xc0, 0x1c, 0xd8, 0xe1, 0x1d, 0xc2, 0x81, 0x1e, 0xfc,
-  0x00, 0x09, 0x06, 0x46, 0xd9, 0x4c, 0xd8, 0x38, 0xb0, 0x43, 0x38, 0xcc,
-  0xc3, 0x3c, 0xb8, 0x81, 0x2c, 0xdc, 0x02, 0x2d, 0x94, 0x03, 0x3e, 0xd0,
-  0x43, 0x3d, 0xc8, 0x43, 0x39, 0xc8, 0x01, 0x29, 0xf0, 0x81, 0x39, 0xb0,
-  0xc3, 0x3b, 0x84, 0x03, 0x3d, 0xf8, 0x01, 0x0a, 0x0c, 0xda, 0x86, 0x11,
-  0x84, 0xe1, 0x16, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x59, 0x24, 0x23, 0x50,
-  0xd0, 0x5d, 0x22, 0x1c, 0xc8, 0x32, 0xb0, 0x48, 0x46, 0xa0, 0xc0, 0xa3,
-  0xef, 0x26, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x59, 0x80, 0x79, 0x16, 0x22,
-  0x62, 0x27, 0x60, 0x22, 0x50, 0x30, 0x50, 0x38, 0x05, 0x00, 0x00, 0x00,
-  0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79,
-  0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e,
-  0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07,
-  0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07,
-  0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x04, 0x10, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x16, 0x20,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x34,
-  0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4,
-  0x79, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0xc8, 0x23, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc0, 0x90, 0xa7, 0x02, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x2c, 0x10, 0x0c, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x14,
-  0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x1a,
-  0x4a, 0x60, 0x04, 0xa0, 0x18, 0x8a, 0xa0, 0x24, 0x0a, 0xa2, 0x10, 0x0a,
-  0x88, 0xa8, 0x11, 0x00, 0xd2, 0x66, 0x00, 0x88, 0x9b, 0x01, 0x20, 0x70,
-  0x06, 0x80, 0xc4, 0x19, 0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44,
-  0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b,
-  0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b,
-  0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81,
-  0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x84,
-  0xe1, 0x98, 0x20, 0x0c, 0xc8, 0x06, 0x61, 0x20, 0x26, 0x08, 0x43, 0xb2,
-  0x41, 0x18, 0x0c, 0x0a, 0x63, 0x73, 0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08,
-  0x1a, 0x44, 0x60, 0x82, 0x30, 0x28, 0x13, 0x84, 0x61, 0xd9, 0x20, 0x10,
-  0xcd, 0x86, 0x84, 0x50, 0x16, 0x82, 0x18, 0x18, 0xc2, 0xd9, 0x10, 0x3c,
-  0x13, 0x04, 0x2e, 0x9a, 0x20, 0x50, 0xcf, 0x86, 0x85, 0x88, 0x16, 0x82,
-  0x18, 0x18, 0x49, 0x92, 0x9c, 0x0d, 0xc1, 0x34, 0x41, 0x00, 0x03, 0x69,
-  0x82, 0x30, 0x30, 0x1b, 0x10, 0xa2, 0x5a, 0x08, 0x62, 0xb0, 0x80, 0x0d,
-  0xc1, 0x35, 0x41, 0x10, 0x83, 0x69, 0x03, 0x42, 0x64, 0x0b, 0x41, 0x0c,
-  0x04, 0xb0, 0x21, 0xd0, 0x36, 0x10, 0x10, 0x85, 0x6d, 0x13, 0x04, 0x01,
-  0x20, 0xd1, 0x16, 0x96, 0xe6, 0x36, 0x41, 0x18, 0x9a, 0x09, 0xc2, 0xe0,
-  0x6c, 0x18, 0xc0, 0x00, 0x0c, 0x86, 0x0d, 0xc2, 0x17, 0x06, 0x1b, 0x8a,
-  0xce, 0x03, 0x38, 0x31, 0xa8, 0xc2, 0xc6, 0x66, 0xd7, 0xe6, 0x92, 0x46,
-  0x56, 0xe6, 0x46, 0x37, 0x25, 0x08, 0xaa, 0x90, 0xe1, 0xb9, 0xd8, 0x95,
-  0xc9, 0xcd, 0xa5, 0xbd, 0xb9, 0x4d, 0x09, 0x88, 0x26, 0x64, 0x78, 0x2e,
-  0x76, 0x61, 0x6c, 0x76, 0x65, 0x72, 0x53, 0x02, 0xa3, 0x0e, 0x19, 0x9e,
-  0xcb, 0x1c, 0x5a, 0x18, 0x59, 0x99, 0x5c, 0xd3, 0x1b, 0x59, 0x19, 0xdb,
-  0x94, 0x00, 0x29, 0x43, 0x86, 0xe7, 0x22, 0x57, 0x36, 0xf7, 0x56, 0x27,
-  0x37, 0x56, 0x36, 0x37, 0x25, 0xd8, 0xea, 0x90, 0xe1, 0xb9, 0x94, 0xb9,
-  0xd1, 0xc9, 0xe5, 0x41, 0xbd, 0xa5, 0xb9, 0xd1, 0xcd, 0x4d, 0x09, 0xc4,
-  0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-  0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73,
-  0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e,
-  0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30,
-  0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8,
-  0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b,
-  0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76,
-  0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e,
-  0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e,
-  0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61,
-  0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4,
-  0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76,
-  0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37,
-  0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76,
-  0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71,
-  0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e,
-  0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1,
-  0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61,
-  0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90,
-  0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8,
-  0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc,
-  0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4,
-  0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19,
-  0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06,
-  0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f,
-  0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
-  0x36, 0x00, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x80, 0x34, 0x40, 0x84, 0xf9,
-  0xc5, 0x6d, 0x5b, 0xc1, 0x36, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x40, 0x15,
-  0x05, 0x11, 0x95, 0x0e, 0x30, 0x94, 0x84, 0x01, 0x08, 0x98, 0x8f, 0xdc,
-  0xb6, 0x19, 0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x44, 0x04, 0x30, 0x11,
-  0x21, 0xd0, 0x0c, 0x0b, 0x61, 0x02, 0xd7, 0x70, 0xf9, 0xce, 0xe3, 0x4f,
-  0xc4, 0x35, 0x51, 0x11, 0x01, 0x02, 0xd3, 0x41, 0x44, 0x7e, 0x71, 0xdb,
-  0x46, 0x60, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0x44, 0x5c, 0x13, 0x15, 0x11,
-  0xec, 0xe4, 0x44, 0x84, 0x5f, 0xdc, 0xb6, 0x05, 0x48, 0xc3, 0xe5, 0x3b,
-  0x8f, 0x3f, 0x1d, 0x11, 0x01, 0x0c, 0xe2, 0xe0, 0x23, 0xb7, 0x6d, 0x00,
-  0x04, 0x03, 0x20, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x13, 0x04, 0x43, 0x2c, 0x10, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x00, 0x34, 0x94, 0x5c, 0x19, 0x95, 0x6e, 0x40, 0xd9,
-  0x95, 0x64, 0x40, 0x19, 0x06, 0xcc, 0x00, 0x10, 0x52, 0x1e, 0x45, 0x50,
-  0x02, 0x23, 0x00, 0x65, 0x40, 0xc6, 0x0c, 0xc0, 0x18, 0x01, 0x08, 0x82,
-  0x20, 0xfc, 0x01, 0x00, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x50, 0x71,
-  0x4e, 0xa1, 0x69, 0xd3, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x54, 0xdd,
-  0x53, 0x6c, 0x1b, 0x35, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x95, 0x07,
-  0x15, 0x1c, 0x57, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x41, 0xf5, 0x45,
-  0x49, 0xd7, 0x59, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60, 0x40, 0x94, 0x01,
-  0xe4, 0x8d, 0x18, 0x18, 0x00, 0x08, 0x82, 0x01, 0x61, 0x06, 0x11, 0x18,
-  0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0x81, 0x34, 0x06, 0xd1, 0x00, 0x06,
-  0xa3, 0x09, 0x01, 0x30, 0xdc, 0x40, 0x04, 0x64, 0x30, 0x9a, 0x30, 0x04,
-  0xc3, 0x0d, 0x45, 0x40, 0x06, 0x35, 0x04, 0x3a, 0xcb, 0x10, 0x08, 0xc1,
-  0x21, 0x46, 0x1d, 0x62, 0x94, 0x09, 0x0f, 0x7c, 0x4c, 0x80, 0xe0, 0x33,
-  0x62, 0x70, 0x00, 0x20, 0x08, 0x06, 0x52, 0x1b, 0x6c, 0x8d, 0x1a, 0x8c,
-  0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x9c, 0x60, 0xd4, 0x09, 0x46, 0xd9,
-  0x21, 0xd0, 0xc7, 0x0e, 0x81, 0x3e, 0x23, 0x06, 0x0e, 0x00, 0x82, 0x60,
-  0xb0, 0xdc, 0x41, 0x18, 0x58, 0x95, 0x10, 0x64, 0x59, 0x1c, 0xc4, 0x41,
-  0x1c, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2,
-  0x68, 0x02, 0x31, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0x41, 0xb3, 0x07,
-  0x69, 0x20, 0x04, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xd0, 0xf0, 0x81,
-  0x1a, 0x14, 0xc4, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x34, 0x7d, 0xb0,
-  0x06, 0x81, 0x30, 0x62, 0xe0, 0x00, 0x20, 0x08, 0x06, 0x4f, 0x1f, 0xa0,
-  0xc1, 0xb7, 0x69, 0x67, 0x10, 0x04, 0x41, 0x60, 0x06, 0xb3, 0x04, 0x02,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
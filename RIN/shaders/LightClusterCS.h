@@ -1,875 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; no parameters
-; shader hash: 0abbfe434d1104aff1349063c67637f9
-;
-; Pipeline Runtime Information: 
-;
-;
-;
-; Buffer Definitions:
-;
-; cbuffer lightBufferLength
-; {
-;
-;   struct lightBufferLength
-;   {
-;
-;       struct struct.Length
-;       {
-;
-;           uint length;                              ; Offset:    0
-;       
-;       } lightBufferLength;                          ; Offset:    0
-;
-;   
-;   } lightBufferLength;                              ; Offset:    0 Size:     4
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for lightBuffer
-; {
-;
-;   struct struct.Light
-;   {
-;
-;       float3 position;                              ; Offset:    0
-;       float radius;                                 ; Offset:   12
-;       float3 color;                                 ; Offset:   16
-;       uint flags;                                   ; Offset:   28
-;   
-;   } $Element;                                       ; Offset:    0 Size:    32
-;
-; }
-;
-; Resource bind info for lightClusterBuffer
-; {
-;
-;   struct struct.LightCluster
-;   {
-;
-;       uint lightCount;                              ; Offset:    0
-;       uint lights[63];                              ; Offset:    4
-;   
-;   } $Element;                                       ; Offset:    0 Size:   256
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; lightBufferLength                 cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; lightBuffer                       texture  struct         r/o      T0             t0     1
-; lightClusterBuffer                    UAV  struct         r/w      U0             u0     1
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%"class.StructuredBuffer<Light>" = type { %struct.Light }
-%struct.Light = type { <3 x float>, float, <3 x float>, i32 }
-%"class.RWStructuredBuffer<LightCluster>" = type { %struct.LightCluster }
-%struct.LightCluster = type { i32, [63 x i32] }
-%lightBufferLength = type { %struct.Length }
-%struct.Length = type { i32 }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 1, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %5 = call i32 @dx.op.threadId.i32(i32 93, i32 0)  ; ThreadId(component)
-  %6 = call i32 @dx.op.threadId.i32(i32 93, i32 1)  ; ThreadId(component)
-  %7 = call i32 @dx.op.threadId.i32(i32 93, i32 2)  ; ThreadId(component)
-  %8 = shl i32 %6, 4
-  %9 = add i32 %8, %5
-  %10 = shl i32 %7, 7
-  %11 = add i32 %9, %10
-  %12 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %13 = extractvalue %dx.types.CBufRet.f32 %12, 1
-  %14 = extractvalue %dx.types.CBufRet.f32 %12, 0
-  %15 = uitofp i32 %7 to float
-  %16 = fmul fast float %15, 0x3FA5555560000000
-  %17 = fdiv fast float %13, %14
-  %18 = call float @dx.op.unary.f32(i32 23, float %17)  ; Log(value)
-  %19 = fmul fast float %16, %18
-  %20 = call float @dx.op.unary.f32(i32 21, float %19)  ; Exp(value)
-  %21 = fmul fast float %20, %14
-  %22 = add i32 %7, 1
-  %23 = uitofp i32 %22 to float
-  %24 = fmul fast float %23, 0x3FA5555560000000
-  %25 = fmul fast float %24, %18
-  %26 = call float @dx.op.unary.f32(i32 21, float %25)  ; Exp(value)
-  %27 = fmul fast float %26, %14
-  %28 = fsub fast float -0.000000e+00, %21
-  %29 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 8)  ; CBufferLoadLegacy(handle,regIndex)
-  %30 = extractvalue %dx.types.CBufRet.f32 %29, 0
-  %31 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 9)  ; CBufferLoadLegacy(handle,regIndex)
-  %32 = extractvalue %dx.types.CBufRet.f32 %31, 1
-  %33 = fmul fast float %30, %28
-  %34 = fmul fast float %32, %28
-  %35 = fsub fast float -0.000000e+00, %27
-  %36 = fmul fast float %30, %35
-  %37 = fmul fast float %32, %35
-  %38 = uitofp i32 %5 to float
-  %39 = uitofp i32 %6 to float
-  %40 = fmul fast float %38, 1.250000e-01
-  %41 = fmul fast float %39, 2.500000e-01
-  %42 = fadd fast float %40, -1.000000e+00
-  %43 = fadd fast float %41, -1.000000e+00
-  %44 = add i32 %5, 1
-  %45 = add i32 %6, 1
-  %46 = uitofp i32 %44 to float
-  %47 = uitofp i32 %45 to float
-  %48 = fmul fast float %46, 1.250000e-01
-  %49 = fmul fast float %47, 2.500000e-01
-  %50 = fadd fast float %48, -1.000000e+00
-  %51 = fadd fast float %49, -1.000000e+00
-  %52 = fmul fast float %33, %42
-  %53 = fmul fast float %34, %43
-  %54 = fmul fast float %33, %50
-  %55 = fmul fast float %34, %51
-  %56 = fmul fast float %36, %42
-  %57 = fmul fast float %37, %43
-  %58 = fmul fast float %36, %50
-  %59 = fmul fast float %37, %51
-  %60 = call float @dx.op.binary.f32(i32 36, float %52, float %56)  ; FMin(a,b)
-  %61 = call float @dx.op.binary.f32(i32 36, float %53, float %57)  ; FMin(a,b)
-  %62 = call float @dx.op.binary.f32(i32 35, float %54, float %58)  ; FMax(a,b)
-  %63 = call float @dx.op.binary.f32(i32 35, float %55, float %59)  ; FMax(a,b)
-  %64 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %4, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %65 = extractvalue %dx.types.CBufRet.i32 %64, 0
-  %66 = icmp eq i32 %65, 0
-  br i1 %66, label %142, label %67
-
-; <label>:67                                      ; preds = %0
-  br label %68
-
-; <label>:68                                      ; preds = %133, %67
-  %69 = phi i32 [ %134, %133 ], [ 0, %67 ]
-  %70 = phi i32 [ %135, %133 ], [ 0, %67 ]
-  %71 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %2, i32 %70, i32 0)  ; BufferLoad(srv,index,wot)
-  %72 = extractvalue %dx.types.ResRet.f32 %71, 0
-  %73 = extractvalue %dx.types.ResRet.f32 %71, 1
-  %74 = extractvalue %dx.types.ResRet.f32 %71, 2
-  %75 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %2, i32 %70, i32 12)  ; BufferLoad(srv,index,wot)
-  %76 = extractvalue %dx.types.ResRet.f32 %75, 0
-  %77 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %70, i32 28)  ; BufferLoad(srv,index,wot)
-  %78 = extractvalue %dx.types.ResRet.i32 %77, 0
-  %79 = and i32 %78, 1
-  %80 = icmp eq i32 %79, 0
-  br i1 %80, label %133, label %81
-
-; <label>:81                                      ; preds = %68
-  %82 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %83 = extractvalue %dx.types.CBufRet.f32 %82, 0
-  %84 = extractvalue %dx.types.CBufRet.f32 %82, 1
-  %85 = extractvalue %dx.types.CBufRet.f32 %82, 2
-  %86 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 1)  ; CBufferLoadLegacy(handle,regIndex)
-  %87 = extractvalue %dx.types.CBufRet.f32 %86, 0
-  %88 = extractvalue %dx.types.CBufRet.f32 %86, 1
-  %89 = extractvalue %dx.types.CBufRet.f32 %86, 2
-  %90 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 2)  ; CBufferLoadLegacy(handle,regIndex)
-  %91 = extractvalue %dx.types.CBufRet.f32 %90, 0
-  %92 = extractvalue %dx.types.CBufRet.f32 %90, 1
-  %93 = extractvalue %dx.types.CBufRet.f32 %90, 2
-  %94 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 3)  ; CBufferLoadLegacy(handle,regIndex)
-  %95 = extractvalue %dx.types.CBufRet.f32 %94, 0
-  %96 = extractvalue %dx.types.CBufRet.f32 %94, 1
-  %97 = extractvalue %dx.types.CBufRet.f32 %94, 2
-  %98 = fmul fast float %83, %72
-  %99 = call float @dx.op.tertiary.f32(i32 46, float %87, float %73, float %98)  ; FMad(a,b,c)
-  %100 = call float @dx.op.tertiary.f32(i32 46, float %91, float %74, float %99)  ; FMad(a,b,c)
-  %101 = fadd fast float %100, %95
-  %102 = fmul fast float %84, %72
-  %103 = call float @dx.op.tertiary.f32(i32 46, float %88, float %73, float %102)  ; FMad(a,b,c)
-  %104 = call float @dx.op.tertiary.f32(i32 46, float %92, float %74, float %103)  ; FMad(a,b,c)
-  %105 = fadd fast float %104, %96
-  %106 = fmul fast float %85, %72
-  %107 = call float @dx.op.tertiary.f32(i32 46, float %89, float %73, float %106)  ; FMad(a,b,c)
-  %108 = call float @dx.op.tertiary.f32(i32 46, float %93, float %74, float %107)  ; FMad(a,b,c)
-  %109 = fadd fast float %108, %97
-  %110 = fsub fast float %60, %101
-  %111 = fsub fast float %101, %62
-  %112 = call float @dx.op.binary.f32(i32 35, float %111, float %110)  ; FMax(a,b)
-  %113 = call float @dx.op.binary.f32(i32 35, float %112, float 0.000000e+00)  ; FMax(a,b)
-  %114 = fsub fast float %61, %105
-  %115 = fsub fast float %105, %63
-  %116 = call float @dx.op.binary.f32(i32 35, float %115, float %114)  ; FMax(a,b)
-  %117 = call float @dx.op.binary.f32(i32 35, float %116, float 0.000000e+00)  ; FMax(a,b)
-  %118 = fsub fast float %27, %109
-  %119 = fsub fast float %109, %21
-  %120 = call float @dx.op.binary.f32(i32 35, float %119, float %118)  ; FMax(a,b)
-  %121 = call float @dx.op.binary.f32(i32 35, float %120, float 0.000000e+00)  ; FMax(a,b)
-  %122 = fmul fast float %113, %113
-  %123 = fmul fast float %117, %117
-  %124 = fadd fast float %123, %122
-  %125 = fmul fast float %121, %121
-  %126 = fadd fast float %124, %125
-  %127 = fmul fast float %76, %76
-  %128 = fcmp fast ugt float %126, %127
-  br i1 %128, label %133, label %129
-
-; <label>:129                                     ; preds = %81
-  %130 = add i32 %69, 1
-  %131 = shl i32 %69, 2
-  %132 = add i32 %131, 4
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %11, i32 %132, i32 %70, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  br label %133
-
-; <label>:133                                     ; preds = %129, %81, %68
-  %134 = phi i32 [ %130, %129 ], [ %69, %81 ], [ %69, %68 ]
-  %135 = add i32 %70, 1
-  %136 = icmp ult i32 %134, 63
-  %137 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %4, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %138 = extractvalue %dx.types.CBufRet.i32 %137, 0
-  %139 = icmp ult i32 %135, %138
-  %140 = and i1 %136, %139
-  br i1 %140, label %68, label %141
-
-; <label>:141                                     ; preds = %133
-  br label %142
-
-; <label>:142                                     ; preds = %141, %0
-  %143 = phi i32 [ 0, %0 ], [ %134, %141 ]
-  call void @dx.op.bufferStore.i32(i32 69, %dx.types.Handle %1, i32 %11, i32 0, i32 %143, i32 undef, i32 undef, i32 undef, i8 1)  ; BufferStore(uav,coord0,coord1,value0,value1,value2,value3,mask)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.threadId.i32(i32, i32) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.binary.f32(i32, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32, %dx.types.Handle, i32, i32) #1
-
-; Function Attrs: nounwind
-declare void @dx.op.bufferStore.i32(i32, %dx.types.Handle, i32, i32, i32, i32, i32, i32, i8) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind readonly }
-attributes #2 = { nounwind }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.entryPoints = !{!14}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"cs", i32 6, i32 0}
-!4 = !{!5, !8, !11, null}
-!5 = !{!6}
-!6 = !{i32 0, %"class.StructuredBuffer<Light>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 32}
-!8 = !{!9}
-!9 = !{i32 0, %"class.RWStructuredBuffer<LightCluster>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i1 false, i1 false, i1 false, !10}
-!10 = !{i32 1, i32 256}
-!11 = !{!12, !13}
-!12 = !{i32 0, %lightBufferLength* undef, !"", i32 0, i32 0, i32 1, i32 4, null}
-!13 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!14 = !{void ()* @main, !"main", null, !4, !15}
-!15 = !{i32 0, i64 16, i32 4, !16}
-!16 = !{i32 16, i32 8, i32 8}
-
-#endif
-
-const unsigned char RINShaderBytesLightClusterCS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x2c, 0x1c, 0x25, 0x2b, 0x67, 0xdd, 0x7d, 0xfd,
-  0x0d, 0x09, 0xdd, 0xce, 0x2c, 0xee, 0xd6, 0xee, 0x01, 0x00, 0x00, 0x00,
-  0x8c, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00,
-  0xf4, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x4c, 0x0d, 0x00, 0x00,
-  0x68, 0x0d, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x4f, 0x53, 0x47, 0x31, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x50, 0x53, 0x56, 0x30, 0x7c, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x52, 0x54, 0x53, 0x30, 0x8c, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x53, 0x54, 0x41, 0x54,
-  0xbc, 0x0b, 0x00, 0x00, 0x60, 0x00, 0x05, 0x00, 0xef, 0x02, 0x00, 0x00,
-  0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xa4, 0x0b, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00,
-  0xe6, 0x02, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49,
-  0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19,
-  0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42,
-  0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62, 0x88,
-  0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42,
-  0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c,
-  0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07,
-  0x40, 0x02, 0xa8, 0x0d, 0x86, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20,
-  0x01, 0xd5, 0x06, 0x62, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x00,
-  0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42,
-  0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00,
-  0x84, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 0x04,
-  0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14,
-  0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 0xd8, 0xc1, 0x0c,
-  0xc0, 0x30, 0xc2, 0x00, 0xcc, 0x11, 0x80, 0xc1, 0x31, 0xd2, 0x14, 0x51,
-  0xc2, 0xe4, 0x97, 0x88, 0x71, 0x4c, 0x88, 0x08, 0x80, 0x40, 0x98, 0xa9,
-  0x1b, 0x07, 0x76, 0x08, 0x87, 0x79, 0x98, 0x07, 0x37, 0x98, 0x05, 0x7a,
-  0x90, 0x87, 0x7a, 0x18, 0x07, 0x7a, 0xa8, 0x07, 0x79, 0x28, 0x07, 0x72,
-  0x10, 0x85, 0x7a, 0x30, 0x07, 0x73, 0x28, 0x07, 0x79, 0xe0, 0x03, 0x56,
-  0x48, 0x87, 0x73, 0x40, 0x07, 0x7a, 0xf0, 0x03, 0x14, 0x0c, 0x44, 0xe4,
-  0x8f, 0x70, 0x93, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x25, 0x62, 0x1c, 0x13,
-  0xb7, 0x50, 0xd2, 0x44, 0x44, 0x48, 0x10, 0x8c, 0x99, 0xcc, 0x60, 0x1c,
-  0xd8, 0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x40, 0x16, 0x6e, 0x61, 0x16,
-  0xe8, 0x41, 0x1e, 0xea, 0x61, 0x1c, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c,
-  0xc8, 0x41, 0x14, 0xea, 0xc1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0x81, 0x0f,
-  0x58, 0x21, 0x1d, 0xce, 0x01, 0x1d, 0xe8, 0x61, 0x14, 0xd8, 0xa1, 0x1e,
-  0xe6, 0x81, 0x1e, 0xca, 0x41, 0x1e, 0xfc, 0x00, 0x05, 0x07, 0x21, 0xd7,
-  0x48, 0x53, 0x44, 0x09, 0x93, 0x5f, 0x12, 0x8d, 0x31, 0x1d, 0x28, 0x10,
-  0x2e, 0x5a, 0x10, 0xe3, 0x98, 0x36, 0xaa, 0x28, 0x88, 0xa8, 0x24, 0x1a,
-  0x63, 0x3a, 0x50, 0xa0, 0xd0, 0x32, 0x8c, 0x40, 0x00, 0x49, 0xd0, 0x5c,
-  0x18, 0x0c, 0x97, 0x0f, 0x2c, 0x88, 0xd1, 0x30, 0x44, 0x33, 0xf9, 0x0b,
-  0x61, 0x00, 0x02, 0xe6, 0x4b, 0x53, 0x44, 0x09, 0x93, 0xcf, 0x01, 0x0c,
-  0x11, 0x01, 0xc8, 0x71, 0x1c, 0xc7, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x03, 0x83, 0xe1, 0xf2, 0x81, 0x05, 0x31, 0x1a, 0x86, 0x68,
-  0x26, 0x7f, 0x21, 0x0c, 0x40, 0xc0, 0x7c, 0x01, 0x60, 0x88, 0x08, 0xd8,
-  0xa8, 0xa2, 0x20, 0x22, 0x14, 0x3c, 0x04, 0x8d, 0x00, 0x94, 0x40, 0xa2,
-  0xa9, 0x0c, 0x82, 0x20, 0x50, 0x55, 0x08, 0x40, 0x00, 0x00, 0xba, 0xca,
-  0x00, 0x08, 0x00, 0x65, 0x47, 0x0d, 0x97, 0x3f, 0x61, 0x0f, 0x21, 0xf9,
-  0xdc, 0x46, 0x15, 0x2b, 0x31, 0xf9, 0xc8, 0x6d, 0x23, 0x42, 0x10, 0x04,
-  0x61, 0x8e, 0x00, 0x21, 0xee, 0x9e, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24,
-  0x3f, 0x04, 0x9a, 0x61, 0x21, 0x50, 0xd0, 0x15, 0x62, 0x13, 0x3c, 0x81,
-  0xbe, 0xa3, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0x7c, 0x6e, 0xa3, 0x8a,
-  0x95, 0x98, 0xfc, 0xe2, 0xb6, 0x11, 0x01, 0x00, 0x00, 0x50, 0x88, 0x50,
-  0xf0, 0x04, 0x12, 0x4b, 0x01, 0x08, 0x00, 0x00, 0x10, 0x39, 0x47, 0x10,
-  0x14, 0xc3, 0x13, 0x38, 0x41, 0x30, 0xe9, 0xbc, 0x69, 0xb8, 0xfc, 0x09,
-  0x7b, 0x08, 0xc9, 0x5f, 0x09, 0x69, 0x25, 0x26, 0x1f, 0xb9, 0x6d, 0x54,
-  0x08, 0x82, 0x20, 0x08, 0xa5, 0x48, 0x05, 0x4f, 0x10, 0x48, 0xbd, 0x69,
-  0xb8, 0xfc, 0x09, 0x7b, 0x08, 0xc9, 0x5f, 0x09, 0x69, 0x25, 0x26, 0xbf,
-  0xb8, 0x6d, 0x54, 0x00, 0x00, 0x00, 0x08, 0xa5, 0x60, 0x05, 0x4f, 0x10,
-  0xa8, 0x2d, 0x8a, 0x24, 0x78, 0x82, 0x20, 0x08, 0x82, 0xc0, 0xd1, 0x3b,
-  0x10, 0x70, 0x96, 0xb0, 0x00, 0x92, 0xe4, 0x33, 0xc0, 0x14, 0x21, 0x97,
-  0x5f, 0x2c, 0x0e, 0x30, 0xf9, 0xb8, 0x8f, 0xa3, 0xc0, 0xb9, 0x46, 0x9a,
-  0x22, 0x4a, 0x98, 0x7c, 0x0e, 0x60, 0x88, 0x08, 0x40, 0x8e, 0x2c, 0xcb,
-  0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x23, 0x00, 0x0c,
-  0x11, 0x01, 0x1b, 0x55, 0x14, 0x44, 0x84, 0x82, 0x79, 0x8e, 0x00, 0x14,
-  0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87,
-  0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50,
-  0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0,
-  0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10,
-  0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0,
-  0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60,
-  0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a, 0x0f,
-  0xa4, 0x90, 0x21, 0x23, 0x45, 0x44, 0x00, 0x92, 0x01, 0x00, 0x13, 0x0d,
-  0x00, 0x98, 0x6b, 0x00, 0x00, 0x84, 0x02, 0x00, 0x18, 0xf2, 0x4c, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0xa9,
-  0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8,
-  0x73, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
-  0x90, 0x27, 0x03, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x21, 0xcf, 0x07, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x43, 0x1e, 0x31, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x21, 0x0f, 0x19, 0x00, 0x01, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0xe7, 0x0c, 0x80, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0xa3, 0x06, 0x40,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x69,
-  0x03, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0xf2, 0xbc, 0x01, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x64, 0x81, 0x00, 0x22, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18,
-  0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x12,
-  0x4a, 0x60, 0x04, 0xa0, 0x18, 0x0a, 0xa3, 0x80, 0x0a, 0x90, 0xa0, 0x10,
-  0x0a, 0x9c, 0xa0, 0x0c, 0xca, 0xa1, 0x14, 0x8a, 0xa0, 0x24, 0x0a, 0x30,
-  0xa0, 0x00, 0x05, 0x0a, 0x70, 0xa0, 0x30, 0x09, 0x0a, 0x94, 0xa0, 0x50,
-  0x09, 0x0a, 0x96, 0xa0, 0x70, 0x09, 0x0a, 0x98, 0xa0, 0x90, 0x09, 0x0a,
-  0x9a, 0xa0, 0xb0, 0x09, 0x0a, 0xa4, 0x70, 0x0a, 0xfd, 0xa1, 0x20, 0xca,
-  0x30, 0xa0, 0x48, 0x05, 0xa8, 0x2e, 0x10, 0x32, 0x47, 0x00, 0xa8, 0x98,
-  0x01, 0xa0, 0x63, 0x06, 0x80, 0x90, 0x19, 0x00, 0x4a, 0x66, 0x00, 0x48,
-  0x99, 0x01, 0xa0, 0x65, 0x06, 0x80, 0x98, 0x19, 0x00, 0x7a, 0x66, 0x00,
-  0x08, 0x9a, 0x01, 0xa0, 0x68, 0x06, 0x80, 0x88, 0x19, 0x00, 0x9a, 0x67,
-  0x00, 0x88, 0x9e, 0x01, 0xa0, 0x61, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90,
-  0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1,
-  0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41,
-  0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a,
-  0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9,
-  0x10, 0x04, 0x13, 0x04, 0xe1, 0x99, 0x20, 0x08, 0xd0, 0x06, 0x61, 0x20,
-  0x36, 0x08, 0x04, 0x41, 0x61, 0x6c, 0x6e, 0x82, 0x20, 0x44, 0x1b, 0x86,
-  0x03, 0x21, 0x26, 0x08, 0x05, 0x1c, 0x70, 0x61, 0x4b, 0x3b, 0x43, 0xa3,
-  0x13, 0xaa, 0x33, 0x33, 0x2b, 0x93, 0x9b, 0x20, 0x08, 0xd2, 0x04, 0x41,
-  0x98, 0x36, 0x08, 0x43, 0xb3, 0x21, 0x21, 0x94, 0x85, 0x20, 0x06, 0x86,
-  0x70, 0x36, 0x04, 0xcf, 0x04, 0x21, 0x99, 0x03, 0x4a, 0x6c, 0x69, 0x67,
-  0x68, 0x74, 0x43, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x42, 0x75, 0x66,
-  0x66, 0x65, 0x72, 0x13, 0x04, 0x33, 0x78, 0x83, 0x09, 0x82, 0x40, 0x6d,
-  0x10, 0x06, 0x6a, 0xc3, 0x42, 0x44, 0x12, 0x41, 0x0c, 0xcc, 0x34, 0x4d,
-  0xd5, 0x86, 0xc0, 0x9a, 0x20, 0x30, 0x76, 0xc0, 0x88, 0x2d, 0xed, 0x0c,
-  0x8d, 0x4e, 0xa8, 0xce, 0xcc, 0xac, 0x4c, 0x8e, 0xa9, 0xcc, 0xed, 0x8c,
-  0x0e, 0x6d, 0x82, 0x20, 0x54, 0x1b, 0x10, 0x02, 0xcb, 0x08, 0x62, 0xd0,
-  0x80, 0x09, 0x42, 0x94, 0x07, 0x64, 0xc6, 0xc2, 0xda, 0xca, 0xe4, 0xc2,
-  0x84, 0xea, 0xcc, 0xcc, 0xca, 0xe4, 0x26, 0x08, 0x82, 0xb5, 0x01, 0x19,
-  0xb8, 0x8e, 0x18, 0x06, 0x0f, 0xd8, 0x20, 0x6c, 0xdf, 0x06, 0x02, 0xba,
-  0xc0, 0x00, 0x98, 0x20, 0x28, 0x74, 0x40, 0x83, 0xad, 0xcc, 0xed, 0x8c,
-  0x0e, 0x6d, 0x82, 0x20, 0x5c, 0x13, 0x04, 0x01, 0x9b, 0x20, 0x08, 0xd9,
-  0x06, 0x03, 0x19, 0x03, 0x32, 0x20, 0xca, 0xc0, 0x0c, 0x36, 0x08, 0xda,
-  0x19, 0x4c, 0x10, 0xe6, 0x60, 0x0f, 0xa8, 0xd8, 0xa5, 0x95, 0xdd, 0x35,
-  0x85, 0xd1, 0xc9, 0xa5, 0xe1, 0x4d, 0x10, 0x04, 0x6d, 0xc3, 0xa0, 0x69,
-  0x6b, 0x30, 0x41, 0x10, 0xb6, 0x0d, 0x08, 0xa2, 0x06, 0x6b, 0xc0, 0x06,
-  0x64, 0x40, 0x94, 0x41, 0x1b, 0x50, 0x81, 0x93, 0x7b, 0x53, 0x6b, 0x0a,
-  0xa3, 0x93, 0x4b, 0xc3, 0x9b, 0x20, 0x08, 0xdc, 0x06, 0x04, 0x79, 0x83,
-  0x35, 0x60, 0x03, 0x32, 0x80, 0x83, 0x32, 0x68, 0x03, 0x36, 0x69, 0x6e,
-  0x76, 0x50, 0x72, 0x6f, 0x6a, 0x4d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x13,
-  0x04, 0xa1, 0xdb, 0x80, 0x20, 0x72, 0xb0, 0x06, 0x6c, 0x40, 0x06, 0x73,
-  0x50, 0x06, 0x6d, 0x40, 0xc7, 0x2e, 0xad, 0xec, 0x0e, 0x4a, 0xee, 0x4d,
-  0xad, 0x29, 0x8c, 0x4e, 0x2e, 0x0d, 0x6f, 0x82, 0x20, 0x78, 0x1b, 0x10,
-  0xa4, 0x0e, 0xd6, 0x80, 0x0d, 0xc8, 0xc0, 0x0e, 0xca, 0xa0, 0x0d, 0x88,
-  0xc0, 0xbd, 0xcd, 0xa5, 0xd1, 0xa5, 0xbd, 0xb9, 0x6d, 0x30, 0x10, 0x3c,
-  0x20, 0x03, 0xaa, 0x0c, 0xda, 0x80, 0x08, 0x5c, 0x18, 0x19, 0x59, 0x9a,
-  0xdb, 0x19, 0xcc, 0x04, 0x41, 0xf8, 0x36, 0x18, 0x88, 0x1e, 0x90, 0xc1,
-  0x1e, 0x94, 0x41, 0x1b, 0x30, 0x31, 0x93, 0xab, 0x9b, 0xa3, 0xab, 0x6b,
-  0xc3, 0xc2, 0x9a, 0x20, 0x08, 0x60, 0xb0, 0xc1, 0x40, 0xfa, 0x80, 0x0c,
-  0xfc, 0xa0, 0x0c, 0xda, 0x80, 0x89, 0x99, 0x5c, 0xdd, 0x1c, 0x5d, 0x5d,
-  0x1b, 0x96, 0xd6, 0x04, 0x41, 0x08, 0x83, 0x0d, 0x06, 0x02, 0x0a, 0x64,
-  0x10, 0x0a, 0x65, 0xd0, 0x06, 0x4c, 0xcc, 0xe4, 0xea, 0xe6, 0xe8, 0xea,
-  0xda, 0xb2, 0xb2, 0x26, 0x08, 0x82, 0x18, 0x6c, 0x30, 0x90, 0x51, 0x20,
-  0x03, 0x52, 0x28, 0x83, 0x36, 0x60, 0x62, 0x26, 0x57, 0x37, 0x47, 0x57,
-  0xd7, 0x96, 0xa5, 0x35, 0x41, 0x10, 0xc6, 0x60, 0x83, 0x81, 0x98, 0x02,
-  0x19, 0x9c, 0x42, 0x19, 0xb4, 0x01, 0x0b, 0xb7, 0xb2, 0x30, 0x39, 0xad,
-  0x09, 0x82, 0x40, 0x06, 0x1b, 0x0c, 0x24, 0x15, 0xc8, 0x40, 0x15, 0xca,
-  0xa0, 0x0d, 0x48, 0x98, 0x85, 0xc9, 0x69, 0x4d, 0x10, 0x84, 0x32, 0xd8,
-  0x60, 0x20, 0xac, 0x40, 0x06, 0xad, 0x50, 0x06, 0x6d, 0x40, 0x68, 0x8c,
-  0xad, 0x6e, 0x8e, 0xae, 0x4c, 0x6e, 0xe8, 0xcd, 0x6d, 0x8e, 0x2e, 0xcc,
-  0x8d, 0x2e, 0x68, 0x82, 0x20, 0x98, 0xc1, 0x06, 0x03, 0x79, 0x05, 0x32,
-  0x80, 0x85, 0x32, 0x68, 0x03, 0x42, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65,
-  0x72, 0x43, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x42, 0x13, 0x04,
-  0xe1, 0x0c, 0x36, 0x18, 0x88, 0x2c, 0x90, 0xc1, 0x2c, 0x94, 0x41, 0x1b,
-  0x6c, 0x78, 0x3c, 0x37, 0x88, 0x03, 0x3a, 0xb8, 0x83, 0x3c, 0xe0, 0x83,
-  0x3f, 0x10, 0x85, 0x52, 0x40, 0x85, 0x55, 0x70, 0x85, 0x58, 0xa0, 0x85,
-  0x09, 0x02, 0xa1, 0x07, 0x0c, 0xd0, 0x36, 0x10, 0xc8, 0x2d, 0x90, 0x01,
-  0x31, 0x41, 0x18, 0xfa, 0x60, 0x83, 0x40, 0xe4, 0xc2, 0x86, 0x40, 0x17,
-  0x36, 0x08, 0xc4, 0x2e, 0x6c, 0x18, 0x1a, 0x5c, 0xe0, 0x85, 0x0d, 0x06,
-  0x82, 0x07, 0x64, 0x40, 0x94, 0x41, 0x1b, 0xd0, 0x90, 0x0b, 0x23, 0x4b,
-  0xab, 0x9b, 0xdb, 0x60, 0x20, 0xbf, 0x40, 0x06, 0x4c, 0x19, 0xb4, 0x01,
-  0x8b, 0xb1, 0x37, 0xb6, 0x37, 0xb9, 0x09, 0x82, 0x80, 0x06, 0x1b, 0x0c,
-  0x24, 0x1c, 0xc8, 0x40, 0x1c, 0xca, 0xa0, 0x0d, 0x58, 0x98, 0xb1, 0x85,
-  0x9d, 0xcd, 0x4d, 0x10, 0x84, 0x34, 0xd8, 0x60, 0x20, 0xe4, 0x40, 0x06,
-  0xe5, 0x50, 0x06, 0x66, 0xb0, 0xa1, 0x68, 0x7c, 0x01, 0x1c, 0xc6, 0xc1,
-  0x1c, 0x26, 0x08, 0x88, 0x1c, 0x4c, 0x10, 0x04, 0x35, 0x98, 0x20, 0x1c,
-  0x71, 0xb0, 0x41, 0x20, 0xd4, 0x61, 0x43, 0xb0, 0x0e, 0x1b, 0x04, 0x82,
-  0x1d, 0x36, 0x0c, 0xe9, 0x80, 0x0b, 0xed, 0x40, 0x85, 0x2d, 0xed, 0x0c,
-  0x8d, 0x6e, 0xe8, 0xad, 0xce, 0x8d, 0x6e, 0x83, 0x81, 0xbc, 0x03, 0x19,
-  0x10, 0x65, 0x60, 0x06, 0x34, 0xd8, 0xd2, 0xce, 0xd0, 0xe8, 0xe6, 0x36,
-  0x18, 0x48, 0x3c, 0x90, 0x81, 0x38, 0x94, 0x81, 0x19, 0x6c, 0x18, 0xd2,
-  0x01, 0x1e, 0xe4, 0x61, 0x82, 0xb0, 0xd4, 0xc1, 0x06, 0x02, 0xc9, 0xc8,
-  0x80, 0xd8, 0x20, 0x68, 0xf5, 0x30, 0x41, 0xa0, 0x03, 0x3e, 0xd8, 0x40,
-  0x20, 0x1d, 0x19, 0x10, 0x1b, 0x04, 0x0f, 0x1f, 0x26, 0x08, 0xcf, 0x1d,
-  0x4c, 0x10, 0x20, 0x3c, 0xd8, 0x50, 0x11, 0x62, 0x80, 0x06, 0x69, 0x50,
-  0x0b, 0xb6, 0xd0, 0x0b, 0xb9, 0x70, 0x0e, 0xe8, 0xe0, 0x0e, 0xea, 0x30,
-  0x0f, 0xf4, 0x60, 0x0f, 0xf7, 0x90, 0x0f, 0xfa, 0x50, 0x0b, 0xfb, 0x90,
-  0x0f, 0x13, 0x04, 0x8a, 0xd8, 0x00, 0x6c, 0x18, 0x08, 0x7f, 0xf0, 0x87,
-  0x0d, 0xc1, 0x3f, 0x6c, 0x18, 0x86, 0x7e, 0x00, 0x09, 0x12, 0x6d, 0x61,
-  0x69, 0x6e, 0x13, 0x84, 0x3a, 0x70, 0x83, 0x09, 0x82, 0xb0, 0x06, 0x1b,
-  0x06, 0x71, 0x20, 0x09, 0x92, 0xd8, 0x40, 0x10, 0x23, 0xa1, 0x95, 0xc4,
-  0x86, 0xa2, 0x1f, 0x44, 0x02, 0x08, 0x03, 0x93, 0x20, 0x22, 0x26, 0x17,
-  0xe6, 0x36, 0x86, 0x56, 0x36, 0x47, 0xc3, 0x8c, 0xed, 0x2d, 0x8c, 0x6e,
-  0x6e, 0x82, 0x20, 0xb0, 0x01, 0x8b, 0x34, 0xb7, 0x39, 0xba, 0xb9, 0x09,
-  0x82, 0xd0, 0x06, 0x24, 0xd2, 0xdc, 0xe8, 0xe6, 0x88, 0xd0, 0x95, 0xe1,
-  0x7d, 0xb1, 0xbd, 0x85, 0x91, 0x31, 0xa1, 0x2b, 0xc3, 0xfb, 0x9a, 0xa3,
-  0x7b, 0x93, 0x2b, 0x63, 0x51, 0x97, 0xe6, 0x46, 0x37, 0xb7, 0xc1, 0x41,
-  0x09, 0x2d, 0x25, 0x54, 0x62, 0x25, 0x58, 0xa2, 0x25, 0x18, 0x97, 0x20,
-  0x83, 0x97, 0x58, 0x03, 0x98, 0x30, 0x83, 0x2a, 0x6c, 0x6c, 0x76, 0x6d,
-  0x2e, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x53, 0x82, 0xa0, 0x0a, 0x19, 0x9e,
-  0x8b, 0x5d, 0x99, 0xdc, 0x5c, 0xda, 0x9b, 0xdb, 0x94, 0x80, 0x68, 0x42,
-  0x86, 0xe7, 0x62, 0x17, 0xc6, 0x66, 0x57, 0x26, 0x37, 0x25, 0x28, 0xea,
-  0x90, 0xe1, 0xb9, 0xcc, 0xa1, 0x85, 0x91, 0x95, 0xc9, 0x35, 0xbd, 0x91,
-  0x95, 0xb1, 0x4d, 0x09, 0x90, 0x32, 0x64, 0x78, 0x2e, 0x72, 0x65, 0x73,
-  0x6f, 0x75, 0x72, 0x63, 0x65, 0x73, 0x53, 0x02, 0x30, 0xa8, 0x44, 0x86,
-  0xe7, 0x42, 0x97, 0x07, 0x57, 0x16, 0xe4, 0xe6, 0xf6, 0x46, 0x17, 0x46,
-  0x97, 0xf6, 0xe6, 0x36, 0x37, 0x45, 0xd8, 0x07, 0x90, 0xa8, 0x43, 0x86,
-  0xe7, 0x52, 0xe6, 0x46, 0x27, 0x97, 0x07, 0xf5, 0x96, 0xe6, 0x46, 0x37,
-  0x37, 0x25, 0x30, 0x89, 0x2e, 0x64, 0x78, 0x2e, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x65, 0x72, 0x73, 0x53, 0x02, 0x98, 0x00, 0x79, 0x18, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66,
-  0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07,
-  0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10,
-  0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce,
-  0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b,
-  0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c,
-  0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07,
-  0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11,
-  0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0,
-  0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8,
-  0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b,
-  0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b,
-  0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87,
-  0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07,
-  0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87,
-  0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81,
-  0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30,
-  0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4,
-  0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca,
-  0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39,
-  0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b,
-  0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b,
-  0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87,
-  0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20,
-  0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90,
-  0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00,
-  0x4e, 0x00, 0x00, 0x00, 0x05, 0xf0, 0x06, 0x81, 0x1f, 0x3b, 0x7d, 0x46,
-  0xd3, 0x85, 0x75, 0xb3, 0xb9, 0x2c, 0x07, 0x02, 0x67, 0xd6, 0x1f, 0x69,
-  0x4a, 0x97, 0xd7, 0xc7, 0xf4, 0xba, 0xbc, 0x4c, 0x16, 0xd6, 0xcd, 0xe6,
-  0xb2, 0x1c, 0x58, 0x65, 0xa6, 0xcf, 0x68, 0x3a, 0x10, 0x08, 0x04, 0x06,
-  0x2b, 0xe0, 0x0f, 0x02, 0x3f, 0x76, 0xfa, 0x8c, 0xa6, 0x0f, 0xd9, 0xf5,
-  0x39, 0xbd, 0x2c, 0x17, 0xd6, 0xcd, 0xe6, 0xb2, 0x1c, 0x08, 0x9c, 0x59,
-  0x7f, 0x24, 0xe9, 0x75, 0x4a, 0x97, 0xd7, 0xc7, 0xf4, 0xba, 0xbc, 0x4c,
-  0x16, 0xd6, 0xcd, 0xe6, 0xb2, 0x1c, 0x58, 0x65, 0xa6, 0xcf, 0x68, 0xfa,
-  0x90, 0x5d, 0x9f, 0xd3, 0xcb, 0x72, 0x20, 0x10, 0x08, 0x0c, 0xda, 0xc0,
-  0x24, 0x00, 0x0c, 0x11, 0x01, 0x1b, 0x55, 0x14, 0x44, 0xf4, 0x2f, 0x84,
-  0x01, 0x08, 0x98, 0x19, 0x40, 0xc3, 0xe5, 0x3b, 0x8f, 0x1f, 0x20, 0x0d,
-  0x10, 0x61, 0x7e, 0x71, 0xdb, 0xd6, 0x40, 0x0d, 0x97, 0xef, 0x3c, 0x7e,
-  0x40, 0x15, 0x05, 0x11, 0x95, 0x0e, 0x30, 0xf8, 0xc5, 0x6d, 0x1b, 0x03,
-  0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0,
-  0xe0, 0x23, 0xb7, 0x6d, 0x0e, 0xd5, 0x70, 0xf9, 0xce, 0xe3, 0x07, 0x54,
-  0x51, 0x10, 0x11, 0x3b, 0x39, 0x11, 0xe1, 0x23, 0xb7, 0x6d, 0x09, 0xdb,
-  0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0,
-  0x50, 0x12, 0x06, 0x20, 0x60, 0x7e, 0x71, 0xdb, 0x86, 0xb0, 0x0d, 0x97,
-  0xef, 0x3c, 0xbe, 0x10, 0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25,
-  0x61, 0x00, 0x02, 0xe6, 0x23, 0xb7, 0x6d, 0x0b, 0xd2, 0x70, 0xf9, 0xce,
-  0xe3, 0x0b, 0x11, 0x01, 0x4c, 0x44, 0x08, 0x34, 0xc3, 0x42, 0x98, 0x82,
-  0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x13, 0x11, 0x4d, 0x08, 0x10, 0x61, 0x7e,
-  0x71, 0xdb, 0x56, 0x20, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0x74, 0x44, 0x04,
-  0x30, 0x88, 0x83, 0x8f, 0xdc, 0xb6, 0x1d, 0x3c, 0xc3, 0xe5, 0x3b, 0x8f,
-  0x4f, 0x35, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x9b, 0x40, 0xb4, 0x20, 0xc6,
-  0x31, 0x6d, 0x54, 0x51, 0x10, 0x51, 0x49, 0x34, 0xc6, 0x74, 0x18, 0x01,
-  0xc1, 0x00, 0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xbb, 0xfe, 0x43,
-  0x4d, 0x11, 0x04, 0xaf, 0xf1, 0x34, 0x90, 0x63, 0xc6, 0x76, 0x37, 0xf9,
-  0x44, 0x58, 0x49, 0x4c, 0x1c, 0x0b, 0x00, 0x00, 0x60, 0x00, 0x05, 0x00,
-  0xc7, 0x02, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde,
-  0x21, 0x0c, 0x00, 0x00, 0xbe, 0x02, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91,
-  0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c,
-  0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02,
-  0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b,
-  0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5,
-  0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50,
-  0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06,
-  0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff,
-  0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x86, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0x03, 0x20, 0x01, 0xd5, 0x06, 0x62, 0xf8, 0xff, 0xff, 0xff,
-  0xff, 0x01, 0x90, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x89, 0x20, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09,
-  0x20, 0x64, 0x85, 0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3,
-  0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c,
-  0x10, 0xd0, 0xc1, 0x08, 0x40, 0x09, 0x00, 0x0a, 0xe6, 0x08, 0xc0, 0xa0,
-  0x0c, 0xc3, 0x30, 0x10, 0x31, 0x03, 0x50, 0x08, 0x63, 0x30, 0x0c, 0x3a,
-  0xca, 0x60, 0x0c, 0x06, 0x25, 0x47, 0x0d, 0x97, 0x3f, 0x61, 0x0f, 0x21,
-  0xf9, 0xdc, 0x46, 0x15, 0x2b, 0x31, 0xf9, 0xc8, 0x6d, 0x23, 0x62, 0x18,
-  0x86, 0x61, 0x8e, 0x00, 0x21, 0xe6, 0x9e, 0xe1, 0xf2, 0x27, 0xec, 0x21,
-  0x24, 0x3f, 0x04, 0x9a, 0x61, 0x21, 0x50, 0xd0, 0x14, 0x62, 0x19, 0x9c,
-  0x81, 0x9e, 0xa3, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0x7c, 0x6e, 0xa3,
-  0x8a, 0x95, 0x98, 0xfc, 0xe2, 0xb6, 0x11, 0x61, 0x18, 0x86, 0x51, 0x88,
-  0x68, 0x70, 0x06, 0x92, 0x4a, 0x61, 0x0c, 0x86, 0x61, 0x10, 0x35, 0x47,
-  0x10, 0x14, 0xc3, 0x19, 0x98, 0x61, 0xb0, 0xe8, 0xba, 0x69, 0xb8, 0xfc,
-  0x09, 0x7b, 0x08, 0xc9, 0x5f, 0x09, 0x69, 0x25, 0x26, 0x1f, 0xb9, 0x6d,
-  0x54, 0x0c, 0xc3, 0x30, 0x0c, 0xa5, 0xc8, 0x06, 0x67, 0x18, 0x48, 0xbb,
-  0x69, 0xb8, 0xfc, 0x09, 0x7b, 0x08, 0xc9, 0x5f, 0x09, 0x69, 0x25, 0x26,
-  0xbf, 0xb8, 0x6d, 0x54, 0x18, 0x86, 0x61, 0x0c, 0xa5, 0xe0, 0x06, 0x67,
-  0x18, 0xa8, 0x2b, 0x0a, 0x30, 0x38, 0xc3, 0x30, 0x0c, 0xc3, 0xc0, 0xd0,
-  0x37, 0x10, 0x30, 0x8c, 0x30, 0x18, 0xc7, 0x48, 0x53, 0x44, 0x09, 0x93,
-  0x5f, 0x22, 0xc6, 0x31, 0x21, 0x42, 0x34, 0xc4, 0x61, 0xa6, 0x6e, 0x1c,
-  0xd8, 0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x60, 0x16, 0xe8, 0x41, 0x1e,
-  0xea, 0x61, 0x1c, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xc8, 0x41, 0x14,
-  0xea, 0xc1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0x81, 0x0f, 0x58, 0x21, 0x1d,
-  0xce, 0x01, 0x1d, 0xe8, 0xc1, 0x0f, 0x50, 0x30, 0x12, 0x99, 0x3f, 0xc3,
-  0x4d, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0x97, 0x88, 0x71, 0x4c, 0xdc, 0x42,
-  0x49, 0x13, 0x11, 0x21, 0x61, 0x30, 0x67, 0x32, 0x83, 0x71, 0x60, 0x87,
-  0x70, 0x98, 0x87, 0x79, 0x70, 0x03, 0x59, 0xb8, 0x85, 0x59, 0xa0, 0x07,
-  0x79, 0xa8, 0x87, 0x71, 0xa0, 0x87, 0x7a, 0x90, 0x87, 0x72, 0x20, 0x07,
-  0x51, 0xa8, 0x07, 0x73, 0x30, 0x87, 0x72, 0x90, 0x07, 0x3e, 0x60, 0x85,
-  0x74, 0x38, 0x07, 0x74, 0xa0, 0x87, 0x51, 0x60, 0x87, 0x7a, 0x98, 0x07,
-  0x7a, 0x28, 0x07, 0x79, 0xf0, 0x03, 0x14, 0x9c, 0x84, 0x5e, 0x23, 0x4d,
-  0x11, 0x25, 0x4c, 0x7e, 0x49, 0x34, 0xc6, 0x74, 0xa0, 0x60, 0xb8, 0x68,
-  0x41, 0x8c, 0x63, 0xda, 0xa8, 0xa2, 0x20, 0xa2, 0x92, 0x68, 0x8c, 0xe9,
-  0x40, 0x81, 0x4a, 0xeb, 0x30, 0x02, 0x61, 0x24, 0x41, 0x7b, 0x61, 0x30,
-  0x5c, 0x3e, 0xb0, 0x20, 0x46, 0xc3, 0x10, 0xcd, 0xe4, 0x2f, 0x84, 0x01,
-  0x08, 0x98, 0x2f, 0x4d, 0x11, 0x25, 0x4c, 0x3e, 0x07, 0x30, 0x44, 0x04,
-  0x20, 0xc7, 0x75, 0x5d, 0x57, 0x34, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30,
-  0x0e, 0x0c, 0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68, 0x18, 0xa2, 0x99, 0xfc,
-  0x85, 0x30, 0x00, 0x01, 0xf3, 0x05, 0x80, 0x21, 0x22, 0x60, 0xa3, 0x8a,
-  0x82, 0x88, 0x50, 0xf0, 0x12, 0x3c, 0x47, 0x00, 0x0a, 0x53, 0x00, 0x00,
-  0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79,
-  0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e,
-  0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07,
-  0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07,
-  0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x04, 0x10, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x0e, 0x20,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x24,
-  0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4,
-  0x79, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0xc8, 0x23, 0x01, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc0, 0x90, 0x87, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x21, 0xcf, 0x05, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x43, 0x1e, 0x0d, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x1d, 0x10, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x3e, 0x20, 0x00, 0x06, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x01, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x14, 0x19, 0x11, 0x4c, 0x90,
-  0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x1a, 0x4a, 0x60, 0x04, 0xa0,
-  0x18, 0x0a, 0xa3, 0x80, 0x0a, 0x90, 0xa0, 0x10, 0x0a, 0x9c, 0xa0, 0x40,
-  0x0a, 0x82, 0xac, 0x11, 0x00, 0x92, 0x0b, 0x84, 0xd2, 0x19, 0x00, 0x62,
-  0x67, 0x00, 0x28, 0x9e, 0x01, 0xa0, 0x72, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90,
-  0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1,
-  0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41,
-  0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a,
-  0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9,
-  0x10, 0x04, 0x13, 0x84, 0x61, 0x99, 0x20, 0x0c, 0xcc, 0x06, 0x61, 0x20,
-  0x26, 0x08, 0x43, 0xb3, 0x41, 0x18, 0x0c, 0x0a, 0x63, 0x73, 0x1b, 0x06,
-  0xc4, 0x20, 0x26, 0x08, 0x65, 0xa0, 0x11, 0x98, 0x20, 0x0c, 0xce, 0x04,
-  0x61, 0x78, 0x36, 0x08, 0x43, 0xb3, 0x21, 0x21, 0x94, 0x85, 0x20, 0x06,
-  0x86, 0x70, 0x36, 0x04, 0xcf, 0x04, 0x21, 0x0d, 0xae, 0x09, 0x82, 0x55,
-  0x4d, 0x10, 0x06, 0x68, 0x83, 0x30, 0x4c, 0x1b, 0x16, 0x22, 0x5a, 0x08,
-  0x62, 0x60, 0x24, 0x49, 0xa2, 0x36, 0x04, 0xd5, 0x04, 0x81, 0x0d, 0xb0,
-  0x09, 0xc2, 0x10, 0x6d, 0x40, 0x88, 0x6b, 0x21, 0x88, 0x01, 0x03, 0x26,
-  0x08, 0x71, 0x90, 0x4d, 0x10, 0x06, 0x69, 0x03, 0x32, 0x68, 0x0b, 0x31,
-  0x0c, 0x1b, 0xb0, 0x41, 0xc8, 0xb8, 0x0d, 0x04, 0x64, 0x75, 0xc0, 0x04,
-  0x41, 0x00, 0x48, 0xb4, 0x85, 0xa5, 0xb9, 0x4d, 0x10, 0xe4, 0xc0, 0x9a,
-  0x20, 0x0c, 0xd3, 0x04, 0x61, 0xa0, 0x36, 0x0c, 0x62, 0x30, 0x06, 0x63,
-  0xb0, 0x81, 0x20, 0xc2, 0x00, 0x23, 0x83, 0x0d, 0xc5, 0x07, 0x06, 0x80,
-  0x57, 0x06, 0x55, 0xd8, 0xd8, 0xec, 0xda, 0x5c, 0xd2, 0xc8, 0xca, 0xdc,
-  0xe8, 0xa6, 0x04, 0x41, 0x15, 0x32, 0x3c, 0x17, 0xbb, 0x32, 0xb9, 0xb9,
-  0xb4, 0x37, 0xb7, 0x29, 0x01, 0xd1, 0x84, 0x0c, 0xcf, 0xc5, 0x2e, 0x8c,
-  0xcd, 0xae, 0x4c, 0x6e, 0x4a, 0x60, 0xd4, 0x21, 0xc3, 0x73, 0x99, 0x43,
-  0x0b, 0x23, 0x2b, 0x93, 0x6b, 0x7a, 0x23, 0x2b, 0x63, 0x9b, 0x12, 0x20,
-  0x65, 0xc8, 0xf0, 0x5c, 0xe4, 0xca, 0xe6, 0xde, 0xea, 0xe4, 0xc6, 0xca,
-  0xe6, 0xa6, 0x04, 0x5d, 0x1d, 0x32, 0x3c, 0x97, 0x32, 0x37, 0x3a, 0xb9,
-  0x3c, 0xa8, 0xb7, 0x34, 0x37, 0xba, 0xb9, 0x29, 0x41, 0x19, 0x00, 0x00,
-  0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c,
-  0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3,
-  0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6,
-  0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e,
-  0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43,
-  0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03,
-  0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48,
-  0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20,
-  0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e,
-  0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d,
-  0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89,
-  0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83,
-  0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68,
-  0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90,
-  0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78,
-  0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98,
-  0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5,
-  0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c,
-  0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c,
-  0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43,
-  0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43,
-  0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82,
-  0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70,
-  0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8,
-  0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2,
-  0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00,
-  0x71, 0x20, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x0d, 0x97,
-  0xef, 0x3c, 0x7e, 0x80, 0x34, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x5b, 0x02,
-  0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0,
-  0xe0, 0x17, 0xb7, 0x6d, 0x08, 0xd4, 0x70, 0xf9, 0xce, 0xe3, 0x07, 0x54,
-  0x51, 0x10, 0x51, 0xe9, 0x00, 0x83, 0x8f, 0xdc, 0xb6, 0x29, 0x54, 0xc3,
-  0xe5, 0x3b, 0x8f, 0x1f, 0x50, 0x45, 0x41, 0x44, 0xec, 0xe4, 0x44, 0x84,
-  0x8f, 0xdc, 0xb6, 0x15, 0x6c, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x04, 0x54,
-  0x51, 0x10, 0x51, 0xe9, 0x00, 0x43, 0x49, 0x18, 0x80, 0x80, 0xf9, 0xc5,
-  0x6d, 0x1b, 0xc1, 0x36, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x40, 0x15, 0x05,
-  0x11, 0x95, 0x0e, 0x30, 0x94, 0x84, 0x01, 0x08, 0x98, 0x8f, 0xdc, 0xb6,
-  0x1d, 0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x44, 0x04, 0x30, 0x11, 0x21,
-  0xd0, 0x0c, 0x0b, 0x61, 0x06, 0xd2, 0x70, 0xf9, 0xce, 0xe3, 0x4f, 0x44,
-  0x34, 0x21, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x5b, 0x80, 0x34, 0x5c, 0xbe,
-  0xf3, 0xf8, 0xd3, 0x11, 0x11, 0xc0, 0x20, 0x0e, 0x3e, 0x72, 0xdb, 0x36,
-  0xf0, 0x0c, 0x97, 0xef, 0x3c, 0x3e, 0xd5, 0x00, 0x11, 0xe6, 0x17, 0xb7,
-  0x6d, 0x00, 0x04, 0x03, 0x20, 0x0d, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00,
-  0xfc, 0x00, 0x00, 0x00, 0x13, 0x04, 0x48, 0x2c, 0x10, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x00, 0x00, 0x34, 0x94, 0x5d, 0x19, 0x15, 0xd7, 0x0c, 0x40,
-  0xc9, 0x95, 0x6e, 0x40, 0x11, 0x14, 0x62, 0x40, 0xa9, 0x14, 0x52, 0x29,
-  0x06, 0x94, 0x43, 0x91, 0x94, 0x4b, 0x49, 0x14, 0x4e, 0x19, 0x94, 0x1f,
-  0x31, 0x23, 0x00, 0x45, 0x50, 0x02, 0x64, 0x8c, 0x11, 0x80, 0x20, 0x08,
-  0x82, 0xa0, 0x30, 0x46, 0x00, 0x82, 0x20, 0x08, 0x7e, 0x63, 0x04, 0x20,
-  0x08, 0x82, 0xe8, 0x37, 0x46, 0xb0, 0xd6, 0x6a, 0x2d, 0x7b, 0x23, 0x00,
-  0x63, 0x04, 0x20, 0x08, 0x82, 0xf8, 0x2f, 0x00, 0x23, 0x06, 0x09, 0x00,
-  0x82, 0x60, 0x70, 0xbd, 0xc1, 0x75, 0xa8, 0x81, 0x1a, 0x84, 0xc1, 0x88,
-  0x41, 0x02, 0x80, 0x20, 0x18, 0x5c, 0x70, 0x80, 0x29, 0x6b, 0xb0, 0x06,
-  0x62, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x57, 0x1c, 0x64, 0x4a,
-  0x1b, 0xb4, 0xc1, 0x18, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0xc1, 0x25,
-  0x07, 0xda, 0xd2, 0x06, 0x6d, 0x40, 0x06, 0x23, 0x06, 0x06, 0x00, 0x82,
-  0x60, 0x40, 0xe4, 0x81, 0xe6, 0x06, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60,
-  0x40, 0xe8, 0xc1, 0x06, 0x07, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60, 0x40,
-  0xec, 0x01, 0xb7, 0x95, 0xc0, 0x06, 0x57, 0x01, 0x01, 0x35, 0x64, 0x57,
-  0x42, 0x00, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0x20, 0xf1, 0x81, 0x19,
-  0x24, 0xda, 0x68, 0x42, 0x10, 0x8c, 0x26, 0x08, 0xc0, 0x21, 0x46, 0x59,
-  0x20, 0xc9, 0xc7, 0x88, 0x81, 0x3e, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60,
-  0x90, 0x90, 0xc2, 0x17, 0xd8, 0x10, 0xc8, 0x67, 0xc4, 0xc0, 0x00, 0x40,
-  0x10, 0x0c, 0x12, 0x53, 0x30, 0x83, 0xc0, 0x82, 0x43, 0x3e, 0xf5, 0x80,
-  0x02, 0x5c, 0x60, 0x94, 0x05, 0x9a, 0x7c, 0x2c, 0x38, 0xe4, 0x33, 0x62,
-  0x60, 0x00, 0x20, 0x08, 0x06, 0x09, 0x2b, 0xb0, 0x41, 0x60, 0x41, 0x23,
-  0x1f, 0x0b, 0x83, 0x23, 0x3e, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0x20,
-  0xb5, 0xc2, 0x1d, 0x68, 0x7e, 0x30, 0x9a, 0x10, 0x00, 0x23, 0x06, 0x07,
-  0x00, 0x82, 0x60, 0x20, 0xbd, 0x42, 0x1e, 0x70, 0x6b, 0x30, 0x9a, 0x10,
-  0x04, 0x36, 0x14, 0xf2, 0x31, 0xc1, 0x90, 0x8f, 0xa1, 0x01, 0x12, 0x1f,
-  0x33, 0x02, 0xf9, 0x58, 0x21, 0xc8, 0xe7, 0xc2, 0xc0, 0xa8, 0x0b, 0x03,
-  0xa3, 0x4c, 0x60, 0x03, 0xf9, 0x98, 0xc0, 0x06, 0xf2, 0x31, 0x41, 0x0d,
-  0xe0, 0x63, 0xc2, 0x1a, 0xc0, 0xa7, 0xce, 0xc0, 0x16, 0xa0, 0xce, 0xe0,
-  0x16, 0xe0, 0x04, 0xa3, 0x4e, 0x30, 0xca, 0x04, 0x3a, 0x90, 0x8f, 0x09,
-  0x74, 0x20, 0x1f, 0x13, 0xe4, 0x00, 0x3e, 0x26, 0xcc, 0x01, 0x7c, 0x6c,
-  0x52, 0xe4, 0x63, 0x93, 0x22, 0x1f, 0xab, 0x08, 0xf9, 0x58, 0x45, 0xc8,
-  0xc7, 0x28, 0x47, 0x3e, 0x46, 0x39, 0xf2, 0x31, 0x0b, 0x91, 0x8f, 0x59,
-  0x88, 0x7c, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0xe0, 0x78, 0x87, 0x56,
-  0x40, 0x88, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0x38, 0xe0, 0xc1, 0x15,
-  0x10, 0x62, 0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0x8e, 0x78, 0xb8, 0x05,
-  0x84, 0x18, 0x31, 0x38, 0x00, 0x10, 0x04, 0x83, 0x43, 0x1e, 0x70, 0x01,
-  0x21, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0xe0, 0x89, 0x07, 0x5d, 0xe0,
-  0x83, 0x74, 0x18, 0x4d, 0x08, 0x80, 0xe1, 0x86, 0x60, 0x1d, 0xc0, 0x60,
-  0x96, 0xe1, 0x08, 0x82, 0x59, 0x02, 0x61, 0xa0, 0x62, 0xe8, 0x87, 0x02,
-  0x37, 0x82, 0x81, 0x8a, 0xa1, 0x1f, 0x0a, 0xdd, 0x08, 0x46, 0x0c, 0x10,
-  0x00, 0x04, 0xc1, 0xa0, 0x8b, 0x07, 0x5c, 0x18, 0x85, 0xc0, 0x1d, 0x46,
-  0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x06, 0x61, 0xc4, 0x00,
-  0x01, 0x40, 0x10, 0x0c, 0xba, 0x7a, 0xe0, 0x85, 0x53, 0x28, 0xe0, 0x61,
-  0x34, 0x21, 0x00, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0x40, 0xc3, 0x07,
-  0x5f, 0x48, 0x85, 0xc3, 0x16, 0x46, 0x13, 0x02, 0xa0, 0x82, 0x7b, 0xd0,
-  0xe1, 0x86, 0xe0, 0x1e, 0xc0, 0x60, 0x96, 0xa1, 0x18, 0x82, 0x11, 0x83,
-  0x03, 0x00, 0x41, 0x30, 0x90, 0xfe, 0x21, 0x1d, 0x58, 0x01, 0x1f, 0x46,
-  0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x06, 0x61, 0xc4, 0xe0,
-  0x00, 0x40, 0x10, 0x0c, 0xa4, 0x91, 0x68, 0x07, 0x58, 0xe8, 0x87, 0xd1,
-  0x84, 0x00, 0x18, 0x4d, 0x10, 0x82, 0xd1, 0x84, 0x41, 0x18, 0x31, 0x38,
-  0x00, 0x10, 0x04, 0x03, 0xe9, 0x24, 0xe2, 0x81, 0x16, 0xd6, 0x61, 0x34,
-  0x21, 0x00, 0x46, 0x13, 0x84, 0x60, 0x34, 0x61, 0x10, 0x46, 0x0c, 0x0e,
-  0x00, 0x04, 0xc1, 0x40, 0x5a, 0x89, 0x7a, 0xc0, 0x85, 0x72, 0x18, 0x4d,
-  0x08, 0x80, 0xd1, 0x04, 0x21, 0x18, 0x4d, 0x18, 0x04, 0x7b, 0x32, 0xf9,
-  0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x01, 0xf5, 0x12, 0xf8, 0xc0, 0x64,
-  0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x50, 0x30, 0x91, 0x0f, 0x49,
-  0x16, 0x58, 0x60, 0x40, 0xc7, 0xa4, 0x4e, 0x3e, 0x23, 0x06, 0x08, 0x00,
-  0x82, 0x60, 0x40, 0xcd, 0x04, 0x3f, 0x3c, 0x5d, 0x30, 0x62, 0x80, 0x00,
-  0x20, 0x08, 0x06, 0x14, 0x4d, 0xf4, 0x03, 0xd3, 0x05, 0x16, 0x24, 0xd0,
-  0xb1, 0x2a, 0x0c, 0xe4, 0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0xd4,
-  0x4d, 0x80, 0x84, 0x14, 0x06, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18,
-  0x50, 0x38, 0x11, 0x12, 0x4f, 0x18, 0x04, 0x16, 0x30, 0xd0, 0xb1, 0x37,
-  0x48, 0xe2, 0x63, 0x8a, 0x1b, 0xc4, 0x67, 0xc4, 0xe0, 0x00, 0x40, 0x10,
-  0x0c, 0x0e, 0xb0, 0x30, 0x89, 0x40, 0x18, 0x31, 0x38, 0x00, 0x10, 0x04,
-  0x83, 0x23, 0x2c, 0x4e, 0x22, 0x78, 0x07, 0x93, 0x83, 0x24, 0x3e, 0xa6,
-  0xc4, 0x41, 0x7c, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0xe0, 0x20, 0x0b,
-  0x95, 0x08, 0x84, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0x38, 0xca, 0x62,
-  0x25, 0x82, 0x79, 0x30, 0x5c, 0x48, 0xe2, 0x63, 0xca, 0x2f, 0xc4, 0x67,
-  0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0x0e, 0xb4, 0x70, 0x89, 0x40, 0x18,
-  0x31, 0x38, 0x00, 0x10, 0x04, 0x83, 0x23, 0x2d, 0x5e, 0x22, 0xb8, 0x07,
-  0x4b, 0x12, 0xf9, 0x98, 0x61, 0xc8, 0xc7, 0x02, 0x01, 0x3e, 0x46, 0x10,
-  0xf2, 0x31, 0x21, 0x80, 0x8f, 0xc9, 0x81, 0x1c, 0xc8, 0x67, 0x38, 0x42,
-  0x08, 0x94, 0x6f, 0x96, 0xa1, 0x20, 0x82, 0xda, 0x03, 0xb4, 0x80, 0xe2,
-  0x83, 0x99, 0xb8, 0x0a, 0xc8, 0x02, 0x46, 0x0c, 0x1a, 0x00, 0x04, 0xc1,
-  0xe0, 0x63, 0x8b, 0x98, 0x00, 0x09, 0x7b, 0x08, 0xfa, 0x00, 0x27, 0x70,
-  0x02, 0x27, 0x4e, 0x62, 0x96, 0xa0, 0x18, 0xe8, 0x18, 0x0c, 0x82, 0x1f,
-  0x06, 0x7e, 0x10, 0xca, 0x0f, 0xd8, 0x02, 0x86, 0x1b, 0x04, 0x96, 0x20,
-  0x83, 0x11, 0x83, 0x03, 0x00, 0x41, 0x30, 0x78, 0xea, 0xc2, 0x27, 0x40,
-  0xa2, 0x2d, 0x46, 0x13, 0x02, 0x60, 0xb8, 0x81, 0x08, 0xc8, 0xa0, 0x88,
-  0x40, 0x67, 0x19, 0x04, 0x23, 0x98, 0x25, 0x38, 0x06, 0x2a, 0x06, 0x71,
-  0x01, 0x1c, 0x63, 0xc4, 0xa0, 0x01, 0x40, 0x10, 0x0c, 0x3e, 0xba, 0xc8,
-  0x09, 0x94, 0xf0, 0x07, 0xb9, 0x08, 0xc0, 0x02, 0x2c, 0xc0, 0xe2, 0x25,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
@@ -1,1341 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; POSITION                 0   xyz         0     NONE   float   xyz 
-; NORMAL                   0   xyzw        1     NONE   float   xyzw
-; TANGENT                  0   xyzw        2     NONE   float   xyzw
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float   xyzw
-; POSITION                 0   xyzw        1     NONE   float   xyzw
-; POSITION                 1   xyz         2     NONE   float   xyz 
-; TBN_MATRIX               0   xyz         3     NONE   float   xyz 
-; TBN_MATRIX               1   xyz         4     NONE   float   xyz 
-; TBN_MATRIX               2   xyz         5     NONE   float   xyz 
-; TEXCOORD                 0   xy          6     NONE   float   xy  
-; MATERIAL                 0   x           7     NONE    uint   x   
-; MATERIAL                 1    y          7     NONE    uint    y  
-; MATERIAL                 2     z         7     NONE    uint     z 
-; MATERIAL                 3      w        7     NONE    uint      w
-; MATERIAL                 4   x           8     NONE    uint   x   
-; MATERIAL                 5    y          8     NONE    uint    y  
-; OBJECT_FLAGS             0     z         8     NONE    uint     z 
-;
-; shader hash: 59801c7b4da2c518dfe1b112427e7cf1
-;
-; Pipeline Runtime Information: 
-;
-; Vertex Shader
-; OutputPositionPresent=1
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; POSITION                 0                              
-; NORMAL                   0                              
-; TANGENT                  0                              
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; POSITION                 0                 linear       
-; POSITION                 1                 linear       
-; TBN_MATRIX               0                 linear       
-; TEXCOORD                 0                 linear       
-; MATERIAL                 0        nointerpolation       
-; MATERIAL                 1        nointerpolation       
-; MATERIAL                 2        nointerpolation       
-; MATERIAL                 3        nointerpolation       
-; MATERIAL                 4        nointerpolation       
-; MATERIAL                 5        nointerpolation       
-; OBJECT_FLAGS             0        nointerpolation       
-;
-; Buffer Definitions:
-;
-; cbuffer rootConstants
-; {
-;
-;   struct rootConstants
-;   {
-;
-;       struct struct.RootConstants
-;       {
-;
-;           uint objectID;                            ; Offset:    0
-;       
-;       } rootConstants;                              ; Offset:    0
-;
-;   
-;   } rootConstants;                                  ; Offset:    0 Size:     4
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for dynamicObjectBuffer
-; {
-;
-;   struct dx.alignment.legacy.struct.DynamicObject
-;   {
-;
-;       column_major float4x4 worldMatrix;            ; Offset:    0
-;       column_major float4x4 invWorldMatrix;         ; Offset:   64
-;       struct struct.BoundingSphere
-;       {
-;
-;           float3 center;                            ; Offset:  128
-;           float radius;                             ; Offset:  140
-;       
-;       } boundingSphere;                             ; Offset:  128
-;
-;       struct struct.LOD
-;       {
-;
-;           uint startIndex;                          ; Offset:  144
-;           uint indexCount;                          ; Offset:  148
-;           uint vertexOffset;                        ; Offset:  152
-;       
-;       } lods[3];;                                   ; Offset:  144
-;
-;       struct struct.Material
-;       {
-;
-;           uint baseColorID;                         ; Offset:  180
-;           uint normalID;                            ; Offset:  184
-;           uint roughnessAOID;                       ; Offset:  188
-;           uint metallicID;                          ; Offset:  192
-;           uint heightID;                            ; Offset:  196
-;           uint specialID;                           ; Offset:  200
-;       
-;       } material;                                   ; Offset:  180
-;
-;       uint flags;                                   ; Offset:  204
-;   
-;   } $Element;                                       ; Offset:    0 Size:   208
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; rootConstants                     cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; dynamicObjectBuffer               texture  struct         r/o      T0             t0     1
-;
-;
-; ViewId state:
-;
-; Number of inputs: 12, outputs: 35
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 0, 1, 2 }
-;   output 1 depends on inputs: { 0, 1, 2 }
-;   output 2 depends on inputs: { 0, 1, 2 }
-;   output 3 depends on inputs: { 0, 1, 2 }
-;   output 4 depends on inputs: { 0, 1, 2 }
-;   output 5 depends on inputs: { 0, 1, 2 }
-;   output 6 depends on inputs: { 0, 1, 2 }
-;   output 7 depends on inputs: { 0, 1, 2 }
-;   output 8 depends on inputs: { 0, 1, 2 }
-;   output 9 depends on inputs: { 0, 1, 2 }
-;   output 10 depends on inputs: { 0, 1, 2 }
-;   output 12 depends on inputs: { 8, 9, 10 }
-;   output 13 depends on inputs: { 4, 5, 6, 8, 9, 10 }
-;   output 14 depends on inputs: { 4, 5, 6 }
-;   output 16 depends on inputs: { 8, 9, 10 }
-;   output 17 depends on inputs: { 4, 5, 6, 8, 9, 10 }
-;   output 18 depends on inputs: { 4, 5, 6 }
-;   output 20 depends on inputs: { 8, 9, 10 }
-;   output 21 depends on inputs: { 4, 5, 6, 8, 9, 10 }
-;   output 22 depends on inputs: { 4, 5, 6 }
-;   output 24 depends on inputs: { 7 }
-;   output 25 depends on inputs: { 11 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%"dx.alignment.legacy.class.StructuredBuffer<DynamicObject>" = type { %dx.alignment.legacy.struct.DynamicObject }
-%dx.alignment.legacy.struct.DynamicObject = type { [4 x <4 x float>], [4 x <4 x float>], %struct.BoundingSphere, [3 x %struct.LOD], %struct.Material, i32 }
-%struct.BoundingSphere = type { <3 x float>, float }
-%struct.LOD = type { i32, i32, i32 }
-%struct.Material = type { i32, i32, i32, i32, i32, i32 }
-%rootConstants = type { %struct.RootConstants }
-%struct.RootConstants = type { i32 }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %5 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %6 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %7 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %8 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %9 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %10 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %11 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %12 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %13 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %14 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %15 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %3, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %16 = extractvalue %dx.types.CBufRet.i32 %15, 0
-  %17 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %16, i32 0)  ; BufferLoad(srv,index,wot)
-  %18 = extractvalue %dx.types.ResRet.f32 %17, 0
-  %19 = extractvalue %dx.types.ResRet.f32 %17, 1
-  %20 = extractvalue %dx.types.ResRet.f32 %17, 2
-  %21 = extractvalue %dx.types.ResRet.f32 %17, 3
-  %22 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %16, i32 16)  ; BufferLoad(srv,index,wot)
-  %23 = extractvalue %dx.types.ResRet.f32 %22, 0
-  %24 = extractvalue %dx.types.ResRet.f32 %22, 1
-  %25 = extractvalue %dx.types.ResRet.f32 %22, 2
-  %26 = extractvalue %dx.types.ResRet.f32 %22, 3
-  %27 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %16, i32 32)  ; BufferLoad(srv,index,wot)
-  %28 = extractvalue %dx.types.ResRet.f32 %27, 0
-  %29 = extractvalue %dx.types.ResRet.f32 %27, 1
-  %30 = extractvalue %dx.types.ResRet.f32 %27, 2
-  %31 = extractvalue %dx.types.ResRet.f32 %27, 3
-  %32 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %16, i32 48)  ; BufferLoad(srv,index,wot)
-  %33 = extractvalue %dx.types.ResRet.f32 %32, 0
-  %34 = extractvalue %dx.types.ResRet.f32 %32, 1
-  %35 = extractvalue %dx.types.ResRet.f32 %32, 2
-  %36 = extractvalue %dx.types.ResRet.f32 %32, 3
-  %37 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %16, i32 64)  ; BufferLoad(srv,index,wot)
-  %38 = extractvalue %dx.types.ResRet.f32 %37, 0
-  %39 = extractvalue %dx.types.ResRet.f32 %37, 1
-  %40 = extractvalue %dx.types.ResRet.f32 %37, 2
-  %41 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %16, i32 80)  ; BufferLoad(srv,index,wot)
-  %42 = extractvalue %dx.types.ResRet.f32 %41, 0
-  %43 = extractvalue %dx.types.ResRet.f32 %41, 1
-  %44 = extractvalue %dx.types.ResRet.f32 %41, 2
-  %45 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %16, i32 96)  ; BufferLoad(srv,index,wot)
-  %46 = extractvalue %dx.types.ResRet.f32 %45, 0
-  %47 = extractvalue %dx.types.ResRet.f32 %45, 1
-  %48 = extractvalue %dx.types.ResRet.f32 %45, 2
-  %49 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 180)  ; BufferLoad(srv,index,wot)
-  %50 = extractvalue %dx.types.ResRet.i32 %49, 0
-  %51 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 184)  ; BufferLoad(srv,index,wot)
-  %52 = extractvalue %dx.types.ResRet.i32 %51, 0
-  %53 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 188)  ; BufferLoad(srv,index,wot)
-  %54 = extractvalue %dx.types.ResRet.i32 %53, 0
-  %55 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 192)  ; BufferLoad(srv,index,wot)
-  %56 = extractvalue %dx.types.ResRet.i32 %55, 0
-  %57 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 196)  ; BufferLoad(srv,index,wot)
-  %58 = extractvalue %dx.types.ResRet.i32 %57, 0
-  %59 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 200)  ; BufferLoad(srv,index,wot)
-  %60 = extractvalue %dx.types.ResRet.i32 %59, 0
-  %61 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 204)  ; BufferLoad(srv,index,wot)
-  %62 = extractvalue %dx.types.ResRet.i32 %61, 0
-  %63 = fmul fast float %18, %12
-  %64 = call float @dx.op.tertiary.f32(i32 46, float %23, float %13, float %63)  ; FMad(a,b,c)
-  %65 = call float @dx.op.tertiary.f32(i32 46, float %28, float %14, float %64)  ; FMad(a,b,c)
-  %66 = fadd fast float %65, %33
-  %67 = fmul fast float %19, %12
-  %68 = call float @dx.op.tertiary.f32(i32 46, float %24, float %13, float %67)  ; FMad(a,b,c)
-  %69 = call float @dx.op.tertiary.f32(i32 46, float %29, float %14, float %68)  ; FMad(a,b,c)
-  %70 = fadd fast float %69, %34
-  %71 = fmul fast float %20, %12
-  %72 = call float @dx.op.tertiary.f32(i32 46, float %25, float %13, float %71)  ; FMad(a,b,c)
-  %73 = call float @dx.op.tertiary.f32(i32 46, float %30, float %14, float %72)  ; FMad(a,b,c)
-  %74 = fadd fast float %73, %35
-  %75 = fmul fast float %21, %12
-  %76 = call float @dx.op.tertiary.f32(i32 46, float %26, float %13, float %75)  ; FMad(a,b,c)
-  %77 = call float @dx.op.tertiary.f32(i32 46, float %31, float %14, float %76)  ; FMad(a,b,c)
-  %78 = fadd fast float %77, %36
-  %79 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 12)  ; CBufferLoadLegacy(handle,regIndex)
-  %80 = extractvalue %dx.types.CBufRet.f32 %79, 0
-  %81 = extractvalue %dx.types.CBufRet.f32 %79, 1
-  %82 = extractvalue %dx.types.CBufRet.f32 %79, 2
-  %83 = extractvalue %dx.types.CBufRet.f32 %79, 3
-  %84 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 13)  ; CBufferLoadLegacy(handle,regIndex)
-  %85 = extractvalue %dx.types.CBufRet.f32 %84, 0
-  %86 = extractvalue %dx.types.CBufRet.f32 %84, 1
-  %87 = extractvalue %dx.types.CBufRet.f32 %84, 2
-  %88 = extractvalue %dx.types.CBufRet.f32 %84, 3
-  %89 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 14)  ; CBufferLoadLegacy(handle,regIndex)
-  %90 = extractvalue %dx.types.CBufRet.f32 %89, 0
-  %91 = extractvalue %dx.types.CBufRet.f32 %89, 1
-  %92 = extractvalue %dx.types.CBufRet.f32 %89, 2
-  %93 = extractvalue %dx.types.CBufRet.f32 %89, 3
-  %94 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 15)  ; CBufferLoadLegacy(handle,regIndex)
-  %95 = extractvalue %dx.types.CBufRet.f32 %94, 0
-  %96 = extractvalue %dx.types.CBufRet.f32 %94, 1
-  %97 = extractvalue %dx.types.CBufRet.f32 %94, 2
-  %98 = extractvalue %dx.types.CBufRet.f32 %94, 3
-  %99 = fmul fast float %80, %66
-  %100 = call float @dx.op.tertiary.f32(i32 46, float %85, float %70, float %99)  ; FMad(a,b,c)
-  %101 = call float @dx.op.tertiary.f32(i32 46, float %90, float %74, float %100)  ; FMad(a,b,c)
-  %102 = call float @dx.op.tertiary.f32(i32 46, float %95, float %78, float %101)  ; FMad(a,b,c)
-  %103 = fmul fast float %81, %66
-  %104 = call float @dx.op.tertiary.f32(i32 46, float %86, float %70, float %103)  ; FMad(a,b,c)
-  %105 = call float @dx.op.tertiary.f32(i32 46, float %91, float %74, float %104)  ; FMad(a,b,c)
-  %106 = call float @dx.op.tertiary.f32(i32 46, float %96, float %78, float %105)  ; FMad(a,b,c)
-  %107 = fmul fast float %82, %66
-  %108 = call float @dx.op.tertiary.f32(i32 46, float %87, float %70, float %107)  ; FMad(a,b,c)
-  %109 = call float @dx.op.tertiary.f32(i32 46, float %92, float %74, float %108)  ; FMad(a,b,c)
-  %110 = call float @dx.op.tertiary.f32(i32 46, float %97, float %78, float %109)  ; FMad(a,b,c)
-  %111 = fmul fast float %83, %66
-  %112 = call float @dx.op.tertiary.f32(i32 46, float %88, float %70, float %111)  ; FMad(a,b,c)
-  %113 = call float @dx.op.tertiary.f32(i32 46, float %93, float %74, float %112)  ; FMad(a,b,c)
-  %114 = call float @dx.op.tertiary.f32(i32 46, float %98, float %78, float %113)  ; FMad(a,b,c)
-  %115 = fmul fast float %18, %4
-  %116 = call float @dx.op.tertiary.f32(i32 46, float %23, float %5, float %115)  ; FMad(a,b,c)
-  %117 = call float @dx.op.tertiary.f32(i32 46, float %28, float %6, float %116)  ; FMad(a,b,c)
-  %118 = fmul fast float %19, %4
-  %119 = call float @dx.op.tertiary.f32(i32 46, float %24, float %5, float %118)  ; FMad(a,b,c)
-  %120 = call float @dx.op.tertiary.f32(i32 46, float %29, float %6, float %119)  ; FMad(a,b,c)
-  %121 = fmul fast float %20, %4
-  %122 = call float @dx.op.tertiary.f32(i32 46, float %25, float %5, float %121)  ; FMad(a,b,c)
-  %123 = call float @dx.op.tertiary.f32(i32 46, float %30, float %6, float %122)  ; FMad(a,b,c)
-  %124 = call float @dx.op.dot3.f32(i32 55, float %117, float %120, float %123, float %117, float %120, float %123)  ; Dot3(ax,ay,az,bx,by,bz)
-  %125 = call float @dx.op.unary.f32(i32 25, float %124)  ; Rsqrt(value)
-  %126 = fmul fast float %125, %117
-  %127 = fmul fast float %125, %120
-  %128 = fmul fast float %125, %123
-  %129 = fmul fast float %38, %8
-  %130 = call float @dx.op.tertiary.f32(i32 46, float %9, float %39, float %129)  ; FMad(a,b,c)
-  %131 = call float @dx.op.tertiary.f32(i32 46, float %10, float %40, float %130)  ; FMad(a,b,c)
-  %132 = fmul fast float %42, %8
-  %133 = call float @dx.op.tertiary.f32(i32 46, float %9, float %43, float %132)  ; FMad(a,b,c)
-  %134 = call float @dx.op.tertiary.f32(i32 46, float %10, float %44, float %133)  ; FMad(a,b,c)
-  %135 = fmul fast float %46, %8
-  %136 = call float @dx.op.tertiary.f32(i32 46, float %9, float %47, float %135)  ; FMad(a,b,c)
-  %137 = call float @dx.op.tertiary.f32(i32 46, float %10, float %48, float %136)  ; FMad(a,b,c)
-  %138 = call float @dx.op.dot3.f32(i32 55, float %131, float %134, float %137, float %131, float %134, float %137)  ; Dot3(ax,ay,az,bx,by,bz)
-  %139 = call float @dx.op.unary.f32(i32 25, float %138)  ; Rsqrt(value)
-  %140 = fmul fast float %139, %131
-  %141 = fmul fast float %139, %134
-  %142 = fmul fast float %139, %137
-  %143 = fmul fast float %141, %128
-  %144 = fmul fast float %142, %127
-  %145 = fsub fast float %143, %144
-  %146 = fmul fast float %142, %126
-  %147 = fmul fast float %140, %128
-  %148 = fsub fast float %146, %147
-  %149 = fmul fast float %140, %127
-  %150 = fmul fast float %141, %126
-  %151 = fsub fast float %149, %150
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %102)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %106)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %110)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float %114)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 0, float %102)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 1, float %106)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 2, float %110)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 3, float %114)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 0, float %66)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 1, float %70)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 2, float %74)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 4, i32 0, i8 0, float %11)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 4, i32 0, i8 1, float %7)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 5, i32 0, i8 0, i32 %50)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 6, i32 0, i8 0, i32 %52)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 7, i32 0, i8 0, i32 %54)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 8, i32 0, i8 0, i32 %56)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 9, i32 0, i8 0, i32 %58)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 10, i32 0, i8 0, i32 %60)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 11, i32 0, i8 0, i32 %62)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 0, float %126)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 1, float %145)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 2, float %140)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 0, float %127)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 1, float %148)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 2, float %141)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 0, float %128)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 1, float %151)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 2, float %142)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.loadInput.f32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.i32(i32, i32, i32, i8, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot3.f32(i32, float, float, float, float, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32, %dx.types.Handle, i32, i32) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!11}
-!dx.entryPoints = !{!12}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"vs", i32 6, i32 0}
-!4 = !{!5, null, !8, null}
-!5 = !{!6}
-!6 = !{i32 0, %"dx.alignment.legacy.class.StructuredBuffer<DynamicObject>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 208}
-!8 = !{!9, !10}
-!9 = !{i32 0, %rootConstants* undef, !"", i32 0, i32 0, i32 1, i32 4, null}
-!10 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!11 = !{[26 x i32] [i32 12, i32 35, i32 2047, i32 0, i32 2047, i32 0, i32 2047, i32 0, i32 0, i32 0, i32 6709248, i32 0, i32 6709248, i32 0, i32 6709248, i32 0, i32 16777216, i32 0, i32 3354624, i32 0, i32 3354624, i32 0, i32 3354624, i32 0, i32 33554432, i32 0]}
-!12 = !{void ()* @main, !"main", !13, !4, !42}
-!13 = !{!14, !21, null}
-!14 = !{!15, !18, !20}
-!15 = !{i32 0, !"POSITION", i8 9, i8 0, !16, i8 0, i32 1, i8 3, i32 0, i8 0, !17}
-!16 = !{i32 0}
-!17 = !{i32 3, i32 7}
-!18 = !{i32 1, !"NORMAL", i8 9, i8 0, !16, i8 0, i32 1, i8 4, i32 1, i8 0, !19}
-!19 = !{i32 3, i32 15}
-!20 = !{i32 2, !"TANGENT", i8 9, i8 0, !16, i8 0, i32 1, i8 4, i32 2, i8 0, !19}
-!21 = !{!22, !23, !24, !26, !28, !30, !32, !33, !35, !37, !39, !41}
-!22 = !{i32 0, !"SV_Position", i8 9, i8 3, !16, i8 4, i32 1, i8 4, i32 0, i8 0, !19}
-!23 = !{i32 1, !"POSITION", i8 9, i8 0, !16, i8 2, i32 1, i8 4, i32 1, i8 0, !19}
-!24 = !{i32 2, !"POSITION", i8 9, i8 0, !25, i8 2, i32 1, i8 3, i32 2, i8 0, !17}
-!25 = !{i32 1}
-!26 = !{i32 3, !"TBN_MATRIX", i8 9, i8 0, !27, i8 2, i32 3, i8 3, i32 3, i8 0, !17}
-!27 = !{i32 0, i32 1, i32 2}
-!28 = !{i32 4, !"TEXCOORD", i8 9, i8 0, !16, i8 2, i32 1, i8 2, i32 6, i8 0, !29}
-!29 = !{i32 3, i32 3}
-!30 = !{i32 5, !"MATERIAL", i8 5, i8 0, !16, i8 1, i32 1, i8 1, i32 7, i8 0, !31}
-!31 = !{i32 3, i32 1}
-!32 = !{i32 6, !"MATERIAL", i8 5, i8 0, !25, i8 1, i32 1, i8 1, i32 7, i8 1, !31}
-!33 = !{i32 7, !"MATERIAL", i8 5, i8 0, !34, i8 1, i32 1, i8 1, i32 7, i8 2, !31}
-!34 = !{i32 2}
-!35 = !{i32 8, !"MATERIAL", i8 5, i8 0, !36, i8 1, i32 1, i8 1, i32 7, i8 3, !31}
-!36 = !{i32 3}
-!37 = !{i32 9, !"MATERIAL", i8 5, i8 0, !38, i8 1, i32 1, i8 1, i32 8, i8 0, !31}
-!38 = !{i32 4}
-!39 = !{i32 10, !"MATERIAL", i8 5, i8 0, !40, i8 1, i32 1, i8 1, i32 8, i8 1, !31}
-!40 = !{i32 5}
-!41 = !{i32 11, !"OBJECT_FLAGS", i8 5, i8 0, !16, i8 1, i32 1, i8 1, i32 8, i8 2, !31}
-!42 = !{i32 0, i64 16}
-
-#endif
-
-const unsigned char RINShaderBytesPBRDynamicVS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x32, 0x62, 0x0d, 0x31, 0xb8, 0x67, 0x32, 0x58,
-  0xe2, 0x09, 0xb8, 0xd4, 0x8b, 0x35, 0xab, 0x76, 0x01, 0x00, 0x00, 0x00,
-  0xdd, 0x27, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00,
-  0x85, 0x05, 0x00, 0x00, 0x45, 0x07, 0x00, 0x00, 0x45, 0x17, 0x00, 0x00,
-  0x61, 0x17, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x4e, 0x4f, 0x52,
-  0x4d, 0x41, 0x4c, 0x00, 0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e, 0x54, 0x00,
-  0x4f, 0x53, 0x47, 0x31, 0x3d, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xdd, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xe6, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xfa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1e, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x56, 0x5f, 0x50,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x50, 0x4f, 0x53, 0x49,
-  0x54, 0x49, 0x4f, 0x4e, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f,
-  0x4e, 0x00, 0x54, 0x42, 0x4e, 0x5f, 0x4d, 0x41, 0x54, 0x52, 0x49, 0x58,
-  0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x4d, 0x41,
-  0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52,
-  0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c,
-  0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41,
-  0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52,
-  0x49, 0x41, 0x4c, 0x00, 0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x46,
-  0x4c, 0x41, 0x47, 0x53, 0x00, 0x50, 0x53, 0x56, 0x30, 0x60, 0x02, 0x00,
-  0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00,
-  0x03, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49,
-  0x4f, 0x4e, 0x00, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x00, 0x54, 0x41,
-  0x4e, 0x47, 0x45, 0x4e, 0x54, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49,
-  0x4f, 0x4e, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00,
-  0x54, 0x42, 0x4e, 0x5f, 0x4d, 0x41, 0x54, 0x52, 0x49, 0x58, 0x00, 0x54,
-  0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x4d, 0x41, 0x54, 0x45,
-  0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41,
-  0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d,
-  0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45,
-  0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41,
-  0x4c, 0x00, 0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x53, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x44,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x03, 0x03, 0x04, 0x00,
-  0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x44,
-  0x00, 0x03, 0x02, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x43, 0x00, 0x03, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x03, 0x43, 0x00, 0x03, 0x02, 0x00,
-  0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x42,
-  0x00, 0x03, 0x02, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x07, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x51, 0x00, 0x01, 0x01, 0x00,
-  0x00, 0x51, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x07, 0x61,
-  0x00, 0x01, 0x01, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x01, 0x07, 0x71, 0x00, 0x01, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00,
-  0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x08, 0x41, 0x00, 0x01, 0x01, 0x00,
-  0x00, 0x6c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x08, 0x51,
-  0x00, 0x01, 0x01, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x08, 0x61, 0x00, 0x01, 0x01, 0x00, 0x00, 0xff, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x52, 0x54, 0x53,
-  0x30, 0xb8, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00,
-  0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x84, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7f, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f,
-  0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x53, 0x54, 0x41, 0x54, 0xf8, 0x0f, 0x00, 0x00, 0x60, 0x00, 0x01,
-  0x00, 0xfe, 0x03, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0x42, 0x43, 0xc0,
-  0xde, 0x21, 0x0c, 0x00, 0x00, 0xf5, 0x03, 0x00, 0x00, 0x0b, 0x82, 0x20,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23,
-  0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84,
-  0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45,
-  0x02, 0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18,
-  0x4b, 0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88,
-  0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4,
-  0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46,
-  0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0,
-  0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff,
-  0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x89, 0x20, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88,
-  0x09, 0x20, 0x64, 0x85, 0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23,
-  0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4,
-  0x4c, 0x10, 0xfc, 0xc1, 0x1c, 0x01, 0x18, 0x1c, 0x25, 0x4d, 0x11, 0x25,
-  0x4c, 0xfe, 0xea, 0x38, 0x13, 0xe7, 0x34, 0xd2, 0x04, 0x34, 0x93, 0x84,
-  0x02, 0xe0, 0x9a, 0xc8, 0x71, 0x26, 0xce, 0x69, 0xa4, 0x09, 0x68, 0x26,
-  0x09, 0x05, 0x01, 0x09, 0x33, 0x00, 0xc3, 0x08, 0x04, 0x91, 0x04, 0xc5,
-  0x30, 0xc2, 0x40, 0x5c, 0x18, 0x0c, 0x97, 0x0f, 0x2c, 0x88, 0xd1, 0x30,
-  0x44, 0x33, 0xf9, 0x0b, 0x61, 0x00, 0x02, 0xe6, 0x4b, 0x53, 0x44, 0x09,
-  0x93, 0xcf, 0x01, 0x0c, 0x11, 0x01, 0xc8, 0x31, 0x0c, 0xc3, 0x38, 0x08,
-  0x82, 0x20, 0x08, 0x82, 0x20, 0x88, 0x03, 0x83, 0xe1, 0xf2, 0x81, 0x05,
-  0x31, 0x1a, 0x86, 0x68, 0x26, 0x7f, 0x21, 0x0c, 0x40, 0xc0, 0x7c, 0x01,
-  0x60, 0x88, 0x08, 0xd8, 0xa8, 0xa2, 0x20, 0x22, 0x14, 0x20, 0x94, 0x5c,
-  0x25, 0x4d, 0x11, 0x25, 0x4c, 0xfe, 0xe6, 0x50, 0xcd, 0x80, 0x34, 0x06,
-  0xfb, 0x1c, 0x44, 0x44, 0x20, 0xe1, 0x20, 0x4e, 0x91, 0xa6, 0x88, 0x12,
-  0x26, 0xbf, 0x44, 0x3b, 0x34, 0x00, 0x00, 0x90, 0x03, 0xcc, 0x3d, 0xd2,
-  0x14, 0x51, 0xc2, 0xe4, 0x9b, 0xc0, 0x44, 0x44, 0x08, 0xb0, 0x20, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x0e, 0x0d, 0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68,
-  0x18, 0xa2, 0x99, 0xfc, 0x85, 0x30, 0x00, 0x01, 0xf3, 0xa5, 0x29, 0xa2,
-  0x84, 0xc9, 0xef, 0xb0, 0x06, 0x60, 0x10, 0x01, 0x0d, 0x12, 0x42, 0x98,
-  0x90, 0x61, 0x18, 0x4b, 0xe3, 0x00, 0x33, 0xe5, 0x01, 0x39, 0xe0, 0x83,
-  0x1b, 0x84, 0x03, 0x3b, 0xa4, 0xc3, 0x39, 0xb8, 0x43, 0x3b, 0x94, 0x83,
-  0x3b, 0xd0, 0x83, 0x1b, 0xb0, 0x43, 0x39, 0x9c, 0x43, 0x38, 0x8c, 0x43,
-  0x3e, 0xb8, 0xc1, 0x38, 0xb0, 0x43, 0x38, 0xcc, 0xc3, 0x3c, 0xb8, 0xc1,
-  0x2c, 0xd0, 0x83, 0x3c, 0xd4, 0xc3, 0x38, 0xd0, 0x43, 0x3d, 0xc8, 0x43,
-  0x39, 0x90, 0x83, 0x28, 0xd4, 0x83, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x03,
-  0x1f, 0x90, 0x42, 0x3e, 0xb8, 0x43, 0x38, 0xb4, 0x43, 0x3a, 0x8c, 0xc3,
-  0x2b, 0x88, 0x83, 0x3a, 0x94, 0xc3, 0x38, 0xd0, 0x83, 0x1f, 0xa0, 0xe0,
-  0x21, 0x68, 0x04, 0xa0, 0x04, 0x12, 0x4d, 0x73, 0x04, 0x48, 0x31, 0x08,
-  0x00, 0x00, 0x2a, 0x80, 0xac, 0x62, 0x48, 0x00, 0x00, 0x54, 0x04, 0x61,
-  0xc5, 0x90, 0x00, 0x00, 0xa8, 0x00, 0xd2, 0x0a, 0x42, 0x00, 0x04, 0x41,
-  0x10, 0x04, 0x41, 0x5c, 0x19, 0x08, 0x80, 0x20, 0xef, 0xa8, 0xe1, 0xf2,
-  0x27, 0xec, 0x21, 0x24, 0x9f, 0xdb, 0xa8, 0x62, 0x25, 0x26, 0x1f, 0xb9,
-  0x6d, 0x44, 0x00, 0x00, 0x00, 0x50, 0x75, 0xcf, 0x70, 0xf9, 0x13, 0xf6,
-  0x10, 0x92, 0x1f, 0x02, 0xcd, 0xb0, 0x10, 0x28, 0x08, 0x0b, 0x01, 0x02,
-  0x22, 0x40, 0xe3, 0x51, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 0x48, 0x3e, 0xb7,
-  0x51, 0xc5, 0x4a, 0x4c, 0x7e, 0x71, 0xdb, 0x88, 0x20, 0x08, 0x82, 0x28,
-  0x44, 0x09, 0x88, 0x00, 0x99, 0xa5, 0x20, 0x00, 0x82, 0x20, 0x08, 0x9d,
-  0x23, 0x08, 0x8a, 0x21, 0x02, 0x15, 0x00, 0xa8, 0xb4, 0xde, 0x34, 0x5c,
-  0xfe, 0x84, 0x3d, 0x84, 0xe4, 0xaf, 0x84, 0xb4, 0x12, 0x93, 0x8f, 0xdc,
-  0x36, 0x2a, 0x00, 0x00, 0x00, 0x80, 0x52, 0xb4, 0x80, 0x08, 0x00, 0xe4,
-  0xde, 0x34, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4, 0xaf, 0x84, 0xb4, 0x12,
-  0x93, 0x5f, 0xdc, 0x36, 0x2a, 0x08, 0x82, 0x20, 0x80, 0x52, 0xc0, 0x80,
-  0x08, 0x00, 0x14, 0x0f, 0x04, 0x9c, 0x25, 0x2c, 0x80, 0x24, 0xf9, 0x0c,
-  0x30, 0x45, 0xc8, 0xe5, 0x17, 0x8b, 0x03, 0x4c, 0x3e, 0xee, 0xe3, 0x28,
-  0x30, 0xae, 0x91, 0xa6, 0x88, 0x12, 0x26, 0x9f, 0x03, 0x18, 0x22, 0x02,
-  0x90, 0x43, 0xd3, 0x34, 0x7d, 0x10, 0x04, 0x41, 0x10, 0x04, 0x41, 0x10,
-  0x47, 0x49, 0x53, 0x44, 0x09, 0x93, 0xdf, 0x61, 0x0d, 0xc0, 0x20, 0x02,
-  0x1a, 0x24, 0x84, 0x30, 0x21, 0x83, 0xa6, 0x97, 0xc6, 0x01, 0x66, 0x2a,
-  0x83, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70, 0x83, 0x59, 0xa0,
-  0x07, 0x79, 0xa8, 0x87, 0x71, 0xa0, 0x87, 0x7a, 0x90, 0x87, 0x72, 0x20,
-  0x07, 0x51, 0xa8, 0x07, 0x73, 0x30, 0x87, 0x72, 0x90, 0x07, 0x3e, 0x20,
-  0x85, 0x7c, 0x70, 0x87, 0x70, 0x68, 0x87, 0x74, 0x18, 0x87, 0x57, 0x10,
-  0x07, 0x75, 0x28, 0x87, 0x71, 0xa0, 0x07, 0x3f, 0x40, 0x81, 0x9d, 0x03,
-  0xc7, 0x59, 0xc2, 0x02, 0x48, 0x92, 0xcf, 0x00, 0x53, 0x84, 0x5c, 0x7e,
-  0xb1, 0x38, 0xc0, 0xe4, 0xdf, 0xfe, 0x8d, 0x02, 0x7c, 0x18, 0x41, 0x20,
-  0xee, 0x91, 0xa6, 0x88, 0x12, 0x26, 0x3f, 0xdd, 0x56, 0xb1, 0x79, 0xa8,
-  0x09, 0x1d, 0x45, 0x71, 0xe4, 0xba, 0x03, 0x1c, 0x23, 0x00, 0x0c, 0x11,
-  0x01, 0x1b, 0x55, 0x14, 0x44, 0x84, 0x82, 0x3a, 0x35, 0x80, 0x39, 0x02,
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60,
-  0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf,
-  0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a,
-  0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72,
-  0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6,
-  0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73,
-  0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74,
-  0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71,
-  0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a,
-  0x0f, 0xa4, 0x90, 0x21, 0x23, 0x25, 0x40, 0x00, 0x8a, 0x01, 0x00, 0x4c,
-  0x02, 0x00, 0x08, 0x05, 0x00, 0x0c, 0x79, 0x26, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x58, 0x40, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0xc1, 0x80, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0xa3, 0x01,
-  0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x87,
-  0x03, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21,
-  0x8f, 0x07, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x43, 0x9e, 0x31, 0x00, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x80, 0x21, 0x8f, 0x19, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xc0, 0x90, 0x07, 0x0d, 0x80, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0xb3, 0x06, 0x40, 0x00, 0x0c,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x71, 0x03, 0x20,
-  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0xc4,
-  0x01, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
-  0x81, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98,
-  0x1c, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43,
-  0x02, 0x4a, 0x60, 0x04, 0xa0, 0x18, 0x0a, 0xa3, 0x40, 0x07, 0x0a, 0xa1,
-  0xc0, 0x09, 0xca, 0xa0, 0x1c, 0x4a, 0xa1, 0x08, 0x4a, 0xa2, 0x00, 0x03,
-  0x0a, 0x50, 0xa0, 0x00, 0x07, 0x0a, 0x90, 0xa0, 0x30, 0x09, 0x0a, 0x94,
-  0xa0, 0x50, 0x09, 0x0a, 0x96, 0xa0, 0x70, 0x09, 0x0a, 0x98, 0xa0, 0x90,
-  0x09, 0x0a, 0x9a, 0xa0, 0xb0, 0x09, 0x0a, 0x77, 0xa0, 0x40, 0x05, 0x0a,
-  0x76, 0xa0, 0x40, 0x0a, 0xa2, 0x60, 0x0a, 0xa5, 0x30, 0x05, 0x0a, 0xa8,
-  0xc0, 0x0a, 0x38, 0xa0, 0xc0, 0x03, 0x0a, 0x52, 0xa0, 0x3c, 0x8a, 0xa2,
-  0x2c, 0x4a, 0xa9, 0xd4, 0x05, 0x4a, 0xa7, 0x38, 0xc8, 0x2f, 0x10, 0xaa,
-  0x4a, 0xa0, 0x14, 0x8a, 0xa0, 0x10, 0xca, 0x60, 0x04, 0xa0, 0x24, 0xc8,
-  0x99, 0x01, 0xa0, 0x67, 0x06, 0x80, 0xa0, 0x19, 0x00, 0x8a, 0x66, 0x00,
-  0x88, 0x99, 0x01, 0xa0, 0x65, 0x06, 0x80, 0x94, 0x19, 0x00, 0x4a, 0x66,
-  0x00, 0x08, 0x99, 0x01, 0xa0, 0x61, 0x06, 0x80, 0x84, 0x19, 0x00, 0xaa,
-  0x67, 0x00, 0xc8, 0x9e, 0x01, 0xa0, 0x7b, 0x06, 0x80, 0xf6, 0x19, 0x00,
-  0xe2, 0x67, 0x00, 0xa8, 0x1f, 0x4b, 0x63, 0xc6, 0xe0, 0xff, 0x03, 0xe0,
-  0xff, 0x03, 0xe0, 0xff, 0x03, 0x00, 0x00, 0x40, 0x10, 0x67, 0x0d, 0x00,
-  0x04, 0x71, 0xd6, 0x00, 0x40, 0x10, 0x67, 0x0d, 0x00, 0x04, 0x41, 0x10,
-  0x02, 0x40, 0x90, 0x35, 0x07, 0x00, 0x04, 0x59, 0x73, 0x00, 0x40, 0x90,
-  0x35, 0x07, 0x00, 0x04, 0x41, 0x10, 0x0c, 0x00, 0x0a, 0x66, 0x00, 0x00,
-  0x00, 0x79, 0x18, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x00, 0x1a, 0x03, 0x4c,
-  0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03,
-  0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01,
-  0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a,
-  0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b,
-  0xd9, 0x10, 0x04, 0x13, 0x04, 0xe0, 0x99, 0x20, 0x00, 0xd0, 0x06, 0x61,
-  0x20, 0x36, 0x08, 0x04, 0x41, 0xc1, 0x6e, 0x6e, 0x82, 0x00, 0x44, 0x1b,
-  0x86, 0x03, 0x21, 0x26, 0x08, 0xd1, 0x29, 0x70, 0x22, 0xcb, 0x73, 0x0b,
-  0x6b, 0x4b, 0x1b, 0x7b, 0x12, 0x53, 0x2b, 0x1b, 0xa3, 0x13, 0xaa, 0x33,
-  0x33, 0x2b, 0x93, 0x9b, 0x20, 0x00, 0xd2, 0x04, 0x01, 0x98, 0x36, 0x08,
-  0x43, 0xb3, 0x21, 0x21, 0x94, 0x85, 0x20, 0x06, 0x86, 0x70, 0x36, 0x04,
-  0xcf, 0x04, 0x61, 0x68, 0x05, 0x36, 0x72, 0x6f, 0x6f, 0x74, 0x43, 0x6f,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x13, 0x04, 0x80, 0xda, 0x80,
-  0x10, 0x91, 0x44, 0x10, 0xc3, 0x04, 0x4c, 0x10, 0x14, 0x55, 0x20, 0x33,
-  0x16, 0xd6, 0x56, 0x26, 0x17, 0x26, 0x54, 0x67, 0x66, 0x56, 0x26, 0x37,
-  0x41, 0x00, 0xaa, 0x0d, 0xc8, 0x50, 0x59, 0xc4, 0x30, 0x5c, 0xc0, 0x06,
-  0x81, 0xc2, 0x36, 0x10, 0x10, 0x90, 0x01, 0x13, 0x84, 0xa0, 0x16, 0x88,
-  0xbc, 0x89, 0xa9, 0x95, 0x8d, 0xd1, 0x25, 0x11, 0x4d, 0x10, 0x00, 0x6b,
-  0x82, 0x00, 0x5c, 0x13, 0x04, 0x00, 0xdb, 0x60, 0x20, 0x5c, 0x47, 0x78,
-  0xdf, 0x06, 0x61, 0x02, 0x83, 0x09, 0x42, 0x1d, 0xbc, 0x02, 0x15, 0xbb,
-  0xb4, 0xb2, 0xbb, 0xa6, 0x30, 0x3a, 0xb9, 0x34, 0xbc, 0x09, 0x02, 0x90,
-  0x6d, 0x18, 0xa6, 0x89, 0x0c, 0x26, 0x08, 0x80, 0xb6, 0x01, 0x41, 0xc6,
-  0x80, 0x0c, 0xca, 0xa0, 0x23, 0x3c, 0x33, 0xa0, 0x02, 0x27, 0xf7, 0xa6,
-  0xd6, 0x14, 0x46, 0x27, 0x97, 0x86, 0x37, 0x41, 0x00, 0xb6, 0x0d, 0x08,
-  0x82, 0x06, 0x64, 0x50, 0x06, 0x5d, 0x1a, 0x78, 0x66, 0xc0, 0x26, 0xcd,
-  0xcd, 0x0e, 0x4a, 0xee, 0x4d, 0xad, 0x29, 0x8c, 0x4e, 0x2e, 0x0d, 0x6f,
-  0x82, 0x00, 0x70, 0x1b, 0x10, 0x64, 0x0d, 0xc8, 0xa0, 0x0c, 0x3a, 0x36,
-  0xf0, 0xcc, 0x80, 0x8e, 0x5d, 0x5a, 0xd9, 0x1d, 0x94, 0xdc, 0x9b, 0x5a,
-  0x53, 0x18, 0x9d, 0x5c, 0x1a, 0xde, 0x04, 0x01, 0xe8, 0x36, 0x20, 0x88,
-  0x1b, 0x90, 0x41, 0x19, 0x74, 0x6f, 0xe0, 0x99, 0x01, 0x11, 0xb8, 0xb7,
-  0xb9, 0x34, 0xba, 0xb4, 0x37, 0xb7, 0x09, 0x02, 0xe0, 0x6d, 0x30, 0x90,
-  0x38, 0xe8, 0xe4, 0xc0, 0x33, 0x03, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69,
-  0x6e, 0x67, 0x30, 0x13, 0x04, 0xe0, 0xdb, 0x60, 0x20, 0x74, 0xd0, 0xd5,
-  0x81, 0x67, 0x06, 0x4c, 0xcc, 0xe4, 0xea, 0xe6, 0xe8, 0xea, 0xda, 0xb0,
-  0xb0, 0x26, 0x08, 0x00, 0x18, 0x6c, 0x30, 0x90, 0x3b, 0xe8, 0xf0, 0xc0,
-  0x33, 0x03, 0x26, 0x66, 0x72, 0x75, 0x73, 0x74, 0x75, 0x6d, 0x58, 0x5a,
-  0x13, 0x04, 0x20, 0x0c, 0x36, 0x18, 0x88, 0x1e, 0x74, 0x7b, 0xe0, 0x99,
-  0x01, 0x13, 0x33, 0xb9, 0xba, 0x39, 0xba, 0xba, 0xb6, 0xac, 0xac, 0x09,
-  0x02, 0x20, 0x06, 0x1b, 0x0c, 0xa4, 0x0f, 0x3a, 0x3f, 0xf0, 0xcc, 0x80,
-  0x89, 0x99, 0x5c, 0xdd, 0x1c, 0x5d, 0x5d, 0x5b, 0x96, 0xd6, 0x04, 0x01,
-  0x18, 0x83, 0x0d, 0x06, 0x02, 0x0a, 0x5d, 0x28, 0x78, 0x66, 0xc0, 0xc2,
-  0xad, 0x2c, 0x4c, 0x4e, 0x6b, 0x82, 0x00, 0x90, 0xc1, 0x06, 0x03, 0x19,
-  0x85, 0x8e, 0x14, 0x3c, 0x33, 0x20, 0x61, 0x16, 0x26, 0xa7, 0x35, 0x41,
-  0x00, 0xca, 0x60, 0x83, 0x81, 0x98, 0x42, 0x77, 0x0a, 0x9e, 0x19, 0x10,
-  0x1a, 0x63, 0xab, 0x9b, 0xa3, 0x2b, 0x93, 0x1b, 0x7a, 0x73, 0x9b, 0xa3,
-  0x0b, 0x73, 0xa3, 0x0b, 0x9a, 0x20, 0x00, 0x66, 0xb0, 0xc1, 0x40, 0x52,
-  0xa1, 0x53, 0x05, 0xcf, 0x0c, 0x08, 0x8d, 0xb1, 0xd5, 0xcd, 0xd1, 0x95,
-  0xc9, 0x0d, 0xbd, 0xb9, 0xcd, 0xd1, 0x85, 0xb9, 0xd1, 0x09, 0x4d, 0x10,
-  0x80, 0x33, 0xd8, 0x60, 0x20, 0xac, 0xd0, 0xb5, 0x82, 0x67, 0x06, 0x1b,
-  0x9e, 0xeb, 0x0c, 0xd4, 0xa0, 0x0d, 0xe0, 0x60, 0x0e, 0xec, 0x20, 0x0f,
-  0xf8, 0xe0, 0x0f, 0x44, 0xa1, 0x14, 0x50, 0x61, 0x15, 0x5c, 0x61, 0x82,
-  0x70, 0x07, 0xb1, 0x30, 0x41, 0x00, 0xd0, 0x80, 0x01, 0xda, 0x06, 0x02,
-  0x91, 0x85, 0x8e, 0x98, 0x20, 0xd8, 0x01, 0x2c, 0x6c, 0x10, 0x08, 0x5a,
-  0xd8, 0x10, 0xd4, 0xc2, 0x06, 0x81, 0xb0, 0x85, 0x0d, 0x43, 0x2c, 0xcc,
-  0xc2, 0x2d, 0x70, 0xb9, 0x7b, 0x93, 0x63, 0x23, 0x6b, 0x0a, 0xa3, 0x93,
-  0x4b, 0xc3, 0xdb, 0x80, 0x20, 0xb9, 0x40, 0x06, 0x65, 0xd0, 0x11, 0x9e,
-  0x19, 0xd0, 0x49, 0x73, 0xb3, 0xbb, 0x7a, 0x93, 0x63, 0x23, 0x6b, 0x0a,
-  0xa3, 0x93, 0x4b, 0xc3, 0xdb, 0x80, 0x20, 0xbb, 0x40, 0x06, 0x65, 0xd0,
-  0xa5, 0x81, 0x67, 0x06, 0x74, 0xc4, 0xde, 0xea, 0xdc, 0xc8, 0xd2, 0xdc,
-  0xce, 0xa6, 0xe0, 0xd0, 0xca, 0xe4, 0xca, 0x36, 0x10, 0x48, 0x2f, 0x74,
-  0x6c, 0x40, 0x82, 0xed, 0x8d, 0x6c, 0x6e, 0x82, 0x00, 0xa4, 0xc1, 0x06,
-  0x02, 0xf9, 0x85, 0x0e, 0x1c, 0x88, 0xb4, 0x85, 0xd1, 0x95, 0xc9, 0xa5,
-  0x85, 0xb1, 0x6d, 0x20, 0x10, 0x71, 0xe8, 0xde, 0x80, 0x85, 0x19, 0x5b,
-  0xd8, 0xd9, 0xdc, 0x04, 0x01, 0x50, 0x83, 0x0d, 0x06, 0x42, 0x0e, 0x5d,
-  0x39, 0x78, 0xdf, 0x86, 0x23, 0x16, 0x74, 0x81, 0x17, 0x7c, 0x21, 0x1c,
-  0xc6, 0xc1, 0x1c, 0x26, 0x08, 0x4b, 0x2a, 0x4c, 0x10, 0x80, 0x35, 0xa0,
-  0x31, 0x56, 0xe6, 0x46, 0x57, 0x26, 0xb7, 0xc1, 0x40, 0xd4, 0xa1, 0x23,
-  0x3c, 0x33, 0xa0, 0x21, 0x17, 0x46, 0x96, 0x56, 0x37, 0xb7, 0xc1, 0x40,
-  0xd8, 0xa1, 0x63, 0x3c, 0x33, 0xd8, 0x30, 0xa4, 0xc3, 0x3a, 0xb4, 0xc3,
-  0x04, 0x81, 0x41, 0x05, 0x2a, 0x73, 0x74, 0x61, 0x72, 0x74, 0x49, 0x6e,
-  0x64, 0x65, 0x78, 0x1b, 0x0c, 0x04, 0x1e, 0x3a, 0xc2, 0xfb, 0xa8, 0xa4,
-  0xb9, 0x91, 0x95, 0xe1, 0x0d, 0xbd, 0xd5, 0xb9, 0xd1, 0x6d, 0x30, 0x10,
-  0x79, 0xe8, 0x26, 0xef, 0x23, 0x63, 0x57, 0x26, 0x47, 0x57, 0x86, 0xf7,
-  0x64, 0x66, 0x36, 0x57, 0x46, 0x37, 0x41, 0x00, 0xd8, 0x60, 0x83, 0x81,
-  0xd0, 0x43, 0x57, 0x0f, 0xde, 0xb7, 0x81, 0x60, 0xe2, 0x61, 0x1e, 0xec,
-  0x61, 0x82, 0xe0, 0x90, 0xc2, 0x04, 0x01, 0x68, 0x03, 0x2e, 0x62, 0x61,
-  0x73, 0x65, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x49, 0x44, 0x1b, 0x0c, 0x44,
-  0x1f, 0x3a, 0xc2, 0xfb, 0x88, 0xb8, 0xbd, 0xc9, 0xb5, 0x85, 0xb1, 0x25,
-  0x11, 0x6d, 0x30, 0x10, 0x7e, 0xe8, 0x26, 0xef, 0x63, 0x23, 0xf7, 0x56,
-  0x77, 0x86, 0xe6, 0x56, 0x36, 0x37, 0x17, 0xf4, 0x94, 0x44, 0xb4, 0xc1,
-  0x40, 0xfc, 0xa1, 0xab, 0x07, 0xef, 0xa3, 0xd2, 0x56, 0x46, 0x17, 0xc6,
-  0xc6, 0x96, 0x36, 0x96, 0x44, 0xb4, 0xc1, 0x40, 0x40, 0xa2, 0x63, 0xbc,
-  0x8f, 0x08, 0x5a, 0x59, 0xda, 0x19, 0x1a, 0x5d, 0x12, 0xd1, 0x06, 0x03,
-  0x11, 0x89, 0x2e, 0x1d, 0xbc, 0x8f, 0xc9, 0x1c, 0x5c, 0xd9, 0x58, 0x5a,
-  0x18, 0x5b, 0x12, 0xd1, 0x04, 0x01, 0x70, 0x83, 0x0d, 0x06, 0x42, 0x12,
-  0x5d, 0x49, 0x78, 0xdf, 0x86, 0x23, 0x1f, 0xf6, 0xa1, 0x1f, 0xfe, 0x21,
-  0x24, 0x46, 0xc2, 0x24, 0x26, 0x08, 0x7b, 0x20, 0x0b, 0x13, 0x04, 0xe0,
-  0x0d, 0xb8, 0x4c, 0x59, 0x7d, 0x41, 0x3d, 0x4d, 0x25, 0x51, 0x25, 0x3d,
-  0x39, 0x6d, 0x40, 0x90, 0x38, 0xe8, 0x88, 0x49, 0x25, 0x3c, 0x33, 0xe0,
-  0x31, 0xc6, 0x96, 0x06, 0x07, 0xf5, 0x36, 0xc7, 0x04, 0xea, 0x69, 0x2a,
-  0x89, 0x2a, 0xe9, 0xc9, 0x09, 0x66, 0x03, 0x82, 0xb0, 0x44, 0x97, 0x0e,
-  0x53, 0x4b, 0x78, 0x66, 0x40, 0xe4, 0xee, 0x4d, 0x8e, 0x8d, 0x0c, 0xea,
-  0x6d, 0x6e, 0x82, 0x00, 0xc0, 0x01, 0x13, 0xa8, 0xa7, 0xa9, 0x24, 0xaa,
-  0xa4, 0x27, 0xa7, 0x98, 0x0d, 0x08, 0xf2, 0x12, 0x1d, 0x4c, 0x4c, 0x31,
-  0xe1, 0x99, 0x01, 0x07, 0x3a, 0x31, 0xb7, 0x0d, 0x43, 0xd7, 0x91, 0xc1,
-  0x04, 0x01, 0x88, 0x03, 0x2a, 0x54, 0x42, 0x4e, 0x5f, 0x4d, 0x41, 0x54,
-  0x52, 0x49, 0x58, 0x1b, 0x14, 0x64, 0x26, 0xc8, 0x80, 0x26, 0xba, 0x9a,
-  0x98, 0x6c, 0xc2, 0x33, 0x03, 0x0e, 0x74, 0x65, 0x78, 0x13, 0x04, 0x40,
-  0x0e, 0x88, 0x50, 0x15, 0x61, 0x0d, 0x3d, 0x3d, 0x49, 0x11, 0x6d, 0x40,
-  0x10, 0x9c, 0xe8, 0x72, 0x62, 0xd2, 0x09, 0xcf, 0x0c, 0x26, 0x08, 0xc0,
-  0x1c, 0x10, 0x69, 0x0a, 0xa2, 0x2a, 0x92, 0x4a, 0x0a, 0x62, 0xda, 0x60,
-  0x20, 0xe2, 0xd0, 0xf1, 0xc4, 0xd4, 0x13, 0x13, 0x04, 0x80, 0x0e, 0xc8,
-  0x3c, 0x09, 0x29, 0x15, 0x0d, 0x51, 0x7d, 0x19, 0x31, 0x05, 0x1d, 0x4d,
-  0x6d, 0x40, 0x10, 0x72, 0xe8, 0x7e, 0x62, 0x02, 0x0b, 0xef, 0xdb, 0x80,
-  0xa4, 0xc4, 0x4a, 0xb8, 0x84, 0x4c, 0xdc, 0xc4, 0x4e, 0xf8, 0x44, 0x58,
-  0x4c, 0x10, 0x04, 0x57, 0xd8, 0x40, 0x20, 0x52, 0x47, 0x6c, 0x10, 0x26,
-  0xb2, 0x98, 0x20, 0xf0, 0xc1, 0x2c, 0x6c, 0x20, 0x10, 0xab, 0x23, 0x36,
-  0x08, 0xd7, 0x59, 0x4c, 0x10, 0x10, 0x56, 0x98, 0x20, 0x24, 0xab, 0x30,
-  0x41, 0x78, 0x4a, 0x61, 0x82, 0x00, 0x99, 0xc2, 0x86, 0x8e, 0xd8, 0xc2,
-  0x40, 0x0c, 0x5e, 0x01, 0x16, 0x70, 0x81, 0x16, 0xce, 0x01, 0x1d, 0xdc,
-  0xe1, 0x1d, 0xee, 0x01, 0x1f, 0x4e, 0x02, 0x25, 0xc4, 0x62, 0x2c, 0xca,
-  0xc2, 0x2c, 0xd0, 0x22, 0x2d, 0x5e, 0x41, 0x2d, 0xd0, 0x62, 0x2d, 0xce,
-  0x81, 0x2d, 0x70, 0x61, 0x82, 0x40, 0x0d, 0x1b, 0x80, 0x0d, 0x03, 0xf1,
-  0x16, 0x6f, 0xb1, 0x21, 0x80, 0x8b, 0x0d, 0xc3, 0xe0, 0x16, 0x71, 0x31,
-  0x41, 0xe8, 0x03, 0x5a, 0xd8, 0x10, 0xcc, 0x05, 0x89, 0xb6, 0xb0, 0x34,
-  0x37, 0x22, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x13, 0x84,
-  0x6a, 0x14, 0x26, 0x08, 0x95, 0x28, 0x6c, 0x08, 0x88, 0x09, 0x42, 0x15,
-  0x0a, 0x1b, 0x84, 0xce, 0xdb, 0xb0, 0x10, 0x76, 0x71, 0x17, 0x78, 0x91,
-  0x17, 0x78, 0x31, 0xe8, 0x05, 0x81, 0x17, 0x7b, 0x41, 0xc3, 0xe9, 0x49,
-  0xaa, 0x29, 0x88, 0x69, 0x82, 0x50, 0x81, 0xc2, 0x04, 0x01, 0xa8, 0x83,
-  0x0d, 0x42, 0xf7, 0x17, 0x1b, 0x96, 0xa1, 0x2f, 0xee, 0x02, 0x2f, 0xf2,
-  0x02, 0x2f, 0x06, 0xbf, 0x18, 0xf0, 0x02, 0x34, 0x78, 0x50, 0x05, 0x39,
-  0x1d, 0x15, 0x39, 0x51, 0x6d, 0x58, 0xc8, 0x40, 0x34, 0xee, 0x02, 0x2f,
-  0xf2, 0x02, 0x2f, 0x06, 0xbf, 0x20, 0x03, 0xbc, 0x00, 0x8d, 0x0d, 0x03,
-  0x5f, 0x84, 0xc6, 0x68, 0x70, 0x99, 0xb2, 0xfa, 0x82, 0x7a, 0x9b, 0x4b,
-  0xa3, 0x4b, 0x7b, 0x73, 0xdb, 0xb0, 0x10, 0xa5, 0x71, 0x17, 0x7a, 0x91,
-  0x17, 0x7e, 0x31, 0xf8, 0x05, 0x81, 0x17, 0xa0, 0x31, 0x41, 0xa8, 0xfe,
-  0x60, 0xc3, 0x32, 0xd8, 0xc5, 0x5d, 0xe0, 0x45, 0x5e, 0x9c, 0xc6, 0xe0,
-  0x17, 0x03, 0x5e, 0x80, 0xc6, 0x86, 0x60, 0xd8, 0xb0, 0x90, 0x81, 0x5d,
-  0xdc, 0x05, 0x5e, 0xa4, 0xc6, 0x69, 0x0c, 0x7a, 0x41, 0x06, 0x78, 0xb1,
-  0x17, 0x1b, 0x06, 0x62, 0x20, 0x83, 0x0d, 0x4b, 0x67, 0x13, 0x77, 0x81,
-  0x17, 0xab, 0x71, 0x1a, 0x9d, 0x5e, 0x74, 0x78, 0xb1, 0x17, 0x1b, 0x84,
-  0xae, 0xdb, 0xb0, 0x4c, 0x3a, 0x71, 0x17, 0x78, 0x91, 0x17, 0xa7, 0x31,
-  0x9c, 0x06, 0x82, 0x17, 0xad, 0x31, 0x41, 0xa8, 0xfc, 0x60, 0x82, 0x50,
-  0xf5, 0xc1, 0x06, 0xa1, 0x1b, 0x36, 0x2c, 0x5f, 0x4f, 0xbc, 0x06, 0x5e,
-  0xe4, 0x05, 0x6c, 0x0c, 0xb0, 0xe1, 0xe1, 0x45, 0x6c, 0x6c, 0x58, 0x90,
-  0x9e, 0x78, 0x0d, 0xbc, 0x48, 0x0d, 0xd8, 0x18, 0x60, 0xc3, 0x83, 0x8d,
-  0xd8, 0xd8, 0x10, 0x90, 0xc1, 0x86, 0xc5, 0xeb, 0x89, 0xd7, 0xc0, 0x0b,
-  0xda, 0x80, 0x8d, 0x01, 0x36, 0xbc, 0xd3, 0x88, 0x8d, 0x0d, 0x41, 0xb7,
-  0x61, 0xa9, 0x87, 0x9e, 0x78, 0x0d, 0xbc, 0xb0, 0x0d, 0xd8, 0x18, 0x60,
-  0xc3, 0xd3, 0x8b, 0xd8, 0xd8, 0x10, 0x4c, 0x1b, 0x16, 0x33, 0xe8, 0x89,
-  0xd7, 0xc0, 0x0b, 0xdc, 0x80, 0x8d, 0x01, 0x36, 0xea, 0x01, 0x2f, 0x62,
-  0x63, 0x82, 0x00, 0xd8, 0xc1, 0x86, 0xe0, 0xdb, 0xb0, 0xe8, 0x46, 0x4f,
-  0xbc, 0x06, 0x5e, 0xec, 0x06, 0x6c, 0x0c, 0xb0, 0x51, 0x0f, 0xb0, 0x11,
-  0x1b, 0x13, 0x04, 0xe0, 0x0e, 0x36, 0x2c, 0xbd, 0x01, 0x16, 0xaf, 0x81,
-  0x17, 0x79, 0x01, 0x1b, 0x03, 0x6c, 0xd4, 0xc3, 0x69, 0xc4, 0xc6, 0x06,
-  0xc6, 0x34, 0x50, 0x43, 0x35, 0x58, 0xc3, 0x35, 0x64, 0x63, 0x36, 0x6a,
-  0xe3, 0x36, 0x72, 0x83, 0x37, 0x7c, 0x63, 0xc3, 0x40, 0x1a, 0xbf, 0x01,
-  0x4c, 0x10, 0xfc, 0x80, 0x0f, 0x36, 0x08, 0x44, 0x78, 0x6c, 0x28, 0xdc,
-  0xa2, 0x2e, 0xc0, 0x43, 0x13, 0x0f, 0x1a, 0x66, 0x6c, 0x6f, 0x61, 0x74,
-  0x73, 0x13, 0x04, 0x00, 0x0f, 0x58, 0xa4, 0xb9, 0xcd, 0xd1, 0xcd, 0x4d,
-  0x10, 0x80, 0x3c, 0xa0, 0x31, 0x97, 0x76, 0xf6, 0xc5, 0x46, 0x46, 0x63,
-  0x2e, 0xed, 0xec, 0x6b, 0x8e, 0x6e, 0x82, 0x00, 0xe8, 0x01, 0x11, 0xba,
-  0x32, 0xbc, 0x2f, 0xb6, 0xb7, 0x30, 0xb2, 0x09, 0x02, 0xb0, 0x07, 0x1b,
-  0x14, 0xf2, 0x28, 0x0f, 0xf3, 0x38, 0x0f, 0xf4, 0xe8, 0x8d, 0xf4, 0x50,
-  0x8f, 0xf5, 0x60, 0x8f, 0x2a, 0x6c, 0x6c, 0x76, 0x6d, 0x2e, 0x69, 0x64,
-  0x65, 0x6e, 0x74, 0x53, 0x82, 0xa0, 0x0a, 0x19, 0x9e, 0x8b, 0x5d, 0x99,
-  0xdc, 0x5c, 0xda, 0x9b, 0xdb, 0x94, 0x80, 0x68, 0x42, 0x86, 0xe7, 0x62,
-  0x17, 0xc6, 0x66, 0x57, 0x26, 0x37, 0x25, 0x28, 0xea, 0x90, 0xe1, 0xb9,
-  0xcc, 0xa1, 0x85, 0x91, 0x95, 0xc9, 0x35, 0xbd, 0x91, 0x95, 0xb1, 0x4d,
-  0x09, 0x90, 0x32, 0x64, 0x78, 0x2e, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72,
-  0x63, 0x65, 0x73, 0x53, 0x82, 0xac, 0x12, 0x19, 0x9e, 0x0b, 0x5d, 0x1e,
-  0x5c, 0x59, 0x90, 0x9b, 0xdb, 0x1b, 0x5d, 0x18, 0x5d, 0xda, 0x9b, 0xdb,
-  0xdc, 0x14, 0x81, 0x2d, 0xe2, 0xa2, 0x0e, 0x19, 0x9e, 0x8b, 0x5d, 0x5a,
-  0xd9, 0x5d, 0x12, 0xd9, 0x14, 0x5d, 0x18, 0x5d, 0xd9, 0x94, 0x60, 0x2e,
-  0xea, 0x90, 0xe1, 0xb9, 0x94, 0xb9, 0xd1, 0xc9, 0xe5, 0x41, 0xbd, 0xa5,
-  0xb9, 0xd1, 0xcd, 0x4d, 0x09, 0xc4, 0xa3, 0x0b, 0x19, 0x9e, 0xcb, 0xd8,
-  0x5b, 0x9d, 0x1b, 0x5d, 0x99, 0xdc, 0xdc, 0x94, 0x80, 0x3d, 0x00, 0x00,
-  0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80,
-  0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84,
-  0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c,
-  0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42,
-  0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c,
-  0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79,
-  0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70,
-  0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f,
-  0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4,
-  0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30,
-  0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc,
-  0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b,
-  0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70,
-  0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76,
-  0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72,
-  0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e,
-  0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1,
-  0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21,
-  0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8,
-  0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94,
-  0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc,
-  0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c,
-  0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e,
-  0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e,
-  0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00,
-  0x00, 0x71, 0x20, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x25, 0x60, 0x0a,
-  0x81, 0x1f, 0x39, 0xef, 0x0e, 0xb7, 0xd3, 0xe3, 0xa7, 0x58, 0x5d, 0x1e,
-  0xd3, 0x85, 0x75, 0xb3, 0xb9, 0x2c, 0x07, 0x02, 0x67, 0xd6, 0x1f, 0x69,
-  0x4a, 0x97, 0xd7, 0xc7, 0xf4, 0xba, 0xbc, 0x4c, 0x16, 0xd6, 0xcd, 0xe6,
-  0xb2, 0x1c, 0x58, 0x25, 0xe6, 0xdd, 0xe1, 0x76, 0x7a, 0xfc, 0x14, 0xab,
-  0xcb, 0x63, 0x3a, 0x10, 0x08, 0x04, 0x06, 0xbf, 0xec, 0xf2, 0x39, 0x3c,
-  0xce, 0x5b, 0xc0, 0x24, 0x00, 0x0c, 0x11, 0x01, 0x1b, 0x55, 0x14, 0x44,
-  0xf4, 0x2f, 0x84, 0x01, 0x08, 0x98, 0x39, 0x50, 0xc3, 0xe5, 0x3b, 0x8f,
-  0x1f, 0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x7e, 0x71, 0xdb, 0xd6,
-  0x40, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x40, 0x15, 0x05, 0x11, 0x95, 0x0e,
-  0x30, 0xf8, 0xc8, 0x6d, 0x9b, 0xc2, 0x36, 0x5c, 0xbe, 0xf3, 0xf8, 0x42,
-  0x40, 0x15, 0x05, 0x11, 0x95, 0x0e, 0x30, 0x94, 0x84, 0x01, 0x08, 0x98,
-  0x5f, 0xdc, 0xb6, 0x25, 0x6c, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x04, 0x54,
-  0x51, 0x10, 0x51, 0xe9, 0x00, 0x43, 0x49, 0x18, 0x80, 0x80, 0xf9, 0xc8,
-  0x6d, 0x1b, 0x83, 0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x44, 0x00, 0x13,
-  0x11, 0x02, 0xcd, 0xb0, 0x10, 0x76, 0xe0, 0x0c, 0x97, 0xef, 0x3c, 0xfe,
-  0xe0, 0x4c, 0xb7, 0x5f, 0xdc, 0xb6, 0x11, 0x4c, 0xc3, 0xe5, 0x3b, 0x8f,
-  0xbf, 0x38, 0xc0, 0x20, 0x36, 0x0f, 0x35, 0xf9, 0xc5, 0x6d, 0x5b, 0x41,
-  0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0xd2, 0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f,
-  0x35, 0xf9, 0xc5, 0x6d, 0x9b, 0x41, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0xd2,
-  0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f, 0x35, 0xf9, 0xc8, 0x6d, 0xdb, 0x82,
-  0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x13, 0x11, 0x4d, 0x08, 0x10, 0x61, 0x7e,
-  0x71, 0xdb, 0x86, 0xf0, 0x0c, 0x97, 0xef, 0x3c, 0x3e, 0xd5, 0x00, 0x11,
-  0xe6, 0x17, 0xb7, 0x6d, 0x03, 0x04, 0x03, 0x20, 0x8d, 0x01, 0x34, 0x91,
-  0xe3, 0x4c, 0x9c, 0xd3, 0x48, 0x13, 0xd0, 0x4c, 0x12, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48, 0x14, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x80, 0x1c, 0x7b, 0x4d, 0xa2, 0xc5,
-  0x18, 0xdf, 0xe1, 0xb1, 0x12, 0x42, 0x7e, 0x7c, 0xf1, 0x44, 0x58, 0x49,
-  0x4c, 0x74, 0x10, 0x00, 0x00, 0x60, 0x00, 0x01, 0x00, 0x1d, 0x04, 0x00,
-  0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00,
-  0x00, 0x5c, 0x10, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00,
-  0x00, 0x14, 0x04, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04,
-  0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08,
-  0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 0x0b,
-  0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62,
-  0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32,
-  0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81,
-  0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff,
-  0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03,
-  0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8,
-  0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60,
-  0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00,
-  0x00, 0x82, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85,
-  0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90,
-  0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 0xd8, 0xc1,
-  0x08, 0x40, 0x09, 0x00, 0x0a, 0x66, 0x00, 0xe6, 0x08, 0xc0, 0x60, 0x8e,
-  0x00, 0x29, 0xc6, 0x40, 0x10, 0x44, 0x41, 0x90, 0x51, 0x0c, 0x80, 0x20,
-  0x88, 0x62, 0x20, 0xa4, 0x18, 0x00, 0x41, 0x10, 0x05, 0x41, 0x4a, 0x41,
-  0x06, 0x62, 0x18, 0x86, 0x61, 0x18, 0x88, 0x29, 0xc3, 0x40, 0x0c, 0xe4,
-  0x1c, 0x35, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4, 0x73, 0x1b, 0x55, 0xac,
-  0xc4, 0xe4, 0x23, 0xb7, 0x8d, 0x08, 0x82, 0x20, 0x08, 0x2a, 0xee, 0x19,
-  0x2e, 0x7f, 0xc2, 0x1e, 0x42, 0xf2, 0x43, 0xa0, 0x19, 0x16, 0x02, 0x05,
-  0x51, 0x21, 0x20, 0x42, 0x22, 0x68, 0x3a, 0x6a, 0xb8, 0xfc, 0x09, 0x7b,
-  0x08, 0xc9, 0xe7, 0x36, 0xaa, 0x58, 0x89, 0xc9, 0x2f, 0x6e, 0x1b, 0x11,
-  0xc3, 0x30, 0x0c, 0x85, 0xa8, 0x08, 0x89, 0x20, 0xab, 0x14, 0x03, 0x31,
-  0x0c, 0x03, 0x61, 0x73, 0x04, 0x41, 0x31, 0x24, 0xa2, 0x20, 0x08, 0x8d,
-  0xb6, 0x9b, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc, 0x95, 0x90, 0x56,
-  0x62, 0xf2, 0x91, 0xdb, 0x46, 0x05, 0x41, 0x10, 0x04, 0x51, 0x8a, 0x8e,
-  0x90, 0x08, 0x82, 0xbc, 0x9b, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc,
-  0x95, 0x90, 0x56, 0x62, 0xf2, 0x8b, 0xdb, 0x46, 0xc5, 0x30, 0x0c, 0x03,
-  0x51, 0x0a, 0x90, 0x90, 0x08, 0x82, 0xc2, 0x81, 0x80, 0x61, 0x04, 0x62,
-  0x48, 0x02, 0x72, 0x18, 0x61, 0x18, 0xae, 0x92, 0xa6, 0x88, 0x12, 0x26,
-  0x7f, 0x73, 0xa8, 0x66, 0x40, 0x1a, 0x83, 0x7d, 0x0e, 0x22, 0x22, 0x90,
-  0x60, 0x0e, 0xa7, 0x48, 0x53, 0x44, 0x09, 0x93, 0x5f, 0xa2, 0x1d, 0x1a,
-  0x08, 0x82, 0xc8, 0x01, 0xf4, 0x1e, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x4d,
-  0x60, 0x22, 0x22, 0x04, 0x58, 0x90, 0x41, 0x10, 0x04, 0x41, 0x10, 0x87,
-  0x06, 0xc3, 0xe5, 0x03, 0x0b, 0x62, 0x34, 0x0c, 0xd1, 0x4c, 0xfe, 0x42,
-  0x18, 0x80, 0x80, 0xf9, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0x77, 0x58, 0x03,
-  0x30, 0x88, 0x80, 0x06, 0x09, 0x21, 0x4c, 0xc8, 0x28, 0xcb, 0x33, 0x55,
-  0x89, 0x99, 0xf2, 0x80, 0x1c, 0xf0, 0xc1, 0x0d, 0xc2, 0x81, 0x1d, 0xd2,
-  0xe1, 0x1c, 0xdc, 0xa1, 0x1d, 0xca, 0xc1, 0x1d, 0xe8, 0xc1, 0x0d, 0xd8,
-  0xa1, 0x1c, 0xce, 0x21, 0x1c, 0xc6, 0x21, 0x1f, 0xdc, 0x60, 0x1c, 0xd8,
-  0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x60, 0x16, 0xe8, 0x41, 0x1e, 0xea,
-  0x61, 0x1c, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xc8, 0x41, 0x14, 0xea,
-  0xc1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0x81, 0x0f, 0x48, 0x21, 0x1f, 0xdc,
-  0x21, 0x1c, 0xda, 0x21, 0x1d, 0xc6, 0xe1, 0x15, 0xc4, 0x41, 0x1d, 0xca,
-  0x61, 0x1c, 0xe8, 0xc1, 0x0f, 0x50, 0xb0, 0x12, 0x7b, 0x94, 0x34, 0x45,
-  0x94, 0x30, 0xf9, 0xab, 0xe3, 0x4c, 0x9c, 0xd3, 0x48, 0x13, 0xd0, 0x4c,
-  0x12, 0x0a, 0x88, 0x6b, 0x22, 0xc7, 0x99, 0x38, 0xa7, 0x91, 0x26, 0xa0,
-  0x99, 0x24, 0x14, 0xb8, 0xf4, 0x5e, 0x18, 0x0c, 0x97, 0x0f, 0x2c, 0x88,
-  0xd1, 0x30, 0x44, 0x33, 0xf9, 0x0b, 0x61, 0x00, 0x02, 0xe6, 0x4b, 0x53,
-  0x44, 0x09, 0x93, 0xcf, 0x01, 0x0c, 0x11, 0x01, 0xc8, 0x29, 0xcb, 0xb2,
-  0x34, 0x87, 0x61, 0x18, 0x86, 0x61, 0x18, 0x86, 0x03, 0x83, 0xe1, 0xf2,
-  0x81, 0x05, 0x31, 0x1a, 0x86, 0x68, 0x26, 0x7f, 0x21, 0x0c, 0x40, 0xc0,
-  0x7c, 0x01, 0x60, 0x88, 0x08, 0xd8, 0xa8, 0xa2, 0x20, 0x22, 0x14, 0xc4,
-  0x24, 0xa7, 0x06, 0x31, 0x47, 0x00, 0x0a, 0x00, 0x00, 0x13, 0x14, 0x72,
-  0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72,
-  0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e,
-  0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07,
-  0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07,
-  0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06,
-  0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e,
-  0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07,
-  0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x06, 0x10, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x10, 0x20, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x28, 0x40, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x61, 0x80, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0xe3, 0x00,
-  0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x67,
-  0x02, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21,
-  0x8f, 0x05, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x43, 0x1e, 0x0c, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x86, 0x3c, 0x1b, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0c, 0x79, 0x3c, 0x20, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xf2, 0x84, 0x01, 0x10, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x81, 0x00, 0x00, 0x1f, 0x00, 0x00,
-  0x00, 0x32, 0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26,
-  0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a, 0x60, 0x04, 0xa0, 0x18, 0x0a, 0xa3,
-  0x40, 0x07, 0x0a, 0xa1, 0xc0, 0x09, 0xca, 0xa0, 0x1c, 0xca, 0xa3, 0x08,
-  0x4a, 0xa1, 0x20, 0x4a, 0xa2, 0x28, 0xca, 0x82, 0x8a, 0x92, 0x18, 0x01,
-  0x28, 0x83, 0x42, 0x28, 0x82, 0x52, 0x28, 0x01, 0xaa, 0x0b, 0x84, 0xe0,
-  0x19, 0x00, 0x9a, 0x67, 0x00, 0x88, 0x1e, 0x4b, 0x63, 0xc6, 0xe0, 0xff,
-  0x03, 0xe0, 0xff, 0x03, 0xe0, 0xff, 0x03, 0x00, 0x00, 0x40, 0x10, 0x67,
-  0x0d, 0x00, 0x04, 0x71, 0xd6, 0x00, 0x40, 0x10, 0x67, 0x0d, 0x00, 0x04,
-  0x41, 0x10, 0x02, 0x40, 0x90, 0x35, 0x07, 0x00, 0x04, 0x59, 0x73, 0x00,
-  0x40, 0x90, 0x35, 0x07, 0x00, 0x04, 0x41, 0x10, 0x0c, 0x00, 0x6a, 0x67,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0xb6, 0x00, 0x00,
-  0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63,
-  0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03,
-  0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a,
-  0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b,
-  0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04, 0x82, 0x99, 0x20,
-  0x10, 0xcd, 0x06, 0x61, 0x20, 0x26, 0x08, 0x84, 0xb3, 0x41, 0x18, 0x0c,
-  0x0a, 0x76, 0x73, 0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08, 0x6d, 0x70, 0x06,
-  0x04, 0x26, 0x08, 0xc4, 0x33, 0x41, 0x20, 0xa0, 0x0d, 0xc2, 0xd0, 0x6c,
-  0x48, 0x08, 0x65, 0x21, 0x88, 0x81, 0x21, 0x9c, 0x0d, 0xc1, 0x33, 0x41,
-  0x80, 0x03, 0x32, 0x98, 0x20, 0x10, 0xd1, 0x06, 0x84, 0x88, 0x16, 0x82,
-  0x18, 0x24, 0x60, 0x82, 0x30, 0x07, 0x65, 0x30, 0x41, 0x20, 0xa4, 0x0d,
-  0xc8, 0x40, 0x2d, 0xc4, 0x30, 0x54, 0xc0, 0x06, 0x61, 0xb2, 0x36, 0x10,
-  0x10, 0x70, 0x01, 0x13, 0x04, 0x3a, 0x30, 0x83, 0x0d, 0x41, 0x36, 0x41,
-  0x10, 0x00, 0x12, 0x6d, 0x61, 0x69, 0x6e, 0x44, 0xa0, 0x9e, 0xa6, 0x92,
-  0xa8, 0x92, 0x9e, 0x9c, 0x26, 0x08, 0x05, 0x37, 0x41, 0x28, 0xba, 0x0d,
-  0x01, 0x31, 0x41, 0x28, 0xbc, 0x09, 0x02, 0x31, 0x4d, 0x10, 0x08, 0x6a,
-  0x83, 0x20, 0x06, 0x63, 0xb0, 0x61, 0x21, 0x3a, 0xef, 0x03, 0x83, 0x6f,
-  0x08, 0x03, 0xe2, 0x23, 0x03, 0x1a, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c,
-  0x13, 0x84, 0xe2, 0x9b, 0x20, 0x10, 0xd5, 0x06, 0x41, 0x0c, 0xd0, 0x60,
-  0xc3, 0x32, 0x98, 0x81, 0xf7, 0x81, 0xc1, 0x37, 0x9c, 0xc1, 0xf0, 0xa5,
-  0xc1, 0x04, 0x81, 0xb0, 0x78, 0x50, 0x05, 0x39, 0x1d, 0x15, 0x39, 0x51,
-  0x6d, 0x58, 0xd6, 0x80, 0x0d, 0xbc, 0x0f, 0x0c, 0xbe, 0xe1, 0x0c, 0xd6,
-  0xe0, 0x4b, 0x83, 0x0d, 0x43, 0x19, 0xa8, 0x41, 0x1b, 0x70, 0x99, 0xb2,
-  0xfa, 0x82, 0x7a, 0x9b, 0x4b, 0xa3, 0x4b, 0x7b, 0x73, 0xdb, 0xb0, 0x10,
-  0x6f, 0xe0, 0x85, 0x01, 0x18, 0x9c, 0xc1, 0x70, 0x06, 0xc4, 0x97, 0x06,
-  0x13, 0x84, 0x02, 0x0c, 0x36, 0x2c, 0x43, 0xe7, 0x7d, 0x60, 0x10, 0x07,
-  0xc3, 0x19, 0x0c, 0x5f, 0x1a, 0x6c, 0x08, 0x86, 0x0d, 0xcb, 0x1a, 0x74,
-  0xde, 0x37, 0x07, 0x71, 0x30, 0x84, 0xc1, 0x1a, 0x7c, 0x64, 0x40, 0x85,
-  0x4a, 0xc8, 0xe9, 0xab, 0x29, 0x88, 0x4a, 0x2a, 0x09, 0x6b, 0xc3, 0x40,
-  0x0c, 0x6b, 0xb0, 0x61, 0x11, 0x83, 0x3a, 0xf0, 0x3e, 0x3b, 0x88, 0x03,
-  0x31, 0x08, 0x03, 0x31, 0xf8, 0xc8, 0x80, 0x08, 0x55, 0x11, 0xd6, 0xd0,
-  0xd3, 0x93, 0x14, 0xd1, 0x06, 0x41, 0x0c, 0xc4, 0x60, 0xc3, 0x22, 0xe1,
-  0x81, 0xf7, 0x81, 0x41, 0x1c, 0x0c, 0x71, 0x60, 0x7c, 0x79, 0x30, 0x41,
-  0x20, 0x2e, 0x22, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x13,
-  0x84, 0x22, 0x0c, 0x26, 0x08, 0x85, 0x18, 0x6c, 0x10, 0xc4, 0x60, 0xd8,
-  0xb0, 0xec, 0x01, 0x1f, 0xf4, 0xc1, 0x07, 0x06, 0x7e, 0x30, 0xf8, 0xc1,
-  0x18, 0x7c, 0x7f, 0xb0, 0x61, 0x31, 0xf8, 0xa0, 0x0f, 0xbe, 0x39, 0xf0,
-  0x83, 0xc1, 0x0f, 0xc6, 0xc0, 0x0f, 0xfe, 0x60, 0x43, 0xb0, 0x06, 0x1b,
-  0x96, 0x31, 0xe0, 0x83, 0x3e, 0xf8, 0x44, 0xc1, 0x0f, 0x06, 0x3f, 0x18,
-  0x83, 0x38, 0xf8, 0x83, 0x09, 0x02, 0x81, 0x6d, 0x08, 0xc4, 0x60, 0xc3,
-  0x42, 0x0a, 0x7c, 0xd0, 0x07, 0x5f, 0x29, 0xf8, 0xc1, 0xe0, 0x07, 0x63,
-  0x10, 0x06, 0x7f, 0x30, 0x41, 0x20, 0xb2, 0x0d, 0x81, 0xb4, 0x61, 0x39,
-  0x05, 0x3e, 0xe8, 0x83, 0x0f, 0x15, 0xfc, 0x60, 0xf0, 0x03, 0x52, 0xf8,
-  0xfe, 0x60, 0x82, 0x40, 0x68, 0x1b, 0x82, 0x3d, 0xd8, 0xb0, 0xa8, 0x02,
-  0x1f, 0xf4, 0xc1, 0xb7, 0x0a, 0x7e, 0x30, 0xf8, 0x01, 0x29, 0xf8, 0xc1,
-  0x1f, 0x4c, 0x10, 0x88, 0x8d, 0xcc, 0x93, 0x90, 0x52, 0xd1, 0x10, 0xd5,
-  0x97, 0x11, 0x53, 0xd0, 0xd1, 0xd4, 0x86, 0xa5, 0x15, 0x5c, 0xa1, 0x0f,
-  0x3e, 0x30, 0xf0, 0x83, 0xc1, 0x0f, 0x48, 0x21, 0x0e, 0xfe, 0x60, 0x03,
-  0x03, 0x07, 0x72, 0x40, 0x07, 0x77, 0xa0, 0x07, 0xa0, 0x10, 0x0a, 0xa3,
-  0x60, 0x0a, 0xa9, 0xc0, 0x0a, 0xaf, 0xb0, 0x61, 0x70, 0x03, 0x58, 0x00,
-  0x26, 0x08, 0x75, 0x30, 0x06, 0x1b, 0x04, 0x42, 0x16, 0x36, 0x14, 0x1b,
-  0x17, 0x0b, 0xd8, 0x2c, 0x54, 0x61, 0x63, 0xb3, 0x6b, 0x73, 0x49, 0x23,
-  0x2b, 0x73, 0xa3, 0x9b, 0x12, 0x04, 0x55, 0xc8, 0xf0, 0x5c, 0xec, 0xca,
-  0xe4, 0xe6, 0xd2, 0xde, 0xdc, 0xa6, 0x04, 0x44, 0x13, 0x32, 0x3c, 0x17,
-  0xbb, 0x30, 0x36, 0xbb, 0x32, 0xb9, 0x29, 0x81, 0x51, 0x87, 0x0c, 0xcf,
-  0x65, 0x0e, 0x2d, 0x8c, 0xac, 0x4c, 0xae, 0xe9, 0x8d, 0xac, 0x8c, 0x6d,
-  0x4a, 0x80, 0x94, 0x21, 0xc3, 0x73, 0x91, 0x2b, 0x9b, 0x7b, 0xab, 0x93,
-  0x1b, 0x2b, 0x9b, 0x9b, 0x12, 0x5c, 0x75, 0xc8, 0xf0, 0x5c, 0xec, 0xd2,
-  0xca, 0xee, 0x92, 0xc8, 0xa6, 0xe8, 0xc2, 0xe8, 0xca, 0xa6, 0x04, 0x59,
-  0x1d, 0x32, 0x3c, 0x97, 0x32, 0x37, 0x3a, 0xb9, 0x3c, 0xa8, 0xb7, 0x34,
-  0x37, 0xba, 0xb9, 0x29, 0xc1, 0x2c, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00,
-  0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c,
-  0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80,
-  0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed,
-  0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d,
-  0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83,
-  0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78,
-  0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70,
-  0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc,
-  0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3,
-  0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c,
-  0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83,
-  0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03,
-  0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68,
-  0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60,
-  0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80,
-  0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98,
-  0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec,
-  0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c,
-  0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d,
-  0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43,
-  0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03,
-  0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03,
-  0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28,
-  0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4,
-  0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1,
-  0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00,
-  0x00, 0x31, 0x00, 0x00, 0x00, 0xb6, 0x40, 0x0d, 0x97, 0xef, 0x3c, 0x7e,
-  0x40, 0x15, 0x05, 0x11, 0x95, 0x0e, 0x30, 0xf8, 0xc5, 0x6d, 0x9b, 0x02,
-  0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0,
-  0xe0, 0x23, 0xb7, 0x6d, 0x07, 0xdb, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x01,
-  0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0, 0x50, 0x12, 0x06, 0x20, 0x60, 0x7e,
-  0x71, 0xdb, 0x66, 0xb0, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x50, 0x45,
-  0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25, 0x61, 0x00, 0x02, 0xe6, 0x23, 0xb7,
-  0x6d, 0x09, 0xd2, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x11, 0x01, 0x4c, 0x44,
-  0x08, 0x34, 0xc3, 0x42, 0x18, 0x81, 0x33, 0x5c, 0xbe, 0xf3, 0xf8, 0x83,
-  0x33, 0xdd, 0x7e, 0x71, 0xdb, 0x16, 0x30, 0x0d, 0x97, 0xef, 0x3c, 0xfe,
-  0xe2, 0x00, 0x83, 0xd8, 0x3c, 0xd4, 0xe4, 0x17, 0xb7, 0x6d, 0x02, 0xd5,
-  0x70, 0xf9, 0xce, 0xe3, 0x4b, 0x93, 0x13, 0x11, 0x28, 0x35, 0x3d, 0xd4,
-  0xe4, 0x17, 0xb7, 0x6d, 0x03, 0xd5, 0x70, 0xf9, 0xce, 0xe3, 0x4b, 0x93,
-  0x13, 0x11, 0x28, 0x35, 0x3d, 0xd4, 0xe4, 0x23, 0xb7, 0x6d, 0x08, 0xd2,
-  0x70, 0xf9, 0xce, 0xe3, 0x4f, 0x44, 0x34, 0x21, 0x40, 0x84, 0xf9, 0xc5,
-  0x6d, 0x5b, 0xc1, 0x33, 0x5c, 0xbe, 0xf3, 0xf8, 0x54, 0x03, 0x44, 0x98,
-  0x5f, 0xdc, 0xb6, 0x01, 0x10, 0x0c, 0x80, 0x34, 0x00, 0x61, 0x20, 0x00,
-  0x00, 0xc4, 0x01, 0x00, 0x00, 0x13, 0x04, 0x41, 0x2c, 0x10, 0x00, 0x00,
-  0x00, 0x0d, 0x00, 0x00, 0x00, 0x44, 0x14, 0x57, 0x21, 0x06, 0xcc, 0x00,
-  0x94, 0x5d, 0xc9, 0x95, 0x5b, 0xc9, 0x14, 0x48, 0x01, 0x15, 0x58, 0x01,
-  0x06, 0x14, 0x68, 0x40, 0x01, 0x07, 0x14, 0xba, 0x40, 0xc1, 0x0b, 0x14,
-  0xbe, 0x40, 0x01, 0x0e, 0x14, 0xe2, 0x40, 0x41, 0x0e, 0x14, 0xe6, 0x40,
-  0x69, 0x14, 0x07, 0x69, 0x23, 0x00, 0x00, 0x00, 0x00, 0x23, 0x06, 0x09,
-  0x00, 0x82, 0x60, 0xb0, 0xd9, 0xc1, 0x24, 0x06, 0x72, 0x20, 0x07, 0xc1,
-  0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x6c, 0x77, 0x40, 0x81, 0x01, 0x1d,
-  0xd0, 0x81, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x1b, 0x1e, 0x54,
-  0x61, 0x40, 0x07, 0x74, 0x30, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81,
-  0x11, 0x0a, 0x71, 0xc0, 0x06, 0x75, 0x50, 0x06, 0xd8, 0x88, 0x41, 0x02,
-  0x80, 0x20, 0x18, 0x18, 0xa2, 0x20, 0x07, 0x6d, 0x60, 0x07, 0x61, 0x90,
-  0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x31, 0x0a, 0x73, 0xe0, 0x06,
-  0x77, 0x40, 0x06, 0xda, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0xa4,
-  0x40, 0x07, 0x6f, 0x80, 0x07, 0x67, 0xb0, 0x8d, 0x18, 0x24, 0x00, 0x08,
-  0x82, 0x81, 0x51, 0x0a, 0x75, 0xa0, 0x07, 0x79, 0x90, 0x06, 0xdc, 0x88,
-  0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0xa6, 0x60, 0x07, 0x7b, 0xa0, 0x07,
-  0x65, 0xd0, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x71, 0x0a, 0x77,
-  0xc0, 0x07, 0x7b, 0x80, 0x06, 0xde, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18,
-  0x18, 0xa8, 0x80, 0x07, 0x7d, 0xc0, 0x07, 0x6b, 0xf0, 0x8d, 0x18, 0x24,
-  0x00, 0x08, 0x82, 0x81, 0x91, 0x0a, 0x79, 0xd0, 0x07, 0x7d, 0xd0, 0x06,
-  0x60, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x86, 0x2a, 0xe8, 0x81,
-  0x1f, 0xf8, 0x41, 0x1a, 0x84, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18,
-  0x18, 0xab, 0xb0, 0x07, 0x7f, 0xf0, 0x07, 0x6c, 0x20, 0x06, 0x23, 0x06,
-  0x07, 0x00, 0x82, 0x60, 0x30, 0x9d, 0x82, 0x18, 0x30, 0xa0, 0x30, 0x9a,
-  0x10, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x10, 0x06, 0xa4, 0x60,
-  0x06, 0x50, 0x20, 0x0a, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3,
-  0x09, 0x83, 0x30, 0x9a, 0x40, 0x0c, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60,
-  0x10, 0x06, 0xa9, 0xb0, 0x06, 0x95, 0x51, 0x06, 0xa3, 0x09, 0x01, 0x30,
-  0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30, 0x9a, 0x40, 0x0c, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0x10, 0x06, 0xae, 0x00, 0x07, 0xda, 0x92, 0x06,
-  0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30, 0x9a,
-  0x40, 0x0c, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x10, 0x06, 0xb3, 0x50,
-  0x07, 0x1f, 0xd4, 0x06, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3,
-  0x09, 0x83, 0x30, 0x9a, 0x40, 0x0c, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60,
-  0x10, 0x06, 0xb8, 0xa0, 0x07, 0x64, 0x50, 0xc5, 0xc1, 0x68, 0x42, 0x00,
-  0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x18, 0x20, 0x00, 0x08,
-  0x82, 0x41, 0x18, 0xf0, 0x82, 0x1f, 0xa0, 0x41, 0x46, 0x07, 0xa3, 0x09,
-  0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30, 0x62, 0x80, 0x00,
-  0x20, 0x08, 0x06, 0x61, 0x00, 0x0e, 0xa2, 0xc0, 0x06, 0xdd, 0x1d, 0x8c,
-  0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x88, 0x01,
-  0x02, 0x80, 0x20, 0x18, 0x78, 0xe5, 0x60, 0x0a, 0x70, 0x10, 0x06, 0x7a,
-  0x30, 0x9a, 0x10, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0xe0, 0x9d,
-  0x03, 0x2a, 0xc8, 0xc1, 0x18, 0xec, 0xc1, 0x68, 0x42, 0x00, 0x8c, 0x18,
-  0x20, 0x00, 0x08, 0x82, 0x81, 0x97, 0x0e, 0xaa, 0x40, 0x07, 0x65, 0xc0,
-  0x07, 0xa3, 0x09, 0x01, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0xde,
-  0x3a, 0xb0, 0x82, 0x1d, 0x9c, 0x41, 0x1f, 0x8c, 0x26, 0x04, 0xc0, 0x88,
-  0x01, 0x02, 0x80, 0x20, 0x18, 0x78, 0xed, 0xe0, 0x0a, 0x78, 0x90, 0x06,
-  0x7e, 0x30, 0x9a, 0x10, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0xe0,
-  0xbd, 0x03, 0x2c, 0xe8, 0xc1, 0x1a, 0xfc, 0xc1, 0x68, 0x42, 0x00, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0x81, 0x17, 0x0f, 0xb2, 0xc0, 0x07, 0x6d,
-  0x00, 0x0a, 0xa3, 0x09, 0x01, 0x60, 0x6d, 0x30, 0x07, 0xf2, 0x19, 0x31,
-  0x40, 0x00, 0x10, 0x04, 0x03, 0xcc, 0x1e, 0x6c, 0x21, 0x0d, 0xe6, 0x20,
-  0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0xec, 0x1e, 0x6e, 0xa1, 0x0c,
-  0xe6, 0x20, 0xb0, 0x20, 0x0c, 0xa0, 0x63, 0x70, 0x70, 0x07, 0xf2, 0x19,
-  0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0x4c, 0x1f, 0x74, 0x81, 0x0d, 0xee,
-  0x20, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0x6c, 0x1f, 0x76, 0x01,
-  0x0d, 0xee, 0x20, 0xb0, 0x80, 0x0c, 0xa0, 0x63, 0x73, 0xb0, 0x07, 0xf2,
-  0x19, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0xcc, 0x1f, 0x7c, 0xe1, 0x0d,
-  0xf6, 0x20, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0xec, 0x1f, 0x7e,
-  0x61, 0x0d, 0xf6, 0x20, 0xb0, 0xe0, 0x0c, 0xa0, 0x63, 0x76, 0xf0, 0x07,
-  0xf2, 0x19, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0x4c, 0x24, 0xc4, 0x41,
-  0x0e, 0xfe, 0x20, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0x6c, 0x24,
-  0xc6, 0xc1, 0x0d, 0xfe, 0x20, 0xb0, 0x40, 0x0d, 0xa0, 0x33, 0x62, 0x70,
-  0x00, 0x20, 0x08, 0x06, 0x96, 0x49, 0x88, 0x43, 0x2b, 0xf8, 0xc3, 0x68,
-  0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x26, 0x10,
-  0xc3, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x58, 0x2b, 0x71, 0x0e, 0xb2,
-  0x60, 0x0b, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83,
-  0x30, 0x9a, 0x40, 0x0c, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0x60, 0xc1,
-  0x04, 0x3b, 0xdc, 0x82, 0x2e, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10,
-  0x8c, 0x26, 0x0c, 0xc2, 0x68, 0x02, 0x31, 0x8c, 0x18, 0x1c, 0x00, 0x08,
-  0x82, 0x81, 0x55, 0x13, 0xf1, 0xc0, 0x0b, 0x27, 0x31, 0x9a, 0x10, 0x00,
-  0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 0xa3, 0x09, 0xc4, 0x60, 0x53,
-  0x18, 0xc8, 0x67, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0x30, 0x9d, 0xd0,
-  0x87, 0xc7, 0x0b, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0x00, 0xdb, 0x89,
-  0x7d, 0x58, 0xb6, 0x60, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0x30, 0x9e,
-  0xe0, 0x87, 0x03, 0x0b, 0xcc, 0x2a, 0x03, 0xf9, 0x8c, 0x18, 0x20, 0x00,
-  0x08, 0x82, 0x01, 0xe6, 0x13, 0xfe, 0x20, 0x89, 0x41, 0x30, 0x62, 0x80,
-  0x00, 0x20, 0x08, 0x06, 0xd8, 0x4f, 0xfc, 0x83, 0xf3, 0x05, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0x80, 0x81, 0x05, 0x48, 0x28, 0x5c, 0x60, 0x59,
-  0x1a, 0xc8, 0x67, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0x30, 0xb1, 0x10,
-  0x89, 0xca, 0x0c, 0x82, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xc0, 0xc6,
-  0x62, 0x24, 0xa2, 0x31, 0x08, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0x00,
-  0x23, 0x0b, 0x92, 0x68, 0xc0, 0x20, 0x30, 0xae, 0x0d, 0xe4, 0x33, 0x62,
-  0x80, 0x00, 0x20, 0x08, 0x06, 0x98, 0x59, 0x98, 0x04, 0xa6, 0x06, 0xc1,
-  0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x60, 0x67, 0x71, 0x12, 0xd4, 0x19,
-  0x04, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x80, 0xa1, 0x05, 0x4a, 0x40,
-  0x64, 0x10, 0x58, 0x38, 0xbc, 0x83, 0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04,
-  0xc1, 0x00, 0x53, 0x0b, 0x95, 0xe8, 0x85, 0x77, 0x08, 0x46, 0x0c, 0x10,
-  0x00, 0x04, 0xc1, 0x00, 0x5b, 0x8b, 0x95, 0xc8, 0x85, 0x77, 0x08, 0x6c,
-  0x1c, 0xe4, 0x41, 0x3e, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x80, 0xb5,
-  0x45, 0x4b, 0xfc, 0x82, 0x3c, 0x04, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60,
-  0x80, 0xb9, 0x85, 0x4b, 0xec, 0x82, 0x3c, 0x04, 0x56, 0x0e, 0xf5, 0x20,
-  0x9f, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xc0, 0xe0, 0x02, 0x26, 0xc2,
-  0xa1, 0x1e, 0x82, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xc0, 0xe2, 0x22,
-  0x26, 0x7a, 0xa1, 0x1e, 0x82, 0x11, 0x83, 0x05, 0x00, 0x41, 0x30, 0x60,
-  0xec, 0xa2, 0x25, 0x0e, 0x22, 0x38, 0x88, 0x60, 0xc4, 0xc0, 0x00, 0x40,
-  0x10, 0x0c, 0x1c, 0xbb, 0x68, 0x89, 0xc0, 0x82, 0x44, 0x3e, 0x26, 0x1c,
-  0xf2, 0xb1, 0xa1, 0x90, 0x8f, 0xed, 0x42, 0x3e, 0xc8, 0x67, 0xc4, 0x00,
-  0x01, 0x40, 0x10, 0x0c, 0x30, 0xbc, 0xc0, 0x89, 0x7c, 0xd8, 0x85, 0x60,
-  0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0xb0, 0xbc, 0xc8, 0x89, 0x7c, 0xd8,
-  0x85, 0xc0, 0x74, 0x81, 0x1f, 0xe4, 0x33, 0x62, 0x80, 0x00, 0x20, 0x08,
-  0x06, 0xd8, 0x5e, 0xec, 0x04, 0x3f, 0xe8, 0x42, 0x30, 0x62, 0x80, 0x00,
-  0x20, 0x08, 0x06, 0x18, 0x5f, 0xf0, 0x04, 0x3f, 0xe8, 0x42, 0x60, 0xb9,
-  0xf0, 0x0f, 0xf2, 0x19, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03, 0xcc, 0x2f,
-  0x7c, 0xe2, 0x1f, 0x72, 0x21, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x03,
-  0xec, 0x2f, 0x7e, 0xe2, 0x1f, 0x72, 0x21, 0x18, 0x31, 0x58, 0x00, 0x10,
-  0x04, 0x03, 0x86, 0x34, 0x76, 0xe2, 0x20, 0x82, 0x83, 0x08, 0x46, 0x0c,
-  0x0c, 0x00, 0x04, 0xc1, 0xc0, 0x21, 0x8d, 0x9d, 0x08, 0x2c, 0x48, 0xe4,
-  0x63, 0xc2, 0x21, 0x1f, 0x1b, 0x0a, 0xf9, 0x98, 0xf0, 0xc8, 0xc7, 0x84,
-  0x48, 0x3e, 0x26, 0x04, 0xf1, 0x31, 0x82, 0x92, 0x8f, 0x1d, 0x93, 0x7c,
-  0x4c, 0x08, 0xe2, 0x63, 0x89, 0x25, 0x1f, 0x4b, 0x30, 0xf9, 0x98, 0x10,
-  0xc4, 0x67, 0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 0x10, 0xda, 0xf8, 0x8b,
-  0xd4, 0x48, 0x8d, 0xbc, 0x90, 0x83, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30,
-  0x40, 0x68, 0xe3, 0x2f, 0x52, 0x23, 0x35, 0xe8, 0xc2, 0x0d, 0x46, 0x0c,
-  0x12, 0x00, 0x04, 0xc1, 0x00, 0xa1, 0x8d, 0xbf, 0x48, 0x8d, 0xd4, 0xb0,
-  0x0b, 0x35, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03, 0x84, 0x36, 0xfe,
-  0x22, 0x35, 0x52, 0x03, 0x2f, 0xcc, 0x60, 0xc4, 0x20, 0x01, 0x40, 0x10,
-  0x0c, 0x10, 0xda, 0xf8, 0x0b, 0xd5, 0x48, 0x8d, 0xbc, 0x90, 0x83, 0x11,
-  0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0x68, 0xe3, 0x2f, 0x54, 0x23, 0x35,
-  0xe8, 0xc2, 0x0d, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0xa1, 0x8d,
-  0xbf, 0x50, 0x8d, 0xd4, 0xb0, 0x0b, 0x35, 0x18, 0x31, 0x48, 0x00, 0x10,
-  0x04, 0x03, 0x84, 0x36, 0xfe, 0x42, 0x35, 0x52, 0x03, 0x2f, 0xcc, 0x60,
-  0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 0x10, 0xda, 0xf8, 0x0b, 0xd0, 0x48,
-  0x8d, 0xbc, 0xb0, 0x85, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0x68,
-  0xe3, 0x2f, 0x40, 0x23, 0x35, 0xe8, 0x42, 0x16, 0x46, 0x0c, 0x12, 0x00,
-  0x04, 0xc1, 0x00, 0xa1, 0x8d, 0xbf, 0x00, 0x8d, 0xd4, 0xb0, 0x0b, 0x57,
-  0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03, 0x84, 0x36, 0xfe, 0xa2, 0x34,
-  0x52, 0x23, 0x2f, 0x5a, 0x62, 0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 0x10,
-  0xda, 0xf8, 0x8b, 0xd2, 0x48, 0x0d, 0xba, 0x88, 0x89, 0x11, 0x83, 0x04,
-  0x00, 0x41, 0x30, 0x50, 0x66, 0xe3, 0x2f, 0xfe, 0x22, 0x35, 0xf2, 0xc2,
-  0x1c, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x40, 0x99, 0x8d, 0xbf, 0x40,
-  0x8d, 0xd4, 0xc8, 0x0b, 0x72, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03,
-  0x65, 0x36, 0xfe, 0x42, 0x34, 0x52, 0x23, 0x2f, 0xc4, 0x61, 0xc4, 0x20,
-  0x01, 0x40, 0x10, 0x0c, 0x94, 0xd9, 0xf8, 0x0b, 0xbf, 0x48, 0x8d, 0xbc,
-  0x00, 0x87, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30, 0x50, 0x66, 0xe3, 0x2f,
-  0xfa, 0x22, 0x35, 0xf2, 0xc2, 0x17, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1,
-  0x40, 0x99, 0x8d, 0xbf, 0xe0, 0x8b, 0xd4, 0xc8, 0x0b, 0x5e, 0x18, 0x31,
-  0x48, 0x00, 0x10, 0x04, 0x03, 0x65, 0x36, 0xfe, 0x62, 0x2f, 0x52, 0x23,
-  0x2f, 0x74, 0x61, 0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 0x10, 0xda, 0xf8,
-  0x8b, 0xd1, 0x48, 0x8d, 0xbc, 0xd0, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1,
-  0x00, 0xa1, 0x8d, 0xbf, 0x18, 0x8d, 0xd4, 0xa0, 0x8b, 0x63, 0xc4, 0x20,
-  0x01, 0x40, 0x10, 0x0c, 0x10, 0xda, 0xf8, 0x8b, 0xd1, 0x48, 0x0d, 0xbb,
-  0x60, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0xa1, 0x8d, 0xbf, 0x18,
-  0x0d, 0xd5, 0xc8, 0x8b, 0x6c, 0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 0x10,
-  0xda, 0xf8, 0x8b, 0xd1, 0x50, 0x0d, 0xba, 0x20, 0x46, 0x0c, 0x12, 0x00,
-  0x04, 0xc1, 0x00, 0xa1, 0x8d, 0xbf, 0x18, 0x0d, 0xd5, 0xb0, 0x8b, 0x65,
-  0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 0x10, 0xda, 0xf8, 0x8b, 0xd1, 0x00,
-  0x8d, 0xbc, 0xc0, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0xa1, 0x8d,
-  0xbf, 0x18, 0x0d, 0xd0, 0xa0, 0x8b, 0x60, 0xc4, 0x20, 0x01, 0x40, 0x10,
-  0x0c, 0x10, 0xda, 0xf8, 0x8b, 0xd1, 0x00, 0x0d, 0xbb, 0x50, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00
-};
@@ -1,3191 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float       
-; POSITION                 0   xyzw        1     NONE   float   xyzw
-; POSITION                 1   xyz         2     NONE   float   xyz 
-; TBN_MATRIX               0   xyz         3     NONE   float   xyz 
-; TBN_MATRIX               1   xyz         4     NONE   float   xyz 
-; TBN_MATRIX               2   xyz         5     NONE   float   xyz 
-; TEXCOORD                 0   xy          6     NONE   float   xy  
-; MATERIAL                 0   x           7     NONE    uint   x   
-; MATERIAL                 1    y          7     NONE    uint    y  
-; MATERIAL                 2     z         7     NONE    uint     z 
-; MATERIAL                 3      w        7     NONE    uint      w
-; MATERIAL                 4   x           8     NONE    uint       
-; MATERIAL                 5    y          8     NONE    uint    y  
-; OBJECT_FLAGS             0     z         8     NONE    uint     z 
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Target                0   xyzw        0   TARGET   float   xyzw
-;
-; shader hash: d303faceae1c140fda9c4d88ee12e541
-;
-; Pipeline Runtime Information: 
-;
-; Pixel Shader
-; DepthOutput=0
-; SampleFrequency=0
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; POSITION                 0                 linear       
-; POSITION                 1                 linear       
-; TBN_MATRIX               0                 linear       
-; TEXCOORD                 0                 linear       
-; MATERIAL                 0        nointerpolation       
-; MATERIAL                 1        nointerpolation       
-; MATERIAL                 2        nointerpolation       
-; MATERIAL                 3        nointerpolation       
-; MATERIAL                 4        nointerpolation       
-; MATERIAL                 5        nointerpolation       
-; OBJECT_FLAGS             0        nointerpolation       
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Target                0                              
-;
-; Buffer Definitions:
-;
-; cbuffer rootConstants
-; {
-;
-;   struct rootConstants
-;   {
-;
-;       struct struct.RootConstants
-;       {
-;
-;           uint iblSpecularMIPCount;                 ; Offset:    0
-;       
-;       } rootConstants;                              ; Offset:    0
-;
-;   
-;   } rootConstants;                                  ; Offset:    0 Size:     4
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for lightBuffer
-; {
-;
-;   struct struct.Light
-;   {
-;
-;       float3 position;                              ; Offset:    0
-;       float radius;                                 ; Offset:   12
-;       float3 color;                                 ; Offset:   16
-;       uint flags;                                   ; Offset:   28
-;   
-;   } $Element;                                       ; Offset:    0 Size:    32
-;
-; }
-;
-; Resource bind info for lightClusterBuffer
-; {
-;
-;   struct struct.LightCluster
-;   {
-;
-;       uint lightCount;                              ; Offset:    0
-;       uint lights[63];                              ; Offset:    4
-;   
-;   } $Element;                                       ; Offset:    0 Size:   256
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; rootConstants                     cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; textureSampler                    sampler      NA          NA      S0             s0     1
-; cubeSampler                       sampler      NA          NA      S1             s1     1
-; dfgLUTSampler                     sampler      NA          NA      S2             s2     1
-; lightBuffer                       texture  struct         r/o      T0             t0     1
-; lightClusterBuffer                texture  struct         r/o      T1             t1     1
-; dfgLUT                            texture     f32          2d      T2             t2     1
-; iblDiffTexture                    texture     f32        cube      T3             t3     1
-; iblSpecTexture                    texture     f32        cube      T4             t4     1
-; textures                          texture     f32          2d      T5      t0,space1unbounded
-;
-;
-; ViewId state:
-;
-; Number of inputs: 35, outputs: 4
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 16, 17, 18, 20, 21, 22, 24, 25, 28, 29, 30, 31, 33, 34 }
-;   output 1 depends on inputs: { 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 16, 17, 18, 20, 21, 22, 24, 25, 28, 29, 30, 31, 33, 34 }
-;   output 2 depends on inputs: { 4, 5, 6, 7, 8, 9, 10, 12, 13, 14, 16, 17, 18, 20, 21, 22, 24, 25, 28, 29, 30, 31, 33, 34 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%"class.StructuredBuffer<Light>" = type { %struct.Light }
-%struct.Light = type { <3 x float>, float, <3 x float>, i32 }
-%"class.StructuredBuffer<LightCluster>" = type { %struct.LightCluster }
-%struct.LightCluster = type { i32, [63 x i32] }
-%"class.Texture2D<vector<float, 3> >" = type { <3 x float>, %"class.Texture2D<vector<float, 3> >::mips_type" }
-%"class.Texture2D<vector<float, 3> >::mips_type" = type { i32 }
-%"class.TextureCube<vector<float, 3> >" = type { <3 x float> }
-%"class.Texture2D<vector<float, 4> >" = type { <4 x float>, %"class.Texture2D<vector<float, 4> >::mips_type" }
-%"class.Texture2D<vector<float, 4> >::mips_type" = type { i32 }
-%rootConstants = type { %struct.RootConstants }
-%struct.RootConstants = type { i32 }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-%struct.SamplerState = type { i32 }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 4, i32 4, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 3, i32 3, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 2, i32 2, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %5 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %6 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 2, i32 2, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %7 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %8 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %9 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %10 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %11 = call i32 @dx.op.loadInput.i32(i32 4, i32 11, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %12 = call i32 @dx.op.loadInput.i32(i32 4, i32 10, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %13 = call i32 @dx.op.loadInput.i32(i32 4, i32 8, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %14 = call i32 @dx.op.loadInput.i32(i32 4, i32 7, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %15 = call i32 @dx.op.loadInput.i32(i32 4, i32 6, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %16 = call i32 @dx.op.loadInput.i32(i32 4, i32 5, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %17 = call float @dx.op.loadInput.f32(i32 4, i32 4, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %18 = call float @dx.op.loadInput.f32(i32 4, i32 4, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %19 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %20 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %21 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %22 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %23 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %24 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %25 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %26 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %27 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %28 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %29 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 1, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %30 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 1, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %31 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 1, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %32 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 2, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %33 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 2, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %34 = call float @dx.op.loadInput.f32(i32 4, i32 3, i32 2, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %35 = lshr i32 %11, 1
-  %36 = icmp eq i32 %35, 0
-  br i1 %36, label %37, label %327
-
-; <label>:37                                      ; preds = %0
-  %38 = add i32 %16, 0
-  %39 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %38, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %40 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %39, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %41 = extractvalue %dx.types.ResRet.f32 %40, 0
-  %42 = extractvalue %dx.types.ResRet.f32 %40, 1
-  %43 = extractvalue %dx.types.ResRet.f32 %40, 2
-  %44 = add i32 %15, 0
-  %45 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %44, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %46 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %45, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %47 = extractvalue %dx.types.ResRet.f32 %46, 0
-  %48 = extractvalue %dx.types.ResRet.f32 %46, 1
-  %49 = add i32 %14, 0
-  %50 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %49, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %51 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %50, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %52 = extractvalue %dx.types.ResRet.f32 %51, 0
-  %53 = add i32 %13, 0
-  %54 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %53, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %55 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %54, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %56 = extractvalue %dx.types.ResRet.f32 %55, 0
-  %57 = fmul fast float %52, %52
-  %58 = call float @dx.op.binary.f32(i32 35, float %57, float 0x3FA99999A0000000)  ; FMax(a,b)
-  %59 = fmul fast float %47, 2.000000e+00
-  %60 = fmul fast float %48, 2.000000e+00
-  %61 = fadd fast float %59, -1.000000e+00
-  %62 = fadd fast float %60, -1.000000e+00
-  %63 = fmul fast float %61, %61
-  %64 = fsub fast float 1.000000e+00, %63
-  %65 = fmul fast float %62, %62
-  %66 = fsub fast float %64, %65
-  %67 = call float @dx.op.unary.f32(i32 24, float %66)  ; Sqrt(value)
-  %68 = fmul fast float %61, %26
-  %69 = call float @dx.op.tertiary.f32(i32 46, float %62, float %27, float %68)  ; FMad(a,b,c)
-  %70 = call float @dx.op.tertiary.f32(i32 46, float %67, float %28, float %69)  ; FMad(a,b,c)
-  %71 = fmul fast float %61, %29
-  %72 = call float @dx.op.tertiary.f32(i32 46, float %62, float %30, float %71)  ; FMad(a,b,c)
-  %73 = call float @dx.op.tertiary.f32(i32 46, float %67, float %31, float %72)  ; FMad(a,b,c)
-  %74 = fmul fast float %61, %32
-  %75 = call float @dx.op.tertiary.f32(i32 46, float %62, float %33, float %74)  ; FMad(a,b,c)
-  %76 = call float @dx.op.tertiary.f32(i32 46, float %67, float %34, float %75)  ; FMad(a,b,c)
-  %77 = call float @dx.op.dot3.f32(i32 55, float %70, float %73, float %76, float %70, float %73, float %76)  ; Dot3(ax,ay,az,bx,by,bz)
-  %78 = call float @dx.op.unary.f32(i32 25, float %77)  ; Rsqrt(value)
-  %79 = fmul fast float %78, %70
-  %80 = fmul fast float %78, %73
-  %81 = fmul fast float %78, %76
-  %82 = fsub fast float 1.000000e+00, %56
-  %83 = fmul fast float %82, %41
-  %84 = fmul fast float %82, %42
-  %85 = fmul fast float %82, %43
-  %86 = fadd fast float %41, 0xBFA47AE140000000
-  %87 = fadd fast float %42, 0xBFA47AE140000000
-  %88 = fadd fast float %43, 0xBFA47AE140000000
-  %89 = fmul fast float %56, %86
-  %90 = fmul fast float %56, %87
-  %91 = fmul fast float %56, %88
-  %92 = fadd fast float %89, 0x3FA47AE140000000
-  %93 = fadd fast float %90, 0x3FA47AE140000000
-  %94 = fadd fast float %91, 0x3FA47AE140000000
-  %95 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 16)  ; CBufferLoadLegacy(handle,regIndex)
-  %96 = extractvalue %dx.types.CBufRet.f32 %95, 0
-  %97 = extractvalue %dx.types.CBufRet.f32 %95, 1
-  %98 = extractvalue %dx.types.CBufRet.f32 %95, 2
-  %99 = fsub fast float %96, %19
-  %100 = fsub fast float %97, %20
-  %101 = fsub fast float %98, %21
-  %102 = call float @dx.op.dot3.f32(i32 55, float %99, float %100, float %101, float %99, float %100, float %101)  ; Dot3(ax,ay,az,bx,by,bz)
-  %103 = call float @dx.op.unary.f32(i32 25, float %102)  ; Rsqrt(value)
-  %104 = fmul fast float %99, %103
-  %105 = fmul fast float %100, %103
-  %106 = fmul fast float %101, %103
-  %107 = call float @dx.op.dot3.f32(i32 55, float %79, float %80, float %81, float %104, float %105, float %106)  ; Dot3(ax,ay,az,bx,by,bz)
-  %108 = call float @dx.op.unary.f32(i32 6, float %107)  ; FAbs(value)
-  %109 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %3, %dx.types.Handle %6, float %108, float %52, float undef, float undef, i32 0, i32 0, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %110 = extractvalue %dx.types.ResRet.f32 %109, 1
-  %111 = fdiv fast float 1.000000e+00, %110
-  %112 = fadd fast float %111, -1.000000e+00
-  %113 = fmul fast float %112, %92
-  %114 = fmul fast float %112, %93
-  %115 = fmul fast float %112, %94
-  %116 = fadd fast float %113, 1.000000e+00
-  %117 = fadd fast float %114, 1.000000e+00
-  %118 = fadd fast float %115, 1.000000e+00
-  %119 = fdiv fast float %22, %25
-  %120 = fdiv fast float %23, %25
-  %121 = fmul fast float %119, 8.000000e+00
-  %122 = fadd fast float %121, 8.000000e+00
-  %123 = fmul fast float %120, 4.000000e+00
-  %124 = fadd fast float %123, 4.000000e+00
-  %125 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %126 = extractvalue %dx.types.CBufRet.f32 %125, 2
-  %127 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %128 = extractvalue %dx.types.CBufRet.f32 %127, 2
-  %129 = fsub fast float %24, %128
-  %130 = fdiv fast float %129, %126
-  %131 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %132 = extractvalue %dx.types.CBufRet.f32 %131, 3
-  %133 = extractvalue %dx.types.CBufRet.f32 %131, 2
-  %134 = fsub fast float -0.000000e+00, %130
-  %135 = call float @dx.op.unary.f32(i32 23, float %134)  ; Log(value)
-  %136 = fmul fast float %135, %133
-  %137 = fsub fast float %136, %132
-  %138 = fptoui float %137 to i32
-  %139 = call i32 @dx.op.binary.i32(i32 40, i32 %138, i32 23)  ; UMin(a,b)
-  %140 = fptoui float %122 to i32
-  %141 = fptoui float %124 to i32
-  %142 = shl i32 %141, 4
-  %143 = add i32 %142, %140
-  %144 = shl i32 %139, 7
-  %145 = add i32 %143, %144
-  %146 = fsub fast float 0x3FEEB851E0000000, %91
-  %147 = fsub fast float 0x3FEEB851E0000000, %90
-  %148 = fsub fast float 0x3FEEB851E0000000, %89
-  br label %149
-
-; <label>:149                                     ; preds = %157, %37
-  %150 = phi float [ 0.000000e+00, %37 ], [ %266, %157 ]
-  %151 = phi float [ 0.000000e+00, %37 ], [ %267, %157 ]
-  %152 = phi float [ 0.000000e+00, %37 ], [ %268, %157 ]
-  %153 = phi i32 [ 0, %37 ], [ %269, %157 ]
-  %154 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %145, i32 0)  ; BufferLoad(srv,index,wot)
-  %155 = extractvalue %dx.types.ResRet.i32 %154, 0
-  %156 = icmp ult i32 %153, %155
-  br i1 %156, label %157, label %270
-
-; <label>:157                                     ; preds = %149
-  %158 = shl i32 %153, 2
-  %159 = add i32 %158, 4
-  %160 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %145, i32 %159)  ; BufferLoad(srv,index,wot)
-  %161 = extractvalue %dx.types.ResRet.i32 %160, 0
-  %162 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %161, i32 0)  ; BufferLoad(srv,index,wot)
-  %163 = extractvalue %dx.types.ResRet.f32 %162, 0
-  %164 = extractvalue %dx.types.ResRet.f32 %162, 1
-  %165 = extractvalue %dx.types.ResRet.f32 %162, 2
-  %166 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %161, i32 12)  ; BufferLoad(srv,index,wot)
-  %167 = extractvalue %dx.types.ResRet.f32 %166, 0
-  %168 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %161, i32 16)  ; BufferLoad(srv,index,wot)
-  %169 = extractvalue %dx.types.ResRet.f32 %168, 0
-  %170 = extractvalue %dx.types.ResRet.f32 %168, 1
-  %171 = extractvalue %dx.types.ResRet.f32 %168, 2
-  %172 = fsub fast float %163, %19
-  %173 = fsub fast float %164, %20
-  %174 = fsub fast float %165, %21
-  %175 = fmul fast float %172, %172
-  %176 = fmul fast float %173, %173
-  %177 = fadd fast float %175, %176
-  %178 = fmul fast float %174, %174
-  %179 = fadd fast float %177, %178
-  %180 = call float @dx.op.unary.f32(i32 24, float %179)  ; Sqrt(value)
-  %181 = fdiv fast float %172, %180
-  %182 = fdiv fast float %173, %180
-  %183 = fdiv fast float %174, %180
-  %184 = fadd fast float %181, %104
-  %185 = fadd fast float %182, %105
-  %186 = fadd fast float %183, %106
-  %187 = call float @dx.op.dot3.f32(i32 55, float %184, float %185, float %186, float %184, float %185, float %186)  ; Dot3(ax,ay,az,bx,by,bz)
-  %188 = call float @dx.op.unary.f32(i32 25, float %187)  ; Rsqrt(value)
-  %189 = fmul fast float %188, %184
-  %190 = fmul fast float %188, %185
-  %191 = fmul fast float %188, %186
-  %192 = call float @dx.op.dot3.f32(i32 55, float %79, float %80, float %81, float %189, float %190, float %191)  ; Dot3(ax,ay,az,bx,by,bz)
-  %193 = call float @dx.op.unary.f32(i32 7, float %192)  ; Saturate(value)
-  %194 = call float @dx.op.dot3.f32(i32 55, float %79, float %80, float %81, float %181, float %182, float %183)  ; Dot3(ax,ay,az,bx,by,bz)
-  %195 = call float @dx.op.unary.f32(i32 7, float %194)  ; Saturate(value)
-  %196 = call float @dx.op.dot3.f32(i32 55, float %104, float %105, float %106, float %189, float %190, float %191)  ; Dot3(ax,ay,az,bx,by,bz)
-  %197 = call float @dx.op.unary.f32(i32 7, float %196)  ; Saturate(value)
-  %198 = fsub fast float 1.000000e+00, %197
-  %199 = call float @dx.op.unary.f32(i32 23, float %198)  ; Log(value)
-  %200 = fmul fast float %199, 5.000000e+00
-  %201 = call float @dx.op.unary.f32(i32 21, float %200)  ; Exp(value)
-  %202 = fmul fast float %201, %148
-  %203 = fmul fast float %201, %147
-  %204 = fmul fast float %201, %146
-  %205 = fadd fast float %202, %92
-  %206 = fadd fast float %203, %93
-  %207 = fadd fast float %204, %94
-  %208 = fmul fast float %58, %58
-  %209 = fadd fast float %208, -1.000000e+00
-  %210 = fmul fast float %193, %193
-  %211 = fmul fast float %210, %209
-  %212 = fadd fast float %211, 1.000000e+00
-  %213 = fmul fast float %212, %212
-  %214 = fmul fast float %213, 0x400921FB60000000
-  %215 = fdiv fast float %208, %214
-  %216 = fsub fast float 1.000000e+00, %208
-  %217 = fmul fast float %108, %108
-  %218 = fmul fast float %217, %216
-  %219 = fadd fast float %218, %208
-  %220 = call float @dx.op.unary.f32(i32 24, float %219)  ; Sqrt(value)
-  %221 = fmul fast float %220, %195
-  %222 = fmul fast float %195, %195
-  %223 = fmul fast float %222, %216
-  %224 = fadd fast float %223, %208
-  %225 = call float @dx.op.unary.f32(i32 24, float %224)  ; Sqrt(value)
-  %226 = fmul fast float %225, %108
-  %227 = fadd fast float %226, %221
-  %228 = fdiv fast float 5.000000e-01, %227
-  %229 = fmul fast float %228, %215
-  %230 = fmul fast float %205, %116
-  %231 = fmul fast float %230, %229
-  %232 = fmul fast float %206, %117
-  %233 = fmul fast float %232, %229
-  %234 = fmul fast float %207, %118
-  %235 = fmul fast float %234, %229
-  %236 = fmul fast float %83, 0x3FD45F3060000000
-  %237 = fmul fast float %84, 0x3FD45F3060000000
-  %238 = fmul fast float %85, 0x3FD45F3060000000
-  %239 = fsub fast float 1.000000e+00, %205
-  %240 = fsub fast float 1.000000e+00, %206
-  %241 = fsub fast float 1.000000e+00, %207
-  %242 = fmul fast float %236, %239
-  %243 = fmul fast float %237, %240
-  %244 = fmul fast float %238, %241
-  %245 = fadd fast float %231, %242
-  %246 = fadd fast float %233, %243
-  %247 = fadd fast float %235, %244
-  %248 = fdiv fast float %180, %167
-  %249 = fmul fast float %248, %248
-  %250 = fmul fast float %249, %249
-  %251 = fsub fast float 1.000000e+00, %250
-  %252 = call float @dx.op.unary.f32(i32 7, float %251)  ; Saturate(value)
-  %253 = fmul fast float %252, %252
-  %254 = fmul fast float %180, %180
-  %255 = fadd fast float %254, 1.000000e+00
-  %256 = fdiv fast float %253, %255
-  %257 = fmul fast float %195, %169
-  %258 = fmul fast float %257, %256
-  %259 = fmul fast float %258, %245
-  %260 = fmul fast float %195, %170
-  %261 = fmul fast float %260, %256
-  %262 = fmul fast float %261, %246
-  %263 = fmul fast float %195, %171
-  %264 = fmul fast float %263, %256
-  %265 = fmul fast float %264, %247
-  %266 = fadd fast float %259, %150
-  %267 = fadd fast float %262, %151
-  %268 = fadd fast float %265, %152
-  %269 = add i32 %153, 1
-  br label %149
-
-; <label>:270                                     ; preds = %149
-  %271 = extractvalue %dx.types.ResRet.f32 %51, 1
-  %272 = extractvalue %dx.types.ResRet.f32 %109, 0
-  %273 = fsub fast float 1.000000e+00, %108
-  %274 = call float @dx.op.unary.f32(i32 23, float %273)  ; Log(value)
-  %275 = fmul fast float %274, 5.000000e+00
-  %276 = call float @dx.op.unary.f32(i32 21, float %275)  ; Exp(value)
-  %277 = fmul fast float %276, %148
-  %278 = fmul fast float %276, %147
-  %279 = fmul fast float %276, %146
-  %280 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %2, %dx.types.Handle %7, float %79, float %81, float %80, float undef, i32 undef, i32 undef, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %281 = extractvalue %dx.types.ResRet.f32 %280, 0
-  %282 = extractvalue %dx.types.ResRet.f32 %280, 1
-  %283 = extractvalue %dx.types.ResRet.f32 %280, 2
-  %284 = fsub fast float %148, %277
-  %285 = fsub fast float %147, %278
-  %286 = fsub fast float %146, %279
-  %287 = fmul fast float %108, 2.000000e+00
-  %288 = fmul fast float %287, %79
-  %289 = fmul fast float %287, %80
-  %290 = fmul fast float %287, %81
-  %291 = fsub fast float %288, %104
-  %292 = fsub fast float %289, %105
-  %293 = fsub fast float %290, %106
-  %294 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %10, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %295 = extractvalue %dx.types.CBufRet.i32 %294, 0
-  %296 = uitofp i32 %295 to float
-  %297 = fmul fast float %296, %52
-  %298 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %1, %dx.types.Handle %7, float %291, float %293, float %292, float undef, i32 undef, i32 undef, i32 undef, float %297)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %299 = extractvalue %dx.types.ResRet.f32 %298, 0
-  %300 = extractvalue %dx.types.ResRet.f32 %298, 1
-  %301 = extractvalue %dx.types.ResRet.f32 %298, 2
-  %302 = fsub fast float %110, %272
-  %303 = fmul fast float %302, %92
-  %304 = fmul fast float %302, %93
-  %305 = fmul fast float %302, %94
-  %306 = fadd fast float %303, %272
-  %307 = fadd fast float %304, %272
-  %308 = fadd fast float %305, %272
-  %309 = fmul fast float %299, %306
-  %310 = fmul fast float %300, %307
-  %311 = fmul fast float %301, %308
-  %312 = fmul fast float %284, %83
-  %313 = fmul fast float %312, %281
-  %314 = fmul fast float %285, %84
-  %315 = fmul fast float %314, %282
-  %316 = fmul fast float %286, %85
-  %317 = fmul fast float %316, %283
-  %318 = fadd fast float %309, %313
-  %319 = fadd fast float %310, %315
-  %320 = fadd fast float %311, %317
-  %321 = fmul fast float %318, %271
-  %322 = fmul fast float %319, %271
-  %323 = fmul fast float %320, %271
-  %324 = fadd fast float %321, %150
-  %325 = fadd fast float %322, %151
-  %326 = fadd fast float %323, %152
-  br label %1273
-
-; <label>:327                                     ; preds = %0
-  %328 = icmp eq i32 %35, 1
-  br i1 %328, label %329, label %628
-
-; <label>:329                                     ; preds = %327
-  %330 = add i32 %12, 0
-  %331 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %330, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %332 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %331, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %333 = extractvalue %dx.types.ResRet.f32 %332, 1
-  %334 = add i32 %16, 0
-  %335 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %334, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %336 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %335, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %337 = extractvalue %dx.types.ResRet.f32 %336, 0
-  %338 = extractvalue %dx.types.ResRet.f32 %336, 1
-  %339 = extractvalue %dx.types.ResRet.f32 %336, 2
-  %340 = add i32 %15, 0
-  %341 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %340, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %342 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %341, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %343 = extractvalue %dx.types.ResRet.f32 %342, 0
-  %344 = extractvalue %dx.types.ResRet.f32 %342, 1
-  %345 = add i32 %14, 0
-  %346 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %345, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %347 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %346, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %348 = extractvalue %dx.types.ResRet.f32 %347, 0
-  %349 = add i32 %13, 0
-  %350 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %349, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %351 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %350, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %352 = extractvalue %dx.types.ResRet.f32 %351, 0
-  %353 = fmul fast float %348, %348
-  %354 = call float @dx.op.binary.f32(i32 35, float %353, float 0x3FA99999A0000000)  ; FMax(a,b)
-  %355 = fmul fast float %343, 2.000000e+00
-  %356 = fmul fast float %344, 2.000000e+00
-  %357 = fadd fast float %355, -1.000000e+00
-  %358 = fadd fast float %356, -1.000000e+00
-  %359 = fmul fast float %357, %357
-  %360 = fsub fast float 1.000000e+00, %359
-  %361 = fmul fast float %358, %358
-  %362 = fsub fast float %360, %361
-  %363 = call float @dx.op.unary.f32(i32 24, float %362)  ; Sqrt(value)
-  %364 = fmul fast float %357, %26
-  %365 = call float @dx.op.tertiary.f32(i32 46, float %358, float %27, float %364)  ; FMad(a,b,c)
-  %366 = call float @dx.op.tertiary.f32(i32 46, float %363, float %28, float %365)  ; FMad(a,b,c)
-  %367 = fmul fast float %357, %29
-  %368 = call float @dx.op.tertiary.f32(i32 46, float %358, float %30, float %367)  ; FMad(a,b,c)
-  %369 = call float @dx.op.tertiary.f32(i32 46, float %363, float %31, float %368)  ; FMad(a,b,c)
-  %370 = fmul fast float %357, %32
-  %371 = call float @dx.op.tertiary.f32(i32 46, float %358, float %33, float %370)  ; FMad(a,b,c)
-  %372 = call float @dx.op.tertiary.f32(i32 46, float %363, float %34, float %371)  ; FMad(a,b,c)
-  %373 = call float @dx.op.dot3.f32(i32 55, float %366, float %369, float %372, float %366, float %369, float %372)  ; Dot3(ax,ay,az,bx,by,bz)
-  %374 = call float @dx.op.unary.f32(i32 25, float %373)  ; Rsqrt(value)
-  %375 = fmul fast float %374, %366
-  %376 = fmul fast float %374, %369
-  %377 = fmul fast float %374, %372
-  %378 = fsub fast float 1.000000e+00, %352
-  %379 = fmul fast float %378, %337
-  %380 = fmul fast float %378, %338
-  %381 = fmul fast float %378, %339
-  %382 = fadd fast float %337, 0xBFA47AE140000000
-  %383 = fadd fast float %338, 0xBFA47AE140000000
-  %384 = fadd fast float %339, 0xBFA47AE140000000
-  %385 = fmul fast float %352, %382
-  %386 = fmul fast float %352, %383
-  %387 = fmul fast float %352, %384
-  %388 = fadd fast float %385, 0x3FA47AE140000000
-  %389 = fadd fast float %386, 0x3FA47AE140000000
-  %390 = fadd fast float %387, 0x3FA47AE140000000
-  %391 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 16)  ; CBufferLoadLegacy(handle,regIndex)
-  %392 = extractvalue %dx.types.CBufRet.f32 %391, 0
-  %393 = extractvalue %dx.types.CBufRet.f32 %391, 1
-  %394 = extractvalue %dx.types.CBufRet.f32 %391, 2
-  %395 = fsub fast float %392, %19
-  %396 = fsub fast float %393, %20
-  %397 = fsub fast float %394, %21
-  %398 = call float @dx.op.dot3.f32(i32 55, float %395, float %396, float %397, float %395, float %396, float %397)  ; Dot3(ax,ay,az,bx,by,bz)
-  %399 = call float @dx.op.unary.f32(i32 25, float %398)  ; Rsqrt(value)
-  %400 = fmul fast float %395, %399
-  %401 = fmul fast float %396, %399
-  %402 = fmul fast float %397, %399
-  %403 = call float @dx.op.dot3.f32(i32 55, float %375, float %376, float %377, float %400, float %401, float %402)  ; Dot3(ax,ay,az,bx,by,bz)
-  %404 = call float @dx.op.unary.f32(i32 6, float %403)  ; FAbs(value)
-  %405 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %3, %dx.types.Handle %6, float %404, float %348, float undef, float undef, i32 0, i32 0, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %406 = extractvalue %dx.types.ResRet.f32 %405, 1
-  %407 = fdiv fast float 1.000000e+00, %406
-  %408 = fadd fast float %407, -1.000000e+00
-  %409 = fmul fast float %408, %388
-  %410 = fmul fast float %408, %389
-  %411 = fmul fast float %408, %390
-  %412 = fadd fast float %409, 1.000000e+00
-  %413 = fadd fast float %410, 1.000000e+00
-  %414 = fadd fast float %411, 1.000000e+00
-  %415 = fdiv fast float %22, %25
-  %416 = fdiv fast float %23, %25
-  %417 = fmul fast float %415, 8.000000e+00
-  %418 = fadd fast float %417, 8.000000e+00
-  %419 = fmul fast float %416, 4.000000e+00
-  %420 = fadd fast float %419, 4.000000e+00
-  %421 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %422 = extractvalue %dx.types.CBufRet.f32 %421, 2
-  %423 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %424 = extractvalue %dx.types.CBufRet.f32 %423, 2
-  %425 = fsub fast float %24, %424
-  %426 = fdiv fast float %425, %422
-  %427 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %428 = extractvalue %dx.types.CBufRet.f32 %427, 3
-  %429 = extractvalue %dx.types.CBufRet.f32 %427, 2
-  %430 = fsub fast float -0.000000e+00, %426
-  %431 = call float @dx.op.unary.f32(i32 23, float %430)  ; Log(value)
-  %432 = fmul fast float %431, %429
-  %433 = fsub fast float %432, %428
-  %434 = fptoui float %433 to i32
-  %435 = call i32 @dx.op.binary.i32(i32 40, i32 %434, i32 23)  ; UMin(a,b)
-  %436 = fptoui float %418 to i32
-  %437 = fptoui float %420 to i32
-  %438 = shl i32 %437, 4
-  %439 = add i32 %438, %436
-  %440 = shl i32 %435, 7
-  %441 = add i32 %439, %440
-  %442 = fsub fast float 0x3FEEB851E0000000, %387
-  %443 = fsub fast float 0x3FEEB851E0000000, %386
-  %444 = fsub fast float 0x3FEEB851E0000000, %385
-  br label %445
-
-; <label>:445                                     ; preds = %453, %329
-  %446 = phi float [ 0.000000e+00, %329 ], [ %562, %453 ]
-  %447 = phi float [ 0.000000e+00, %329 ], [ %563, %453 ]
-  %448 = phi float [ 0.000000e+00, %329 ], [ %564, %453 ]
-  %449 = phi i32 [ 0, %329 ], [ %565, %453 ]
-  %450 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %441, i32 0)  ; BufferLoad(srv,index,wot)
-  %451 = extractvalue %dx.types.ResRet.i32 %450, 0
-  %452 = icmp ult i32 %449, %451
-  br i1 %452, label %453, label %566
-
-; <label>:453                                     ; preds = %445
-  %454 = shl i32 %449, 2
-  %455 = add i32 %454, 4
-  %456 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %441, i32 %455)  ; BufferLoad(srv,index,wot)
-  %457 = extractvalue %dx.types.ResRet.i32 %456, 0
-  %458 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %457, i32 0)  ; BufferLoad(srv,index,wot)
-  %459 = extractvalue %dx.types.ResRet.f32 %458, 0
-  %460 = extractvalue %dx.types.ResRet.f32 %458, 1
-  %461 = extractvalue %dx.types.ResRet.f32 %458, 2
-  %462 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %457, i32 12)  ; BufferLoad(srv,index,wot)
-  %463 = extractvalue %dx.types.ResRet.f32 %462, 0
-  %464 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %457, i32 16)  ; BufferLoad(srv,index,wot)
-  %465 = extractvalue %dx.types.ResRet.f32 %464, 0
-  %466 = extractvalue %dx.types.ResRet.f32 %464, 1
-  %467 = extractvalue %dx.types.ResRet.f32 %464, 2
-  %468 = fsub fast float %459, %19
-  %469 = fsub fast float %460, %20
-  %470 = fsub fast float %461, %21
-  %471 = fmul fast float %468, %468
-  %472 = fmul fast float %469, %469
-  %473 = fadd fast float %471, %472
-  %474 = fmul fast float %470, %470
-  %475 = fadd fast float %473, %474
-  %476 = call float @dx.op.unary.f32(i32 24, float %475)  ; Sqrt(value)
-  %477 = fdiv fast float %468, %476
-  %478 = fdiv fast float %469, %476
-  %479 = fdiv fast float %470, %476
-  %480 = fadd fast float %477, %400
-  %481 = fadd fast float %478, %401
-  %482 = fadd fast float %479, %402
-  %483 = call float @dx.op.dot3.f32(i32 55, float %480, float %481, float %482, float %480, float %481, float %482)  ; Dot3(ax,ay,az,bx,by,bz)
-  %484 = call float @dx.op.unary.f32(i32 25, float %483)  ; Rsqrt(value)
-  %485 = fmul fast float %484, %480
-  %486 = fmul fast float %484, %481
-  %487 = fmul fast float %484, %482
-  %488 = call float @dx.op.dot3.f32(i32 55, float %375, float %376, float %377, float %485, float %486, float %487)  ; Dot3(ax,ay,az,bx,by,bz)
-  %489 = call float @dx.op.unary.f32(i32 7, float %488)  ; Saturate(value)
-  %490 = call float @dx.op.dot3.f32(i32 55, float %375, float %376, float %377, float %477, float %478, float %479)  ; Dot3(ax,ay,az,bx,by,bz)
-  %491 = call float @dx.op.unary.f32(i32 7, float %490)  ; Saturate(value)
-  %492 = call float @dx.op.dot3.f32(i32 55, float %400, float %401, float %402, float %485, float %486, float %487)  ; Dot3(ax,ay,az,bx,by,bz)
-  %493 = call float @dx.op.unary.f32(i32 7, float %492)  ; Saturate(value)
-  %494 = fsub fast float 1.000000e+00, %493
-  %495 = call float @dx.op.unary.f32(i32 23, float %494)  ; Log(value)
-  %496 = fmul fast float %495, 5.000000e+00
-  %497 = call float @dx.op.unary.f32(i32 21, float %496)  ; Exp(value)
-  %498 = fmul fast float %497, %444
-  %499 = fmul fast float %497, %443
-  %500 = fmul fast float %497, %442
-  %501 = fadd fast float %498, %388
-  %502 = fadd fast float %499, %389
-  %503 = fadd fast float %500, %390
-  %504 = fmul fast float %354, %354
-  %505 = fadd fast float %504, -1.000000e+00
-  %506 = fmul fast float %489, %489
-  %507 = fmul fast float %506, %505
-  %508 = fadd fast float %507, 1.000000e+00
-  %509 = fmul fast float %508, %508
-  %510 = fmul fast float %509, 0x400921FB60000000
-  %511 = fdiv fast float %504, %510
-  %512 = fsub fast float 1.000000e+00, %504
-  %513 = fmul fast float %404, %404
-  %514 = fmul fast float %513, %512
-  %515 = fadd fast float %514, %504
-  %516 = call float @dx.op.unary.f32(i32 24, float %515)  ; Sqrt(value)
-  %517 = fmul fast float %516, %491
-  %518 = fmul fast float %491, %491
-  %519 = fmul fast float %518, %512
-  %520 = fadd fast float %519, %504
-  %521 = call float @dx.op.unary.f32(i32 24, float %520)  ; Sqrt(value)
-  %522 = fmul fast float %521, %404
-  %523 = fadd fast float %522, %517
-  %524 = fdiv fast float 5.000000e-01, %523
-  %525 = fmul fast float %524, %511
-  %526 = fmul fast float %501, %412
-  %527 = fmul fast float %526, %525
-  %528 = fmul fast float %502, %413
-  %529 = fmul fast float %528, %525
-  %530 = fmul fast float %503, %414
-  %531 = fmul fast float %530, %525
-  %532 = fmul fast float %379, 0x3FD45F3060000000
-  %533 = fmul fast float %380, 0x3FD45F3060000000
-  %534 = fmul fast float %381, 0x3FD45F3060000000
-  %535 = fsub fast float 1.000000e+00, %501
-  %536 = fsub fast float 1.000000e+00, %502
-  %537 = fsub fast float 1.000000e+00, %503
-  %538 = fmul fast float %532, %535
-  %539 = fmul fast float %533, %536
-  %540 = fmul fast float %534, %537
-  %541 = fadd fast float %527, %538
-  %542 = fadd fast float %529, %539
-  %543 = fadd fast float %531, %540
-  %544 = fdiv fast float %476, %463
-  %545 = fmul fast float %544, %544
-  %546 = fmul fast float %545, %545
-  %547 = fsub fast float 1.000000e+00, %546
-  %548 = call float @dx.op.unary.f32(i32 7, float %547)  ; Saturate(value)
-  %549 = fmul fast float %548, %548
-  %550 = fmul fast float %476, %476
-  %551 = fadd fast float %550, 1.000000e+00
-  %552 = fdiv fast float %549, %551
-  %553 = fmul fast float %491, %465
-  %554 = fmul fast float %553, %552
-  %555 = fmul fast float %554, %541
-  %556 = fmul fast float %491, %466
-  %557 = fmul fast float %556, %552
-  %558 = fmul fast float %557, %542
-  %559 = fmul fast float %491, %467
-  %560 = fmul fast float %559, %552
-  %561 = fmul fast float %560, %543
-  %562 = fadd fast float %555, %446
-  %563 = fadd fast float %558, %447
-  %564 = fadd fast float %561, %448
-  %565 = add i32 %449, 1
-  br label %445
-
-; <label>:566                                     ; preds = %445
-  %567 = extractvalue %dx.types.ResRet.f32 %332, 0
-  %568 = extractvalue %dx.types.ResRet.f32 %332, 2
-  %569 = extractvalue %dx.types.ResRet.f32 %347, 1
-  %570 = extractvalue %dx.types.ResRet.f32 %405, 0
-  %571 = fsub fast float 1.000000e+00, %404
-  %572 = call float @dx.op.unary.f32(i32 23, float %571)  ; Log(value)
-  %573 = fmul fast float %572, 5.000000e+00
-  %574 = call float @dx.op.unary.f32(i32 21, float %573)  ; Exp(value)
-  %575 = fmul fast float %574, %444
-  %576 = fmul fast float %574, %443
-  %577 = fmul fast float %574, %442
-  %578 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %2, %dx.types.Handle %7, float %375, float %377, float %376, float undef, i32 undef, i32 undef, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %579 = extractvalue %dx.types.ResRet.f32 %578, 0
-  %580 = extractvalue %dx.types.ResRet.f32 %578, 1
-  %581 = extractvalue %dx.types.ResRet.f32 %578, 2
-  %582 = fsub fast float %444, %575
-  %583 = fsub fast float %443, %576
-  %584 = fsub fast float %442, %577
-  %585 = fmul fast float %404, 2.000000e+00
-  %586 = fmul fast float %585, %375
-  %587 = fmul fast float %585, %376
-  %588 = fmul fast float %585, %377
-  %589 = fsub fast float %586, %400
-  %590 = fsub fast float %587, %401
-  %591 = fsub fast float %588, %402
-  %592 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %10, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %593 = extractvalue %dx.types.CBufRet.i32 %592, 0
-  %594 = uitofp i32 %593 to float
-  %595 = fmul fast float %594, %348
-  %596 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %1, %dx.types.Handle %7, float %589, float %591, float %590, float undef, i32 undef, i32 undef, i32 undef, float %595)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %597 = extractvalue %dx.types.ResRet.f32 %596, 0
-  %598 = extractvalue %dx.types.ResRet.f32 %596, 1
-  %599 = extractvalue %dx.types.ResRet.f32 %596, 2
-  %600 = fsub fast float %406, %570
-  %601 = fmul fast float %600, %388
-  %602 = fmul fast float %600, %389
-  %603 = fmul fast float %600, %390
-  %604 = fadd fast float %601, %570
-  %605 = fadd fast float %602, %570
-  %606 = fadd fast float %603, %570
-  %607 = fmul fast float %597, %604
-  %608 = fmul fast float %598, %605
-  %609 = fmul fast float %599, %606
-  %610 = fmul fast float %582, %379
-  %611 = fmul fast float %610, %579
-  %612 = fmul fast float %583, %380
-  %613 = fmul fast float %612, %580
-  %614 = fmul fast float %584, %381
-  %615 = fmul fast float %614, %581
-  %616 = fadd fast float %607, %611
-  %617 = fadd fast float %608, %613
-  %618 = fadd fast float %609, %615
-  %619 = fmul fast float %616, %569
-  %620 = fmul fast float %617, %569
-  %621 = fmul fast float %618, %569
-  %622 = fadd fast float %446, %567
-  %623 = fadd fast float %622, %619
-  %624 = fadd fast float %447, %333
-  %625 = fadd fast float %624, %620
-  %626 = fadd fast float %448, %568
-  %627 = fadd fast float %626, %621
-  br label %1273
-
-; <label>:628                                     ; preds = %327
-  %629 = icmp eq i32 %35, 2
-  br i1 %629, label %630, label %1049
-
-; <label>:630                                     ; preds = %628
-  %631 = add i32 %16, 0
-  %632 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %631, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %633 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %632, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %634 = extractvalue %dx.types.ResRet.f32 %633, 0
-  %635 = extractvalue %dx.types.ResRet.f32 %633, 1
-  %636 = extractvalue %dx.types.ResRet.f32 %633, 2
-  %637 = add i32 %15, 0
-  %638 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %637, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %639 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %638, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %640 = extractvalue %dx.types.ResRet.f32 %639, 0
-  %641 = extractvalue %dx.types.ResRet.f32 %639, 1
-  %642 = add i32 %14, 0
-  %643 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %642, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %644 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %643, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %645 = extractvalue %dx.types.ResRet.f32 %644, 0
-  %646 = add i32 %13, 0
-  %647 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %646, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %648 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %647, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %649 = extractvalue %dx.types.ResRet.f32 %648, 0
-  %650 = add i32 %12, 0
-  %651 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %650, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %652 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %651, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %653 = extractvalue %dx.types.ResRet.f32 %652, 0
-  %654 = extractvalue %dx.types.ResRet.f32 %652, 1
-  %655 = extractvalue %dx.types.ResRet.f32 %652, 2
-  %656 = extractvalue %dx.types.ResRet.f32 %652, 3
-  %657 = fmul fast float %645, %645
-  %658 = call float @dx.op.binary.f32(i32 35, float %657, float 0x3FA99999A0000000)  ; FMax(a,b)
-  %659 = fmul fast float %655, %655
-  %660 = call float @dx.op.binary.f32(i32 35, float %659, float 0x3FA99999A0000000)  ; FMax(a,b)
-  %661 = fmul fast float %640, 2.000000e+00
-  %662 = fmul fast float %641, 2.000000e+00
-  %663 = fadd fast float %661, -1.000000e+00
-  %664 = fadd fast float %662, -1.000000e+00
-  %665 = fmul fast float %663, %663
-  %666 = fsub fast float 1.000000e+00, %665
-  %667 = fmul fast float %664, %664
-  %668 = fsub fast float %666, %667
-  %669 = call float @dx.op.unary.f32(i32 24, float %668)  ; Sqrt(value)
-  %670 = fmul fast float %663, %26
-  %671 = call float @dx.op.tertiary.f32(i32 46, float %664, float %27, float %670)  ; FMad(a,b,c)
-  %672 = call float @dx.op.tertiary.f32(i32 46, float %669, float %28, float %671)  ; FMad(a,b,c)
-  %673 = fmul fast float %663, %29
-  %674 = call float @dx.op.tertiary.f32(i32 46, float %664, float %30, float %673)  ; FMad(a,b,c)
-  %675 = call float @dx.op.tertiary.f32(i32 46, float %669, float %31, float %674)  ; FMad(a,b,c)
-  %676 = fmul fast float %663, %32
-  %677 = call float @dx.op.tertiary.f32(i32 46, float %664, float %33, float %676)  ; FMad(a,b,c)
-  %678 = call float @dx.op.tertiary.f32(i32 46, float %669, float %34, float %677)  ; FMad(a,b,c)
-  %679 = call float @dx.op.dot3.f32(i32 55, float %672, float %675, float %678, float %672, float %675, float %678)  ; Dot3(ax,ay,az,bx,by,bz)
-  %680 = call float @dx.op.unary.f32(i32 25, float %679)  ; Rsqrt(value)
-  %681 = fmul fast float %680, %672
-  %682 = fmul fast float %680, %675
-  %683 = fmul fast float %680, %678
-  %684 = fmul fast float %653, 2.000000e+00
-  %685 = fmul fast float %654, 2.000000e+00
-  %686 = fadd fast float %684, -1.000000e+00
-  %687 = fadd fast float %685, -1.000000e+00
-  %688 = fmul fast float %686, %686
-  %689 = fsub fast float 1.000000e+00, %688
-  %690 = fmul fast float %687, %687
-  %691 = fsub fast float %689, %690
-  %692 = call float @dx.op.unary.f32(i32 24, float %691)  ; Sqrt(value)
-  %693 = fmul fast float %686, %26
-  %694 = call float @dx.op.tertiary.f32(i32 46, float %687, float %27, float %693)  ; FMad(a,b,c)
-  %695 = call float @dx.op.tertiary.f32(i32 46, float %692, float %28, float %694)  ; FMad(a,b,c)
-  %696 = fmul fast float %686, %29
-  %697 = call float @dx.op.tertiary.f32(i32 46, float %687, float %30, float %696)  ; FMad(a,b,c)
-  %698 = call float @dx.op.tertiary.f32(i32 46, float %692, float %31, float %697)  ; FMad(a,b,c)
-  %699 = fmul fast float %686, %32
-  %700 = call float @dx.op.tertiary.f32(i32 46, float %687, float %33, float %699)  ; FMad(a,b,c)
-  %701 = call float @dx.op.tertiary.f32(i32 46, float %692, float %34, float %700)  ; FMad(a,b,c)
-  %702 = call float @dx.op.dot3.f32(i32 55, float %695, float %698, float %701, float %695, float %698, float %701)  ; Dot3(ax,ay,az,bx,by,bz)
-  %703 = call float @dx.op.unary.f32(i32 25, float %702)  ; Rsqrt(value)
-  %704 = fmul fast float %703, %695
-  %705 = fmul fast float %703, %698
-  %706 = fmul fast float %703, %701
-  %707 = fsub fast float 1.000000e+00, %649
-  %708 = fmul fast float %707, %634
-  %709 = fmul fast float %707, %635
-  %710 = fmul fast float %707, %636
-  %711 = fadd fast float %634, 0xBFA47AE140000000
-  %712 = fadd fast float %635, 0xBFA47AE140000000
-  %713 = fadd fast float %636, 0xBFA47AE140000000
-  %714 = fmul fast float %649, %711
-  %715 = fmul fast float %649, %712
-  %716 = fmul fast float %649, %713
-  %717 = fadd fast float %714, 0x3FA47AE140000000
-  %718 = fadd fast float %715, 0x3FA47AE140000000
-  %719 = fadd fast float %716, 0x3FA47AE140000000
-  %720 = call float @dx.op.unary.f32(i32 24, float %717)  ; Sqrt(value)
-  %721 = call float @dx.op.unary.f32(i32 24, float %718)  ; Sqrt(value)
-  %722 = call float @dx.op.unary.f32(i32 24, float %719)  ; Sqrt(value)
-  %723 = fmul fast float %720, 5.000000e+00
-  %724 = fmul fast float %721, 5.000000e+00
-  %725 = fmul fast float %722, 5.000000e+00
-  %726 = fsub fast float 1.000000e+00, %723
-  %727 = fsub fast float 1.000000e+00, %724
-  %728 = fsub fast float 1.000000e+00, %725
-  %729 = fsub fast float 5.000000e+00, %720
-  %730 = fsub fast float 5.000000e+00, %721
-  %731 = fsub fast float 5.000000e+00, %722
-  %732 = fmul fast float %726, %726
-  %733 = fmul fast float %727, %727
-  %734 = fmul fast float %728, %728
-  %735 = fmul fast float %729, %729
-  %736 = fmul fast float %730, %730
-  %737 = fmul fast float %731, %731
-  %738 = fdiv fast float %732, %735
-  %739 = fdiv fast float %733, %736
-  %740 = fdiv fast float %734, %737
-  %741 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 16)  ; CBufferLoadLegacy(handle,regIndex)
-  %742 = extractvalue %dx.types.CBufRet.f32 %741, 0
-  %743 = extractvalue %dx.types.CBufRet.f32 %741, 1
-  %744 = extractvalue %dx.types.CBufRet.f32 %741, 2
-  %745 = fsub fast float %742, %19
-  %746 = fsub fast float %743, %20
-  %747 = fsub fast float %744, %21
-  %748 = call float @dx.op.dot3.f32(i32 55, float %745, float %746, float %747, float %745, float %746, float %747)  ; Dot3(ax,ay,az,bx,by,bz)
-  %749 = call float @dx.op.unary.f32(i32 25, float %748)  ; Rsqrt(value)
-  %750 = fmul fast float %745, %749
-  %751 = fmul fast float %746, %749
-  %752 = fmul fast float %747, %749
-  %753 = call float @dx.op.dot3.f32(i32 55, float %681, float %682, float %683, float %750, float %751, float %752)  ; Dot3(ax,ay,az,bx,by,bz)
-  %754 = call float @dx.op.unary.f32(i32 6, float %753)  ; FAbs(value)
-  %755 = call float @dx.op.dot3.f32(i32 55, float %704, float %705, float %706, float %750, float %751, float %752)  ; Dot3(ax,ay,az,bx,by,bz)
-  %756 = call float @dx.op.unary.f32(i32 6, float %755)  ; FAbs(value)
-  %757 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %3, %dx.types.Handle %6, float %754, float %645, float undef, float undef, i32 0, i32 0, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %758 = extractvalue %dx.types.ResRet.f32 %757, 1
-  %759 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %3, %dx.types.Handle %6, float %756, float %655, float undef, float undef, i32 0, i32 0, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %760 = extractvalue %dx.types.ResRet.f32 %759, 1
-  %761 = fdiv fast float 1.000000e+00, %758
-  %762 = fadd fast float %761, -1.000000e+00
-  %763 = fmul fast float %762, %738
-  %764 = fmul fast float %762, %739
-  %765 = fmul fast float %762, %740
-  %766 = fadd fast float %763, 1.000000e+00
-  %767 = fadd fast float %764, 1.000000e+00
-  %768 = fadd fast float %765, 1.000000e+00
-  %769 = fdiv fast float 0x3FA47AE140000000, %760
-  %770 = fadd fast float %769, 0x3FEEB851E0000000
-  %771 = fdiv fast float %22, %25
-  %772 = fdiv fast float %23, %25
-  %773 = fmul fast float %771, 8.000000e+00
-  %774 = fadd fast float %773, 8.000000e+00
-  %775 = fmul fast float %772, 4.000000e+00
-  %776 = fadd fast float %775, 4.000000e+00
-  %777 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %778 = extractvalue %dx.types.CBufRet.f32 %777, 2
-  %779 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %780 = extractvalue %dx.types.CBufRet.f32 %779, 2
-  %781 = fsub fast float %24, %780
-  %782 = fdiv fast float %781, %778
-  %783 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %784 = extractvalue %dx.types.CBufRet.f32 %783, 3
-  %785 = extractvalue %dx.types.CBufRet.f32 %783, 2
-  %786 = fsub fast float -0.000000e+00, %782
-  %787 = call float @dx.op.unary.f32(i32 23, float %786)  ; Log(value)
-  %788 = fmul fast float %787, %785
-  %789 = fsub fast float %788, %784
-  %790 = fptoui float %789 to i32
-  %791 = call i32 @dx.op.binary.i32(i32 40, i32 %790, i32 23)  ; UMin(a,b)
-  %792 = fptoui float %774 to i32
-  %793 = fptoui float %776 to i32
-  %794 = shl i32 %793, 4
-  %795 = add i32 %794, %792
-  %796 = shl i32 %791, 7
-  %797 = add i32 %795, %796
-  %798 = fsub fast float 1.000000e+00, %740
-  %799 = fsub fast float 1.000000e+00, %739
-  %800 = fsub fast float 1.000000e+00, %738
-  br label %801
-
-; <label>:801                                     ; preds = %809, %630
-  %802 = phi float [ 0.000000e+00, %630 ], [ %955, %809 ]
-  %803 = phi float [ 0.000000e+00, %630 ], [ %956, %809 ]
-  %804 = phi float [ 0.000000e+00, %630 ], [ %957, %809 ]
-  %805 = phi i32 [ 0, %630 ], [ %958, %809 ]
-  %806 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %797, i32 0)  ; BufferLoad(srv,index,wot)
-  %807 = extractvalue %dx.types.ResRet.i32 %806, 0
-  %808 = icmp ult i32 %805, %807
-  br i1 %808, label %809, label %959
-
-; <label>:809                                     ; preds = %801
-  %810 = shl i32 %805, 2
-  %811 = add i32 %810, 4
-  %812 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %797, i32 %811)  ; BufferLoad(srv,index,wot)
-  %813 = extractvalue %dx.types.ResRet.i32 %812, 0
-  %814 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %813, i32 0)  ; BufferLoad(srv,index,wot)
-  %815 = extractvalue %dx.types.ResRet.f32 %814, 0
-  %816 = extractvalue %dx.types.ResRet.f32 %814, 1
-  %817 = extractvalue %dx.types.ResRet.f32 %814, 2
-  %818 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %813, i32 12)  ; BufferLoad(srv,index,wot)
-  %819 = extractvalue %dx.types.ResRet.f32 %818, 0
-  %820 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %813, i32 16)  ; BufferLoad(srv,index,wot)
-  %821 = extractvalue %dx.types.ResRet.f32 %820, 0
-  %822 = extractvalue %dx.types.ResRet.f32 %820, 1
-  %823 = extractvalue %dx.types.ResRet.f32 %820, 2
-  %824 = fsub fast float %815, %19
-  %825 = fsub fast float %816, %20
-  %826 = fsub fast float %817, %21
-  %827 = fmul fast float %824, %824
-  %828 = fmul fast float %825, %825
-  %829 = fadd fast float %827, %828
-  %830 = fmul fast float %826, %826
-  %831 = fadd fast float %829, %830
-  %832 = call float @dx.op.unary.f32(i32 24, float %831)  ; Sqrt(value)
-  %833 = fdiv fast float %824, %832
-  %834 = fdiv fast float %825, %832
-  %835 = fdiv fast float %826, %832
-  %836 = fadd fast float %833, %750
-  %837 = fadd fast float %834, %751
-  %838 = fadd fast float %835, %752
-  %839 = call float @dx.op.dot3.f32(i32 55, float %836, float %837, float %838, float %836, float %837, float %838)  ; Dot3(ax,ay,az,bx,by,bz)
-  %840 = call float @dx.op.unary.f32(i32 25, float %839)  ; Rsqrt(value)
-  %841 = fmul fast float %840, %836
-  %842 = fmul fast float %840, %837
-  %843 = fmul fast float %840, %838
-  %844 = call float @dx.op.dot3.f32(i32 55, float %681, float %682, float %683, float %841, float %842, float %843)  ; Dot3(ax,ay,az,bx,by,bz)
-  %845 = call float @dx.op.unary.f32(i32 7, float %844)  ; Saturate(value)
-  %846 = call float @dx.op.dot3.f32(i32 55, float %681, float %682, float %683, float %833, float %834, float %835)  ; Dot3(ax,ay,az,bx,by,bz)
-  %847 = call float @dx.op.unary.f32(i32 7, float %846)  ; Saturate(value)
-  %848 = call float @dx.op.dot3.f32(i32 55, float %750, float %751, float %752, float %841, float %842, float %843)  ; Dot3(ax,ay,az,bx,by,bz)
-  %849 = call float @dx.op.unary.f32(i32 7, float %848)  ; Saturate(value)
-  %850 = call float @dx.op.dot3.f32(i32 55, float %704, float %705, float %706, float %841, float %842, float %843)  ; Dot3(ax,ay,az,bx,by,bz)
-  %851 = call float @dx.op.unary.f32(i32 7, float %850)  ; Saturate(value)
-  %852 = call float @dx.op.dot3.f32(i32 55, float %704, float %705, float %706, float %833, float %834, float %835)  ; Dot3(ax,ay,az,bx,by,bz)
-  %853 = call float @dx.op.unary.f32(i32 7, float %852)  ; Saturate(value)
-  %854 = fsub fast float 1.000000e+00, %849
-  %855 = call float @dx.op.unary.f32(i32 23, float %854)  ; Log(value)
-  %856 = fmul fast float %855, 5.000000e+00
-  %857 = call float @dx.op.unary.f32(i32 21, float %856)  ; Exp(value)
-  %858 = fmul fast float %857, %800
-  %859 = fmul fast float %857, %799
-  %860 = fmul fast float %857, %798
-  %861 = fadd fast float %858, %738
-  %862 = fadd fast float %859, %739
-  %863 = fadd fast float %860, %740
-  %864 = fmul fast float %658, %658
-  %865 = fadd fast float %864, -1.000000e+00
-  %866 = fmul fast float %845, %845
-  %867 = fmul fast float %866, %865
-  %868 = fadd fast float %867, 1.000000e+00
-  %869 = fmul fast float %868, %868
-  %870 = fmul fast float %869, 0x400921FB60000000
-  %871 = fdiv fast float %864, %870
-  %872 = fsub fast float 1.000000e+00, %864
-  %873 = fmul fast float %754, %754
-  %874 = fmul fast float %873, %872
-  %875 = fadd fast float %874, %864
-  %876 = call float @dx.op.unary.f32(i32 24, float %875)  ; Sqrt(value)
-  %877 = fmul fast float %876, %847
-  %878 = fmul fast float %847, %847
-  %879 = fmul fast float %878, %872
-  %880 = fadd fast float %879, %864
-  %881 = call float @dx.op.unary.f32(i32 24, float %880)  ; Sqrt(value)
-  %882 = fmul fast float %881, %754
-  %883 = fadd fast float %882, %877
-  %884 = fdiv fast float 5.000000e-01, %883
-  %885 = fmul fast float %884, %871
-  %886 = fmul fast float %861, %766
-  %887 = fmul fast float %886, %885
-  %888 = fmul fast float %862, %767
-  %889 = fmul fast float %888, %885
-  %890 = fmul fast float %863, %768
-  %891 = fmul fast float %890, %885
-  %892 = fmul fast float %708, 0x3FD45F3060000000
-  %893 = fmul fast float %709, 0x3FD45F3060000000
-  %894 = fmul fast float %710, 0x3FD45F3060000000
-  %895 = fsub fast float 1.000000e+00, %861
-  %896 = fsub fast float 1.000000e+00, %862
-  %897 = fsub fast float 1.000000e+00, %863
-  %898 = fmul fast float %892, %895
-  %899 = fmul fast float %893, %896
-  %900 = fmul fast float %894, %897
-  %901 = fadd fast float %887, %898
-  %902 = fadd fast float %889, %899
-  %903 = fadd fast float %891, %900
-  %904 = fmul fast float %857, 0x3FEEB851E0000000
-  %905 = fadd fast float %904, 0x3FA47AE140000000
-  %906 = fmul fast float %905, %656
-  %907 = fmul fast float %660, %660
-  %908 = fadd fast float %907, -1.000000e+00
-  %909 = fmul fast float %851, %851
-  %910 = fmul fast float %909, %908
-  %911 = fadd fast float %910, 1.000000e+00
-  %912 = fmul fast float %911, %911
-  %913 = fmul fast float %912, 0x400921FB60000000
-  %914 = fdiv fast float %907, %913
-  %915 = fsub fast float 1.000000e+00, %907
-  %916 = fmul fast float %756, %756
-  %917 = fmul fast float %916, %915
-  %918 = fadd fast float %917, %907
-  %919 = call float @dx.op.unary.f32(i32 24, float %918)  ; Sqrt(value)
-  %920 = fmul fast float %919, %853
-  %921 = fmul fast float %853, %853
-  %922 = fmul fast float %921, %915
-  %923 = fadd fast float %922, %907
-  %924 = call float @dx.op.unary.f32(i32 24, float %923)  ; Sqrt(value)
-  %925 = fmul fast float %924, %756
-  %926 = fadd fast float %925, %920
-  %927 = fdiv fast float 5.000000e-01, %926
-  %928 = fsub fast float 1.000000e+00, %906
-  %929 = fdiv fast float %832, %819
-  %930 = fmul fast float %929, %929
-  %931 = fmul fast float %930, %930
-  %932 = fsub fast float 1.000000e+00, %931
-  %933 = call float @dx.op.unary.f32(i32 7, float %932)  ; Saturate(value)
-  %934 = fmul fast float %933, %933
-  %935 = fmul fast float %832, %832
-  %936 = fadd fast float %935, 1.000000e+00
-  %937 = fdiv fast float %934, %936
-  %938 = fmul fast float %937, %821
-  %939 = fmul fast float %937, %822
-  %940 = fmul fast float %937, %823
-  %941 = fmul fast float %928, %847
-  %942 = fmul fast float %941, %901
-  %943 = fmul fast float %941, %902
-  %944 = fmul fast float %941, %903
-  %945 = fmul fast float %853, %770
-  %946 = fmul fast float %945, %914
-  %947 = fmul fast float %946, %906
-  %948 = fmul fast float %947, %927
-  %949 = fadd fast float %948, %942
-  %950 = fadd fast float %948, %943
-  %951 = fadd fast float %948, %944
-  %952 = fmul fast float %938, %949
-  %953 = fmul fast float %939, %950
-  %954 = fmul fast float %940, %951
-  %955 = fadd fast float %952, %802
-  %956 = fadd fast float %953, %803
-  %957 = fadd fast float %954, %804
-  %958 = add i32 %805, 1
-  br label %801
-
-; <label>:959                                     ; preds = %801
-  %960 = extractvalue %dx.types.ResRet.f32 %644, 1
-  %961 = extractvalue %dx.types.ResRet.f32 %757, 0
-  %962 = extractvalue %dx.types.ResRet.f32 %759, 0
-  %963 = fsub fast float 1.000000e+00, %754
-  %964 = call float @dx.op.unary.f32(i32 23, float %963)  ; Log(value)
-  %965 = fmul fast float %964, 5.000000e+00
-  %966 = call float @dx.op.unary.f32(i32 21, float %965)  ; Exp(value)
-  %967 = fmul fast float %966, %800
-  %968 = fmul fast float %966, %799
-  %969 = fmul fast float %966, %798
-  %970 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %2, %dx.types.Handle %7, float %681, float %683, float %682, float undef, i32 undef, i32 undef, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %971 = extractvalue %dx.types.ResRet.f32 %970, 0
-  %972 = extractvalue %dx.types.ResRet.f32 %970, 1
-  %973 = extractvalue %dx.types.ResRet.f32 %970, 2
-  %974 = fsub fast float %800, %967
-  %975 = fsub fast float %799, %968
-  %976 = fsub fast float %798, %969
-  %977 = fmul fast float %754, 2.000000e+00
-  %978 = fmul fast float %977, %681
-  %979 = fmul fast float %977, %682
-  %980 = fmul fast float %977, %683
-  %981 = fsub fast float %978, %750
-  %982 = fsub fast float %979, %751
-  %983 = fsub fast float %980, %752
-  %984 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %10, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %985 = extractvalue %dx.types.CBufRet.i32 %984, 0
-  %986 = uitofp i32 %985 to float
-  %987 = fmul fast float %986, %645
-  %988 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %1, %dx.types.Handle %7, float %981, float %983, float %982, float undef, i32 undef, i32 undef, i32 undef, float %987)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %989 = extractvalue %dx.types.ResRet.f32 %988, 0
-  %990 = extractvalue %dx.types.ResRet.f32 %988, 1
-  %991 = extractvalue %dx.types.ResRet.f32 %988, 2
-  %992 = fsub fast float %758, %961
-  %993 = fmul fast float %992, %738
-  %994 = fmul fast float %992, %739
-  %995 = fmul fast float %992, %740
-  %996 = fadd fast float %993, %961
-  %997 = fadd fast float %994, %961
-  %998 = fadd fast float %995, %961
-  %999 = fmul fast float %989, %996
-  %1000 = fmul fast float %990, %997
-  %1001 = fmul fast float %991, %998
-  %1002 = fsub fast float 1.000000e+00, %756
-  %1003 = call float @dx.op.unary.f32(i32 23, float %1002)  ; Log(value)
-  %1004 = fmul fast float %1003, 5.000000e+00
-  %1005 = call float @dx.op.unary.f32(i32 21, float %1004)  ; Exp(value)
-  %1006 = fmul fast float %1005, 0x3FEEB851E0000000
-  %1007 = fadd fast float %1006, 0x3FA47AE140000000
-  %1008 = fmul fast float %1007, %656
-  %1009 = fmul fast float %756, 2.000000e+00
-  %1010 = fmul fast float %1009, %704
-  %1011 = fmul fast float %1009, %705
-  %1012 = fmul fast float %1009, %706
-  %1013 = fsub fast float %1010, %750
-  %1014 = fsub fast float %1011, %751
-  %1015 = fsub fast float %1012, %752
-  %1016 = fmul fast float %986, %655
-  %1017 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %1, %dx.types.Handle %7, float %1013, float %1015, float %1014, float undef, i32 undef, i32 undef, i32 undef, float %1016)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %1018 = extractvalue %dx.types.ResRet.f32 %1017, 0
-  %1019 = extractvalue %dx.types.ResRet.f32 %1017, 1
-  %1020 = extractvalue %dx.types.ResRet.f32 %1017, 2
-  %1021 = fsub fast float %760, %962
-  %1022 = fmul fast float %1021, 0x3FA47AE140000000
-  %1023 = fadd fast float %1022, %962
-  %1024 = fmul fast float %1018, %1023
-  %1025 = fmul fast float %1019, %1023
-  %1026 = fmul fast float %1020, %1023
-  %1027 = fsub fast float 1.000000e+00, %1008
-  %1028 = fmul fast float %974, %708
-  %1029 = fmul fast float %1028, %971
-  %1030 = fmul fast float %975, %709
-  %1031 = fmul fast float %1030, %972
-  %1032 = fmul fast float %976, %710
-  %1033 = fmul fast float %1032, %973
-  %1034 = fadd fast float %999, %1029
-  %1035 = fadd fast float %1000, %1031
-  %1036 = fadd fast float %1001, %1033
-  %1037 = fmul fast float %1034, %960
-  %1038 = fmul fast float %1037, %1027
-  %1039 = fmul fast float %1035, %960
-  %1040 = fmul fast float %1039, %1027
-  %1041 = fmul fast float %1036, %960
-  %1042 = fmul fast float %1041, %1027
-  %1043 = fadd fast float %1038, %802
-  %1044 = fadd fast float %1040, %803
-  %1045 = fadd fast float %1042, %804
-  %1046 = fadd fast float %1043, %1024
-  %1047 = fadd fast float %1044, %1025
-  %1048 = fadd fast float %1045, %1026
-  br label %1273
-
-; <label>:1049                                    ; preds = %628
-  %1050 = icmp eq i32 %35, 3
-  br i1 %1050, label %1051, label %1273
-
-; <label>:1051                                    ; preds = %1049
-  %1052 = add i32 %16, 0
-  %1053 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %1052, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %1054 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %1053, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %1055 = extractvalue %dx.types.ResRet.f32 %1054, 0
-  %1056 = extractvalue %dx.types.ResRet.f32 %1054, 1
-  %1057 = extractvalue %dx.types.ResRet.f32 %1054, 2
-  %1058 = add i32 %15, 0
-  %1059 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %1058, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %1060 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %1059, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %1061 = extractvalue %dx.types.ResRet.f32 %1060, 0
-  %1062 = extractvalue %dx.types.ResRet.f32 %1060, 1
-  %1063 = add i32 %14, 0
-  %1064 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %1063, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %1065 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %1064, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %1066 = extractvalue %dx.types.ResRet.f32 %1065, 0
-  %1067 = add i32 %12, 0
-  %1068 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 5, i32 %1067, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %1069 = call %dx.types.ResRet.f32 @dx.op.sample.f32(i32 60, %dx.types.Handle %1068, %dx.types.Handle %8, float %17, float %18, float undef, float undef, i32 0, i32 0, i32 undef, float undef)  ; Sample(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,clamp)
-  %1070 = extractvalue %dx.types.ResRet.f32 %1069, 0
-  %1071 = extractvalue %dx.types.ResRet.f32 %1069, 1
-  %1072 = extractvalue %dx.types.ResRet.f32 %1069, 2
-  %1073 = fmul fast float %1066, %1066
-  %1074 = call float @dx.op.binary.f32(i32 35, float %1073, float 0x3FA99999A0000000)  ; FMax(a,b)
-  %1075 = fmul fast float %1061, 2.000000e+00
-  %1076 = fmul fast float %1062, 2.000000e+00
-  %1077 = fadd fast float %1075, -1.000000e+00
-  %1078 = fadd fast float %1076, -1.000000e+00
-  %1079 = fmul fast float %1077, %1077
-  %1080 = fsub fast float 1.000000e+00, %1079
-  %1081 = fmul fast float %1078, %1078
-  %1082 = fsub fast float %1080, %1081
-  %1083 = call float @dx.op.unary.f32(i32 24, float %1082)  ; Sqrt(value)
-  %1084 = fmul fast float %1077, %26
-  %1085 = call float @dx.op.tertiary.f32(i32 46, float %1078, float %27, float %1084)  ; FMad(a,b,c)
-  %1086 = call float @dx.op.tertiary.f32(i32 46, float %1083, float %28, float %1085)  ; FMad(a,b,c)
-  %1087 = fmul fast float %1077, %29
-  %1088 = call float @dx.op.tertiary.f32(i32 46, float %1078, float %30, float %1087)  ; FMad(a,b,c)
-  %1089 = call float @dx.op.tertiary.f32(i32 46, float %1083, float %31, float %1088)  ; FMad(a,b,c)
-  %1090 = fmul fast float %1077, %32
-  %1091 = call float @dx.op.tertiary.f32(i32 46, float %1078, float %33, float %1090)  ; FMad(a,b,c)
-  %1092 = call float @dx.op.tertiary.f32(i32 46, float %1083, float %34, float %1091)  ; FMad(a,b,c)
-  %1093 = call float @dx.op.dot3.f32(i32 55, float %1086, float %1089, float %1092, float %1086, float %1089, float %1092)  ; Dot3(ax,ay,az,bx,by,bz)
-  %1094 = call float @dx.op.unary.f32(i32 25, float %1093)  ; Rsqrt(value)
-  %1095 = fmul fast float %1094, %1086
-  %1096 = fmul fast float %1094, %1089
-  %1097 = fmul fast float %1094, %1092
-  %1098 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 16)  ; CBufferLoadLegacy(handle,regIndex)
-  %1099 = extractvalue %dx.types.CBufRet.f32 %1098, 0
-  %1100 = extractvalue %dx.types.CBufRet.f32 %1098, 1
-  %1101 = extractvalue %dx.types.CBufRet.f32 %1098, 2
-  %1102 = fsub fast float %1099, %19
-  %1103 = fsub fast float %1100, %20
-  %1104 = fsub fast float %1101, %21
-  %1105 = call float @dx.op.dot3.f32(i32 55, float %1102, float %1103, float %1104, float %1102, float %1103, float %1104)  ; Dot3(ax,ay,az,bx,by,bz)
-  %1106 = call float @dx.op.unary.f32(i32 25, float %1105)  ; Rsqrt(value)
-  %1107 = fmul fast float %1102, %1106
-  %1108 = fmul fast float %1103, %1106
-  %1109 = fmul fast float %1104, %1106
-  %1110 = call float @dx.op.dot3.f32(i32 55, float %1095, float %1096, float %1097, float %1107, float %1108, float %1109)  ; Dot3(ax,ay,az,bx,by,bz)
-  %1111 = call float @dx.op.unary.f32(i32 6, float %1110)  ; FAbs(value)
-  %1112 = fdiv fast float %22, %25
-  %1113 = fdiv fast float %23, %25
-  %1114 = fmul fast float %1112, 8.000000e+00
-  %1115 = fadd fast float %1114, 8.000000e+00
-  %1116 = fmul fast float %1113, 4.000000e+00
-  %1117 = fadd fast float %1116, 4.000000e+00
-  %1118 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %1119 = extractvalue %dx.types.CBufRet.f32 %1118, 2
-  %1120 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %1121 = extractvalue %dx.types.CBufRet.f32 %1120, 2
-  %1122 = fsub fast float %24, %1121
-  %1123 = fdiv fast float %1122, %1119
-  %1124 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %9, i32 18)  ; CBufferLoadLegacy(handle,regIndex)
-  %1125 = extractvalue %dx.types.CBufRet.f32 %1124, 3
-  %1126 = extractvalue %dx.types.CBufRet.f32 %1124, 2
-  %1127 = fsub fast float -0.000000e+00, %1123
-  %1128 = call float @dx.op.unary.f32(i32 23, float %1127)  ; Log(value)
-  %1129 = fmul fast float %1128, %1126
-  %1130 = fsub fast float %1129, %1125
-  %1131 = fptoui float %1130 to i32
-  %1132 = call i32 @dx.op.binary.i32(i32 40, i32 %1131, i32 23)  ; UMin(a,b)
-  %1133 = fptoui float %1115 to i32
-  %1134 = fptoui float %1117 to i32
-  %1135 = shl i32 %1134, 4
-  %1136 = add i32 %1135, %1133
-  %1137 = shl i32 %1132, 7
-  %1138 = add i32 %1136, %1137
-  br label %1139
-
-; <label>:1139                                    ; preds = %1147, %1051
-  %1140 = phi float [ 0.000000e+00, %1051 ], [ %1228, %1147 ]
-  %1141 = phi float [ 0.000000e+00, %1051 ], [ %1229, %1147 ]
-  %1142 = phi float [ 0.000000e+00, %1051 ], [ %1230, %1147 ]
-  %1143 = phi i32 [ 0, %1051 ], [ %1231, %1147 ]
-  %1144 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %1138, i32 0)  ; BufferLoad(srv,index,wot)
-  %1145 = extractvalue %dx.types.ResRet.i32 %1144, 0
-  %1146 = icmp ult i32 %1143, %1145
-  br i1 %1146, label %1147, label %1232
-
-; <label>:1147                                    ; preds = %1139
-  %1148 = shl i32 %1143, 2
-  %1149 = add i32 %1148, 4
-  %1150 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %4, i32 %1138, i32 %1149)  ; BufferLoad(srv,index,wot)
-  %1151 = extractvalue %dx.types.ResRet.i32 %1150, 0
-  %1152 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %1151, i32 0)  ; BufferLoad(srv,index,wot)
-  %1153 = extractvalue %dx.types.ResRet.f32 %1152, 0
-  %1154 = extractvalue %dx.types.ResRet.f32 %1152, 1
-  %1155 = extractvalue %dx.types.ResRet.f32 %1152, 2
-  %1156 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %1151, i32 12)  ; BufferLoad(srv,index,wot)
-  %1157 = extractvalue %dx.types.ResRet.f32 %1156, 0
-  %1158 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %5, i32 %1151, i32 16)  ; BufferLoad(srv,index,wot)
-  %1159 = extractvalue %dx.types.ResRet.f32 %1158, 0
-  %1160 = extractvalue %dx.types.ResRet.f32 %1158, 1
-  %1161 = extractvalue %dx.types.ResRet.f32 %1158, 2
-  %1162 = fsub fast float %1153, %19
-  %1163 = fsub fast float %1154, %20
-  %1164 = fsub fast float %1155, %21
-  %1165 = fmul fast float %1162, %1162
-  %1166 = fmul fast float %1163, %1163
-  %1167 = fadd fast float %1165, %1166
-  %1168 = fmul fast float %1164, %1164
-  %1169 = fadd fast float %1167, %1168
-  %1170 = call float @dx.op.unary.f32(i32 24, float %1169)  ; Sqrt(value)
-  %1171 = fdiv fast float %1162, %1170
-  %1172 = fdiv fast float %1163, %1170
-  %1173 = fdiv fast float %1164, %1170
-  %1174 = fadd fast float %1171, %1107
-  %1175 = fadd fast float %1172, %1108
-  %1176 = fadd fast float %1173, %1109
-  %1177 = call float @dx.op.dot3.f32(i32 55, float %1174, float %1175, float %1176, float %1174, float %1175, float %1176)  ; Dot3(ax,ay,az,bx,by,bz)
-  %1178 = call float @dx.op.unary.f32(i32 25, float %1177)  ; Rsqrt(value)
-  %1179 = fmul fast float %1178, %1174
-  %1180 = fmul fast float %1178, %1175
-  %1181 = fmul fast float %1178, %1176
-  %1182 = call float @dx.op.dot3.f32(i32 55, float %1095, float %1096, float %1097, float %1179, float %1180, float %1181)  ; Dot3(ax,ay,az,bx,by,bz)
-  %1183 = call float @dx.op.unary.f32(i32 7, float %1182)  ; Saturate(value)
-  %1184 = call float @dx.op.dot3.f32(i32 55, float %1095, float %1096, float %1097, float %1171, float %1172, float %1173)  ; Dot3(ax,ay,az,bx,by,bz)
-  %1185 = call float @dx.op.unary.f32(i32 7, float %1184)  ; Saturate(value)
-  %1186 = fdiv fast float 1.000000e+00, %1074
-  %1187 = fadd fast float %1186, 2.000000e+00
-  %1188 = fmul fast float %1186, 5.000000e-01
-  %1189 = fmul fast float %1183, %1183
-  %1190 = fsub fast float 1.000000e+00, %1189
-  %1191 = call float @dx.op.unary.f32(i32 23, float %1190)  ; Log(value)
-  %1192 = fmul fast float %1188, %1191
-  %1193 = call float @dx.op.unary.f32(i32 21, float %1192)  ; Exp(value)
-  %1194 = fadd fast float %1185, %1111
-  %1195 = fmul fast float %1185, %1111
-  %1196 = fsub fast float %1194, %1195
-  %1197 = fdiv fast float 2.500000e-01, %1196
-  %1198 = fmul fast float %1187, 0x3FC45F3060000000
-  %1199 = fmul fast float %1198, %1193
-  %1200 = fmul fast float %1199, %1197
-  %1201 = fmul fast float %1200, %1070
-  %1202 = fmul fast float %1200, %1071
-  %1203 = fmul fast float %1200, %1072
-  %1204 = fmul fast float %1055, 0x3FD45F3060000000
-  %1205 = fmul fast float %1056, 0x3FD45F3060000000
-  %1206 = fmul fast float %1057, 0x3FD45F3060000000
-  %1207 = fadd fast float %1201, %1204
-  %1208 = fadd fast float %1202, %1205
-  %1209 = fadd fast float %1203, %1206
-  %1210 = fdiv fast float %1170, %1157
-  %1211 = fmul fast float %1210, %1210
-  %1212 = fmul fast float %1211, %1211
-  %1213 = fsub fast float 1.000000e+00, %1212
-  %1214 = call float @dx.op.unary.f32(i32 7, float %1213)  ; Saturate(value)
-  %1215 = fmul fast float %1214, %1214
-  %1216 = fmul fast float %1170, %1170
-  %1217 = fadd fast float %1216, 1.000000e+00
-  %1218 = fdiv fast float %1215, %1217
-  %1219 = fmul fast float %1185, %1159
-  %1220 = fmul fast float %1219, %1218
-  %1221 = fmul fast float %1220, %1207
-  %1222 = fmul fast float %1185, %1160
-  %1223 = fmul fast float %1222, %1218
-  %1224 = fmul fast float %1223, %1208
-  %1225 = fmul fast float %1185, %1161
-  %1226 = fmul fast float %1225, %1218
-  %1227 = fmul fast float %1226, %1209
-  %1228 = fadd fast float %1221, %1140
-  %1229 = fadd fast float %1224, %1141
-  %1230 = fadd fast float %1227, %1142
-  %1231 = add i32 %1143, 1
-  br label %1139
-
-; <label>:1232                                    ; preds = %1139
-  %1233 = extractvalue %dx.types.ResRet.f32 %1065, 1
-  %1234 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %2, %dx.types.Handle %7, float %1095, float %1097, float %1096, float undef, i32 undef, i32 undef, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %1235 = extractvalue %dx.types.ResRet.f32 %1234, 0
-  %1236 = extractvalue %dx.types.ResRet.f32 %1234, 1
-  %1237 = extractvalue %dx.types.ResRet.f32 %1234, 2
-  %1238 = fmul fast float %1235, %1055
-  %1239 = fmul fast float %1236, %1056
-  %1240 = fmul fast float %1237, %1057
-  %1241 = fmul fast float %1111, 2.000000e+00
-  %1242 = fmul fast float %1241, %1095
-  %1243 = fmul fast float %1241, %1096
-  %1244 = fmul fast float %1241, %1097
-  %1245 = fsub fast float %1242, %1107
-  %1246 = fsub fast float %1243, %1108
-  %1247 = fsub fast float %1244, %1109
-  %1248 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %10, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %1249 = extractvalue %dx.types.CBufRet.i32 %1248, 0
-  %1250 = uitofp i32 %1249 to float
-  %1251 = fmul fast float %1250, %1066
-  %1252 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %1, %dx.types.Handle %7, float %1245, float %1247, float %1246, float undef, i32 undef, i32 undef, i32 undef, float %1251)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %1253 = extractvalue %dx.types.ResRet.f32 %1252, 0
-  %1254 = extractvalue %dx.types.ResRet.f32 %1252, 1
-  %1255 = extractvalue %dx.types.ResRet.f32 %1252, 2
-  %1256 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %3, %dx.types.Handle %6, float %1111, float %1066, float undef, float undef, i32 0, i32 0, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %1257 = extractvalue %dx.types.ResRet.f32 %1256, 2
-  %1258 = fmul fast float %1253, %1070
-  %1259 = fmul fast float %1258, %1257
-  %1260 = fmul fast float %1254, %1071
-  %1261 = fmul fast float %1260, %1257
-  %1262 = fmul fast float %1255, %1072
-  %1263 = fmul fast float %1262, %1257
-  %1264 = fadd fast float %1259, %1238
-  %1265 = fadd fast float %1261, %1239
-  %1266 = fadd fast float %1263, %1240
-  %1267 = fmul fast float %1264, %1233
-  %1268 = fmul fast float %1265, %1233
-  %1269 = fmul fast float %1266, %1233
-  %1270 = fadd fast float %1267, %1140
-  %1271 = fadd fast float %1268, %1141
-  %1272 = fadd fast float %1269, %1142
-  br label %1273
-
-; <label>:1273                                    ; preds = %1232, %1049, %959, %566, %270
-  %1274 = phi float [ %324, %270 ], [ %623, %566 ], [ %1046, %959 ], [ %1270, %1232 ], [ 0.000000e+00, %1049 ]
-  %1275 = phi float [ %325, %270 ], [ %625, %566 ], [ %1047, %959 ], [ %1271, %1232 ], [ 0.000000e+00, %1049 ]
-  %1276 = phi float [ %326, %270 ], [ %627, %566 ], [ %1048, %959 ], [ %1272, %1232 ], [ 0.000000e+00, %1049 ]
-  %1277 = fmul fast float %1274, 0x3FE3333340000000
-  %1278 = fmul fast float %1275, 0x3FE3333340000000
-  %1279 = fmul fast float %1276, 0x3FE3333340000000
-  %1280 = fmul fast float %1274, 0x3FF8189380000000
-  %1281 = fmul fast float %1275, 0x3FF8189380000000
-  %1282 = fmul fast float %1276, 0x3FF8189380000000
-  %1283 = fadd fast float %1280, 0x3F9EB851E0000000
-  %1284 = fadd fast float %1281, 0x3F9EB851E0000000
-  %1285 = fadd fast float %1282, 0x3F9EB851E0000000
-  %1286 = fmul fast float %1283, %1277
-  %1287 = fmul fast float %1284, %1278
-  %1288 = fmul fast float %1285, %1279
-  %1289 = fmul fast float %1274, 0x3FF753F7E0000000
-  %1290 = fmul fast float %1275, 0x3FF753F7E0000000
-  %1291 = fmul fast float %1276, 0x3FF753F7E0000000
-  %1292 = fadd fast float %1289, 0x3FE2E147A0000000
-  %1293 = fadd fast float %1290, 0x3FE2E147A0000000
-  %1294 = fadd fast float %1291, 0x3FE2E147A0000000
-  %1295 = fmul fast float %1292, %1277
-  %1296 = fmul fast float %1293, %1278
-  %1297 = fmul fast float %1294, %1279
-  %1298 = fadd fast float %1295, 0x3FC1EB8520000000
-  %1299 = fadd fast float %1296, 0x3FC1EB8520000000
-  %1300 = fadd fast float %1297, 0x3FC1EB8520000000
-  %1301 = fdiv fast float %1286, %1298
-  %1302 = fdiv fast float %1287, %1299
-  %1303 = fdiv fast float %1288, %1300
-  %1304 = call float @dx.op.unary.f32(i32 7, float %1301)  ; Saturate(value)
-  %1305 = call float @dx.op.unary.f32(i32 7, float %1302)  ; Saturate(value)
-  %1306 = call float @dx.op.unary.f32(i32 7, float %1303)  ; Saturate(value)
-  %1307 = call float @dx.op.unary.f32(i32 23, float %1304)  ; Log(value)
-  %1308 = call float @dx.op.unary.f32(i32 23, float %1305)  ; Log(value)
-  %1309 = call float @dx.op.unary.f32(i32 23, float %1306)  ; Log(value)
-  %1310 = fmul fast float %1307, 0x3FDD168720000000
-  %1311 = fmul fast float %1308, 0x3FDD168720000000
-  %1312 = fmul fast float %1309, 0x3FDD168720000000
-  %1313 = call float @dx.op.unary.f32(i32 21, float %1310)  ; Exp(value)
-  %1314 = call float @dx.op.unary.f32(i32 21, float %1311)  ; Exp(value)
-  %1315 = call float @dx.op.unary.f32(i32 21, float %1312)  ; Exp(value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %1313)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %1314)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %1315)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float 1.000000e+00)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.loadInput.f32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.loadInput.i32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.sample.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32, float) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot3.f32(i32, float, float, float, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32, float) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.binary.f32(i32, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.binary.i32(i32, i32, i32) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32, %dx.types.Handle, i32, i32) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!22}
-!dx.entryPoints = !{!23}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"ps", i32 6, i32 0}
-!4 = !{!5, null, !15, !18}
-!5 = !{!6, !8, !10, !12, !13, !14}
-!6 = !{i32 0, %"class.StructuredBuffer<Light>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 32}
-!8 = !{i32 1, %"class.StructuredBuffer<LightCluster>"* undef, !"", i32 0, i32 1, i32 1, i32 12, i32 0, !9}
-!9 = !{i32 1, i32 256}
-!10 = !{i32 2, %"class.Texture2D<vector<float, 3> >"* undef, !"", i32 0, i32 2, i32 1, i32 2, i32 0, !11}
-!11 = !{i32 0, i32 9}
-!12 = !{i32 3, %"class.TextureCube<vector<float, 3> >"* undef, !"", i32 0, i32 3, i32 1, i32 5, i32 0, !11}
-!13 = !{i32 4, %"class.TextureCube<vector<float, 3> >"* undef, !"", i32 0, i32 4, i32 1, i32 5, i32 0, !11}
-!14 = !{i32 5, [0 x %"class.Texture2D<vector<float, 4> >"]* undef, !"", i32 1, i32 0, i32 -1, i32 2, i32 0, !11}
-!15 = !{!16, !17}
-!16 = !{i32 0, %rootConstants* undef, !"", i32 0, i32 0, i32 1, i32 4, null}
-!17 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!18 = !{!19, !20, !21}
-!19 = !{i32 0, %struct.SamplerState* undef, !"", i32 0, i32 0, i32 1, i32 0, null}
-!20 = !{i32 1, %struct.SamplerState* undef, !"", i32 0, i32 1, i32 1, i32 0, null}
-!21 = !{i32 2, %struct.SamplerState* undef, !"", i32 0, i32 2, i32 1, i32 0, null}
-!22 = !{[37 x i32] [i32 35, i32 4, i32 0, i32 0, i32 0, i32 0, i32 7, i32 7, i32 7, i32 7, i32 7, i32 7, i32 7, i32 0, i32 7, i32 7, i32 7, i32 0, i32 7, i32 7, i32 7, i32 0, i32 7, i32 7, i32 7, i32 0, i32 7, i32 7, i32 0, i32 0, i32 7, i32 7, i32 7, i32 7, i32 0, i32 7, i32 7]}
-!23 = !{void ()* @main, !"main", !24, !4, !51}
-!24 = !{!25, !49, null}
-!25 = !{!26, !28, !30, !33, !35, !37, !39, !40, !42, !44, !46, !48}
-!26 = !{i32 0, !"SV_Position", i8 9, i8 3, !27, i8 4, i32 1, i8 4, i32 0, i8 0, null}
-!27 = !{i32 0}
-!28 = !{i32 1, !"POSITION", i8 9, i8 0, !27, i8 2, i32 1, i8 4, i32 1, i8 0, !29}
-!29 = !{i32 3, i32 15}
-!30 = !{i32 2, !"POSITION", i8 9, i8 0, !31, i8 2, i32 1, i8 3, i32 2, i8 0, !32}
-!31 = !{i32 1}
-!32 = !{i32 3, i32 7}
-!33 = !{i32 3, !"TBN_MATRIX", i8 9, i8 0, !34, i8 2, i32 3, i8 3, i32 3, i8 0, !32}
-!34 = !{i32 0, i32 1, i32 2}
-!35 = !{i32 4, !"TEXCOORD", i8 9, i8 0, !27, i8 2, i32 1, i8 2, i32 6, i8 0, !36}
-!36 = !{i32 3, i32 3}
-!37 = !{i32 5, !"MATERIAL", i8 5, i8 0, !27, i8 1, i32 1, i8 1, i32 7, i8 0, !38}
-!38 = !{i32 3, i32 1}
-!39 = !{i32 6, !"MATERIAL", i8 5, i8 0, !31, i8 1, i32 1, i8 1, i32 7, i8 1, !38}
-!40 = !{i32 7, !"MATERIAL", i8 5, i8 0, !41, i8 1, i32 1, i8 1, i32 7, i8 2, !38}
-!41 = !{i32 2}
-!42 = !{i32 8, !"MATERIAL", i8 5, i8 0, !43, i8 1, i32 1, i8 1, i32 7, i8 3, !38}
-!43 = !{i32 3}
-!44 = !{i32 9, !"MATERIAL", i8 5, i8 0, !45, i8 1, i32 1, i8 1, i32 8, i8 0, null}
-!45 = !{i32 4}
-!46 = !{i32 10, !"MATERIAL", i8 5, i8 0, !47, i8 1, i32 1, i8 1, i32 8, i8 1, !38}
-!47 = !{i32 5}
-!48 = !{i32 11, !"OBJECT_FLAGS", i8 5, i8 0, !27, i8 1, i32 1, i8 1, i32 8, i8 2, !38}
-!49 = !{!50}
-!50 = !{i32 0, !"SV_Target", i8 9, i8 16, !27, i8 0, i32 1, i8 4, i32 0, i8 0, !29}
-!51 = !{i32 0, i64 16}
-
-#endif
-
-const unsigned char RINShaderBytesPBRPS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x81, 0x45, 0xce, 0x53, 0xdc, 0x14, 0x4f, 0xc9,
-  0xfb, 0x01, 0x09, 0x5b, 0x42, 0x9f, 0x00, 0xde, 0x01, 0x00, 0x00, 0x00,
-  0x73, 0x47, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0xcb, 0x02, 0x00, 0x00,
-  0xab, 0x05, 0x00, 0x00, 0xb7, 0x19, 0x00, 0x00, 0xd3, 0x19, 0x00, 0x00,
-  0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31, 0x3d, 0x02, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xe6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xf1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x27, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x56, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00,
-  0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x50, 0x4f, 0x53,
-  0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x54, 0x42, 0x4e, 0x5f, 0x4d, 0x41,
-  0x54, 0x52, 0x49, 0x58, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52,
-  0x44, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d,
-  0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45,
-  0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41,
-  0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d,
-  0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4f, 0x42, 0x4a, 0x45,
-  0x43, 0x54, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x00, 0x4f, 0x53, 0x47,
-  0x31, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x56, 0x5f,
-  0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x00, 0x50, 0x53, 0x56, 0x30, 0xd8,
-  0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c,
-  0x01, 0x00, 0x09, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x6c,
-  0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e,
-  0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x54, 0x42,
-  0x4e, 0x5f, 0x4d, 0x41, 0x54, 0x52, 0x49, 0x58, 0x00, 0x54, 0x45, 0x58,
-  0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49,
-  0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00,
-  0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54,
-  0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49,
-  0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00,
-  0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x44, 0x00, 0x03,
-  0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-  0x02, 0x43, 0x00, 0x03, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x03, 0x03, 0x43, 0x00, 0x03, 0x02, 0x00, 0x00, 0x1e,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x42, 0x00, 0x03,
-  0x02, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x07, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x01, 0x07, 0x51, 0x00, 0x01, 0x01, 0x00, 0x00, 0x39,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x07, 0x61, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01,
-  0x07, 0x71, 0x00, 0x01, 0x01, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x06,
-  0x00, 0x00, 0x00, 0x01, 0x08, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 0x54,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x08, 0x51, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x08, 0x61, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
-  0x54, 0x41, 0x54, 0x04, 0x14, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01,
-  0x05, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0xec, 0x13, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21,
-  0x0c, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41,
-  0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25,
-  0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x1c, 0x45, 0x02, 0x42,
-  0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a,
-  0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00,
-  0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x91, 0x23, 0xc4, 0x50, 0x41,
-  0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x39, 0x46, 0x06, 0x51,
-  0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff,
-  0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00,
-  0x09, 0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
-  0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89,
-  0x20, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x32, 0x22, 0xc8, 0x09, 0x20,
-  0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84, 0x04, 0x93, 0x23, 0xe3, 0x84,
-  0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c, 0x0b, 0x84, 0xe4, 0x4c, 0x10,
-  0xbc, 0xc2, 0x0c, 0xc0, 0x30, 0xc2, 0x00, 0xcc, 0x11, 0x80, 0xc1, 0x31,
-  0xd2, 0x14, 0x51, 0xc2, 0xe4, 0x97, 0x88, 0x71, 0x4c, 0x88, 0x08, 0x00,
-  0x02, 0x82, 0x99, 0xba, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70,
-  0x83, 0x59, 0xa0, 0x07, 0x79, 0xa8, 0x87, 0x71, 0xa0, 0x87, 0x7a, 0x90,
-  0x87, 0x72, 0x20, 0x07, 0x51, 0xa8, 0x07, 0x73, 0x30, 0x87, 0x72, 0x90,
-  0x07, 0x3e, 0x60, 0x85, 0x74, 0x38, 0x07, 0x74, 0xa0, 0x07, 0x3f, 0x40,
-  0xc1, 0x80, 0x08, 0xf9, 0x23, 0xb8, 0x49, 0x9a, 0x22, 0x4a, 0x98, 0xfc,
-  0x12, 0x31, 0x8e, 0x89, 0x5b, 0x28, 0x69, 0x22, 0x22, 0x24, 0x08, 0x0c,
-  0x33, 0x91, 0xc1, 0x38, 0xb0, 0x43, 0x38, 0xcc, 0xc3, 0x3c, 0xb8, 0xc1,
-  0x2c, 0xd0, 0x83, 0x3c, 0xd4, 0xc3, 0x38, 0xd0, 0x43, 0x3d, 0xc8, 0x43,
-  0x39, 0x90, 0x83, 0x28, 0xd4, 0x83, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x03,
-  0x1f, 0xb0, 0x42, 0x3a, 0x9c, 0x03, 0x3a, 0xd0, 0xc3, 0x28, 0xb0, 0x43,
-  0x3d, 0xcc, 0x03, 0x3d, 0x94, 0x83, 0x3c, 0xf8, 0x01, 0x0a, 0x0e, 0x84,
-  0x98, 0xa9, 0x0d, 0xc6, 0x81, 0x1d, 0xc2, 0x61, 0x1e, 0xe6, 0xc1, 0x0d,
-  0x68, 0xa1, 0x1c, 0xf0, 0x81, 0x1e, 0xea, 0x41, 0x1e, 0xca, 0x41, 0x0e,
-  0x48, 0x81, 0x0f, 0xec, 0xa1, 0x1c, 0xc6, 0x81, 0x1e, 0xde, 0x41, 0x1e,
-  0xf8, 0xc0, 0x1c, 0xd8, 0xe1, 0x1d, 0xc2, 0x81, 0x1e, 0xd8, 0x00, 0x0c,
-  0xe6, 0xc0, 0x0f, 0xc0, 0xc0, 0x0f, 0xf4, 0x40, 0x0f, 0xda, 0x21, 0x1d,
-  0xe0, 0x61, 0x1e, 0x7e, 0x81, 0x1e, 0xf2, 0x01, 0x1e, 0xca, 0x01, 0x05,
-  0x82, 0x99, 0xc4, 0x60, 0x1c, 0xd8, 0x21, 0x1c, 0xe6, 0x61, 0x1e, 0xdc,
-  0x80, 0x16, 0xca, 0x01, 0x1f, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xe4,
-  0x80, 0x14, 0xf8, 0xc0, 0x1e, 0xca, 0x61, 0x1c, 0xe8, 0xe1, 0x1d, 0xe4,
-  0x81, 0x0f, 0xcc, 0x81, 0x1d, 0xde, 0x21, 0x1c, 0xe8, 0x81, 0x0d, 0xc0,
-  0x60, 0x0e, 0xfc, 0x00, 0x0c, 0xfc, 0x00, 0x09, 0x01, 0x05, 0x2d, 0x66,
-  0x22, 0x83, 0x71, 0x60, 0x87, 0x70, 0x98, 0x87, 0x79, 0x70, 0x03, 0x5a,
-  0x28, 0x07, 0x7c, 0xa0, 0x87, 0x7a, 0x90, 0x87, 0x72, 0x18, 0x85, 0x7a,
-  0x10, 0x87, 0x72, 0xe0, 0x03, 0x7b, 0x28, 0x87, 0x71, 0xa0, 0x87, 0x77,
-  0x90, 0x07, 0x3e, 0x30, 0x07, 0x76, 0x78, 0x87, 0x70, 0xa0, 0x07, 0x36,
-  0x00, 0x83, 0x39, 0xf0, 0x03, 0x30, 0xf0, 0x03, 0x14, 0x04, 0xa8, 0x31,
-  0x8c, 0x40, 0x00, 0x33, 0xb5, 0xc1, 0x38, 0xb0, 0x43, 0x38, 0xcc, 0xc3,
-  0x3c, 0xb8, 0x01, 0x2d, 0x94, 0x03, 0x3e, 0xd0, 0x43, 0x3d, 0xc8, 0x43,
-  0x39, 0xc8, 0x01, 0x29, 0xf0, 0x81, 0x3d, 0x94, 0xc3, 0x38, 0xd0, 0xc3,
-  0x3b, 0xc8, 0x03, 0x1f, 0x98, 0x03, 0x3b, 0xbc, 0x43, 0x38, 0xd0, 0x03,
-  0x1b, 0x80, 0x01, 0x1d, 0xf8, 0x01, 0x18, 0xf8, 0x81, 0x1e, 0xe8, 0x41,
-  0x3b, 0xa4, 0x03, 0x3c, 0xcc, 0xc3, 0x2f, 0xd0, 0x43, 0x3e, 0xc0, 0x43,
-  0x39, 0xa0, 0x40, 0x30, 0x93, 0x18, 0x8c, 0x03, 0x3b, 0x84, 0xc3, 0x3c,
-  0xcc, 0x83, 0x1b, 0xd0, 0x42, 0x39, 0xe0, 0x03, 0x3d, 0xd4, 0x83, 0x3c,
-  0x94, 0x83, 0x1c, 0x90, 0x02, 0x1f, 0xd8, 0x43, 0x39, 0x8c, 0x03, 0x3d,
-  0xbc, 0x83, 0x3c, 0xf0, 0x81, 0x39, 0xb0, 0xc3, 0x3b, 0x84, 0x03, 0x3d,
-  0xb0, 0x01, 0x18, 0xd0, 0x81, 0x1f, 0x80, 0x81, 0x1f, 0x20, 0xe1, 0x01,
-  0x49, 0x80, 0x08, 0x49, 0x6e, 0x92, 0xa6, 0x88, 0x12, 0x26, 0x9f, 0x05,
-  0x98, 0x67, 0x21, 0x22, 0x76, 0x02, 0x26, 0x02, 0x05, 0x02, 0xa2, 0x1c,
-  0x25, 0x4d, 0x11, 0x25, 0x4c, 0xfe, 0xea, 0x38, 0x13, 0xe7, 0x34, 0xd2,
-  0x04, 0x34, 0x93, 0x84, 0x02, 0xc1, 0x35, 0x91, 0xe3, 0x4c, 0x9c, 0xd3,
-  0x48, 0x13, 0xd0, 0x4c, 0x12, 0x0a, 0x2c, 0x74, 0x49, 0x82, 0xc7, 0x85,
-  0xc1, 0x70, 0xf9, 0xc0, 0x82, 0x18, 0x0d, 0x43, 0x34, 0x93, 0xbf, 0x10,
-  0x06, 0x20, 0x60, 0xbe, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x1c, 0xc0, 0x10,
-  0x11, 0x80, 0x9c, 0x4c, 0x26, 0x93, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0e, 0x0c, 0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68, 0x18,
-  0xa2, 0x99, 0xfc, 0x85, 0x30, 0x00, 0x01, 0xf3, 0x05, 0x80, 0x21, 0x22,
-  0x60, 0xa3, 0x8a, 0x82, 0x88, 0x50, 0xa0, 0xa1, 0xcd, 0x08, 0x40, 0x09,
-  0x3a, 0xe4, 0x99, 0x23, 0x40, 0x8a, 0x01, 0x10, 0x08, 0x04, 0x20, 0x01,
-  0x85, 0x8a, 0x21, 0x10, 0x08, 0x04, 0x20, 0x01, 0x8d, 0x8a, 0xd1, 0x11,
-  0x08, 0x04, 0x20, 0x00, 0x95, 0x6e, 0x1a, 0x2e, 0x7f, 0xc2, 0x1e, 0x42,
-  0xf2, 0x57, 0x42, 0x5a, 0x89, 0xc9, 0x2f, 0x6e, 0x1b, 0x15, 0x00, 0x00,
-  0x00, 0x20, 0x20, 0xd0, 0x3d, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 0x48, 0x7e,
-  0x08, 0x34, 0xc3, 0x42, 0xa0, 0x00, 0x55, 0x98, 0x93, 0x20, 0x95, 0x02,
-  0x00, 0x00, 0x00, 0x81, 0x40, 0x00, 0x20, 0x55, 0x19, 0x00, 0x02, 0x00,
-  0xb1, 0x0a, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xae, 0x42,
-  0x00, 0x04, 0x00, 0x00, 0xc1, 0x0a, 0x21, 0x10, 0x08, 0x04, 0x24, 0x2b,
-  0x05, 0x40, 0x00, 0x00, 0x00, 0x88, 0x76, 0xd4, 0x70, 0xf9, 0x13, 0xf6,
-  0x10, 0x92, 0xcf, 0x6d, 0x54, 0xb1, 0x12, 0x93, 0x8f, 0xdc, 0x36, 0x22,
-  0x04, 0x02, 0x81, 0xa0, 0x10, 0x36, 0x41, 0x4a, 0x40, 0xb7, 0xa3, 0x86,
-  0xcb, 0x9f, 0xb0, 0x87, 0x90, 0x7c, 0x6e, 0xa3, 0x8a, 0x95, 0x98, 0xfc,
-  0xe2, 0xb6, 0x11, 0x01, 0x00, 0x00, 0x00, 0x85, 0xc8, 0x09, 0x52, 0x02,
-  0xd2, 0xcd, 0x11, 0x04, 0xc5, 0x48, 0x09, 0x40, 0x02, 0x01, 0x8f, 0x7a,
-  0x37, 0x0d, 0x97, 0x3f, 0x61, 0x0f, 0x21, 0xf9, 0x2b, 0x21, 0xad, 0xc4,
-  0xe4, 0x23, 0xb7, 0x8d, 0x0a, 0x81, 0x40, 0x20, 0x10, 0x94, 0xe2, 0x27,
-  0x48, 0x09, 0x04, 0x04, 0x2c, 0xc5, 0x49, 0x90, 0x12, 0x08, 0x48, 0x38,
-  0x10, 0x70, 0x96, 0xb0, 0x00, 0x92, 0xe4, 0x33, 0xc0, 0x14, 0x21, 0x97,
-  0x5f, 0x2c, 0x0e, 0x30, 0xf9, 0xb8, 0x8f, 0xa3, 0x20, 0x73, 0x8d, 0x34,
-  0x45, 0x94, 0x30, 0xf9, 0x1c, 0xc0, 0x10, 0x11, 0x80, 0x9c, 0x62, 0xb1,
-  0x58, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x20,
-  0x70, 0x96, 0xb0, 0x00, 0x92, 0xe4, 0x33, 0xc0, 0x14, 0x21, 0x97, 0x5f,
-  0x2c, 0x0e, 0x30, 0xf9, 0xb7, 0x7f, 0xa3, 0xe0, 0x38, 0x8c, 0x20, 0x00,
-  0xf7, 0x48, 0x53, 0x44, 0x09, 0x93, 0x6f, 0x02, 0x13, 0x11, 0x21, 0xc0,
-  0x82, 0x0c, 0x81, 0x40, 0x20, 0x10, 0x08, 0xee, 0x91, 0xa6, 0x88, 0x12,
-  0x26, 0x3f, 0xdd, 0x56, 0xb1, 0x79, 0xa8, 0x09, 0x1d, 0x8f, 0x47, 0x00,
-  0x99, 0x54, 0x0a, 0x8e, 0x11, 0x00, 0x86, 0x88, 0x80, 0x8d, 0x2a, 0x0a,
-  0x22, 0x42, 0x81, 0x31, 0x4b, 0x04, 0x73, 0x04, 0xa0, 0x00, 0x00, 0x13,
-  0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68,
-  0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a,
-  0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71,
-  0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a,
-  0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72,
-  0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d,
-  0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72,
-  0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a, 0x0f, 0xa4, 0x90, 0x21, 0x23, 0x45,
-  0x44, 0x00, 0x92, 0x01, 0x00, 0x13, 0x0d, 0x00, 0x98, 0x6b, 0x00, 0xc0,
-  0x6c, 0x03, 0x00, 0x66, 0x1b, 0x00, 0x30, 0xe5, 0x00, 0x80, 0x49, 0x07,
-  0x00, 0x4c, 0x3a, 0x00, 0x60, 0xd2, 0x01, 0x00, 0xf3, 0x0e, 0x00, 0x80,
-  0x5b, 0x00, 0x00, 0x43, 0x1e, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x61, 0x00, 0x04, 0x40, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x9e, 0x31, 0x00, 0x02, 0x20,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f, 0x19, 0x00,
-  0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x47,
-  0x0d, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-  0xc8, 0xc3, 0x06, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x30, 0xe4, 0x71, 0x03, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x18, 0xf2, 0xa8, 0x01, 0x10, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0xe0, 0x00, 0x08, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x72, 0x00, 0x04,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x3a,
-  0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21,
-  0xcf, 0x1d, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xc0, 0x90, 0x47, 0x0f, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0xc8, 0xd3, 0x07, 0x40, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x01, 0x05, 0x20, 0x00, 0x06, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x88, 0x02, 0x10, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x81, 0x00, 0x3e,
-  0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x1c, 0x19, 0x11, 0x4c, 0x90, 0x8c,
-  0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x72, 0x16, 0x08, 0x09, 0x4a, 0x60,
-  0x04, 0xa0, 0x18, 0x0a, 0xa3, 0x80, 0x0a, 0x90, 0xa0, 0x08, 0x4a, 0xa2,
-  0x0c, 0x4a, 0xa1, 0x10, 0x6a, 0xa0, 0xc0, 0x09, 0xca, 0xa1, 0x00, 0x03,
-  0x0a, 0x50, 0xa0, 0x00, 0x07, 0x0a, 0x93, 0xa0, 0x40, 0x09, 0x0a, 0x95,
-  0xa0, 0x60, 0x09, 0x0a, 0x97, 0xa0, 0x80, 0x09, 0x0a, 0x99, 0xa0, 0xa0,
-  0x09, 0x0a, 0x9b, 0xa0, 0x40, 0x0a, 0xa7, 0xd0, 0x1f, 0x0a, 0xa5, 0x30,
-  0x05, 0x0a, 0xac, 0x80, 0x03, 0x0a, 0x3c, 0xa0, 0x20, 0x05, 0x0a, 0xa6,
-  0x20, 0xca, 0xa3, 0x28, 0xca, 0xa2, 0x58, 0x1d, 0x0a, 0x9a, 0xa2, 0xa8,
-  0x4a, 0x84, 0x40, 0x05, 0x52, 0x02, 0xa5, 0x50, 0x04, 0x23, 0x00, 0x85,
-  0x50, 0x06, 0x25, 0x41, 0x8c, 0x19, 0x00, 0x6a, 0xcc, 0x00, 0x90, 0x63,
-  0x06, 0x80, 0x1e, 0x33, 0x00, 0x04, 0x99, 0x01, 0xa0, 0xc8, 0x0c, 0x00,
-  0x4d, 0x66, 0x00, 0xa8, 0x32, 0x03, 0x40, 0x96, 0x19, 0x00, 0xba, 0xcc,
-  0x00, 0x10, 0x66, 0x06, 0x80, 0x34, 0x33, 0x00, 0xb4, 0x99, 0x01, 0x20,
-  0xce, 0x0c, 0x00, 0x2d, 0x66, 0x00, 0x48, 0x31, 0x03, 0x40, 0x89, 0x19,
-  0x00, 0x42, 0xcc, 0x00, 0xd0, 0x61, 0x06, 0x80, 0x0a, 0x33, 0x00, 0x44,
-  0x98, 0x01, 0xa0, 0xc1, 0x0c, 0x00, 0x19, 0x67, 0x00, 0x48, 0x39, 0x03,
-  0x40, 0xcb, 0x19, 0x00, 0x62, 0xce, 0x00, 0x50, 0x73, 0xac, 0x32, 0x18,
-  0x03, 0x02, 0x00, 0x00, 0xe0, 0x38, 0x8e, 0xe3, 0x38, 0x0e, 0xe0, 0x38,
-  0x0e, 0xe0, 0x38, 0x0e, 0xe0, 0x38, 0x0e, 0xe0, 0x38, 0x00, 0xe0, 0x38,
-  0x8e, 0x03, 0x38, 0x0e, 0x0a, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-  0x18, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46,
-  0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b,
-  0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1,
-  0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa,
-  0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10,
-  0x04, 0x13, 0x04, 0x81, 0x9b, 0x20, 0x08, 0xdd, 0x06, 0x61, 0x20, 0x36,
-  0x08, 0x04, 0x41, 0x01, 0x6e, 0x6e, 0x82, 0x20, 0x78, 0x1b, 0x86, 0x03,
-  0x21, 0x26, 0x08, 0xc5, 0x38, 0x70, 0x61, 0x4b, 0x3b, 0x43, 0xa3, 0x13,
-  0xaa, 0x33, 0x33, 0x2b, 0x93, 0x9b, 0x20, 0x08, 0xdf, 0x04, 0x41, 0x00,
-  0x83, 0x0d, 0xc2, 0xd0, 0x6c, 0x48, 0x08, 0x65, 0x21, 0x88, 0x81, 0x21,
-  0x9c, 0x09, 0x42, 0x02, 0x0e, 0x94, 0xd8, 0xd2, 0xce, 0xd0, 0xe8, 0x86,
-  0xd8, 0xea, 0xe6, 0xe8, 0xca, 0xe4, 0x84, 0xea, 0xcc, 0xcc, 0xca, 0xe4,
-  0x26, 0x08, 0x42, 0x18, 0x6c, 0x10, 0x06, 0x69, 0x43, 0x32, 0x40, 0x11,
-  0x31, 0x0c, 0x0c, 0x31, 0x4d, 0x10, 0x04, 0x31, 0x98, 0x20, 0x30, 0xb0,
-  0x40, 0x83, 0xcc, 0xec, 0x8c, 0xa9, 0x8a, 0x6a, 0x82, 0x20, 0x8c, 0xc1,
-  0x06, 0x81, 0xc0, 0x36, 0x24, 0x95, 0x75, 0x11, 0xd5, 0x50, 0x11, 0xd9,
-  0x04, 0x41, 0x20, 0x83, 0x09, 0x82, 0x23, 0x0b, 0x74, 0xd2, 0xc4, 0xd8,
-  0x88, 0xd2, 0xcc, 0xcc, 0xa8, 0xca, 0xf0, 0xe8, 0xea, 0xe4, 0xca, 0x26,
-  0x08, 0x42, 0x19, 0x6c, 0x48, 0x36, 0xae, 0x23, 0xb6, 0xc1, 0x23, 0xb2,
-  0x09, 0x82, 0x60, 0x06, 0x74, 0xd2, 0xc4, 0xd8, 0xa6, 0xe0, 0xca, 0xc6,
-  0xa8, 0xca, 0xf0, 0xe8, 0xea, 0xe4, 0xca, 0x36, 0x24, 0x60, 0xc0, 0x85,
-  0x01, 0x01, 0x06, 0x83, 0x47, 0x64, 0x13, 0x84, 0xc9, 0x16, 0x88, 0xd0,
-  0x95, 0xe1, 0xd1, 0xd5, 0xc9, 0x95, 0xcd, 0x4d, 0x10, 0x84, 0x33, 0xd8,
-  0x90, 0x78, 0x63, 0x40, 0x06, 0x03, 0x51, 0x06, 0x15, 0x91, 0x6d, 0x30,
-  0x1e, 0x4a, 0xfb, 0xc4, 0xc0, 0x0c, 0x26, 0x08, 0x98, 0x2e, 0xb0, 0x91,
-  0x7b, 0x7b, 0xa3, 0x1b, 0x7a, 0x73, 0x9b, 0xa3, 0x0b, 0x73, 0xa3, 0x9b,
-  0xdb, 0x80, 0x10, 0x68, 0x90, 0x06, 0x04, 0x31, 0x80, 0x01, 0x30, 0x41,
-  0xe0, 0x7a, 0x81, 0xcc, 0x58, 0x58, 0x5b, 0x99, 0x5c, 0x98, 0x50, 0x9d,
-  0x99, 0x59, 0x99, 0xdc, 0x04, 0x41, 0x40, 0x83, 0x0d, 0xc8, 0xb0, 0x06,
-  0x6c, 0x40, 0x0c, 0x43, 0x1b, 0x00, 0x1b, 0x04, 0x35, 0x70, 0x83, 0x09,
-  0x42, 0x75, 0x0b, 0x74, 0xe8, 0xca, 0xf0, 0xe8, 0xea, 0xe4, 0xca, 0xa6,
-  0xc2, 0xda, 0xe0, 0xd8, 0xca, 0xe4, 0x36, 0x20, 0x04, 0x1c, 0xc4, 0x01,
-  0x41, 0x0c, 0x04, 0xc0, 0x65, 0xac, 0x4e, 0xac, 0x6c, 0x2a, 0xac, 0x0d,
-  0x8e, 0xad, 0x4c, 0x6e, 0x03, 0x32, 0xc0, 0xc1, 0x1c, 0x10, 0xc3, 0x40,
-  0x00, 0x6c, 0xc8, 0xcc, 0xce, 0x98, 0xaa, 0xa8, 0xa6, 0xc2, 0xda, 0xe0,
-  0xd8, 0xca, 0xe4, 0x36, 0x20, 0x15, 0x1c, 0xd4, 0x01, 0x51, 0x0d, 0x04,
-  0xb0, 0x61, 0x90, 0x03, 0x3a, 0xb0, 0x83, 0x0d, 0xc4, 0x19, 0x00, 0x6f,
-  0x70, 0x07, 0x13, 0x04, 0x0b, 0x17, 0x38, 0xa5, 0x89, 0xb1, 0x4d, 0xc1,
-  0x95, 0x8d, 0xd5, 0xb1, 0x85, 0xc9, 0x35, 0x25, 0x41, 0x0d, 0xbd, 0xd5,
-  0xb9, 0xd1, 0x4d, 0x10, 0x84, 0x34, 0xd8, 0x60, 0x20, 0x7a, 0xb0, 0x11,
-  0x7b, 0xe0, 0x6d, 0x10, 0xc0, 0x80, 0x0f, 0x26, 0x08, 0xa6, 0x60, 0x0e,
-  0x54, 0xec, 0xd2, 0xca, 0xee, 0x9a, 0xc2, 0xe8, 0xe4, 0xd2, 0xf0, 0x36,
-  0x0c, 0x60, 0x00, 0x06, 0xd5, 0x06, 0x04, 0xf9, 0x83, 0x0a, 0x14, 0x36,
-  0x62, 0x0f, 0x30, 0x2a, 0x70, 0x72, 0x6f, 0x6a, 0x4d, 0x61, 0x74, 0x72,
-  0x69, 0x78, 0x13, 0x04, 0x41, 0x0d, 0x36, 0x20, 0x88, 0x28, 0x54, 0xa0,
-  0xb0, 0x8d, 0xc2, 0x1e, 0x60, 0x6c, 0xd2, 0xdc, 0xec, 0xa0, 0xe4, 0xde,
-  0xd4, 0x9a, 0xc2, 0xe8, 0xe4, 0xd2, 0xf0, 0x26, 0x08, 0xc2, 0x1a, 0x6c,
-  0x40, 0x90, 0x52, 0xa8, 0x40, 0x61, 0x33, 0x85, 0x3d, 0xc0, 0xe8, 0xd8,
-  0xa5, 0x95, 0xdd, 0x41, 0xc9, 0xbd, 0xa9, 0x35, 0x85, 0xd1, 0xc9, 0xa5,
-  0xe1, 0x4d, 0x10, 0x04, 0x36, 0xd8, 0x80, 0x20, 0xa8, 0x50, 0x81, 0xc2,
-  0x96, 0x0a, 0x7b, 0x80, 0x11, 0x81, 0x7b, 0x9b, 0x4b, 0xa3, 0x4b, 0x7b,
-  0x73, 0xdb, 0x60, 0x20, 0xab, 0xb0, 0x49, 0x7b, 0x80, 0x11, 0x81, 0x0b,
-  0x23, 0x23, 0x4b, 0x73, 0x3b, 0x83, 0x99, 0x20, 0x08, 0x6d, 0xb0, 0xc1,
-  0x40, 0x5a, 0x61, 0x73, 0x85, 0x3d, 0xc0, 0x98, 0x98, 0xc9, 0xd5, 0xcd,
-  0xd1, 0xd5, 0xb5, 0x61, 0x61, 0x4d, 0x10, 0x04, 0x37, 0xd8, 0x60, 0x20,
-  0xb0, 0xb0, 0xc5, 0xc2, 0x1e, 0x60, 0x4c, 0xcc, 0xe4, 0xea, 0xe6, 0xe8,
-  0xea, 0xda, 0xb0, 0xb4, 0x26, 0x08, 0xc2, 0x1b, 0x6c, 0x30, 0x90, 0x59,
-  0xd8, 0x68, 0x61, 0x0f, 0x30, 0x26, 0x66, 0x72, 0x75, 0x73, 0x74, 0x75,
-  0x6d, 0x59, 0x59, 0x13, 0x04, 0x01, 0x0e, 0x36, 0x18, 0x88, 0x2d, 0x6c,
-  0xb7, 0xb0, 0x07, 0x18, 0x13, 0x33, 0xb9, 0xba, 0x39, 0xba, 0xba, 0xb6,
-  0x2c, 0xad, 0x09, 0x82, 0x10, 0x07, 0x1b, 0x0c, 0x24, 0x17, 0x36, 0x5d,
-  0xd8, 0x03, 0x8c, 0x85, 0x5b, 0x59, 0x98, 0x9c, 0xd6, 0x04, 0x41, 0x90,
-  0x83, 0x0d, 0x06, 0xc2, 0x0b, 0x5b, 0x2f, 0xec, 0x01, 0x46, 0xc2, 0x2c,
-  0x4c, 0x4e, 0x6b, 0x82, 0x20, 0xcc, 0xc1, 0x06, 0x03, 0xf9, 0x85, 0x0d,
-  0x1c, 0xf6, 0x00, 0x23, 0x34, 0xc6, 0x56, 0x37, 0x47, 0x57, 0x26, 0x37,
-  0xf4, 0xe6, 0x36, 0x47, 0x17, 0xe6, 0x46, 0x17, 0x34, 0x41, 0x10, 0xe8,
-  0x60, 0x83, 0x81, 0x88, 0xc3, 0x36, 0x0e, 0x7b, 0x80, 0x11, 0x1a, 0x63,
-  0xab, 0x9b, 0xa3, 0x2b, 0x93, 0x1b, 0x7a, 0x73, 0x9b, 0xa3, 0x0b, 0x73,
-  0xa3, 0x13, 0x9a, 0x20, 0x08, 0x75, 0xb0, 0xc1, 0x40, 0xca, 0x61, 0x33,
-  0x87, 0x3d, 0xc0, 0x36, 0x3c, 0x6d, 0x10, 0x0a, 0xa4, 0x70, 0x0a, 0xaa,
-  0xc0, 0x0a, 0xaf, 0x20, 0x0b, 0xb5, 0x80, 0x0b, 0xbb, 0xe0, 0x0b, 0xe1,
-  0x40, 0x0e, 0xe7, 0x30, 0x41, 0x20, 0xc8, 0x81, 0x01, 0xda, 0x06, 0x02,
-  0x51, 0x87, 0x8d, 0x98, 0x20, 0x0c, 0xe5, 0xb0, 0x41, 0x20, 0xd8, 0x61,
-  0x43, 0xd0, 0x0e, 0x1b, 0x04, 0xc2, 0x1d, 0x36, 0x0c, 0xcd, 0x3a, 0xbc,
-  0xc3, 0x06, 0x03, 0x59, 0x85, 0x8d, 0xd8, 0x03, 0x8c, 0x86, 0x5c, 0x18,
-  0x59, 0x5a, 0xdd, 0xdc, 0x06, 0x03, 0x91, 0x87, 0x8d, 0xd9, 0x03, 0x8c,
-  0xc5, 0xd8, 0x1b, 0xdb, 0x9b, 0xdc, 0x04, 0x41, 0xb0, 0x83, 0x0d, 0x06,
-  0x42, 0x0f, 0x5b, 0x3d, 0xec, 0x01, 0xc6, 0xc2, 0x8c, 0x2d, 0xec, 0x6c,
-  0x6e, 0x82, 0x20, 0xdc, 0xc1, 0x06, 0x03, 0xb9, 0x87, 0x0d, 0x1f, 0xf6,
-  0xc0, 0xdb, 0x50, 0x34, 0xf1, 0x30, 0x0f, 0xf6, 0x90, 0x0f, 0x13, 0x04,
-  0x24, 0x1c, 0x26, 0x08, 0x02, 0x1e, 0x4c, 0x10, 0x0e, 0x71, 0xd8, 0x20,
-  0x10, 0xfd, 0xb0, 0x21, 0xf0, 0x87, 0x0d, 0x02, 0xf1, 0x0f, 0x1b, 0x06,
-  0x7e, 0x58, 0x07, 0x90, 0xa0, 0xc2, 0x96, 0x76, 0x86, 0x46, 0x37, 0xf4,
-  0x56, 0xe7, 0x46, 0xb7, 0xc1, 0x40, 0x44, 0x62, 0x23, 0xf6, 0xc0, 0xa3,
-  0xc1, 0x96, 0x76, 0x86, 0x46, 0x37, 0xb7, 0xc1, 0x40, 0x48, 0x62, 0xab,
-  0x87, 0x3d, 0xf0, 0x36, 0x0c, 0xfc, 0x30, 0x12, 0x25, 0x31, 0x41, 0x58,
-  0x7c, 0x61, 0x82, 0x20, 0xe4, 0xc1, 0x06, 0x03, 0x51, 0x87, 0x8d, 0xd8,
-  0x03, 0x8c, 0x44, 0x5b, 0x1a, 0xdc, 0xdc, 0x06, 0x02, 0x51, 0x89, 0xad,
-  0x1e, 0x26, 0x08, 0xc1, 0x3a, 0x6c, 0x10, 0x08, 0x96, 0xd8, 0x10, 0xb4,
-  0xc4, 0x06, 0x81, 0x70, 0x89, 0x0d, 0x04, 0x4a, 0xa4, 0xc4, 0x4a, 0xbc,
-  0xc4, 0x04, 0x41, 0xf9, 0x05, 0x1a, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65,
-  0x1b, 0x0c, 0x44, 0x26, 0x36, 0x62, 0x0f, 0xbc, 0x0d, 0x02, 0x18, 0xcc,
-  0xc4, 0x04, 0xa1, 0x89, 0x85, 0x0d, 0x03, 0x93, 0x12, 0x2f, 0x31, 0x41,
-  0x88, 0x6a, 0x61, 0x82, 0xf0, 0xcc, 0xc2, 0x06, 0x81, 0xc0, 0x89, 0x0d,
-  0x41, 0x4e, 0x6c, 0x10, 0x08, 0x9d, 0xd8, 0x40, 0xa0, 0x44, 0x4a, 0xac,
-  0xc4, 0x4e, 0x4c, 0x10, 0x20, 0x5a, 0x98, 0x20, 0xac, 0x02, 0x3a, 0x4c,
-  0x10, 0x04, 0x3d, 0xe0, 0x32, 0x65, 0xf5, 0x05, 0xf5, 0x34, 0x95, 0x44,
-  0x95, 0xf4, 0xe4, 0xb4, 0x01, 0x41, 0x56, 0x61, 0x23, 0xc0, 0x00, 0x2c,
-  0xf6, 0x00, 0xe3, 0x31, 0xc6, 0x96, 0x06, 0x07, 0xf5, 0x36, 0xc7, 0x04,
-  0xea, 0x69, 0x2a, 0x89, 0x2a, 0xe9, 0xc9, 0x09, 0x66, 0x03, 0x82, 0x88,
-  0xc5, 0x56, 0x0f, 0x60, 0x30, 0x16, 0x7b, 0x80, 0x11, 0xb9, 0x7b, 0x93,
-  0x63, 0x23, 0x83, 0x7a, 0x9b, 0x63, 0x02, 0xf5, 0x34, 0x95, 0x44, 0x95,
-  0xf4, 0xe4, 0x14, 0xb3, 0x01, 0x41, 0xca, 0x62, 0x6b, 0xc0, 0xc0, 0x2c,
-  0xf6, 0x00, 0xe3, 0x40, 0x27, 0xe6, 0xb6, 0x61, 0xd8, 0xb6, 0x6a, 0x82,
-  0x20, 0xec, 0x01, 0x15, 0x2a, 0x21, 0xa7, 0xaf, 0xa6, 0x20, 0x2a, 0xa9,
-  0x24, 0xac, 0x0d, 0x0a, 0x82, 0x16, 0x55, 0x5a, 0x6c, 0x6a, 0x01, 0x06,
-  0x6b, 0xb1, 0x07, 0x18, 0x07, 0xba, 0x32, 0xbc, 0x09, 0x82, 0xc0, 0x07,
-  0x44, 0xa8, 0x8a, 0xb0, 0x86, 0x9e, 0x9e, 0xa4, 0x88, 0x36, 0x20, 0x48,
-  0x5b, 0x6c, 0x6e, 0x01, 0x06, 0x6f, 0xb1, 0x07, 0x18, 0x91, 0xb6, 0x30,
-  0xba, 0x32, 0xb9, 0xb4, 0x30, 0xb6, 0x09, 0x82, 0xd0, 0x07, 0x44, 0x9a,
-  0x82, 0xa8, 0x8a, 0xa4, 0x92, 0x82, 0x98, 0x36, 0x18, 0x48, 0x5c, 0x6c,
-  0x72, 0x01, 0x06, 0x73, 0x31, 0x41, 0x10, 0xfc, 0x80, 0xcc, 0x93, 0x90,
-  0x52, 0xd1, 0x10, 0xd5, 0x97, 0x11, 0x53, 0xd0, 0xd1, 0xd4, 0x06, 0x04,
-  0xb9, 0x87, 0xad, 0x2e, 0xc0, 0xc0, 0x2e, 0xf6, 0xc0, 0xdb, 0x80, 0xfc,
-  0x44, 0x58, 0x90, 0xc5, 0x59, 0xb0, 0x05, 0x5c, 0xd0, 0xc5, 0x5d, 0x4c,
-  0x10, 0x54, 0xe1, 0x1c, 0x26, 0x08, 0xc2, 0x1f, 0x70, 0x11, 0x0b, 0x9b,
-  0x2b, 0x1b, 0x7a, 0x63, 0x7b, 0x93, 0x4b, 0x22, 0xda, 0x60, 0x20, 0x7b,
-  0xb1, 0x11, 0x7b, 0xe0, 0x11, 0x71, 0x7b, 0x93, 0x6b, 0x0b, 0x63, 0x4b,
-  0x22, 0xda, 0x60, 0x20, 0x7d, 0xb1, 0x81, 0xc1, 0x1e, 0x78, 0x6c, 0xe4,
-  0xde, 0xea, 0xce, 0xd0, 0xdc, 0xca, 0xe6, 0xe6, 0x82, 0x9e, 0x92, 0x88,
-  0x26, 0x08, 0x02, 0x28, 0x6c, 0x30, 0x90, 0xbf, 0xd8, 0x40, 0x63, 0x0f,
-  0x3c, 0x2a, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x49, 0x44,
-  0x1b, 0x0c, 0x44, 0x34, 0x36, 0x66, 0x0f, 0x3c, 0x22, 0x68, 0x65, 0x69,
-  0x67, 0x68, 0x74, 0x49, 0x44, 0x1b, 0x0c, 0x84, 0x34, 0xb6, 0x7a, 0xd8,
-  0x03, 0x8f, 0xc9, 0x1c, 0x5c, 0xd9, 0x58, 0x5a, 0x18, 0x5b, 0x12, 0xd1,
-  0x06, 0x03, 0x31, 0x8d, 0x0d, 0x25, 0xf6, 0xc0, 0xdb, 0x70, 0xe8, 0x05,
-  0x5f, 0xf8, 0x45, 0x68, 0x8c, 0x46, 0x69, 0x9c, 0xc6, 0x04, 0xe1, 0xca,
-  0x85, 0x0d, 0x04, 0x92, 0x06, 0x1b, 0xb1, 0x41, 0x00, 0x03, 0xd5, 0x98,
-  0x20, 0xb0, 0x42, 0x3a, 0x6c, 0x20, 0x10, 0x36, 0xd8, 0x88, 0x0d, 0x42,
-  0x1b, 0xb4, 0xc6, 0x04, 0x41, 0xdb, 0x85, 0x09, 0xc2, 0xc6, 0x0b, 0x1b,
-  0xc6, 0x80, 0xc8, 0x83, 0x3e, 0xf0, 0x03, 0x74, 0x48, 0x07, 0x78, 0x60,
-  0x07, 0x7d, 0xd8, 0x87, 0x90, 0xe8, 0x07, 0x93, 0x38, 0x09, 0x98, 0x88,
-  0x09, 0x9a, 0xa8, 0x09, 0x9b, 0xb8, 0x09, 0x9e, 0xe8, 0x09, 0x9a, 0xf0,
-  0x09, 0xbc, 0xc8, 0x0b, 0xd4, 0x48, 0x8d, 0xd5, 0x60, 0x0d, 0xd7, 0x78,
-  0x0d, 0x74, 0x80, 0x0d, 0xd7, 0x98, 0x20, 0x7c, 0xcb, 0x06, 0x60, 0xc3,
-  0x40, 0xcc, 0xc6, 0x6c, 0x6c, 0x08, 0x68, 0x63, 0xc3, 0x30, 0xc8, 0x46,
-  0x6d, 0x4c, 0x10, 0x5a, 0x41, 0x1d, 0x36, 0x04, 0xb7, 0x41, 0xa2, 0x2d,
-  0x2c, 0xcd, 0x8d, 0xcb, 0x94, 0xd5, 0x17, 0xd4, 0xdb, 0x5c, 0x1a, 0x5d,
-  0xda, 0x9b, 0xdb, 0x04, 0x01, 0x0c, 0x5e, 0x61, 0x82, 0x00, 0x06, 0xae,
-  0xb0, 0x21, 0x20, 0x26, 0x08, 0x60, 0xd0, 0x0a, 0x13, 0x04, 0x30, 0x60,
-  0x85, 0x0d, 0x0b, 0xa1, 0x1b, 0xbb, 0xc1, 0x1b, 0xbd, 0xe1, 0x1b, 0x83,
-  0x6f, 0x10, 0xbf, 0x01, 0x10, 0x81, 0x7a, 0x9a, 0x4a, 0xa2, 0x4a, 0x7a,
-  0x72, 0x9a, 0x20, 0x80, 0xc1, 0x2a, 0x4c, 0x10, 0x84, 0x50, 0xd8, 0x20,
-  0x6c, 0xe3, 0xb1, 0x61, 0x19, 0xc2, 0x63, 0x37, 0x7e, 0xa3, 0x37, 0xc4,
-  0x63, 0xf0, 0x8d, 0xe1, 0x37, 0xc8, 0x63, 0x43, 0x30, 0x6c, 0x10, 0xb6,
-  0x3d, 0xd8, 0xb0, 0x54, 0xe1, 0xb1, 0x1b, 0xbf, 0x61, 0x1e, 0xe2, 0x31,
-  0xf0, 0x46, 0xf5, 0x1b, 0xe7, 0xb1, 0x61, 0x20, 0x86, 0x6a, 0xc3, 0xb2,
-  0xad, 0xc5, 0x6e, 0xfc, 0x46, 0x7a, 0x88, 0xc7, 0xc6, 0x1b, 0xdb, 0x6f,
-  0x9c, 0xc7, 0x06, 0x61, 0xdb, 0x36, 0x2c, 0x60, 0xf0, 0x16, 0xbb, 0xf1,
-  0x1b, 0xbd, 0x21, 0x1e, 0x83, 0x78, 0x20, 0xbf, 0xb1, 0x1e, 0x13, 0x04,
-  0x30, 0x50, 0x85, 0x09, 0x02, 0x18, 0xa4, 0xc2, 0x06, 0x61, 0x1b, 0x36,
-  0x2c, 0xde, 0x5c, 0xb4, 0xc7, 0x6f, 0xf4, 0x86, 0x7b, 0x0c, 0xee, 0xb1,
-  0x07, 0xbf, 0xf1, 0x1e, 0x1b, 0x16, 0x64, 0x2e, 0xda, 0xe3, 0x37, 0xcc,
-  0xc3, 0x3d, 0x06, 0xf7, 0xd8, 0x03, 0xf7, 0x78, 0x8f, 0x0d, 0x41, 0xb5,
-  0x61, 0xd9, 0x83, 0xb9, 0x68, 0x8f, 0xdf, 0x90, 0x0f, 0xf7, 0x18, 0xdc,
-  0x63, 0x0f, 0xc4, 0xe3, 0x3d, 0x36, 0x04, 0xdb, 0x86, 0x05, 0x34, 0xe6,
-  0xa2, 0x3d, 0x7e, 0x83, 0x3e, 0xdc, 0x63, 0x70, 0x8f, 0x3d, 0xe0, 0x8d,
-  0xf7, 0xd8, 0x10, 0x80, 0xc1, 0x86, 0x05, 0x9b, 0x8b, 0xf6, 0xf8, 0x0d,
-  0xfb, 0x70, 0x8f, 0xc1, 0x3d, 0x40, 0xe3, 0x37, 0x80, 0x09, 0x82, 0x20,
-  0x0a, 0x1b, 0x02, 0x6f, 0xc3, 0x82, 0x1f, 0x73, 0xd1, 0x1e, 0xbf, 0x91,
-  0x1f, 0xee, 0x31, 0xb8, 0x07, 0x68, 0xb8, 0xc7, 0x7b, 0x4c, 0x10, 0x84,
-  0x51, 0xd8, 0xb0, 0xec, 0x87, 0x5d, 0xb4, 0xc7, 0x6f, 0xf4, 0x86, 0x7b,
-  0x0c, 0xee, 0x01, 0x1a, 0xe2, 0xf1, 0x1e, 0x1b, 0x18, 0xf0, 0x28, 0x0f,
-  0xf4, 0x50, 0x0f, 0xf6, 0x80, 0x8f, 0xf8, 0x98, 0x8f, 0xfa, 0xb8, 0x0f,
-  0xfd, 0xe0, 0x0f, 0x26, 0x53, 0x56, 0x5f, 0x54, 0x61, 0x72, 0x67, 0x65,
-  0x74, 0x13, 0x04, 0x30, 0x40, 0x85, 0x0d, 0x0b, 0xe1, 0x1f, 0xbb, 0xf1,
-  0x1f, 0xbd, 0xf1, 0x1b, 0x83, 0x6f, 0x10, 0xbf, 0x41, 0x1e, 0x1b, 0x02,
-  0x10, 0xd9, 0x30, 0xf4, 0x47, 0x88, 0x00, 0x13, 0x04, 0x57, 0xd8, 0x36,
-  0x08, 0xc4, 0x88, 0x6c, 0x28, 0x64, 0x23, 0x37, 0x44, 0x04, 0x0f, 0x48,
-  0x84, 0x88, 0x98, 0x5c, 0x98, 0xdb, 0x18, 0x5a, 0xd9, 0x1c, 0x0d, 0x33,
-  0xb6, 0xb7, 0x30, 0xba, 0xb9, 0x09, 0x82, 0x40, 0x0a, 0x2c, 0xd2, 0xdc,
-  0xe6, 0xe8, 0xe6, 0x26, 0x08, 0x42, 0x29, 0x90, 0x48, 0x73, 0xa3, 0x9b,
-  0x9b, 0x20, 0x08, 0xa6, 0x40, 0x63, 0x2e, 0xed, 0xec, 0x8b, 0x8d, 0x8c,
-  0xc6, 0x5c, 0xda, 0xd9, 0xd7, 0x1c, 0x1d, 0x11, 0xba, 0x32, 0xbc, 0x2f,
-  0xb6, 0xb7, 0x30, 0x32, 0x22, 0x74, 0x65, 0x78, 0x5f, 0x6e, 0x6f, 0x72,
-  0x6d, 0x2c, 0xea, 0xd2, 0xdc, 0xe8, 0xe6, 0x26, 0x08, 0xc2, 0x29, 0x6c,
-  0x90, 0x4c, 0x04, 0x34, 0x4e, 0x04, 0x45, 0x52, 0x44, 0x45, 0x56, 0x84,
-  0x45, 0x5a, 0x44, 0x2f, 0x5c, 0x04, 0x0c, 0x5e, 0x04, 0x25, 0x60, 0xa4,
-  0x89, 0x11, 0x19, 0xa9, 0xc2, 0xc6, 0x66, 0xd7, 0xe6, 0x92, 0x46, 0x56,
-  0xe6, 0x46, 0x37, 0x25, 0x08, 0xaa, 0x90, 0xe1, 0xb9, 0xd8, 0x95, 0xc9,
-  0xcd, 0xa5, 0xbd, 0xb9, 0x4d, 0x09, 0x88, 0x26, 0x64, 0x78, 0x2e, 0x76,
-  0x61, 0x6c, 0x76, 0x65, 0x72, 0x53, 0x82, 0xa2, 0x0e, 0x19, 0x9e, 0xcb,
-  0x1c, 0x5a, 0x18, 0x59, 0x99, 0x5c, 0xd3, 0x1b, 0x59, 0x19, 0xdb, 0x94,
-  0x00, 0x29, 0x43, 0x86, 0xe7, 0x22, 0x57, 0x36, 0xf7, 0x56, 0x27, 0x37,
-  0x56, 0x36, 0x37, 0x25, 0xb8, 0x83, 0x4a, 0x64, 0x78, 0x2e, 0x74, 0x79,
-  0x70, 0x65, 0x41, 0x6e, 0x6e, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x53, 0x04, 0xd8, 0xa8, 0x8d, 0x3a, 0x64, 0x78, 0x2e, 0x76, 0x69,
-  0x65, 0x77, 0x49, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x53, 0x82, 0xdb,
-  0xa8, 0x43, 0x86, 0xe7, 0x52, 0xe6, 0x46, 0x27, 0x97, 0x07, 0xf5, 0x96,
-  0xe6, 0x46, 0x37, 0x37, 0x25, 0x20, 0x91, 0x2e, 0x64, 0x78, 0x2e, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x53, 0x02, 0x19, 0x01, 0x79,
-  0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4,
-  0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c,
-  0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00,
-  0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2,
-  0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38,
-  0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d,
-  0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87,
-  0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87,
-  0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30,
-  0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde,
-  0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b,
-  0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c,
-  0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07,
-  0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87,
-  0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87,
-  0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87,
-  0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0,
-  0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc,
-  0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4,
-  0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39,
-  0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38,
-  0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b,
-  0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03,
-  0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0,
-  0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0,
-  0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71,
-  0x20, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x75, 0x00, 0x06, 0x81, 0xdf,
-  0xb8, 0x2e, 0x2e, 0x4f, 0xc3, 0x6d, 0x38, 0xbb, 0x2c, 0x07, 0x02, 0x67,
-  0xd5, 0x69, 0xb8, 0x0d, 0x67, 0x97, 0xe5, 0x53, 0x7a, 0x98, 0x5e, 0x06,
-  0x02, 0x83, 0x25, 0xb0, 0x06, 0x81, 0x1f, 0xd9, 0x7c, 0x66, 0x56, 0xa9,
-  0x40, 0xe0, 0xcc, 0xfa, 0x23, 0x51, 0xcb, 0x78, 0x7a, 0x5d, 0x5e, 0x96,
-  0x11, 0x81, 0xd6, 0x1f, 0xc9, 0x5e, 0x1e, 0xd3, 0xdf, 0x72, 0x60, 0x93,
-  0x04, 0x93, 0x01, 0x81, 0x40, 0x60, 0xb0, 0x10, 0xc4, 0x20, 0xf0, 0x23,
-  0x9b, 0xcf, 0xcc, 0x2a, 0x75, 0x1a, 0x6e, 0xc3, 0xd9, 0x65, 0x39, 0x10,
-  0x38, 0xab, 0x4e, 0xc3, 0x6d, 0x38, 0xbb, 0x2c, 0x9f, 0xd2, 0xc3, 0xf4,
-  0x32, 0x10, 0x18, 0xac, 0x81, 0x3a, 0x08, 0xfc, 0xd2, 0x62, 0x36, 0x31,
-  0x6d, 0x36, 0x53, 0xcb, 0x78, 0x7a, 0x5d, 0x5e, 0x06, 0x02, 0x67, 0xd6,
-  0x1f, 0x89, 0x5a, 0xc6, 0xd3, 0xeb, 0xf2, 0xf2, 0xb0, 0x2e, 0x2e, 0x03,
-  0xad, 0x3f, 0x92, 0xbd, 0x3c, 0xa6, 0xbf, 0xe5, 0xc0, 0x26, 0x09, 0x26,
-  0x03, 0x02, 0x81, 0xc0, 0x60, 0x11, 0xd4, 0x41, 0xe0, 0x97, 0x16, 0xb3,
-  0xa7, 0xf0, 0xf2, 0x98, 0x5a, 0xc6, 0xd3, 0xeb, 0xf2, 0x32, 0x10, 0x38,
-  0xb3, 0xfe, 0x48, 0xd4, 0x32, 0x9e, 0x5e, 0x97, 0x97, 0x87, 0x75, 0x71,
-  0x19, 0x68, 0xfd, 0x91, 0xec, 0xe5, 0x31, 0xfd, 0x2d, 0x07, 0x36, 0x49,
-  0x30, 0x19, 0x10, 0x08, 0x04, 0x06, 0x0b, 0xe0, 0x0d, 0x02, 0x3f, 0x76,
-  0xfa, 0x8c, 0xa6, 0x0b, 0xeb, 0x66, 0x73, 0x59, 0x0e, 0x04, 0xce, 0xac,
-  0x3f, 0xd2, 0x94, 0x2e, 0xaf, 0x8f, 0xe9, 0x75, 0x79, 0x99, 0x2c, 0xac,
-  0x9b, 0xcd, 0x65, 0x39, 0xb0, 0xca, 0x4c, 0x9f, 0xd1, 0x74, 0x20, 0x10,
-  0x08, 0x0c, 0x56, 0x40, 0x1f, 0x04, 0x7e, 0xec, 0xf4, 0x19, 0x4d, 0x1f,
-  0xb2, 0xeb, 0x73, 0x7a, 0x59, 0x2e, 0xac, 0x9b, 0xcd, 0x65, 0x39, 0x10,
-  0x38, 0xb3, 0xfe, 0x48, 0x53, 0xba, 0xbc, 0x3e, 0xa6, 0xd7, 0xe5, 0x65,
-  0xb2, 0xb0, 0x6e, 0x36, 0x97, 0xe5, 0xc0, 0x2a, 0x33, 0x7d, 0x46, 0xd3,
-  0x87, 0xec, 0xfa, 0x9c, 0x5e, 0x96, 0x03, 0x81, 0x40, 0x60, 0xb0, 0x0c,
-  0xc6, 0x20, 0xf0, 0xa3, 0x97, 0xf1, 0xf4, 0xba, 0xbc, 0x3c, 0x0d, 0xb7,
-  0xe1, 0xec, 0xb2, 0x1c, 0x08, 0x9c, 0x55, 0xa7, 0xe1, 0x36, 0x9c, 0x5d,
-  0x96, 0x4f, 0xe9, 0x61, 0x7a, 0x19, 0x08, 0x0c, 0x56, 0xc1, 0x1b, 0x04,
-  0x7e, 0xf4, 0x32, 0x9e, 0x5e, 0x97, 0x97, 0xe7, 0x40, 0xe0, 0x0c, 0x1a,
-  0xb4, 0xfe, 0x48, 0xd4, 0x32, 0x9e, 0x5e, 0x97, 0x97, 0x65, 0x44, 0xa0,
-  0xf5, 0x47, 0xb2, 0x97, 0xc7, 0xf4, 0xb7, 0x1c, 0xd8, 0x24, 0xc1, 0x66,
-  0x40, 0x20, 0x10, 0x18, 0x34, 0x85, 0x49, 0x00, 0x18, 0x22, 0x02, 0x36,
-  0xaa, 0x28, 0x88, 0xe8, 0x5f, 0x08, 0x03, 0x10, 0x30, 0x9b, 0x80, 0x86,
-  0xcb, 0x77, 0x1e, 0x3f, 0x40, 0x1a, 0x20, 0xc2, 0xfc, 0xe2, 0xb6, 0x8d,
-  0x02, 0x1a, 0x2e, 0xdf, 0x79, 0xfc, 0x00, 0x69, 0x80, 0x08, 0xf3, 0x91,
-  0xdb, 0x36, 0x0d, 0x6a, 0xb8, 0x7c, 0xe7, 0xf1, 0x03, 0xaa, 0x28, 0x88,
-  0xa8, 0x74, 0x80, 0xc1, 0x2f, 0x6e, 0xdb, 0x32, 0xa8, 0xe1, 0xf2, 0x9d,
-  0xc7, 0x0f, 0xa8, 0xa2, 0x20, 0xa2, 0xd2, 0x01, 0x06, 0x1f, 0xb9, 0x6d,
-  0xbb, 0xd8, 0x86, 0xcb, 0x77, 0x1e, 0x5f, 0x08, 0xa8, 0xa2, 0x20, 0xa2,
-  0xd2, 0x01, 0x86, 0x92, 0x30, 0x00, 0x01, 0xf3, 0x8b, 0xdb, 0x36, 0x8b,
-  0x6d, 0xb8, 0x7c, 0xe7, 0xf1, 0x85, 0x80, 0x2a, 0x0a, 0x22, 0x2a, 0x1d,
-  0x60, 0x28, 0x09, 0x03, 0x10, 0x30, 0x1f, 0xb9, 0x6d, 0xc3, 0x90, 0x86,
-  0xcb, 0x77, 0x1e, 0x5f, 0x88, 0x08, 0x60, 0x22, 0x42, 0xa0, 0x19, 0x16,
-  0xc2, 0x22, 0x9c, 0xe1, 0xf2, 0x9d, 0xc7, 0x1f, 0x9c, 0xe9, 0xf6, 0x8b,
-  0xdb, 0x36, 0x86, 0x69, 0xb8, 0x7c, 0xe7, 0xf1, 0x17, 0x07, 0x18, 0xc4,
-  0xe6, 0xa1, 0x26, 0xbf, 0xb8, 0x6d, 0x6b, 0x98, 0x86, 0xcb, 0x77, 0x1e,
-  0x7f, 0x71, 0x80, 0x41, 0x6c, 0x1e, 0x6a, 0xf2, 0x91, 0xdb, 0xb6, 0x07,
-  0x68, 0xb8, 0x7c, 0xe7, 0xf1, 0x25, 0x80, 0x79, 0x16, 0xc2, 0x2f, 0x6e,
-  0xdb, 0x24, 0xaa, 0xe1, 0xf2, 0x9d, 0xc7, 0x97, 0x00, 0xe6, 0x59, 0x88,
-  0x92, 0xa8, 0x88, 0xc5, 0x2f, 0x6e, 0xdb, 0x1c, 0xaa, 0xe1, 0xf2, 0x9d,
-  0xc7, 0x97, 0x26, 0x27, 0x22, 0x50, 0x6a, 0x7a, 0xa8, 0xc9, 0x2f, 0x6e,
-  0xdb, 0x2a, 0xa4, 0xe1, 0xf2, 0x9d, 0xc7, 0x9f, 0x88, 0x68, 0x42, 0x80,
-  0x08, 0xf3, 0x8b, 0xdb, 0x36, 0x88, 0x67, 0xb8, 0x7c, 0xe7, 0xf1, 0xa9,
-  0x06, 0x88, 0x30, 0xbf, 0xb8, 0x6d, 0x5b, 0x20, 0x18, 0x00, 0x69, 0x2c,
-  0xa1, 0x89, 0x1c, 0x67, 0xe2, 0x9c, 0x46, 0x9a, 0x80, 0x66, 0x92, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48, 0x14,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x03, 0xfa, 0xce, 0xae,
-  0x1c, 0x14, 0x0f, 0xda, 0x9c, 0x4d, 0x88, 0xee, 0x12, 0xe5, 0x41, 0x44,
-  0x58, 0x49, 0x4c, 0x98, 0x2d, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x66,
-  0x0b, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x80, 0x2d, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21,
-  0x0c, 0x00, 0x00, 0x5d, 0x0b, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41,
-  0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25,
-  0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x1c, 0x45, 0x02, 0x42,
-  0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a,
-  0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00,
-  0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x91, 0x23, 0xc4, 0x50, 0x41,
-  0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x39, 0x46, 0x06, 0x51,
-  0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff,
-  0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00,
-  0x09, 0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
-  0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89,
-  0x20, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x32, 0x22, 0xc8, 0x09, 0x20,
-  0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84, 0x04, 0x93, 0x23, 0xe3, 0x84,
-  0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c, 0x0b, 0x84, 0xe4, 0x4c, 0x10,
-  0xa0, 0xc2, 0x08, 0x40, 0x09, 0x00, 0x14, 0x98, 0x01, 0x98, 0x23, 0x00,
-  0x83, 0x39, 0x02, 0xa4, 0x18, 0x03, 0x02, 0x81, 0x50, 0x20, 0x90, 0xa1,
-  0x18, 0x04, 0x02, 0x81, 0x50, 0x20, 0x10, 0xa2, 0x18, 0x00, 0x02, 0x81,
-  0x50, 0x18, 0x90, 0xe2, 0xa6, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24, 0x7f,
-  0x25, 0xa4, 0x95, 0x98, 0xfc, 0xe2, 0xb6, 0x51, 0x31, 0x18, 0x0c, 0x06,
-  0x04, 0x2a, 0xdc, 0x33, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4, 0x87, 0x40,
-  0x33, 0x2c, 0x04, 0x0a, 0x1a, 0x85, 0x61, 0x10, 0x1c, 0x8e, 0xc1, 0x60,
-  0x30, 0x20, 0x10, 0x08, 0x03, 0x7a, 0x94, 0x61, 0x40, 0x18, 0x50, 0xa4,
-  0x20, 0x03, 0xc2, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x34, 0x29, 0xc4, 0x80,
-  0x30, 0x18, 0x50, 0xa5, 0x10, 0x04, 0x02, 0x81, 0x40, 0x97, 0x52, 0x0c,
-  0x08, 0x83, 0xc1, 0x80, 0x32, 0x47, 0x0d, 0x97, 0x3f, 0x61, 0x0f, 0x21,
-  0xf9, 0xdc, 0x46, 0x15, 0x2b, 0x31, 0xf9, 0xc8, 0x6d, 0x23, 0x82, 0x40,
-  0x20, 0x10, 0x0a, 0xb1, 0x21, 0x38, 0x08, 0xc4, 0x39, 0x6a, 0xb8, 0xfc,
-  0x09, 0x7b, 0x08, 0xc9, 0xe7, 0x36, 0xaa, 0x58, 0x89, 0xc9, 0x2f, 0x6e,
-  0x1b, 0x11, 0x83, 0xc1, 0x60, 0x50, 0x08, 0x0f, 0xc1, 0x41, 0xa0, 0xcf,
-  0x1c, 0x41, 0x50, 0x0c, 0x07, 0xa1, 0x40, 0x20, 0x84, 0x48, 0x74, 0xd3,
-  0x70, 0xf9, 0x13, 0xf6, 0x10, 0x92, 0xbf, 0x12, 0xd2, 0x4a, 0x4c, 0x3e,
-  0x72, 0xdb, 0xa8, 0x20, 0x10, 0x08, 0x04, 0x42, 0x29, 0x48, 0x04, 0x07,
-  0x81, 0x40, 0xa5, 0x52, 0x30, 0x08, 0x0e, 0x02, 0x81, 0x4e, 0x03, 0x01,
-  0xc3, 0x08, 0xc3, 0x70, 0x8c, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x25, 0x62,
-  0x1c, 0x13, 0x22, 0x54, 0x03, 0x15, 0x61, 0xa6, 0x6e, 0x1c, 0xd8, 0x21,
-  0x1c, 0xe6, 0x61, 0x1e, 0xdc, 0x60, 0x16, 0xe8, 0x41, 0x1e, 0xea, 0x61,
-  0x1c, 0xe8, 0xa1, 0x1e, 0xe4, 0xa1, 0x1c, 0xc8, 0x41, 0x14, 0xea, 0xc1,
-  0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0x81, 0x0f, 0x58, 0x21, 0x1d, 0xce, 0x01,
-  0x1d, 0xe8, 0xc1, 0x0f, 0x50, 0xb0, 0x22, 0x56, 0xfe, 0x10, 0x6e, 0x92,
-  0xa6, 0x88, 0x12, 0x26, 0xbf, 0x44, 0x8c, 0x63, 0xe2, 0x16, 0x4a, 0x9a,
-  0x88, 0x08, 0x09, 0x04, 0xd7, 0x4c, 0x64, 0x30, 0x0e, 0xec, 0x10, 0x0e,
-  0xf3, 0x30, 0x0f, 0x6e, 0x30, 0x0b, 0xf4, 0x20, 0x0f, 0xf5, 0x30, 0x0e,
-  0xf4, 0x50, 0x0f, 0xf2, 0x50, 0x0e, 0xe4, 0x20, 0x0a, 0xf5, 0x60, 0x0e,
-  0xe6, 0x50, 0x0e, 0xf2, 0xc0, 0x07, 0xac, 0x90, 0x0e, 0xe7, 0x80, 0x0e,
-  0xf4, 0x30, 0x0a, 0xec, 0x50, 0x0f, 0xf3, 0x40, 0x0f, 0xe5, 0x20, 0x0f,
-  0x7e, 0x80, 0x82, 0x17, 0xc1, 0x66, 0x6a, 0x83, 0x71, 0x60, 0x87, 0x70,
-  0x98, 0x87, 0x79, 0x70, 0x03, 0x5a, 0x28, 0x07, 0x7c, 0xa0, 0x87, 0x7a,
-  0x90, 0x87, 0x72, 0x90, 0x03, 0x52, 0xe0, 0x03, 0x7b, 0x28, 0x87, 0x71,
-  0xa0, 0x87, 0x77, 0x90, 0x07, 0x3e, 0x30, 0x07, 0x76, 0x78, 0x87, 0x70,
-  0xa0, 0x07, 0x36, 0x00, 0x83, 0x39, 0xf0, 0x03, 0x30, 0xf0, 0x03, 0x3d,
-  0xd0, 0x83, 0x76, 0x48, 0x07, 0x78, 0x98, 0x87, 0x5f, 0xa0, 0x87, 0x7c,
-  0x80, 0x87, 0x72, 0x40, 0x01, 0x61, 0x26, 0x31, 0x18, 0x07, 0x76, 0x08,
-  0x87, 0x79, 0x98, 0x07, 0x37, 0xa0, 0x85, 0x72, 0xc0, 0x07, 0x7a, 0xa8,
-  0x07, 0x79, 0x28, 0x07, 0x39, 0x20, 0x05, 0x3e, 0xb0, 0x87, 0x72, 0x18,
-  0x07, 0x7a, 0x78, 0x07, 0x79, 0xe0, 0x03, 0x73, 0x60, 0x87, 0x77, 0x08,
-  0x07, 0x7a, 0x60, 0x03, 0x30, 0x98, 0x03, 0x3f, 0x00, 0x03, 0x3f, 0x40,
-  0x82, 0x4a, 0x46, 0xb3, 0x99, 0xc8, 0x60, 0x1c, 0xd8, 0x21, 0x1c, 0xe6,
-  0x61, 0x1e, 0xdc, 0x80, 0x16, 0xca, 0x01, 0x1f, 0xe8, 0xa1, 0x1e, 0xe4,
-  0xa1, 0x1c, 0x46, 0xa1, 0x1e, 0xc4, 0xa1, 0x1c, 0xf8, 0xc0, 0x1e, 0xca,
-  0x61, 0x1c, 0xe8, 0xe1, 0x1d, 0xe4, 0x81, 0x0f, 0xcc, 0x81, 0x1d, 0xde,
-  0x21, 0x1c, 0xe8, 0x81, 0x0d, 0xc0, 0x60, 0x0e, 0xfc, 0x00, 0x0c, 0xfc,
-  0x00, 0x05, 0x2a, 0xaa, 0x0d, 0x23, 0x10, 0xc3, 0x4c, 0x6d, 0x30, 0x0e,
-  0xec, 0x10, 0x0e, 0xf3, 0x30, 0x0f, 0x6e, 0x40, 0x0b, 0xe5, 0x80, 0x0f,
-  0xf4, 0x50, 0x0f, 0xf2, 0x50, 0x0e, 0x72, 0x40, 0x0a, 0x7c, 0x60, 0x0f,
-  0xe5, 0x30, 0x0e, 0xf4, 0xf0, 0x0e, 0xf2, 0xc0, 0x07, 0xe6, 0xc0, 0x0e,
-  0xef, 0x10, 0x0e, 0xf4, 0xc0, 0x06, 0x60, 0x40, 0x07, 0x7e, 0x00, 0x06,
-  0x7e, 0xa0, 0x07, 0x7a, 0xd0, 0x0e, 0xe9, 0x00, 0x0f, 0xf3, 0xf0, 0x0b,
-  0xf4, 0x90, 0x0f, 0xf0, 0x50, 0x0e, 0x28, 0x20, 0xcc, 0x24, 0x06, 0xe3,
-  0xc0, 0x0e, 0xe1, 0x30, 0x0f, 0xf3, 0xe0, 0x06, 0xb4, 0x50, 0x0e, 0xf8,
-  0x40, 0x0f, 0xf5, 0x20, 0x0f, 0xe5, 0x20, 0x07, 0xa4, 0xc0, 0x07, 0xf6,
-  0x50, 0x0e, 0xe3, 0x40, 0x0f, 0xef, 0x20, 0x0f, 0x7c, 0x60, 0x0e, 0xec,
-  0xf0, 0x0e, 0xe1, 0x40, 0x0f, 0x6c, 0x00, 0x06, 0x74, 0xe0, 0x07, 0x60,
-  0xe0, 0x07, 0x48, 0xb8, 0xe1, 0x12, 0x20, 0x47, 0xba, 0xa3, 0xa4, 0x29,
-  0xa2, 0x84, 0xc9, 0x5f, 0x1d, 0x67, 0xe2, 0x9c, 0x46, 0x9a, 0x80, 0x66,
-  0x92, 0x50, 0x40, 0xb8, 0x26, 0x72, 0x9c, 0x89, 0x73, 0x1a, 0x69, 0x02,
-  0x9a, 0x49, 0x42, 0x01, 0x8f, 0x7a, 0x49, 0x70, 0xbb, 0x30, 0x18, 0x2e,
-  0x1f, 0x58, 0x10, 0xa3, 0x61, 0x88, 0x66, 0xf2, 0x17, 0xc2, 0x00, 0x04,
-  0xcc, 0x97, 0xa6, 0x88, 0x12, 0x26, 0x9f, 0x03, 0x18, 0x22, 0x02, 0x90,
-  0xf3, 0xfb, 0xfd, 0x7e, 0xaa, 0xc1, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x83,
-  0xc1, 0x81, 0xc1, 0x70, 0xf9, 0xc0, 0x82, 0x18, 0x0d, 0x43, 0x34, 0x93,
-  0xbf, 0x10, 0x06, 0x20, 0x60, 0xbe, 0x00, 0x30, 0x44, 0x04, 0x6c, 0x54,
-  0x51, 0x10, 0x11, 0x0a, 0x80, 0x14, 0xbc, 0x49, 0x9a, 0x22, 0x4a, 0x98,
-  0x7c, 0x16, 0x60, 0x9e, 0x85, 0x88, 0xd8, 0x09, 0x98, 0x08, 0x14, 0x10,
-  0x68, 0x98, 0x25, 0x84, 0x39, 0x02, 0x50, 0x98, 0x02, 0x00, 0x00, 0x13,
-  0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68,
-  0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a,
-  0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71,
-  0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a,
-  0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72,
-  0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d,
-  0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72,
-  0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x06, 0x10, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x10, 0x20, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x28, 0x40,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x79,
-  0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8,
-  0x13, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0,
-  0x90, 0x67, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x21, 0xcf, 0x03, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x43, 0x9e, 0x0a, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x86, 0x3c, 0x17, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x32, 0x20, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x70, 0x40, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0xf9, 0x80, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x23, 0x06, 0x40,
-  0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x29,
-  0x03, 0x20, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0xf2, 0x9c, 0x01, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x64, 0x81, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x32,
-  0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6,
-  0x04, 0x43, 0x22, 0x94, 0xc0, 0x08, 0x40, 0x31, 0x14, 0x46, 0x01, 0x15,
-  0x20, 0x41, 0x11, 0x94, 0x44, 0x19, 0x94, 0x42, 0x21, 0xd4, 0x40, 0x81,
-  0x13, 0x94, 0x47, 0x39, 0x14, 0x44, 0x51, 0x94, 0x05, 0x15, 0x4a, 0xa2,
-  0x0c, 0x0a, 0x61, 0x04, 0xa0, 0x08, 0x4a, 0xa1, 0x04, 0x0a, 0x84, 0x8c,
-  0x05, 0x42, 0xb1, 0x19, 0x00, 0xa2, 0xcd, 0x00, 0x90, 0x6d, 0x06, 0x80,
-  0x76, 0x33, 0x00, 0xe4, 0x9b, 0x01, 0x20, 0xe1, 0x0c, 0x00, 0x11, 0x67,
-  0x00, 0xa8, 0x38, 0x56, 0x19, 0x8c, 0x01, 0x01, 0x00, 0x00, 0x70, 0x1c,
-  0xc7, 0x71, 0x1c, 0x07, 0x70, 0x1c, 0x07, 0x70, 0x1c, 0x07, 0x70, 0x1c,
-  0x07, 0x70, 0x1c, 0x00, 0x70, 0x1c, 0xc7, 0x01, 0x1c, 0x07, 0xb5, 0x66,
-  0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x1a,
-  0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73,
-  0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71,
-  0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a,
-  0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b,
-  0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04, 0x02, 0x9a, 0x20, 0x10, 0xd1,
-  0x06, 0x61, 0x20, 0x26, 0x08, 0x84, 0xb4, 0x41, 0x18, 0x0c, 0x0a, 0x70,
-  0x73, 0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08, 0x6d, 0x30, 0x07, 0x04, 0x26,
-  0x08, 0xc4, 0x34, 0x41, 0x20, 0xa8, 0x0d, 0xc2, 0xd0, 0x6c, 0x48, 0x08,
-  0x65, 0x21, 0x88, 0x81, 0x21, 0x9c, 0x09, 0x42, 0x1c, 0xac, 0xc1, 0x04,
-  0x81, 0xa8, 0x36, 0x08, 0x43, 0xb4, 0x21, 0x19, 0xa0, 0x85, 0x18, 0x06,
-  0x86, 0x90, 0x26, 0x08, 0x84, 0x35, 0x41, 0xa0, 0x03, 0x36, 0x98, 0x20,
-  0x10, 0xd7, 0x06, 0x81, 0xb0, 0x36, 0x24, 0x54, 0xb5, 0x10, 0xd4, 0x40,
-  0x11, 0xd7, 0x04, 0x81, 0xc0, 0x26, 0x08, 0x76, 0xd0, 0x06, 0x13, 0x04,
-  0x22, 0xdb, 0x90, 0x64, 0xda, 0x42, 0x64, 0xc3, 0x46, 0x5c, 0x13, 0x04,
-  0x42, 0xdb, 0x90, 0x74, 0xda, 0x42, 0x74, 0xc3, 0x46, 0x5c, 0x13, 0x84,
-  0x3d, 0x70, 0x83, 0x09, 0x02, 0xb1, 0x6d, 0x48, 0xb6, 0x6f, 0x19, 0x08,
-  0x30, 0xa0, 0x88, 0x6b, 0x83, 0xf1, 0x4c, 0x18, 0xe7, 0x85, 0xc1, 0x04,
-  0xc1, 0x0f, 0xde, 0x60, 0x03, 0x42, 0x8c, 0xc1, 0x42, 0x10, 0x43, 0x07,
-  0x4c, 0x10, 0x44, 0x01, 0x0e, 0x26, 0x08, 0x04, 0xb7, 0x01, 0x19, 0xca,
-  0x60, 0x21, 0x86, 0xc1, 0x0c, 0x80, 0x0d, 0x02, 0x19, 0x9c, 0xc1, 0x04,
-  0x81, 0x14, 0xe2, 0x60, 0x03, 0x42, 0xa4, 0xc1, 0x42, 0x10, 0x03, 0x01,
-  0x6c, 0x40, 0x86, 0x34, 0x58, 0x88, 0x61, 0x20, 0x80, 0x0d, 0x08, 0x95,
-  0x06, 0x0b, 0x41, 0x0d, 0x04, 0xb0, 0x61, 0x50, 0x83, 0x35, 0x60, 0x83,
-  0x0d, 0x84, 0x18, 0x00, 0x68, 0xd0, 0x06, 0x13, 0x84, 0x52, 0x90, 0x83,
-  0x0d, 0xc1, 0x1b, 0x4c, 0x10, 0x04, 0x80, 0x44, 0x5b, 0x58, 0x9a, 0x1b,
-  0x97, 0x29, 0xab, 0x2f, 0xa8, 0xb7, 0xb9, 0x34, 0xba, 0xb4, 0x37, 0xb7,
-  0x09, 0x42, 0x21, 0x06, 0x13, 0x84, 0x62, 0x0c, 0x36, 0x04, 0xc4, 0x04,
-  0xa1, 0x20, 0x83, 0x09, 0x42, 0x51, 0x06, 0x1b, 0x16, 0x62, 0x0e, 0xe8,
-  0xa0, 0x0e, 0xec, 0xe0, 0x0e, 0x86, 0x3b, 0x20, 0xf0, 0x00, 0x20, 0x02,
-  0xf5, 0x34, 0x95, 0x44, 0x95, 0xf4, 0xe4, 0x34, 0x41, 0x28, 0xcc, 0x60,
-  0x82, 0x40, 0x74, 0x1b, 0x84, 0x8c, 0x0f, 0x36, 0x2c, 0x83, 0x1e, 0xd0,
-  0x01, 0x1e, 0xd8, 0xc1, 0x1e, 0x0c, 0x77, 0x30, 0xe0, 0x41, 0x1f, 0x6c,
-  0x08, 0x86, 0x09, 0x02, 0xe1, 0x6d, 0x10, 0x32, 0x50, 0xd8, 0xb0, 0x50,
-  0x7a, 0x40, 0x07, 0x78, 0xf0, 0x07, 0x7b, 0x30, 0xd4, 0x01, 0x85, 0x07,
-  0xa1, 0x40, 0x85, 0x4a, 0xc8, 0xe9, 0xab, 0x29, 0x88, 0x4a, 0x2a, 0x09,
-  0x6b, 0xc3, 0x40, 0x0c, 0xd4, 0x86, 0x25, 0x1b, 0x05, 0x3a, 0xc0, 0x03,
-  0x52, 0xd8, 0x83, 0xac, 0x0e, 0x32, 0x3c, 0x08, 0x05, 0x22, 0x54, 0x45,
-  0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x1b, 0x84, 0x2c, 0xdb, 0xb0, 0x74,
-  0xa6, 0x40, 0x07, 0x78, 0x60, 0x07, 0x7b, 0x30, 0xec, 0x81, 0x81, 0x07,
-  0xa7, 0x40, 0xa4, 0x29, 0x88, 0xaa, 0x48, 0x2a, 0x29, 0x88, 0x69, 0x82,
-  0x50, 0x9c, 0xc1, 0x04, 0xa1, 0x40, 0x83, 0x0d, 0x42, 0x36, 0x6c, 0x58,
-  0xb6, 0x54, 0x50, 0x05, 0x3c, 0xb0, 0x83, 0x55, 0x18, 0x56, 0x01, 0x14,
-  0xf0, 0x80, 0x15, 0x36, 0x2c, 0x46, 0x2a, 0xa8, 0x02, 0x1e, 0xfc, 0xc1,
-  0x2a, 0x0c, 0xab, 0x00, 0x0a, 0xab, 0xc0, 0x0a, 0x1b, 0x02, 0x6a, 0xc3,
-  0x02, 0x0a, 0xa9, 0xa0, 0x0a, 0x78, 0xf0, 0x0a, 0xab, 0x30, 0xac, 0x02,
-  0x28, 0xec, 0x01, 0x2b, 0x4c, 0x10, 0x88, 0x6f, 0x43, 0x90, 0x6d, 0x58,
-  0x62, 0x21, 0x15, 0x54, 0x01, 0x0f, 0x64, 0x61, 0x15, 0x86, 0x55, 0x00,
-  0x85, 0x3a, 0x60, 0x85, 0x0d, 0x41, 0xb7, 0x61, 0xb1, 0x52, 0x41, 0x15,
-  0xf0, 0x80, 0x16, 0x56, 0x61, 0x58, 0x85, 0x58, 0xc0, 0x03, 0x60, 0x82,
-  0x40, 0x80, 0xc1, 0x86, 0x60, 0xdb, 0xb0, 0xd8, 0x42, 0x2a, 0xa8, 0x02,
-  0x1e, 0xdc, 0xc2, 0x2a, 0x0c, 0xab, 0x10, 0x0b, 0xab, 0xc0, 0x0a, 0x13,
-  0x04, 0x22, 0x0c, 0xc8, 0x3c, 0x09, 0x29, 0x15, 0x0d, 0x51, 0x7d, 0x19,
-  0x31, 0x05, 0x1d, 0x4d, 0x6d, 0x58, 0x72, 0x41, 0x17, 0x54, 0x01, 0x0f,
-  0xec, 0x60, 0x15, 0x86, 0x55, 0x88, 0x85, 0x3d, 0x60, 0x85, 0x0d, 0x4c,
-  0x1e, 0xf8, 0x81, 0x28, 0x94, 0x02, 0x2a, 0xb4, 0x82, 0x2b, 0xc0, 0xc2,
-  0x2c, 0xd4, 0x02, 0x2e, 0xec, 0x02, 0x93, 0x29, 0xab, 0x2f, 0xaa, 0x30,
-  0xb9, 0xb3, 0x32, 0xba, 0x09, 0x42, 0x91, 0x06, 0x1b, 0x16, 0xa2, 0x17,
-  0xe8, 0xc0, 0x17, 0xec, 0x00, 0x0f, 0x86, 0x3b, 0x20, 0xf0, 0xa0, 0x0f,
-  0x36, 0x04, 0xbf, 0xb0, 0x61, 0xe0, 0x05, 0x70, 0x00, 0x26, 0x08, 0xa6,
-  0xa0, 0x06, 0x1b, 0x04, 0x42, 0x1c, 0x36, 0x14, 0x71, 0x20, 0x07, 0xe1,
-  0xe0, 0x06, 0xe3, 0x50, 0x85, 0x8d, 0xcd, 0xae, 0xcd, 0x25, 0x8d, 0xac,
-  0xcc, 0x8d, 0x6e, 0x4a, 0x10, 0x54, 0x21, 0xc3, 0x73, 0xb1, 0x2b, 0x93,
-  0x9b, 0x4b, 0x7b, 0x73, 0x9b, 0x12, 0x10, 0x4d, 0xc8, 0xf0, 0x5c, 0xec,
-  0xc2, 0xd8, 0xec, 0xca, 0xe4, 0xa6, 0x04, 0x46, 0x1d, 0x32, 0x3c, 0x97,
-  0x39, 0xb4, 0x30, 0xb2, 0x32, 0xb9, 0xa6, 0x37, 0xb2, 0x32, 0xb6, 0x29,
-  0x01, 0x52, 0x86, 0x0c, 0xcf, 0x45, 0xae, 0x6c, 0xee, 0xad, 0x4e, 0x6e,
-  0xac, 0x6c, 0x6e, 0x4a, 0xd0, 0x06, 0x75, 0xc8, 0xf0, 0x5c, 0xec, 0xd2,
-  0xca, 0xee, 0x92, 0xc8, 0xa6, 0xe8, 0xc2, 0xe8, 0xca, 0xa6, 0x04, 0x6f,
-  0x50, 0x87, 0x0c, 0xcf, 0xa5, 0xcc, 0x8d, 0x4e, 0x2e, 0x0f, 0xea, 0x2d,
-  0xcd, 0x8d, 0x6e, 0x6e, 0x4a, 0x30, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x79,
-  0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4,
-  0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c,
-  0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00,
-  0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2,
-  0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38,
-  0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d,
-  0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87,
-  0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87,
-  0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30,
-  0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde,
-  0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b,
-  0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c,
-  0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07,
-  0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87,
-  0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87,
-  0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87,
-  0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0,
-  0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc,
-  0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4,
-  0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39,
-  0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38,
-  0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b,
-  0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03,
-  0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0,
-  0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0,
-  0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71,
-  0x20, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x86, 0x00, 0x0d, 0x97, 0xef,
-  0x3c, 0x7e, 0x80, 0x34, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x5b, 0x02, 0x34,
-  0x5c, 0xbe, 0xf3, 0xf8, 0x01, 0xd2, 0x00, 0x11, 0xe6, 0x23, 0xb7, 0x6d,
-  0x0f, 0xd4, 0x70, 0xf9, 0xce, 0xe3, 0x07, 0x54, 0x51, 0x10, 0x51, 0xe9,
-  0x00, 0x83, 0x5f, 0xdc, 0xb6, 0x39, 0x50, 0xc3, 0xe5, 0x3b, 0x8f, 0x1f,
-  0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x3e, 0x72, 0xdb, 0xc6, 0xb0,
-  0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x10, 0x50, 0x45, 0x41, 0x44, 0xa5, 0x03,
-  0x0c, 0x25, 0x61, 0x00, 0x02, 0xe6, 0x17, 0xb7, 0x6d, 0x0b, 0xdb, 0x70,
-  0xf9, 0xce, 0xe3, 0x0b, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0, 0x50,
-  0x12, 0x06, 0x20, 0x60, 0x3e, 0x72, 0xdb, 0xd6, 0x20, 0x0d, 0x97, 0xef,
-  0x3c, 0xbe, 0x10, 0x11, 0xc0, 0x44, 0x84, 0x40, 0x33, 0x2c, 0x84, 0x19,
-  0x38, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x38, 0xd3, 0xed, 0x17, 0xb7, 0x6d,
-  0x01, 0xd3, 0x70, 0xf9, 0xce, 0xe3, 0x2f, 0x0e, 0x30, 0x88, 0xcd, 0x43,
-  0x4d, 0x7e, 0x71, 0xdb, 0x26, 0x30, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0xe2,
-  0x00, 0x83, 0xd8, 0x3c, 0xd4, 0xe4, 0x23, 0xb7, 0x6d, 0x04, 0xd0, 0x70,
-  0xf9, 0xce, 0xe3, 0x4b, 0x00, 0xf3, 0x2c, 0x84, 0x5f, 0xdc, 0xb6, 0x1d,
-  0x54, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x01, 0xcc, 0xb3, 0x10, 0x25, 0x51,
-  0x11, 0x8b, 0x5f, 0xdc, 0xb6, 0x0d, 0x54, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f,
-  0x4d, 0x4e, 0x44, 0xa0, 0xd4, 0xf4, 0x50, 0x93, 0x5f, 0xdc, 0xb6, 0x29,
-  0x48, 0xc3, 0xe5, 0x3b, 0x8f, 0x3f, 0x11, 0xd1, 0x84, 0x00, 0x11, 0xe6,
-  0x17, 0xb7, 0x6d, 0x05, 0xcf, 0x70, 0xf9, 0xce, 0xe3, 0x53, 0x0d, 0x10,
-  0x61, 0x7e, 0x71, 0xdb, 0x06, 0x40, 0x30, 0x00, 0xd2, 0x00, 0x00, 0x61,
-  0x20, 0x00, 0x00, 0x7d, 0x08, 0x00, 0x00, 0x13, 0x04, 0x55, 0x2c, 0x10,
-  0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x14, 0x1a, 0x01, 0x20, 0x42,
-  0x41, 0x15, 0x49, 0x19, 0x15, 0x48, 0xa9, 0x94, 0x4c, 0xf1, 0x15, 0x5e,
-  0xb9, 0x14, 0x62, 0x40, 0xd9, 0x15, 0x4c, 0xc9, 0x15, 0x57, 0xb9, 0xcd,
-  0x00, 0xd0, 0x60, 0x8c, 0x80, 0x27, 0xe3, 0x90, 0xff, 0xc6, 0x08, 0x5e,
-  0x1a, 0x5e, 0x5f, 0x6f, 0x8c, 0xe0, 0xef, 0xcf, 0x7a, 0xff, 0xc6, 0x08,
-  0xfa, 0x58, 0x74, 0xe3, 0x6f, 0x8c, 0x20, 0x0d, 0x6f, 0x1f, 0xfc, 0xc6,
-  0x08, 0xf2, 0xb0, 0x8d, 0xdd, 0x6f, 0x8c, 0x00, 0x04, 0x41, 0x10, 0xfd,
-  0xc6, 0x08, 0x46, 0xd6, 0x2f, 0xc5, 0x6f, 0x8c, 0x40, 0x67, 0xcd, 0x39,
-  0xfe, 0xc6, 0x08, 0x76, 0x7f, 0x94, 0x49, 0x30, 0x18, 0x23, 0x00, 0x41,
-  0x10, 0x04, 0x41, 0x61, 0x8c, 0x00, 0x04, 0x41, 0x10, 0xfe, 0xc6, 0x08,
-  0x5a, 0x73, 0xce, 0x69, 0x6f, 0x8c, 0x00, 0x04, 0x41, 0x10, 0x05, 0x83,
-  0x31, 0x02, 0x10, 0x04, 0x41, 0x18, 0x0c, 0xc6, 0x08, 0x5e, 0x1a, 0x5e,
-  0xef, 0x6f, 0x8c, 0x40, 0xc5, 0xeb, 0x53, 0xf6, 0x85, 0x31, 0x82, 0x91,
-  0xf5, 0x4b, 0xf5, 0x1b, 0x23, 0x00, 0x41, 0x10, 0x54, 0xc1, 0x60, 0x8c,
-  0x40, 0xc5, 0xeb, 0x53, 0xf6, 0xc6, 0x08, 0x40, 0x10, 0x04, 0x41, 0x30,
-  0x18, 0x23, 0x00, 0x41, 0x10, 0xc4, 0x7f, 0x61, 0x04, 0x60, 0x8c, 0x00,
-  0x04, 0x41, 0x10, 0xff, 0x66, 0x00, 0x00, 0x23, 0x06, 0x09, 0x00, 0x82,
-  0x60, 0x20, 0x06, 0xb1, 0xd0, 0xe5, 0x01, 0x29, 0x90, 0x82, 0x1a, 0x8c,
-  0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x18, 0xc8, 0x82, 0xa7, 0x07, 0xa7,
-  0x70, 0x0a, 0x6b, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x62, 0x30,
-  0x0b, 0xdf, 0x1e, 0xa8, 0x82, 0x2a, 0xb0, 0xc1, 0x88, 0x41, 0x02, 0x80,
-  0x20, 0x18, 0x88, 0x01, 0x2d, 0x80, 0x01, 0x1f, 0xc4, 0x42, 0x2c, 0xb4,
-  0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x88, 0x41, 0x2d, 0x84, 0x41,
-  0x1f, 0xc4, 0x42, 0x2c, 0xb8, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18,
-  0x88, 0x81, 0x2d, 0x88, 0x01, 0x28, 0xb4, 0x42, 0x2b, 0xbc, 0xc1, 0x88,
-  0x41, 0x02, 0x80, 0x20, 0x18, 0x88, 0xc1, 0x2d, 0x8c, 0x41, 0x28, 0xd0,
-  0x02, 0x2d, 0xc0, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x88, 0x01,
-  0x2e, 0x90, 0x81, 0x28, 0xd0, 0x02, 0x2d, 0xc4, 0xc1, 0x88, 0x41, 0x02,
-  0x80, 0x20, 0x18, 0x88, 0x41, 0x2e, 0x94, 0x01, 0x28, 0xd8, 0x82, 0x2d,
-  0xc8, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x88, 0x81, 0x2e, 0x98,
-  0x41, 0x28, 0xd8, 0x82, 0x2d, 0xcc, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20,
-  0x18, 0x20, 0xe6, 0xe0, 0x0a, 0xa7, 0x70, 0x0b, 0xa3, 0x40, 0x06, 0x23,
-  0x06, 0x09, 0x00, 0x82, 0x60, 0x80, 0x9c, 0xc3, 0x2b, 0xa4, 0x02, 0x2e,
-  0x90, 0x42, 0x19, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x01, 0x82, 0x0e,
-  0xb0, 0xb0, 0x0a, 0xb9, 0x50, 0x0a, 0x66, 0x30, 0x62, 0x90, 0x00, 0x20,
-  0x08, 0x06, 0x48, 0x3a, 0xc4, 0x42, 0x2b, 0xe8, 0x82, 0x29, 0x9c, 0xc1,
-  0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x20, 0xea, 0x20, 0x0b, 0xba, 0xb0,
-  0x0b, 0xa7, 0x80, 0x06, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x80, 0xac,
-  0xc3, 0x2c, 0xd0, 0x02, 0x2f, 0xa0, 0x42, 0x1a, 0x8c, 0x18, 0x24, 0x00,
-  0x08, 0x82, 0x81, 0xd1, 0x0e, 0xb4, 0x40, 0x0b, 0xbd, 0x90, 0x0a, 0x6a,
-  0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x86, 0x3b, 0xd4, 0x42, 0x2d,
-  0xf8, 0xc2, 0x29, 0xac, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18,
-  0xef, 0x60, 0x0b, 0xba, 0xf0, 0x0b, 0xab, 0xc0, 0x06, 0x23, 0x06, 0x09,
-  0x00, 0x82, 0x60, 0x60, 0xc0, 0xc3, 0x2d, 0xec, 0x02, 0x38, 0xa4, 0x42,
-  0x1b, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x11, 0x0f, 0xb8, 0xc0,
-  0x0b, 0xe1, 0xc0, 0x0a, 0x6e, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06,
-  0x86, 0x3c, 0xe4, 0xc2, 0x38, 0x88, 0x83, 0x2b, 0xbc, 0xc1, 0x88, 0x41,
-  0x02, 0x80, 0x20, 0x18, 0x18, 0xf3, 0xa0, 0x0b, 0xe4, 0x30, 0x0e, 0xac,
-  0x00, 0x07, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xd0, 0xc3, 0x2e,
-  0x94, 0x03, 0x39, 0xbc, 0x42, 0x1c, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82,
-  0x81, 0x51, 0x0f, 0xbc, 0x60, 0x0e, 0xe5, 0x30, 0x0b, 0x72, 0x30, 0x62,
-  0x90, 0x00, 0x20, 0x08, 0x06, 0x86, 0x3d, 0xf4, 0xc2, 0x2f, 0x98, 0x83,
-  0x2c, 0xcc, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0xf7, 0xe0,
-  0x0b, 0xe0, 0x70, 0x0e, 0xb0, 0x40, 0x07, 0x23, 0x06, 0x09, 0x00, 0x82,
-  0x60, 0x60, 0xe0, 0xc3, 0x2f, 0x84, 0x03, 0x3a, 0xcc, 0x42, 0x1d, 0x8c,
-  0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x91, 0x0f, 0xe0, 0x20, 0x0e, 0xea,
-  0x50, 0x0b, 0x76, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x86, 0x3e,
-  0x84, 0xc3, 0x38, 0xac, 0xc3, 0x2c, 0xdc, 0xc1, 0x88, 0x41, 0x02, 0x80,
-  0x20, 0x18, 0x18, 0xfb, 0x20, 0x0e, 0xe4, 0xc0, 0x0e, 0xb6, 0x80, 0x07,
-  0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xf0, 0xc3, 0x38, 0x94, 0xc3,
-  0x39, 0xe0, 0x42, 0x1e, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xd1,
-  0x0f, 0xe4, 0x60, 0x0e, 0xe8, 0x60, 0x0b, 0x7a, 0x30, 0x62, 0x90, 0x00,
-  0x20, 0x08, 0x06, 0x86, 0x3f, 0x94, 0xc3, 0x39, 0xa4, 0x43, 0x2e, 0xec,
-  0x41, 0x61, 0xf0, 0x80, 0xc3, 0x0d, 0x01, 0x3c, 0x80, 0xc1, 0x2c, 0x43,
-  0x50, 0x04, 0x55, 0xc5, 0x03, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81,
-  0x18, 0xd8, 0x83, 0x28, 0xf8, 0x82, 0x3a, 0x04, 0xaf, 0x30, 0x62, 0xf0,
-  0x00, 0x20, 0x08, 0x06, 0x0f, 0x48, 0xa0, 0x42, 0xf0, 0x59, 0xd5, 0x19,
-  0x9c, 0xc1, 0x3c, 0xcc, 0x03, 0x28, 0x9c, 0xc1, 0x68, 0x42, 0x00, 0x8c,
-  0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x14, 0x77, 0x0f, 0x30, 0x62, 0x90,
-  0x00, 0x20, 0x08, 0x06, 0x62, 0xc0, 0x0f, 0xa8, 0x40, 0x0e, 0xf0, 0x10,
-  0xd4, 0xc2, 0x88, 0xc1, 0x03, 0x80, 0x20, 0x18, 0x3c, 0x26, 0xe1, 0x0a,
-  0x41, 0x19, 0x70, 0x5b, 0x1b, 0xb4, 0x41, 0x3e, 0xe4, 0x83, 0x29, 0xb4,
-  0xc1, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0x41, 0x89, 0x01, 0x3f, 0xc0,
-  0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x88, 0x41, 0x48, 0xb4, 0x42, 0x3a,
-  0xd4, 0x43, 0xa0, 0x0b, 0x23, 0x06, 0x0f, 0x00, 0x82, 0x60, 0xf0, 0xac,
-  0xc4, 0x2c, 0x04, 0x6a, 0x10, 0x06, 0x60, 0x20, 0x07, 0x72, 0xe0, 0x0f,
-  0xfe, 0xb0, 0x0a, 0x72, 0x30, 0x9a, 0x10, 0x00, 0x75, 0x06, 0x20, 0x01,
-  0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x20, 0x06, 0x25, 0x11, 0x0b, 0xed,
-  0x90, 0x0f, 0x81, 0x2f, 0x8c, 0x18, 0x3c, 0x00, 0x08, 0x82, 0xc1, 0xf3,
-  0x12, 0xb7, 0x10, 0xb8, 0x41, 0x19, 0x90, 0x81, 0x1d, 0xd8, 0x81, 0x48,
-  0x88, 0xc4, 0x2b, 0xd8, 0xc1, 0x68, 0x42, 0x00, 0x58, 0x51, 0xc8, 0x67,
-  0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0x2a, 0x97, 0xf8, 0x85, 0xa0, 0x14,
-  0x8c, 0xf1, 0x03, 0xf9, 0x18, 0xf3, 0x07, 0xf2, 0x31, 0xe1, 0x0f, 0xe0,
-  0x63, 0x02, 0x28, 0xc0, 0xc7, 0x04, 0x41, 0x3e, 0x06, 0x0a, 0x41, 0x7c,
-  0x6c, 0x18, 0xe4, 0x63, 0x42, 0x10, 0x9f, 0x11, 0x03, 0x03, 0x00, 0x41,
-  0x30, 0x88, 0x74, 0xe2, 0x17, 0x02, 0x3b, 0xd2, 0x40, 0x3e, 0x23, 0x06,
-  0x08, 0x00, 0x82, 0x60, 0x90, 0xdd, 0xc4, 0x2f, 0x1c, 0x69, 0x10, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0x86, 0x13, 0xe0, 0x30, 0xa4, 0x41,
-  0x60, 0x4a, 0x1a, 0xc8, 0x67, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0x32,
-  0x9d, 0x10, 0x07, 0x25, 0x0d, 0x82, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30,
-  0xc8, 0x76, 0x62, 0x1c, 0x8c, 0x34, 0x08, 0xac, 0x49, 0x03, 0xf9, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0xd6, 0x13, 0xe5, 0xd0, 0xa4, 0x41,
-  0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x99, 0x4f, 0x98, 0x43, 0x92,
-  0x06, 0xc1, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18, 0x4c, 0x63, 0x61, 0x0e,
-  0x07, 0x11, 0x1c, 0x44, 0x30, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06, 0x51,
-  0x59, 0xc0, 0x43, 0x60, 0x41, 0x22, 0x1f, 0x13, 0x0e, 0xf9, 0xd8, 0x50,
-  0xc8, 0xc7, 0x64, 0x41, 0x8b, 0x8f, 0x05, 0x6a, 0x20, 0x1f, 0x13, 0xd4,
-  0x40, 0x3e, 0x36, 0xa8, 0x81, 0x7c, 0xac, 0x0d, 0x7a, 0x01, 0x3e, 0xd6,
-  0x06, 0xbe, 0x00, 0x1f, 0x6b, 0x83, 0x5f, 0x80, 0x8f, 0x85, 0xc1, 0x20,
-  0x1f, 0x13, 0x83, 0x41, 0x3e, 0x36, 0x06, 0x83, 0x7c, 0x6c, 0x00, 0x07,
-  0xf8, 0xd8, 0x10, 0x0e, 0xf0, 0xb1, 0x41, 0x1c, 0xe0, 0x33, 0x62, 0x70,
-  0x00, 0x20, 0x08, 0x06, 0xdf, 0x5b, 0xf0, 0x43, 0x2d, 0x8c, 0xc4, 0x68,
-  0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0xd8, 0xf0, 0x0a,
-  0xf1, 0xb1, 0xe1, 0x15, 0xe2, 0x63, 0xc3, 0x2b, 0xc4, 0x67, 0xc4, 0x60,
-  0x01, 0x40, 0x10, 0x0c, 0x26, 0xbe, 0xf8, 0x87, 0x41, 0x08, 0x06, 0x21,
-  0x18, 0x31, 0x30, 0x00, 0x10, 0x04, 0x83, 0xc8, 0x2f, 0x52, 0x22, 0xb0,
-  0x22, 0x90, 0x8f, 0x15, 0x82, 0x7c, 0xac, 0x18, 0xe4, 0x33, 0x62, 0xb0,
-  0x00, 0x20, 0x08, 0x06, 0x53, 0x68, 0x90, 0x04, 0xb7, 0x69, 0x83, 0x10,
-  0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0x34, 0x1a, 0x76, 0x11, 0x8c,
-  0x18, 0x3c, 0x00, 0x08, 0x82, 0xc1, 0x23, 0x1a, 0x2e, 0x91, 0x0e, 0xe6,
-  0x10, 0xe4, 0x01, 0x3b, 0xb0, 0x03, 0x5e, 0xe0, 0x45, 0x49, 0xb8, 0xc3,
-  0x68, 0x42, 0x10, 0xd8, 0x3b, 0x04, 0xf4, 0xb1, 0x40, 0x1e, 0xe0, 0x63,
-  0x41, 0x25, 0x1f, 0x13, 0x2a, 0xf9, 0xd8, 0x50, 0xc9, 0xc7, 0x06, 0x7a,
-  0x80, 0x8f, 0x0d, 0xf5, 0x00, 0x1f, 0x1b, 0xec, 0x01, 0x3e, 0x06, 0x0e,
-  0xbd, 0x40, 0x1f, 0x03, 0x07, 0x5f, 0xa0, 0x8f, 0x09, 0x22, 0x21, 0x1f,
-  0x0b, 0x46, 0x02, 0x3e, 0x36, 0x94, 0x84, 0x7c, 0x2c, 0x30, 0x09, 0xf8,
-  0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1, 0xd7, 0x1a, 0x3a, 0x31, 0x0f,
-  0xa7, 0x31, 0x9a, 0x10, 0x08, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xf0,
-  0xbd, 0x06, 0x4f, 0xd4, 0x43, 0x5f, 0x8c, 0x26, 0x04, 0x82, 0xa1, 0x43,
-  0x10, 0x1f, 0x0b, 0x08, 0xfa, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1,
-  0x37, 0x1b, 0x60, 0x91, 0x0f, 0x69, 0x31, 0x9a, 0x10, 0x0c, 0xa3, 0x09,
-  0x82, 0x60, 0x33, 0x41, 0xc4, 0x67, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c,
-  0x22, 0xdf, 0x30, 0x8b, 0xc0, 0x82, 0x41, 0x3e, 0x16, 0x14, 0xf1, 0xb9,
-  0x80, 0x30, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0x70, 0xf9, 0x86, 0x5c,
-  0x04, 0x6a, 0x71, 0x12, 0x61, 0x2e, 0x22, 0x4c, 0x05, 0xb0, 0x71, 0x15,
-  0x0c, 0x50, 0x85, 0x6b, 0x5c, 0x09, 0x01, 0x98, 0x4e, 0xdc, 0x41, 0x7c,
-  0x6c, 0x27, 0xf2, 0x20, 0x3e, 0xc6, 0x13, 0x7b, 0x10, 0x9f, 0x59, 0x02,
-  0x61, 0xa0, 0x62, 0x60, 0x93, 0xe0, 0x3c, 0x86, 0x81, 0x8a, 0xc1, 0x4d,
-  0x82, 0xf3, 0x18, 0x06, 0x2a, 0x06, 0x38, 0x09, 0xce, 0x63, 0x18, 0xa8,
-  0x20, 0x4c, 0x27, 0x38, 0x8f, 0x61, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c,
-  0xca, 0xe0, 0x3c, 0xee, 0x82, 0x26, 0x10, 0xf2, 0x18, 0x4d, 0x08, 0x80,
-  0xe1, 0x86, 0x21, 0x20, 0x83, 0x59, 0x86, 0x81, 0x08, 0x8a, 0x10, 0x8f,
-  0xab, 0xe0, 0x37, 0x60, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0xca, 0x80,
-  0x3d, 0xf8, 0x22, 0x27, 0x9a, 0x60, 0x34, 0x21, 0x00, 0x46, 0x0c, 0x10,
-  0x00, 0x04, 0xc1, 0xe0, 0x0c, 0xda, 0xc3, 0x2f, 0x74, 0x22, 0x58, 0x8f,
-  0xd1, 0x84, 0x00, 0x18, 0x4d, 0x10, 0x82, 0xd1, 0x84, 0x41, 0x18, 0x31,
-  0x40, 0x00, 0x10, 0x04, 0x83, 0x33, 0x88, 0x0f, 0xd1, 0xf0, 0x89, 0xa2,
-  0x3d, 0x46, 0x13, 0x02, 0x60, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0xce,
-  0x60, 0x3e, 0x48, 0x03, 0x2c, 0x0e, 0xd5, 0x18, 0x4d, 0x08, 0x80, 0xd1,
-  0x04, 0x21, 0x18, 0x4d, 0x18, 0x04, 0x4b, 0x6c, 0x22, 0x3e, 0x96, 0xd8,
-  0x44, 0x7c, 0x2c, 0xb1, 0x89, 0xf8, 0xd8, 0x30, 0xc8, 0xc7, 0x86, 0x41,
-  0x3e, 0x26, 0x04, 0xf0, 0x31, 0x82, 0x90, 0x8f, 0x09, 0x01, 0x7c, 0x46,
-  0x0c, 0x0c, 0x00, 0x04, 0xc1, 0x20, 0x4a, 0x11, 0xd7, 0x08, 0x2c, 0x09,
-  0xe8, 0x63, 0x89, 0x40, 0x1f, 0x4b, 0x06, 0xfa, 0xd8, 0xe0, 0x0a, 0xf0,
-  0xb1, 0xc1, 0x15, 0xe0, 0x63, 0x83, 0x2b, 0xc0, 0x67, 0xc4, 0x60, 0x01,
-  0x40, 0x10, 0x0c, 0xa6, 0x17, 0x91, 0x8d, 0x41, 0x08, 0x06, 0x21, 0x18,
-  0x31, 0x30, 0x00, 0x10, 0x04, 0x83, 0x28, 0x46, 0x78, 0x23, 0xb0, 0xa0,
-  0x90, 0x8f, 0x09, 0x85, 0x7c, 0x6c, 0x28, 0xe4, 0x33, 0x62, 0xb0, 0x00,
-  0x20, 0x08, 0x06, 0x13, 0x8d, 0xdc, 0xc6, 0x3b, 0xb8, 0x43, 0x3b, 0x0c,
-  0x42, 0x30, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06, 0x91, 0x8d, 0xf4, 0x47,
-  0x30, 0x62, 0xb0, 0x00, 0x20, 0x08, 0x06, 0x93, 0x8d, 0xe4, 0x46, 0x3c,
-  0xc0, 0xc3, 0x3b, 0x34, 0xcc, 0x32, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06,
-  0x11, 0x8e, 0xfc, 0x47, 0x30, 0x62, 0xb0, 0x00, 0x20, 0x08, 0x06, 0x13,
-  0x8e, 0xec, 0x86, 0x2e, 0xe4, 0x02, 0x2e, 0x1c, 0x46, 0x31, 0x62, 0x60,
-  0x00, 0x20, 0x08, 0x06, 0x91, 0x8e, 0x84, 0x48, 0x60, 0xa4, 0x11, 0xc4,
-  0x67, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0x22, 0x1e, 0x21, 0x8f, 0xc0,
-  0x82, 0xd5, 0x90, 0xcf, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x3e,
-  0xa2, 0x1e, 0x81, 0x05, 0x74, 0x20, 0x1f, 0x13, 0xec, 0x40, 0x3e, 0x36,
-  0xe0, 0x81, 0x7c, 0x6c, 0x78, 0x07, 0xf8, 0xd8, 0xf0, 0x0e, 0xf0, 0xb1,
-  0xe1, 0x1d, 0xe0, 0x63, 0x34, 0x41, 0x13, 0xf2, 0xb1, 0x20, 0x36, 0xe0,
-  0x63, 0x51, 0x24, 0x1f, 0x0b, 0x04, 0xf9, 0x58, 0x20, 0x1b, 0xf0, 0xb1,
-  0x20, 0x90, 0x8f, 0x05, 0xe2, 0x21, 0x1f, 0x3b, 0x02, 0xfa, 0x98, 0x6d,
-  0x20, 0xf1, 0xb1, 0x75, 0x58, 0x07, 0xf9, 0x58, 0x20, 0xc8, 0xc7, 0x82,
-  0x05, 0x3e, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60, 0x10, 0xc5, 0x89, 0x7d,
-  0x04, 0x16, 0x68, 0xf2, 0xb1, 0x6d, 0x93, 0x8f, 0x05, 0x87, 0x7c, 0x2c,
-  0x80, 0xe0, 0x33, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06, 0x91, 0x9d, 0xec,
-  0x47, 0x60, 0x01, 0x3d, 0xc8, 0xc7, 0x02, 0x03, 0x3e, 0xe6, 0x1e, 0x01,
-  0x7d, 0x2c, 0x70, 0xe4, 0x63, 0x19, 0x3c, 0xc8, 0xc7, 0x02, 0x41, 0x3e,
-  0xa6, 0xc5, 0x83, 0x7c, 0x2c, 0x20, 0xe4, 0x63, 0x9b, 0x3c, 0xc8, 0xc7,
-  0x02, 0x43, 0x3e, 0x76, 0x13, 0xf0, 0x21, 0x1f, 0xbb, 0x89, 0xf8, 0x90,
-  0x8f, 0xdd, 0x84, 0x7c, 0xc8, 0xc7, 0xda, 0x43, 0x0c, 0xe2, 0x63, 0xee,
-  0x21, 0x06, 0xf1, 0xb1, 0xf7, 0x10, 0x83, 0xf8, 0x98, 0x31, 0xc8, 0xc7,
-  0x8c, 0x41, 0x3e, 0x66, 0x0c, 0xf2, 0x31, 0x67, 0x80, 0x8f, 0x35, 0x03,
-  0x7c, 0x8c, 0x19, 0xe0, 0x63, 0xa4, 0x10, 0x0b, 0xf4, 0xb1, 0x20, 0x90,
-  0x8f, 0x05, 0x81, 0x7c, 0x2c, 0x3f, 0x82, 0xf8, 0x8c, 0x18, 0x18, 0x00,
-  0x08, 0x82, 0x41, 0x14, 0x2b, 0x78, 0x12, 0x58, 0x10, 0xc8, 0xc7, 0x54,
-  0x41, 0x15, 0xe4, 0x63, 0x41, 0x7f, 0xc0, 0xc7, 0x86, 0x80, 0x3e, 0xe6,
-  0x07, 0xb8, 0x20, 0x1f, 0x0b, 0x04, 0xf9, 0x58, 0xe0, 0xc8, 0xc7, 0x42,
-  0x41, 0x17, 0xe4, 0x63, 0x41, 0x21, 0x1f, 0x0b, 0x20, 0xf9, 0x18, 0x29,
-  0xf0, 0x82, 0x7c, 0x2c, 0x40, 0xe4, 0x63, 0x81, 0x24, 0x1f, 0x3b, 0xe6,
-  0x01, 0x3e, 0x56, 0xcc, 0x03, 0x7c, 0x6c, 0x98, 0x07, 0xf8, 0xd4, 0x3c,
-  0xdc, 0x0a, 0xcc, 0x12, 0x08, 0xa3, 0x09, 0xb9, 0x11, 0x8c, 0x26, 0x80,
-  0x05, 0x60, 0x2e, 0x22, 0x16, 0xf1, 0x19, 0x31, 0x30, 0x00, 0x10, 0x04,
-  0x83, 0xc8, 0x5c, 0xdc, 0x24, 0xb0, 0xa0, 0x46, 0xe4, 0x33, 0x62, 0x60,
-  0x00, 0x20, 0x08, 0x06, 0x11, 0xba, 0xd0, 0x49, 0x60, 0x81, 0x3f, 0xc8,
-  0xc7, 0x04, 0x90, 0x90, 0x8f, 0x0d, 0x22, 0x21, 0x9f, 0x11, 0x83, 0x07,
-  0x00, 0x41, 0x30, 0x78, 0xd4, 0xc5, 0x4e, 0x64, 0xa4, 0x45, 0x4c, 0x83,
-  0x34, 0x4a, 0x83, 0x46, 0xda, 0xa4, 0x4d, 0xda, 0xc4, 0x46, 0x46, 0x13,
-  0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x06, 0xc1, 0x4a, 0xe2, 0x88,
-  0x8f, 0x9d, 0xc4, 0x11, 0x1f, 0x4b, 0x89, 0x23, 0x3e, 0x06, 0x17, 0x3f,
-  0x22, 0x1f, 0x0b, 0x5c, 0x43, 0x3e, 0x26, 0xb8, 0x86, 0x7c, 0x6c, 0x70,
-  0x0d, 0xf9, 0xd8, 0x80, 0x17, 0xf1, 0xb1, 0x01, 0x2f, 0xe2, 0x63, 0x03,
-  0x5e, 0xc4, 0x67, 0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0x38, 0x7a, 0x01,
-  0x15, 0x1c, 0x71, 0x97, 0xd1, 0x84, 0x00, 0xb8, 0x60, 0x50, 0x16, 0xc8,
-  0x87, 0x7c, 0x46, 0x0c, 0x1e, 0x00, 0x04, 0xc1, 0xe0, 0xe1, 0x17, 0x54,
-  0x29, 0x93, 0x1f, 0x39, 0x0a, 0xc3, 0x4c, 0xfe, 0xe4, 0x4f, 0xfe, 0x24,
-  0x18, 0x4d, 0x08, 0x80, 0xd1, 0x04, 0x21, 0x18, 0x4d, 0x18, 0x04, 0xeb,
-  0x0b, 0x2f, 0x3e, 0x16, 0xc0, 0x86, 0x7c, 0x4c, 0x80, 0x0d, 0xf9, 0xd8,
-  0x00, 0x1b, 0xf2, 0xb1, 0x41, 0x0c, 0xe0, 0x63, 0xc3, 0x18, 0xc0, 0xc7,
-  0x06, 0x32, 0x80, 0x8f, 0x29, 0x83, 0x7c, 0x4c, 0x19, 0xe4, 0x63, 0xca,
-  0x20, 0x1f, 0xe3, 0xc4, 0x43, 0x3e, 0x16, 0x80, 0x81, 0x7c, 0xac, 0x1b,
-  0x0f, 0xf9, 0x58, 0x10, 0x06, 0xf2, 0x31, 0x8f, 0x3c, 0xe4, 0x63, 0x81,
-  0x18, 0xc8, 0xc7, 0x92, 0x02, 0x3e, 0x96, 0x10, 0xf0, 0xb1, 0x64, 0x80,
-  0x8f, 0x0d, 0x72, 0x20, 0x1f, 0x1b, 0xe6, 0x40, 0x3e, 0x36, 0xd0, 0x81,
-  0x7c, 0x6c, 0x60, 0x0b, 0xf8, 0xd8, 0xc0, 0x16, 0xf0, 0xb1, 0x81, 0x2d,
-  0xe0, 0x33, 0x4b, 0x40, 0x0d, 0x37, 0x80, 0x09, 0xcc, 0x80, 0xc1, 0x2c,
-  0x83, 0xa1, 0x04, 0x85, 0x27, 0x30, 0x03, 0x23, 0x06, 0x09, 0x00, 0x82,
-  0x60, 0x20, 0x06, 0x35, 0x13, 0x2e, 0xfd, 0x92, 0x32, 0x81, 0xbb, 0x8c,
-  0x18, 0x3c, 0x00, 0x08, 0x82, 0xc1, 0xf3, 0x33, 0xe7, 0x12, 0xf8, 0x49,
-  0x9d, 0xd0, 0x89, 0xa9, 0x98, 0x8a, 0xcc, 0xc8, 0xcc, 0xaf, 0x98, 0xca,
-  0x68, 0x42, 0x10, 0x14, 0x9e, 0xd0, 0x0c, 0x8c, 0x18, 0x24, 0x00, 0x08,
-  0x82, 0x81, 0x18, 0xe4, 0x4c, 0xb9, 0x84, 0x4c, 0xcb, 0x04, 0xf2, 0x32,
-  0x62, 0xf0, 0x00, 0x20, 0x08, 0x06, 0xcf, 0xd8, 0xac, 0x4b, 0x20, 0x2a,
-  0x79, 0x82, 0x27, 0xaa, 0xa2, 0x2a, 0x36, 0x63, 0x33, 0xe3, 0xa2, 0x2a,
-  0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x50, 0x7f,
-  0xa2, 0x33, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x62, 0xf0, 0x33,
-  0xeb, 0x72, 0x32, 0x33, 0x13, 0xe0, 0xcb, 0x88, 0xc1, 0x03, 0x80, 0x20,
-  0x18, 0x3c, 0x69, 0x13, 0x2f, 0x01, 0xaa, 0xfc, 0x89, 0x9f, 0xc0, 0x0a,
-  0xac, 0xf0, 0x0c, 0xcf, 0xa4, 0x0b, 0xac, 0x8c, 0x26, 0x04, 0xc0, 0x68,
-  0x82, 0x10, 0x54, 0xa9, 0xfc, 0x0c, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82,
-  0x81, 0x18, 0x90, 0x0d, 0xbc, 0xb0, 0x0c, 0xce, 0x04, 0xfd, 0x32, 0x62,
-  0xf0, 0x00, 0x20, 0x08, 0x06, 0x8f, 0xdb, 0xd8, 0x4b, 0xd0, 0x2a, 0xa4,
-  0x32, 0x2a, 0xb5, 0x52, 0x2b, 0x61, 0x13, 0x36, 0xee, 0x52, 0x2b, 0xa3,
-  0x09, 0x01, 0x50, 0xaa, 0x32, 0x36, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08,
-  0x06, 0x62, 0x80, 0x36, 0xf4, 0x02, 0x33, 0x3c, 0x13, 0x84, 0xcc, 0x88,
-  0xc1, 0x03, 0x80, 0x20, 0x18, 0x3c, 0x72, 0xa3, 0x2f, 0x41, 0xac, 0xa0,
-  0xca, 0xa9, 0xe4, 0x4a, 0xae, 0x94, 0x4d, 0xd9, 0xc8, 0x4b, 0xae, 0x8c,
-  0x26, 0x04, 0x80, 0x15, 0x85, 0x7c, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1,
-  0xa0, 0x8a, 0x1b, 0x91, 0x09, 0xd0, 0xc5, 0x98, 0x70, 0x91, 0x8f, 0x31,
-  0xe2, 0x22, 0x1f, 0x13, 0xc4, 0x05, 0x3e, 0x26, 0x8c, 0x0b, 0x7c, 0x4c,
-  0x10, 0xe4, 0x63, 0xe3, 0x12, 0xc4, 0xc7, 0x86, 0x41, 0x3e, 0x26, 0x04,
-  0xf1, 0x19, 0x31, 0x30, 0x00, 0x10, 0x04, 0x83, 0xa8, 0x6f, 0x44, 0x26,
-  0xb0, 0x83, 0x55, 0xe4, 0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x99,
-  0xde, 0x88, 0xcc, 0xc1, 0x2a, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18,
-  0x64, 0x7b, 0x33, 0x32, 0x03, 0xab, 0x04, 0xa6, 0xb0, 0x8a, 0x7c, 0x46,
-  0x0c, 0x10, 0x00, 0x04, 0xc1, 0x20, 0xeb, 0x9b, 0x92, 0x51, 0x58, 0x25,
-  0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0xcc, 0x6f, 0x4c, 0xc6, 0x60,
-  0x95, 0xc0, 0x1a, 0x56, 0x91, 0xcf, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18,
-  0x64, 0xa0, 0x83, 0x32, 0x0d, 0xab, 0x04, 0x23, 0x06, 0x08, 0x00, 0x82,
-  0x60, 0x90, 0x85, 0x4e, 0xca, 0x24, 0xac, 0x12, 0x8c, 0x18, 0x2c, 0x00,
-  0x08, 0x82, 0xc1, 0x64, 0x3a, 0x29, 0x73, 0x10, 0xc1, 0x41, 0x04, 0x23,
-  0x06, 0x06, 0x00, 0x82, 0x60, 0x10, 0xa1, 0xce, 0xcc, 0x04, 0x16, 0x24,
-  0xf2, 0x31, 0xe1, 0x90, 0x8f, 0x0d, 0x85, 0x7c, 0xac, 0x5e, 0xb4, 0xf8,
-  0x58, 0xa0, 0x06, 0xf2, 0x31, 0x41, 0x0d, 0xe4, 0x63, 0x83, 0x1a, 0xc8,
-  0xc7, 0xda, 0x00, 0x64, 0xe0, 0x63, 0x6d, 0x10, 0x32, 0xf0, 0xb1, 0x36,
-  0x10, 0x19, 0xf8, 0x58, 0x18, 0x0c, 0xf2, 0x31, 0x31, 0x18, 0xe4, 0x63,
-  0x63, 0x30, 0xc8, 0xc7, 0x86, 0x91, 0x81, 0x8f, 0x0d, 0x24, 0x03, 0x1f,
-  0x1b, 0x4a, 0x06, 0x3e, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xf0, 0xc9,
-  0xce, 0xcf, 0xe0, 0x8b, 0xd9, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10,
-  0x8c, 0x26, 0x0c, 0x82, 0x0d, 0xf2, 0x12, 0x1f, 0x1b, 0xe4, 0x25, 0x3e,
-  0x36, 0xc8, 0x4b, 0x7c, 0x46, 0x0c, 0x16, 0x00, 0x04, 0xc1, 0x60, 0xfa,
-  0x1d, 0xb1, 0x19, 0x84, 0x60, 0x10, 0x82, 0x11, 0x03, 0x03, 0x00, 0x41,
-  0x30, 0x88, 0xc2, 0x87, 0x6d, 0x02, 0x2b, 0x02, 0xf9, 0x58, 0x21, 0xc8,
-  0xc7, 0x8a, 0x41, 0x3e, 0x23, 0x06, 0x0b, 0x00, 0x82, 0x60, 0x30, 0x91,
-  0xcf, 0xd9, 0x70, 0x9b, 0x36, 0x08, 0xc1, 0x88, 0x81, 0x01, 0x80, 0x20,
-  0x18, 0x44, 0xe6, 0x93, 0x3b, 0xc1, 0x88, 0xc1, 0x03, 0x80, 0x20, 0x18,
-  0x3c, 0xe5, 0x13, 0x37, 0x2c, 0x93, 0x32, 0x41, 0x1e, 0xbc, 0xcc, 0xcb,
-  0xec, 0xce, 0xee, 0xa0, 0x4d, 0xcc, 0x8c, 0x26, 0x04, 0x81, 0xc9, 0x4c,
-  0x40, 0x1f, 0x0b, 0x6a, 0x06, 0x3e, 0x16, 0x54, 0xf2, 0x31, 0xa1, 0x92,
-  0x8f, 0x0d, 0x95, 0x7c, 0x6c, 0xb8, 0x19, 0xf8, 0xd8, 0x80, 0x33, 0xf0,
-  0xb1, 0x21, 0x67, 0xe0, 0x63, 0x23, 0x03, 0x32, 0xf4, 0xb1, 0x91, 0x09,
-  0x19, 0xfa, 0x98, 0x50, 0x36, 0xf2, 0xb1, 0xc0, 0x6c, 0xe0, 0x63, 0x03,
-  0xda, 0xc8, 0xc7, 0x82, 0xb4, 0x81, 0xcf, 0x88, 0xc1, 0x01, 0x80, 0x20,
-  0x18, 0x7c, 0xf0, 0xd3, 0x37, 0x36, 0xa3, 0x3e, 0xa3, 0x09, 0x81, 0x30,
-  0x62, 0x70, 0x00, 0x20, 0x08, 0x06, 0x9f, 0xfc, 0xfc, 0x0d, 0xce, 0x80,
-  0xcf, 0x68, 0x42, 0x20, 0xd8, 0xca, 0x04, 0xf1, 0xb1, 0x80, 0xa0, 0xcf,
-  0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x7c, 0xf6, 0x33, 0x3a, 0x3c, 0xc3,
-  0x3a, 0xa3, 0x09, 0xc1, 0x30, 0x9a, 0x20, 0x08, 0x66, 0x37, 0x44, 0x7c,
-  0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1, 0x20, 0x0a, 0xa1, 0xd4, 0x09, 0x2c,
-  0x18, 0xe4, 0x63, 0x41, 0x11, 0x9f, 0x0b, 0x08, 0x33, 0x62, 0x70, 0x00,
-  0x20, 0x08, 0x06, 0x57, 0x08, 0xd5, 0x4e, 0xd0, 0x3a, 0x27, 0x11, 0xe6,
-  0x22, 0xc2, 0x54, 0x30, 0x3f, 0x57, 0xc1, 0x00, 0x55, 0xc4, 0xcf, 0x95,
-  0x10, 0x80, 0xf5, 0xcd, 0x1d, 0xc4, 0xc7, 0xfc, 0x26, 0x0f, 0xe2, 0x63,
-  0x7f, 0xb3, 0x07, 0xf1, 0x99, 0x25, 0x38, 0x06, 0x2a, 0x06, 0x79, 0x33,
-  0xce, 0x03, 0x19, 0xa8, 0x18, 0xe8, 0xcd, 0x38, 0x0f, 0x64, 0xa0, 0x62,
-  0xb0, 0x37, 0xe3, 0x3c, 0x90, 0x81, 0x0a, 0x82, 0x05, 0x03, 0xe3, 0x3c,
-  0x90, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0x28, 0x03, 0x15, 0xd2, 0x9d,
-  0xbb, 0x41, 0x4e, 0x68, 0x34, 0x21, 0x00, 0x86, 0x1b, 0x86, 0x80, 0x0c,
-  0x66, 0x19, 0x90, 0x24, 0x28, 0xa2, 0x84, 0xae, 0x02, 0x11, 0x82, 0x11,
-  0x03, 0x04, 0x00, 0x41, 0x30, 0x28, 0x83, 0x17, 0xfa, 0x1d, 0xbe, 0x69,
-  0x82, 0xd1, 0x84, 0x00, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0x33,
-  0x80, 0xa1, 0xf0, 0xe9, 0x9b, 0xc0, 0x85, 0x46, 0x13, 0x02, 0x60, 0x34,
-  0x41, 0x08, 0x46, 0x13, 0x06, 0x61, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c,
-  0xce, 0x80, 0x86, 0xca, 0x27, 0x74, 0x0a, 0x18, 0x1a, 0x4d, 0x08, 0x80,
-  0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0x38, 0x03, 0x1b, 0x3a, 0x9f, 0xd1,
-  0x39, 0xda, 0x67, 0x34, 0x21, 0x00, 0x46, 0x13, 0x84, 0x60, 0x34, 0x61,
-  0x10, 0x2c, 0xc9, 0x9b, 0xf8, 0x58, 0x92, 0x37, 0xf1, 0xb1, 0x24, 0x6f,
-  0xe2, 0x63, 0xc3, 0x20, 0x1f, 0x1b, 0x06, 0xf9, 0x98, 0x10, 0xc0, 0xc7,
-  0x08, 0x42, 0x3e, 0x26, 0x04, 0xf0, 0x19, 0x31, 0x30, 0x00, 0x10, 0x04,
-  0x83, 0x88, 0x8d, 0xe2, 0x27, 0xb0, 0x24, 0xa0, 0x8f, 0x25, 0x02, 0x7d,
-  0x2c, 0x19, 0xe8, 0x63, 0x83, 0x2b, 0xc0, 0xc7, 0x06, 0x57, 0x80, 0x8f,
-  0x0d, 0xae, 0x00, 0x9f, 0x11, 0x83, 0x05, 0x00, 0x41, 0x30, 0x98, 0xe4,
-  0xa8, 0x7e, 0x06, 0x21, 0x18, 0x84, 0x60, 0xc4, 0xc0, 0x00, 0x40, 0x10,
-  0x0c, 0x22, 0x3a, 0xfa, 0x9f, 0xc0, 0x82, 0x42, 0x3e, 0x26, 0x14, 0xf2,
-  0xb1, 0xa1, 0x90, 0xcf, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18, 0x4c, 0x77,
-  0xa4, 0x3f, 0xef, 0xe0, 0x0e, 0xed, 0x30, 0x08, 0xc1, 0x88, 0x81, 0x01,
-  0x80, 0x20, 0x18, 0x44, 0x79, 0x04, 0x46, 0xc1, 0x88, 0xc1, 0x02, 0x80,
-  0x20, 0x18, 0x4c, 0x79, 0xc4, 0x3f, 0xf1, 0x00, 0x0f, 0xef, 0xd0, 0x30,
-  0xcb, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x7b, 0x24, 0x46, 0xc1,
-  0x88, 0xc1, 0x02, 0x80, 0x20, 0x18, 0x4c, 0x7b, 0xe4, 0x3f, 0xba, 0x90,
-  0x0b, 0xb8, 0x70, 0x18, 0xc5, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44,
-  0x7d, 0x44, 0x46, 0x81, 0x9d, 0x4f, 0x10, 0x9f, 0x11, 0x03, 0x03, 0x00,
-  0x41, 0x30, 0x88, 0xfe, 0xe8, 0x84, 0x02, 0x0b, 0xdc, 0x47, 0x3e, 0x23,
-  0x06, 0x06, 0x00, 0x82, 0x60, 0x10, 0x85, 0x52, 0x0b, 0x05, 0x16, 0xd0,
-  0x81, 0x7c, 0x4c, 0xb0, 0x03, 0xf9, 0xd8, 0x80, 0x07, 0xf2, 0xb1, 0xe1,
-  0x1d, 0xe0, 0x63, 0xc3, 0x3b, 0xc0, 0xc7, 0x86, 0x77, 0x80, 0x8f, 0xd1,
-  0x04, 0x4d, 0xc8, 0xc7, 0x02, 0xfa, 0x81, 0x8f, 0x45, 0x91, 0x7c, 0x2c,
-  0x10, 0xe4, 0x63, 0x41, 0xfd, 0xc0, 0xc7, 0x82, 0x40, 0x3e, 0x16, 0x94,
-  0x90, 0x7c, 0xec, 0x08, 0xe8, 0x63, 0xf9, 0x83, 0xc4, 0xc7, 0xd6, 0x61,
-  0x1d, 0xe4, 0x63, 0x81, 0x20, 0x1f, 0x0b, 0x16, 0xf8, 0x8c, 0x18, 0x18,
-  0x00, 0x08, 0x82, 0x41, 0x44, 0x4b, 0x39, 0x14, 0x58, 0xa0, 0xc9, 0xc7,
-  0xb6, 0x4d, 0x3e, 0x16, 0x1c, 0xf2, 0xb1, 0x00, 0x82, 0xcf, 0x88, 0x81,
-  0x01, 0x80, 0x20, 0x18, 0x44, 0xb9, 0xe4, 0x43, 0x81, 0x05, 0xf4, 0x20,
-  0x1f, 0x0b, 0x0c, 0xf8, 0x58, 0x0c, 0x05, 0xf4, 0xb1, 0xc0, 0x91, 0x8f,
-  0x65, 0xf0, 0x20, 0x1f, 0x0b, 0x04, 0xf9, 0x98, 0x16, 0x0f, 0xf2, 0xb1,
-  0x80, 0x90, 0x8f, 0x6d, 0xf2, 0x20, 0x1f, 0x0b, 0x0c, 0xf9, 0xd8, 0x4d,
-  0xcc, 0x90, 0x7c, 0xec, 0x26, 0x68, 0x48, 0x3e, 0x76, 0x13, 0x35, 0x24,
-  0x1f, 0x83, 0x21, 0x31, 0x88, 0x8f, 0xc5, 0x90, 0x18, 0xc4, 0xc7, 0x64,
-  0x48, 0x0c, 0xe2, 0x63, 0xc6, 0x20, 0x1f, 0x33, 0x06, 0xf9, 0x98, 0x31,
-  0xc8, 0xc7, 0x9c, 0x01, 0x3e, 0xd6, 0x0c, 0xf0, 0x31, 0x66, 0x80, 0x8f,
-  0x91, 0x42, 0x2c, 0xd0, 0xc7, 0x82, 0x40, 0x3e, 0x16, 0x04, 0xf2, 0x31,
-  0x1e, 0x0a, 0xe2, 0x33, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06, 0x11, 0x3d,
-  0xed, 0x52, 0x60, 0x41, 0x20, 0x1f, 0x53, 0x05, 0x55, 0x90, 0x8f, 0x05,
-  0x60, 0x04, 0x1f, 0x1b, 0x02, 0xfa, 0x98, 0x1f, 0xe0, 0x82, 0x7c, 0x2c,
-  0x10, 0xe4, 0x63, 0x81, 0x23, 0x1f, 0x0b, 0x05, 0x5d, 0x90, 0x8f, 0x05,
-  0x85, 0x7c, 0x2c, 0x80, 0xe4, 0x63, 0xa4, 0xc0, 0x0b, 0xf2, 0xb1, 0x00,
-  0x91, 0x8f, 0x05, 0x92, 0x7c, 0xec, 0x98, 0x07, 0xf8, 0x58, 0x31, 0x0f,
-  0xf0, 0xb1, 0x61, 0x1e, 0xe0, 0x53, 0xf3, 0xa0, 0x4f, 0x30, 0x4b, 0x70,
-  0x8c, 0x26, 0xa0, 0x07, 0x30, 0x9a, 0x90, 0x1e, 0xc2, 0x68, 0xc2, 0x6e,
-  0x04, 0xa3, 0x09, 0x62, 0x01, 0xd8, 0x1c, 0x91, 0x45, 0x7c, 0x46, 0x0c,
-  0x0c, 0x00, 0x04, 0xc1, 0x20, 0x5a, 0xa9, 0x59, 0x0a, 0x2c, 0xd0, 0x23,
-  0xf9, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0xd4, 0x52, 0xb9, 0x14,
-  0x58, 0x00, 0x12, 0xf2, 0x31, 0x41, 0x24, 0xe4, 0x63, 0x03, 0x49, 0xc8,
-  0x67, 0xc4, 0xe0, 0x01, 0x40, 0x10, 0x0c, 0x9e, 0x97, 0xda, 0xa5, 0x3b,
-  0x92, 0x23, 0xd4, 0x30, 0x8d, 0xd3, 0xc8, 0x23, 0x59, 0x92, 0x25, 0x59,
-  0xda, 0xa3, 0xd1, 0x84, 0x00, 0x18, 0x4d, 0x10, 0x82, 0xd1, 0x84, 0x41,
-  0xb0, 0x93, 0x38, 0xe2, 0x63, 0x29, 0x71, 0xc4, 0xc7, 0x56, 0xe2, 0x88,
-  0x8f, 0xc9, 0x05, 0x29, 0xc9, 0xc7, 0x02, 0xd8, 0x90, 0x8f, 0x09, 0xb0,
-  0x21, 0x1f, 0x1b, 0x60, 0x43, 0x3e, 0x36, 0xe8, 0x45, 0x7c, 0x6c, 0xd0,
-  0x8b, 0xf8, 0xd8, 0xa0, 0x17, 0xf1, 0x19, 0x31, 0x38, 0x00, 0x10, 0x04,
-  0x03, 0x2e, 0xa7, 0xca, 0xa9, 0x8f, 0x66, 0x6a, 0x34, 0x21, 0x00, 0x2e,
-  0x18, 0x94, 0x05, 0xf4, 0x21, 0x9f, 0x11, 0x83, 0x07, 0x00, 0x41, 0x30,
-  0x78, 0xc2, 0xaa, 0x9d, 0x54, 0x89, 0x94, 0x8e, 0xc2, 0x58, 0x25, 0x72,
-  0x22, 0x27, 0x72, 0x0a, 0x46, 0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46,
-  0x13, 0x06, 0xc1, 0xfe, 0xc2, 0x8b, 0x8f, 0x05, 0xb2, 0x21, 0x1f, 0x13,
-  0x64, 0x43, 0x3e, 0x36, 0xc8, 0x86, 0x7c, 0x6c, 0x10, 0x03, 0xf8, 0xd8,
-  0x30, 0x06, 0xf0, 0xb1, 0x81, 0x0c, 0xe0, 0x63, 0xca, 0x20, 0x1f, 0x53,
-  0x06, 0xf9, 0x98, 0x32, 0xc8, 0xc7, 0x38, 0xf2, 0x90, 0x8f, 0x05, 0x60,
-  0x20, 0x1f, 0xeb, 0xca, 0x43, 0x3e, 0x16, 0x84, 0x81, 0x7c, 0xcc, 0x33,
-  0x0f, 0xf9, 0x58, 0x20, 0x06, 0xf2, 0xb1, 0xa4, 0x80, 0x8f, 0x25, 0x04,
-  0x7c, 0x2c, 0x19, 0xe0, 0x63, 0x83, 0x1c, 0xc8, 0xc7, 0x86, 0x39, 0x90,
-  0x8f, 0x0d, 0x74, 0x20, 0x1f, 0x73, 0x8b, 0x3b, 0x80, 0x8f, 0x05, 0x04,
-  0x7c, 0xec, 0x2d, 0xc0, 0x04, 0x3e, 0x16, 0x14, 0xf0, 0x31, 0xb8, 0xd0,
-  0x03, 0xf8, 0x58, 0x60, 0xc0, 0x67, 0x96, 0x80, 0x1a, 0x6e, 0x40, 0x25,
-  0xb9, 0x02, 0x83, 0x59, 0x86, 0xe5, 0x09, 0x8a, 0x97, 0xf0, 0x0a, 0x46,
-  0x0c, 0x12, 0x00, 0x04, 0xc1, 0x40, 0x0c, 0xfa, 0x2a, 0xa5, 0xca, 0x2a,
-  0xae, 0x02, 0x9b, 0x1a, 0x31, 0x78, 0x00, 0x10, 0x04, 0x83, 0xe7, 0xb4,
-  0x5e, 0x2a, 0x30, 0xa7, 0x5e, 0xe2, 0x25, 0x77, 0x72, 0x27, 0xbd, 0xd2,
-  0xab, 0x93, 0x72, 0xa7, 0xd1, 0x84, 0x00, 0x18, 0x4d, 0x10, 0x82, 0xd1,
-  0x84, 0x41, 0xa8, 0x71, 0xf2, 0x2b, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04,
-  0x03, 0x31, 0x18, 0xad, 0x97, 0x5a, 0xab, 0xbb, 0x0a, 0x78, 0x6a, 0xc4,
-  0xe0, 0x01, 0x40, 0x10, 0x0c, 0x9e, 0xd6, 0xaa, 0xa9, 0x80, 0x9d, 0xc6,
-  0x49, 0x9c, 0xe8, 0x89, 0x9e, 0x40, 0x0b, 0xb4, 0x5a, 0x8a, 0x9e, 0x46,
-  0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x2a, 0x9d, 0x46, 0x0b, 0x46, 0x0c,
-  0x12, 0x00, 0x04, 0xc1, 0x40, 0x0c, 0x50, 0x8b, 0xa6, 0xe0, 0x8a, 0xaf,
-  0x82, 0xb0, 0x1a, 0x31, 0x78, 0x00, 0x10, 0x04, 0x83, 0x47, 0xb6, 0x74,
-  0x2a, 0x88, 0x27, 0x74, 0x3a, 0xa7, 0x7c, 0xca, 0xa7, 0xd2, 0x2a, 0x2d,
-  0x99, 0xca, 0xa7, 0xd1, 0x84, 0x00, 0x28, 0x77, 0x3a, 0x2d, 0x18, 0x31,
-  0x48, 0x00, 0x10, 0x04, 0x03, 0x31, 0x60, 0x2d, 0x9c, 0xa2, 0x2b, 0xd0,
-  0x0a, 0xca, 0x6a, 0xc4, 0xe0, 0x01, 0x40, 0x10, 0x0c, 0x1e, 0xdb, 0xf2,
-  0xa9, 0xa0, 0x9e, 0xd8, 0x69, 0x9d, 0xfa, 0xa9, 0x9f, 0x52, 0x2b, 0xb5,
-  0x6c, 0xaa, 0x9f, 0x46, 0x13, 0x02, 0xa0, 0xe6, 0x69, 0xb5, 0x60, 0xc4,
-  0x20, 0x01, 0x40, 0x10, 0x0c, 0xc4, 0x00, 0xb6, 0x78, 0x0a, 0xaf, 0x48,
-  0x2b, 0x48, 0xab, 0x11, 0x83, 0x07, 0x00, 0x41, 0x30, 0x78, 0x74, 0x4b,
-  0xac, 0x82, 0x7c, 0x82, 0xa7, 0x77, 0x0a, 0xa9, 0x90, 0x6a, 0xad, 0xd6,
-  0xd2, 0xa9, 0x90, 0x1a, 0x4d, 0x08, 0x80, 0xd1, 0x04, 0x21, 0x18, 0x4d,
-  0x18, 0x84, 0xd1, 0x04, 0x62, 0x30, 0x86, 0x91, 0xcf, 0x88, 0xc1, 0x01,
-  0x80, 0x20, 0x18, 0x54, 0xbc, 0xd5, 0x56, 0xc1, 0x4c, 0x19, 0x41, 0xc8,
-  0x67, 0xc4, 0xe0, 0x00, 0x40, 0x10, 0x0c, 0x2a, 0xdf, 0x7a, 0xab, 0xa0,
-  0xa6, 0xac, 0x72, 0x29, 0xf9, 0x58, 0xf5, 0x52, 0xf2, 0x31, 0xe1, 0xa5,
-  0xe0, 0x63, 0x02, 0x4c, 0xc1, 0xc7, 0x04, 0x41, 0x3e, 0x06, 0x53, 0x41,
-  0x7c, 0x6c, 0x18, 0xe4, 0x63, 0x42, 0x10, 0x9f, 0x11, 0x03, 0x03, 0x00,
-  0x41, 0x30, 0x88, 0xd4, 0xeb, 0xad, 0x02, 0x3b, 0xf2, 0x49, 0x3e, 0x23,
-  0x06, 0x08, 0x00, 0x82, 0x60, 0x90, 0x9d, 0xd7, 0x5b, 0x1d, 0xf9, 0x14,
-  0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0x86, 0x5e, 0x70, 0x35, 0xe4,
-  0x53, 0x60, 0x4a, 0x3e, 0xc9, 0x67, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c,
-  0x32, 0xf5, 0x92, 0x2b, 0x25, 0x9f, 0x82, 0x11, 0x03, 0x04, 0x00, 0x41,
-  0x30, 0xc8, 0xd6, 0x6b, 0xae, 0x8c, 0x7c, 0x0a, 0xac, 0xc9, 0x27, 0xf9,
-  0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0xd6, 0x5e, 0x75, 0xd5, 0xe4,
-  0x53, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x99, 0x7b, 0xd9, 0x55,
-  0x92, 0x4f, 0xc1, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18, 0x4c, 0xf3, 0x65,
-  0x57, 0x07, 0x11, 0x1c, 0x44, 0x30, 0x62, 0x60, 0x00, 0x20, 0x08, 0x06,
-  0x51, 0x7d, 0x81, 0x56, 0x60, 0x41, 0x22, 0x1f, 0x13, 0x0e, 0xf9, 0xd8,
-  0x50, 0xc8, 0xc7, 0xbe, 0xb2, 0x92, 0x8f, 0x7d, 0x66, 0x25, 0x1f, 0x13,
-  0xcc, 0x0a, 0x3e, 0x26, 0x9c, 0x15, 0x7c, 0x4c, 0x10, 0xe4, 0x63, 0x67,
-  0x15, 0xc4, 0xc7, 0x86, 0x41, 0x3e, 0x26, 0x04, 0xf1, 0x19, 0x31, 0x30,
-  0x00, 0x10, 0x04, 0x83, 0x28, 0xc4, 0x4c, 0x2b, 0xb0, 0x03, 0xa6, 0xe4,
-  0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x99, 0x7f, 0x99, 0xd6, 0x01,
-  0x53, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x64, 0xff, 0x75, 0x5a,
-  0x03, 0x4c, 0x05, 0xa6, 0xc0, 0x94, 0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04,
-  0xc1, 0x20, 0x0b, 0xb1, 0xd4, 0x52, 0x60, 0x2a, 0x18, 0x31, 0x40, 0x00,
-  0x10, 0x04, 0x83, 0x4c, 0xc4, 0x54, 0xcb, 0x80, 0xa9, 0xc0, 0x1a, 0x98,
-  0x92, 0xcf, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x64, 0x24, 0xc6, 0x5a,
-  0x0d, 0x4c, 0x05, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x90, 0x95, 0x58,
-  0x6b, 0x25, 0x30, 0x15, 0x8c, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1, 0xa4,
-  0x62, 0xad, 0x75, 0x10, 0xc1, 0x41, 0x04, 0x23, 0x06, 0x06, 0x00, 0x82,
-  0x60, 0x10, 0xb1, 0xd8, 0x6d, 0x05, 0x16, 0x24, 0xf2, 0x31, 0xe1, 0x90,
-  0x8f, 0x0d, 0x85, 0x7c, 0x2c, 0xaf, 0xf4, 0x20, 0x3e, 0x16, 0xa8, 0x82,
-  0x7c, 0x4c, 0x50, 0x05, 0xf9, 0xd8, 0xa0, 0x0a, 0xf2, 0xb1, 0x56, 0x20,
-  0x2d, 0xf8, 0x58, 0x2b, 0x94, 0x16, 0x7c, 0xac, 0x15, 0x4c, 0x0b, 0x3e,
-  0x16, 0x0a, 0x83, 0x7c, 0x4c, 0x14, 0x06, 0xf9, 0xd8, 0x28, 0x0c, 0xf2,
-  0xb1, 0xe1, 0xb4, 0xe0, 0x63, 0x03, 0x6a, 0xc1, 0xc7, 0x86, 0xd4, 0x82,
-  0xcf, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x3d, 0x26, 0x5e, 0xc3,
-  0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x3e, 0x36, 0x5e, 0xc3, 0x88,
-  0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x3f, 0x46, 0x5e, 0x83, 0x0d, 0xae,
-  0x25, 0x1f, 0x1b, 0x5e, 0x4b, 0x3e, 0x36, 0xc0, 0x96, 0x7c, 0x8c, 0xb5,
-  0x86, 0xf8, 0x58, 0x6b, 0x0d, 0xf1, 0x31, 0xd7, 0x1a, 0xe2, 0x63, 0xb4,
-  0x95, 0xc4, 0xc7, 0x6a, 0x2b, 0x89, 0x8f, 0xd9, 0x56, 0x12, 0x1f, 0x33,
-  0x0c, 0xf9, 0x98, 0x61, 0xc8, 0xc7, 0x0c, 0x43, 0x3e, 0x66, 0x18, 0xf2,
-  0x31, 0xc3, 0x90, 0x8f, 0x19, 0x86, 0x7c, 0xcc, 0x18, 0xe8, 0x63, 0xc6,
-  0x40, 0x1f, 0x33, 0x06, 0xfa, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1,
-  0xb7, 0x66, 0xf8, 0x15, 0x5b, 0xff, 0x35, 0x9a, 0x10, 0x00, 0xa3, 0x09,
-  0x42, 0x30, 0x9a, 0x30, 0x08, 0x36, 0xac, 0x56, 0x7c, 0x6c, 0x58, 0xad,
-  0xf8, 0xd8, 0xb0, 0x5a, 0xf1, 0x19, 0x31, 0x58, 0x00, 0x10, 0x04, 0x83,
-  0x09, 0xcf, 0xf6, 0x6b, 0x10, 0x82, 0x41, 0x08, 0x46, 0x0c, 0x0c, 0x00,
-  0x04, 0xc1, 0x20, 0xd2, 0xb3, 0x12, 0x0b, 0xac, 0x08, 0xe4, 0x63, 0x85,
-  0x20, 0x1f, 0x2b, 0x06, 0xf9, 0x8c, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1,
-  0xd4, 0x67, 0x20, 0x86, 0x0a, 0xa7, 0x60, 0x0a, 0x83, 0x10, 0x8c, 0x18,
-  0x18, 0x00, 0x08, 0x82, 0x41, 0xf4, 0x67, 0x72, 0x16, 0x8c, 0x18, 0x2c,
-  0x00, 0x08, 0x82, 0xc1, 0xf4, 0x67, 0x22, 0x36, 0x07, 0x72, 0x10, 0x07,
-  0x05, 0x31, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0x14, 0x6a, 0x74,
-  0x16, 0x8c, 0x18, 0x3c, 0x00, 0x08, 0x82, 0xc1, 0x03, 0x6a, 0x2c, 0x76,
-  0x5e, 0xe4, 0x35, 0xc0, 0x83, 0x7a, 0xa9, 0x97, 0x9d, 0xd9, 0xd9, 0x88,
-  0xb1, 0xd7, 0x68, 0x42, 0x10, 0x8c, 0x18, 0x3c, 0x00, 0x08, 0x82, 0xc1,
-  0x23, 0x6a, 0x2e, 0x96, 0x5e, 0xe6, 0x35, 0xa0, 0x03, 0x7b, 0xb1, 0x17,
-  0x9e, 0xe1, 0x59, 0x89, 0xb9, 0xd7, 0x68, 0x42, 0x10, 0xd8, 0x7b, 0x0d,
-  0xf4, 0xb1, 0x40, 0xbe, 0xe0, 0x63, 0x41, 0x26, 0x1f, 0x13, 0x32, 0xf9,
-  0xd8, 0x90, 0xc9, 0xc7, 0x06, 0xfa, 0x82, 0x8f, 0x0d, 0xf5, 0x05, 0x1f,
-  0x1b, 0xec, 0x0b, 0x3e, 0xb6, 0x5f, 0x09, 0x7d, 0x2c, 0x00, 0x31, 0xf8,
-  0x98, 0x78, 0xfd, 0x16, 0x7d, 0x4c, 0xbc, 0xc0, 0x8b, 0x3e, 0x26, 0x90,
-  0x98, 0x7c, 0x2c, 0x28, 0x31, 0xf8, 0xd8, 0x70, 0x62, 0xf2, 0xb1, 0x00,
-  0xc5, 0xe0, 0x33, 0x62, 0x70, 0x00, 0x20, 0x08, 0x06, 0xdf, 0xab, 0xf1,
-  0x58, 0x7d, 0xa5, 0xda, 0x68, 0x42, 0x20, 0x8c, 0x18, 0x1c, 0x00, 0x08,
-  0x82, 0xc1, 0x17, 0x6b, 0x3e, 0x76, 0x5f, 0x7f, 0x36, 0x9a, 0x10, 0x08,
-  0xa6, 0x5e, 0x41, 0x7c, 0x2c, 0x20, 0xe8, 0x33, 0x62, 0x70, 0x00, 0x20,
-  0x08, 0x06, 0x5f, 0xad, 0x89, 0xd9, 0x7e, 0xad, 0xd9, 0x68, 0x42, 0x30,
-  0x8c, 0x26, 0x08, 0x82, 0xd5, 0x18, 0x11, 0x9f, 0x11, 0x03, 0x03, 0x00,
-  0x41, 0x30, 0x88, 0xc0, 0x0d, 0xcd, 0x02, 0x0b, 0x06, 0xf9, 0x58, 0x50,
-  0xc4, 0xe7, 0x02, 0xc2, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0xc1, 0x05,
-  0x6e, 0x74, 0x16, 0xb0, 0xd9, 0x49, 0x84, 0xb9, 0x88, 0x30, 0x15, 0xc8,
-  0xda, 0x55, 0x30, 0x40, 0x15, 0xb0, 0x76, 0x25, 0x04, 0x60, 0x34, 0xa6,
-  0x07, 0xf1, 0xb1, 0x1a, 0xe3, 0x83, 0xf8, 0x98, 0x8d, 0xf9, 0x41, 0x7c,
-  0x66, 0x09, 0x98, 0x81, 0x8a, 0x01, 0x8e, 0x83, 0x25, 0x4e, 0x9a, 0x81,
-  0x8a, 0x41, 0x8e, 0x83, 0x25, 0x4e, 0x9a, 0x81, 0x8a, 0x81, 0x8e, 0x83,
-  0x25, 0x4e, 0x9a, 0x81, 0x0a, 0x42, 0xb5, 0x83, 0x25, 0x4e, 0x9a, 0x11,
-  0x03, 0x04, 0x00, 0x41, 0x30, 0x28, 0x83, 0x74, 0xcb, 0x33, 0x1b, 0x43,
-  0xcc, 0x6d, 0x34, 0x21, 0x00, 0x86, 0x1b, 0x86, 0x80, 0x0c, 0x66, 0x19,
-  0x1a, 0x27, 0x28, 0x82, 0xdc, 0xae, 0x82, 0x70, 0x83, 0x11, 0x03, 0x04,
-  0x00, 0x41, 0x30, 0x28, 0x03, 0x77, 0xf3, 0xb3, 0x1d, 0x6b, 0x82, 0xd1,
-  0x84, 0x00, 0x18, 0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0x33, 0x78, 0x37,
-  0x50, 0xe3, 0xb1, 0xa0, 0xdd, 0x46, 0x13, 0x02, 0x60, 0x34, 0x41, 0x08,
-  0x46, 0x13, 0x06, 0x61, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0xce, 0x60,
-  0xde, 0x48, 0x0d, 0xcc, 0x8a, 0x77, 0x1b, 0x4d, 0x08, 0x80, 0x11, 0x03,
-  0x04, 0x00, 0x41, 0x30, 0x38, 0x83, 0x7a, 0x33, 0x35, 0x31, 0x3b, 0x58,
-  0x6d, 0x34, 0x21, 0x00, 0x46, 0x13, 0x84, 0x60, 0x34, 0x61, 0x10, 0x2c,
-  0xc1, 0xb1, 0xf8, 0x58, 0x82, 0x63, 0xf1, 0xb1, 0x04, 0xc7, 0xe2, 0x63,
-  0xc3, 0x20, 0x1f, 0x1b, 0x06, 0xf9, 0x98, 0x10, 0xc0, 0xc7, 0x08, 0x42,
-  0x3e, 0x26, 0x04, 0xf0, 0x19, 0x31, 0x30, 0x00, 0x10, 0x04, 0x83, 0x68,
-  0xe5, 0x60, 0x2d, 0xb0, 0x24, 0xa0, 0x8f, 0x25, 0x02, 0x7d, 0x2c, 0x19,
-  0xe8, 0x63, 0x03, 0x2d, 0xc0, 0xc7, 0x06, 0x5a, 0x80, 0x8f, 0x0d, 0xb4,
-  0x00, 0x9f, 0x11, 0x83, 0x05, 0x00, 0x41, 0x30, 0x98, 0x62, 0x8e, 0xd6,
-  0x06, 0x21, 0x18, 0x84, 0x60, 0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0xa2,
-  0x99, 0xf3, 0xb5, 0xc0, 0x82, 0x42, 0x3e, 0x26, 0x14, 0xf2, 0xb1, 0xa1,
-  0x90, 0xcf, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18, 0x4c, 0x36, 0x97, 0x6b,
-  0x61, 0x01, 0x16, 0x3f, 0x31, 0x08, 0xc1, 0x88, 0x81, 0x01, 0x80, 0x20,
-  0x18, 0x44, 0x38, 0xf7, 0x6f, 0xc1, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18,
-  0x4c, 0x38, 0xb7, 0x6b, 0x63, 0x21, 0x16, 0x61, 0xd1, 0x30, 0xcb, 0x88,
-  0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x3a, 0x17, 0x72, 0xc1, 0x88, 0xc1,
-  0x02, 0x80, 0x20, 0x18, 0x4c, 0x3a, 0xd7, 0x6b, 0xe0, 0xf0, 0x0b, 0xbe,
-  0x70, 0x18, 0xc5, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x3c, 0x37,
-  0x72, 0xc1, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18, 0x4c, 0x3c, 0xf7, 0x6b,
-  0x30, 0xf1, 0x12, 0x2e, 0x91, 0x20, 0xc7, 0x88, 0x81, 0x01, 0x80, 0x20,
-  0x18, 0x44, 0x3e, 0x57, 0x72, 0xc1, 0x88, 0xc1, 0x02, 0x80, 0x20, 0x18,
-  0x4c, 0x3e, 0x17, 0x6e, 0x32, 0x11, 0x13, 0x30, 0x31, 0x49, 0xd1, 0x88,
-  0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x60, 0x77, 0x72, 0x81, 0xa9, 0x5a,
-  0x11, 0x9f, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 0x88, 0xc4, 0x4e, 0xdd,
-  0x02, 0x0b, 0x62, 0x4d, 0x3e, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60, 0x10,
-  0x91, 0x1d, 0xbc, 0x05, 0x16, 0xe0, 0x81, 0x7c, 0x4c, 0xd0, 0x03, 0xf9,
-  0xd8, 0xc0, 0x07, 0xf2, 0xb1, 0x21, 0x1f, 0xe0, 0x63, 0x43, 0x3e, 0xc0,
-  0xc7, 0x86, 0x7c, 0x80, 0x8f, 0xb1, 0x06, 0x6b, 0xc8, 0xc7, 0x82, 0x5b,
-  0x83, 0x8f, 0x55, 0x95, 0x7c, 0x2c, 0x10, 0xe4, 0x63, 0x01, 0xae, 0xc1,
-  0xc7, 0x82, 0x40, 0x3e, 0x16, 0xa0, 0x9b, 0x7c, 0xec, 0x08, 0xe8, 0x63,
-  0xbc, 0x86, 0xc4, 0xc7, 0xea, 0xa1, 0x1e, 0xe4, 0x63, 0x81, 0x20, 0x1f,
-  0x0b, 0x16, 0xf8, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0x74, 0x77,
-  0xfc, 0x16, 0x58, 0xe0, 0xc9, 0xc7, 0xbe, 0x4f, 0x3e, 0x16, 0x1c, 0xf2,
-  0xb1, 0x00, 0x82, 0xcf, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0x7c,
-  0x17, 0x72, 0x81, 0x05, 0xfe, 0x20, 0x1f, 0x0b, 0x0c, 0xf8, 0x18, 0xbd,
-  0x05, 0xf4, 0xb1, 0xc0, 0x91, 0x8f, 0x65, 0xf6, 0x20, 0x1f, 0x0b, 0x04,
-  0xf9, 0x98, 0x76, 0x0f, 0xf2, 0xb1, 0x80, 0x90, 0x8f, 0x6d, 0xf8, 0x20,
-  0x1f, 0x0b, 0x0c, 0xf9, 0x98, 0x5d, 0xd8, 0x9b, 0x7c, 0xcc, 0x2e, 0xee,
-  0x4d, 0x3e, 0x66, 0x17, 0xf8, 0x26, 0x1f, 0x9b, 0x37, 0x31, 0x88, 0x8f,
-  0xd1, 0x9b, 0x18, 0xc4, 0xc7, 0xea, 0x4d, 0x0c, 0xe2, 0x63, 0xc6, 0x20,
-  0x1f, 0x33, 0x06, 0xf9, 0x98, 0x31, 0xc8, 0xc7, 0x9c, 0x01, 0x3e, 0xd6,
-  0x0c, 0xf0, 0x31, 0x66, 0x80, 0x8f, 0xbd, 0x01, 0xc9, 0xc9, 0xc7, 0x82,
-  0x90, 0x83, 0x8f, 0x05, 0xf8, 0x21, 0x1f, 0xab, 0x8f, 0xfa, 0x90, 0x8f,
-  0x05, 0x22, 0x07, 0x1f, 0xd3, 0x03, 0x3d, 0x90, 0x8f, 0x05, 0x82, 0x7c,
-  0x2c, 0x18, 0x39, 0xf8, 0x58, 0x10, 0xc8, 0xc7, 0x82, 0x99, 0x93, 0x8f,
-  0x1d, 0x01, 0x7d, 0xec, 0xe4, 0x90, 0xf8, 0x98, 0x4f, 0xf8, 0x84, 0x7c,
-  0x2c, 0x10, 0xe4, 0x63, 0xc1, 0x02, 0x9f, 0x11, 0x03, 0x03, 0x00, 0x41,
-  0x30, 0x88, 0xc4, 0xef, 0xec, 0x02, 0x0b, 0x46, 0x41, 0x3e, 0x46, 0x0a,
-  0xa4, 0x20, 0x1f, 0x0b, 0x0e, 0xf9, 0x58, 0x00, 0xc1, 0x67, 0xc4, 0xc0,
-  0x00, 0x40, 0x10, 0x0c, 0xa2, 0xf3, 0x63, 0xbb, 0xc0, 0x82, 0xb3, 0x90,
-  0x8f, 0x05, 0x06, 0x7c, 0xec, 0xe7, 0x02, 0xfa, 0x18, 0xcd, 0x59, 0xf1,
-  0xb1, 0x70, 0x70, 0x07, 0xfa, 0x58, 0x10, 0xc8, 0xc7, 0x82, 0x40, 0x3e,
-  0x86, 0x73, 0x41, 0x7c, 0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1, 0x20, 0x82,
-  0xbf, 0xdb, 0x0b, 0x2c, 0x08, 0xe4, 0x63, 0xe7, 0x70, 0x0e, 0xf2, 0xb1,
-  0x80, 0xe7, 0xe0, 0x63, 0x43, 0x40, 0x1f, 0x0b, 0xea, 0x41, 0x3e, 0x26,
-  0xd4, 0x83, 0x7c, 0x6c, 0xa8, 0x07, 0xf9, 0x58, 0xe3, 0x0b, 0xf2, 0xb1,
-  0x20, 0x0d, 0xe4, 0x63, 0x42, 0x1a, 0xc8, 0xc7, 0x86, 0x34, 0x90, 0x8f,
-  0xf1, 0x42, 0x5b, 0xc8, 0xc7, 0x02, 0x30, 0x90, 0x8f, 0x05, 0x69, 0x20,
-  0x1f, 0x0b, 0x2a, 0xf9, 0x58, 0x70, 0xc0, 0xc7, 0x84, 0x03, 0x3e, 0x36,
-  0x1c, 0xf0, 0x31, 0x67, 0x90, 0x8f, 0x39, 0x83, 0x7c, 0xcc, 0x19, 0xe4,
-  0x63, 0x03, 0x4e, 0xc0, 0xc7, 0x06, 0x9c, 0x80, 0x8f, 0x0d, 0x38, 0x01,
-  0x9f, 0xc2, 0x09, 0xff, 0x83, 0x59, 0x02, 0x66, 0x34, 0x21, 0x4f, 0x82,
-  0xd1, 0x84, 0xd4, 0x00, 0x46, 0x13, 0x50, 0x03, 0x30, 0xbb, 0x73, 0x8d,
-  0xf8, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0xe4, 0x82, 0x81, 0xed,
-  0x05, 0x16, 0xf4, 0x9d, 0x7c, 0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1, 0x20,
-  0x82, 0xc1, 0x80, 0xf7, 0x02, 0x0b, 0xc8, 0x42, 0x3e, 0x26, 0x98, 0x85,
-  0x7c, 0x6c, 0x40, 0x0b, 0xf9, 0x8c, 0x18, 0x3c, 0x00, 0x08, 0x82, 0xc1,
-  0x23, 0x83, 0x81, 0xef, 0xe9, 0x5d, 0xdd, 0xf9, 0x08, 0x8f, 0xf4, 0x08,
-  0xdf, 0xd5, 0x5e, 0xed, 0xd5, 0x9e, 0xdf, 0x8d, 0x26, 0x04, 0xc0, 0x68,
-  0x82, 0x10, 0x8c, 0x26, 0x0c, 0x82, 0xad, 0xc5, 0x11, 0x1f, 0x6b, 0x8b,
-  0x23, 0x3e, 0xf6, 0x16, 0x47, 0x7c, 0x8c, 0x37, 0x4e, 0x4f, 0x3e, 0x16,
-  0x98, 0x89, 0x7c, 0x4c, 0x30, 0x13, 0xf9, 0xd8, 0x60, 0x26, 0xf2, 0xb1,
-  0x81, 0x3c, 0xe2, 0x63, 0x03, 0x79, 0xc4, 0xc7, 0x06, 0xf2, 0x88, 0xcf,
-  0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x70, 0x3c, 0x18, 0xa0, 0x1f, 0xe8,
-  0xd9, 0x60, 0x30, 0x9a, 0x10, 0x00, 0x17, 0x0c, 0xca, 0x82, 0x59, 0x91,
-  0xcf, 0x88, 0xc1, 0x03, 0x80, 0x20, 0x18, 0x3c, 0x64, 0x18, 0xc0, 0x5f,
-  0xeb, 0x9d, 0xde, 0x51, 0x18, 0xae, 0x77, 0x7e, 0xe7, 0x77, 0x7e, 0xc1,
-  0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0xd8, 0x79,
-  0x7c, 0xf1, 0xb1, 0x80, 0x3f, 0xe4, 0x63, 0x02, 0x7f, 0xc8, 0xc7, 0x06,
-  0xfe, 0x90, 0x8f, 0x0d, 0x63, 0x00, 0x1f, 0x1b, 0xc8, 0x00, 0x3e, 0x36,
-  0x94, 0x01, 0x7c, 0x4c, 0x19, 0xe4, 0x63, 0xca, 0x20, 0x1f, 0x53, 0x06,
-  0xf9, 0x58, 0xef, 0xcd, 0x47, 0x7c, 0x46, 0x0c, 0x0c, 0x00, 0x04, 0xc1,
-  0x20, 0xaa, 0xc3, 0xa0, 0xff, 0x02, 0x0b, 0xc8, 0x4f, 0x3e, 0x23, 0x06,
-  0x06, 0x00, 0x82, 0x60, 0x10, 0xdd, 0x61, 0x30, 0x82, 0x41, 0x60, 0x41,
-  0xfa, 0xc9, 0xc7, 0x02, 0xf3, 0x83, 0x8f, 0x05, 0xbd, 0x22, 0x1f, 0xd3,
-  0x8f, 0xf3, 0x93, 0x8f, 0x05, 0x6f, 0x22, 0x1f, 0x13, 0xde, 0x44, 0x3e,
-  0x36, 0xbc, 0x89, 0x7c, 0x6c, 0x20, 0x91, 0xf8, 0xd8, 0x40, 0x22, 0xf1,
-  0xb1, 0x81, 0x44, 0xe2, 0x63, 0x9e, 0xb9, 0xc8, 0x67, 0xc4, 0xe0, 0x01,
-  0x40, 0x10, 0x0c, 0x9e, 0x50, 0x0c, 0x5a, 0x30, 0x50, 0x3f, 0xf2, 0x23,
-  0x84, 0x61, 0xfd, 0x48, 0x30, 0x20, 0xc1, 0x80, 0x04, 0x83, 0x60, 0x34,
-  0x21, 0x00, 0x46, 0x13, 0x84, 0x60, 0x34, 0x61, 0x10, 0x4c, 0x44, 0xf6,
-  0x20, 0x3e, 0x16, 0xd4, 0x9f, 0x7c, 0x2c, 0xe8, 0x03, 0xf8, 0x98, 0x11,
-  0xc8, 0xc7, 0x0c, 0x41, 0x3e, 0x66, 0x0c, 0xf2, 0x31, 0xfb, 0x9b, 0xe2,
-  0x63, 0x76, 0xd0, 0x27, 0xf2, 0xb1, 0x40, 0x0f, 0xe4, 0x63, 0x77, 0xe0,
-  0x27, 0xf2, 0xb1, 0x60, 0x0f, 0xe4, 0x63, 0x78, 0xf0, 0x27, 0xf2, 0xb1,
-  0x80, 0x0f, 0xe4, 0x63, 0x63, 0x50, 0xc0, 0xc7, 0xc6, 0x80, 0x80, 0x8f,
-  0x8d, 0xc1, 0x00, 0x1f, 0x1b, 0x5a, 0x41, 0x3e, 0x16, 0x2c, 0xf2, 0x31,
-  0xe2, 0x15, 0xe4, 0x63, 0x41, 0x23, 0x1f, 0x2b, 0x62, 0x41, 0x3e, 0x16,
-  0x3c, 0xf2, 0xb1, 0xe2, 0x3d, 0xe0, 0x63, 0xc4, 0x7b, 0xc0, 0xc7, 0x86,
-  0xf7, 0x80, 0x8f, 0x0d, 0x16, 0x7c, 0x6c, 0xb0, 0xe0, 0x63, 0x83, 0x05,
-  0x9f, 0x59, 0x02, 0x6a, 0xb8, 0x01, 0xfd, 0x60, 0x31, 0x00, 0x83, 0x59,
-  0x06, 0x88, 0x0a, 0x8a, 0xff, 0x70, 0x31, 0x80, 0x11, 0x83, 0x04, 0x00,
-  0x41, 0x30, 0x10, 0x83, 0x5e, 0x0c, 0xd2, 0x30, 0x28, 0xc5, 0x20, 0x16,
-  0x83, 0xc0, 0x0e, 0x83, 0x11, 0x83, 0x07, 0x00, 0x41, 0x30, 0x78, 0xce,
-  0x31, 0x78, 0xc3, 0x20, 0x30, 0xc1, 0xa0, 0xff, 0xf8, 0xcf, 0x05, 0x03,
-  0x17, 0x0c, 0x74, 0x31, 0xd0, 0xc5, 0xe0, 0x0c, 0x03, 0x17, 0x0c, 0x46,
-  0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x06, 0xa1, 0x46, 0x30,
-  0xf0, 0xc5, 0x00, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x40, 0x0c, 0xc6,
-  0x31, 0x78, 0xc3, 0x60, 0x15, 0x83, 0x5b, 0x0c, 0x02, 0x3e, 0x0c, 0x46,
-  0x0c, 0x1e, 0x00, 0x04, 0xc1, 0xe0, 0x69, 0xc7, 0xa0, 0x0e, 0x83, 0x80,
-  0x05, 0x83, 0x11, 0x0c, 0x44, 0x30, 0xa0, 0xc1, 0x80, 0x06, 0x03, 0x70,
-  0x0c, 0xc0, 0x31, 0x68, 0xc3, 0x80, 0x06, 0x83, 0xd1, 0x84, 0x00, 0x18,
-  0x4d, 0x10, 0x82, 0x4a, 0xc1, 0x60, 0x1c, 0x03, 0x18, 0x31, 0x48, 0x00,
-  0x10, 0x04, 0x03, 0x31, 0x40, 0xc7, 0x80, 0x0e, 0x03, 0x58, 0x0c, 0x78,
-  0x31, 0x08, 0x42, 0x31, 0x18, 0x31, 0x78, 0x00, 0x10, 0x04, 0x83, 0x47,
-  0x1e, 0x03, 0x3d, 0x0c, 0x82, 0x18, 0x0c, 0x50, 0x30, 0x38, 0xc1, 0x20,
-  0x07, 0x83, 0x1c, 0x0c, 0xca, 0x31, 0x28, 0xc7, 0x40, 0x0e, 0x83, 0x1c,
-  0x0c, 0x46, 0x13, 0x02, 0xa0, 0x5e, 0x30, 0x38, 0xc7, 0x00, 0x46, 0x0c,
-  0x12, 0x00, 0x04, 0xc1, 0x40, 0x0c, 0xd8, 0x31, 0xc0, 0xc3, 0x80, 0x16,
-  0x03, 0x70, 0x0c, 0x82, 0x52, 0x0c, 0x46, 0x0c, 0x1e, 0x00, 0x04, 0xc1,
-  0xe0, 0xb1, 0xc7, 0xc0, 0x0f, 0x83, 0xa0, 0x06, 0x03, 0x16, 0x0c, 0x56,
-  0x30, 0xe8, 0xc1, 0xa0, 0x07, 0x83, 0x74, 0x0c, 0xd2, 0x31, 0xb0, 0xc3,
-  0xa0, 0x07, 0x83, 0xd1, 0x84, 0x00, 0x18, 0x4d, 0x10, 0x82, 0xd1, 0x84,
-  0x41, 0xb0, 0xe3, 0x90, 0xcf, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18, 0x54,
-  0xf7, 0x18, 0xa0, 0x62, 0x10, 0xb8, 0x61, 0x60, 0xce, 0x19, 0x06, 0xf2,
-  0x31, 0x07, 0x0d, 0x03, 0xf9, 0x98, 0x80, 0x86, 0x01, 0x7c, 0x4c, 0x48,
-  0xc3, 0x00, 0x3e, 0x26, 0x08, 0xf2, 0xb1, 0x34, 0x0c, 0x82, 0xf8, 0xd8,
-  0x30, 0xc8, 0xc7, 0x84, 0x20, 0x3e, 0x23, 0x06, 0x06, 0x00, 0x82, 0x60,
-  0x10, 0x8d, 0x64, 0x80, 0x8a, 0x41, 0x60, 0x87, 0x0c, 0x06, 0xf2, 0x19,
-  0x31, 0x40, 0x00, 0x10, 0x04, 0x83, 0x0c, 0x24, 0x03, 0x54, 0x0c, 0x0e,
-  0x19, 0x0c, 0x82, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xc8, 0x42, 0x32,
-  0x48, 0xc5, 0x60, 0x90, 0xc1, 0x20, 0x30, 0x45, 0x06, 0x03, 0xf9, 0x8c,
-  0x18, 0x20, 0x00, 0x08, 0x82, 0x41, 0x36, 0x92, 0xc1, 0x2a, 0x06, 0x8a,
-  0x0c, 0x06, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x64, 0x24, 0x19,
-  0xb0, 0x62, 0x60, 0xc8, 0x60, 0x10, 0x58, 0x23, 0x83, 0x81, 0x7c, 0x46,
-  0x0c, 0x10, 0x00, 0x04, 0xc1, 0x20, 0x33, 0xc9, 0xc0, 0x15, 0x83, 0x46,
-  0x06, 0x83, 0x60, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0xb2, 0x93, 0x0c,
-  0x5e, 0x31, 0x48, 0x64, 0x30, 0x08, 0x46, 0x0c, 0x16, 0x00, 0x04, 0xc1,
-  0x60, 0x62, 0xc9, 0xe0, 0x15, 0x83, 0x83, 0x08, 0x0e, 0x22, 0x18, 0x31,
-  0x30, 0x00, 0x10, 0x04, 0x83, 0xc8, 0x25, 0x83, 0x5c, 0x0c, 0x02, 0x0b,
-  0x12, 0xf9, 0x98, 0x70, 0xc8, 0xc7, 0x86, 0x42, 0x3e, 0x23, 0x06, 0x07,
-  0x00, 0x82, 0x60, 0xf0, 0xad, 0x64, 0x80, 0x8b, 0x41, 0x1c, 0x06, 0xbf,
-  0x18, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0x82,
-  0x0d, 0x6b, 0x18, 0xc4, 0xc7, 0x86, 0x35, 0x0c, 0xe2, 0x63, 0xc3, 0x1a,
-  0x06, 0xf1, 0x19, 0x31, 0x58, 0x00, 0x10, 0x04, 0x83, 0x09, 0x27, 0x83,
-  0x5d, 0x0c, 0x06, 0x21, 0x18, 0x84, 0x60, 0xc4, 0xc0, 0x00, 0x40, 0x10,
-  0x0c, 0x22, 0x9d, 0x0c, 0xca, 0x31, 0x08, 0xac, 0x08, 0xe4, 0x63, 0x85,
-  0x20, 0x1f, 0x2b, 0x06, 0xf9, 0x8c, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1,
-  0xd4, 0x93, 0x01, 0x38, 0x06, 0x8f, 0xd3, 0x0c, 0x42, 0x30, 0x62, 0x60,
-  0x00, 0x20, 0x08, 0x06, 0xd1, 0x4f, 0x06, 0x32, 0x19, 0x04, 0x26, 0x87,
-  0xc1, 0x1b, 0x06, 0xf4, 0x31, 0x39, 0x0c, 0xe0, 0x30, 0xa0, 0x8f, 0x09,
-  0xb4, 0x18, 0xc8, 0xc7, 0x82, 0x5a, 0x0c, 0xe0, 0x63, 0xc3, 0x2d, 0x06,
-  0xf2, 0xb1, 0x00, 0x17, 0x03, 0xf8, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82,
-  0xc1, 0xf7, 0x93, 0x01, 0x3b, 0x06, 0xa5, 0x18, 0xe4, 0x64, 0x30, 0x9a,
-  0x10, 0x08, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xf0, 0x85, 0x65, 0xe0,
-  0x8e, 0xc1, 0x29, 0x06, 0x2f, 0x19, 0x8c, 0x26, 0x04, 0x82, 0xe9, 0x61,
-  0x10, 0xc4, 0xc7, 0x02, 0x82, 0x3e, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60,
-  0xf0, 0x95, 0x65, 0x20, 0x8f, 0xc1, 0x2a, 0x06, 0xfb, 0x18, 0x8c, 0x26,
-  0x04, 0xc3, 0x68, 0x82, 0x20, 0x58, 0x39, 0x06, 0x44, 0x7c, 0x46, 0x0c,
-  0x0c, 0x00, 0x04, 0xc1, 0x20, 0x82, 0xcb, 0x00, 0x1f, 0x83, 0xc0, 0x82,
-  0x41, 0x3e, 0x16, 0x14, 0xf1, 0xb9, 0x80, 0x30, 0x23, 0x06, 0x07, 0x00,
-  0x82, 0x60, 0x70, 0xc1, 0x65, 0x40, 0x92, 0x41, 0xc0, 0x8f, 0xc1, 0x49,
-  0x84, 0xb9, 0x88, 0x30, 0x15, 0x88, 0x65, 0x70, 0x15, 0x0c, 0x50, 0x05,
-  0x58, 0x06, 0x57, 0x42, 0x00, 0xb3, 0x04, 0xd1, 0x40, 0xc5, 0xa0, 0x9a,
-  0x02, 0xf4, 0x16, 0xd2, 0x40, 0xc5, 0xc0, 0x9a, 0x02, 0xf4, 0x16, 0xd2,
-  0x40, 0xc5, 0xe0, 0x9a, 0x02, 0xf4, 0x16, 0xd2, 0x40, 0x05, 0x41, 0xae,
-  0x02, 0xf4, 0x16, 0xd2, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x94, 0x81,
-  0x5d, 0x06, 0x26, 0x19, 0x8c, 0x63, 0x50, 0xcc, 0x65, 0x30, 0x9a, 0x10,
-  0x00, 0xc3, 0x0d, 0x43, 0x40, 0x06, 0xb3, 0x0c, 0xd2, 0x14, 0x14, 0x11,
-  0x97, 0xc1, 0x55, 0xe0, 0x96, 0x01, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82,
-  0x41, 0x19, 0xec, 0x65, 0xb0, 0x92, 0x01, 0x3a, 0x06, 0x4a, 0x30, 0x9a,
-  0x10, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x70, 0x06, 0x7c, 0x19,
-  0xb4, 0x64, 0x90, 0x8e, 0x41, 0xa0, 0x97, 0xc1, 0x68, 0x42, 0x00, 0x8c,
-  0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82,
-  0xc1, 0x19, 0x80, 0x66, 0x10, 0x93, 0x41, 0x3b, 0x06, 0x05, 0x5f, 0x06,
-  0xa3, 0x09, 0x01, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x67, 0x20,
-  0x9a, 0xc1, 0x4c, 0x06, 0xef, 0x18, 0x1c, 0x39, 0x19, 0x8c, 0x26, 0x04,
-  0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0x82, 0x25, 0xe5, 0x18, 0xc4,
-  0xc7, 0x92, 0x72, 0x0c, 0xe2, 0x63, 0x49, 0x39, 0x06, 0xf1, 0xb1, 0x61,
-  0x90, 0x8f, 0x0d, 0x83, 0x7c, 0x4c, 0x08, 0xe0, 0x63, 0x04, 0x21, 0x1f,
-  0x13, 0x02, 0xf8, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0x84, 0x9b,
-  0x41, 0x4f, 0x06, 0x81, 0x25, 0x01, 0x7d, 0x2c, 0x11, 0xe8, 0x63, 0xc9,
-  0x40, 0x1f, 0x1b, 0x42, 0x01, 0x3e, 0x36, 0x84, 0x02, 0x7c, 0x6c, 0x08,
-  0x05, 0xf8, 0x8c, 0x18, 0x2c, 0x00, 0x08, 0x82, 0xc1, 0xe4, 0x9b, 0x41,
-  0x58, 0x06, 0x83, 0x10, 0x0c, 0x42, 0x30, 0x62, 0x60, 0x00, 0x20, 0x08,
-  0x06, 0x11, 0x78, 0x06, 0x6b, 0x19, 0x04, 0x16, 0x14, 0xf2, 0x31, 0xa1,
-  0x90, 0x8f, 0x0d, 0x85, 0x7c, 0x46, 0x0c, 0x16, 0x00, 0x04, 0xc1, 0x60,
-  0x1a, 0xcf, 0xc0, 0x2c, 0x83, 0x5a, 0xa0, 0x85, 0x59, 0x18, 0x84, 0x60,
-  0xc4, 0xc0, 0x00, 0x40, 0x10, 0x0c, 0xa2, 0xf2, 0x0c, 0x58, 0x33, 0x08,
-  0x46, 0x0c, 0x16, 0x00, 0x04, 0xc1, 0x60, 0x2a, 0xcf, 0x00, 0x2d, 0x83,
-  0x5b, 0xb0, 0x85, 0x5a, 0x68, 0x98, 0x65, 0xc4, 0xc0, 0x00, 0x40, 0x10,
-  0x0c, 0xa2, 0xf3, 0x0c, 0x5c, 0x33, 0x08, 0x2c, 0x26, 0x03, 0x77, 0xa0,
-  0x8f, 0x05, 0x35, 0x19, 0xc0, 0xc7, 0x84, 0x9f, 0x0c, 0xe4, 0x63, 0x86,
-  0x21, 0x1f, 0xab, 0xc9, 0x20, 0x88, 0xcf, 0x88, 0x81, 0x01, 0x80, 0x20,
-  0x18, 0x44, 0xed, 0x19, 0xd4, 0x65, 0x10, 0x18, 0x11, 0xc8, 0x67, 0xc4,
-  0xc0, 0x00, 0x40, 0x10, 0x0c, 0xa2, 0xf7, 0x0c, 0xf6, 0x32, 0x08, 0x2c,
-  0x89, 0x05, 0xf8, 0x98, 0x22, 0x0b, 0xf2, 0x31, 0x21, 0x88, 0x8f, 0xb5,
-  0x65, 0x10, 0xd0, 0xc7, 0x96, 0xb6, 0x0c, 0xe4, 0x63, 0x81, 0x21, 0x1f,
-  0x0b, 0x06, 0xf9, 0x58, 0x10, 0x12, 0xf2, 0x31, 0x21, 0x24, 0xe4, 0x63,
-  0x43, 0x48, 0xc8, 0xc7, 0x66, 0x22, 0x2d, 0x03, 0xf9, 0xd8, 0x4c, 0xa8,
-  0x65, 0x20, 0x1f, 0x9b, 0x89, 0xb5, 0x0c, 0xe4, 0x63, 0xc6, 0x00, 0x1f,
-  0x33, 0x06, 0xf8, 0x98, 0x31, 0xc0, 0xc7, 0xd0, 0xa0, 0x0e, 0xe8, 0x63,
-  0x41, 0x20, 0x1f, 0x0b, 0x02, 0xf9, 0x18, 0x5b, 0x06, 0x41, 0x7c, 0x46,
-  0x0c, 0x0c, 0x00, 0x04, 0xc1, 0x20, 0x22, 0xd1, 0x60, 0x3d, 0x83, 0xc0,
-  0x82, 0x40, 0x3e, 0xe6, 0x06, 0x6e, 0x20, 0x1f, 0x0b, 0xe0, 0x32, 0x80,
-  0x8f, 0x0d, 0x01, 0x7d, 0x4c, 0x0c, 0xf8, 0x40, 0x3e, 0x16, 0x08, 0xf2,
-  0xb1, 0xc0, 0x91, 0x8f, 0x95, 0x81, 0x1f, 0xc8, 0xc7, 0x82, 0x42, 0x3e,
-  0x16, 0x40, 0xf2, 0x31, 0x34, 0x00, 0x05, 0xf9, 0x58, 0x80, 0xc8, 0xc7,
-  0x02, 0x49, 0x3e, 0x76, 0xdc, 0x02, 0x7c, 0xac, 0xb8, 0x05, 0xf8, 0xd8,
-  0x70, 0x0b, 0xf0, 0xa9, 0x5b, 0x50, 0xd1, 0x00, 0x66, 0x09, 0xa2, 0xd1,
-  0x84, 0xb2, 0x08, 0x46, 0x0c, 0x1e, 0x00, 0x04, 0xc1, 0xe0, 0xa9, 0xd1,
-  0x20, 0x3c, 0x83, 0xbe, 0x0c, 0xf0, 0x32, 0x40, 0x09, 0x93, 0x38, 0x89,
-  0xbf, 0x0c, 0x70, 0x33, 0xc0, 0xcd, 0x00, 0x37, 0x83, 0xd0, 0x0c, 0x46,
-  0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x06, 0xc1, 0x06, 0xba,
-  0x90, 0x8f, 0x0d, 0x74, 0x21, 0x1f, 0x1b, 0xe8, 0x42, 0x3e, 0xf6, 0x0f,
-  0xaa, 0x19, 0xc8, 0xc7, 0x02, 0x98, 0x90, 0x8f, 0x09, 0x30, 0x21, 0x1f,
-  0x1b, 0x60, 0x42, 0x3e, 0x36, 0x9c, 0x44, 0x7c, 0x6c, 0x38, 0x89, 0xf8,
-  0xd8, 0x70, 0x12, 0xf1, 0x19, 0x31, 0x38, 0x00, 0x10, 0x04, 0x03, 0xee,
-  0x47, 0x83, 0xf5, 0x0c, 0x46, 0x33, 0xc8, 0xd1, 0x60, 0x34, 0x21, 0x00,
-  0x2e, 0x18, 0x94, 0x05, 0x76, 0x21, 0x9f, 0x11, 0x83, 0x07, 0x00, 0x41,
-  0x30, 0x78, 0xce, 0x34, 0x98, 0xcf, 0x00, 0x36, 0x03, 0xd5, 0x0c, 0x8e,
-  0xc2, 0x88, 0xcd, 0x40, 0x3d, 0x03, 0xf5, 0x0c, 0xd4, 0x33, 0x08, 0x46,
-  0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x06, 0x61, 0xc4, 0xe0,
-  0x01, 0x40, 0x10, 0x0c, 0x9e, 0x35, 0x0d, 0xee, 0x33, 0x90, 0xcd, 0xe0,
-  0x35, 0x03, 0x97, 0xd8, 0x8b, 0xda, 0x0c, 0x6a, 0x33, 0x08, 0xd3, 0x20,
-  0x4c, 0x03, 0xf7, 0x0c, 0x6e, 0x33, 0x18, 0x4d, 0x08, 0x04, 0x2b, 0xf2,
-  0x42, 0x3e, 0x16, 0x08, 0xf2, 0x31, 0x43, 0x2f, 0xe4, 0x63, 0x01, 0x21,
-  0x1f, 0x3b, 0xf6, 0x42, 0x3e, 0x16, 0x18, 0xf2, 0xb1, 0x42, 0x83, 0x8f,
-  0x11, 0x1a, 0x7c, 0x6c, 0xd0, 0xe0, 0x63, 0x83, 0x18, 0xc8, 0xc7, 0x86,
-  0x31, 0x90, 0x8f, 0x0d, 0x64, 0x20, 0x1f, 0x1b, 0x40, 0x02, 0x3e, 0x36,
-  0x80, 0x04, 0x7c, 0x6c, 0x00, 0x09, 0xf8, 0xcc, 0x12, 0x50, 0x03, 0x2d,
-  0x03, 0xab, 0x07, 0x04, 0x88, 0x06, 0x09, 0xdf, 0x38, 0xc6, 0x04, 0xbb,
-  0xc2, 0x33, 0xd0, 0x32, 0xb0, 0x7a, 0x40, 0xf8, 0x67, 0x90, 0xf0, 0x8d,
-  0x63, 0x4c, 0xb2, 0x2b, 0x3c, 0x03, 0x2d, 0x03, 0xab, 0x07, 0x04, 0x7f,
-  0x06, 0x09, 0xdf, 0x38, 0xc6, 0x44, 0xbb, 0xc2, 0x63, 0x43, 0x7e, 0x06,
-  0xf2, 0xb1, 0x41, 0x3f, 0x03, 0xf9, 0xd8, 0xb0, 0x9f, 0x81, 0x7c, 0xcc,
-  0x20, 0xd1, 0x40, 0x3e, 0x66, 0x94, 0x68, 0x20, 0x1f, 0x33, 0x4c, 0x34,
-  0x90, 0x8f, 0x0d, 0x26, 0x1a, 0xc0, 0xc7, 0x86, 0x13, 0x0d, 0xe0, 0x63,
-  0x03, 0x8a, 0x06, 0xf0, 0xb1, 0x21, 0x91, 0x8f, 0x0d, 0x89, 0x7c, 0x6c,
-  0x48, 0xe4, 0x63, 0xcf, 0x8a, 0x06, 0xf2, 0xb1, 0x87, 0x45, 0x03, 0xf9,
-  0xd8, 0xd3, 0xa2, 0x81, 0x7c, 0x6c, 0x68, 0xd1, 0x00, 0x3e, 0x36, 0xb8,
-  0x68, 0x00, 0x1f, 0x1b, 0x5e, 0x34, 0x80, 0x8f, 0x0d, 0x92, 0x7c, 0x6c,
-  0x90, 0xe4, 0x63, 0x83, 0x24, 0x1f, 0x1b, 0x64, 0x34, 0x80, 0x8f, 0x0d,
-  0x33, 0x1a, 0xc0, 0xc7, 0x06, 0x1a, 0x0d, 0xe0, 0x63, 0xcf, 0x40, 0x1f,
-  0x7b, 0x06, 0xfa, 0xd8, 0x33, 0xd0, 0x67, 0xc4, 0xc0, 0x00, 0x40, 0x10,
-  0x0c, 0x22, 0x5e, 0x0d, 0x46, 0x35, 0x18, 0x46, 0x0c, 0x0c, 0x00, 0x04,
-  0xc1, 0x20, 0xea, 0xd5, 0x80, 0x54, 0x83, 0x61, 0xc4, 0xc0, 0x00, 0x40,
-  0x10, 0x0c, 0x22, 0x5f, 0x0d, 0x4a, 0x35, 0x18, 0x46, 0x0c, 0x0c, 0x00,
-  0x04, 0xc1, 0x20, 0xfa, 0xd5, 0xe0, 0x4c, 0x83, 0x61, 0xc4, 0xc0, 0x00,
-  0x40, 0x10, 0x0c, 0x22, 0x70, 0x0d, 0xd0, 0x34, 0x18, 0x46, 0x0c, 0x0c,
-  0x00, 0x04, 0xc1, 0x20, 0x0a, 0xd7, 0x20, 0x4d, 0x83, 0xc1, 0x86, 0x1e,
-  0x0d, 0xe4, 0x63, 0x83, 0x8f, 0x06, 0xf2, 0xb1, 0xe1, 0x47, 0x03, 0xf9,
-  0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0x54, 0xae, 0x41, 0x9c, 0x06,
-  0xc3, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18, 0x44, 0xe6, 0x1a, 0xc8, 0x69,
-  0x30, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0x41, 0x74, 0xae, 0xc1, 0x9c,
-  0x06, 0xc3, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 0xea, 0x1a, 0xd0,
-  0x6a, 0xc0, 0xab, 0x01, 0xaf, 0x06, 0xa8, 0x1a, 0x0c, 0x23, 0x06, 0x09,
-  0x00, 0x82, 0x60, 0xa0, 0xa8, 0x6b, 0x40, 0xab, 0x01, 0xaf, 0x06, 0xbc,
-  0x1a, 0x94, 0x6a, 0x20, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xa2,
-  0xae, 0x01, 0xad, 0x06, 0xbc, 0x1a, 0xf0, 0x6a, 0x70, 0xaa, 0x41, 0x30,
-  0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x8a, 0xba, 0x06, 0xb4, 0x1a, 0xf0,
-  0x6a, 0xc0, 0xab, 0x81, 0xaa, 0x06, 0x31, 0x1a, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00
-};
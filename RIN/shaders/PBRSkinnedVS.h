@@ -1,1859 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; POSITION                 0   xyz         0     NONE   float   xyz 
-; NORMAL                   0   xyzw        1     NONE   float   xyzw
-; TANGENT                  0   xyzw        2     NONE   float   xyzw
-; BLENDINDICES             0   xyzw        3     NONE    uint   xyzw
-; BLENDWEIGHTS             0   xyzw        4     NONE   float   xyzw
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float   xyzw
-; POSITION                 0   xyzw        1     NONE   float   xyzw
-; POSITION                 1   xyz         2     NONE   float   xyz 
-; TBN_MATRIX               0   xyz         3     NONE   float   xyz 
-; TBN_MATRIX               1   xyz         4     NONE   float   xyz 
-; TBN_MATRIX               2   xyz         5     NONE   float   xyz 
-; TEXCOORD                 0   xy          6     NONE   float   xy  
-; MATERIAL                 0   x           7     NONE    uint   x   
-; MATERIAL                 1    y          7     NONE    uint    y  
-; MATERIAL                 2     z         7     NONE    uint     z 
-; MATERIAL                 3      w        7     NONE    uint      w
-; MATERIAL                 4   x           8     NONE    uint   x   
-; MATERIAL                 5    y          8     NONE    uint    y  
-; OBJECT_FLAGS             0     z         8     NONE    uint     z 
-;
-; shader hash: 5ee3b97a43ec6ff579ebf597deabf658
-;
-; Pipeline Runtime Information: 
-;
-; Vertex Shader
-; OutputPositionPresent=1
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; POSITION                 0                              
-; NORMAL                   0                              
-; TANGENT                  0                              
-; BLENDINDICES             0                              
-; BLENDWEIGHTS             0                              
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; POSITION                 0                 linear       
-; POSITION                 1                 linear       
-; TBN_MATRIX               0                 linear       
-; TEXCOORD                 0                 linear       
-; MATERIAL                 0        nointerpolation       
-; MATERIAL                 1        nointerpolation       
-; MATERIAL                 2        nointerpolation       
-; MATERIAL                 3        nointerpolation       
-; MATERIAL                 4        nointerpolation       
-; MATERIAL                 5        nointerpolation       
-; OBJECT_FLAGS             0        nointerpolation       
-;
-; Buffer Definitions:
-;
-; cbuffer rootConstants
-; {
-;
-;   struct rootConstants
-;   {
-;
-;       struct struct.RootConstants
-;       {
-;
-;           uint objectID;                            ; Offset:    0
-;       
-;       } rootConstants;                              ; Offset:    0
-;
-;   
-;   } rootConstants;                                  ; Offset:    0 Size:     4
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for skinnedObjectBuffer
-; {
-;
-;   struct struct.SkinnedObject
-;   {
-;
-;       struct struct.BoundingSphere
-;       {
-;
-;           float3 center;                            ; Offset:    0
-;           float radius;                             ; Offset:   12
-;       
-;       } boundingSphere;                             ; Offset:    0
-;
-;       struct struct.LOD
-;       {
-;
-;           uint startIndex;                          ; Offset:   16
-;           uint indexCount;                          ; Offset:   20
-;           uint vertexOffset;                        ; Offset:   24
-;       
-;       } lods[3];;                                   ; Offset:   16
-;
-;       struct struct.Material
-;       {
-;
-;           uint baseColorID;                         ; Offset:   52
-;           uint normalID;                            ; Offset:   56
-;           uint roughnessAOID;                       ; Offset:   60
-;           uint metallicID;                          ; Offset:   64
-;           uint heightID;                            ; Offset:   68
-;           uint specialID;                           ; Offset:   72
-;       
-;       } material;                                   ; Offset:   52
-;
-;       uint boneIndex;                               ; Offset:   76
-;       uint flags;                                   ; Offset:   80
-;       float3 padding;                               ; Offset:   84
-;   
-;   } $Element;                                       ; Offset:    0 Size:    96
-;
-; }
-;
-; Resource bind info for boneBuffer
-; {
-;
-;   struct dx.alignment.legacy.struct.Bone
-;   {
-;
-;       column_major float4x4 worldMatrix;            ; Offset:    0
-;       column_major float4x4 invWorldMatrix;         ; Offset:   64
-;   
-;   } $Element;                                       ; Offset:    0 Size:   128
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; rootConstants                     cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; skinnedObjectBuffer               texture  struct         r/o      T0             t0     1
-; boneBuffer                        texture  struct         r/o      T1             t1     1
-;
-;
-; ViewId state:
-;
-; Number of inputs: 20, outputs: 35
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 1 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 2 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 3 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 4 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 5 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 6 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 7 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 8 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 9 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 10 depends on inputs: { 0, 1, 2, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 12 depends on inputs: { 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 13 depends on inputs: { 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 14 depends on inputs: { 4, 5, 6, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 16 depends on inputs: { 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 17 depends on inputs: { 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 18 depends on inputs: { 4, 5, 6, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 20 depends on inputs: { 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 21 depends on inputs: { 4, 5, 6, 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 22 depends on inputs: { 4, 5, 6, 12, 13, 14, 15, 16, 17, 18, 19 }
-;   output 24 depends on inputs: { 7 }
-;   output 25 depends on inputs: { 11 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%"class.StructuredBuffer<SkinnedObject>" = type { %struct.SkinnedObject }
-%struct.SkinnedObject = type { %struct.BoundingSphere, [3 x %struct.LOD], %struct.Material, i32, i32, <3 x float> }
-%struct.BoundingSphere = type { <3 x float>, float }
-%struct.LOD = type { i32, i32, i32 }
-%struct.Material = type { i32, i32, i32, i32, i32, i32 }
-%"dx.alignment.legacy.class.StructuredBuffer<Bone>" = type { %dx.alignment.legacy.struct.Bone }
-%dx.alignment.legacy.struct.Bone = type { [4 x <4 x float>], [4 x <4 x float>] }
-%rootConstants = type { %struct.RootConstants }
-%struct.RootConstants = type { i32 }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %5 = call float @dx.op.loadInput.f32(i32 4, i32 4, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %6 = call float @dx.op.loadInput.f32(i32 4, i32 4, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %7 = call float @dx.op.loadInput.f32(i32 4, i32 4, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %8 = call float @dx.op.loadInput.f32(i32 4, i32 4, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %9 = call i32 @dx.op.loadInput.i32(i32 4, i32 3, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %10 = call i32 @dx.op.loadInput.i32(i32 4, i32 3, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %11 = call i32 @dx.op.loadInput.i32(i32 4, i32 3, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %12 = call i32 @dx.op.loadInput.i32(i32 4, i32 3, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %13 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %14 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %15 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %16 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %17 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %18 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %19 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %20 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %21 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %22 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %23 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %24 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %4, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %25 = extractvalue %dx.types.CBufRet.i32 %24, 0
-  %26 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 52)  ; BufferLoad(srv,index,wot)
-  %27 = extractvalue %dx.types.ResRet.i32 %26, 0
-  %28 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 56)  ; BufferLoad(srv,index,wot)
-  %29 = extractvalue %dx.types.ResRet.i32 %28, 0
-  %30 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 60)  ; BufferLoad(srv,index,wot)
-  %31 = extractvalue %dx.types.ResRet.i32 %30, 0
-  %32 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 64)  ; BufferLoad(srv,index,wot)
-  %33 = extractvalue %dx.types.ResRet.i32 %32, 0
-  %34 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 68)  ; BufferLoad(srv,index,wot)
-  %35 = extractvalue %dx.types.ResRet.i32 %34, 0
-  %36 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 72)  ; BufferLoad(srv,index,wot)
-  %37 = extractvalue %dx.types.ResRet.i32 %36, 0
-  %38 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 76)  ; BufferLoad(srv,index,wot)
-  %39 = extractvalue %dx.types.ResRet.i32 %38, 0
-  %40 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %2, i32 %25, i32 80)  ; BufferLoad(srv,index,wot)
-  %41 = extractvalue %dx.types.ResRet.i32 %40, 0
-  %42 = add i32 %39, %9
-  %43 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %42, i32 0)  ; BufferLoad(srv,index,wot)
-  %44 = extractvalue %dx.types.ResRet.f32 %43, 0
-  %45 = extractvalue %dx.types.ResRet.f32 %43, 1
-  %46 = extractvalue %dx.types.ResRet.f32 %43, 2
-  %47 = extractvalue %dx.types.ResRet.f32 %43, 3
-  %48 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %42, i32 16)  ; BufferLoad(srv,index,wot)
-  %49 = extractvalue %dx.types.ResRet.f32 %48, 0
-  %50 = extractvalue %dx.types.ResRet.f32 %48, 1
-  %51 = extractvalue %dx.types.ResRet.f32 %48, 2
-  %52 = extractvalue %dx.types.ResRet.f32 %48, 3
-  %53 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %42, i32 32)  ; BufferLoad(srv,index,wot)
-  %54 = extractvalue %dx.types.ResRet.f32 %53, 0
-  %55 = extractvalue %dx.types.ResRet.f32 %53, 1
-  %56 = extractvalue %dx.types.ResRet.f32 %53, 2
-  %57 = extractvalue %dx.types.ResRet.f32 %53, 3
-  %58 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %42, i32 48)  ; BufferLoad(srv,index,wot)
-  %59 = extractvalue %dx.types.ResRet.f32 %58, 0
-  %60 = extractvalue %dx.types.ResRet.f32 %58, 1
-  %61 = extractvalue %dx.types.ResRet.f32 %58, 2
-  %62 = extractvalue %dx.types.ResRet.f32 %58, 3
-  %63 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %42, i32 64)  ; BufferLoad(srv,index,wot)
-  %64 = extractvalue %dx.types.ResRet.f32 %63, 0
-  %65 = extractvalue %dx.types.ResRet.f32 %63, 1
-  %66 = extractvalue %dx.types.ResRet.f32 %63, 2
-  %67 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %42, i32 80)  ; BufferLoad(srv,index,wot)
-  %68 = extractvalue %dx.types.ResRet.f32 %67, 0
-  %69 = extractvalue %dx.types.ResRet.f32 %67, 1
-  %70 = extractvalue %dx.types.ResRet.f32 %67, 2
-  %71 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %42, i32 96)  ; BufferLoad(srv,index,wot)
-  %72 = extractvalue %dx.types.ResRet.f32 %71, 0
-  %73 = extractvalue %dx.types.ResRet.f32 %71, 1
-  %74 = extractvalue %dx.types.ResRet.f32 %71, 2
-  %75 = add i32 %39, %10
-  %76 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %75, i32 0)  ; BufferLoad(srv,index,wot)
-  %77 = extractvalue %dx.types.ResRet.f32 %76, 0
-  %78 = extractvalue %dx.types.ResRet.f32 %76, 1
-  %79 = extractvalue %dx.types.ResRet.f32 %76, 2
-  %80 = extractvalue %dx.types.ResRet.f32 %76, 3
-  %81 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %75, i32 16)  ; BufferLoad(srv,index,wot)
-  %82 = extractvalue %dx.types.ResRet.f32 %81, 0
-  %83 = extractvalue %dx.types.ResRet.f32 %81, 1
-  %84 = extractvalue %dx.types.ResRet.f32 %81, 2
-  %85 = extractvalue %dx.types.ResRet.f32 %81, 3
-  %86 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %75, i32 32)  ; BufferLoad(srv,index,wot)
-  %87 = extractvalue %dx.types.ResRet.f32 %86, 0
-  %88 = extractvalue %dx.types.ResRet.f32 %86, 1
-  %89 = extractvalue %dx.types.ResRet.f32 %86, 2
-  %90 = extractvalue %dx.types.ResRet.f32 %86, 3
-  %91 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %75, i32 48)  ; BufferLoad(srv,index,wot)
-  %92 = extractvalue %dx.types.ResRet.f32 %91, 0
-  %93 = extractvalue %dx.types.ResRet.f32 %91, 1
-  %94 = extractvalue %dx.types.ResRet.f32 %91, 2
-  %95 = extractvalue %dx.types.ResRet.f32 %91, 3
-  %96 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %75, i32 64)  ; BufferLoad(srv,index,wot)
-  %97 = extractvalue %dx.types.ResRet.f32 %96, 0
-  %98 = extractvalue %dx.types.ResRet.f32 %96, 1
-  %99 = extractvalue %dx.types.ResRet.f32 %96, 2
-  %100 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %75, i32 80)  ; BufferLoad(srv,index,wot)
-  %101 = extractvalue %dx.types.ResRet.f32 %100, 0
-  %102 = extractvalue %dx.types.ResRet.f32 %100, 1
-  %103 = extractvalue %dx.types.ResRet.f32 %100, 2
-  %104 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %75, i32 96)  ; BufferLoad(srv,index,wot)
-  %105 = extractvalue %dx.types.ResRet.f32 %104, 0
-  %106 = extractvalue %dx.types.ResRet.f32 %104, 1
-  %107 = extractvalue %dx.types.ResRet.f32 %104, 2
-  %108 = add i32 %39, %11
-  %109 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %108, i32 0)  ; BufferLoad(srv,index,wot)
-  %110 = extractvalue %dx.types.ResRet.f32 %109, 0
-  %111 = extractvalue %dx.types.ResRet.f32 %109, 1
-  %112 = extractvalue %dx.types.ResRet.f32 %109, 2
-  %113 = extractvalue %dx.types.ResRet.f32 %109, 3
-  %114 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %108, i32 16)  ; BufferLoad(srv,index,wot)
-  %115 = extractvalue %dx.types.ResRet.f32 %114, 0
-  %116 = extractvalue %dx.types.ResRet.f32 %114, 1
-  %117 = extractvalue %dx.types.ResRet.f32 %114, 2
-  %118 = extractvalue %dx.types.ResRet.f32 %114, 3
-  %119 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %108, i32 32)  ; BufferLoad(srv,index,wot)
-  %120 = extractvalue %dx.types.ResRet.f32 %119, 0
-  %121 = extractvalue %dx.types.ResRet.f32 %119, 1
-  %122 = extractvalue %dx.types.ResRet.f32 %119, 2
-  %123 = extractvalue %dx.types.ResRet.f32 %119, 3
-  %124 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %108, i32 48)  ; BufferLoad(srv,index,wot)
-  %125 = extractvalue %dx.types.ResRet.f32 %124, 0
-  %126 = extractvalue %dx.types.ResRet.f32 %124, 1
-  %127 = extractvalue %dx.types.ResRet.f32 %124, 2
-  %128 = extractvalue %dx.types.ResRet.f32 %124, 3
-  %129 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %108, i32 64)  ; BufferLoad(srv,index,wot)
-  %130 = extractvalue %dx.types.ResRet.f32 %129, 0
-  %131 = extractvalue %dx.types.ResRet.f32 %129, 1
-  %132 = extractvalue %dx.types.ResRet.f32 %129, 2
-  %133 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %108, i32 80)  ; BufferLoad(srv,index,wot)
-  %134 = extractvalue %dx.types.ResRet.f32 %133, 0
-  %135 = extractvalue %dx.types.ResRet.f32 %133, 1
-  %136 = extractvalue %dx.types.ResRet.f32 %133, 2
-  %137 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %108, i32 96)  ; BufferLoad(srv,index,wot)
-  %138 = extractvalue %dx.types.ResRet.f32 %137, 0
-  %139 = extractvalue %dx.types.ResRet.f32 %137, 1
-  %140 = extractvalue %dx.types.ResRet.f32 %137, 2
-  %141 = add i32 %39, %12
-  %142 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %141, i32 0)  ; BufferLoad(srv,index,wot)
-  %143 = extractvalue %dx.types.ResRet.f32 %142, 0
-  %144 = extractvalue %dx.types.ResRet.f32 %142, 1
-  %145 = extractvalue %dx.types.ResRet.f32 %142, 2
-  %146 = extractvalue %dx.types.ResRet.f32 %142, 3
-  %147 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %141, i32 16)  ; BufferLoad(srv,index,wot)
-  %148 = extractvalue %dx.types.ResRet.f32 %147, 0
-  %149 = extractvalue %dx.types.ResRet.f32 %147, 1
-  %150 = extractvalue %dx.types.ResRet.f32 %147, 2
-  %151 = extractvalue %dx.types.ResRet.f32 %147, 3
-  %152 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %141, i32 32)  ; BufferLoad(srv,index,wot)
-  %153 = extractvalue %dx.types.ResRet.f32 %152, 0
-  %154 = extractvalue %dx.types.ResRet.f32 %152, 1
-  %155 = extractvalue %dx.types.ResRet.f32 %152, 2
-  %156 = extractvalue %dx.types.ResRet.f32 %152, 3
-  %157 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %141, i32 48)  ; BufferLoad(srv,index,wot)
-  %158 = extractvalue %dx.types.ResRet.f32 %157, 0
-  %159 = extractvalue %dx.types.ResRet.f32 %157, 1
-  %160 = extractvalue %dx.types.ResRet.f32 %157, 2
-  %161 = extractvalue %dx.types.ResRet.f32 %157, 3
-  %162 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %141, i32 64)  ; BufferLoad(srv,index,wot)
-  %163 = extractvalue %dx.types.ResRet.f32 %162, 0
-  %164 = extractvalue %dx.types.ResRet.f32 %162, 1
-  %165 = extractvalue %dx.types.ResRet.f32 %162, 2
-  %166 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %141, i32 80)  ; BufferLoad(srv,index,wot)
-  %167 = extractvalue %dx.types.ResRet.f32 %166, 0
-  %168 = extractvalue %dx.types.ResRet.f32 %166, 1
-  %169 = extractvalue %dx.types.ResRet.f32 %166, 2
-  %170 = call %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32 68, %dx.types.Handle %1, i32 %141, i32 96)  ; BufferLoad(srv,index,wot)
-  %171 = extractvalue %dx.types.ResRet.f32 %170, 0
-  %172 = extractvalue %dx.types.ResRet.f32 %170, 1
-  %173 = extractvalue %dx.types.ResRet.f32 %170, 2
-  %174 = fmul fast float %44, %5
-  %175 = fmul fast float %49, %5
-  %176 = fmul fast float %54, %5
-  %177 = fmul fast float %59, %5
-  %178 = fmul fast float %45, %5
-  %179 = fmul fast float %50, %5
-  %180 = fmul fast float %55, %5
-  %181 = fmul fast float %60, %5
-  %182 = fmul fast float %46, %5
-  %183 = fmul fast float %51, %5
-  %184 = fmul fast float %56, %5
-  %185 = fmul fast float %61, %5
-  %186 = fmul fast float %47, %5
-  %187 = fmul fast float %52, %5
-  %188 = fmul fast float %57, %5
-  %189 = fmul fast float %62, %5
-  %190 = fmul fast float %77, %6
-  %191 = fmul fast float %82, %6
-  %192 = fmul fast float %87, %6
-  %193 = fmul fast float %92, %6
-  %194 = fmul fast float %78, %6
-  %195 = fmul fast float %83, %6
-  %196 = fmul fast float %88, %6
-  %197 = fmul fast float %93, %6
-  %198 = fmul fast float %79, %6
-  %199 = fmul fast float %84, %6
-  %200 = fmul fast float %89, %6
-  %201 = fmul fast float %94, %6
-  %202 = fmul fast float %80, %6
-  %203 = fmul fast float %85, %6
-  %204 = fmul fast float %90, %6
-  %205 = fmul fast float %95, %6
-  %206 = fadd fast float %190, %174
-  %207 = fadd fast float %191, %175
-  %208 = fadd fast float %192, %176
-  %209 = fadd fast float %193, %177
-  %210 = fadd fast float %194, %178
-  %211 = fadd fast float %195, %179
-  %212 = fadd fast float %196, %180
-  %213 = fadd fast float %197, %181
-  %214 = fadd fast float %198, %182
-  %215 = fadd fast float %199, %183
-  %216 = fadd fast float %200, %184
-  %217 = fadd fast float %201, %185
-  %218 = fadd fast float %202, %186
-  %219 = fadd fast float %203, %187
-  %220 = fadd fast float %204, %188
-  %221 = fadd fast float %205, %189
-  %222 = fmul fast float %110, %7
-  %223 = fmul fast float %115, %7
-  %224 = fmul fast float %120, %7
-  %225 = fmul fast float %125, %7
-  %226 = fmul fast float %111, %7
-  %227 = fmul fast float %116, %7
-  %228 = fmul fast float %121, %7
-  %229 = fmul fast float %126, %7
-  %230 = fmul fast float %112, %7
-  %231 = fmul fast float %117, %7
-  %232 = fmul fast float %122, %7
-  %233 = fmul fast float %127, %7
-  %234 = fmul fast float %113, %7
-  %235 = fmul fast float %118, %7
-  %236 = fmul fast float %123, %7
-  %237 = fmul fast float %128, %7
-  %238 = fadd fast float %206, %222
-  %239 = fadd fast float %207, %223
-  %240 = fadd fast float %208, %224
-  %241 = fadd fast float %209, %225
-  %242 = fadd fast float %210, %226
-  %243 = fadd fast float %211, %227
-  %244 = fadd fast float %212, %228
-  %245 = fadd fast float %213, %229
-  %246 = fadd fast float %214, %230
-  %247 = fadd fast float %215, %231
-  %248 = fadd fast float %216, %232
-  %249 = fadd fast float %217, %233
-  %250 = fadd fast float %218, %234
-  %251 = fadd fast float %219, %235
-  %252 = fadd fast float %220, %236
-  %253 = fadd fast float %221, %237
-  %254 = fmul fast float %143, %8
-  %255 = fmul fast float %148, %8
-  %256 = fmul fast float %153, %8
-  %257 = fmul fast float %158, %8
-  %258 = fmul fast float %144, %8
-  %259 = fmul fast float %149, %8
-  %260 = fmul fast float %154, %8
-  %261 = fmul fast float %159, %8
-  %262 = fmul fast float %145, %8
-  %263 = fmul fast float %150, %8
-  %264 = fmul fast float %155, %8
-  %265 = fmul fast float %160, %8
-  %266 = fmul fast float %146, %8
-  %267 = fmul fast float %151, %8
-  %268 = fmul fast float %156, %8
-  %269 = fmul fast float %161, %8
-  %270 = fadd fast float %238, %254
-  %271 = fadd fast float %239, %255
-  %272 = fadd fast float %240, %256
-  %273 = fadd fast float %241, %257
-  %274 = fadd fast float %242, %258
-  %275 = fadd fast float %243, %259
-  %276 = fadd fast float %244, %260
-  %277 = fadd fast float %245, %261
-  %278 = fadd fast float %246, %262
-  %279 = fadd fast float %247, %263
-  %280 = fadd fast float %248, %264
-  %281 = fadd fast float %249, %265
-  %282 = fadd fast float %250, %266
-  %283 = fadd fast float %251, %267
-  %284 = fadd fast float %252, %268
-  %285 = fadd fast float %253, %269
-  %286 = fmul fast float %64, %5
-  %287 = fmul fast float %68, %5
-  %288 = fmul fast float %72, %5
-  %289 = fmul fast float %65, %5
-  %290 = fmul fast float %69, %5
-  %291 = fmul fast float %73, %5
-  %292 = fmul fast float %66, %5
-  %293 = fmul fast float %70, %5
-  %294 = fmul fast float %74, %5
-  %295 = fmul fast float %97, %6
-  %296 = fmul fast float %101, %6
-  %297 = fmul fast float %105, %6
-  %298 = fmul fast float %98, %6
-  %299 = fmul fast float %102, %6
-  %300 = fmul fast float %106, %6
-  %301 = fmul fast float %99, %6
-  %302 = fmul fast float %103, %6
-  %303 = fmul fast float %107, %6
-  %304 = fadd fast float %295, %286
-  %305 = fadd fast float %296, %287
-  %306 = fadd fast float %297, %288
-  %307 = fadd fast float %298, %289
-  %308 = fadd fast float %299, %290
-  %309 = fadd fast float %300, %291
-  %310 = fadd fast float %301, %292
-  %311 = fadd fast float %302, %293
-  %312 = fadd fast float %303, %294
-  %313 = fmul fast float %130, %7
-  %314 = fmul fast float %134, %7
-  %315 = fmul fast float %138, %7
-  %316 = fmul fast float %131, %7
-  %317 = fmul fast float %135, %7
-  %318 = fmul fast float %139, %7
-  %319 = fmul fast float %132, %7
-  %320 = fmul fast float %136, %7
-  %321 = fmul fast float %140, %7
-  %322 = fadd fast float %304, %313
-  %323 = fadd fast float %305, %314
-  %324 = fadd fast float %306, %315
-  %325 = fadd fast float %307, %316
-  %326 = fadd fast float %308, %317
-  %327 = fadd fast float %309, %318
-  %328 = fadd fast float %310, %319
-  %329 = fadd fast float %311, %320
-  %330 = fadd fast float %312, %321
-  %331 = fmul fast float %163, %8
-  %332 = fmul fast float %167, %8
-  %333 = fmul fast float %171, %8
-  %334 = fmul fast float %164, %8
-  %335 = fmul fast float %168, %8
-  %336 = fmul fast float %172, %8
-  %337 = fmul fast float %165, %8
-  %338 = fmul fast float %169, %8
-  %339 = fmul fast float %173, %8
-  %340 = fadd fast float %322, %331
-  %341 = fadd fast float %323, %332
-  %342 = fadd fast float %324, %333
-  %343 = fadd fast float %325, %334
-  %344 = fadd fast float %326, %335
-  %345 = fadd fast float %327, %336
-  %346 = fadd fast float %328, %337
-  %347 = fadd fast float %329, %338
-  %348 = fadd fast float %330, %339
-  %349 = fmul fast float %270, %21
-  %350 = call float @dx.op.tertiary.f32(i32 46, float %271, float %22, float %349)  ; FMad(a,b,c)
-  %351 = call float @dx.op.tertiary.f32(i32 46, float %272, float %23, float %350)  ; FMad(a,b,c)
-  %352 = fadd fast float %273, %351
-  %353 = fmul fast float %274, %21
-  %354 = call float @dx.op.tertiary.f32(i32 46, float %275, float %22, float %353)  ; FMad(a,b,c)
-  %355 = call float @dx.op.tertiary.f32(i32 46, float %276, float %23, float %354)  ; FMad(a,b,c)
-  %356 = fadd fast float %277, %355
-  %357 = fmul fast float %278, %21
-  %358 = call float @dx.op.tertiary.f32(i32 46, float %279, float %22, float %357)  ; FMad(a,b,c)
-  %359 = call float @dx.op.tertiary.f32(i32 46, float %280, float %23, float %358)  ; FMad(a,b,c)
-  %360 = fadd fast float %281, %359
-  %361 = fmul fast float %282, %21
-  %362 = call float @dx.op.tertiary.f32(i32 46, float %283, float %22, float %361)  ; FMad(a,b,c)
-  %363 = call float @dx.op.tertiary.f32(i32 46, float %284, float %23, float %362)  ; FMad(a,b,c)
-  %364 = fadd fast float %285, %363
-  %365 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 12)  ; CBufferLoadLegacy(handle,regIndex)
-  %366 = extractvalue %dx.types.CBufRet.f32 %365, 0
-  %367 = extractvalue %dx.types.CBufRet.f32 %365, 1
-  %368 = extractvalue %dx.types.CBufRet.f32 %365, 2
-  %369 = extractvalue %dx.types.CBufRet.f32 %365, 3
-  %370 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 13)  ; CBufferLoadLegacy(handle,regIndex)
-  %371 = extractvalue %dx.types.CBufRet.f32 %370, 0
-  %372 = extractvalue %dx.types.CBufRet.f32 %370, 1
-  %373 = extractvalue %dx.types.CBufRet.f32 %370, 2
-  %374 = extractvalue %dx.types.CBufRet.f32 %370, 3
-  %375 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 14)  ; CBufferLoadLegacy(handle,regIndex)
-  %376 = extractvalue %dx.types.CBufRet.f32 %375, 0
-  %377 = extractvalue %dx.types.CBufRet.f32 %375, 1
-  %378 = extractvalue %dx.types.CBufRet.f32 %375, 2
-  %379 = extractvalue %dx.types.CBufRet.f32 %375, 3
-  %380 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %3, i32 15)  ; CBufferLoadLegacy(handle,regIndex)
-  %381 = extractvalue %dx.types.CBufRet.f32 %380, 0
-  %382 = extractvalue %dx.types.CBufRet.f32 %380, 1
-  %383 = extractvalue %dx.types.CBufRet.f32 %380, 2
-  %384 = extractvalue %dx.types.CBufRet.f32 %380, 3
-  %385 = fmul fast float %366, %352
-  %386 = call float @dx.op.tertiary.f32(i32 46, float %371, float %356, float %385)  ; FMad(a,b,c)
-  %387 = call float @dx.op.tertiary.f32(i32 46, float %376, float %360, float %386)  ; FMad(a,b,c)
-  %388 = call float @dx.op.tertiary.f32(i32 46, float %381, float %364, float %387)  ; FMad(a,b,c)
-  %389 = fmul fast float %367, %352
-  %390 = call float @dx.op.tertiary.f32(i32 46, float %372, float %356, float %389)  ; FMad(a,b,c)
-  %391 = call float @dx.op.tertiary.f32(i32 46, float %377, float %360, float %390)  ; FMad(a,b,c)
-  %392 = call float @dx.op.tertiary.f32(i32 46, float %382, float %364, float %391)  ; FMad(a,b,c)
-  %393 = fmul fast float %368, %352
-  %394 = call float @dx.op.tertiary.f32(i32 46, float %373, float %356, float %393)  ; FMad(a,b,c)
-  %395 = call float @dx.op.tertiary.f32(i32 46, float %378, float %360, float %394)  ; FMad(a,b,c)
-  %396 = call float @dx.op.tertiary.f32(i32 46, float %383, float %364, float %395)  ; FMad(a,b,c)
-  %397 = fmul fast float %369, %352
-  %398 = call float @dx.op.tertiary.f32(i32 46, float %374, float %356, float %397)  ; FMad(a,b,c)
-  %399 = call float @dx.op.tertiary.f32(i32 46, float %379, float %360, float %398)  ; FMad(a,b,c)
-  %400 = call float @dx.op.tertiary.f32(i32 46, float %384, float %364, float %399)  ; FMad(a,b,c)
-  %401 = fmul fast float %270, %13
-  %402 = call float @dx.op.tertiary.f32(i32 46, float %271, float %14, float %401)  ; FMad(a,b,c)
-  %403 = call float @dx.op.tertiary.f32(i32 46, float %272, float %15, float %402)  ; FMad(a,b,c)
-  %404 = fmul fast float %274, %13
-  %405 = call float @dx.op.tertiary.f32(i32 46, float %275, float %14, float %404)  ; FMad(a,b,c)
-  %406 = call float @dx.op.tertiary.f32(i32 46, float %276, float %15, float %405)  ; FMad(a,b,c)
-  %407 = fmul fast float %278, %13
-  %408 = call float @dx.op.tertiary.f32(i32 46, float %279, float %14, float %407)  ; FMad(a,b,c)
-  %409 = call float @dx.op.tertiary.f32(i32 46, float %280, float %15, float %408)  ; FMad(a,b,c)
-  %410 = call float @dx.op.dot3.f32(i32 55, float %403, float %406, float %409, float %403, float %406, float %409)  ; Dot3(ax,ay,az,bx,by,bz)
-  %411 = call float @dx.op.unary.f32(i32 25, float %410)  ; Rsqrt(value)
-  %412 = fmul fast float %411, %403
-  %413 = fmul fast float %411, %406
-  %414 = fmul fast float %411, %409
-  %415 = fmul fast float %340, %17
-  %416 = call float @dx.op.tertiary.f32(i32 46, float %18, float %343, float %415)  ; FMad(a,b,c)
-  %417 = call float @dx.op.tertiary.f32(i32 46, float %19, float %346, float %416)  ; FMad(a,b,c)
-  %418 = fmul fast float %341, %17
-  %419 = call float @dx.op.tertiary.f32(i32 46, float %18, float %344, float %418)  ; FMad(a,b,c)
-  %420 = call float @dx.op.tertiary.f32(i32 46, float %19, float %347, float %419)  ; FMad(a,b,c)
-  %421 = fmul fast float %342, %17
-  %422 = call float @dx.op.tertiary.f32(i32 46, float %18, float %345, float %421)  ; FMad(a,b,c)
-  %423 = call float @dx.op.tertiary.f32(i32 46, float %19, float %348, float %422)  ; FMad(a,b,c)
-  %424 = call float @dx.op.dot3.f32(i32 55, float %417, float %420, float %423, float %417, float %420, float %423)  ; Dot3(ax,ay,az,bx,by,bz)
-  %425 = call float @dx.op.unary.f32(i32 25, float %424)  ; Rsqrt(value)
-  %426 = fmul fast float %425, %417
-  %427 = fmul fast float %425, %420
-  %428 = fmul fast float %425, %423
-  %429 = fmul fast float %427, %414
-  %430 = fmul fast float %428, %413
-  %431 = fsub fast float %429, %430
-  %432 = fmul fast float %428, %412
-  %433 = fmul fast float %426, %414
-  %434 = fsub fast float %432, %433
-  %435 = fmul fast float %426, %413
-  %436 = fmul fast float %427, %412
-  %437 = fsub fast float %435, %436
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %388)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %392)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %396)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float %400)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 0, float %388)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 1, float %392)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 2, float %396)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 3, float %400)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 0, float %352)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 1, float %356)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 2, float %360)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 4, i32 0, i8 0, float %20)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 4, i32 0, i8 1, float %16)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 5, i32 0, i8 0, i32 %27)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 6, i32 0, i8 0, i32 %29)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 7, i32 0, i8 0, i32 %31)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 8, i32 0, i8 0, i32 %33)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 9, i32 0, i8 0, i32 %35)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 10, i32 0, i8 0, i32 %37)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 11, i32 0, i8 0, i32 %41)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 0, float %412)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 1, float %431)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 2, float %426)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 0, float %413)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 1, float %434)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 2, float %427)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 0, float %414)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 1, float %437)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 2, float %428)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.loadInput.f32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind readnone
-declare i32 @dx.op.loadInput.i32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.i32(i32, i32, i32, i8, i32) #1
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.dot3.f32(i32, float, float, float, float, float, float) #0
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.bufferLoad.f32(i32, %dx.types.Handle, i32, i32) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!13}
-!dx.entryPoints = !{!14}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"vs", i32 6, i32 0}
-!4 = !{!5, null, !10, null}
-!5 = !{!6, !8}
-!6 = !{i32 0, %"class.StructuredBuffer<SkinnedObject>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 96}
-!8 = !{i32 1, %"dx.alignment.legacy.class.StructuredBuffer<Bone>"* undef, !"", i32 0, i32 1, i32 1, i32 12, i32 0, !9}
-!9 = !{i32 1, i32 128}
-!10 = !{!11, !12}
-!11 = !{i32 0, %rootConstants* undef, !"", i32 0, i32 0, i32 1, i32 4, null}
-!12 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!13 = !{[42 x i32] [i32 20, i32 35, i32 2047, i32 0, i32 2047, i32 0, i32 2047, i32 0, i32 0, i32 0, i32 6709248, i32 0, i32 6709248, i32 0, i32 6709248, i32 0, i32 16777216, i32 0, i32 3354624, i32 0, i32 3354624, i32 0, i32 3354624, i32 0, i32 33554432, i32 0, i32 7829503, i32 0, i32 7829503, i32 0, i32 7829503, i32 0, i32 7829503, i32 0, i32 7829503, i32 0, i32 7829503, i32 0, i32 7829503, i32 0, i32 7829503, i32 0]}
-!14 = !{void ()* @main, !"main", !15, !4, !46}
-!15 = !{!16, !25, null}
-!16 = !{!17, !20, !22, !23, !24}
-!17 = !{i32 0, !"POSITION", i8 9, i8 0, !18, i8 0, i32 1, i8 3, i32 0, i8 0, !19}
-!18 = !{i32 0}
-!19 = !{i32 3, i32 7}
-!20 = !{i32 1, !"NORMAL", i8 9, i8 0, !18, i8 0, i32 1, i8 4, i32 1, i8 0, !21}
-!21 = !{i32 3, i32 15}
-!22 = !{i32 2, !"TANGENT", i8 9, i8 0, !18, i8 0, i32 1, i8 4, i32 2, i8 0, !21}
-!23 = !{i32 3, !"BLENDINDICES", i8 5, i8 0, !18, i8 0, i32 1, i8 4, i32 3, i8 0, !21}
-!24 = !{i32 4, !"BLENDWEIGHTS", i8 9, i8 0, !18, i8 0, i32 1, i8 4, i32 4, i8 0, !21}
-!25 = !{!26, !27, !28, !30, !32, !34, !36, !37, !39, !41, !43, !45}
-!26 = !{i32 0, !"SV_Position", i8 9, i8 3, !18, i8 4, i32 1, i8 4, i32 0, i8 0, !21}
-!27 = !{i32 1, !"POSITION", i8 9, i8 0, !18, i8 2, i32 1, i8 4, i32 1, i8 0, !21}
-!28 = !{i32 2, !"POSITION", i8 9, i8 0, !29, i8 2, i32 1, i8 3, i32 2, i8 0, !19}
-!29 = !{i32 1}
-!30 = !{i32 3, !"TBN_MATRIX", i8 9, i8 0, !31, i8 2, i32 3, i8 3, i32 3, i8 0, !19}
-!31 = !{i32 0, i32 1, i32 2}
-!32 = !{i32 4, !"TEXCOORD", i8 9, i8 0, !18, i8 2, i32 1, i8 2, i32 6, i8 0, !33}
-!33 = !{i32 3, i32 3}
-!34 = !{i32 5, !"MATERIAL", i8 5, i8 0, !18, i8 1, i32 1, i8 1, i32 7, i8 0, !35}
-!35 = !{i32 3, i32 1}
-!36 = !{i32 6, !"MATERIAL", i8 5, i8 0, !29, i8 1, i32 1, i8 1, i32 7, i8 1, !35}
-!37 = !{i32 7, !"MATERIAL", i8 5, i8 0, !38, i8 1, i32 1, i8 1, i32 7, i8 2, !35}
-!38 = !{i32 2}
-!39 = !{i32 8, !"MATERIAL", i8 5, i8 0, !40, i8 1, i32 1, i8 1, i32 7, i8 3, !35}
-!40 = !{i32 3}
-!41 = !{i32 9, !"MATERIAL", i8 5, i8 0, !42, i8 1, i32 1, i8 1, i32 8, i8 0, !35}
-!42 = !{i32 4}
-!43 = !{i32 10, !"MATERIAL", i8 5, i8 0, !44, i8 1, i32 1, i8 1, i32 8, i8 1, !35}
-!44 = !{i32 5}
-!45 = !{i32 11, !"OBJECT_FLAGS", i8 5, i8 0, !18, i8 1, i32 1, i8 1, i32 8, i8 2, !35}
-!46 = !{i32 0, i64 16}
-
-#endif
-
-const unsigned char RINShaderBytesPBRSkinnedVS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x93, 0x89, 0x3a, 0x7d, 0x08, 0xc9, 0x19, 0x17,
-  0x4a, 0xa1, 0xb3, 0xad, 0xd8, 0xb0, 0xc7, 0x7c, 0x01, 0x00, 0x00, 0x00,
-  0x77, 0x31, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00,
-  0x67, 0x06, 0x00, 0x00, 0x3f, 0x08, 0x00, 0x00, 0xfb, 0x19, 0x00, 0x00,
-  0x17, 0x1a, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0xda, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e,
-  0x00, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x00, 0x54, 0x41, 0x4e, 0x47,
-  0x45, 0x4e, 0x54, 0x00, 0x42, 0x4c, 0x45, 0x4e, 0x44, 0x49, 0x4e, 0x44,
-  0x49, 0x43, 0x45, 0x53, 0x00, 0x42, 0x4c, 0x45, 0x4e, 0x44, 0x57, 0x45,
-  0x49, 0x47, 0x48, 0x54, 0x53, 0x00, 0x4f, 0x53, 0x47, 0x31, 0x3d, 0x02,
-  0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x01, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x01,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00,
-  0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x0c,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x0b,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x02,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00,
-  0x00, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x0d,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x53, 0x56, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x50,
-  0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x54, 0x42, 0x4e, 0x5f,
-  0x4d, 0x41, 0x54, 0x52, 0x49, 0x58, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f,
-  0x4f, 0x52, 0x44, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c,
-  0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41,
-  0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52,
-  0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c,
-  0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4f, 0x42,
-  0x4a, 0x45, 0x43, 0x54, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x00, 0x50,
-  0x53, 0x56, 0x30, 0xe8, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01,
-  0x00, 0x00, 0x00, 0x05, 0x0c, 0x00, 0x05, 0x09, 0x00, 0x00, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c,
-  0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e,
-  0x00, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x00, 0x54, 0x41, 0x4e, 0x47,
-  0x45, 0x4e, 0x54, 0x00, 0x42, 0x4c, 0x45, 0x4e, 0x44, 0x49, 0x4e, 0x44,
-  0x49, 0x43, 0x45, 0x53, 0x00, 0x42, 0x4c, 0x45, 0x4e, 0x44, 0x57, 0x45,
-  0x49, 0x47, 0x48, 0x54, 0x53, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49,
-  0x4f, 0x4e, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00,
-  0x54, 0x42, 0x4e, 0x5f, 0x4d, 0x41, 0x54, 0x52, 0x49, 0x58, 0x00, 0x54,
-  0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x4d, 0x41, 0x54, 0x45,
-  0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41,
-  0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d,
-  0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45,
-  0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41,
-  0x4c, 0x00, 0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x53, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x44, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x02, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x03, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x44, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x44, 0x03, 0x03, 0x04, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x44, 0x00, 0x03, 0x02, 0x00, 0x00, 0x3c,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x43, 0x00, 0x03,
-  0x02, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-  0x03, 0x43, 0x00, 0x03, 0x02, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x06, 0x42, 0x00, 0x03, 0x02, 0x00, 0x00, 0x59,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x41, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-  0x07, 0x51, 0x00, 0x01, 0x01, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x01, 0x07, 0x61, 0x00, 0x01, 0x01, 0x00, 0x00, 0x74,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x07, 0x71, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01,
-  0x08, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x01, 0x08, 0x51, 0x00, 0x01, 0x01, 0x00, 0x00, 0x8f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x61, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x77, 0x77, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x77, 0x77, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x54, 0x53, 0x30, 0xd0,
-  0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x1d,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x78,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x84,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9c,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xb4,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xc0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xcc,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x55,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
-  0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7f, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x53,
-  0x54, 0x41, 0x54, 0xb4, 0x11, 0x00, 0x00, 0x60, 0x00, 0x01, 0x00, 0x6d,
-  0x04, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x9c, 0x11, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21,
-  0x0c, 0x00, 0x00, 0x64, 0x04, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41,
-  0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25,
-  0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x1c, 0x45, 0x02, 0x42,
-  0x92, 0x0b, 0x42, 0xe4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a,
-  0x32, 0x72, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00,
-  0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x91, 0x23, 0xc4, 0x50, 0x41,
-  0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x39, 0x46, 0x06, 0x51,
-  0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff,
-  0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00,
-  0x09, 0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
-  0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89,
-  0x20, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x32, 0x22, 0xc8, 0x09, 0x20,
-  0x64, 0x85, 0x04, 0x93, 0x23, 0xa4, 0x84, 0x04, 0x93, 0x23, 0xe3, 0x84,
-  0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8e, 0x8c, 0x0b, 0x84, 0xe4, 0x4c, 0x10,
-  0x90, 0xc2, 0x0c, 0xc0, 0x30, 0xc2, 0x00, 0x5c, 0x25, 0x4d, 0x11, 0x25,
-  0x4c, 0xfe, 0xe6, 0x50, 0xcd, 0x80, 0x34, 0x06, 0xfb, 0x1c, 0x44, 0x44,
-  0x20, 0x21, 0x00, 0x98, 0x23, 0x00, 0x83, 0x53, 0xa4, 0x29, 0xa2, 0x84,
-  0xc9, 0x2f, 0xd1, 0x0e, 0x0d, 0x83, 0xc1, 0x20, 0x07, 0x08, 0xf7, 0x48,
-  0x53, 0x44, 0x09, 0x93, 0x6f, 0x02, 0x13, 0x11, 0x21, 0xc0, 0x82, 0x8c,
-  0xc1, 0x60, 0x30, 0x18, 0x0c, 0x8e, 0x92, 0xa6, 0x88, 0x12, 0x26, 0x9f,
-  0x55, 0x90, 0xa6, 0x21, 0x06, 0x34, 0x48, 0x08, 0x61, 0x42, 0x86, 0xa0,
-  0x60, 0x18, 0x0c, 0x02, 0x33, 0x95, 0xc1, 0x38, 0xb0, 0x43, 0x38, 0xcc,
-  0xc3, 0x3c, 0xb8, 0xc1, 0x2c, 0xd0, 0x83, 0x3c, 0xd4, 0xc3, 0x38, 0xd0,
-  0x43, 0x3d, 0xc8, 0x43, 0x39, 0x90, 0x83, 0x28, 0xd4, 0x83, 0x39, 0x98,
-  0x43, 0x39, 0xc8, 0x03, 0x1f, 0xcc, 0xc2, 0x3a, 0xa4, 0x83, 0x3b, 0xb8,
-  0x43, 0x39, 0x90, 0xc3, 0x2b, 0x88, 0x83, 0x3a, 0x94, 0xc3, 0x38, 0xd0,
-  0x83, 0x1f, 0xa0, 0xe0, 0x40, 0x88, 0xa3, 0xa4, 0x29, 0xa2, 0x84, 0xc9,
-  0x5f, 0x1d, 0x67, 0xe2, 0x9c, 0x46, 0x9a, 0x80, 0x66, 0x92, 0x50, 0x30,
-  0xb8, 0x26, 0x72, 0x9c, 0x89, 0x73, 0x1a, 0x69, 0x02, 0x9a, 0x49, 0x42,
-  0x81, 0x82, 0x16, 0xc3, 0x08, 0x04, 0x90, 0x04, 0x8d, 0x0b, 0x83, 0xe1,
-  0xf2, 0x81, 0x05, 0x31, 0x1a, 0x86, 0x68, 0x26, 0x7f, 0x21, 0x0c, 0x40,
-  0xc0, 0x7c, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x39, 0x80, 0x21, 0x22, 0x00,
-  0x39, 0x0e, 0x87, 0xc3, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1c, 0x18, 0x0c, 0x97, 0x0f, 0x2c, 0x88, 0xd1, 0x30, 0x44, 0x33,
-  0xf9, 0x0b, 0x61, 0x00, 0x02, 0xe6, 0x0b, 0x00, 0x43, 0x44, 0xc0, 0x46,
-  0x15, 0x05, 0x11, 0xa1, 0xe0, 0x41, 0x90, 0xfb, 0x86, 0xcb, 0x07, 0x16,
-  0xc4, 0x68, 0x18, 0xa2, 0x99, 0xfc, 0x85, 0x30, 0x00, 0x01, 0xf3, 0xa5,
-  0x29, 0xa2, 0x84, 0xc9, 0xdf, 0x9c, 0x86, 0x40, 0x82, 0xc3, 0x31, 0x13,
-  0x1c, 0x90, 0x03, 0x3e, 0xb8, 0x41, 0x38, 0xb0, 0x43, 0x3a, 0x9c, 0x83,
-  0x3b, 0xb4, 0x43, 0x39, 0xb8, 0x03, 0x3d, 0xb8, 0x01, 0x3b, 0x94, 0xc3,
-  0x39, 0x84, 0xc3, 0x38, 0xe4, 0x83, 0x1b, 0x8c, 0x03, 0x3b, 0x84, 0xc3,
-  0x3c, 0xcc, 0x83, 0x1b, 0xcc, 0x02, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03,
-  0x3d, 0xd4, 0x83, 0x3c, 0x94, 0x03, 0x39, 0x88, 0x42, 0x3d, 0x98, 0x83,
-  0x39, 0x94, 0x83, 0x3c, 0xf0, 0x81, 0x28, 0xbc, 0x83, 0x3b, 0x94, 0x83,
-  0x1f, 0xa0, 0x40, 0x42, 0x93, 0x11, 0x80, 0x12, 0x54, 0xc8, 0x32, 0x47,
-  0x80, 0x14, 0x03, 0x30, 0x18, 0x0c, 0x30, 0x03, 0xca, 0x14, 0x63, 0x30,
-  0x18, 0x0c, 0x30, 0x03, 0xda, 0x14, 0xa3, 0x32, 0x18, 0x0c, 0x30, 0x00,
-  0xea, 0x14, 0xa3, 0x32, 0x18, 0x0c, 0x30, 0x03, 0xfa, 0x14, 0x04, 0x30,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x42, 0x65, 0x00, 0x0c, 0x00, 0x34,
-  0x3a, 0x6a, 0xb8, 0xfc, 0x09, 0x7b, 0x08, 0xc9, 0xe7, 0x36, 0xaa, 0x58,
-  0x89, 0xc9, 0x47, 0x6e, 0x1b, 0x11, 0x83, 0xc1, 0x60, 0x40, 0x98, 0x7b,
-  0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc, 0x10, 0x68, 0x86, 0x85, 0x40,
-  0x81, 0xa9, 0x10, 0xa5, 0xc1, 0x69, 0x40, 0xa8, 0xa3, 0x86, 0xcb, 0x9f,
-  0xb0, 0x87, 0x90, 0x7c, 0x6e, 0xa3, 0x8a, 0x95, 0x98, 0xfc, 0xe2, 0xb6,
-  0x11, 0x01, 0x00, 0x00, 0x00, 0x85, 0x50, 0x0d, 0x4e, 0x03, 0x5a, 0x95,
-  0x02, 0x30, 0x00, 0x00, 0x00, 0xd4, 0x9a, 0x23, 0x08, 0x8a, 0x71, 0x1a,
-  0x60, 0x06, 0x83, 0x17, 0xc1, 0x6e, 0x1a, 0x2e, 0x7f, 0xc2, 0x1e, 0x42,
-  0xf2, 0x57, 0x42, 0x5a, 0x89, 0xc9, 0x47, 0x6e, 0x1b, 0x15, 0x83, 0xc1,
-  0x60, 0x30, 0x28, 0x85, 0x6c, 0x70, 0x1a, 0x0c, 0x68, 0x76, 0xd3, 0x70,
-  0xf9, 0x13, 0xf6, 0x10, 0x92, 0xbf, 0x12, 0xd2, 0x4a, 0x4c, 0x7e, 0x71,
-  0xdb, 0xa8, 0x00, 0x00, 0x00, 0x80, 0x41, 0x29, 0x6a, 0x83, 0xd3, 0x60,
-  0x40, 0xb6, 0x81, 0x80, 0xb3, 0x84, 0x05, 0x90, 0x24, 0x9f, 0x01, 0xa6,
-  0x08, 0xb9, 0xfc, 0x62, 0x71, 0x80, 0xc9, 0xc7, 0x7d, 0x1c, 0x05, 0x8e,
-  0x6b, 0xa4, 0x29, 0xa2, 0x84, 0xc9, 0xe7, 0x00, 0x86, 0x88, 0x00, 0xe4,
-  0xe4, 0x72, 0xb9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x70, 0x8b, 0x34, 0x45, 0x94, 0x30, 0xf9, 0x9b, 0xd3, 0x10, 0x48, 0xc8,
-  0xe5, 0x66, 0xe2, 0xc6, 0x81, 0x1d, 0xc2, 0x61, 0x1e, 0xe6, 0xc1, 0x0d,
-  0x66, 0x81, 0x1e, 0xe4, 0xa1, 0x1e, 0xc6, 0x81, 0x1e, 0xea, 0x41, 0x1e,
-  0xca, 0x81, 0x1c, 0x44, 0xa1, 0x1e, 0xcc, 0xc1, 0x1c, 0xca, 0x41, 0x1e,
-  0xf8, 0x40, 0x14, 0xde, 0xc1, 0x1d, 0xca, 0xc1, 0x0f, 0x50, 0xb0, 0xcb,
-  0x81, 0xc0, 0x59, 0xc2, 0x02, 0x48, 0x92, 0xcf, 0x00, 0x53, 0x84, 0x5c,
-  0x7e, 0xb1, 0x38, 0xc0, 0xe4, 0xdf, 0xfe, 0x8d, 0x82, 0xde, 0x30, 0x82,
-  0x00, 0xdc, 0x23, 0x4d, 0x11, 0x25, 0x4c, 0x7e, 0xba, 0xad, 0x62, 0xf3,
-  0x50, 0x13, 0x3a, 0x1a, 0x8d, 0x80, 0xef, 0x67, 0x18, 0x1c, 0x23, 0x00,
-  0x0c, 0x11, 0x01, 0x1b, 0x55, 0x14, 0x44, 0x84, 0x02, 0x5d, 0xaa, 0x0c,
-  0xe6, 0x08, 0x40, 0x01, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87,
-  0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87,
-  0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00,
-  0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30,
-  0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0,
-  0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60,
-  0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60,
-  0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0,
-  0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40,
-  0x07, 0x3a, 0x0f, 0xa4, 0x90, 0x21, 0x23, 0x45, 0x44, 0x00, 0xa2, 0x01,
-  0x00, 0x73, 0x0d, 0x00, 0x80, 0x50, 0x00, 0x00, 0x9c, 0x02, 0x00, 0x18,
-  0xf2, 0x58, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0xe4, 0xc9, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0xc8, 0xb3, 0x01, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xc0, 0x90, 0xa7, 0x03, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x80, 0x21, 0xcf, 0x07, 0x04, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x9e, 0x30, 0x00, 0x02, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0xcf, 0x18, 0x00, 0x01,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0x07, 0x0d,
-  0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8,
-  0xb3, 0x06, 0x40, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0xe4, 0x69, 0x03, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x18, 0xf2, 0xc0, 0x01, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0xe6, 0x00, 0x08, 0x80, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x76, 0x00, 0x04, 0xc0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x20, 0x00, 0x47,
-  0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x1c, 0x19, 0x11, 0x4c, 0x90, 0x8c,
-  0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x1a, 0x16, 0x08, 0x0d, 0x4a, 0x60,
-  0x04, 0xa0, 0x18, 0x0a, 0xa3, 0x80, 0x03, 0x0a, 0x50, 0xa0, 0x10, 0x0a,
-  0x9c, 0xa0, 0x0c, 0xca, 0xa1, 0x14, 0x8a, 0xa0, 0x24, 0x0a, 0x30, 0xa0,
-  0x00, 0x07, 0x0a, 0x90, 0xa0, 0x30, 0x09, 0x0a, 0x94, 0xa0, 0x50, 0x09,
-  0x0a, 0x96, 0xa0, 0x70, 0x09, 0x0a, 0x98, 0xa0, 0x90, 0x09, 0x0a, 0x9a,
-  0xa0, 0xb0, 0x09, 0x0a, 0x3b, 0xa0, 0x40, 0x0a, 0x36, 0xa0, 0x70, 0x03,
-  0x0a, 0xa2, 0x60, 0x0a, 0xa5, 0x30, 0x05, 0x0a, 0xa8, 0xc0, 0x0a, 0x3c,
-  0xa0, 0x20, 0x05, 0xca, 0xa3, 0x28, 0xca, 0xa2, 0x50, 0x07, 0xca, 0xf4,
-  0xa0, 0x4c, 0x4a, 0xa7, 0x90, 0x08, 0x53, 0x02, 0x45, 0x50, 0x0a, 0x85,
-  0x50, 0x06, 0x23, 0x00, 0x25, 0x41, 0x8c, 0x19, 0x00, 0x7a, 0xcc, 0x00,
-  0x10, 0x64, 0x06, 0x80, 0x22, 0x33, 0x00, 0x24, 0x99, 0x01, 0xa0, 0xc9,
-  0x0c, 0x00, 0x51, 0x66, 0x00, 0x68, 0x31, 0x03, 0x40, 0x8a, 0x19, 0x00,
-  0x4a, 0xcc, 0x00, 0x10, 0x62, 0x06, 0x80, 0x0e, 0x33, 0x00, 0x64, 0x98,
-  0x01, 0x20, 0xc2, 0x0c, 0x00, 0xe9, 0x66, 0x00, 0x68, 0x37, 0x03, 0x40,
-  0xbc, 0x19, 0x00, 0x02, 0xce, 0x00, 0x50, 0x70, 0x06, 0x80, 0x84, 0x63,
-  0xa9, 0x01, 0x35, 0x06, 0xff, 0x1f, 0x00, 0xff, 0x1f, 0x00, 0xff, 0x1f,
-  0x00, 0x00, 0x00, 0x82, 0x38, 0x6b, 0x00, 0x20, 0x88, 0xb3, 0x06, 0x00,
-  0x82, 0x38, 0x6b, 0x00, 0x20, 0x08, 0x82, 0x10, 0x00, 0x82, 0xac, 0x39,
-  0x00, 0x20, 0xc8, 0x9a, 0x03, 0x00, 0x82, 0xac, 0x39, 0x00, 0x20, 0x08,
-  0x82, 0x60, 0x00, 0xfc, 0x7f, 0xef, 0x1e, 0xc0, 0xff, 0xf7, 0xee, 0x01,
-  0xfc, 0x7f, 0xef, 0x1e, 0xc0, 0xff, 0xf7, 0xee, 0x01, 0xfc, 0x7f, 0xef,
-  0x1e, 0xc0, 0xff, 0xf7, 0xee, 0x01, 0xfc, 0x7f, 0xef, 0x1e, 0xc0, 0xff,
-  0xf7, 0xee, 0x01, 0x90, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-  0x18, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46,
-  0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b,
-  0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1,
-  0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa,
-  0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10,
-  0x04, 0x13, 0x84, 0x41, 0x9a, 0x20, 0x0c, 0xd3, 0x06, 0x61, 0x20, 0x36,
-  0x08, 0x04, 0x41, 0xc1, 0x6e, 0x6e, 0x82, 0x30, 0x50, 0x1b, 0x86, 0x03,
-  0x21, 0x26, 0x08, 0xc9, 0x2b, 0x70, 0x9a, 0x5b, 0x4b, 0x73, 0x73, 0x2b,
-  0x23, 0x7b, 0x12, 0x53, 0x2b, 0x1b, 0xa3, 0x13, 0xaa, 0x33, 0x33, 0x2b,
-  0x93, 0x9b, 0x20, 0x0c, 0xd5, 0x04, 0x61, 0xb0, 0x36, 0x08, 0x43, 0xb3,
-  0x21, 0x21, 0x94, 0x85, 0x20, 0x06, 0x86, 0x70, 0x26, 0x08, 0x14, 0x2b,
-  0x50, 0x11, 0x7b, 0x73, 0x2b, 0x13, 0xaa, 0x33, 0x33, 0x2b, 0x93, 0x9b,
-  0x20, 0x0c, 0xd7, 0x06, 0x61, 0x90, 0x36, 0x24, 0x03, 0x14, 0x11, 0xc3,
-  0xc0, 0x10, 0xd3, 0x06, 0xe1, 0xa1, 0x26, 0x08, 0x8c, 0x29, 0xb0, 0x91,
-  0x7b, 0x7b, 0xa3, 0x1b, 0x7a, 0x73, 0x9b, 0xa3, 0x0b, 0x73, 0xa3, 0x9b,
-  0x9b, 0x20, 0x0c, 0xd8, 0x06, 0x84, 0xb0, 0x2e, 0x82, 0x18, 0x30, 0x60,
-  0x82, 0x10, 0xa5, 0x02, 0x99, 0xb1, 0xb0, 0xb6, 0x32, 0xb9, 0x30, 0xa1,
-  0x3a, 0x33, 0xb3, 0x32, 0xb9, 0x09, 0xc2, 0x90, 0x6d, 0x40, 0x06, 0x6d,
-  0x23, 0x86, 0x81, 0x03, 0x36, 0x08, 0x59, 0xb7, 0x81, 0xa8, 0x00, 0x0f,
-  0x98, 0x20, 0x28, 0xae, 0x40, 0xe4, 0x4d, 0x4c, 0xad, 0x6c, 0x8c, 0x2e,
-  0x89, 0x68, 0x82, 0x30, 0x68, 0x13, 0x84, 0x61, 0x9b, 0x20, 0x0c, 0xdc,
-  0x06, 0x03, 0x09, 0x03, 0x31, 0x20, 0xc6, 0x80, 0x0c, 0x36, 0x08, 0x58,
-  0x19, 0x4c, 0x10, 0xf4, 0x80, 0x16, 0xa8, 0xd8, 0xa5, 0x95, 0xdd, 0x35,
-  0x85, 0xd1, 0xc9, 0xa5, 0xe1, 0x4d, 0x10, 0x86, 0x6e, 0xc3, 0x80, 0x61,
-  0x69, 0x30, 0x41, 0x18, 0xbc, 0x0d, 0x08, 0x82, 0x06, 0x69, 0xa0, 0x06,
-  0x62, 0x40, 0x8c, 0xc1, 0x1a, 0x50, 0x81, 0x93, 0x7b, 0x53, 0x6b, 0x0a,
-  0xa3, 0x93, 0x4b, 0xc3, 0x9b, 0x20, 0x0c, 0xdf, 0x06, 0x04, 0x69, 0x83,
-  0x34, 0x50, 0x03, 0x31, 0x70, 0x83, 0x31, 0x58, 0x03, 0x36, 0x69, 0x6e,
-  0x76, 0x50, 0x72, 0x6f, 0x6a, 0x4d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x1b,
-  0x10, 0x04, 0x0e, 0xd2, 0x40, 0x0d, 0xc4, 0x40, 0x1a, 0x83, 0x35, 0xa0,
-  0x63, 0x97, 0x56, 0x76, 0x07, 0x25, 0xf7, 0xa6, 0xd6, 0x14, 0x46, 0x27,
-  0x97, 0x86, 0x37, 0x41, 0x18, 0xc0, 0x60, 0x03, 0x82, 0xc8, 0x41, 0x1a,
-  0xa8, 0x81, 0x18, 0xcc, 0xc1, 0x18, 0xac, 0x01, 0x11, 0xb8, 0xb7, 0xb9,
-  0x34, 0xba, 0xb4, 0x37, 0xb7, 0x09, 0xc2, 0x10, 0x06, 0x1b, 0x0c, 0xa4,
-  0x0e, 0xc4, 0xc0, 0x0e, 0xc6, 0x60, 0x0d, 0x88, 0xc0, 0x85, 0x91, 0x91,
-  0xa5, 0xb9, 0x9d, 0xc1, 0x4c, 0x10, 0x06, 0x31, 0xd8, 0x60, 0x20, 0x78,
-  0x20, 0x06, 0x79, 0x30, 0x06, 0x6b, 0xc0, 0xc4, 0x4c, 0xae, 0x6e, 0x8e,
-  0xae, 0xae, 0x0d, 0x0b, 0x6b, 0x82, 0x30, 0x8c, 0xc1, 0x06, 0x03, 0xd9,
-  0x03, 0x31, 0xe0, 0x83, 0x31, 0x58, 0x03, 0x26, 0x66, 0x72, 0x75, 0x73,
-  0x74, 0x75, 0x6d, 0x58, 0x5a, 0x13, 0x84, 0x81, 0x0c, 0x36, 0x18, 0x88,
-  0x1f, 0x88, 0xc1, 0x1f, 0x8c, 0xc1, 0x1a, 0x30, 0x31, 0x93, 0xab, 0x9b,
-  0xa3, 0xab, 0x6b, 0xcb, 0xca, 0x9a, 0x20, 0x0c, 0x65, 0xb0, 0xc1, 0x40,
-  0x42, 0x41, 0x0c, 0x44, 0x61, 0x0c, 0xd6, 0x80, 0x89, 0x99, 0x5c, 0xdd,
-  0x1c, 0x5d, 0x5d, 0x5b, 0x96, 0xd6, 0x04, 0x61, 0x30, 0x83, 0x0d, 0x06,
-  0x42, 0x0a, 0x62, 0x50, 0x0a, 0x63, 0xb0, 0x06, 0x2c, 0xdc, 0xca, 0xc2,
-  0xe4, 0xb4, 0x26, 0x08, 0xc3, 0x19, 0x6c, 0x30, 0x90, 0x53, 0x10, 0x03,
-  0x54, 0x18, 0x83, 0x35, 0x20, 0x61, 0x16, 0x26, 0xa7, 0x35, 0x41, 0x18,
-  0xd0, 0x60, 0x83, 0x81, 0xa8, 0x82, 0x18, 0xac, 0xc2, 0x18, 0xac, 0x01,
-  0xa1, 0x31, 0xb6, 0xba, 0x39, 0xba, 0x32, 0xb9, 0xa1, 0x37, 0xb7, 0x39,
-  0xba, 0x30, 0x37, 0xba, 0xa0, 0x09, 0xc2, 0x90, 0x06, 0x1b, 0x0c, 0xa4,
-  0x15, 0xc4, 0xc0, 0x15, 0xc6, 0x60, 0x0d, 0x08, 0x8d, 0xb1, 0xd5, 0xcd,
-  0xd1, 0x95, 0xc9, 0x0d, 0xbd, 0xb9, 0xcd, 0xd1, 0x85, 0xb9, 0xd1, 0x09,
-  0x4d, 0x10, 0x06, 0x35, 0xd8, 0x60, 0x20, 0xb0, 0x20, 0x06, 0xb1, 0x30,
-  0x06, 0x6b, 0xb0, 0xe1, 0xe1, 0xd8, 0xe0, 0x0d, 0xe2, 0x80, 0x0e, 0xee,
-  0x40, 0x0f, 0xfa, 0x00, 0x14, 0x46, 0xc1, 0x14, 0x52, 0x81, 0x15, 0x5e,
-  0x41, 0x16, 0x26, 0x08, 0x08, 0x2c, 0x4c, 0x10, 0x86, 0x35, 0x60, 0x80,
-  0xb6, 0x81, 0x40, 0x6c, 0x41, 0x0c, 0x88, 0x09, 0xc2, 0x11, 0x0b, 0x1b,
-  0x04, 0x02, 0x17, 0x36, 0x04, 0xb9, 0xb0, 0x41, 0x20, 0x74, 0x61, 0xc3,
-  0x50, 0x0b, 0xb7, 0xb0, 0x0b, 0x74, 0xc4, 0xde, 0xea, 0xdc, 0xc8, 0xd2,
-  0xdc, 0xce, 0xa6, 0xe0, 0xd0, 0xca, 0xe4, 0xca, 0x36, 0x10, 0x48, 0x2f,
-  0x88, 0x01, 0x41, 0x82, 0xed, 0x8d, 0x6c, 0x6e, 0x82, 0x30, 0xb0, 0xc1,
-  0x06, 0x02, 0xf9, 0x05, 0x31, 0x00, 0x07, 0x22, 0x6d, 0x61, 0x74, 0x65,
-  0x72, 0x69, 0x61, 0x6c, 0x1b, 0x08, 0x44, 0x1c, 0xc4, 0xc0, 0x0d, 0x98,
-  0x88, 0xbd, 0xb9, 0x95, 0x25, 0xb9, 0x91, 0x95, 0xe1, 0x4d, 0x10, 0x86,
-  0x36, 0xd8, 0x60, 0x20, 0xe4, 0x20, 0x06, 0xe5, 0x30, 0x06, 0x64, 0xc0,
-  0xc2, 0x8c, 0x2d, 0xec, 0x6c, 0x6e, 0x82, 0x30, 0xb8, 0xc1, 0x06, 0x03,
-  0x39, 0x07, 0x31, 0x40, 0x87, 0x31, 0x20, 0x03, 0x1e, 0x70, 0x61, 0x64,
-  0x64, 0x69, 0x6e, 0x67, 0x1b, 0x0c, 0x44, 0x1d, 0xc4, 0xa0, 0x19, 0x83,
-  0x35, 0xd8, 0x70, 0xd4, 0x82, 0x2f, 0x84, 0xc3, 0x38, 0x98, 0x43, 0x3a,
-  0xac, 0xc3, 0x04, 0x41, 0xd0, 0x05, 0x1a, 0x63, 0x65, 0x6e, 0x74, 0x65,
-  0x72, 0x1b, 0x0c, 0xc4, 0x1d, 0xc4, 0x80, 0x18, 0x83, 0x35, 0xa0, 0x21,
-  0x17, 0x46, 0x96, 0x56, 0x37, 0xb7, 0xc1, 0x40, 0xe0, 0x41, 0x0c, 0x98,
-  0x31, 0x58, 0x83, 0x0d, 0x03, 0x38, 0xbc, 0x43, 0x3c, 0x4c, 0x10, 0x88,
-  0x59, 0xa0, 0x32, 0x47, 0x17, 0x26, 0x47, 0x97, 0xe4, 0x46, 0x56, 0x86,
-  0xb7, 0xc1, 0x40, 0xe8, 0x41, 0x0c, 0x88, 0x31, 0x20, 0x03, 0x2a, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x1b, 0x0c, 0xc4,
-  0x1e, 0xc4, 0x00, 0x1b, 0x03, 0x32, 0x20, 0x63, 0x57, 0x26, 0x47, 0x57,
-  0x86, 0xf7, 0x64, 0x66, 0x36, 0x57, 0x46, 0x37, 0x41, 0x18, 0xde, 0x60,
-  0x83, 0x81, 0xe0, 0x83, 0x18, 0xe4, 0xc3, 0x18, 0x90, 0xc1, 0x06, 0x82,
-  0xa9, 0x87, 0x7b, 0xd0, 0x87, 0x09, 0x82, 0x21, 0x0b, 0x13, 0x84, 0x01,
-  0x0e, 0xb8, 0x88, 0x85, 0xcd, 0x95, 0x0d, 0xbd, 0xb1, 0xbd, 0xc9, 0x25,
-  0x11, 0x6d, 0x30, 0x10, 0x7f, 0x10, 0x03, 0x62, 0x0c, 0xc8, 0x80, 0x88,
-  0xdb, 0x9b, 0x5c, 0x5b, 0x18, 0x5b, 0x12, 0xd1, 0x06, 0x03, 0x01, 0x09,
-  0x31, 0xc0, 0xc6, 0x80, 0x0c, 0xd8, 0xc8, 0xbd, 0xd5, 0x9d, 0xa1, 0xb9,
-  0x95, 0xcd, 0xcd, 0x05, 0x3d, 0x25, 0x11, 0x6d, 0x30, 0x10, 0x91, 0x10,
-  0x83, 0x7c, 0x18, 0x03, 0x32, 0xa0, 0xd2, 0x56, 0x46, 0x17, 0xc6, 0xc6,
-  0x96, 0x36, 0x96, 0x44, 0xb4, 0xc1, 0x40, 0x48, 0x42, 0x0c, 0x98, 0x31,
-  0x20, 0x03, 0x22, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x49, 0x44, 0x1b,
-  0x0c, 0xc4, 0x24, 0xc4, 0x00, 0x1c, 0xc6, 0x80, 0x0c, 0x98, 0xcc, 0xc1,
-  0x95, 0x8d, 0xa5, 0x85, 0xb1, 0x25, 0x11, 0x4d, 0x10, 0x86, 0x38, 0xd8,
-  0x60, 0x20, 0x28, 0x21, 0x06, 0x29, 0x31, 0x06, 0x64, 0xb0, 0xe1, 0xe8,
-  0x87, 0x7f, 0x08, 0x89, 0x91, 0x28, 0x89, 0x93, 0x50, 0x89, 0x09, 0x02,
-  0x1f, 0xd8, 0xc2, 0x04, 0x61, 0x0f, 0x6a, 0x61, 0x83, 0x40, 0xb4, 0xc4,
-  0x86, 0xc0, 0x25, 0x36, 0x08, 0xc4, 0x4b, 0x6c, 0x18, 0xa4, 0x5b, 0x80,
-  0x09, 0x2e, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x4d, 0x61, 0x74, 0x72, 0x69,
-  0x78, 0x1b, 0x10, 0x44, 0x26, 0xd2, 0x40, 0x0d, 0xc4, 0x80, 0x18, 0x83,
-  0x35, 0xa0, 0x93, 0xe6, 0x66, 0x77, 0xf5, 0x26, 0xc7, 0x46, 0xd6, 0x14,
-  0x46, 0x27, 0x97, 0x86, 0xb7, 0x01, 0x41, 0x68, 0x22, 0x0d, 0xd4, 0x40,
-  0x0c, 0xdc, 0x60, 0x0c, 0xd6, 0x60, 0xc3, 0x20, 0xcd, 0x44, 0x4d, 0x4c,
-  0x10, 0x40, 0xe1, 0x16, 0x26, 0x08, 0x83, 0x1c, 0x70, 0x99, 0xb2, 0xfa,
-  0x82, 0x7a, 0x9a, 0x4a, 0xa2, 0x4a, 0x7a, 0x72, 0xda, 0x80, 0x20, 0x75,
-  0x20, 0x06, 0x04, 0x96, 0x13, 0x63, 0xb0, 0x06, 0x3c, 0xc6, 0xd8, 0xd2,
-  0xe0, 0xa0, 0xde, 0xe6, 0x98, 0x40, 0x3d, 0x4d, 0x25, 0x51, 0x25, 0x3d,
-  0x39, 0xc1, 0x6c, 0x40, 0x90, 0x9d, 0x10, 0x03, 0x70, 0xc0, 0x78, 0x62,
-  0x0c, 0xd6, 0x80, 0xc8, 0xdd, 0x9b, 0x1c, 0x1b, 0x19, 0xd4, 0xdb, 0xdc,
-  0x04, 0x61, 0x98, 0x03, 0x26, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f,
-  0x4e, 0x31, 0x1b, 0x10, 0xc4, 0x27, 0xc4, 0xe0, 0x27, 0x30, 0xb0, 0x18,
-  0x83, 0x35, 0xe0, 0x40, 0x27, 0xe6, 0xb6, 0x61, 0x10, 0x03, 0x31, 0x48,
-  0x83, 0x09, 0xc2, 0x40, 0x07, 0x54, 0xa8, 0x84, 0x9c, 0xbe, 0x9a, 0x82,
-  0xa8, 0xa4, 0x92, 0xb0, 0x36, 0x28, 0x88, 0x58, 0xa4, 0xc1, 0x58, 0x88,
-  0x01, 0x59, 0x60, 0x65, 0x31, 0x06, 0x6b, 0xc0, 0x81, 0xae, 0x0c, 0x8f,
-  0x08, 0x55, 0x11, 0xd6, 0xd0, 0xd3, 0x93, 0x14, 0xd1, 0x06, 0x04, 0x39,
-  0x0b, 0x31, 0x68, 0x30, 0xb4, 0x18, 0x83, 0x35, 0x98, 0x20, 0x0c, 0x75,
-  0x40, 0xa4, 0x29, 0x88, 0xaa, 0x48, 0x2a, 0x29, 0x88, 0x69, 0x83, 0x81,
-  0x88, 0x83, 0x18, 0xa8, 0x05, 0xb6, 0x16, 0x13, 0x84, 0xc1, 0x0e, 0xc8,
-  0x3c, 0x09, 0x29, 0x15, 0x0d, 0x51, 0x7d, 0x19, 0x31, 0x05, 0x1d, 0x4d,
-  0x6d, 0x40, 0x90, 0x73, 0x10, 0x83, 0xb6, 0xc0, 0xdc, 0x62, 0x0c, 0xc8,
-  0x60, 0x03, 0x82, 0x13, 0x3a, 0xd1, 0x13, 0x61, 0x61, 0x16, 0x69, 0xc1,
-  0x16, 0x6f, 0x31, 0x41, 0x58, 0x5a, 0x61, 0x03, 0x81, 0x5c, 0x62, 0x40,
-  0x6c, 0x10, 0x30, 0xb9, 0x98, 0x20, 0x84, 0x02, 0x2e, 0x6c, 0x20, 0x90,
-  0x4d, 0x0c, 0x88, 0x0d, 0x02, 0x57, 0x17, 0x13, 0x84, 0xe7, 0x14, 0x26,
-  0x08, 0x10, 0x2a, 0x4c, 0x10, 0x24, 0x55, 0x98, 0x20, 0x4c, 0xab, 0xb0,
-  0x21, 0x0c, 0x08, 0x30, 0x30, 0x83, 0x33, 0x98, 0x05, 0x5a, 0xe0, 0x05,
-  0x5c, 0x60, 0x87, 0x76, 0x90, 0x87, 0x79, 0xd8, 0x07, 0x7e, 0x58, 0x09,
-  0x96, 0x88, 0x89, 0x96, 0xb0, 0x89, 0x9b, 0x80, 0x8b, 0xb8, 0x98, 0x0b,
-  0xba, 0xb0, 0x8b, 0xbb, 0x98, 0x05, 0xbc, 0xb0, 0x8b, 0xbc, 0xb0, 0x09,
-  0xbd, 0x88, 0x89, 0x09, 0xc2, 0x45, 0x6c, 0x00, 0x36, 0x0c, 0x44, 0x5f,
-  0xf4, 0xc5, 0x86, 0xc0, 0x2f, 0x36, 0x0c, 0x03, 0x5f, 0xfc, 0xc5, 0x04,
-  0x41, 0x14, 0x72, 0x61, 0x43, 0x10, 0x1a, 0x24, 0xda, 0xc2, 0xd2, 0xdc,
-  0x88, 0x40, 0x3d, 0x4d, 0x25, 0x51, 0x25, 0x3d, 0x39, 0x4d, 0x10, 0xb0,
-  0x52, 0x98, 0x20, 0x60, 0xa4, 0xb0, 0x21, 0x20, 0x26, 0x08, 0xd8, 0x28,
-  0x6c, 0x10, 0xc4, 0x60, 0x0c, 0x36, 0x2c, 0x04, 0x69, 0x94, 0x86, 0x69,
-  0x9c, 0x86, 0x69, 0x0c, 0xa8, 0x41, 0x98, 0x46, 0x6a, 0xd0, 0x70, 0x7a,
-  0x92, 0x6a, 0x0a, 0x62, 0x9a, 0x20, 0x60, 0xa2, 0x30, 0x41, 0x18, 0xee,
-  0x60, 0x83, 0x20, 0x06, 0xad, 0xb1, 0x61, 0x19, 0x56, 0xa3, 0x34, 0x4c,
-  0xe3, 0x34, 0x4c, 0x63, 0x60, 0x8d, 0xc1, 0x34, 0x5c, 0x83, 0x07, 0x55,
-  0x90, 0xd3, 0x51, 0x91, 0x13, 0xd5, 0x86, 0x25, 0x0d, 0x60, 0xa3, 0x34,
-  0x4c, 0xe3, 0x34, 0x4c, 0x63, 0x60, 0x8d, 0x34, 0x30, 0x0d, 0xd7, 0x20,
-  0x23, 0xc4, 0x54, 0xe4, 0x44, 0x94, 0xe4, 0x44, 0x94, 0x34, 0x54, 0x34,
-  0x35, 0x41, 0xc0, 0x42, 0x61, 0xc3, 0x22, 0x06, 0xb2, 0x31, 0x1b, 0xa6,
-  0x71, 0x1a, 0xa6, 0x31, 0xb0, 0x86, 0x18, 0x98, 0x86, 0x6b, 0x90, 0x11,
-  0x62, 0x2a, 0x72, 0x22, 0xba, 0x2a, 0x4a, 0x3a, 0x42, 0xa2, 0x9a, 0xda,
-  0xb0, 0x60, 0xb5, 0x51, 0x1a, 0xa6, 0x71, 0x1a, 0xa6, 0x31, 0xb0, 0x06,
-  0x66, 0x1a, 0xae, 0xb1, 0xa1, 0x50, 0x8d, 0xd7, 0x88, 0x0d, 0xda, 0xb0,
-  0x0d, 0x2e, 0x53, 0x56, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f,
-  0x6e, 0x1b, 0x16, 0x02, 0x37, 0x4a, 0x03, 0x35, 0x4e, 0x83, 0x35, 0x06,
-  0xd6, 0x20, 0x4c, 0xc3, 0x35, 0x26, 0x08, 0x18, 0x28, 0x6c, 0x58, 0x06,
-  0xd2, 0x28, 0x0d, 0xd3, 0x38, 0x0d, 0xdd, 0x18, 0x58, 0x63, 0x30, 0x0d,
-  0xd7, 0xd8, 0x10, 0x0c, 0x1b, 0x96, 0x34, 0x20, 0x8d, 0xd2, 0x30, 0x0d,
-  0xde, 0xd0, 0x8d, 0x01, 0x35, 0xd2, 0xc0, 0x34, 0x52, 0x63, 0xc3, 0x40,
-  0x0c, 0x69, 0xb0, 0x61, 0x11, 0x83, 0xb2, 0x28, 0x0d, 0xd3, 0xf0, 0x0d,
-  0xdd, 0x10, 0x03, 0xd4, 0x10, 0x03, 0xd3, 0x48, 0x8d, 0x0d, 0x82, 0x18,
-  0x88, 0xc1, 0x86, 0x05, 0x43, 0x8b, 0xd2, 0x30, 0x8d, 0xd3, 0xd0, 0x8d,
-  0x41, 0x37, 0x10, 0xd3, 0x00, 0x8f, 0x09, 0x02, 0xf6, 0x07, 0x1b, 0x04,
-  0x31, 0x18, 0x36, 0x2c, 0x64, 0xb0, 0x16, 0xb3, 0x61, 0x1a, 0xa7, 0x21,
-  0x1e, 0x83, 0x78, 0x8c, 0x81, 0x69, 0x8c, 0xc7, 0x86, 0x05, 0x59, 0x8b,
-  0xd9, 0x30, 0x0d, 0xde, 0x10, 0x8f, 0x41, 0x3c, 0xc6, 0x40, 0x3c, 0xc6,
-  0x63, 0x43, 0x90, 0x06, 0x1b, 0x96, 0x31, 0x58, 0x8b, 0xd9, 0x30, 0x0d,
-  0xf3, 0x10, 0x8f, 0x41, 0x3c, 0xc6, 0x40, 0x37, 0xc6, 0x63, 0x43, 0x20,
-  0x06, 0x1b, 0x96, 0x7c, 0x58, 0x8b, 0xd9, 0x30, 0x0d, 0xf4, 0x10, 0x8f,
-  0x41, 0x3c, 0xc6, 0x00, 0x35, 0xc6, 0x63, 0x43, 0x80, 0x6d, 0x58, 0xd6,
-  0x60, 0x2d, 0x66, 0xc3, 0x34, 0xd4, 0x43, 0x3c, 0x06, 0xf1, 0xc8, 0x07,
-  0xd3, 0x18, 0x8f, 0x09, 0xc2, 0x80, 0x07, 0x1b, 0x02, 0x32, 0xd8, 0xb0,
-  0xb0, 0xc7, 0x5a, 0xcc, 0x86, 0x69, 0xb4, 0x87, 0x78, 0x0c, 0xe2, 0x91,
-  0x0f, 0xe2, 0x31, 0x1e, 0x13, 0x84, 0x21, 0x0f, 0x36, 0x2c, 0xef, 0xe1,
-  0x16, 0xb3, 0x61, 0x1a, 0xa7, 0x21, 0x1e, 0x83, 0x78, 0xe4, 0x83, 0x6e,
-  0x8c, 0xc7, 0x06, 0x26, 0x37, 0x76, 0xa3, 0x37, 0x7e, 0x23, 0x3c, 0xc8,
-  0xa3, 0x3c, 0xce, 0x23, 0x3d, 0xd6, 0xc3, 0x3d, 0xe0, 0x63, 0xc3, 0x70,
-  0x1b, 0xf1, 0x01, 0x4c, 0x10, 0x46, 0x21, 0xda, 0x20, 0x10, 0xf3, 0xb1,
-  0xa1, 0xe0, 0x8b, 0xd1, 0x90, 0x8f, 0x8f, 0x3e, 0x68, 0x98, 0xb1, 0xbd,
-  0x85, 0xd1, 0xcd, 0x4d, 0x10, 0x06, 0x3d, 0x60, 0x91, 0xe6, 0x36, 0x47,
-  0x37, 0x37, 0x41, 0x18, 0xf6, 0x80, 0x44, 0x9a, 0x1b, 0xdd, 0x1c, 0x8d,
-  0xb9, 0xb4, 0xb3, 0x2f, 0x36, 0xb2, 0x09, 0xc2, 0xc0, 0x07, 0x34, 0xe6,
-  0xd2, 0xce, 0xbe, 0xe6, 0xe8, 0x26, 0x08, 0x43, 0x1f, 0x10, 0xa1, 0x2b,
-  0xc3, 0xfb, 0x62, 0x7b, 0x0b, 0x23, 0x9b, 0x20, 0x0c, 0x7e, 0xb0, 0x81,
-  0xb1, 0x8f, 0xfb, 0xc0, 0x8f, 0xfc, 0xd0, 0x0f, 0x6c, 0x3f, 0xf8, 0xa3,
-  0x3f, 0xfc, 0xe3, 0x3f, 0x40, 0xa4, 0x0a, 0x1b, 0x9b, 0x5d, 0x9b, 0x4b,
-  0x1a, 0x59, 0x99, 0x1b, 0xdd, 0x94, 0x20, 0xa8, 0x42, 0x86, 0xe7, 0x62,
-  0x57, 0x26, 0x37, 0x97, 0xf6, 0xe6, 0x36, 0x25, 0x20, 0x9a, 0x90, 0xe1,
-  0xb9, 0xd8, 0x85, 0xb1, 0xd9, 0x95, 0xc9, 0x4d, 0x09, 0x8a, 0x3a, 0x64,
-  0x78, 0x2e, 0x73, 0x68, 0x61, 0x64, 0x65, 0x72, 0x4d, 0x6f, 0x64, 0x65,
-  0x6c, 0x53, 0x02, 0xa4, 0x0c, 0x19, 0x9e, 0x8b, 0x5c, 0xd9, 0xdc, 0x5b,
-  0x9d, 0xdc, 0x58, 0xd9, 0xdc, 0x94, 0xc0, 0xab, 0x44, 0x86, 0xe7, 0x42,
-  0x97, 0x07, 0x57, 0x16, 0xe4, 0xe6, 0xf6, 0x46, 0x17, 0x46, 0x97, 0xf6,
-  0xe6, 0x36, 0x37, 0x45, 0xd0, 0x8b, 0xbf, 0xa8, 0x43, 0x86, 0xe7, 0x62,
-  0x97, 0x56, 0x76, 0x97, 0x44, 0x36, 0x45, 0x17, 0x46, 0x57, 0x36, 0x25,
-  0x08, 0x8d, 0x3a, 0x64, 0x78, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x50,
-  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x53, 0x02, 0xfa, 0xe8, 0x42, 0x86, 0xe7,
-  0x32, 0xf6, 0x56, 0xe7, 0x46, 0x57, 0x26, 0x37, 0x37, 0x25, 0x00, 0x11,
-  0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33,
-  0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43,
-  0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98,
-  0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33,
-  0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05,
-  0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43,
-  0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08,
-  0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78,
-  0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1,
-  0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33,
-  0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e,
-  0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03,
-  0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60,
-  0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80,
-  0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8,
-  0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18,
-  0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee,
-  0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c,
-  0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c,
-  0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43,
-  0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3,
-  0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83,
-  0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21,
-  0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1,
-  0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6,
-  0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4,
-  0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x35,
-  0x40, 0x07, 0x81, 0x9f, 0xf8, 0xed, 0x2e, 0x0b, 0xeb, 0x66, 0x73, 0x59,
-  0x0e, 0x04, 0xce, 0xac, 0x3f, 0xd2, 0x94, 0x2e, 0xaf, 0x8f, 0xe9, 0x75,
-  0x79, 0x99, 0x2c, 0xac, 0x9b, 0xcd, 0x65, 0x39, 0xb0, 0x2a, 0x7c, 0xbb,
-  0xcb, 0x40, 0x20, 0x10, 0x18, 0xfc, 0xb2, 0xcb, 0xe7, 0xf0, 0x38, 0x5f,
-  0x00, 0x7f, 0x10, 0xf8, 0xcd, 0xd7, 0x69, 0xb7, 0xbb, 0x4c, 0x7e, 0x8a,
-  0xd5, 0xe5, 0x31, 0x5d, 0x58, 0x37, 0x9b, 0xcb, 0x72, 0x20, 0x70, 0x66,
-  0xfd, 0x91, 0xa6, 0x74, 0x79, 0x7d, 0x4c, 0xaf, 0xcb, 0xcb, 0x64, 0x61,
-  0xdd, 0x6c, 0x2e, 0xcb, 0x81, 0xd5, 0xe9, 0x3a, 0xed, 0x76, 0x97, 0xc9,
-  0x4f, 0xb1, 0xba, 0x3c, 0xa6, 0x03, 0x81, 0x40, 0x60, 0xd0, 0x04, 0x26,
-  0x01, 0x60, 0x88, 0x08, 0xd8, 0xa8, 0xa2, 0x20, 0xa2, 0x7f, 0x21, 0x0c,
-  0x40, 0xc0, 0x0c, 0x82, 0x1a, 0x2e, 0xdf, 0x79, 0xfc, 0x80, 0x2a, 0x0a,
-  0x22, 0x2a, 0x1d, 0x60, 0xf0, 0x8b, 0xdb, 0xb6, 0x07, 0x6a, 0xb8, 0x7c,
-  0xe7, 0xf1, 0x03, 0xaa, 0x28, 0x88, 0xa8, 0x74, 0x80, 0xc1, 0x47, 0x6e,
-  0xdb, 0x18, 0xb6, 0xe1, 0xf2, 0x9d, 0xc7, 0x17, 0x02, 0xaa, 0x28, 0x88,
-  0xa8, 0x74, 0x80, 0xa1, 0x24, 0x0c, 0x40, 0xc0, 0xfc, 0xe2, 0xb6, 0x6d,
-  0x61, 0x1b, 0x2e, 0xdf, 0x79, 0x7c, 0x21, 0xa0, 0x8a, 0x82, 0x88, 0x4a,
-  0x07, 0x18, 0x4a, 0xc2, 0x00, 0x04, 0xcc, 0x47, 0x6e, 0xdb, 0x1c, 0xa4,
-  0xe1, 0xf2, 0x9d, 0xc7, 0x17, 0x22, 0x02, 0x98, 0x88, 0x10, 0x68, 0x86,
-  0x85, 0xb0, 0x04, 0x67, 0xb8, 0x7c, 0xe7, 0xf1, 0x07, 0x67, 0xba, 0xfd,
-  0xe2, 0xb6, 0xad, 0x60, 0x1a, 0x2e, 0xdf, 0x79, 0xfc, 0xc5, 0x01, 0x06,
-  0xb1, 0x79, 0xa8, 0xc9, 0x2f, 0x6e, 0xdb, 0x0c, 0xa6, 0xe1, 0xf2, 0x9d,
-  0xc7, 0x5f, 0x1c, 0x60, 0x10, 0x9b, 0x87, 0x9a, 0x7c, 0xe4, 0xb6, 0xed,
-  0xa0, 0x1a, 0x2e, 0xdf, 0x79, 0x7c, 0x69, 0x72, 0x22, 0x02, 0xa5, 0xa6,
-  0x87, 0x9a, 0xfc, 0xe2, 0xb6, 0x0d, 0xa1, 0x1a, 0x2e, 0xdf, 0x79, 0x7c,
-  0x69, 0x72, 0x22, 0x02, 0xa5, 0xa6, 0x87, 0x9a, 0x7c, 0xe4, 0xb6, 0xad,
-  0x41, 0x1a, 0x2e, 0xdf, 0x79, 0xfc, 0x89, 0x88, 0x26, 0x04, 0x88, 0x30,
-  0xbf, 0xb8, 0x6d, 0x53, 0x78, 0x86, 0xcb, 0x77, 0x1e, 0x9f, 0x6a, 0x80,
-  0x08, 0xf3, 0x8b, 0xdb, 0x36, 0x02, 0x82, 0x01, 0x90, 0xc6, 0x02, 0x9a,
-  0xc8, 0x71, 0x26, 0xce, 0x69, 0xa4, 0x09, 0x68, 0x26, 0x09, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48, 0x14, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x5e, 0xe3, 0xb9, 0x7a, 0x43, 0xec, 0x6f, 0xf5, 0x79,
-  0xeb, 0xf5, 0x97, 0xde, 0xab, 0xf6, 0x58, 0x44, 0x58, 0x49, 0x4c, 0x58,
-  0x17, 0x00, 0x00, 0x60, 0x00, 0x01, 0x00, 0xd6, 0x05, 0x00, 0x00, 0x44,
-  0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
-  0x17, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xcd,
-  0x05, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13,
-  0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06,
-  0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e,
-  0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xc4,
-  0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62, 0x88, 0x48,
-  0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4,
-  0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1,
-  0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40,
-  0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x6d,
-  0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49,
-  0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20,
-  0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0x93,
-  0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 0x04, 0x13,
-  0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12,
-  0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 0xec, 0xc1, 0x08, 0x40,
-  0x09, 0x00, 0x0a, 0x66, 0x00, 0xe6, 0x08, 0xc0, 0x60, 0x8e, 0x00, 0x29,
-  0xc6, 0x40, 0x10, 0x44, 0x41, 0x90, 0x51, 0x0c, 0x82, 0x20, 0x88, 0x82,
-  0x20, 0xa4, 0x18, 0x00, 0x41, 0x10, 0xc5, 0x40, 0x4a, 0x31, 0x00, 0x82,
-  0x20, 0x0a, 0x82, 0x98, 0x82, 0x0c, 0xc4, 0x30, 0x0c, 0xc3, 0x30, 0x90,
-  0x53, 0x86, 0x81, 0x18, 0x08, 0x3a, 0x6a, 0xb8, 0xfc, 0x09, 0x7b, 0x08,
-  0xc9, 0xe7, 0x36, 0xaa, 0x58, 0x89, 0xc9, 0x47, 0x6e, 0x1b, 0x11, 0x04,
-  0x41, 0x10, 0x54, 0xdc, 0x33, 0x5c, 0xfe, 0x84, 0x3d, 0x84, 0xe4, 0x87,
-  0x40, 0x33, 0x2c, 0x04, 0x0a, 0xa6, 0x42, 0x48, 0x04, 0x45, 0x50, 0x75,
-  0xd4, 0x70, 0xf9, 0x13, 0xf6, 0x10, 0x92, 0xcf, 0x6d, 0x54, 0xb1, 0x12,
-  0x93, 0x5f, 0xdc, 0x36, 0x22, 0x86, 0x61, 0x18, 0x0a, 0x71, 0x11, 0x14,
-  0x41, 0x58, 0x29, 0x06, 0x62, 0x18, 0x06, 0xd2, 0xe6, 0x08, 0x82, 0x62,
-  0x50, 0x44, 0x41, 0x10, 0x1c, 0x75, 0x37, 0x0d, 0x97, 0x3f, 0x61, 0x0f,
-  0x21, 0xf9, 0x2b, 0x21, 0xad, 0xc4, 0xe4, 0x23, 0xb7, 0x8d, 0x0a, 0x82,
-  0x20, 0x08, 0xa2, 0x14, 0x1f, 0x41, 0x11, 0x04, 0x81, 0x37, 0x0d, 0x97,
-  0x3f, 0x61, 0x0f, 0x21, 0xf9, 0x2b, 0x21, 0xad, 0xc4, 0xe4, 0x17, 0xb7,
-  0x8d, 0x8a, 0x61, 0x18, 0x06, 0xa2, 0x14, 0x22, 0x41, 0x11, 0x04, 0x8d,
-  0x03, 0x01, 0xc3, 0x08, 0xc3, 0x70, 0x95, 0x34, 0x45, 0x94, 0x30, 0xf9,
-  0x9b, 0x43, 0x35, 0x03, 0xd2, 0x18, 0xec, 0x73, 0x10, 0x11, 0x81, 0x04,
-  0x73, 0x38, 0x45, 0x9a, 0x22, 0x4a, 0x98, 0xfc, 0x12, 0xed, 0xd0, 0x40,
-  0x10, 0x44, 0x0e, 0xa0, 0xf7, 0x48, 0x53, 0x44, 0x09, 0x93, 0x6f, 0x02,
-  0x13, 0x11, 0x21, 0xc0, 0x82, 0x0c, 0x82, 0x20, 0x08, 0x82, 0x38, 0x4a,
-  0x9a, 0x22, 0x4a, 0x98, 0x7c, 0x56, 0x41, 0x9a, 0x86, 0x18, 0xd0, 0x20,
-  0x21, 0x84, 0x09, 0x19, 0x67, 0xaa, 0x12, 0x84, 0x39, 0x53, 0x19, 0x8c,
-  0x03, 0x3b, 0x84, 0xc3, 0x3c, 0xcc, 0x83, 0x1b, 0xcc, 0x02, 0x3d, 0xc8,
-  0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xd4, 0x83, 0x3c, 0x94, 0x03, 0x39, 0x88,
-  0x42, 0x3d, 0x98, 0x83, 0x39, 0x94, 0x83, 0x3c, 0xf0, 0xc1, 0x2c, 0xac,
-  0x43, 0x3a, 0xb8, 0x83, 0x3b, 0x94, 0x03, 0x39, 0xbc, 0x82, 0x38, 0xa8,
-  0x43, 0x39, 0x8c, 0x03, 0x3d, 0xf8, 0x01, 0x0a, 0x56, 0x62, 0x87, 0x11,
-  0x88, 0x21, 0x09, 0xdc, 0xfb, 0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68, 0x18,
-  0xa2, 0x99, 0xfc, 0x85, 0x30, 0x00, 0x01, 0xf3, 0xa5, 0x29, 0xa2, 0x84,
-  0xc9, 0xdf, 0x9c, 0x86, 0x40, 0xc2, 0xfb, 0xce, 0x04, 0x07, 0xe4, 0x80,
-  0x0f, 0x6e, 0x10, 0x0e, 0xec, 0x90, 0x0e, 0xe7, 0xe0, 0x0e, 0xed, 0x50,
-  0x0e, 0xee, 0x40, 0x0f, 0x6e, 0xc0, 0x0e, 0xe5, 0x70, 0x0e, 0xe1, 0x30,
-  0x0e, 0xf9, 0xe0, 0x06, 0xe3, 0xc0, 0x0e, 0xe1, 0x30, 0x0f, 0xf3, 0xe0,
-  0x06, 0xb3, 0x40, 0x0f, 0xf2, 0x50, 0x0f, 0xe3, 0x40, 0x0f, 0xf5, 0x20,
-  0x0f, 0xe5, 0x40, 0x0e, 0xa2, 0x50, 0x0f, 0xe6, 0x60, 0x0e, 0xe5, 0x20,
-  0x0f, 0x7c, 0x20, 0x0a, 0xef, 0xe0, 0x0e, 0xe5, 0xe0, 0x07, 0x28, 0x80,
-  0x29, 0x3e, 0x4a, 0x9a, 0x22, 0x4a, 0x98, 0xfc, 0xd5, 0x71, 0x26, 0xce,
-  0x69, 0xa4, 0x09, 0x68, 0x26, 0x09, 0x05, 0xc4, 0x35, 0x91, 0xe3, 0x4c,
-  0x9c, 0xd3, 0x48, 0x13, 0xd0, 0x4c, 0x12, 0x0a, 0x66, 0xa2, 0x2f, 0x0c,
-  0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68, 0x18, 0xa2, 0x99, 0xfc, 0x85, 0x30,
-  0x00, 0x01, 0xf3, 0xa5, 0x29, 0xa2, 0x84, 0xc9, 0xe7, 0x00, 0x86, 0x88,
-  0x00, 0xe4, 0xbc, 0xef, 0xfb, 0x9a, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c,
-  0xc3, 0x81, 0xc1, 0x70, 0xf9, 0xc0, 0x82, 0x18, 0x0d, 0x43, 0x34, 0x93,
-  0xbf, 0x10, 0x06, 0x20, 0x60, 0xbe, 0x00, 0x30, 0x44, 0x04, 0x6c, 0x54,
-  0x51, 0x10, 0x11, 0x0a, 0x6c, 0xba, 0x53, 0x85, 0x98, 0x23, 0x00, 0x05,
-  0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36,
-  0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e,
-  0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06,
-  0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07,
-  0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07,
-  0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07,
-  0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07,
-  0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c,
-  0x06, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-  0x79, 0x10, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x18, 0xf2, 0x28, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x30, 0xe4, 0x61, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0xc8, 0xe3, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xc0, 0x90, 0x07, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x4f, 0x05, 0x04, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x0c, 0x08, 0x80, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x1a, 0x10, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x3a, 0x20,
-  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x80,
-  0x01, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-  0x79, 0xc6, 0x00, 0x08, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xb2, 0x40, 0x29, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x18, 0x19,
-  0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a,
-  0x60, 0x04, 0xa0, 0x18, 0x0a, 0xa3, 0x80, 0x03, 0x0a, 0x50, 0xa0, 0x10,
-  0x0a, 0x9c, 0xa0, 0x0c, 0xca, 0xa1, 0x3c, 0x8a, 0xa0, 0x14, 0x0a, 0xa2,
-  0x24, 0x8a, 0xa2, 0x2c, 0xa8, 0x28, 0x89, 0x11, 0x80, 0x32, 0x28, 0x84,
-  0x52, 0x28, 0x82, 0x12, 0x20, 0xbd, 0x40, 0x48, 0x9e, 0x01, 0xa0, 0x7a,
-  0x06, 0x80, 0xf0, 0x19, 0x00, 0xca, 0xc7, 0x52, 0x03, 0x6a, 0x0c, 0xfe,
-  0x3f, 0x00, 0xfe, 0x3f, 0x00, 0xfe, 0x3f, 0x00, 0x00, 0x00, 0x04, 0x71,
-  0xd6, 0x00, 0x40, 0x10, 0x67, 0x0d, 0x00, 0x04, 0x71, 0xd6, 0x00, 0x40,
-  0x10, 0x04, 0x21, 0x00, 0x04, 0x59, 0x73, 0x00, 0x40, 0x90, 0x35, 0x07,
-  0x00, 0x04, 0x59, 0x73, 0x00, 0x40, 0x10, 0x04, 0xc1, 0x00, 0xf8, 0xff,
-  0xde, 0x3d, 0x80, 0xff, 0xef, 0xdd, 0x03, 0xf8, 0xff, 0xde, 0x3d, 0x80,
-  0xff, 0xef, 0xdd, 0x03, 0xf8, 0xff, 0xde, 0x3d, 0x80, 0xff, 0xef, 0xdd,
-  0x03, 0xf8, 0xff, 0xde, 0x3d, 0x80, 0xff, 0xef, 0xdd, 0x03, 0xa0, 0x76,
-  0x06, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x1a,
-  0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73,
-  0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71,
-  0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a,
-  0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b,
-  0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04, 0xa2, 0x99, 0x20, 0x10, 0xce,
-  0x06, 0x61, 0x20, 0x26, 0x08, 0xc4, 0xb3, 0x41, 0x18, 0x0c, 0x0a, 0x76,
-  0x73, 0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08, 0x6d, 0xa0, 0x06, 0x04, 0x26,
-  0x08, 0x04, 0x34, 0x41, 0x20, 0xa2, 0x0d, 0xc2, 0xd0, 0x6c, 0x48, 0x08,
-  0x65, 0x21, 0x88, 0x81, 0x21, 0x9c, 0x09, 0x82, 0x1c, 0x98, 0xc1, 0x04,
-  0x81, 0x90, 0x36, 0x08, 0x43, 0xb4, 0x21, 0x19, 0xa0, 0x85, 0x18, 0x06,
-  0x86, 0x90, 0x36, 0x08, 0xcf, 0x34, 0x41, 0xa8, 0x83, 0x33, 0x98, 0x20,
-  0x10, 0xd3, 0x06, 0x84, 0xa8, 0x16, 0x82, 0x18, 0x2c, 0x60, 0x82, 0x80,
-  0x07, 0x68, 0x30, 0x41, 0x20, 0xa8, 0x0d, 0xc8, 0x80, 0x2d, 0xc4, 0x30,
-  0x64, 0xc0, 0x06, 0xe1, 0xd2, 0x36, 0x10, 0x14, 0xb0, 0x01, 0x13, 0x84,
-  0x3c, 0x48, 0x83, 0x0d, 0x41, 0x37, 0x41, 0x10, 0x00, 0x12, 0x6d, 0x61,
-  0x69, 0x6e, 0x44, 0xa0, 0x9e, 0xa6, 0x92, 0xa8, 0x92, 0x9e, 0x9c, 0x26,
-  0x08, 0x85, 0x37, 0x41, 0x28, 0xbe, 0x0d, 0x01, 0x31, 0x41, 0x28, 0xc0,
-  0x60, 0x82, 0x40, 0x54, 0x13, 0x04, 0xc2, 0xda, 0x20, 0x98, 0xc1, 0x19,
-  0x6c, 0x58, 0x88, 0x30, 0x10, 0x83, 0x31, 0x20, 0x83, 0x31, 0x18, 0xca,
-  0x80, 0x18, 0x03, 0x34, 0xa0, 0xe1, 0xf4, 0x24, 0xd5, 0x14, 0xc4, 0x34,
-  0x41, 0x28, 0xc2, 0x60, 0x82, 0x40, 0x5c, 0x1b, 0x04, 0x33, 0x60, 0x83,
-  0x0d, 0xcb, 0xa0, 0x06, 0x62, 0x30, 0x06, 0x64, 0x30, 0x06, 0xc3, 0x1a,
-  0x0c, 0x63, 0xd0, 0x06, 0x13, 0x04, 0x02, 0xe3, 0x41, 0x15, 0xe4, 0x74,
-  0x54, 0xe4, 0x44, 0xb5, 0x61, 0x79, 0x03, 0x38, 0x10, 0x83, 0x31, 0x20,
-  0x83, 0x31, 0x18, 0xd6, 0xe0, 0x0d, 0xc6, 0xa0, 0x0d, 0xc8, 0x08, 0x31,
-  0x15, 0x39, 0x11, 0x25, 0x39, 0x11, 0x25, 0x0d, 0x15, 0x4d, 0x4d, 0x10,
-  0x0a, 0x31, 0xd8, 0xb0, 0x98, 0x81, 0x1c, 0xcc, 0xc1, 0x18, 0x90, 0xc1,
-  0x18, 0x0c, 0x6b, 0x60, 0x06, 0x63, 0xd0, 0x06, 0x64, 0x84, 0x98, 0x8a,
-  0x9c, 0x88, 0xae, 0x8a, 0x92, 0x8e, 0x90, 0xa8, 0xa6, 0x36, 0x2c, 0x56,
-  0x1d, 0x88, 0xc1, 0x18, 0x90, 0xc1, 0x18, 0x0c, 0x6b, 0x60, 0x8d, 0x41,
-  0x1b, 0x6c, 0x28, 0xd2, 0xc0, 0x0d, 0xe2, 0x80, 0x0e, 0xec, 0x80, 0xcb,
-  0x94, 0xd5, 0x17, 0xd4, 0xdb, 0x5c, 0x1a, 0x5d, 0xda, 0x9b, 0xdb, 0x86,
-  0x85, 0xc0, 0x03, 0x31, 0x28, 0x03, 0x32, 0x58, 0x83, 0x61, 0x0d, 0x88,
-  0x31, 0x68, 0x83, 0x09, 0x42, 0x31, 0x06, 0x1b, 0x96, 0x21, 0x0c, 0xc4,
-  0x60, 0x0c, 0xc8, 0x40, 0x0f, 0x86, 0x35, 0x18, 0xc6, 0xa0, 0x0d, 0x36,
-  0x04, 0xc3, 0x86, 0xe5, 0x0d, 0xc2, 0x40, 0x0c, 0xc6, 0x80, 0x0f, 0xf4,
-  0x60, 0x28, 0x83, 0x37, 0x18, 0x03, 0x34, 0xa0, 0x42, 0x25, 0xe4, 0xf4,
-  0xd5, 0x14, 0x44, 0x25, 0x95, 0x84, 0xb5, 0x61, 0x20, 0x86, 0x37, 0xd8,
-  0xb0, 0x98, 0x81, 0x1f, 0x88, 0xc1, 0x18, 0xfc, 0x81, 0x1e, 0x98, 0x41,
-  0x19, 0x98, 0xc1, 0x18, 0xa0, 0x01, 0x11, 0xaa, 0x22, 0xac, 0xa1, 0xa7,
-  0x27, 0x29, 0xa2, 0x0d, 0x82, 0x19, 0x98, 0xc1, 0x86, 0xc5, 0x0a, 0x05,
-  0x31, 0x18, 0x03, 0x32, 0xd0, 0x83, 0x41, 0x0f, 0x8c, 0x31, 0x10, 0x85,
-  0x09, 0x02, 0x91, 0x11, 0x69, 0x0a, 0xa2, 0x2a, 0x92, 0x4a, 0x0a, 0x62,
-  0x9a, 0x20, 0x14, 0x64, 0xb0, 0x41, 0x30, 0x83, 0x61, 0xc3, 0x42, 0x0a,
-  0xa5, 0x30, 0x07, 0x63, 0x40, 0x06, 0xa6, 0x30, 0x98, 0xc2, 0x19, 0x8c,
-  0xc1, 0x29, 0x6c, 0x58, 0x8c, 0x52, 0x98, 0x83, 0x31, 0xe0, 0x03, 0x53,
-  0x18, 0x4c, 0xe1, 0x0c, 0x4c, 0xe1, 0x14, 0x36, 0x04, 0x6f, 0xb0, 0x61,
-  0x39, 0x83, 0x52, 0x98, 0x83, 0x31, 0x50, 0x05, 0x53, 0x18, 0x4c, 0xe1,
-  0x0c, 0xf4, 0xe0, 0x14, 0x26, 0x08, 0x84, 0xb6, 0x21, 0x30, 0x83, 0x0d,
-  0x0b, 0x2b, 0x94, 0xc2, 0x1c, 0x8c, 0x41, 0x2b, 0x98, 0xc2, 0x60, 0x0a,
-  0x67, 0x50, 0x06, 0xa7, 0x30, 0x41, 0x20, 0xb6, 0x0d, 0x81, 0xb5, 0x61,
-  0x79, 0x85, 0x52, 0x98, 0x83, 0x31, 0x80, 0x05, 0x53, 0x18, 0x4c, 0x81,
-  0x15, 0xc6, 0xe0, 0x14, 0x26, 0x08, 0x04, 0xb7, 0x21, 0x20, 0x85, 0x0d,
-  0x8b, 0x2c, 0x94, 0xc2, 0x1c, 0x8c, 0xc1, 0x2c, 0x98, 0xc2, 0x60, 0x0a,
-  0xac, 0x60, 0x0a, 0xa7, 0x30, 0x41, 0x20, 0x3a, 0x32, 0x4f, 0x42, 0x4a,
-  0x45, 0x43, 0x54, 0x5f, 0x46, 0x4c, 0x41, 0x47, 0x53, 0x1b, 0x96, 0x5a,
-  0xb0, 0x85, 0x39, 0x18, 0x03, 0x32, 0x30, 0x85, 0xc1, 0x14, 0x58, 0x41,
-  0x0f, 0x4e, 0x61, 0x03, 0x93, 0x07, 0x7b, 0xd0, 0x07, 0xa0, 0x30, 0x0a,
-  0xa8, 0x90, 0x0a, 0xab, 0xe0, 0x0a, 0xb1, 0x40, 0x0b, 0xb7, 0xb0, 0x61,
-  0xb8, 0x03, 0x5c, 0x00, 0x26, 0x08, 0x7a, 0x50, 0x06, 0x1b, 0x04, 0x42,
-  0x17, 0x36, 0x14, 0x1f, 0x18, 0xe4, 0x02, 0xb7, 0x0b, 0x55, 0xd8, 0xd8,
-  0xec, 0xda, 0x5c, 0xd2, 0xc8, 0xca, 0xdc, 0xe8, 0xa6, 0x04, 0x41, 0x15,
-  0x32, 0x3c, 0x17, 0xbb, 0x32, 0xb9, 0xb9, 0xb4, 0x37, 0xb7, 0x29, 0x01,
-  0xd1, 0x84, 0x0c, 0xcf, 0xc5, 0x2e, 0x8c, 0xcd, 0xae, 0x4c, 0x6e, 0x4a,
-  0x60, 0xd4, 0x21, 0xc3, 0x73, 0x99, 0x43, 0x0b, 0x23, 0x2b, 0x93, 0x6b,
-  0x7a, 0x23, 0x2b, 0x63, 0x9b, 0x12, 0x20, 0x65, 0xc8, 0xf0, 0x5c, 0xe4,
-  0xca, 0xe6, 0xde, 0xea, 0xe4, 0xc6, 0xca, 0xe6, 0xa6, 0x04, 0x5b, 0x1d,
-  0x32, 0x3c, 0x17, 0xbb, 0xb4, 0xb2, 0xbb, 0x24, 0xb2, 0x29, 0xba, 0x30,
-  0xba, 0xb2, 0x29, 0x41, 0x57, 0x87, 0x0c, 0xcf, 0xa5, 0xcc, 0x8d, 0x4e,
-  0x2e, 0x0f, 0xea, 0x2d, 0xcd, 0x8d, 0x6e, 0x6e, 0x4a, 0xb0, 0x0b, 0x00,
-  0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33,
-  0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43,
-  0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98,
-  0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33,
-  0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05,
-  0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43,
-  0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08,
-  0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78,
-  0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1,
-  0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33,
-  0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e,
-  0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03,
-  0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60,
-  0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80,
-  0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8,
-  0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18,
-  0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee,
-  0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c,
-  0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c,
-  0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43,
-  0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3,
-  0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83,
-  0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21,
-  0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1,
-  0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6,
-  0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4,
-  0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xc6,
-  0x40, 0x0d, 0x97, 0xef, 0x3c, 0x7e, 0x40, 0x15, 0x05, 0x11, 0x95, 0x0e,
-  0x30, 0xf8, 0xc5, 0x6d, 0xdb, 0x02, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x01,
-  0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0, 0xe0, 0x23, 0xb7, 0x6d, 0x08, 0xdb,
-  0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a, 0xc0,
-  0x50, 0x12, 0x06, 0x20, 0x60, 0x7e, 0x71, 0xdb, 0x76, 0xb0, 0x0d, 0x97,
-  0xef, 0x3c, 0xbe, 0x10, 0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25,
-  0x61, 0x00, 0x02, 0xe6, 0x23, 0xb7, 0x6d, 0x0a, 0xd2, 0x70, 0xf9, 0xce,
-  0xe3, 0x0b, 0x11, 0x01, 0x4c, 0x44, 0x08, 0x34, 0xc3, 0x42, 0x58, 0x81,
-  0x33, 0x5c, 0xbe, 0xf3, 0xf8, 0x83, 0x33, 0xdd, 0x7e, 0x71, 0xdb, 0x16,
-  0x30, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0xe2, 0x00, 0x83, 0xd8, 0x3c, 0xd4,
-  0xe4, 0x17, 0xb7, 0x6d, 0x02, 0xd3, 0x70, 0xf9, 0xce, 0xe3, 0x2f, 0x0e,
-  0x30, 0x88, 0xcd, 0x43, 0x4d, 0x3e, 0x72, 0xdb, 0x36, 0x50, 0x0d, 0x97,
-  0xef, 0x3c, 0xbe, 0x34, 0x39, 0x11, 0x81, 0x52, 0xd3, 0x43, 0x4d, 0x7e,
-  0x71, 0xdb, 0x46, 0x50, 0x0d, 0x97, 0xef, 0x3c, 0xbe, 0x34, 0x39, 0x11,
-  0x81, 0x52, 0xd3, 0x43, 0x4d, 0x3e, 0x72, 0xdb, 0x96, 0x20, 0x0d, 0x97,
-  0xef, 0x3c, 0xfe, 0x44, 0x44, 0x13, 0x02, 0x44, 0x98, 0x5f, 0xdc, 0xb6,
-  0x19, 0x3c, 0xc3, 0xe5, 0x3b, 0x8f, 0x4f, 0x35, 0x40, 0x84, 0xf9, 0xc5,
-  0x6d, 0x1b, 0x00, 0xc1, 0x00, 0x48, 0x03, 0x61, 0x20, 0x00, 0x00, 0x3e,
-  0x03, 0x00, 0x00, 0x13, 0x04, 0x41, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x0a,
-  0x00, 0x00, 0x00, 0x44, 0x14, 0x62, 0x40, 0x71, 0xcd, 0x00, 0x94, 0x5d,
-  0x01, 0x06, 0x14, 0x68, 0x40, 0xc9, 0x15, 0x48, 0x01, 0x15, 0x58, 0xb9,
-  0x95, 0x4c, 0xa1, 0x15, 0x5c, 0xe1, 0x15, 0x64, 0x40, 0x61, 0x06, 0x94,
-  0x46, 0x71, 0x10, 0x37, 0x02, 0x00, 0x00, 0x23, 0x06, 0x09, 0x00, 0x82,
-  0x60, 0xd0, 0xd5, 0x81, 0x03, 0x06, 0x72, 0x20, 0x07, 0xc1, 0x88, 0x41,
-  0x02, 0x80, 0x20, 0x18, 0x74, 0x76, 0xf0, 0x84, 0x81, 0x1c, 0xc8, 0x81,
-  0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0xdd, 0x1d, 0x40, 0x1e, 0x1d,
-  0xd0, 0xc1, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x1d, 0x1e, 0x44,
-  0x1f, 0x1d, 0xd0, 0x01, 0x31, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x86,
-  0x28, 0xc0, 0x01, 0x1c, 0xd4, 0x01, 0x19, 0x58, 0x23, 0x06, 0x09, 0x00,
-  0x82, 0x60, 0x60, 0x8c, 0x42, 0x1c, 0xc4, 0x81, 0x1d, 0x80, 0xc1, 0x35,
-  0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x06, 0x29, 0xc8, 0x81, 0x1c, 0xdc,
-  0x81, 0x18, 0x60, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0x94, 0xc2,
-  0x1c, 0xcc, 0x01, 0x1e, 0x98, 0x41, 0x36, 0x62, 0x90, 0x00, 0x20, 0x08,
-  0x06, 0x48, 0x29, 0xd0, 0x81, 0x1c, 0xe4, 0x01, 0x1a, 0x68, 0x23, 0x06,
-  0x09, 0x00, 0x82, 0x60, 0x80, 0x98, 0x42, 0x1d, 0xcc, 0x81, 0x1e, 0x90,
-  0xc1, 0x36, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0xc8, 0x29, 0xd8, 0x01,
-  0x1d, 0xec, 0x81, 0x19, 0x70, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x80,
-  0xa0, 0xc2, 0x1d, 0xd4, 0x01, 0x1f, 0xa8, 0x41, 0x37, 0x62, 0x90, 0x00,
-  0x20, 0x08, 0x06, 0x86, 0x2a, 0xe0, 0xc1, 0x1c, 0xf4, 0x01, 0x1b, 0x78,
-  0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xac, 0x42, 0x1e, 0xd0, 0x81,
-  0x1f, 0xa0, 0xc1, 0x37, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x06, 0x2b,
-  0xe8, 0x41, 0x1d, 0xfc, 0x81, 0x1a, 0x80, 0xc1, 0x88, 0x41, 0x02, 0x80,
-  0x20, 0x18, 0x18, 0xad, 0xb0, 0x07, 0x76, 0x00, 0x0a, 0x6e, 0x10, 0x06,
-  0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xb8, 0x02, 0x1f, 0x88, 0x42,
-  0x28, 0xc0, 0x81, 0x18, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0xf1,
-  0x0a, 0x7d, 0x30, 0x0a, 0xa2, 0xc0, 0x06, 0x63, 0x30, 0x62, 0x90, 0x00,
-  0x20, 0x08, 0x06, 0x06, 0x2c, 0xf8, 0x01, 0x29, 0x8c, 0x82, 0x1b, 0x90,
-  0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x18, 0xb1, 0xf0, 0x07, 0xa5,
-  0x40, 0x0a, 0x72, 0x50, 0x06, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60,
-  0xc8, 0x02, 0x28, 0x94, 0x42, 0x29, 0xd0, 0x81, 0x19, 0x8c, 0x18, 0x24,
-  0x00, 0x08, 0x82, 0x81, 0x31, 0x0b, 0xa1, 0x60, 0x0a, 0xa6, 0x00, 0x07,
-  0x67, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x06, 0x2d, 0x88, 0xc2,
-  0x29, 0x9c, 0x82, 0x1c, 0xa0, 0xc1, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18,
-  0x54, 0xaf, 0x80, 0x06, 0x14, 0x2a, 0x8c, 0x26, 0x04, 0xc0, 0x88, 0x01,
-  0x02, 0x80, 0x20, 0x18, 0x80, 0x41, 0x2b, 0xb4, 0x01, 0x16, 0x84, 0xc1,
-  0x68, 0x42, 0x00, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x01, 0x18, 0xbc,
-  0xc2, 0x1b, 0x68, 0x83, 0x18, 0x8c, 0x26, 0x04, 0xc0, 0x88, 0x01, 0x02,
-  0x80, 0x20, 0x18, 0x80, 0x41, 0x2c, 0xc4, 0x01, 0x57, 0x8c, 0xc1, 0x68,
-  0x42, 0x00, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x01, 0x18, 0xcc, 0xc2,
-  0x1c, 0x78, 0xc7, 0x1b, 0x8c, 0x26, 0x04, 0xc0, 0x88, 0x01, 0x02, 0x80,
-  0x20, 0x18, 0x80, 0x41, 0x2d, 0xd4, 0x01, 0x18, 0x24, 0x75, 0x30, 0x9a,
-  0x10, 0x00, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x00, 0x06, 0xb7, 0x70,
-  0x07, 0x62, 0xb0, 0xa0, 0xc1, 0x68, 0x42, 0x00, 0x8c, 0x18, 0x20, 0x00,
-  0x08, 0x82, 0x01, 0x18, 0xe4, 0x42, 0x1e, 0x90, 0x41, 0x93, 0x06, 0xa3,
-  0x09, 0x01, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x60, 0xb0, 0x0b,
-  0x7b, 0x60, 0x06, 0x8f, 0x1d, 0x8c, 0x26, 0x04, 0x40, 0x0d, 0x61, 0x00,
-  0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0xbd, 0xe0, 0x07, 0x6a,
-  0x10, 0xec, 0xc2, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2,
-  0x20, 0x8c, 0x26, 0x10, 0xc3, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c,
-  0x81, 0x38, 0x8c, 0xc2, 0x1b, 0x18, 0x7c, 0x30, 0x9a, 0x10, 0x00, 0xa3,
-  0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 0xa3, 0x09, 0xc4, 0x30, 0x62, 0x80,
-  0x00, 0x20, 0x08, 0x06, 0x63, 0x70, 0x0e, 0xa8, 0x40, 0x07, 0x0b, 0x28,
-  0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x68,
-  0x02, 0x31, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18, 0xb0, 0x43,
-  0x2b, 0xe4, 0x01, 0x44, 0x0a, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04,
-  0xa3, 0x09, 0x83, 0x30, 0x9a, 0x40, 0x0c, 0x23, 0x06, 0x08, 0x00, 0x82,
-  0x60, 0x30, 0x06, 0xf1, 0x20, 0x0b, 0x7e, 0x50, 0xb9, 0xc2, 0x68, 0x42,
-  0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x18, 0x20, 0x00,
-  0x08, 0x82, 0xc1, 0x18, 0xd4, 0x83, 0x2d, 0x88, 0x42, 0x16, 0x0b, 0xa3,
-  0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30, 0x62, 0x80,
-  0x00, 0x20, 0x08, 0x06, 0x63, 0x90, 0x0f, 0xba, 0x60, 0x0a, 0x1d, 0x3d,
-  0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0x42, 0x91,
-  0x41, 0x28, 0xc0, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c, 0x81, 0x3f,
-  0xfc, 0xc2, 0x2a, 0x04, 0xfc, 0x30, 0x9a, 0x10, 0x00, 0xa3, 0x09, 0x42,
-  0x30, 0x9a, 0x30, 0x08, 0xa3, 0x09, 0xc4, 0x30, 0x62, 0x80, 0x00, 0x20,
-  0x08, 0x06, 0x63, 0x30, 0x12, 0xe4, 0x00, 0x0b, 0x46, 0x2f, 0x8c, 0x26,
-  0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x68, 0x02, 0x31,
-  0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18, 0xa0, 0x44, 0x3a, 0xd4,
-  0xc2, 0x12, 0x0e, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09,
-  0x83, 0x30, 0x9a, 0x40, 0x0c, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30,
-  0x06, 0x2d, 0xe1, 0x0e, 0xba, 0x00, 0x95, 0xc3, 0x68, 0x42, 0x00, 0x8c,
-  0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x26, 0x10, 0xc3, 0x88, 0x01,
-  0x02, 0x80, 0x20, 0x18, 0x8c, 0x81, 0x4c, 0xcc, 0xc3, 0x2f, 0x54, 0xef,
-  0x30, 0x9a, 0x10, 0x00, 0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 0x23,
-  0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0x36, 0x71, 0x0f, 0xe3, 0x90,
-  0xc9, 0xc3, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20,
-  0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18, 0xe8, 0xc4, 0x3e, 0x9c,
-  0x43, 0x57, 0x13, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09,
-  0x83, 0x50, 0xa5, 0x10, 0x0e, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06,
-  0x63, 0xf0, 0x13, 0x20, 0xc1, 0x0e, 0x41, 0x4f, 0x8c, 0x26, 0x04, 0xc0,
-  0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x68, 0x02, 0x31, 0x8c, 0x18,
-  0x20, 0x00, 0x08, 0x82, 0xc1, 0x18, 0x90, 0x45, 0x49, 0xc4, 0x83, 0xe1,
-  0x0f, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30,
-  0x9a, 0x40, 0x0c, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0x69,
-  0xa1, 0x12, 0xf6, 0xb0, 0x88, 0xc4, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08,
-  0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x26, 0x10, 0xc3, 0x88, 0x01, 0x02, 0x80,
-  0x20, 0x18, 0x8c, 0x81, 0x5b, 0xbc, 0xc4, 0x3e, 0x40, 0x26, 0x31, 0x9a,
-  0x10, 0x00, 0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 0xa3, 0x09, 0xc4,
-  0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x63, 0x30, 0x17, 0x34, 0x01,
-  0x12, 0x15, 0x4c, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26,
-  0x0c, 0xc2, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x8c, 0xc1, 0x5d, 0xe0,
-  0x04, 0x49, 0x64, 0x33, 0x31, 0x9a, 0x10, 0x00, 0xa3, 0x09, 0x42, 0x30,
-  0x9a, 0x30, 0x08, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0x7b,
-  0xc1, 0x13, 0x28, 0xd1, 0xd9, 0xc5, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08,
-  0xc1, 0x68, 0xc2, 0x20, 0x94, 0x39, 0x84, 0x04, 0x8c, 0x18, 0x20, 0x00,
-  0x08, 0x82, 0xc1, 0x18, 0x80, 0x46, 0x58, 0xb4, 0x44, 0xe0, 0x17, 0xa3,
-  0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30, 0x9a, 0x40,
-  0x0c, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0x30, 0x06, 0xa5, 0x61, 0x16,
-  0x32, 0x61, 0xfc, 0xc4, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1, 0x68,
-  0xc2, 0x20, 0x8c, 0x26, 0x10, 0xc3, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18,
-  0x8c, 0x81, 0x6a, 0xac, 0xc5, 0x4d, 0x2c, 0x63, 0x31, 0x9a, 0x10, 0x00,
-  0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 0xa3, 0x09, 0xc4, 0x30, 0x62,
-  0x80, 0x00, 0x20, 0x08, 0x06, 0x63, 0xf0, 0x1a, 0x70, 0xc1, 0x13, 0xd0,
-  0x59, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2,
-  0x68, 0x02, 0x31, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0xc1, 0x18, 0xd0,
-  0x46, 0x5d, 0x84, 0x45, 0x15, 0x17, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20,
-  0x04, 0xa3, 0x09, 0x83, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x63,
-  0x80, 0x1b, 0x79, 0x51, 0x16, 0x19, 0x5d, 0x8c, 0x26, 0x04, 0xc0, 0x68,
-  0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18,
-  0x8c, 0x01, 0x6f, 0xf4, 0x45, 0x5a, 0x74, 0xb7, 0x31, 0x9a, 0x10, 0x00,
-  0xa3, 0x09, 0x42, 0x30, 0x9a, 0x30, 0x08, 0x26, 0x12, 0x69, 0x21, 0x1f,
-  0xf3, 0x07, 0xb5, 0x90, 0x8f, 0xe9, 0xc3, 0x5a, 0xc8, 0xc7, 0xec, 0x81,
-  0x2d, 0xe4, 0x63, 0x25, 0xd1, 0x16, 0xf2, 0xb1, 0x90, 0x70, 0x0b, 0xf9,
-  0x58, 0x3f, 0xbc, 0x85, 0x7c, 0x2c, 0x1f, 0xe0, 0x42, 0x3e, 0x86, 0x12,
-  0x71, 0x21, 0x1f, 0x23, 0x09, 0xb9, 0x90, 0x8f, 0x81, 0xc4, 0x5c, 0xc8,
-  0xc7, 0xf8, 0x81, 0x2e, 0xe4, 0x63, 0x2b, 0x51, 0x17, 0xf2, 0xb1, 0x93,
-  0xb0, 0x0b, 0xf9, 0xd8, 0x48, 0xdc, 0x85, 0x7c, 0xec, 0x1f, 0xf0, 0x42,
-  0x3e, 0x16, 0x0f, 0x78, 0x21, 0x1f, 0x6b, 0x87, 0xbc, 0x90, 0x8f, 0xa5,
-  0x83, 0x5e, 0xc8, 0xc7, 0xca, 0x61, 0x2f, 0xe4, 0x63, 0xf4, 0xc0, 0x17,
-  0xf2, 0x31, 0x78, 0xe8, 0x0b, 0xf9, 0x18, 0x3b, 0xf8, 0x85, 0x7c, 0x0c,
-  0x1d, 0xfe, 0x42, 0x3e, 0x76, 0x0f, 0xa0, 0x21, 0x1f, 0x9b, 0x87, 0xd0,
-  0x90, 0x8f, 0xbd, 0x83, 0x68, 0xc8, 0xc7, 0xd6, 0x61, 0x34, 0xe4, 0x63,
-  0xfa, 0x40, 0x1a, 0xf2, 0x31, 0x7b, 0x28, 0x0d, 0xf9, 0x98, 0x3c, 0x98,
-  0x86, 0x7c, 0xcc, 0x1d, 0x4e, 0x43, 0x3e, 0x06, 0x81, 0x01, 0x7c, 0x0c,
-  0x02, 0x03, 0xf8, 0x18, 0x04, 0x06, 0xf0, 0x31, 0x08, 0x0c, 0xe0, 0x63,
-  0x10, 0x18, 0xc0, 0xc7, 0x20, 0x30, 0x80, 0x8f, 0x41, 0x60, 0x00, 0x1f,
-  0x83, 0xc0, 0x00, 0x3e, 0x06, 0x81, 0x01, 0x7c, 0x0c, 0x02, 0x03, 0xf8,
-  0x18, 0x04, 0x06, 0xf0, 0x31, 0x08, 0x0c, 0xe0, 0x63, 0x10, 0x18, 0xc0,
-  0xc7, 0x20, 0x30, 0x80, 0x8f, 0x41, 0x60, 0x00, 0x1f, 0x83, 0xc0, 0x00,
-  0x3e, 0x06, 0x0f, 0xb7, 0x21, 0x1f, 0x63, 0x07, 0xdc, 0x90, 0x8f, 0xa1,
-  0x43, 0x6e, 0xc8, 0xc7, 0xc8, 0x41, 0x37, 0xe4, 0x63, 0xf3, 0xb0, 0x1b,
-  0xf2, 0xb1, 0x77, 0xe0, 0x0d, 0xf9, 0xd8, 0x3a, 0xf4, 0x86, 0x7c, 0xec,
-  0x1c, 0x7c, 0x43, 0x3e, 0x66, 0x0f, 0xbf, 0x21, 0x1f, 0x93, 0x07, 0xf0,
-  0x90, 0x8f, 0xb9, 0x43, 0x78, 0xc8, 0xc7, 0xd4, 0x41, 0x3c, 0xe4, 0x63,
-  0xf9, 0x30, 0x1e, 0xf2, 0xb1, 0x7a, 0x20, 0x0f, 0xf9, 0x58, 0x3c, 0x94,
-  0x87, 0x7c, 0xac, 0x1d, 0xcc, 0x43, 0x3e, 0x06, 0x06, 0x10, 0x7c, 0x0c,
-  0x0c, 0x20, 0xf8, 0x18, 0x18, 0x40, 0xf0, 0x31, 0x30, 0x80, 0xe0, 0x63,
-  0x60, 0x00, 0xc1, 0xc7, 0xc0, 0x00, 0x82, 0x8f, 0x81, 0x01, 0x04, 0x1f,
-  0x03, 0x03, 0x08, 0x3e, 0x06, 0x06, 0x10, 0x7c, 0x0c, 0x0c, 0x20, 0xf8,
-  0x18, 0x18, 0x40, 0xf0, 0x31, 0x30, 0x80, 0xe0, 0x63, 0x60, 0x00, 0xc1,
-  0xc7, 0xc0, 0x00, 0x82, 0x8f, 0x81, 0x01, 0x04, 0x1f, 0x03, 0x03, 0x08,
-  0x3e, 0xf6, 0x0e, 0xf6, 0x21, 0x1f, 0x5b, 0x87, 0xfb, 0x90, 0x8f, 0x9d,
-  0x03, 0x7e, 0xc8, 0xc7, 0xc6, 0x21, 0x3f, 0xe4, 0x63, 0xf2, 0xa0, 0x1f,
-  0xf2, 0x31, 0x77, 0xd8, 0x0f, 0xf9, 0x98, 0x3a, 0xf0, 0x87, 0x7c, 0xcc,
-  0x1c, 0xfa, 0x43, 0x3e, 0x56, 0x0f, 0xfe, 0x21, 0x1f, 0x8b, 0x87, 0xff,
-  0x90, 0x8f, 0xb5, 0x03, 0x88, 0xc8, 0xc7, 0xd2, 0x21, 0x44, 0xe4, 0x63,
-  0xf8, 0x20, 0x22, 0xf2, 0x31, 0x7a, 0x18, 0x11, 0xf9, 0x18, 0x3c, 0x90,
-  0x88, 0x7c, 0x8c, 0x1d, 0x4a, 0x44, 0x3e, 0x06, 0x06, 0x10, 0x7c, 0x0c,
-  0x0c, 0x20, 0xf8, 0x18, 0x18, 0x40, 0xf0, 0x31, 0x30, 0x80, 0xe0, 0x63,
-  0x60, 0x00, 0xc1, 0xc7, 0xc0, 0x00, 0x82, 0x8f, 0x81, 0x01, 0x04, 0x1f,
-  0x03, 0x03, 0x08, 0x3e, 0x06, 0x06, 0x10, 0x7c, 0x0c, 0x0c, 0x20, 0xf8,
-  0x18, 0x18, 0x40, 0xf0, 0x31, 0x30, 0x80, 0xe0, 0x63, 0x60, 0x00, 0xc1,
-  0xc7, 0xc0, 0x00, 0x82, 0x8f, 0x81, 0x01, 0x04, 0x1f, 0x03, 0x03, 0x08,
-  0x3e, 0xe6, 0x1b, 0x39, 0x22, 0x1f, 0xdb, 0x0d, 0x1d, 0x91, 0x8f, 0xe1,
-  0xc6, 0x8e, 0xc8, 0xc7, 0xc0, 0x83, 0x47, 0xe4, 0x63, 0xbd, 0xd1, 0x23,
-  0xf2, 0x31, 0xdd, 0xf0, 0x11, 0xf9, 0x98, 0x78, 0xfc, 0x88, 0x7c, 0xec,
-  0x37, 0xc0, 0x44, 0x3e, 0xc6, 0x1b, 0x61, 0x22, 0x1f, 0x33, 0x8d, 0x30,
-  0x91, 0x8f, 0x8d, 0x86, 0x98, 0xc8, 0xc7, 0x40, 0x63, 0x4c, 0xe4, 0x63,
-  0xa8, 0x41, 0x26, 0xf2, 0xb1, 0xd2, 0x28, 0x13, 0xf9, 0x98, 0x68, 0x98,
-  0x89, 0x7c, 0x4c, 0x35, 0xce, 0x44, 0x3e, 0x76, 0x1a, 0x68, 0x22, 0x1f,
-  0x23, 0x8d, 0x34, 0x91, 0x8f, 0x25, 0x12, 0x7c, 0x2c, 0x91, 0xe0, 0x63,
-  0x89, 0x04, 0x1f, 0x4b, 0x24, 0xf8, 0x58, 0x22, 0xc1, 0xc7, 0x12, 0x09,
-  0x3e, 0x96, 0x48, 0xf0, 0xb1, 0x44, 0x82, 0x8f, 0x25, 0x12, 0x7c, 0xec,
-  0x2e, 0xe4, 0x44, 0x3e, 0x46, 0x17, 0x73, 0x22, 0x1f, 0x8b, 0x0b, 0x3a,
-  0x91, 0x8f, 0xe5, 0x45, 0x9d, 0xc8, 0xc7, 0xec, 0xc2, 0x4e, 0xe4, 0x63,
-  0x73, 0x71, 0x27, 0xf2, 0xb1, 0xbd, 0xc0, 0x13, 0xf9, 0x18, 0x5e, 0xe4,
-  0x89, 0x7c, 0xac, 0x2e, 0xf4, 0x44, 0x3e, 0x26, 0x25, 0xf0, 0x31, 0x29,
-  0x81, 0x8f, 0x49, 0x09, 0x7c, 0x4c, 0x4a, 0xe0, 0x63, 0x52, 0x02, 0x1f,
-  0x93, 0x12, 0xf8, 0x98, 0x94, 0xc0, 0xc7, 0xa4, 0x04, 0x3e, 0x26, 0x25,
-  0xf0, 0x31, 0xb4, 0x18, 0x15, 0xf9, 0x58, 0x59, 0x90, 0x8a, 0x7c, 0x4c,
-  0x2c, 0x4a, 0x45, 0x3e, 0xa6, 0x16, 0xa6, 0x22, 0x1f, 0x3b, 0x8b, 0x53,
-  0x91, 0x8f, 0x91, 0x05, 0xaa, 0xc8, 0xc7, 0xd8, 0x22, 0x55, 0xe4, 0x63,
-  0x69, 0xa1, 0x2a, 0xf2, 0x31, 0xb3, 0x58, 0x15, 0xf9, 0x98, 0x94, 0xc0,
-  0xc7, 0xa4, 0x04, 0x3e, 0x26, 0x25, 0xf0, 0x31, 0x29, 0x81, 0x8f, 0x49,
-  0x09, 0x7c, 0x4c, 0x4a, 0xe0, 0x63, 0x52, 0x02, 0x1f, 0x93, 0x12, 0xf8,
-  0x98, 0x94, 0xc0, 0xc7, 0x5e, 0x01, 0x55, 0xe4, 0x33, 0x62, 0x80, 0x00,
-  0x20, 0x08, 0x06, 0xda, 0xcc, 0xc0, 0xcb, 0x2b, 0xa0, 0x4a, 0x30, 0x62,
-  0x80, 0x00, 0x20, 0x08, 0x06, 0x1a, 0xcd, 0xc4, 0xcb, 0x2b, 0xa0, 0x4a,
-  0x60, 0xaf, 0x10, 0x40, 0xc7, 0x5e, 0x81, 0x55, 0xe4, 0x33, 0x62, 0x80,
-  0x00, 0x20, 0x08, 0x06, 0xda, 0xcd, 0xd0, 0xcb, 0x2b, 0xb0, 0x4a, 0x30,
-  0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x1a, 0xce, 0xd4, 0xcb, 0x2b, 0xb0,
-  0x4a, 0x60, 0xaf, 0x10, 0x40, 0xc7, 0x5e, 0x01, 0x56, 0xe4, 0x33, 0x62,
-  0x80, 0x00, 0x20, 0x08, 0x06, 0xda, 0xce, 0xe0, 0xcb, 0x2b, 0xc0, 0x4a,
-  0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x1a, 0xcf, 0xe4, 0xcb, 0x2b,
-  0xc0, 0x4a, 0x60, 0xaf, 0x10, 0x40, 0xc7, 0x5e, 0x81, 0x56, 0xe4, 0x33,
-  0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0xda, 0xcf, 0xf0, 0xcb, 0x2b, 0xd0,
-  0x4a, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x1a, 0xd8, 0xf4, 0xcb,
-  0x2b, 0xd0, 0x4a, 0x60, 0xaf, 0x10, 0x40, 0x67, 0xc4, 0xe0, 0x00, 0x40,
-  0x10, 0x0c, 0xb0, 0xb1, 0xe9, 0x17, 0x75, 0xd9, 0x99, 0xd1, 0x84, 0x00,
-  0x18, 0x4d, 0x10, 0x82, 0xd1, 0x84, 0x41, 0x18, 0x4d, 0x20, 0x86, 0x11,
-  0x83, 0x03, 0x00, 0x41, 0x30, 0xc0, 0xd0, 0x46, 0x64, 0xde, 0x85, 0x5e,
-  0x46, 0x13, 0x02, 0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x06, 0x61, 0x34,
-  0x81, 0x18, 0x46, 0x0c, 0x0e, 0x00, 0x04, 0xc1, 0x00, 0x6b, 0x9b, 0x93,
-  0xa1, 0x17, 0x7c, 0x19, 0x4d, 0x08, 0x80, 0xd1, 0x04, 0x21, 0x18, 0x4d,
-  0x18, 0x84, 0xd1, 0x04, 0x62, 0x18, 0x31, 0x38, 0x00, 0x10, 0x04, 0x03,
-  0x4c, 0x6e, 0x58, 0x26, 0x5f, 0xc6, 0x66, 0x34, 0x21, 0x00, 0x46, 0x13,
-  0x84, 0x60, 0x34, 0x61, 0x10, 0x46, 0x13, 0x88, 0xc1, 0xa6, 0x30, 0x90,
-  0xcf, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x68, 0x77, 0x43, 0x33, 0x8f,
-  0x17, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x81, 0x86, 0x37, 0x35, 0xb3,
-  0x6c, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x68, 0x79, 0x63, 0x33,
-  0x07, 0x16, 0x98, 0x55, 0x06, 0xf2, 0x19, 0x31, 0x40, 0x00, 0x10, 0x04,
-  0x03, 0x6d, 0x6f, 0x70, 0x46, 0x12, 0x83, 0x60, 0xc4, 0x00, 0x01, 0x40,
-  0x10, 0x0c, 0x34, 0xbe, 0xc9, 0x19, 0xe7, 0x0b, 0x46, 0x0c, 0x10, 0x00,
-  0x04, 0xc1, 0x40, 0xeb, 0x1b, 0x9d, 0x51, 0xb8, 0xc0, 0xb2, 0x34, 0x90,
-  0xcf, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x68, 0x7f, 0xc3, 0x33, 0x95,
-  0x19, 0x04, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0xa0, 0x81, 0x4e, 0xcf,
-  0x44, 0x63, 0x10, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x81, 0x16, 0x3a,
-  0x3e, 0xd3, 0x80, 0x41, 0x60, 0x5c, 0x1b, 0xc8, 0x67, 0xc4, 0x00, 0x01,
-  0x40, 0x10, 0x0c, 0xb4, 0xd1, 0x01, 0x1b, 0x4c, 0x0d, 0x82, 0x11, 0x03,
-  0x04, 0x00, 0x41, 0x30, 0xd0, 0x48, 0x27, 0x6c, 0xa8, 0x33, 0x08, 0x46,
-  0x0c, 0x10, 0x00, 0x04, 0xc1, 0x40, 0x2b, 0x1d, 0xb1, 0x81, 0xc8, 0x20,
-  0xb0, 0x91, 0x20, 0x19, 0xf9, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x81,
-  0x76, 0x3a, 0x64, 0x33, 0x12, 0x24, 0x13, 0x8c, 0x18, 0x20, 0x00, 0x08,
-  0x82, 0x81, 0x86, 0x3a, 0x65, 0x33, 0x12, 0x24, 0x13, 0x98, 0x48, 0x9c,
-  0x8c, 0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0x40, 0x53, 0x9d, 0xb3,
-  0x11, 0x89, 0x93, 0x09, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0x40, 0x5b,
-  0x1d, 0xb4, 0x11, 0x89, 0x93, 0x09, 0x2c, 0x24, 0x54, 0x46, 0x3e, 0x23,
-  0x06, 0x08, 0x00, 0x82, 0x60, 0xa0, 0xb5, 0x8e, 0xda, 0x84, 0x84, 0xca,
-  0x04, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0xa0, 0xb9, 0xce, 0xda, 0x84,
-  0x84, 0xca, 0x04, 0x23, 0x06, 0x0b, 0x00, 0x82, 0x60, 0xe0, 0xcc, 0xce,
-  0xd8, 0x1c, 0x44, 0x70, 0x10, 0xc1, 0x88, 0x81, 0x01, 0x80, 0x20, 0x18,
-  0x40, 0xb3, 0x33, 0x36, 0x81, 0x05, 0x89, 0x7c, 0x4c, 0x38, 0xe4, 0x63,
-  0x43, 0x21, 0x1f, 0x5b, 0x05, 0x97, 0x91, 0xcf, 0x88, 0x01, 0x02, 0x80,
-  0x20, 0x18, 0x68, 0xb5, 0x23, 0x37, 0x2e, 0x93, 0x0a, 0xc1, 0x88, 0x01,
-  0x02, 0x80, 0x20, 0x18, 0x68, 0xb6, 0x33, 0x37, 0x2e, 0x73, 0x0a, 0x81,
-  0xb5, 0x42, 0xcc, 0xc8, 0x67, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0x34,
-  0xdc, 0xa9, 0x9b, 0x98, 0x59, 0x85, 0x60, 0xc4, 0x00, 0x01, 0x40, 0x10,
-  0x0c, 0xb4, 0xdc, 0xb1, 0x9b, 0x98, 0x49, 0x85, 0xc0, 0x5e, 0x81, 0x66,
-  0xe4, 0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0xda, 0xee, 0xe0, 0x0d,
-  0xcd, 0xb4, 0x42, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x1a, 0xef,
-  0xe4, 0x0d, 0xcd, 0xac, 0x42, 0x30, 0x62, 0xb0, 0x00, 0x20, 0x08, 0x06,
-  0x4e, 0xf8, 0xc4, 0xcd, 0x41, 0x04, 0x07, 0x11, 0x8c, 0x18, 0x18, 0x00,
-  0x08, 0x82, 0x01, 0x14, 0x3e, 0x71, 0x13, 0x58, 0x90, 0xc8, 0xc7, 0x84,
-  0x43, 0x3e, 0x36, 0x14, 0xf2, 0x31, 0xe1, 0x91, 0x8f, 0x09, 0x91, 0x7c,
-  0x4c, 0x08, 0xe2, 0x63, 0x04, 0x25, 0x1f, 0x3b, 0x26, 0xf9, 0x98, 0x10,
-  0xc4, 0xc7, 0x12, 0x4b, 0x3e, 0x96, 0x60, 0xf2, 0x31, 0x21, 0x88, 0xcf,
-  0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 0xf1, 0xb3, 0x3b, 0xe6, 0x63,
-  0x3e, 0xb5, 0x23, 0x07, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0xa0, 0xc4,
-  0xcf, 0xee, 0x98, 0x8f, 0xf9, 0xc0, 0x8e, 0x1b, 0x8c, 0x18, 0x24, 0x00,
-  0x08, 0x82, 0x81, 0x12, 0x3f, 0xbb, 0x63, 0x3e, 0xe6, 0x13, 0x3b, 0x6a,
-  0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x4a, 0xfc, 0xec, 0x8e, 0xf9,
-  0x98, 0x0f, 0xed, 0x98, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28,
-  0xf1, 0xb3, 0x3b, 0xe7, 0x63, 0x3e, 0xb5, 0x23, 0x07, 0x23, 0x06, 0x09,
-  0x00, 0x82, 0x60, 0xa0, 0xc4, 0xcf, 0xee, 0x9c, 0x8f, 0xf9, 0xc0, 0x8e,
-  0x1b, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x12, 0x3f, 0xbb, 0x73,
-  0x3e, 0xe6, 0x13, 0x3b, 0x6a, 0x30, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06,
-  0x4a, 0xfc, 0xec, 0xce, 0xf9, 0x98, 0x0f, 0xed, 0x98, 0xc1, 0x88, 0x41,
-  0x02, 0x80, 0x20, 0x18, 0x28, 0xf1, 0xb3, 0x3b, 0xbc, 0x63, 0x3e, 0xb5,
-  0x63, 0x0b, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0xa0, 0xc4, 0xcf, 0xee,
-  0xf0, 0x8e, 0xf9, 0xc0, 0x8e, 0x2c, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82,
-  0x81, 0x12, 0x3f, 0xbb, 0xc3, 0x3b, 0xe6, 0x13, 0x3b, 0xae, 0x30, 0x62,
-  0x90, 0x00, 0x20, 0x08, 0x06, 0x4a, 0xfc, 0xec, 0x4e, 0xf8, 0x98, 0x4f,
-  0xed, 0x88, 0xcd, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 0xf1, 0xb3,
-  0x3b, 0xe1, 0x63, 0x3e, 0xb0, 0x63, 0x36, 0x23, 0x06, 0x09, 0x00, 0x82,
-  0x60, 0xc0, 0xc0, 0xcf, 0xee, 0xec, 0x8e, 0xf9, 0xd4, 0xce, 0xce, 0x8c,
-  0x18, 0x24, 0x00, 0x08, 0x82, 0x01, 0x03, 0x3f, 0xbb, 0x53, 0x3e, 0xe6,
-  0x53, 0x3b, 0x39, 0x33, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x0c, 0xfc,
-  0xec, 0x8e, 0xef, 0x98, 0x4f, 0xed, 0xdc, 0xcc, 0x88, 0x41, 0x02, 0x80,
-  0x20, 0x18, 0x30, 0xf0, 0xb3, 0x3b, 0xba, 0x63, 0x3e, 0xb5, 0x53, 0x33,
-  0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0xc0, 0xc0, 0xcf, 0xee, 0xe4, 0x8e,
-  0xf9, 0xd4, 0xce, 0xcc, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x01, 0x03,
-  0x3f, 0xbb, 0x83, 0x3b, 0xe6, 0x53, 0x3b, 0x31, 0x33, 0x62, 0x90, 0x00,
-  0x20, 0x08, 0x06, 0x0c, 0xfc, 0xec, 0xce, 0xed, 0x98, 0x4f, 0xed, 0xb4,
-  0xcc, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 0xf1, 0xb3, 0x3b, 0xbf,
-  0x63, 0x3e, 0xb5, 0xa3, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x12,
-  0x3f, 0xbb, 0xf3, 0x3b, 0xe6, 0x03, 0x3b, 0xc7, 0x88, 0x41, 0x02, 0x80,
-  0x20, 0x18, 0x28, 0xf1, 0xb3, 0x3b, 0xbf, 0x63, 0x3e, 0xb1, 0xc3, 0x8c,
-  0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x12, 0x3f, 0xbb, 0xf3, 0x3b, 0xe7,
-  0x53, 0x3b, 0xd9, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28, 0xf1, 0xb3,
-  0x3b, 0xbf, 0x73, 0x3e, 0xb0, 0x43, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82,
-  0x81, 0x12, 0x3f, 0xbb, 0xf3, 0x3b, 0xe7, 0x13, 0x3b, 0xcb, 0x88, 0x41,
-  0x02, 0x80, 0x20, 0x18, 0x28, 0xf1, 0xb3, 0x3b, 0xbf, 0xc3, 0x3b, 0xb5,
-  0x83, 0x8d, 0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x12, 0x3f, 0xbb, 0xf3,
-  0x3b, 0xbc, 0x03, 0x3b, 0xc1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x28,
-  0xf1, 0xb3, 0x3b, 0xbf, 0xc3, 0x3b, 0xb1, 0xa3, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00
-};
@@ -1,1151 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; POSITION                 0   xyz         0     NONE   float   xyz 
-; NORMAL                   0   xyzw        1     NONE   float   xyzw
-; TANGENT                  0   xyzw        2     NONE   float   xyzw
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float   xyzw
-; POSITION                 0   xyzw        1     NONE   float   xyzw
-; POSITION                 1   xyz         2     NONE   float   xyz 
-; TBN_MATRIX               0   xyz         3     NONE   float   xyz 
-; TBN_MATRIX               1   xyz         4     NONE   float   xyz 
-; TBN_MATRIX               2   xyz         5     NONE   float   xyz 
-; TEXCOORD                 0   xy          6     NONE   float   xy  
-; MATERIAL                 0   x           7     NONE    uint   x   
-; MATERIAL                 1    y          7     NONE    uint    y  
-; MATERIAL                 2     z         7     NONE    uint     z 
-; MATERIAL                 3      w        7     NONE    uint      w
-; MATERIAL                 4   x           8     NONE    uint   x   
-; MATERIAL                 5    y          8     NONE    uint    y  
-; OBJECT_FLAGS             0     z         8     NONE    uint     z 
-;
-; shader hash: 1b81ca3eb4f12bc5d3b18845c177d2b6
-;
-; Pipeline Runtime Information: 
-;
-; Vertex Shader
-; OutputPositionPresent=1
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; POSITION                 0                              
-; NORMAL                   0                              
-; TANGENT                  0                              
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; POSITION                 0                 linear       
-; POSITION                 1                 linear       
-; TBN_MATRIX               0                 linear       
-; TEXCOORD                 0                 linear       
-; MATERIAL                 0        nointerpolation       
-; MATERIAL                 1        nointerpolation       
-; MATERIAL                 2        nointerpolation       
-; MATERIAL                 3        nointerpolation       
-; MATERIAL                 4        nointerpolation       
-; MATERIAL                 5        nointerpolation       
-; OBJECT_FLAGS             0        nointerpolation       
-;
-; Buffer Definitions:
-;
-; cbuffer rootConstants
-; {
-;
-;   struct rootConstants
-;   {
-;
-;       struct struct.RootConstants
-;       {
-;
-;           uint objectID;                            ; Offset:    0
-;       
-;       } rootConstants;                              ; Offset:    0
-;
-;   
-;   } rootConstants;                                  ; Offset:    0 Size:     4
-;
-; }
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-; Resource bind info for staticObjectBuffer
-; {
-;
-;   struct struct.StaticObject
-;   {
-;
-;       struct struct.BoundingSphere
-;       {
-;
-;           float3 center;                            ; Offset:    0
-;           float radius;                             ; Offset:   12
-;       
-;       } boundingSphere;                             ; Offset:    0
-;
-;       struct struct.LOD
-;       {
-;
-;           uint startIndex;                          ; Offset:   16
-;           uint indexCount;                          ; Offset:   20
-;           uint vertexOffset;                        ; Offset:   24
-;       
-;       } lods[3];;                                   ; Offset:   16
-;
-;       struct struct.Material
-;       {
-;
-;           uint baseColorID;                         ; Offset:   52
-;           uint normalID;                            ; Offset:   56
-;           uint roughnessAOID;                       ; Offset:   60
-;           uint metallicID;                          ; Offset:   64
-;           uint heightID;                            ; Offset:   68
-;           uint specialID;                           ; Offset:   72
-;       
-;       } material;                                   ; Offset:   52
-;
-;       uint flags;                                   ; Offset:   76
-;   
-;   } $Element;                                       ; Offset:    0 Size:    80
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; rootConstants                     cbuffer      NA          NA     CB0            cb0     1
-; cameraBuffer                      cbuffer      NA          NA     CB1            cb1     1
-; staticObjectBuffer                texture  struct         r/o      T0             t0     1
-;
-;
-; ViewId state:
-;
-; Number of inputs: 12, outputs: 35
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 0, 1, 2 }
-;   output 1 depends on inputs: { 0, 1, 2 }
-;   output 2 depends on inputs: { 0, 1, 2 }
-;   output 3 depends on inputs: { 0, 1, 2 }
-;   output 4 depends on inputs: { 0, 1, 2 }
-;   output 5 depends on inputs: { 0, 1, 2 }
-;   output 6 depends on inputs: { 0, 1, 2 }
-;   output 7 depends on inputs: { 0, 1, 2 }
-;   output 8 depends on inputs: { 0 }
-;   output 9 depends on inputs: { 1 }
-;   output 10 depends on inputs: { 2 }
-;   output 12 depends on inputs: { 8 }
-;   output 13 depends on inputs: { 5, 6, 9, 10 }
-;   output 14 depends on inputs: { 4 }
-;   output 16 depends on inputs: { 9 }
-;   output 17 depends on inputs: { 4, 6, 8, 10 }
-;   output 18 depends on inputs: { 5 }
-;   output 20 depends on inputs: { 10 }
-;   output 21 depends on inputs: { 4, 5, 8, 9 }
-;   output 22 depends on inputs: { 6 }
-;   output 24 depends on inputs: { 7 }
-;   output 25 depends on inputs: { 11 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.CBufRet.i32 = type { i32, i32, i32, i32 }
-%dx.types.ResRet.i32 = type { i32, i32, i32, i32, i32 }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%"class.StructuredBuffer<StaticObject>" = type { %struct.StaticObject }
-%struct.StaticObject = type { %struct.BoundingSphere, [3 x %struct.LOD], %struct.Material, i32 }
-%struct.BoundingSphere = type { <3 x float>, float }
-%struct.LOD = type { i32, i32, i32 }
-%struct.Material = type { i32, i32, i32, i32, i32, i32 }
-%rootConstants = type { %struct.RootConstants }
-%struct.RootConstants = type { i32 }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 1, i32 1, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %4 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %5 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %6 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %7 = call float @dx.op.loadInput.f32(i32 4, i32 2, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %8 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %9 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %10 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %11 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 3, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %12 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %13 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %14 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %15 = call %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32 59, %dx.types.Handle %3, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %16 = extractvalue %dx.types.CBufRet.i32 %15, 0
-  %17 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 52)  ; BufferLoad(srv,index,wot)
-  %18 = extractvalue %dx.types.ResRet.i32 %17, 0
-  %19 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 56)  ; BufferLoad(srv,index,wot)
-  %20 = extractvalue %dx.types.ResRet.i32 %19, 0
-  %21 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 60)  ; BufferLoad(srv,index,wot)
-  %22 = extractvalue %dx.types.ResRet.i32 %21, 0
-  %23 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 64)  ; BufferLoad(srv,index,wot)
-  %24 = extractvalue %dx.types.ResRet.i32 %23, 0
-  %25 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 68)  ; BufferLoad(srv,index,wot)
-  %26 = extractvalue %dx.types.ResRet.i32 %25, 0
-  %27 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 72)  ; BufferLoad(srv,index,wot)
-  %28 = extractvalue %dx.types.ResRet.i32 %27, 0
-  %29 = call %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32 68, %dx.types.Handle %1, i32 %16, i32 76)  ; BufferLoad(srv,index,wot)
-  %30 = extractvalue %dx.types.ResRet.i32 %29, 0
-  %31 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 12)  ; CBufferLoadLegacy(handle,regIndex)
-  %32 = extractvalue %dx.types.CBufRet.f32 %31, 0
-  %33 = extractvalue %dx.types.CBufRet.f32 %31, 1
-  %34 = extractvalue %dx.types.CBufRet.f32 %31, 2
-  %35 = extractvalue %dx.types.CBufRet.f32 %31, 3
-  %36 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 13)  ; CBufferLoadLegacy(handle,regIndex)
-  %37 = extractvalue %dx.types.CBufRet.f32 %36, 0
-  %38 = extractvalue %dx.types.CBufRet.f32 %36, 1
-  %39 = extractvalue %dx.types.CBufRet.f32 %36, 2
-  %40 = extractvalue %dx.types.CBufRet.f32 %36, 3
-  %41 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 14)  ; CBufferLoadLegacy(handle,regIndex)
-  %42 = extractvalue %dx.types.CBufRet.f32 %41, 0
-  %43 = extractvalue %dx.types.CBufRet.f32 %41, 1
-  %44 = extractvalue %dx.types.CBufRet.f32 %41, 2
-  %45 = extractvalue %dx.types.CBufRet.f32 %41, 3
-  %46 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %2, i32 15)  ; CBufferLoadLegacy(handle,regIndex)
-  %47 = extractvalue %dx.types.CBufRet.f32 %46, 0
-  %48 = extractvalue %dx.types.CBufRet.f32 %46, 1
-  %49 = extractvalue %dx.types.CBufRet.f32 %46, 2
-  %50 = extractvalue %dx.types.CBufRet.f32 %46, 3
-  %51 = fmul fast float %32, %12
-  %52 = call float @dx.op.tertiary.f32(i32 46, float %37, float %13, float %51)  ; FMad(a,b,c)
-  %53 = call float @dx.op.tertiary.f32(i32 46, float %42, float %14, float %52)  ; FMad(a,b,c)
-  %54 = fadd fast float %53, %47
-  %55 = fmul fast float %33, %12
-  %56 = call float @dx.op.tertiary.f32(i32 46, float %38, float %13, float %55)  ; FMad(a,b,c)
-  %57 = call float @dx.op.tertiary.f32(i32 46, float %43, float %14, float %56)  ; FMad(a,b,c)
-  %58 = fadd fast float %57, %48
-  %59 = fmul fast float %34, %12
-  %60 = call float @dx.op.tertiary.f32(i32 46, float %39, float %13, float %59)  ; FMad(a,b,c)
-  %61 = call float @dx.op.tertiary.f32(i32 46, float %44, float %14, float %60)  ; FMad(a,b,c)
-  %62 = fadd fast float %61, %49
-  %63 = fmul fast float %35, %12
-  %64 = call float @dx.op.tertiary.f32(i32 46, float %40, float %13, float %63)  ; FMad(a,b,c)
-  %65 = call float @dx.op.tertiary.f32(i32 46, float %45, float %14, float %64)  ; FMad(a,b,c)
-  %66 = fadd fast float %65, %50
-  %67 = fmul fast float %9, %6
-  %68 = fmul fast float %10, %5
-  %69 = fsub fast float %67, %68
-  %70 = fmul fast float %10, %4
-  %71 = fmul fast float %8, %6
-  %72 = fsub fast float %70, %71
-  %73 = fmul fast float %8, %5
-  %74 = fmul fast float %9, %4
-  %75 = fsub fast float %73, %74
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %54)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %58)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %62)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float %66)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 0, float %54)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 1, float %58)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 2, float %62)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 3, float %66)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 0, float %12)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 1, float %13)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 2, i32 0, i8 2, float %14)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 4, i32 0, i8 0, float %11)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 4, i32 0, i8 1, float %7)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 5, i32 0, i8 0, i32 %18)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 6, i32 0, i8 0, i32 %20)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 7, i32 0, i8 0, i32 %22)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 8, i32 0, i8 0, i32 %24)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 9, i32 0, i8 0, i32 %26)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 10, i32 0, i8 0, i32 %28)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.i32(i32 5, i32 11, i32 0, i8 0, i32 %30)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 0, float %4)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 1, float %69)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 0, i8 2, float %8)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 0, float %5)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 1, float %72)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 1, i8 2, float %9)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 0, float %6)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 1, float %75)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 3, i32 2, i8 2, float %10)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.loadInput.f32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.i32(i32, i32, i32, i8, i32) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.i32 @dx.op.cbufferLoadLegacy.i32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #2
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.i32 @dx.op.bufferLoad.i32(i32, %dx.types.Handle, i32, i32) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!11}
-!dx.entryPoints = !{!12}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"vs", i32 6, i32 0}
-!4 = !{!5, null, !8, null}
-!5 = !{!6}
-!6 = !{i32 0, %"class.StructuredBuffer<StaticObject>"* undef, !"", i32 0, i32 0, i32 1, i32 12, i32 0, !7}
-!7 = !{i32 1, i32 80}
-!8 = !{!9, !10}
-!9 = !{i32 0, %rootConstants* undef, !"", i32 0, i32 0, i32 1, i32 4, null}
-!10 = !{i32 1, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 1, i32 1, i32 304, null}
-!11 = !{[26 x i32] [i32 12, i32 35, i32 511, i32 0, i32 767, i32 0, i32 1279, i32 0, i32 0, i32 0, i32 2244608, i32 0, i32 2367488, i32 0, i32 4333568, i32 0, i32 16777216, i32 0, i32 2232320, i32 0, i32 2170880, i32 0, i32 1187840, i32 0, i32 33554432, i32 0]}
-!12 = !{void ()* @main, !"main", !13, !4, !42}
-!13 = !{!14, !21, null}
-!14 = !{!15, !18, !20}
-!15 = !{i32 0, !"POSITION", i8 9, i8 0, !16, i8 0, i32 1, i8 3, i32 0, i8 0, !17}
-!16 = !{i32 0}
-!17 = !{i32 3, i32 7}
-!18 = !{i32 1, !"NORMAL", i8 9, i8 0, !16, i8 0, i32 1, i8 4, i32 1, i8 0, !19}
-!19 = !{i32 3, i32 15}
-!20 = !{i32 2, !"TANGENT", i8 9, i8 0, !16, i8 0, i32 1, i8 4, i32 2, i8 0, !19}
-!21 = !{!22, !23, !24, !26, !28, !30, !32, !33, !35, !37, !39, !41}
-!22 = !{i32 0, !"SV_Position", i8 9, i8 3, !16, i8 4, i32 1, i8 4, i32 0, i8 0, !19}
-!23 = !{i32 1, !"POSITION", i8 9, i8 0, !16, i8 2, i32 1, i8 4, i32 1, i8 0, !19}
-!24 = !{i32 2, !"POSITION", i8 9, i8 0, !25, i8 2, i32 1, i8 3, i32 2, i8 0, !17}
-!25 = !{i32 1}
-!26 = !{i32 3, !"TBN_MATRIX", i8 9, i8 0, !27, i8 2, i32 3, i8 3, i32 3, i8 0, !17}
-!27 = !{i32 0, i32 1, i32 2}
-!28 = !{i32 4, !"TEXCOORD", i8 9, i8 0, !16, i8 2, i32 1, i8 2, i32 6, i8 0, !29}
-!29 = !{i32 3, i32 3}
-!30 = !{i32 5, !"MATERIAL", i8 5, i8 0, !16, i8 1, i32 1, i8 1, i32 7, i8 0, !31}
-!31 = !{i32 3, i32 1}
-!32 = !{i32 6, !"MATERIAL", i8 5, i8 0, !25, i8 1, i32 1, i8 1, i32 7, i8 1, !31}
-!33 = !{i32 7, !"MATERIAL", i8 5, i8 0, !34, i8 1, i32 1, i8 1, i32 7, i8 2, !31}
-!34 = !{i32 2}
-!35 = !{i32 8, !"MATERIAL", i8 5, i8 0, !36, i8 1, i32 1, i8 1, i32 7, i8 3, !31}
-!36 = !{i32 3}
-!37 = !{i32 9, !"MATERIAL", i8 5, i8 0, !38, i8 1, i32 1, i8 1, i32 8, i8 0, !31}
-!38 = !{i32 4}
-!39 = !{i32 10, !"MATERIAL", i8 5, i8 0, !40, i8 1, i32 1, i8 1, i32 8, i8 1, !31}
-!40 = !{i32 5}
-!41 = !{i32 11, !"OBJECT_FLAGS", i8 5, i8 0, !16, i8 1, i32 1, i8 1, i32 8, i8 2, !31}
-!42 = !{i32 0, i64 16}
-
-#endif
-
-const unsigned char RINShaderBytesPBRStaticVS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x92, 0xda, 0x98, 0x10, 0x60, 0xa5, 0x0f, 0xac,
-  0xfe, 0x14, 0x9b, 0xcf, 0xb2, 0x83, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0x00,
-  0x15, 0x23, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00,
-  0x85, 0x05, 0x00, 0x00, 0x45, 0x07, 0x00, 0x00, 0xd9, 0x15, 0x00, 0x00,
-  0xf5, 0x15, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x80, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00, 0x4e, 0x4f, 0x52,
-  0x4d, 0x41, 0x4c, 0x00, 0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e, 0x54, 0x00,
-  0x4f, 0x53, 0x47, 0x31, 0x3d, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xdd, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xe6, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xfa, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x08, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1e, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00,
-  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x04, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x56, 0x5f, 0x50,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x50, 0x4f, 0x53, 0x49,
-  0x54, 0x49, 0x4f, 0x4e, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f,
-  0x4e, 0x00, 0x54, 0x42, 0x4e, 0x5f, 0x4d, 0x41, 0x54, 0x52, 0x49, 0x58,
-  0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x4d, 0x41,
-  0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52,
-  0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c,
-  0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41,
-  0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52,
-  0x49, 0x41, 0x4c, 0x00, 0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x46,
-  0x4c, 0x41, 0x47, 0x53, 0x00, 0x50, 0x53, 0x56, 0x30, 0x60, 0x02, 0x00,
-  0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00,
-  0x03, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49,
-  0x4f, 0x4e, 0x00, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x00, 0x54, 0x41,
-  0x4e, 0x47, 0x45, 0x4e, 0x54, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49,
-  0x4f, 0x4e, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00,
-  0x54, 0x42, 0x4e, 0x5f, 0x4d, 0x41, 0x54, 0x52, 0x49, 0x58, 0x00, 0x54,
-  0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x4d, 0x41, 0x54, 0x45,
-  0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41,
-  0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d,
-  0x41, 0x54, 0x45, 0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45,
-  0x52, 0x49, 0x41, 0x4c, 0x00, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0x41,
-  0x4c, 0x00, 0x4f, 0x42, 0x4a, 0x45, 0x43, 0x54, 0x5f, 0x46, 0x4c, 0x41,
-  0x47, 0x53, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x44,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x44, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x03, 0x03, 0x04, 0x00,
-  0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x44,
-  0x00, 0x03, 0x02, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x43, 0x00, 0x03, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x03, 0x43, 0x00, 0x03, 0x02, 0x00,
-  0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x42,
-  0x00, 0x03, 0x02, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x07, 0x41, 0x00, 0x01, 0x01, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x51, 0x00, 0x01, 0x01, 0x00,
-  0x00, 0x51, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x07, 0x61,
-  0x00, 0x01, 0x01, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x01, 0x07, 0x71, 0x00, 0x01, 0x01, 0x00, 0x00, 0x63, 0x00, 0x00,
-  0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x08, 0x41, 0x00, 0x01, 0x01, 0x00,
-  0x00, 0x6c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x08, 0x51,
-  0x00, 0x01, 0x01, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x08, 0x61, 0x00, 0x01, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x22, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x20, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x42,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x12, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x52, 0x54, 0x53,
-  0x30, 0xb8, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x00,
-  0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x84, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x90, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x9c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7f, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f,
-  0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0x53, 0x54, 0x41, 0x54, 0x8c, 0x0e, 0x00, 0x00, 0x60, 0x00, 0x01,
-  0x00, 0xa3, 0x03, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00,
-  0x00, 0x10, 0x00, 0x00, 0x00, 0x74, 0x0e, 0x00, 0x00, 0x42, 0x43, 0xc0,
-  0xde, 0x21, 0x0c, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x00, 0x0b, 0x82, 0x20,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23,
-  0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84,
-  0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45,
-  0x02, 0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18,
-  0x4b, 0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88,
-  0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4,
-  0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46,
-  0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0,
-  0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff,
-  0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00,
-  0x00, 0x89, 0x20, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88,
-  0x09, 0x20, 0x64, 0x85, 0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23,
-  0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4,
-  0x4c, 0x10, 0xd8, 0xc1, 0x0c, 0xc0, 0x30, 0xc2, 0x00, 0x5c, 0x25, 0x4d,
-  0x11, 0x25, 0x4c, 0xfe, 0xe6, 0x50, 0xcd, 0x80, 0x34, 0x06, 0xfb, 0x1c,
-  0x44, 0x44, 0x20, 0x21, 0x00, 0xe6, 0x08, 0xc0, 0xe0, 0x14, 0x69, 0x8a,
-  0x28, 0x61, 0xf2, 0x4b, 0xb4, 0x43, 0xc3, 0x30, 0x0c, 0x39, 0x40, 0xdc,
-  0x23, 0x4d, 0x11, 0x25, 0x4c, 0xbe, 0x09, 0x4c, 0x44, 0x84, 0x00, 0x0b,
-  0x32, 0x86, 0x61, 0x18, 0x86, 0xe1, 0x26, 0x69, 0x8a, 0x28, 0x61, 0xf2,
-  0xd9, 0x09, 0x98, 0x10, 0x01, 0x0d, 0x12, 0x42, 0x98, 0x10, 0x21, 0x14,
-  0xc6, 0x30, 0x13, 0x19, 0x8c, 0x03, 0x3b, 0x84, 0xc3, 0x3c, 0xcc, 0x83,
-  0x1b, 0xcc, 0x02, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xd4, 0x83,
-  0x3c, 0x94, 0x03, 0x39, 0x88, 0x42, 0x3d, 0x98, 0x83, 0x39, 0x94, 0x83,
-  0x3c, 0xf0, 0xc1, 0x2c, 0xd0, 0x43, 0x38, 0xd0, 0x43, 0x3a, 0x8c, 0xc3,
-  0x2b, 0x88, 0x83, 0x3a, 0x94, 0xc3, 0x38, 0xd0, 0x83, 0x1f, 0xa0, 0xe0,
-  0x20, 0xe4, 0x28, 0x69, 0x8a, 0x28, 0x61, 0xf2, 0x57, 0xc7, 0x99, 0x38,
-  0xa7, 0x91, 0x26, 0xa0, 0x99, 0x24, 0x14, 0x0c, 0xd7, 0x44, 0x8e, 0x33,
-  0x71, 0x4e, 0x23, 0x4d, 0x40, 0x33, 0x49, 0x28, 0x50, 0x68, 0x19, 0x46,
-  0x20, 0x80, 0x24, 0x68, 0x2e, 0x0c, 0x86, 0xcb, 0x07, 0x16, 0xc4, 0x68,
-  0x18, 0xa2, 0x99, 0xfc, 0x85, 0x30, 0x00, 0x01, 0xf3, 0xa5, 0x29, 0xa2,
-  0x84, 0xc9, 0xe7, 0x00, 0x86, 0x88, 0x00, 0xe4, 0x38, 0x8e, 0xe3, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x81, 0xc1, 0x70, 0xf9, 0xc0,
-  0x82, 0x18, 0x0d, 0x43, 0x34, 0x93, 0xbf, 0x10, 0x06, 0x20, 0x60, 0xbe,
-  0x00, 0x30, 0x44, 0x04, 0x6c, 0x54, 0x51, 0x10, 0x11, 0x0a, 0x1e, 0x82,
-  0x46, 0x00, 0x4a, 0x20, 0xd1, 0x34, 0x47, 0x80, 0x14, 0x03, 0x18, 0x86,
-  0xa1, 0x1a, 0xc8, 0x2a, 0x86, 0x34, 0x0c, 0x43, 0x05, 0x10, 0x56, 0x0c,
-  0x69, 0x18, 0x86, 0x6a, 0x20, 0xed, 0xa8, 0xe1, 0xf2, 0x27, 0xec, 0x21,
-  0x24, 0x9f, 0xdb, 0xa8, 0x62, 0x25, 0x26, 0x1f, 0xb9, 0x6d, 0x44, 0x0c,
-  0xc3, 0x30, 0x50, 0x75, 0xcf, 0x70, 0xf9, 0x13, 0xf6, 0x10, 0x92, 0x1f,
-  0x02, 0xcd, 0xb0, 0x10, 0x28, 0xe8, 0x0a, 0xc1, 0x0d, 0xde, 0x40, 0xdf,
-  0x51, 0xc3, 0xe5, 0x4f, 0xd8, 0x43, 0x48, 0x3e, 0xb7, 0x51, 0xc5, 0x4a,
-  0x4c, 0x7e, 0x71, 0xdb, 0x88, 0x00, 0x00, 0x00, 0x28, 0x44, 0x38, 0x78,
-  0x03, 0x89, 0xa5, 0x00, 0x06, 0x00, 0x00, 0x88, 0x9c, 0x23, 0x08, 0x8a,
-  0xe1, 0x0d, 0xd5, 0x30, 0x98, 0x74, 0xde, 0x34, 0x5c, 0xfe, 0x84, 0x3d,
-  0x84, 0xe4, 0xaf, 0x84, 0xb4, 0x12, 0x93, 0x8f, 0xdc, 0x36, 0x2a, 0x86,
-  0x61, 0x18, 0x86, 0x52, 0xa4, 0x83, 0x37, 0x0c, 0xa4, 0x0e, 0x04, 0x9c,
-  0x25, 0x2c, 0x80, 0x24, 0xf9, 0x0c, 0x30, 0x45, 0xc8, 0xe5, 0x17, 0x8b,
-  0x03, 0x4c, 0x3e, 0xee, 0xe3, 0x28, 0x70, 0xae, 0x91, 0xa6, 0x88, 0x12,
-  0x26, 0x9f, 0x03, 0x18, 0x22, 0x02, 0x90, 0xd3, 0xb6, 0x6d, 0x1b, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x10, 0x9c, 0x25, 0x2c, 0x80,
-  0x24, 0xf9, 0x0c, 0x30, 0x45, 0xc8, 0xe5, 0x17, 0x8b, 0x03, 0x4c, 0xfe,
-  0xed, 0xdf, 0x28, 0x78, 0x87, 0x11, 0x04, 0xe0, 0x1e, 0x69, 0x8a, 0x28,
-  0x61, 0xf2, 0xd3, 0x6d, 0x15, 0x9b, 0x87, 0x9a, 0xd0, 0xd1, 0x34, 0x01,
-  0x1c, 0x1b, 0xc3, 0x31, 0x02, 0xc0, 0x10, 0x11, 0xb0, 0x51, 0x45, 0x41,
-  0x44, 0x28, 0x70, 0x53, 0x63, 0x98, 0x23, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87,
-  0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0,
-  0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40,
-  0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30,
-  0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40,
-  0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a, 0x0f, 0xa4, 0x90, 0x21,
-  0x23, 0x45, 0x44, 0x00, 0xa2, 0x01, 0x00, 0x73, 0x0d, 0x00, 0x80, 0x50,
-  0x00, 0x00, 0x43, 0x9e, 0x09, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x86, 0x3c, 0x16, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x30, 0x20, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x68, 0x40, 0x00, 0x08, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0xf9, 0x80, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x23, 0x06, 0x40,
-  0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x21,
-  0x03, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0xf2, 0x9c, 0x01, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0c, 0x79, 0xd4, 0x00, 0x08, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xb2, 0x40, 0x37, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98,
-  0x1c, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43,
-  0xaa, 0x0b, 0x84, 0x86, 0x12, 0x18, 0x01, 0x28, 0x86, 0xc2, 0x28, 0xd0,
-  0x80, 0x42, 0x28, 0x70, 0x82, 0x32, 0x28, 0x87, 0x52, 0x28, 0x82, 0x92,
-  0x28, 0xc0, 0x80, 0x02, 0x14, 0x28, 0xc0, 0x81, 0x02, 0x24, 0x28, 0x4c,
-  0x82, 0x02, 0x25, 0x28, 0x54, 0x82, 0x82, 0x25, 0x28, 0x5c, 0x82, 0x02,
-  0x26, 0x28, 0x64, 0x82, 0x82, 0x26, 0x28, 0x6c, 0x82, 0xc2, 0x0d, 0x28,
-  0x90, 0x82, 0x0d, 0x28, 0x88, 0x82, 0x29, 0x94, 0xc2, 0x14, 0x28, 0xa0,
-  0x02, 0x2b, 0xe0, 0x80, 0x02, 0x0f, 0x28, 0x48, 0x81, 0xf2, 0x28, 0x8a,
-  0xb2, 0x28, 0x91, 0x92, 0x0e, 0x28, 0x1d, 0xaa, 0x4a, 0xa0, 0x14, 0x8a,
-  0xa0, 0x10, 0xca, 0x60, 0x04, 0xa0, 0x24, 0x88, 0x99, 0x01, 0xa0, 0x67,
-  0x06, 0x80, 0xa0, 0x19, 0x00, 0x8a, 0x66, 0x00, 0x68, 0x99, 0x01, 0x20,
-  0x65, 0x06, 0x80, 0x92, 0x19, 0x00, 0x42, 0x66, 0x00, 0xe8, 0x98, 0x01,
-  0x20, 0x63, 0x06, 0x80, 0x88, 0x19, 0x00, 0x72, 0x67, 0x00, 0x48, 0x9e,
-  0x01, 0xa0, 0x79, 0x06, 0x80, 0xe8, 0xb1, 0x34, 0x66, 0x0c, 0xfe, 0x07,
-  0xf8, 0x2f, 0xe0, 0x3f, 0x03, 0x00, 0x00, 0x40, 0x10, 0x26, 0x05, 0x00,
-  0x04, 0x51, 0x54, 0x00, 0x40, 0x10, 0x25, 0x09, 0x00, 0x04, 0x41, 0x10,
-  0x02, 0x40, 0x90, 0x24, 0x05, 0x00, 0x04, 0x51, 0x51, 0x00, 0x40, 0x10,
-  0x25, 0x03, 0x00, 0x04, 0x41, 0x10, 0x0c, 0x00, 0x12, 0x66, 0x00, 0x00,
-  0x00, 0x79, 0x18, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x1a, 0x03, 0x4c,
-  0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03,
-  0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01,
-  0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a,
-  0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b,
-  0xd9, 0x10, 0x04, 0x13, 0x84, 0xa1, 0x99, 0x20, 0x0c, 0xce, 0x06, 0x61,
-  0x20, 0x36, 0x08, 0x04, 0x41, 0xc1, 0x6e, 0x6e, 0x82, 0x30, 0x3c, 0x1b,
-  0x86, 0x03, 0x21, 0x26, 0x08, 0x49, 0x29, 0x50, 0x9a, 0xa3, 0x0b, 0xa3,
-  0x4b, 0x1b, 0x7b, 0x12, 0x53, 0x2b, 0x1b, 0xa3, 0x13, 0xaa, 0x33, 0x33,
-  0x2b, 0x93, 0x9b, 0x20, 0x0c, 0xd0, 0x04, 0x61, 0x88, 0x36, 0x08, 0x43,
-  0xb3, 0x21, 0x21, 0x94, 0x85, 0x20, 0x06, 0x86, 0x70, 0x36, 0x04, 0xcf,
-  0x04, 0x81, 0xf9, 0x03, 0x36, 0x72, 0x6f, 0x6f, 0x74, 0x43, 0x6f, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x74, 0x73, 0x13, 0x84, 0x41, 0xda, 0x80, 0x10,
-  0x91, 0x44, 0x10, 0xc3, 0x04, 0x4c, 0x10, 0x22, 0x51, 0x20, 0x33, 0x16,
-  0xd6, 0x56, 0x26, 0x17, 0x26, 0x54, 0x67, 0x66, 0x56, 0x26, 0x37, 0x41,
-  0x18, 0xa6, 0x0d, 0xc8, 0x50, 0x59, 0xc4, 0x30, 0x5c, 0xc0, 0x06, 0x81,
-  0xc2, 0x36, 0x10, 0x10, 0x90, 0x01, 0x13, 0x04, 0x85, 0x14, 0x88, 0xbc,
-  0x89, 0xa9, 0x95, 0x8d, 0xd1, 0x25, 0x11, 0x4d, 0x10, 0x06, 0x6a, 0x82,
-  0x30, 0x54, 0x13, 0x84, 0xc1, 0xda, 0x60, 0x20, 0x5c, 0x47, 0x78, 0xdf,
-  0x06, 0x61, 0x02, 0x83, 0x09, 0x82, 0x1b, 0xa8, 0x02, 0x15, 0xbb, 0xb4,
-  0xb2, 0xbb, 0xa6, 0x30, 0x3a, 0xb9, 0x34, 0xbc, 0x09, 0xc2, 0x70, 0x6d,
-  0x18, 0xa6, 0x89, 0x0c, 0x26, 0x08, 0x03, 0xb6, 0x01, 0x41, 0xc6, 0x80,
-  0x0c, 0xca, 0xa0, 0x23, 0x3c, 0x33, 0xa0, 0x02, 0x27, 0xf7, 0xa6, 0xd6,
-  0x14, 0x46, 0x27, 0x97, 0x86, 0x37, 0x41, 0x18, 0xb2, 0x0d, 0x08, 0x82,
-  0x06, 0x64, 0x50, 0x06, 0x5d, 0x1a, 0x78, 0x66, 0xc0, 0x26, 0xcd, 0xcd,
-  0x0e, 0x4a, 0xee, 0x4d, 0xad, 0x29, 0x8c, 0x4e, 0x2e, 0x0d, 0x6f, 0x82,
-  0x30, 0x68, 0x1b, 0x10, 0x64, 0x0d, 0xc8, 0xa0, 0x0c, 0x3a, 0x36, 0xf0,
-  0xcc, 0x80, 0x8e, 0x5d, 0x5a, 0xd9, 0x1d, 0x94, 0xdc, 0x9b, 0x5a, 0x53,
-  0x18, 0x9d, 0x5c, 0x1a, 0xde, 0x04, 0x61, 0xd8, 0x36, 0x20, 0x88, 0x1b,
-  0x90, 0x41, 0x19, 0x74, 0x6f, 0xe0, 0x99, 0x01, 0x11, 0xb8, 0xb7, 0xb9,
-  0x34, 0xba, 0xb4, 0x37, 0xb7, 0x09, 0xc2, 0xc0, 0x6d, 0x30, 0x90, 0x38,
-  0xe8, 0xe4, 0xc0, 0x33, 0x03, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
-  0x67, 0x30, 0x13, 0x84, 0xa1, 0xdb, 0x60, 0x20, 0x74, 0xd0, 0xd5, 0x81,
-  0x67, 0x06, 0x4c, 0xcc, 0xe4, 0xea, 0xe6, 0xe8, 0xea, 0xda, 0xb0, 0xb0,
-  0x26, 0x08, 0x83, 0xb7, 0xc1, 0x40, 0xee, 0xa0, 0xc3, 0x03, 0xcf, 0x0c,
-  0x98, 0x98, 0xc9, 0xd5, 0xcd, 0xd1, 0xd5, 0xb5, 0x61, 0x69, 0x4d, 0x10,
-  0x86, 0x6f, 0x83, 0x81, 0xe8, 0x41, 0xb7, 0x07, 0x9e, 0x19, 0x30, 0x31,
-  0x93, 0xab, 0x9b, 0xa3, 0xab, 0x6b, 0xcb, 0xca, 0x9a, 0x20, 0x0c, 0x60,
-  0xb0, 0xc1, 0x40, 0xfa, 0xa0, 0xf3, 0x03, 0xcf, 0x0c, 0x98, 0x98, 0xc9,
-  0xd5, 0xcd, 0xd1, 0xd5, 0xb5, 0x65, 0x69, 0x4d, 0x10, 0x86, 0x30, 0xd8,
-  0x60, 0x20, 0xa0, 0xd0, 0x85, 0x82, 0x67, 0x06, 0x2c, 0xdc, 0xca, 0xc2,
-  0xe4, 0xb4, 0x26, 0x08, 0x83, 0x18, 0x6c, 0x30, 0x90, 0x51, 0xe8, 0x48,
-  0xc1, 0x33, 0x03, 0x12, 0x66, 0x61, 0x72, 0x5a, 0x13, 0x84, 0x61, 0x0c,
-  0x36, 0x18, 0x88, 0x29, 0x74, 0xa7, 0xe0, 0x99, 0x01, 0xa1, 0x31, 0xb6,
-  0xba, 0x39, 0xba, 0x32, 0xb9, 0xa1, 0x37, 0xb7, 0x39, 0xba, 0x30, 0x37,
-  0xba, 0xa0, 0x09, 0xc2, 0x40, 0x06, 0x1b, 0x0c, 0x24, 0x15, 0x3a, 0x55,
-  0xf0, 0xcc, 0x80, 0xd0, 0x18, 0x5b, 0xdd, 0x1c, 0x5d, 0x99, 0xdc, 0xd0,
-  0x9b, 0xdb, 0x1c, 0x5d, 0x98, 0x1b, 0x9d, 0xd0, 0x04, 0x61, 0x28, 0x83,
-  0x0d, 0x06, 0xc2, 0x0a, 0x5d, 0x2b, 0x78, 0x66, 0xb0, 0xe1, 0xb9, 0xce,
-  0x40, 0x0d, 0xda, 0x00, 0x0e, 0xe6, 0xc0, 0x0e, 0xf2, 0x80, 0x0f, 0xfe,
-  0x40, 0x14, 0x4a, 0x01, 0x15, 0x56, 0xc1, 0x15, 0x26, 0x08, 0x88, 0x29,
-  0x4c, 0x10, 0x06, 0x33, 0x60, 0x80, 0xb6, 0x81, 0x40, 0x64, 0xa1, 0x23,
-  0x26, 0x08, 0xc7, 0x29, 0x6c, 0x10, 0x08, 0x5a, 0xd8, 0x10, 0xd4, 0xc2,
-  0x06, 0x81, 0xb0, 0x85, 0x0d, 0x43, 0x2c, 0xcc, 0xc2, 0x2d, 0xd0, 0x11,
-  0x7b, 0xab, 0x73, 0x23, 0x4b, 0x73, 0x3b, 0x9b, 0x82, 0x43, 0x2b, 0x93,
-  0x2b, 0xdb, 0x40, 0x20, 0xb9, 0xd0, 0x11, 0x24, 0xd8, 0xde, 0xc8, 0xe6,
-  0x26, 0x08, 0xc3, 0x19, 0x6c, 0x20, 0x90, 0x5d, 0xe8, 0x78, 0x81, 0x48,
-  0x5b, 0x18, 0x5d, 0x99, 0x5c, 0x5a, 0x18, 0xdb, 0x06, 0x02, 0xf1, 0x85,
-  0x2e, 0x0d, 0x58, 0x98, 0xb1, 0x85, 0x9d, 0xcd, 0x4d, 0x10, 0x06, 0x34,
-  0xd8, 0x60, 0x20, 0xe0, 0xd0, 0x85, 0x83, 0xf7, 0x6d, 0x28, 0x62, 0x41,
-  0x17, 0x7a, 0xe1, 0x17, 0xc4, 0x61, 0x82, 0x20, 0xb8, 0x02, 0x8d, 0xb1,
-  0x32, 0x37, 0xba, 0x32, 0xb9, 0x0d, 0x06, 0x52, 0x0e, 0x1d, 0xe1, 0x99,
-  0x01, 0x0d, 0xb9, 0x30, 0xb2, 0xb4, 0xba, 0xb9, 0x0d, 0x06, 0x72, 0x0e,
-  0x1d, 0xe3, 0x99, 0xc1, 0x86, 0x81, 0x17, 0xcc, 0x01, 0x1d, 0x26, 0x08,
-  0x44, 0x2a, 0x50, 0x99, 0xa3, 0x0b, 0x93, 0xa3, 0x4b, 0x72, 0x23, 0x2b,
-  0xc3, 0xdb, 0x60, 0x20, 0xeb, 0xd0, 0x11, 0xde, 0x47, 0x25, 0xcd, 0x8d,
-  0xac, 0x0c, 0x6f, 0xe8, 0xad, 0xce, 0x8d, 0x6e, 0x83, 0x81, 0xb4, 0x43,
-  0x37, 0x79, 0x1f, 0x19, 0xbb, 0x32, 0x39, 0xba, 0x32, 0xbc, 0x27, 0x33,
-  0xb3, 0xb9, 0x32, 0xba, 0x09, 0xc2, 0x90, 0x06, 0x1b, 0x0c, 0xe4, 0x1d,
-  0x3a, 0x78, 0xf0, 0xbe, 0x0d, 0x04, 0xc3, 0x0e, 0xee, 0x10, 0x0f, 0x13,
-  0x04, 0x03, 0x15, 0x26, 0x08, 0x83, 0x1a, 0x70, 0x11, 0x0b, 0x9b, 0x2b,
-  0x1b, 0x7a, 0x63, 0x7b, 0x93, 0x4b, 0x22, 0xda, 0x60, 0x20, 0xf5, 0xd0,
-  0x11, 0xde, 0x47, 0xc4, 0xed, 0x4d, 0xae, 0x2d, 0x8c, 0x2d, 0x89, 0x68,
-  0x83, 0x81, 0xdc, 0x43, 0x37, 0x79, 0x1f, 0x1b, 0xb9, 0xb7, 0xba, 0x33,
-  0x34, 0xb7, 0xb2, 0xb9, 0xb9, 0xa0, 0xa7, 0x24, 0xa2, 0x0d, 0x06, 0x92,
-  0x0f, 0x1d, 0x3c, 0x78, 0x1f, 0x95, 0xb6, 0x32, 0xba, 0x30, 0x36, 0xb6,
-  0xb4, 0xb1, 0x24, 0xa2, 0x0d, 0x06, 0xb2, 0x0f, 0x1d, 0xe3, 0x7d, 0x44,
-  0xd0, 0xca, 0xd2, 0xce, 0xd0, 0xe8, 0x92, 0x88, 0x36, 0x18, 0x48, 0x3f,
-  0x74, 0xbc, 0xe0, 0x7d, 0x4c, 0xe6, 0xe0, 0xca, 0xc6, 0xd2, 0xc2, 0xd8,
-  0x92, 0x88, 0x26, 0x08, 0xc3, 0x1a, 0x6c, 0x30, 0x90, 0x7f, 0xe8, 0x40,
-  0xc2, 0xfb, 0x36, 0x1c, 0xf4, 0x60, 0x0f, 0xf8, 0xa0, 0x0f, 0xfc, 0xe0,
-  0x0f, 0x21, 0x31, 0x41, 0x90, 0x83, 0x55, 0x98, 0x20, 0x0c, 0x6c, 0xc0,
-  0x65, 0xca, 0xea, 0x0b, 0xea, 0x69, 0x2a, 0x89, 0x2a, 0xe9, 0xc9, 0x69,
-  0x03, 0x82, 0xc4, 0x41, 0x47, 0x4c, 0x25, 0xe1, 0x99, 0x01, 0x8f, 0x31,
-  0xb6, 0x34, 0x38, 0xa8, 0xb7, 0x39, 0x26, 0x50, 0x4f, 0x53, 0x49, 0x54,
-  0x49, 0x4f, 0x4e, 0x30, 0x1b, 0x10, 0xe4, 0x24, 0x3a, 0x5e, 0x98, 0x50,
-  0xc2, 0x33, 0x03, 0x22, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x50, 0x6f, 0x73,
-  0x13, 0x84, 0xa1, 0x0d, 0x98, 0x40, 0x3d, 0x4d, 0x25, 0x51, 0x25, 0x3d,
-  0x39, 0xc5, 0x6c, 0x40, 0x10, 0x95, 0xe8, 0x56, 0x62, 0x62, 0x09, 0xcf,
-  0x0c, 0x38, 0xd0, 0x89, 0xb9, 0x6d, 0x18, 0xba, 0x8e, 0x0c, 0x26, 0x08,
-  0x83, 0x1b, 0x50, 0xa1, 0x12, 0x72, 0xfa, 0x6a, 0x0a, 0xa2, 0x92, 0x4a,
-  0xc2, 0xda, 0xa0, 0x20, 0x2e, 0x41, 0x06, 0x2f, 0xd1, 0xc1, 0xc4, 0x14,
-  0x13, 0x9e, 0x19, 0x70, 0xa0, 0x2b, 0xc3, 0x9b, 0x20, 0x0c, 0x6f, 0x40,
-  0x84, 0xaa, 0x08, 0x6b, 0xe8, 0xe9, 0x49, 0x8a, 0x68, 0x03, 0x82, 0xcc,
-  0x44, 0x47, 0x13, 0x53, 0x4d, 0x78, 0x66, 0x30, 0x41, 0x18, 0xe0, 0x80,
-  0x48, 0x53, 0x10, 0x55, 0x91, 0x54, 0x52, 0x10, 0xd3, 0x06, 0x03, 0xf1,
-  0x85, 0xee, 0x26, 0x26, 0x9c, 0x98, 0x20, 0x0c, 0x71, 0x40, 0xe6, 0x49,
-  0x48, 0xa9, 0x68, 0x88, 0xea, 0xcb, 0x88, 0x29, 0xe8, 0x68, 0x6a, 0x03,
-  0x82, 0x80, 0x43, 0xa7, 0x13, 0xd3, 0x4e, 0x78, 0xdf, 0x06, 0x84, 0x24,
-  0x4c, 0x22, 0x25, 0x5a, 0x42, 0x26, 0x6c, 0x22, 0x27, 0x78, 0x62, 0x82,
-  0xb0, 0x8c, 0xc2, 0x06, 0x02, 0x91, 0x3a, 0x62, 0x83, 0x30, 0xfd, 0xc4,
-  0x04, 0x61, 0x0e, 0x58, 0x61, 0x03, 0x81, 0x58, 0x1d, 0xb1, 0x41, 0xb8,
-  0xc4, 0x62, 0x82, 0xf0, 0x80, 0xc2, 0x04, 0x01, 0x0a, 0x85, 0x0d, 0x19,
-  0xb1, 0x85, 0x81, 0x18, 0xbc, 0x02, 0x2c, 0xe0, 0x02, 0x2d, 0x8c, 0x03,
-  0x39, 0xa4, 0x83, 0x3a, 0xc8, 0xc3, 0x3c, 0x88, 0xc4, 0x48, 0xf4, 0x84,
-  0x4f, 0x80, 0x45, 0x58, 0x8c, 0x05, 0x59, 0xbc, 0x42, 0x59, 0x8c, 0xc5,
-  0x04, 0x81, 0x1a, 0x36, 0x00, 0x1b, 0x06, 0x02, 0x2d, 0xd0, 0x62, 0x43,
-  0x90, 0x16, 0x1b, 0x86, 0xe1, 0x2c, 0xd4, 0x62, 0x82, 0x40, 0x07, 0xad,
-  0xb0, 0x21, 0x60, 0x0b, 0x12, 0x6d, 0x61, 0x69, 0x6e, 0x44, 0xa0, 0x9e,
-  0xa6, 0x92, 0xa8, 0x92, 0x9e, 0x9c, 0x26, 0x08, 0x95, 0x1f, 0x4c, 0x10,
-  0xaa, 0x3e, 0xd8, 0x10, 0x10, 0x13, 0x84, 0x8a, 0x0f, 0x36, 0x08, 0x9d,
-  0xb7, 0x61, 0x21, 0xde, 0x02, 0x2e, 0xe2, 0x42, 0x2e, 0xe2, 0x62, 0x98,
-  0x0b, 0x22, 0x2e, 0xe8, 0x82, 0x86, 0xd3, 0x93, 0x54, 0x53, 0x10, 0xd3,
-  0x04, 0xa1, 0xda, 0x83, 0x09, 0xc2, 0x20, 0x07, 0x1b, 0x84, 0x0e, 0x2f,
-  0x36, 0x2c, 0x83, 0x5d, 0xc0, 0x45, 0x5c, 0xc8, 0x45, 0x5c, 0x0c, 0x77,
-  0x31, 0xc4, 0x45, 0x5e, 0xf0, 0xa0, 0x0a, 0x72, 0x3a, 0x2a, 0x72, 0xa2,
-  0xda, 0xb0, 0x90, 0xc1, 0x5e, 0xc0, 0x45, 0x5c, 0xc8, 0x45, 0x5c, 0x0c,
-  0x77, 0x41, 0x06, 0x71, 0x91, 0x17, 0x1b, 0x86, 0xba, 0xd0, 0x0b, 0xbe,
-  0xe0, 0x32, 0x65, 0xf5, 0x05, 0xf5, 0x36, 0x97, 0x46, 0x97, 0xf6, 0xe6,
-  0xb6, 0x61, 0x21, 0xfc, 0x02, 0x2e, 0xe6, 0x42, 0x2e, 0xee, 0x62, 0xb8,
-  0x0b, 0x22, 0x2e, 0xf2, 0x62, 0x82, 0x50, 0xe9, 0xc1, 0x86, 0x65, 0x78,
-  0x0b, 0xb8, 0x88, 0x0b, 0xb9, 0x00, 0x8d, 0xe1, 0x2e, 0x86, 0xb8, 0xc8,
-  0x8b, 0x0d, 0xc1, 0xb0, 0x61, 0x21, 0x83, 0xb7, 0x80, 0x8b, 0xb8, 0x10,
-  0x0d, 0xd0, 0x18, 0xe6, 0x82, 0x0c, 0xe2, 0x82, 0x2e, 0x36, 0x0c, 0xc4,
-  0x40, 0x06, 0x1b, 0x96, 0x2e, 0x26, 0xe0, 0x22, 0x2e, 0x48, 0x03, 0x34,
-  0xba, 0xb9, 0xe8, 0xe2, 0x82, 0x2e, 0x36, 0x08, 0x5d, 0xb7, 0x61, 0x99,
-  0x6a, 0x02, 0x2e, 0xe2, 0x42, 0x2e, 0x40, 0x63, 0x00, 0x0d, 0x24, 0x2e,
-  0x4c, 0x63, 0x82, 0x50, 0xe5, 0xc1, 0x04, 0xa1, 0xc2, 0x83, 0x0d, 0x42,
-  0x37, 0x6c, 0x58, 0x3e, 0x9c, 0x40, 0x8d, 0xb8, 0x90, 0x8b, 0xd4, 0x18,
-  0x52, 0xc3, 0x8b, 0x0b, 0xd5, 0xd8, 0xb0, 0x20, 0x38, 0x81, 0x1a, 0x71,
-  0x21, 0x1a, 0xa9, 0x31, 0xa4, 0x86, 0x97, 0x1a, 0xaa, 0xb1, 0x21, 0x20,
-  0x83, 0x0d, 0x8b, 0x87, 0x13, 0xa8, 0x11, 0x17, 0xad, 0x91, 0x1a, 0x43,
-  0x6a, 0x78, 0xa0, 0xa1, 0x1a, 0x1b, 0x82, 0x6e, 0xc3, 0x02, 0x0f, 0x38,
-  0x81, 0x1a, 0x71, 0xf1, 0x1a, 0xa9, 0x31, 0xa4, 0x86, 0x37, 0x17, 0xaa,
-  0xb1, 0x21, 0x98, 0x36, 0x2c, 0x66, 0x80, 0x13, 0xa8, 0x11, 0x17, 0xb1,
-  0x91, 0x1a, 0x43, 0x6a, 0xc0, 0x43, 0x5c, 0xa8, 0xc6, 0x04, 0x61, 0x98,
-  0x83, 0x0d, 0xc1, 0xb7, 0x61, 0x99, 0x0d, 0x9c, 0x40, 0x8d, 0xb8, 0xa0,
-  0x8d, 0xd4, 0x18, 0x52, 0x03, 0x1e, 0x52, 0x43, 0x35, 0x26, 0x08, 0x03,
-  0x1d, 0x6c, 0x58, 0x6c, 0x63, 0x27, 0x50, 0x23, 0x2e, 0xe4, 0x22, 0x35,
-  0x86, 0xd4, 0x80, 0x07, 0xd0, 0x50, 0x8d, 0x0d, 0xcc, 0x5f, 0x84, 0xc6,
-  0x68, 0x94, 0xc6, 0x69, 0xac, 0x06, 0x6b, 0xb8, 0x06, 0x6c, 0xc8, 0x46,
-  0x6d, 0xdc, 0xc6, 0x86, 0xa1, 0x2f, 0x70, 0x03, 0x98, 0x20, 0xd4, 0x01,
-  0xb3, 0x41, 0x20, 0x74, 0x63, 0x43, 0x71, 0x16, 0x6e, 0x91, 0x1b, 0xda,
-  0x6e, 0xd0, 0x30, 0x63, 0x7b, 0x0b, 0xa3, 0x9b, 0x9b, 0x20, 0x0c, 0x75,
-  0xc0, 0x22, 0xcd, 0x6d, 0x8e, 0x6e, 0x6e, 0x82, 0x30, 0xd8, 0x01, 0x8d,
-  0xb9, 0xb4, 0xb3, 0x2f, 0x36, 0x32, 0x1a, 0x73, 0x69, 0x67, 0x5f, 0x73,
-  0x74, 0x13, 0x84, 0xe1, 0x0e, 0x88, 0xd0, 0x95, 0xe1, 0x7d, 0xb1, 0xbd,
-  0x85, 0x91, 0x6d, 0x50, 0x7a, 0xc3, 0x37, 0x7e, 0x03, 0x3c, 0xc2, 0xc3,
-  0x36, 0xc4, 0x63, 0x3c, 0xc8, 0xc3, 0xab, 0xc2, 0xc6, 0x66, 0xd7, 0xe6,
-  0x92, 0x46, 0x56, 0xe6, 0x46, 0x37, 0x25, 0x08, 0xaa, 0x90, 0xe1, 0xb9,
-  0xd8, 0x95, 0xc9, 0xcd, 0xa5, 0xbd, 0xb9, 0x4d, 0x09, 0x88, 0x26, 0x64,
-  0x78, 0x2e, 0x76, 0x61, 0x6c, 0x76, 0x65, 0x72, 0x53, 0x82, 0xa2, 0x0e,
-  0x19, 0x9e, 0xcb, 0x1c, 0x5a, 0x18, 0x59, 0x99, 0x5c, 0xd3, 0x1b, 0x59,
-  0x19, 0xdb, 0x94, 0x00, 0x29, 0x43, 0x86, 0xe7, 0x22, 0x57, 0x36, 0xf7,
-  0x56, 0x27, 0x37, 0x56, 0x36, 0x37, 0x25, 0xc8, 0x2a, 0x91, 0xe1, 0xb9,
-  0xd0, 0xe5, 0xc1, 0x95, 0x05, 0xb9, 0xb9, 0xbd, 0xd1, 0x85, 0xd1, 0xa5,
-  0xbd, 0xb9, 0xcd, 0x4d, 0x11, 0xca, 0x42, 0x2d, 0xea, 0x90, 0xe1, 0xb9,
-  0xd8, 0xa5, 0x95, 0xdd, 0x25, 0x91, 0x4d, 0xd1, 0x85, 0xd1, 0x95, 0x4d,
-  0x09, 0xd8, 0xa2, 0x0e, 0x19, 0x9e, 0x4b, 0x99, 0x1b, 0x9d, 0x5c, 0x1e,
-  0xd4, 0x5b, 0x9a, 0x1b, 0xdd, 0xdc, 0x94, 0x60, 0x37, 0xba, 0x90, 0xe1,
-  0xb9, 0x8c, 0xbd, 0xd5, 0xb9, 0xd1, 0x95, 0xc9, 0xcd, 0x4d, 0x09, 0xc8,
-  0x03, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80,
-  0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84,
-  0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c,
-  0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42,
-  0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c,
-  0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79,
-  0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70,
-  0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f,
-  0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4,
-  0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30,
-  0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc,
-  0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b,
-  0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70,
-  0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76,
-  0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72,
-  0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e,
-  0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1,
-  0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21,
-  0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8,
-  0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94,
-  0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc,
-  0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c,
-  0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e,
-  0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e,
-  0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00,
-  0x00, 0x71, 0x20, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x05, 0xd0, 0x07,
-  0x81, 0xdf, 0x9c, 0x1e, 0xa6, 0xa7, 0xc7, 0x4f, 0xb1, 0xba, 0x3c, 0xa6,
-  0x0b, 0xeb, 0x66, 0x73, 0x59, 0x0e, 0x04, 0xce, 0xac, 0x3f, 0xd2, 0x94,
-  0x2e, 0xaf, 0x8f, 0xe9, 0x75, 0x79, 0x99, 0x2c, 0xac, 0x9b, 0xcd, 0x65,
-  0x39, 0xb0, 0x3a, 0xa5, 0x87, 0xe9, 0xe9, 0xf1, 0x53, 0xac, 0x2e, 0x8f,
-  0xe9, 0x40, 0x20, 0x10, 0x18, 0x34, 0x81, 0x49, 0x00, 0x18, 0x22, 0x02,
-  0x36, 0xaa, 0x28, 0x88, 0xe8, 0x5f, 0x08, 0x03, 0x10, 0x30, 0x5b, 0xa0,
-  0x86, 0xcb, 0x77, 0x1e, 0x3f, 0xa0, 0x8a, 0x82, 0x88, 0x4a, 0x07, 0x18,
-  0x7c, 0xe4, 0xb6, 0x0d, 0x61, 0x1b, 0x2e, 0xdf, 0x79, 0x7c, 0x21, 0xa0,
-  0x8a, 0x82, 0x88, 0x4a, 0x07, 0x18, 0x4a, 0xc2, 0x00, 0x04, 0xcc, 0x2f,
-  0x6e, 0xdb, 0x0e, 0xb6, 0xe1, 0xf2, 0x9d, 0xc7, 0x17, 0x02, 0xaa, 0x28,
-  0x88, 0xa8, 0x74, 0x80, 0xa1, 0x24, 0x0c, 0x40, 0xc0, 0x7c, 0xe4, 0xb6,
-  0x4d, 0x41, 0x1a, 0x2e, 0xdf, 0x79, 0x7c, 0x21, 0x22, 0x80, 0x89, 0x08,
-  0x81, 0x66, 0x58, 0x08, 0x23, 0x98, 0x86, 0xcb, 0x77, 0x1e, 0x7f, 0x71,
-  0x80, 0x41, 0x6c, 0x1e, 0x6a, 0xf2, 0x8b, 0xdb, 0xb6, 0x82, 0x6a, 0xb8,
-  0x7c, 0xe7, 0xf1, 0xa5, 0xc9, 0x89, 0x08, 0x94, 0x9a, 0x1e, 0x6a, 0xf2,
-  0x8b, 0xdb, 0x36, 0x83, 0x6a, 0xb8, 0x7c, 0xe7, 0xf1, 0xa5, 0xc9, 0x89,
-  0x08, 0x94, 0x9a, 0x1e, 0x6a, 0xf2, 0x91, 0xdb, 0xb6, 0x04, 0x69, 0xb8,
-  0x7c, 0xe7, 0xf1, 0x27, 0x22, 0x9a, 0x10, 0x20, 0xc2, 0xfc, 0xe2, 0xb6,
-  0x6d, 0x80, 0x60, 0x00, 0xa4, 0xb1, 0x80, 0x26, 0x72, 0x9c, 0x89, 0x73,
-  0x1a, 0x69, 0x02, 0x9a, 0x49, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x41, 0x53, 0x48, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1b, 0x81, 0xca, 0x3e, 0xb4, 0xf1, 0x2b, 0xc5, 0xd3, 0xb1, 0x88,
-  0x45, 0xc1, 0x77, 0xd2, 0xb6, 0x44, 0x58, 0x49, 0x4c, 0x18, 0x0d, 0x00,
-  0x00, 0x60, 0x00, 0x01, 0x00, 0x46, 0x03, 0x00, 0x00, 0x44, 0x58, 0x49,
-  0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00,
-  0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0x3d, 0x03, 0x00,
-  0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
-  0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10, 0x32,
-  0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b,
-  0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xc4, 0x10, 0x32,
-  0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x62, 0x88, 0x48, 0x90, 0x14,
-  0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e,
-  0x90, 0x11, 0x23, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5,
-  0x8a, 0x04, 0x31, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02, 0xa8,
-  0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x6d, 0x30, 0x86,
-  0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49, 0x18, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c, 0x08,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0x6c, 0x00, 0x00,
-  0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64, 0x85, 0x04, 0x13, 0x23, 0xa4,
-  0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8c,
-  0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 0xbc, 0xc1, 0x08, 0x40, 0x09, 0x00,
-  0x0a, 0x66, 0x00, 0xe6, 0x08, 0xc0, 0x60, 0x8e, 0x00, 0x29, 0xc6, 0x40,
-  0x10, 0x44, 0x41, 0x90, 0x51, 0x0c, 0x80, 0x20, 0x88, 0x62, 0x20, 0xa4,
-  0x18, 0x00, 0x41, 0x10, 0x05, 0x41, 0xca, 0x51, 0xc3, 0xe5, 0x4f, 0xd8,
-  0x43, 0x48, 0x3e, 0xb7, 0x51, 0xc5, 0x4a, 0x4c, 0x3e, 0x72, 0xdb, 0x88,
-  0x20, 0x08, 0x82, 0xa0, 0xe2, 0x9e, 0xe1, 0xf2, 0x27, 0xec, 0x21, 0x24,
-  0x3f, 0x04, 0x9a, 0x61, 0x21, 0x50, 0xd0, 0x14, 0x82, 0x21, 0x1c, 0x82,
-  0x9e, 0xa3, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0x7c, 0x6e, 0xa3, 0x8a,
-  0x95, 0x98, 0xfc, 0xe2, 0xb6, 0x11, 0x31, 0x0c, 0xc3, 0x50, 0x88, 0x88,
-  0x70, 0x08, 0x92, 0x4a, 0x31, 0x10, 0xc3, 0x30, 0x10, 0x35, 0x47, 0x10,
-  0x14, 0xc3, 0x21, 0x0a, 0x82, 0xb0, 0xe8, 0xba, 0x69, 0xb8, 0xfc, 0x09,
-  0x7b, 0x08, 0xc9, 0x5f, 0x09, 0x69, 0x25, 0x26, 0x1f, 0xb9, 0x6d, 0x54,
-  0x10, 0x04, 0x41, 0x10, 0xa5, 0xc8, 0x08, 0x87, 0x20, 0x48, 0x1b, 0x08,
-  0x18, 0x46, 0x18, 0x86, 0xab, 0xa4, 0x29, 0xa2, 0x84, 0xc9, 0xdf, 0x1c,
-  0xaa, 0x19, 0x90, 0xc6, 0x60, 0x9f, 0x83, 0x88, 0x08, 0x24, 0x74, 0xc3,
-  0x29, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0x97, 0x68, 0x87, 0x06, 0x82, 0x20,
-  0x72, 0xe0, 0xbb, 0x47, 0x9a, 0x22, 0x4a, 0x98, 0x7c, 0x13, 0x98, 0x88,
-  0x08, 0x01, 0x16, 0x64, 0x10, 0x04, 0x41, 0x10, 0xc4, 0x4d, 0xd2, 0x14,
-  0x51, 0xc2, 0xe4, 0xb3, 0x13, 0x30, 0x21, 0x02, 0x1a, 0x24, 0x84, 0x30,
-  0x21, 0xc2, 0x03, 0x43, 0x62, 0x26, 0x32, 0x18, 0x07, 0x76, 0x08, 0x87,
-  0x79, 0x98, 0x07, 0x37, 0x98, 0x05, 0x7a, 0x90, 0x87, 0x7a, 0x18, 0x07,
-  0x7a, 0xa8, 0x07, 0x79, 0x28, 0x07, 0x72, 0x10, 0x85, 0x7a, 0x30, 0x07,
-  0x73, 0x28, 0x07, 0x79, 0xe0, 0x83, 0x59, 0xa0, 0x87, 0x70, 0xa0, 0x87,
-  0x74, 0x18, 0x87, 0x57, 0x10, 0x07, 0x75, 0x28, 0x87, 0x71, 0xa0, 0x07,
-  0x3f, 0x40, 0x81, 0x48, 0xe3, 0x51, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0xaf,
-  0x8e, 0x33, 0x71, 0x4e, 0x23, 0x4d, 0x40, 0x33, 0x49, 0x28, 0x20, 0xae,
-  0x89, 0x1c, 0x67, 0xe2, 0x9c, 0x46, 0x9a, 0x80, 0x66, 0x92, 0x50, 0x50,
-  0x92, 0x39, 0x8c, 0x40, 0x0c, 0x49, 0x80, 0x5e, 0x18, 0x0c, 0x97, 0x0f,
-  0x2c, 0x88, 0xd1, 0x30, 0x44, 0x33, 0xf9, 0x0b, 0x61, 0x00, 0x02, 0xe6,
-  0x4b, 0x53, 0x44, 0x09, 0x93, 0xcf, 0x01, 0x0c, 0x11, 0x01, 0xc8, 0x49,
-  0xd3, 0x34, 0xed, 0x86, 0x61, 0x18, 0x86, 0x61, 0x18, 0x86, 0x03, 0x83,
-  0xe1, 0xf2, 0x81, 0x05, 0x31, 0x1a, 0x86, 0x68, 0x26, 0x7f, 0x21, 0x0c,
-  0x40, 0xc0, 0x7c, 0x01, 0x60, 0x88, 0x08, 0xd8, 0xa8, 0xa2, 0x20, 0x22,
-  0x14, 0xa8, 0xb4, 0xa6, 0x06, 0x31, 0x47, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68, 0x87,
-  0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0,
-  0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40,
-  0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30,
-  0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76, 0x40,
-  0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a, 0x30,
-  0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x06, 0x10,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x10,
-  0x20, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2,
-  0x28, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-  0xe4, 0x79, 0x80, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0xc8, 0x23, 0x01, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xc0, 0x90, 0x87, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x21, 0xcf, 0x05, 0x04, 0xc0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x43, 0x1e, 0x0d, 0x08, 0x80, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0x40, 0x00, 0x00, 0x1e, 0x00, 0x00,
-  0x00, 0x32, 0x1e, 0x98, 0x18, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26,
-  0x47, 0xc6, 0x04, 0x43, 0x22, 0x4a, 0x60, 0x04, 0xa0, 0x18, 0x0a, 0xa3,
-  0x40, 0x03, 0x0a, 0xa1, 0xc0, 0x09, 0xca, 0xa0, 0x1c, 0xca, 0xa3, 0x08,
-  0x4a, 0xa1, 0x20, 0x4a, 0xa2, 0x28, 0xca, 0x82, 0x8a, 0x92, 0x18, 0x01,
-  0x28, 0x83, 0x42, 0x28, 0x82, 0x52, 0x28, 0x01, 0x72, 0x0b, 0x84, 0xce,
-  0x19, 0x00, 0x62, 0x67, 0x00, 0xa8, 0x1d, 0x4b, 0x63, 0xc6, 0xe0, 0x7f,
-  0x80, 0xff, 0x02, 0xfe, 0x33, 0x00, 0x00, 0x00, 0x04, 0x61, 0x52, 0x00,
-  0x40, 0x10, 0x45, 0x05, 0x00, 0x04, 0x51, 0x92, 0x00, 0x40, 0x10, 0x04,
-  0x21, 0x00, 0x04, 0x49, 0x52, 0x00, 0x40, 0x10, 0x15, 0x05, 0x00, 0x04,
-  0x51, 0x32, 0x00, 0x40, 0x10, 0x04, 0xc1, 0x00, 0x20, 0x72, 0x06, 0x00,
-  0x00, 0x79, 0x18, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c,
-  0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03,
-  0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9, 0x01,
-  0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a,
-  0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b,
-  0xd9, 0x10, 0x04, 0x13, 0x04, 0x22, 0x99, 0x20, 0x10, 0xca, 0x06, 0x61,
-  0x20, 0x26, 0x08, 0xc4, 0xb2, 0x41, 0x18, 0x0c, 0x0a, 0x76, 0x73, 0x1b,
-  0x06, 0xc4, 0x20, 0x26, 0x08, 0x64, 0x40, 0x06, 0x04, 0x26, 0x08, 0x04,
-  0x33, 0x41, 0x20, 0x9a, 0x0d, 0xc2, 0xd0, 0x6c, 0x48, 0x08, 0x65, 0x21,
-  0x88, 0x81, 0x21, 0x9c, 0x0d, 0xc1, 0x33, 0x41, 0x38, 0x83, 0x30, 0x98,
-  0x20, 0x10, 0xce, 0x06, 0x84, 0x88, 0x16, 0x82, 0x18, 0x24, 0x60, 0x82,
-  0xc0, 0x06, 0x62, 0x30, 0x41, 0x20, 0x9e, 0x0d, 0xc8, 0x40, 0x2d, 0xc4,
-  0x30, 0x54, 0xc0, 0x06, 0x61, 0xb2, 0x36, 0x10, 0x10, 0x70, 0x01, 0x13,
-  0x84, 0x36, 0x18, 0x83, 0x0d, 0x41, 0x36, 0x41, 0x10, 0x00, 0x12, 0x6d,
-  0x61, 0x69, 0x6e, 0x44, 0xa0, 0x9e, 0xa6, 0x92, 0xa8, 0x92, 0x9e, 0x9c,
-  0x26, 0x08, 0x45, 0x36, 0x41, 0x28, 0xb4, 0x0d, 0x01, 0x31, 0x41, 0x28,
-  0xb6, 0x09, 0x02, 0x01, 0x4d, 0x10, 0x88, 0x68, 0x83, 0x20, 0x06, 0x63,
-  0xb0, 0x61, 0x21, 0x3a, 0xef, 0x03, 0x83, 0x6f, 0x08, 0x03, 0xe2, 0x23,
-  0x03, 0x1a, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x13, 0x84, 0x82, 0x9b,
-  0x20, 0x10, 0xd2, 0x06, 0x41, 0x0c, 0xd0, 0x60, 0xc3, 0x32, 0x98, 0x81,
-  0xf7, 0x81, 0xc1, 0x37, 0x9c, 0xc1, 0xf0, 0xa5, 0xc1, 0x04, 0x81, 0x98,
-  0x78, 0x50, 0x05, 0x39, 0x1d, 0x15, 0x39, 0x51, 0x6d, 0x58, 0xd6, 0x80,
-  0x0d, 0xbc, 0x0f, 0x0c, 0xbe, 0xe1, 0x0c, 0xd6, 0xe0, 0x4b, 0x83, 0x0d,
-  0x43, 0x19, 0xa8, 0x41, 0x1b, 0x70, 0x99, 0xb2, 0xfa, 0x82, 0x7a, 0x9b,
-  0x4b, 0xa3, 0x4b, 0x7b, 0x73, 0xdb, 0xb0, 0x10, 0x6f, 0xe0, 0x85, 0x01,
-  0x18, 0x9c, 0xc1, 0x70, 0x06, 0xc4, 0x97, 0x06, 0x13, 0x84, 0xa2, 0xdb,
-  0xb0, 0x0c, 0x9d, 0xf7, 0x81, 0x41, 0x1c, 0x0c, 0x67, 0x30, 0x7c, 0x69,
-  0xb0, 0x21, 0x18, 0x36, 0x2c, 0x6b, 0xd0, 0x79, 0xdf, 0x1c, 0xc4, 0xc1,
-  0x10, 0x06, 0x6b, 0xf0, 0x91, 0x01, 0x15, 0x2a, 0x21, 0xa7, 0xaf, 0xa6,
-  0x20, 0x2a, 0xa9, 0x24, 0xac, 0x0d, 0x03, 0x31, 0xac, 0xc1, 0x86, 0x45,
-  0x0c, 0xea, 0xc0, 0xfb, 0xec, 0x20, 0x0e, 0xc4, 0x20, 0x0c, 0xc4, 0xe0,
-  0x23, 0x03, 0x22, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x1b,
-  0x04, 0x31, 0x10, 0x83, 0x0d, 0x8b, 0x84, 0x07, 0xde, 0x07, 0x06, 0x71,
-  0x30, 0xc4, 0x81, 0xf1, 0xe5, 0xc1, 0x04, 0x81, 0xa0, 0x88, 0x34, 0x05,
-  0x51, 0x15, 0x49, 0x25, 0x05, 0x31, 0x4d, 0x10, 0x0a, 0x6f, 0x82, 0x50,
-  0x7c, 0x1b, 0x04, 0x31, 0x18, 0x36, 0x2c, 0x7b, 0xc0, 0x07, 0x7d, 0xf0,
-  0x81, 0x81, 0x1f, 0x0c, 0x7e, 0x30, 0x06, 0xdf, 0x1f, 0x6c, 0x58, 0x0c,
-  0x3e, 0xe8, 0x83, 0x6f, 0x0e, 0xfc, 0x60, 0xf0, 0x83, 0x31, 0xf0, 0x83,
-  0x3f, 0xd8, 0x10, 0xac, 0xc1, 0x86, 0x65, 0x0c, 0xf8, 0xa0, 0x0f, 0x3e,
-  0x51, 0xf0, 0x83, 0xc1, 0x0f, 0xc6, 0x20, 0x0e, 0xfe, 0x60, 0x82, 0x40,
-  0x54, 0x1b, 0x02, 0x31, 0xd8, 0xb0, 0x90, 0x02, 0x1f, 0xf4, 0xc1, 0x57,
-  0x0a, 0x7e, 0x30, 0xf8, 0xc1, 0x18, 0x84, 0xc1, 0x1f, 0x4c, 0x10, 0x08,
-  0x6b, 0x43, 0x20, 0x6d, 0x58, 0x4e, 0x81, 0x0f, 0xfa, 0xe0, 0x43, 0x05,
-  0x3f, 0x18, 0xfc, 0x80, 0x14, 0xbe, 0x3f, 0x98, 0x20, 0x10, 0xd7, 0x86,
-  0x60, 0x0f, 0x36, 0x2c, 0xaa, 0xc0, 0x07, 0x7d, 0xf0, 0xad, 0x82, 0x1f,
-  0x0c, 0x7e, 0x40, 0x0a, 0x7e, 0xf0, 0x07, 0x13, 0x04, 0x02, 0x23, 0xf3,
-  0x24, 0xa4, 0x54, 0x34, 0x44, 0xf5, 0x65, 0xc4, 0x14, 0x74, 0x34, 0xb5,
-  0x61, 0x69, 0x05, 0x57, 0xe8, 0x83, 0x0f, 0x0c, 0xfc, 0x60, 0xf0, 0x03,
-  0x52, 0x88, 0x83, 0x3f, 0xd8, 0xc0, 0xc0, 0x81, 0x1c, 0xd0, 0xc1, 0x1d,
-  0xe8, 0x01, 0x28, 0x84, 0xc2, 0x28, 0x98, 0x42, 0x2a, 0xb0, 0xc2, 0x2b,
-  0x6c, 0x18, 0xdc, 0x00, 0x16, 0x80, 0x09, 0x82, 0x1b, 0x80, 0xc1, 0x06,
-  0x81, 0x90, 0x85, 0x0d, 0xc5, 0xc6, 0xc5, 0x02, 0x36, 0x0b, 0x55, 0xd8,
-  0xd8, 0xec, 0xda, 0x5c, 0xd2, 0xc8, 0xca, 0xdc, 0xe8, 0xa6, 0x04, 0x41,
-  0x15, 0x32, 0x3c, 0x17, 0xbb, 0x32, 0xb9, 0xb9, 0xb4, 0x37, 0xb7, 0x29,
-  0x01, 0xd1, 0x84, 0x0c, 0xcf, 0xc5, 0x2e, 0x8c, 0xcd, 0xae, 0x4c, 0x6e,
-  0x4a, 0x60, 0xd4, 0x21, 0xc3, 0x73, 0x99, 0x43, 0x0b, 0x23, 0x2b, 0x93,
-  0x6b, 0x7a, 0x23, 0x2b, 0x63, 0x9b, 0x12, 0x20, 0x65, 0xc8, 0xf0, 0x5c,
-  0xe4, 0xca, 0xe6, 0xde, 0xea, 0xe4, 0xc6, 0xca, 0xe6, 0xa6, 0x04, 0x57,
-  0x1d, 0x32, 0x3c, 0x17, 0xbb, 0xb4, 0xb2, 0xbb, 0x24, 0xb2, 0x29, 0xba,
-  0x30, 0xba, 0xb2, 0x29, 0x41, 0x56, 0x87, 0x0c, 0xcf, 0xa5, 0xcc, 0x8d,
-  0x4e, 0x2e, 0x0f, 0xea, 0x2d, 0xcd, 0x8d, 0x6e, 0x6e, 0x4a, 0x30, 0x0b,
-  0x00, 0x79, 0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80,
-  0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84,
-  0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c,
-  0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42,
-  0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88,
-  0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c,
-  0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79,
-  0x48, 0x87, 0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70,
-  0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f,
-  0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4,
-  0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30,
-  0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc,
-  0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b,
-  0x68, 0x07, 0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70,
-  0x90, 0x87, 0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76,
-  0x78, 0x87, 0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72,
-  0x98, 0x87, 0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e,
-  0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1,
-  0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21,
-  0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8,
-  0x43, 0x39, 0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94,
-  0x43, 0x38, 0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc,
-  0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c,
-  0x70, 0x03, 0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e,
-  0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e,
-  0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00,
-  0x00, 0x71, 0x20, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x86, 0x40, 0x0d,
-  0x97, 0xef, 0x3c, 0x7e, 0x40, 0x15, 0x05, 0x11, 0x95, 0x0e, 0x30, 0xf8,
-  0xc8, 0x6d, 0x5b, 0xc1, 0x36, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x40, 0x15,
-  0x05, 0x11, 0x95, 0x0e, 0x30, 0x94, 0x84, 0x01, 0x08, 0x98, 0x5f, 0xdc,
-  0xb6, 0x11, 0x6c, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x04, 0x54, 0x51, 0x10,
-  0x51, 0xe9, 0x00, 0x43, 0x49, 0x18, 0x80, 0x80, 0xf9, 0xc8, 0x6d, 0xdb,
-  0x81, 0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x42, 0x44, 0x00, 0x13, 0x11, 0x02,
-  0xcd, 0xb0, 0x10, 0x16, 0x30, 0x0d, 0x97, 0xef, 0x3c, 0xfe, 0xe2, 0x00,
-  0x83, 0xd8, 0x3c, 0xd4, 0xe4, 0x17, 0xb7, 0x6d, 0x02, 0xd5, 0x70, 0xf9,
-  0xce, 0xe3, 0x4b, 0x93, 0x13, 0x11, 0x28, 0x35, 0x3d, 0xd4, 0xe4, 0x17,
-  0xb7, 0x6d, 0x03, 0xd5, 0x70, 0xf9, 0xce, 0xe3, 0x4b, 0x93, 0x13, 0x11,
-  0x28, 0x35, 0x3d, 0xd4, 0xe4, 0x23, 0xb7, 0x6d, 0x06, 0xd2, 0x70, 0xf9,
-  0xce, 0xe3, 0x4f, 0x44, 0x34, 0x21, 0x40, 0x84, 0xf9, 0xc5, 0x6d, 0x1b,
-  0x00, 0xc1, 0x00, 0x48, 0x03, 0x61, 0x20, 0x00, 0x00, 0x1a, 0x01, 0x00,
-  0x00, 0x13, 0x04, 0x41, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x44, 0xcc, 0x00, 0x14, 0x62, 0x40, 0x71, 0x95, 0x5d, 0xc9, 0x15,
-  0x5a, 0xc1, 0x15, 0x5e, 0x01, 0x06, 0x14, 0x64, 0x40, 0x61, 0x06, 0x94,
-  0x46, 0x71, 0x90, 0x35, 0x02, 0x00, 0x00, 0x00, 0x00, 0x23, 0x06, 0x09,
-  0x00, 0x82, 0x60, 0x70, 0xb1, 0x81, 0x92, 0xa5, 0x41, 0x1a, 0x04, 0x23,
-  0x06, 0x09, 0x00, 0x82, 0x60, 0x70, 0xb5, 0xc1, 0x72, 0xad, 0xc1, 0x1a,
-  0x08, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x70, 0xb9, 0x01, 0x83, 0xad,
-  0xc1, 0x1a, 0x0c, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xd4, 0x01,
-  0x1a, 0x8c, 0x01, 0x1b, 0x70, 0xd1, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18,
-  0x18, 0x76, 0x90, 0x06, 0x64, 0xd0, 0x06, 0x98, 0x34, 0x62, 0x90, 0x00,
-  0x20, 0x08, 0x06, 0xc6, 0x1d, 0xa8, 0x41, 0x19, 0xb8, 0xc1, 0x36, 0x8d,
-  0x18, 0x24, 0x00, 0x08, 0x82, 0x81, 0x81, 0x07, 0x6b, 0x60, 0x06, 0x6f,
-  0xe0, 0x51, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xe4, 0x01, 0x1b,
-  0xc4, 0x01, 0x1c, 0x80, 0x41, 0x35, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06,
-  0x86, 0x1e, 0xb4, 0x81, 0x1c, 0xc4, 0x01, 0x67, 0x8d, 0x18, 0x24, 0x00,
-  0x08, 0x82, 0x81, 0xb1, 0x07, 0x6e, 0x30, 0x07, 0x72, 0xf0, 0x5d, 0x23,
-  0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xf0, 0xc1, 0x1b, 0xd0, 0xc1, 0x1c,
-  0x88, 0x01, 0x36, 0x62, 0x90, 0x00, 0x20, 0x08, 0x06, 0x46, 0x1f, 0xc0,
-  0x01, 0x1d, 0xd0, 0x01, 0x19, 0x64, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60,
-  0x60, 0xf8, 0x41, 0x1c, 0xd4, 0x41, 0x1d, 0x80, 0x81, 0x36, 0x62, 0x90,
-  0x00, 0x20, 0x08, 0x06, 0xc6, 0x1f, 0xc8, 0x81, 0x1d, 0xd8, 0xc1, 0x18,
-  0x6c, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0xf0, 0xf4, 0x41, 0xc6, 0xdc,
-  0xc1, 0x68, 0x42, 0x00, 0x8c, 0x18, 0x20, 0x00, 0x08, 0x82, 0x81, 0xb6,
-  0x07, 0x1d, 0x14, 0x64, 0xa3, 0x09, 0x01, 0x30, 0x62, 0x80, 0x00, 0x20,
-  0x08, 0x06, 0x5a, 0x1f, 0x7c, 0xd2, 0xa0, 0x8d, 0x26, 0x04, 0xc0, 0x88,
-  0x01, 0x02, 0x80, 0x20, 0x18, 0x68, 0x7f, 0x10, 0x06, 0x54, 0xb1, 0x8d,
-  0x26, 0x04, 0xc0, 0x88, 0x01, 0x02, 0x80, 0x20, 0x18, 0x68, 0xa1, 0x30,
-  0x06, 0xd6, 0xc1, 0x8d, 0x26, 0x04, 0xc0, 0x88, 0x01, 0x02, 0x80, 0x20,
-  0x18, 0x68, 0xa3, 0x50, 0x06, 0x58, 0x52, 0x06, 0xa3, 0x09, 0x01, 0x30,
-  0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x5a, 0x29, 0x9c, 0x81, 0xb6, 0x7c,
-  0xa3, 0x09, 0x01, 0x30, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0xda, 0x29,
-  0xa4, 0x01, 0xd7, 0x80, 0xc1, 0x68, 0x42, 0x00, 0x8c, 0x18, 0x1c, 0x00,
-  0x08, 0x82, 0x81, 0xc4, 0x0a, 0x69, 0xd0, 0x95, 0xc2, 0x68, 0x42, 0x00,
-  0x8c, 0x26, 0x08, 0xc1, 0x68, 0xc2, 0x20, 0x8c, 0x26, 0x10, 0xc3, 0x88,
-  0xc1, 0x01, 0x80, 0x20, 0x18, 0x48, 0xb1, 0xe0, 0x06, 0x62, 0x60, 0x06,
-  0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83, 0x30, 0x9a,
-  0x40, 0x0c, 0x23, 0x06, 0x07, 0x00, 0x82, 0x60, 0x20, 0xd9, 0xc2, 0x1c,
-  0x9c, 0x81, 0x1a, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26,
-  0x0c, 0xc2, 0x68, 0x02, 0x31, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0x81,
-  0xb4, 0x0b, 0x78, 0xc0, 0x06, 0xae, 0x30, 0x9a, 0x10, 0x00, 0xa3, 0x09,
-  0x42, 0x30, 0x9a, 0x30, 0x08, 0xa3, 0x09, 0xc4, 0x60, 0xd3, 0x19, 0xc8,
-  0x67, 0xc4, 0x00, 0x01, 0x40, 0x10, 0x0c, 0x28, 0x70, 0xf8, 0x83, 0xe7,
-  0x0c, 0x82, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xa0, 0xc2, 0x01, 0x14,
-  0x96, 0x33, 0x08, 0x2c, 0x38, 0xa0, 0x63, 0xd6, 0x1a, 0xc8, 0x67, 0xc4,
-  0x00, 0x01, 0x40, 0x10, 0x0c, 0x28, 0x72, 0x18, 0x05, 0x69, 0x0d, 0x82,
-  0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0xa0, 0xca, 0x81, 0x14, 0x9c, 0x35,
-  0x08, 0x2c, 0x50, 0xa0, 0x63, 0xd9, 0x1b, 0xc8, 0x67, 0xc4, 0x00, 0x01,
-  0x40, 0x10, 0x0c, 0x28, 0x74, 0x38, 0x85, 0xea, 0x0d, 0x82, 0x11, 0x03,
-  0x04, 0x00, 0x41, 0x30, 0xa0, 0xd2, 0x01, 0x15, 0xa2, 0x37, 0x08, 0x2c,
-  0x68, 0xa0, 0x63, 0xdc, 0x1c, 0xc8, 0x67, 0xc4, 0x00, 0x01, 0x40, 0x10,
-  0x0c, 0x28, 0x76, 0x58, 0x05, 0x6c, 0x0e, 0x82, 0x11, 0x03, 0x04, 0x00,
-  0x41, 0x30, 0xa0, 0xda, 0x81, 0x15, 0xa8, 0x39, 0x08, 0x2c, 0x80, 0xa0,
-  0x63, 0x7a, 0xd0, 0x07, 0xf2, 0x31, 0x3d, 0xf8, 0x03, 0xf9, 0x98, 0x10,
-  0xc4, 0xc7, 0xf8, 0x40, 0x14, 0xe4, 0x63, 0x7f, 0x10, 0x0a, 0xf2, 0x31,
-  0x21, 0x88, 0x8f, 0x85, 0x02, 0x29, 0xc8, 0xc7, 0x42, 0xc1, 0x14, 0xe4,
-  0x63, 0x42, 0x10, 0x9f, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0xf8,
-  0x41, 0x1d, 0xe8, 0x81, 0x1e, 0xc8, 0xc1, 0x1a, 0x31, 0x48, 0x00, 0x10,
-  0x04, 0x03, 0x84, 0x1f, 0xd4, 0x81, 0x1e, 0xe8, 0xe1, 0x17, 0xa4, 0x11,
-  0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0xf8, 0x41, 0x1d, 0xe8, 0x81, 0x1e,
-  0xc2, 0xc1, 0x19, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03, 0x84, 0x1f, 0xd4,
-  0x81, 0x1e, 0xe8, 0x61, 0x1c, 0x94, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30,
-  0x40, 0xf8, 0x41, 0x1d, 0xea, 0x81, 0x1e, 0xc8, 0xc1, 0x1a, 0x31, 0x48,
-  0x00, 0x10, 0x04, 0x03, 0x84, 0x1f, 0xd4, 0xa1, 0x1e, 0xe8, 0xe1, 0x17,
-  0xa4, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0xf8, 0x41, 0x1d, 0xea,
-  0x81, 0x1e, 0xc2, 0xc1, 0x19, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03, 0x84,
-  0x1f, 0xd4, 0xa1, 0x1e, 0xe8, 0x61, 0x1c, 0x94, 0x11, 0x83, 0x04, 0x00,
-  0x41, 0x30, 0x40, 0xf8, 0x41, 0x1d, 0xd6, 0x81, 0x1e, 0xc8, 0x01, 0x14,
-  0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0xe1, 0x07, 0x75, 0x58, 0x07,
-  0x7a, 0xf8, 0x85, 0x3f, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03, 0x84,
-  0x1f, 0xd4, 0x61, 0x1d, 0xe8, 0x21, 0x1c, 0xfc, 0x60, 0xc4, 0x20, 0x01,
-  0x40, 0x10, 0x0c, 0x10, 0x7e, 0x50, 0x07, 0x78, 0xa0, 0x07, 0x72, 0x08,
-  0x85, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0xf8, 0x41, 0x1d, 0xe0,
-  0x81, 0x1e, 0x7e, 0xa1, 0x14, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x40,
-  0xd9, 0x07, 0x75, 0x50, 0x07, 0x7a, 0x20, 0x07, 0x3d, 0x18, 0x31, 0x48,
-  0x00, 0x10, 0x04, 0x03, 0x65, 0x1f, 0xd4, 0x61, 0x1e, 0xe8, 0x81, 0x1c,
-  0xf0, 0x60, 0xc4, 0x20, 0x01, 0x40, 0x10, 0x0c, 0x94, 0x7d, 0x50, 0x87,
-  0x76, 0xa0, 0x07, 0x72, 0xb0, 0x83, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30,
-  0x50, 0xf6, 0x41, 0x1d, 0xd2, 0x81, 0x1e, 0xc8, 0x81, 0x0e, 0x46, 0x0c,
-  0x12, 0x00, 0x04, 0xc1, 0x40, 0xd9, 0x07, 0x75, 0x40, 0x07, 0x7a, 0x20,
-  0x07, 0x39, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03, 0x65, 0x1f, 0xd4,
-  0xe1, 0x1c, 0xe8, 0x81, 0x1c, 0xe0, 0x60, 0xc4, 0x20, 0x01, 0x40, 0x10,
-  0x0c, 0x94, 0x7d, 0x50, 0x07, 0x73, 0xa0, 0x07, 0x72, 0x70, 0x83, 0x11,
-  0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0xf8, 0x41, 0x1d, 0xdc, 0x81, 0x1e,
-  0xc8, 0x01, 0x15, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0xe1, 0x07,
-  0x75, 0x70, 0x07, 0x7a, 0xf8, 0x85, 0x63, 0xc4, 0x20, 0x01, 0x40, 0x10,
-  0x0c, 0x10, 0x7e, 0x50, 0x07, 0x77, 0xa0, 0x87, 0x70, 0x20, 0x85, 0x11,
-  0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0xf8, 0x41, 0x1d, 0xdc, 0xa1, 0x1e,
-  0xc8, 0xe1, 0x14, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0xe1, 0x07,
-  0x75, 0x70, 0x87, 0x7a, 0xf8, 0x05, 0x62, 0xc4, 0x20, 0x01, 0x40, 0x10,
-  0x0c, 0x10, 0x7e, 0x50, 0x07, 0x77, 0xa8, 0x87, 0x70, 0x18, 0x85, 0x11,
-  0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0xf8, 0x41, 0x1d, 0xdc, 0x61, 0x1d,
-  0xc8, 0xc1, 0x14, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0xe1, 0x07,
-  0x75, 0x70, 0x87, 0x75, 0xf8, 0x85, 0x60, 0xc4, 0x20, 0x01, 0x40, 0x10,
-  0x0c, 0x10, 0x7e, 0x50, 0x07, 0x77, 0x58, 0x87, 0x70, 0x10, 0x05, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00
-};
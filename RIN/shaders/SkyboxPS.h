@@ -1,524 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float       
-; TEXCOORD                 0   xyz         1     NONE   float   xyz 
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Target                0   xyzw        0   TARGET   float   xyzw
-;
-; shader hash: 916c1982d3ad7261461559e5e643399a
-;
-; Pipeline Runtime Information: 
-;
-; Pixel Shader
-; DepthOutput=0
-; SampleFrequency=0
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; TEXCOORD                 0                 linear       
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Target                0                              
-;
-; Buffer Definitions:
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; skyboxSampler                     sampler      NA          NA      S0             s0     1
-; skybox                            texture     f32        cube      T0             t0     1
-;
-;
-; ViewId state:
-;
-; Number of inputs: 7, outputs: 4
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 4, 5, 6 }
-;   output 1 depends on inputs: { 4, 5, 6 }
-;   output 2 depends on inputs: { 4, 5, 6 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.ResRet.f32 = type { float, float, float, float, i32 }
-%"class.TextureCube<vector<float, 3> >" = type { <3 x float> }
-%struct.SamplerState = type { i32 }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 0, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 3, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %3 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %4 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %5 = call float @dx.op.loadInput.f32(i32 4, i32 1, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %6 = call %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32 62, %dx.types.Handle %1, %dx.types.Handle %2, float %3, float %4, float %5, float undef, i32 undef, i32 undef, i32 undef, float 0.000000e+00)  ; SampleLevel(srv,sampler,coord0,coord1,coord2,coord3,offset0,offset1,offset2,LOD)
-  %7 = extractvalue %dx.types.ResRet.f32 %6, 0
-  %8 = extractvalue %dx.types.ResRet.f32 %6, 1
-  %9 = extractvalue %dx.types.ResRet.f32 %6, 2
-  %10 = fmul fast float %7, 0x3FE3333340000000
-  %11 = fmul fast float %8, 0x3FE3333340000000
-  %12 = fmul fast float %9, 0x3FE3333340000000
-  %13 = fmul fast float %7, 0x3FF8189380000000
-  %14 = fmul fast float %8, 0x3FF8189380000000
-  %15 = fmul fast float %9, 0x3FF8189380000000
-  %16 = fadd fast float %13, 0x3F9EB851E0000000
-  %17 = fadd fast float %14, 0x3F9EB851E0000000
-  %18 = fadd fast float %15, 0x3F9EB851E0000000
-  %19 = fmul fast float %16, %10
-  %20 = fmul fast float %17, %11
-  %21 = fmul fast float %18, %12
-  %22 = fmul fast float %7, 0x3FF753F7E0000000
-  %23 = fmul fast float %8, 0x3FF753F7E0000000
-  %24 = fmul fast float %9, 0x3FF753F7E0000000
-  %25 = fadd fast float %22, 0x3FE2E147A0000000
-  %26 = fadd fast float %23, 0x3FE2E147A0000000
-  %27 = fadd fast float %24, 0x3FE2E147A0000000
-  %28 = fmul fast float %25, %10
-  %29 = fmul fast float %26, %11
-  %30 = fmul fast float %27, %12
-  %31 = fadd fast float %28, 0x3FC1EB8520000000
-  %32 = fadd fast float %29, 0x3FC1EB8520000000
-  %33 = fadd fast float %30, 0x3FC1EB8520000000
-  %34 = fdiv fast float %19, %31
-  %35 = fdiv fast float %20, %32
-  %36 = fdiv fast float %21, %33
-  %37 = call float @dx.op.unary.f32(i32 7, float %34)  ; Saturate(value)
-  %38 = call float @dx.op.unary.f32(i32 7, float %35)  ; Saturate(value)
-  %39 = call float @dx.op.unary.f32(i32 7, float %36)  ; Saturate(value)
-  %40 = call float @dx.op.unary.f32(i32 23, float %37)  ; Log(value)
-  %41 = call float @dx.op.unary.f32(i32 23, float %38)  ; Log(value)
-  %42 = call float @dx.op.unary.f32(i32 23, float %39)  ; Log(value)
-  %43 = fmul fast float %40, 0x3FDD168720000000
-  %44 = fmul fast float %41, 0x3FDD168720000000
-  %45 = fmul fast float %42, 0x3FDD168720000000
-  %46 = call float @dx.op.unary.f32(i32 21, float %43)  ; Exp(value)
-  %47 = call float @dx.op.unary.f32(i32 21, float %44)  ; Exp(value)
-  %48 = call float @dx.op.unary.f32(i32 21, float %45)  ; Exp(value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %46)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %47)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %48)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float 1.000000e+00)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.loadInput.f32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.ResRet.f32 @dx.op.sampleLevel.f32(i32, %dx.types.Handle, %dx.types.Handle, float, float, float, float, i32, i32, i32, float) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.unary.f32(i32, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!10}
-!dx.entryPoints = !{!11}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"ps", i32 6, i32 0}
-!4 = !{!5, null, null, !8}
-!5 = !{!6}
-!6 = !{i32 0, %"class.TextureCube<vector<float, 3> >"* undef, !"", i32 0, i32 0, i32 1, i32 5, i32 0, !7}
-!7 = !{i32 0, i32 9}
-!8 = !{!9}
-!9 = !{i32 0, %struct.SamplerState* undef, !"", i32 0, i32 0, i32 1, i32 0, null}
-!10 = !{[9 x i32] [i32 7, i32 4, i32 0, i32 0, i32 0, i32 0, i32 7, i32 7, i32 7]}
-!11 = !{void ()* @main, !"main", !12, !4, null}
-!12 = !{!13, !18, null}
-!13 = !{!14, !16}
-!14 = !{i32 0, !"SV_Position", i8 9, i8 3, !15, i8 4, i32 1, i8 4, i32 0, i8 0, null}
-!15 = !{i32 0}
-!16 = !{i32 1, !"TEXCOORD", i8 9, i8 0, !15, i8 2, i32 1, i8 3, i32 1, i8 0, !17}
-!17 = !{i32 3, i32 7}
-!18 = !{!19}
-!19 = !{i32 0, !"SV_Target", i8 9, i8 16, !15, i8 0, i32 1, i8 4, i32 0, i8 0, !20}
-!20 = !{i32 3, i32 15}
-
-#endif
-
-const unsigned char RINShaderBytesSkyboxPS[] = {
-  0x44, 0x58, 0x42, 0x43, 0x61, 0x0d, 0x1c, 0x97, 0x7d, 0x0e, 0xae, 0x43,
-  0xb9, 0x2e, 0x0b, 0x42, 0x4b, 0x9b, 0x35, 0xb1, 0x01, 0x00, 0x00, 0x00,
-  0x5b, 0x10, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
-  0xaf, 0x01, 0x00, 0x00, 0xa3, 0x08, 0x00, 0x00, 0xbf, 0x08, 0x00, 0x00,
-  0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31, 0x5d, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x53, 0x56, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00,
-  0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x4f, 0x53, 0x47,
-  0x31, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x56, 0x5f,
-  0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x00, 0x50, 0x53, 0x56, 0x30, 0xbc,
-  0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x01, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-  0x00, 0x00, 0x00, 0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x44, 0x03, 0x03, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x43, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x44, 0x10, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
-  0x54, 0x41, 0x54, 0xec, 0x06, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xbb,
-  0x01, 0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0xd4, 0x06, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21,
-  0x0c, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41,
-  0xc8, 0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25,
-  0x05, 0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x14, 0x45, 0x02, 0x42,
-  0x92, 0x0b, 0x42, 0xa4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a,
-  0x32, 0x52, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00,
-  0x19, 0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x91, 0x22, 0xc4, 0x50, 0x41,
-  0x51, 0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x29, 0x46, 0x06, 0x51,
-  0x18, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff,
-  0xff, 0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00,
-  0x09, 0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13,
-  0x82, 0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89,
-  0x20, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x32, 0x22, 0x48, 0x09, 0x20,
-  0x64, 0x85, 0x04, 0x93, 0x22, 0xa4, 0x84, 0x04, 0x93, 0x22, 0xe3, 0x84,
-  0xa1, 0x90, 0x14, 0x12, 0x4c, 0x8a, 0x8c, 0x0b, 0x84, 0xa4, 0x4c, 0x10,
-  0x6c, 0x33, 0x00, 0xc3, 0x08, 0x03, 0x30, 0x13, 0x19, 0x8c, 0x03, 0x3b,
-  0x84, 0xc3, 0x3c, 0xcc, 0x83, 0x1b, 0xd0, 0x42, 0x39, 0xe0, 0x03, 0x3d,
-  0xd4, 0x83, 0x3c, 0x94, 0xc3, 0x28, 0xd4, 0x83, 0x38, 0x94, 0x03, 0x1f,
-  0xd8, 0x43, 0x39, 0x8c, 0x03, 0x3d, 0xbc, 0x83, 0x3c, 0xf0, 0x81, 0x39,
-  0xb0, 0xc3, 0x3b, 0x84, 0x03, 0x3d, 0xb0, 0x01, 0x18, 0xcc, 0x81, 0x1f,
-  0x80, 0x81, 0x1f, 0xa0, 0x20, 0x90, 0x98, 0x23, 0x00, 0x83, 0x9b, 0xa4,
-  0x29, 0xa2, 0x84, 0xc9, 0x67, 0x01, 0xe6, 0x59, 0x88, 0x88, 0x9d, 0x80,
-  0x89, 0x40, 0x01, 0xa1, 0x32, 0x02, 0x50, 0x82, 0x43, 0x68, 0x8e, 0x00,
-  0x29, 0x06, 0x20, 0x84, 0x28, 0x42, 0xab, 0x18, 0x87, 0x10, 0xa2, 0x00,
-  0xb5, 0x9b, 0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc, 0x95, 0x90, 0x56,
-  0x62, 0xf2, 0x8b, 0xdb, 0x46, 0x05, 0x00, 0x00, 0x10, 0x52, 0xf7, 0x0c,
-  0x97, 0x3f, 0x61, 0x0f, 0x21, 0xf9, 0x21, 0xd0, 0x0c, 0x0b, 0x81, 0x02,
-  0x58, 0x98, 0x47, 0x62, 0x04, 0x00, 0x00, 0x42, 0x08, 0x20, 0x59, 0x06,
-  0x40, 0x00, 0xd1, 0x39, 0x82, 0xa0, 0x18, 0x91, 0x28, 0x42, 0x2c, 0xdd,
-  0x81, 0x80, 0x4c, 0x20, 0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87,
-  0x74, 0x60, 0x87, 0x36, 0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87,
-  0x0d, 0xaf, 0x50, 0x0e, 0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00,
-  0x0f, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90,
-  0x0e, 0x71, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0,
-  0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30,
-  0x07, 0x72, 0xd0, 0x06, 0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20,
-  0x07, 0x6d, 0x90, 0x0e, 0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0,
-  0x06, 0xe6, 0x10, 0x07, 0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60,
-  0x0e, 0x73, 0x20, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60,
-  0x07, 0x74, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0,
-  0x07, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40,
-  0x07, 0x3a, 0x0f, 0x64, 0x90, 0x21, 0x23, 0x45, 0x44, 0x00, 0x6a, 0x00,
-  0xc0, 0xec, 0x00, 0x80, 0x87, 0x3c, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79, 0x16, 0x20, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf2, 0x34, 0x40, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xe4, 0x91, 0x80, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xc8, 0x43, 0x01,
-  0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x90, 0xe7,
-  0x02, 0x02, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2c,
-  0x10, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x32, 0x1e, 0x98, 0x14, 0x19,
-  0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04, 0x43, 0x52, 0x05,
-  0x52, 0x04, 0x23, 0x00, 0x44, 0x4a, 0x60, 0x04, 0xa0, 0x18, 0x4a, 0xa1,
-  0x24, 0x0a, 0xa3, 0x0c, 0xca, 0xa1, 0x3c, 0xca, 0xa9, 0xd4, 0x0a, 0x81,
-  0x54, 0x21, 0x94, 0x44, 0x19, 0x90, 0x99, 0x01, 0xa0, 0x31, 0x03, 0x40,
-  0x62, 0x06, 0x80, 0xc2, 0x0c, 0x00, 0xe9, 0xb1, 0x92, 0x83, 0x00, 0x00,
-  0x00, 0x38, 0x8e, 0x03, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x8e,
-  0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35,
-  0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b,
-  0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b,
-  0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79,
-  0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04, 0x62,
-  0x99, 0x20, 0x10, 0xcc, 0x06, 0x61, 0x20, 0x36, 0x08, 0x04, 0x41, 0x01,
-  0x6e, 0x6e, 0x82, 0x40, 0x34, 0x1b, 0x86, 0x03, 0x21, 0x26, 0x08, 0xc3,
-  0x46, 0x63, 0x6e, 0x2d, 0x4f, 0xec, 0x0d, 0x6f, 0x82, 0x40, 0x38, 0x13,
-  0x04, 0xe2, 0xd9, 0x20, 0x10, 0xcd, 0x86, 0x84, 0x50, 0x16, 0x82, 0x18,
-  0x18, 0xc2, 0xd9, 0x10, 0x3c, 0x13, 0x04, 0x43, 0x63, 0x33, 0xb7, 0x96,
-  0x27, 0xf6, 0x86, 0x37, 0x15, 0xd6, 0x06, 0xc7, 0x56, 0x26, 0xb7, 0x01,
-  0x21, 0x22, 0x89, 0x20, 0x06, 0x02, 0xd8, 0x10, 0x4c, 0x1b, 0x08, 0x08,
-  0x00, 0xa8, 0x09, 0x82, 0xc0, 0x4d, 0x10, 0x08, 0x88, 0x01, 0xda, 0x04,
-  0x81, 0x88, 0x26, 0x08, 0x84, 0xb4, 0xc1, 0x40, 0xb0, 0x8c, 0xd0, 0x9a,
-  0x09, 0x42, 0xd0, 0x6d, 0x10, 0x08, 0x6e, 0x43, 0xd0, 0x6d, 0x10, 0x08,
-  0x6f, 0xc3, 0x70, 0x6d, 0xdf, 0x86, 0x81, 0xb0, 0xc0, 0x60, 0x82, 0x90,
-  0x08, 0x1b, 0x80, 0x0d, 0x03, 0x31, 0x06, 0x63, 0xb0, 0x21, 0x20, 0x83,
-  0x0d, 0xc3, 0x20, 0x06, 0x65, 0x30, 0x41, 0xd0, 0xbc, 0x0d, 0xc1, 0x19,
-  0x90, 0x68, 0x0b, 0x4b, 0x73, 0xe3, 0x32, 0x65, 0xf5, 0x05, 0xf5, 0x36,
-  0x97, 0x46, 0x97, 0xf6, 0xe6, 0x36, 0x41, 0x50, 0xb0, 0x09, 0x82, 0x92,
-  0x6d, 0x08, 0x88, 0x09, 0x82, 0x72, 0x4d, 0x10, 0x14, 0x65, 0xc3, 0x42,
-  0xa8, 0xc1, 0x1a, 0xb0, 0x41, 0x1b, 0xb8, 0xc1, 0xe0, 0x06, 0xc4, 0x1b,
-  0x00, 0x44, 0xa8, 0x8a, 0xb0, 0x86, 0x9e, 0x9e, 0xa4, 0x88, 0x26, 0x08,
-  0x4a, 0xb2, 0x41, 0xc8, 0xb4, 0x0d, 0xcb, 0x10, 0x07, 0x6b, 0xf0, 0x06,
-  0x6d, 0x20, 0x07, 0x03, 0x1b, 0x0c, 0x6f, 0x30, 0x07, 0x1b, 0x04, 0x38,
-  0xa0, 0x03, 0x26, 0x53, 0x56, 0x5f, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74,
-  0x13, 0x04, 0x05, 0x99, 0x20, 0x10, 0xd3, 0x06, 0x21, 0xc3, 0x83, 0x0d,
-  0x0b, 0x61, 0x07, 0x6b, 0x70, 0x07, 0x6d, 0xf0, 0x06, 0x83, 0x1b, 0x10,
-  0x6f, 0x90, 0x07, 0x1b, 0x02, 0x3d, 0xd8, 0x30, 0xd4, 0xc1, 0x1e, 0x00,
-  0x1b, 0x0a, 0x31, 0x48, 0x03, 0x3e, 0xa8, 0x00, 0x1a, 0x66, 0x6c, 0x6f,
-  0x61, 0x74, 0x73, 0x13, 0x04, 0x82, 0x62, 0x91, 0xe6, 0x36, 0x47, 0x37,
-  0x37, 0x41, 0x20, 0x2a, 0x1a, 0x73, 0x69, 0x67, 0x5f, 0x6c, 0x64, 0x34,
-  0xe6, 0xd2, 0xce, 0xbe, 0xe6, 0xe8, 0x26, 0x08, 0x84, 0x45, 0x84, 0xae,
-  0x0c, 0xef, 0xcb, 0xed, 0x4d, 0xae, 0x6d, 0x83, 0xe2, 0x07, 0x7f, 0x00,
-  0x0a, 0xa1, 0x20, 0x0a, 0xd9, 0x28, 0x90, 0x42, 0x29, 0x0c, 0x55, 0xd8,
-  0xd8, 0xec, 0xda, 0x5c, 0xd2, 0xc8, 0xca, 0xdc, 0xe8, 0xa6, 0x04, 0x41,
-  0x15, 0x32, 0x3c, 0x17, 0xbb, 0x32, 0xb9, 0xb9, 0xb4, 0x37, 0xb7, 0x29,
-  0x01, 0xd1, 0x84, 0x0c, 0xcf, 0xc5, 0x2e, 0x8c, 0xcd, 0xae, 0x4c, 0x6e,
-  0x4a, 0x50, 0xd4, 0x21, 0xc3, 0x73, 0x99, 0x43, 0x0b, 0x23, 0x2b, 0x93,
-  0x6b, 0x7a, 0x23, 0x2b, 0x63, 0x9b, 0x12, 0x20, 0x65, 0xc8, 0xf0, 0x5c,
-  0xe4, 0xca, 0xe6, 0xde, 0xea, 0xe4, 0xc6, 0xca, 0xe6, 0xa6, 0x04, 0x54,
-  0x25, 0x32, 0x3c, 0x17, 0xba, 0x3c, 0xb8, 0xb2, 0x20, 0x37, 0xb7, 0x37,
-  0xba, 0x30, 0xba, 0xb4, 0x37, 0xb7, 0xb9, 0x29, 0x02, 0x18, 0x94, 0x41,
-  0x1d, 0x32, 0x3c, 0x17, 0xbb, 0xb4, 0xb2, 0xbb, 0x24, 0xb2, 0x29, 0xba,
-  0x30, 0xba, 0xb2, 0x29, 0xc1, 0x19, 0xd4, 0x21, 0xc3, 0x73, 0x29, 0x73,
-  0xa3, 0x93, 0xcb, 0x83, 0x7a, 0x4b, 0x73, 0xa3, 0x9b, 0x9b, 0x12, 0xf0,
-  0x41, 0x17, 0x32, 0x3c, 0x97, 0xb1, 0xb7, 0x3a, 0x37, 0xba, 0x32, 0xb9,
-  0xb9, 0x29, 0x41, 0x29, 0x00, 0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x4c,
-  0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1, 0x1c, 0x66, 0x14,
-  0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42, 0x80, 0x07, 0x79,
-  0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f, 0xed, 0x10, 0x0e,
-  0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1, 0x1d, 0xce, 0xa1,
-  0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84, 0x83, 0x1b, 0xcc,
-  0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc, 0x78, 0x8c, 0x74,
-  0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70, 0x70, 0x07, 0x7a,
-  0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19, 0xcc, 0x11, 0x0e,
-  0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f, 0xe3, 0xf0, 0x0e,
-  0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21, 0x1c, 0xd8, 0x21,
-  0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc, 0x83, 0x3b, 0xd0,
-  0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84, 0x03, 0x3b, 0xcc,
-  0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37, 0x68, 0x87, 0x72,
-  0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70, 0x60, 0x07, 0x76,
-  0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77, 0x80, 0x87, 0x5f,
-  0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79, 0x98, 0x81, 0x2c,
-  0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e, 0xec, 0x30, 0x03,
-  0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1, 0x1c, 0xe4, 0xa1,
-  0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81, 0x1d, 0xca, 0x61,
-  0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98, 0x43, 0x39, 0xc8,
-  0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88, 0x03, 0x3b, 0x94,
-  0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4, 0x03, 0x3b, 0xb0,
-  0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a, 0x28, 0x87, 0x76,
-  0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06, 0xe4, 0x20, 0x0e,
-  0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e, 0xe1, 0x90, 0x0f,
-  0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71, 0x20, 0x00, 0x00, 0x29,
-  0x00, 0x00, 0x00, 0x05, 0xd0, 0x06, 0x81, 0xdf, 0x7c, 0x9d, 0x17, 0xbf,
-  0xf1, 0x40, 0xe0, 0xcc, 0xfa, 0x23, 0x51, 0xcb, 0x78, 0x7a, 0x5d, 0x5e,
-  0x1e, 0xd6, 0xc5, 0x65, 0xa0, 0xf5, 0x47, 0xb2, 0x97, 0xc7, 0xf4, 0xb7,
-  0x1c, 0xd8, 0x24, 0xc1, 0x64, 0x40, 0x20, 0x10, 0x18, 0xac, 0x00, 0x31,
-  0x08, 0xfc, 0xe6, 0xeb, 0xbc, 0xf8, 0x8d, 0x9f, 0x86, 0xdb, 0x70, 0x76,
-  0x59, 0x0e, 0x04, 0xce, 0xaa, 0xd3, 0x70, 0x1b, 0xce, 0x2e, 0xcb, 0xa7,
-  0xf4, 0x30, 0xbd, 0x0c, 0x04, 0x06, 0xed, 0x40, 0x1a, 0x2e, 0xdf, 0x79,
-  0x7c, 0x21, 0x22, 0x80, 0x89, 0x08, 0x81, 0x66, 0x58, 0x08, 0x1b, 0x98,
-  0x86, 0xcb, 0x77, 0x1e, 0x7f, 0x71, 0x80, 0x41, 0x6c, 0x1e, 0x6a, 0xf2,
-  0x8b, 0xdb, 0xb6, 0x82, 0x6a, 0xb8, 0x7c, 0xe7, 0xf1, 0x25, 0x80, 0x79,
-  0x16, 0xa2, 0x24, 0x2a, 0x62, 0xf1, 0x8b, 0xdb, 0x36, 0x82, 0x6a, 0xb8,
-  0x7c, 0xe7, 0xf1, 0xa5, 0xc9, 0x89, 0x08, 0x94, 0x9a, 0x1e, 0x6a, 0xf2,
-  0x8b, 0xdb, 0x36, 0x83, 0x67, 0xb8, 0x7c, 0xe7, 0xf1, 0xa9, 0x06, 0x88,
-  0x30, 0xbf, 0xb8, 0x6d, 0x13, 0x20, 0x18, 0x00, 0x69, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x41, 0x53, 0x48, 0x14, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x91, 0x6c, 0x19, 0x82, 0xd3, 0xad, 0x72, 0x61, 0x46,
-  0x15, 0x59, 0xe5, 0xe6, 0x43, 0x39, 0x9a, 0x44, 0x58, 0x49, 0x4c, 0x94,
-  0x07, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xe5, 0x01, 0x00, 0x00, 0x44,
-  0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7c,
-  0x07, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xdc,
-  0x01, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13,
-  0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06,
-  0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e,
-  0x04, 0x8b, 0x62, 0x80, 0x14, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xa4,
-  0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x52, 0x88, 0x48,
-  0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4,
-  0x48, 0x0e, 0x90, 0x91, 0x22, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1,
-  0x83, 0xe5, 0x8a, 0x04, 0x29, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40,
-  0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x6d,
-  0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49,
-  0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20,
-  0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0x33,
-  0x00, 0x00, 0x00, 0x32, 0x22, 0x48, 0x09, 0x20, 0x64, 0x85, 0x04, 0x93,
-  0x22, 0xa4, 0x84, 0x04, 0x93, 0x22, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12,
-  0x4c, 0x8a, 0x8c, 0x0b, 0x84, 0xa4, 0x4c, 0x10, 0x6c, 0x23, 0x00, 0x25,
-  0x00, 0x14, 0x66, 0x00, 0xe6, 0x08, 0xc0, 0x60, 0x8e, 0x00, 0x29, 0xc6,
-  0x20, 0x84, 0x14, 0x42, 0xa6, 0x18, 0x80, 0x10, 0x52, 0x06, 0xa1, 0x9b,
-  0x86, 0xcb, 0x9f, 0xb0, 0x87, 0x90, 0xfc, 0x95, 0x90, 0x56, 0x62, 0xf2,
-  0x8b, 0xdb, 0x46, 0xc5, 0x18, 0x63, 0x10, 0x2a, 0xf7, 0x0c, 0x97, 0x3f,
-  0x61, 0x0f, 0x21, 0xf9, 0x21, 0xd0, 0x0c, 0x0b, 0x81, 0x82, 0x55, 0x18,
-  0x45, 0x18, 0x1b, 0x63, 0x0c, 0x42, 0xc8, 0xa0, 0x56, 0x86, 0x41, 0x06,
-  0xbd, 0x39, 0x82, 0xa0, 0x18, 0x8c, 0x14, 0x42, 0x22, 0xc9, 0x81, 0x80,
-  0x61, 0x84, 0x61, 0x98, 0x89, 0x0c, 0xc6, 0x81, 0x1d, 0xc2, 0x61, 0x1e,
-  0xe6, 0xc1, 0x0d, 0x68, 0xa1, 0x1c, 0xf0, 0x81, 0x1e, 0xea, 0x41, 0x1e,
-  0xca, 0x61, 0x14, 0xea, 0x41, 0x1c, 0xca, 0x81, 0x0f, 0xec, 0xa1, 0x1c,
-  0xc6, 0x81, 0x1e, 0xde, 0x41, 0x1e, 0xf8, 0xc0, 0x1c, 0xd8, 0xe1, 0x1d,
-  0xc2, 0x81, 0x1e, 0xd8, 0x00, 0x0c, 0xe6, 0xc0, 0x0f, 0xc0, 0xc0, 0x0f,
-  0x50, 0x50, 0xc9, 0xde, 0x24, 0x4d, 0x11, 0x25, 0x4c, 0x3e, 0x0b, 0x30,
-  0xcf, 0x42, 0x44, 0xec, 0x04, 0x4c, 0x04, 0x0a, 0x08, 0xe1, 0x4c, 0x20,
-  0x00, 0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36,
-  0x68, 0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e,
-  0x6d, 0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07,
-  0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07,
-  0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07,
-  0x6d, 0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06,
-  0xe9, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e,
-  0x76, 0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07,
-  0x76, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07,
-  0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07,
-  0x76, 0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07,
-  0x7a, 0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c,
-  0x06, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
-  0x79, 0x10, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x18, 0xf2, 0x34, 0x40, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x30, 0xe4, 0x79, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x60, 0xc8, 0x23, 0x01, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x40, 0x16, 0x08, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x32,
-  0x1e, 0x98, 0x14, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6,
-  0x04, 0x43, 0x22, 0x25, 0x30, 0x02, 0x50, 0x0c, 0xa5, 0x50, 0x12, 0x65,
-  0x50, 0x0e, 0xe5, 0x41, 0xa5, 0x24, 0xca, 0xa0, 0x10, 0x46, 0x00, 0x8a,
-  0xa0, 0x40, 0xe8, 0xce, 0x00, 0x50, 0x9e, 0x01, 0x20, 0x3d, 0x56, 0x72,
-  0x10, 0x00, 0x00, 0x00, 0xc7, 0x71, 0x00, 0x79, 0x18, 0x00, 0x00, 0x5f,
-  0x00, 0x00, 0x00, 0x1a, 0x03, 0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35,
-  0x18, 0x63, 0x0b, 0x73, 0x3b, 0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b,
-  0x73, 0x03, 0x99, 0x71, 0xb9, 0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b,
-  0x91, 0x2a, 0x62, 0x2a, 0x0a, 0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79,
-  0x31, 0x4b, 0x73, 0x0b, 0x63, 0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04, 0xc2,
-  0x98, 0x20, 0x10, 0xc7, 0x06, 0x61, 0x20, 0x26, 0x08, 0x04, 0xb2, 0x41,
-  0x18, 0x0c, 0x0a, 0x70, 0x73, 0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08, 0x17,
-  0x45, 0x60, 0x82, 0x40, 0x24, 0x13, 0x04, 0x42, 0xd9, 0x20, 0x10, 0xcd,
-  0x86, 0x84, 0x50, 0x16, 0x82, 0x18, 0x18, 0xc2, 0xd9, 0x10, 0x3c, 0x13,
-  0x84, 0xac, 0xda, 0x80, 0x10, 0xd1, 0x42, 0x10, 0x03, 0x01, 0x6c, 0x08,
-  0xa4, 0x0d, 0x04, 0x04, 0x00, 0xd3, 0x04, 0x41, 0xb3, 0x36, 0x04, 0xd5,
-  0x04, 0x41, 0x00, 0x48, 0xb4, 0x85, 0xa5, 0xb9, 0x71, 0x99, 0xb2, 0xfa,
-  0x82, 0x7a, 0x9b, 0x4b, 0xa3, 0x4b, 0x7b, 0x73, 0x9b, 0x20, 0x14, 0xce,
-  0x04, 0xa1, 0x78, 0x36, 0x04, 0xc4, 0x04, 0xa1, 0x80, 0x26, 0x08, 0x45,
-  0xb4, 0x61, 0x21, 0x32, 0x6d, 0xe3, 0xba, 0xa1, 0x23, 0x3c, 0x80, 0x08,
-  0x55, 0x11, 0xd6, 0xd0, 0xd3, 0x93, 0x14, 0xd1, 0x04, 0xa1, 0x90, 0x26,
-  0x08, 0xc4, 0x32, 0x41, 0x20, 0x98, 0x0d, 0x82, 0x18, 0x8c, 0xc1, 0x86,
-  0x65, 0x00, 0x03, 0xcd, 0xe3, 0xc2, 0x60, 0xd8, 0x06, 0x8f, 0x0c, 0x36,
-  0x08, 0x5f, 0x19, 0x30, 0x99, 0xb2, 0xfa, 0xa2, 0x0a, 0x93, 0x3b, 0x2b,
-  0xa3, 0x9b, 0x20, 0x14, 0xd3, 0x04, 0x81, 0x68, 0x36, 0x08, 0x62, 0x90,
-  0x06, 0x1b, 0x16, 0xe2, 0x0c, 0x34, 0x34, 0xe0, 0xbc, 0xa1, 0x23, 0x3c,
-  0x35, 0xd8, 0x10, 0xac, 0xc1, 0x86, 0xc1, 0x0c, 0xd8, 0x00, 0xd8, 0x50,
-  0x5c, 0x58, 0x1b, 0x50, 0x40, 0x15, 0x36, 0x36, 0xbb, 0x36, 0x97, 0x34,
-  0xb2, 0x32, 0x37, 0xba, 0x29, 0x41, 0x50, 0x85, 0x0c, 0xcf, 0xc5, 0xae,
-  0x4c, 0x6e, 0x2e, 0xed, 0xcd, 0x6d, 0x4a, 0x40, 0x34, 0x21, 0xc3, 0x73,
-  0xb1, 0x0b, 0x63, 0xb3, 0x2b, 0x93, 0x9b, 0x12, 0x18, 0x75, 0xc8, 0xf0,
-  0x5c, 0xe6, 0xd0, 0xc2, 0xc8, 0xca, 0xe4, 0x9a, 0xde, 0xc8, 0xca, 0xd8,
-  0xa6, 0x04, 0x48, 0x19, 0x32, 0x3c, 0x17, 0xb9, 0xb2, 0xb9, 0xb7, 0x3a,
-  0xb9, 0xb1, 0xb2, 0xb9, 0x29, 0xc1, 0x54, 0x87, 0x0c, 0xcf, 0xc5, 0x2e,
-  0xad, 0xec, 0x2e, 0x89, 0x6c, 0x8a, 0x2e, 0x8c, 0xae, 0x6c, 0x4a, 0x50,
-  0xd5, 0x21, 0xc3, 0x73, 0x29, 0x73, 0xa3, 0x93, 0xcb, 0x83, 0x7a, 0x4b,
-  0x73, 0xa3, 0x9b, 0x9b, 0x12, 0xb4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x79,
-  0x18, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4,
-  0xe1, 0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c,
-  0x42, 0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00,
-  0x0f, 0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2,
-  0xc1, 0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38,
-  0x84, 0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d,
-  0xcc, 0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87,
-  0x70, 0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87,
-  0x19, 0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30,
-  0x0f, 0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde,
-  0x21, 0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b,
-  0xbc, 0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c,
-  0x84, 0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07,
-  0x37, 0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87,
-  0x70, 0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87,
-  0x77, 0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87,
-  0x79, 0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0,
-  0x0e, 0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc,
-  0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4,
-  0x81, 0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39,
-  0x98, 0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38,
-  0x88, 0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b,
-  0xd4, 0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03,
-  0x7a, 0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0,
-  0x06, 0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0,
-  0x0e, 0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71,
-  0x20, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x56, 0x20, 0x0d, 0x97, 0xef,
-  0x3c, 0xbe, 0x10, 0x11, 0xc0, 0x44, 0x84, 0x40, 0x33, 0x2c, 0x84, 0x05,
-  0x4c, 0xc3, 0xe5, 0x3b, 0x8f, 0xbf, 0x38, 0xc0, 0x20, 0x36, 0x0f, 0x35,
-  0xf9, 0xc5, 0x6d, 0xdb, 0x40, 0x35, 0x5c, 0xbe, 0xf3, 0xf8, 0x12, 0xc0,
-  0x3c, 0x0b, 0x51, 0x12, 0x15, 0xb1, 0xf8, 0xc5, 0x6d, 0x9b, 0x40, 0x35,
-  0x5c, 0xbe, 0xf3, 0xf8, 0xd2, 0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f, 0x35,
-  0xf9, 0xc5, 0x6d, 0x1b, 0xc1, 0x33, 0x5c, 0xbe, 0xf3, 0xf8, 0x54, 0x03,
-  0x44, 0x98, 0x5f, 0xdc, 0xb6, 0x01, 0x10, 0x0c, 0x80, 0x34, 0x00, 0x61,
-  0x20, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x13, 0x04, 0x41, 0x2c, 0x10,
-  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x47, 0x00, 0xa8, 0x94,
-  0x00, 0x91, 0xe2, 0x2b, 0xb9, 0x52, 0x29, 0x97, 0x42, 0x98, 0x01, 0xa0,
-  0x31, 0x02, 0x30, 0x46, 0x00, 0x82, 0x20, 0x88, 0x7f, 0x33, 0x00, 0x63,
-  0x04, 0x79, 0xd8, 0xc6, 0xee, 0x37, 0x46, 0x90, 0x86, 0xb7, 0x0f, 0x7e,
-  0x63, 0x04, 0x7d, 0x2c, 0xba, 0xf1, 0x37, 0x46, 0xf0, 0xf7, 0x67, 0xbd,
-  0x7f, 0x63, 0x04, 0x2f, 0x0d, 0xaf, 0xaf, 0x37, 0x46, 0xc0, 0x93, 0x71,
-  0xc8, 0x7f, 0x63, 0x04, 0x3a, 0x6b, 0xce, 0xf1, 0x07, 0x00, 0x00, 0x23,
-  0x06, 0x09, 0x00, 0x82, 0x60, 0x20, 0x91, 0xc1, 0x83, 0x89, 0x81, 0x18,
-  0x48, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x20, 0x95, 0x01, 0xb4, 0x8d,
-  0xc1, 0x18, 0x4c, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60, 0xa8, 0x81,
-  0x53, 0x06, 0x64, 0xa0, 0x35, 0x23, 0x06, 0x09, 0x00, 0x82, 0x60, 0x60,
-  0xac, 0xc1, 0x63, 0x06, 0x65, 0x40, 0x39, 0x23, 0x06, 0x09, 0x00, 0x82,
-  0x60, 0x60, 0xb0, 0x01, 0x74, 0x06, 0x66, 0xb0, 0x3d, 0x23, 0x06, 0x0f,
-  0x00, 0x82, 0x60, 0xd0, 0xac, 0x41, 0x55, 0x10, 0x83, 0x10, 0x34, 0x10,
-  0x04, 0x3d, 0xa3, 0x09, 0x01, 0x30, 0x9a, 0x20, 0x04, 0xa3, 0x09, 0x83,
-  0x60, 0x83, 0x22, 0x1f, 0x1b, 0x16, 0xf9, 0xd8, 0xc0, 0xc8, 0xc7, 0x0c,
-  0x47, 0x3e, 0x66, 0x3c, 0xf2, 0x31, 0x03, 0x92, 0x8f, 0x0d, 0x12, 0x7c,
-  0x6c, 0x98, 0xe0, 0x63, 0x03, 0x05, 0x1f, 0x1b, 0x12, 0xf9, 0xd8, 0x90,
-  0xc8, 0xc7, 0x86, 0x44, 0x3e, 0xf6, 0x64, 0xf2, 0xb1, 0x47, 0x93, 0x8f,
-  0x3d, 0x9b, 0x7c, 0x6c, 0xe8, 0xe0, 0x63, 0x83, 0x07, 0x1f, 0x1b, 0x3e,
-  0xf8, 0xd8, 0x20, 0xc9, 0xc7, 0x06, 0x49, 0x3e, 0x36, 0x48, 0xf2, 0xb1,
-  0x81, 0x0c, 0xe0, 0x63, 0x43, 0x19, 0xc0, 0xc7, 0x06, 0x33, 0x80, 0x8f,
-  0x3d, 0x03, 0x7d, 0xec, 0x19, 0xe8, 0x63, 0xcf, 0x40, 0x9f, 0x11, 0x03,
-  0x03, 0x00, 0x41, 0x30, 0x78, 0x52, 0x21, 0x14, 0x86, 0x11, 0x03, 0x03,
-  0x00, 0x41, 0x30, 0x78, 0x54, 0x41, 0x14, 0x86, 0x11, 0x03, 0x03, 0x00,
-  0x41, 0x30, 0x78, 0x56, 0x61, 0x14, 0x86, 0x11, 0x03, 0x03, 0x00, 0x41,
-  0x30, 0x78, 0x58, 0x81, 0x0e, 0x86, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30,
-  0x78, 0x5a, 0xa1, 0x0e, 0x86, 0x11, 0x03, 0x03, 0x00, 0x41, 0x30, 0x78,
-  0x5c, 0xc1, 0x0e, 0x06, 0x1b, 0xe2, 0x40, 0x3e, 0x36, 0xc8, 0x81, 0x7c,
-  0x6c, 0x98, 0x03, 0xf9, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0xc1, 0x23,
-  0x0b, 0x7b, 0x30, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0xc1, 0x33, 0x0b,
-  0x7c, 0x30, 0x8c, 0x18, 0x18, 0x00, 0x08, 0x82, 0xc1, 0x43, 0x0b, 0x7d,
-  0x30, 0x8c, 0x18, 0x24, 0x00, 0x08, 0x82, 0x01, 0x72, 0x0b, 0xb0, 0x20,
-  0x0b, 0xb2, 0x80, 0x0a, 0xc3, 0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x20,
-  0xb7, 0x00, 0x0b, 0xb2, 0x20, 0x0b, 0xa1, 0x20, 0x8c, 0x18, 0x24, 0x00,
-  0x08, 0x82, 0x01, 0x72, 0x0b, 0xb0, 0x20, 0x0b, 0xb2, 0x70, 0x0a, 0xc1,
-  0x88, 0x41, 0x02, 0x80, 0x20, 0x18, 0x20, 0xb7, 0x00, 0x0b, 0xb2, 0x20,
-  0x0b, 0xaa, 0x90, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
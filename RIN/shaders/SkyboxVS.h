@@ -1,610 +0,0 @@
-#if 0
-;
-; Input signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; POSITION                 0   xyz         0     NONE   float   xyz 
-;
-;
-; Output signature:
-;
-; Name                 Index   Mask Register SysValue  Format   Used
-; -------------------- ----- ------ -------- -------- ------- ------
-; SV_Position              0   xyzw        0      POS   float   xyzw
-; TEXCOORD                 0   xyz         1     NONE   float   xyz 
-;
-; shader hash: a86635a46bb5786ebd8ca79e7ce97129
-;
-; Pipeline Runtime Information: 
-;
-; Vertex Shader
-; OutputPositionPresent=1
-;
-;
-; Input signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; POSITION                 0                              
-;
-; Output signature:
-;
-; Name                 Index             InterpMode DynIdx
-; -------------------- ----- ---------------------- ------
-; SV_Position              0          noperspective       
-; TEXCOORD                 0                 linear       
-;
-; Buffer Definitions:
-;
-; cbuffer cameraBuffer
-; {
-;
-;   struct dx.alignment.legacy.cameraBuffer
-;   {
-;
-;       struct dx.alignment.legacy.struct.Camera
-;       {
-;
-;           column_major float4x4 viewMatrix;         ; Offset:    0
-;           column_major float4x4 projMatrix;         ; Offset:   64
-;           column_major float4x4 invProjMatrix;      ; Offset:  128
-;           column_major float4x4 viewProjMatrix;     ; Offset:  192
-;           float3 position;                          ; Offset:  256
-;           float padding0;                           ; Offset:  268
-;           float frustumXX;                          ; Offset:  272
-;           float frustumXZ;                          ; Offset:  276
-;           float frustumYY;                          ; Offset:  280
-;           float frustumYZ;                          ; Offset:  284
-;           float nearZ;                              ; Offset:  288
-;           float farZ;                               ; Offset:  292
-;           float clusterConstantA;                   ; Offset:  296
-;           float clusterConstantB;                   ; Offset:  300
-;       
-;       } cameraBuffer;                               ; Offset:    0
-;
-;   
-;   } cameraBuffer;                                   ; Offset:    0 Size:   304
-;
-; }
-;
-;
-; Resource Bindings:
-;
-; Name                                 Type  Format         Dim      ID      HLSL Bind  Count
-; ------------------------------ ---------- ------- ----------- ------- -------------- ------
-; cameraBuffer                      cbuffer      NA          NA     CB0            cb0     1
-;
-;
-; ViewId state:
-;
-; Number of inputs: 3, outputs: 7
-; Outputs dependent on ViewId: {  }
-; Inputs contributing to computation of Outputs:
-;   output 0 depends on inputs: { 0, 1, 2 }
-;   output 1 depends on inputs: { 0, 1, 2 }
-;   output 2 depends on inputs: { 0, 1, 2 }
-;   output 3 depends on inputs: { 0, 1, 2 }
-;   output 4 depends on inputs: { 0 }
-;   output 5 depends on inputs: { 2 }
-;   output 6 depends on inputs: { 1 }
-;
-target datalayout = "e-m:e-p:32:32-i1:32-i8:32-i16:32-i32:32-i64:64-f16:32-f32:32-f64:64-n8:16:32:64"
-target triple = "dxil-ms-dx"
-
-%dx.types.Handle = type { i8* }
-%dx.types.CBufRet.f32 = type { float, float, float, float }
-%dx.alignment.legacy.cameraBuffer = type { %dx.alignment.legacy.struct.Camera }
-%dx.alignment.legacy.struct.Camera = type { [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], [4 x <4 x float>], <3 x float>, float, float, float, float, float, float, float, float, float }
-
-define void @main() {
-  %1 = call %dx.types.Handle @dx.op.createHandle(i32 57, i8 2, i32 0, i32 0, i1 false)  ; CreateHandle(resourceClass,rangeId,index,nonUniformIndex)
-  %2 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 0, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %3 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 1, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %4 = call float @dx.op.loadInput.f32(i32 4, i32 0, i32 0, i8 2, i32 undef)  ; LoadInput(inputSigId,rowIndex,colIndex,gsVertexAxis)
-  %5 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %1, i32 0)  ; CBufferLoadLegacy(handle,regIndex)
-  %6 = extractvalue %dx.types.CBufRet.f32 %5, 0
-  %7 = extractvalue %dx.types.CBufRet.f32 %5, 1
-  %8 = extractvalue %dx.types.CBufRet.f32 %5, 2
-  %9 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %1, i32 1)  ; CBufferLoadLegacy(handle,regIndex)
-  %10 = extractvalue %dx.types.CBufRet.f32 %9, 0
-  %11 = extractvalue %dx.types.CBufRet.f32 %9, 1
-  %12 = extractvalue %dx.types.CBufRet.f32 %9, 2
-  %13 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %1, i32 2)  ; CBufferLoadLegacy(handle,regIndex)
-  %14 = extractvalue %dx.types.CBufRet.f32 %13, 0
-  %15 = extractvalue %dx.types.CBufRet.f32 %13, 1
-  %16 = extractvalue %dx.types.CBufRet.f32 %13, 2
-  %17 = fmul fast float %6, %2
-  %18 = call float @dx.op.tertiary.f32(i32 46, float %10, float %3, float %17)  ; FMad(a,b,c)
-  %19 = call float @dx.op.tertiary.f32(i32 46, float %14, float %4, float %18)  ; FMad(a,b,c)
-  %20 = fmul fast float %7, %2
-  %21 = call float @dx.op.tertiary.f32(i32 46, float %11, float %3, float %20)  ; FMad(a,b,c)
-  %22 = call float @dx.op.tertiary.f32(i32 46, float %15, float %4, float %21)  ; FMad(a,b,c)
-  %23 = fmul fast float %8, %2
-  %24 = call float @dx.op.tertiary.f32(i32 46, float %12, float %3, float %23)  ; FMad(a,b,c)
-  %25 = call float @dx.op.tertiary.f32(i32 46, float %16, float %4, float %24)  ; FMad(a,b,c)
-  %26 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %1, i32 4)  ; CBufferLoadLegacy(handle,regIndex)
-  %27 = extractvalue %dx.types.CBufRet.f32 %26, 0
-  %28 = extractvalue %dx.types.CBufRet.f32 %26, 1
-  %29 = extractvalue %dx.types.CBufRet.f32 %26, 3
-  %30 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %1, i32 5)  ; CBufferLoadLegacy(handle,regIndex)
-  %31 = extractvalue %dx.types.CBufRet.f32 %30, 0
-  %32 = extractvalue %dx.types.CBufRet.f32 %30, 1
-  %33 = extractvalue %dx.types.CBufRet.f32 %30, 3
-  %34 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %1, i32 6)  ; CBufferLoadLegacy(handle,regIndex)
-  %35 = extractvalue %dx.types.CBufRet.f32 %34, 0
-  %36 = extractvalue %dx.types.CBufRet.f32 %34, 1
-  %37 = extractvalue %dx.types.CBufRet.f32 %34, 3
-  %38 = call %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32 59, %dx.types.Handle %1, i32 7)  ; CBufferLoadLegacy(handle,regIndex)
-  %39 = extractvalue %dx.types.CBufRet.f32 %38, 0
-  %40 = extractvalue %dx.types.CBufRet.f32 %38, 1
-  %41 = extractvalue %dx.types.CBufRet.f32 %38, 3
-  %42 = fmul fast float %27, %19
-  %43 = call float @dx.op.tertiary.f32(i32 46, float %31, float %22, float %42)  ; FMad(a,b,c)
-  %44 = call float @dx.op.tertiary.f32(i32 46, float %35, float %25, float %43)  ; FMad(a,b,c)
-  %45 = fadd fast float %44, %39
-  %46 = fmul fast float %28, %19
-  %47 = call float @dx.op.tertiary.f32(i32 46, float %32, float %22, float %46)  ; FMad(a,b,c)
-  %48 = call float @dx.op.tertiary.f32(i32 46, float %36, float %25, float %47)  ; FMad(a,b,c)
-  %49 = fadd fast float %48, %40
-  %50 = fmul fast float %29, %19
-  %51 = call float @dx.op.tertiary.f32(i32 46, float %33, float %22, float %50)  ; FMad(a,b,c)
-  %52 = call float @dx.op.tertiary.f32(i32 46, float %37, float %25, float %51)  ; FMad(a,b,c)
-  %53 = fadd fast float %52, %41
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 0, float %45)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 1, float %49)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 2, float %53)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 0, i32 0, i8 3, float %53)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 0, float %2)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 1, float %4)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  call void @dx.op.storeOutput.f32(i32 5, i32 1, i32 0, i8 2, float %3)  ; StoreOutput(outputSigId,rowIndex,colIndex,value)
-  ret void
-}
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.loadInput.f32(i32, i32, i32, i8, i32) #0
-
-; Function Attrs: nounwind
-declare void @dx.op.storeOutput.f32(i32, i32, i32, i8, float) #1
-
-; Function Attrs: nounwind readonly
-declare %dx.types.CBufRet.f32 @dx.op.cbufferLoadLegacy.f32(i32, %dx.types.Handle, i32) #2
-
-; Function Attrs: nounwind readnone
-declare float @dx.op.tertiary.f32(i32, float, float, float) #0
-
-; Function Attrs: nounwind readonly
-declare %dx.types.Handle @dx.op.createHandle(i32, i8, i32, i32, i1) #2
-
-attributes #0 = { nounwind readnone }
-attributes #1 = { nounwind }
-attributes #2 = { nounwind readonly }
-
-!llvm.ident = !{!0}
-!dx.version = !{!1}
-!dx.valver = !{!2}
-!dx.shaderModel = !{!3}
-!dx.resources = !{!4}
-!dx.viewIdState = !{!7}
-!dx.entryPoints = !{!8}
-
-!0 = !{!"clang version 3.7 (tags/RELEASE_370/final)"}
-!1 = !{i32 1, i32 0}
-!2 = !{i32 1, i32 6}
-!3 = !{!"vs", i32 6, i32 0}
-!4 = !{null, null, !5, null}
-!5 = !{!6}
-!6 = !{i32 0, %dx.alignment.legacy.cameraBuffer* undef, !"", i32 0, i32 0, i32 1, i32 304, null}
-!7 = !{[5 x i32] [i32 3, i32 7, i32 31, i32 79, i32 47]}
-!8 = !{void ()* @main, !"main", !9, !4, null}
-!9 = !{!10, !14, null}
-!10 = !{!11}
-!11 = !{i32 0, !"POSITION", i8 9, i8 0, !12, i8 0, i32 1, i8 3, i32 0, i8 0, !13}
-!12 = !{i32 0}
-!13 = !{i32 3, i32 7}
-!14 = !{!15, !17}
-!15 = !{i32 0, !"SV_Position", i8 9, i8 3, !12, i8 4, i32 1, i8 4, i32 0, i8 0, !16}
-!16 = !{i32 3, i32 15}
-!17 = !{i32 1, !"TEXCOORD", i8 9, i8 0, !12, i8 2, i32 1, i8 3, i32 1, i8 0, !13}
-
-#endif
-
-const unsigned char RINShaderBytesSkyboxVS[] = {
-  0x44, 0x58, 0x42, 0x43, 0xf5, 0x6e, 0x52, 0x6d, 0x3a, 0xa2, 0x90, 0xaf,
-  0xdb, 0x53, 0xa1, 0xb2, 0xcc, 0x34, 0x3d, 0x4d, 0x01, 0x00, 0x00, 0x00,
-  0x96, 0x12, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x50, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
-  0x9a, 0x01, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0xbe, 0x0a, 0x00, 0x00,
-  0xda, 0x0a, 0x00, 0x00, 0x53, 0x46, 0x49, 0x30, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x53, 0x47, 0x31,
-  0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49,
-  0x54, 0x49, 0x4f, 0x4e, 0x00, 0x4f, 0x53, 0x47, 0x31, 0x5d, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x53, 0x56, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e,
-  0x00, 0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x50, 0x53,
-  0x56, 0x30, 0xa4, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
-  0x00, 0x00, 0x00, 0x50, 0x4f, 0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x00,
-  0x54, 0x45, 0x58, 0x43, 0x4f, 0x4f, 0x52, 0x44, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x43, 0x00, 0x03, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x44, 0x03, 0x03, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x01, 0x43, 0x00, 0x03, 0x02, 0x00, 0x00, 0x1f, 0x00,
-  0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x52, 0x54, 0x53, 0x30, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x7f, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x53, 0x54,
-  0x41, 0x54, 0x84, 0x08, 0x00, 0x00, 0x60, 0x00, 0x01, 0x00, 0x21, 0x02,
-  0x00, 0x00, 0x44, 0x58, 0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00,
-  0x00, 0x00, 0x6c, 0x08, 0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c,
-  0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8,
-  0x04, 0x49, 0x06, 0x10, 0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05,
-  0x08, 0x19, 0x1e, 0x04, 0x8b, 0x62, 0x80, 0x18, 0x45, 0x02, 0x42, 0x92,
-  0x0b, 0x42, 0xc4, 0x10, 0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32,
-  0x62, 0x88, 0x48, 0x90, 0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19,
-  0x32, 0x42, 0xe4, 0x48, 0x0e, 0x90, 0x11, 0x23, 0xc4, 0x50, 0x41, 0x51,
-  0x81, 0x8c, 0xe1, 0x83, 0xe5, 0x8a, 0x04, 0x31, 0x46, 0x06, 0x51, 0x18,
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff,
-  0xff, 0x07, 0x40, 0x02, 0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0x03, 0x20, 0x6d, 0x30, 0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09,
-  0xa8, 0x00, 0x49, 0x18, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82,
-  0x60, 0x42, 0x20, 0x4c, 0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20,
-  0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x32, 0x22, 0x88, 0x09, 0x20, 0x64,
-  0x85, 0x04, 0x13, 0x23, 0xa4, 0x84, 0x04, 0x13, 0x23, 0xe3, 0x84, 0xa1,
-  0x90, 0x14, 0x12, 0x4c, 0x8c, 0x8c, 0x0b, 0x84, 0xc4, 0x4c, 0x10, 0x80,
-  0xc1, 0x0c, 0xc0, 0x30, 0x02, 0x01, 0x24, 0x41, 0x30, 0x8c, 0x30, 0x00,
-  0x17, 0x06, 0xc3, 0xe5, 0x03, 0x0b, 0x62, 0x34, 0x0c, 0xd1, 0x4c, 0xfe,
-  0x42, 0x18, 0x80, 0x80, 0xf9, 0xd2, 0x14, 0x51, 0xc2, 0xe4, 0x73, 0x00,
-  0x43, 0x44, 0x00, 0x72, 0x04, 0x41, 0x10, 0x06, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xe0, 0xc0, 0x60, 0xb8, 0x7c, 0x60, 0x41, 0x8c, 0x86, 0x21,
-  0x9a, 0xc9, 0x5f, 0x08, 0x03, 0x10, 0x30, 0x5f, 0x00, 0x18, 0x22, 0x02,
-  0x36, 0xaa, 0x28, 0x88, 0x08, 0x05, 0x04, 0x15, 0x23, 0x00, 0x25, 0x38,
-  0x08, 0x99, 0x23, 0x00, 0x83, 0x39, 0x02, 0xa4, 0x18, 0x80, 0xa2, 0x28,
-  0x8b, 0x42, 0x4c, 0x31, 0x0e, 0x45, 0x51, 0x16, 0x80, 0x9c, 0xa3, 0x86,
-  0xcb, 0x9f, 0xb0, 0x87, 0x90, 0x7c, 0x6e, 0xa3, 0x8a, 0x95, 0x98, 0xfc,
-  0xe2, 0xb6, 0x11, 0x01, 0x00, 0x00, 0x40, 0xcb, 0x3d, 0xc3, 0xe5, 0x4f,
-  0xd8, 0x43, 0x48, 0x7e, 0x08, 0x34, 0xc3, 0x42, 0xa0, 0x20, 0x2a, 0x04,
-  0xa4, 0x48, 0x0a, 0x4d, 0xa5, 0x00, 0x14, 0x00, 0x00, 0xa8, 0x9a, 0x23,
-  0x08, 0x8a, 0x21, 0x29, 0x8b, 0xa2, 0x5c, 0x84, 0x0d, 0x04, 0x9c, 0x25,
-  0x2c, 0x80, 0x24, 0xf9, 0x0c, 0x30, 0x45, 0xc8, 0xe5, 0x17, 0x8b, 0x03,
-  0x4c, 0x3e, 0xee, 0xe3, 0x28, 0x10, 0xae, 0x91, 0xa6, 0x88, 0x12, 0x26,
-  0x9f, 0x03, 0x18, 0x22, 0x02, 0x90, 0xb3, 0x6d, 0xdb, 0x36, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x48, 0x53, 0x44, 0x09, 0x93, 0x5f,
-  0x49, 0x28, 0x35, 0x3d, 0xd4, 0x84, 0x84, 0x60, 0x38, 0x46, 0x00, 0x18,
-  0x22, 0x02, 0x36, 0xaa, 0x28, 0x88, 0x08, 0x05, 0x5c, 0x16, 0x28, 0x00,
-  0x00, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68,
-  0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d,
-  0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9,
-  0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76,
-  0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76,
-  0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x3a, 0x0f, 0x64, 0x90,
-  0x21, 0x23, 0x25, 0x40, 0x00, 0x56, 0x00, 0xc0, 0x90, 0x07, 0x01, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21, 0x0f, 0x03,
-  0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x1e,
-  0x07, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86,
-  0x3c, 0x13, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0c, 0x79, 0x2a, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0xf2, 0x60, 0x40, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x90, 0x05, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x32, 0x1e,
-  0x98, 0x18, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04,
-  0x43, 0x5a, 0x8a, 0xa0, 0x10, 0xca, 0x80, 0x94, 0x12, 0x18, 0x01, 0x28,
-  0x86, 0x02, 0x27, 0x28, 0x82, 0x42, 0x28, 0x83, 0x72, 0x28, 0x89, 0x02,
-  0x0c, 0x28, 0x40, 0x81, 0x02, 0x1c, 0x28, 0x40, 0x82, 0xc2, 0x24, 0x28,
-  0x50, 0x82, 0x42, 0x25, 0x28, 0x58, 0x82, 0xc2, 0x25, 0x28, 0x60, 0x82,
-  0x42, 0x26, 0x28, 0x68, 0x82, 0xc2, 0x26, 0x28, 0x9c, 0x02, 0x29, 0x8f,
-  0xd2, 0xa3, 0xa5, 0x24, 0x46, 0x00, 0xc8, 0x98, 0x01, 0xa0, 0x62, 0x06,
-  0x80, 0x88, 0x19, 0x00, 0xe2, 0x66, 0x00, 0xa8, 0x9b, 0x01, 0x20, 0x6f,
-  0x06, 0x80, 0xbe, 0xb1, 0x8a, 0xe1, 0xf8, 0x5e, 0xe1, 0x0d, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x1a, 0x03,
-  0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b,
-  0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9,
-  0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a,
-  0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63,
-  0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04, 0x45, 0x99, 0x20, 0x28, 0xcb, 0x06,
-  0x61, 0x20, 0x36, 0x08, 0x04, 0x41, 0xc1, 0x6e, 0x6e, 0x82, 0xa0, 0x30,
-  0x1b, 0x86, 0x03, 0x21, 0x26, 0x08, 0x86, 0x19, 0x90, 0x19, 0x0b, 0x6b,
-  0x2b, 0x93, 0x0b, 0x13, 0xaa, 0x33, 0x33, 0x2b, 0x93, 0x9b, 0x20, 0x28,
-  0xcd, 0x06, 0x84, 0x50, 0x16, 0x82, 0x18, 0x18, 0x60, 0x43, 0xd0, 0x6c,
-  0x20, 0x00, 0xc0, 0x01, 0x26, 0x08, 0x5c, 0x1a, 0x50, 0xb1, 0x4b, 0x2b,
-  0xbb, 0x6b, 0x0a, 0xa3, 0x93, 0x4b, 0xc3, 0x9b, 0x20, 0x28, 0xce, 0x04,
-  0x41, 0x79, 0x36, 0x0c, 0xd3, 0x24, 0x4d, 0x10, 0x14, 0x68, 0x82, 0xa0,
-  0x44, 0x13, 0x04, 0x45, 0xda, 0x80, 0x20, 0x91, 0x44, 0x55, 0x84, 0x75,
-  0x51, 0x81, 0x93, 0x7b, 0x53, 0x6b, 0x0a, 0xa3, 0x93, 0x4b, 0xc3, 0x9b,
-  0x20, 0x28, 0xd3, 0x06, 0x04, 0xc9, 0x24, 0xaa, 0xd2, 0xac, 0x8b, 0x4d,
-  0x9a, 0x9b, 0x1d, 0x94, 0xdc, 0x9b, 0x5a, 0x53, 0x18, 0x9d, 0x5c, 0x1a,
-  0xde, 0x04, 0x41, 0xa1, 0x36, 0x20, 0x08, 0x27, 0x51, 0x55, 0x67, 0x5d,
-  0x74, 0xec, 0xd2, 0xca, 0xee, 0xa0, 0xe4, 0xde, 0xd4, 0x9a, 0xc2, 0xe8,
-  0xe4, 0xd2, 0xf0, 0x26, 0x08, 0x4a, 0xb5, 0x01, 0x41, 0x3e, 0x89, 0xaa,
-  0xc0, 0xc0, 0xba, 0x88, 0xc0, 0xbd, 0xcd, 0xa5, 0xd1, 0xa5, 0xbd, 0xb9,
-  0x4d, 0x10, 0x14, 0x6b, 0x83, 0x81, 0x88, 0x41, 0x35, 0x06, 0xd6, 0x45,
-  0x04, 0x2e, 0x8c, 0x8c, 0x2c, 0xcd, 0xed, 0x0c, 0x66, 0x82, 0xa0, 0x5c,
-  0x1b, 0x0c, 0xa4, 0x0c, 0x2a, 0x33, 0xb0, 0x2e, 0x26, 0x66, 0x72, 0x75,
-  0x73, 0x74, 0x75, 0x6d, 0x58, 0x58, 0x13, 0x04, 0x05, 0xdb, 0x60, 0x20,
-  0x68, 0x50, 0xa5, 0x81, 0x75, 0x31, 0x31, 0x93, 0xab, 0x9b, 0xa3, 0xab,
-  0x6b, 0xc3, 0xd2, 0x9a, 0x20, 0x28, 0xd9, 0x06, 0x03, 0x59, 0x83, 0x8a,
-  0x0d, 0xac, 0x8b, 0x89, 0x99, 0x5c, 0xdd, 0x1c, 0x5d, 0x5d, 0x5b, 0x56,
-  0xd6, 0x04, 0x41, 0xd1, 0x36, 0x18, 0x88, 0x1b, 0x54, 0x6f, 0x60, 0x5d,
-  0x4c, 0xcc, 0xe4, 0xea, 0xe6, 0xe8, 0xea, 0xda, 0xb2, 0xb4, 0x26, 0x08,
-  0xca, 0xb6, 0xc1, 0x40, 0xe2, 0xa0, 0x92, 0x03, 0xeb, 0x62, 0xe1, 0x56,
-  0x16, 0x26, 0xa7, 0x35, 0x41, 0x50, 0xb8, 0x0d, 0x06, 0x42, 0x07, 0x55,
-  0x1d, 0x58, 0x17, 0x09, 0xb3, 0x30, 0x39, 0xad, 0x09, 0x82, 0xd2, 0x6d,
-  0x30, 0x90, 0x3b, 0xa8, 0xf0, 0xc0, 0xba, 0x08, 0x8d, 0xb1, 0xd5, 0xcd,
-  0xd1, 0x95, 0xc9, 0x0d, 0xbd, 0xb9, 0xcd, 0xd1, 0x85, 0xb9, 0xd1, 0x05,
-  0x4d, 0x10, 0x14, 0x6f, 0x83, 0x81, 0xe8, 0x41, 0xb5, 0x07, 0xd6, 0x45,
-  0x68, 0x8c, 0xad, 0x6e, 0x8e, 0xae, 0x4c, 0x6e, 0xe8, 0xcd, 0x6d, 0x8e,
-  0x2e, 0xcc, 0x8d, 0x4e, 0x68, 0x82, 0xa0, 0x7c, 0x1b, 0x0c, 0xa4, 0x0f,
-  0x2a, 0x3f, 0xb0, 0xae, 0x0d, 0x0f, 0x83, 0x6d, 0x5e, 0x18, 0x90, 0xc1,
-  0x19, 0xa8, 0x41, 0x1b, 0xc0, 0xc1, 0x1c, 0xd8, 0x41, 0x1e, 0xf0, 0xc1,
-  0x1f, 0x4c, 0x10, 0x3a, 0x35, 0x98, 0x20, 0x28, 0x60, 0xc0, 0x65, 0xca,
-  0xea, 0x0b, 0xea, 0x69, 0x2a, 0x89, 0x2a, 0xe9, 0xc9, 0x69, 0x03, 0x82,
-  0x88, 0x41, 0x45, 0x4c, 0xa3, 0x60, 0x5d, 0x1c, 0xe8, 0xca, 0xf0, 0x26,
-  0x08, 0x4a, 0x18, 0x10, 0xa1, 0x2a, 0xc2, 0x1a, 0x7a, 0x7a, 0x92, 0x22,
-  0xda, 0x80, 0x20, 0xa5, 0x50, 0x99, 0xc2, 0x74, 0x0a, 0xd6, 0xb5, 0x61,
-  0x10, 0x05, 0x52, 0x40, 0x85, 0x09, 0x82, 0xb7, 0x06, 0x1b, 0x08, 0x64,
-  0xa9, 0x88, 0x0d, 0x02, 0xb3, 0x0a, 0x13, 0x04, 0x02, 0x0d, 0x26, 0x08,
-  0xc5, 0x19, 0x6c, 0x58, 0x08, 0x08, 0x14, 0x42, 0x21, 0x15, 0x54, 0x81,
-  0x15, 0x5a, 0x01, 0x14, 0x5c, 0x81, 0x15, 0x26, 0x08, 0x49, 0xb0, 0x01,
-  0xd8, 0x30, 0x10, 0xb1, 0x10, 0x0b, 0x1b, 0x02, 0x59, 0xd8, 0x30, 0x0c,
-  0xb0, 0x30, 0x0b, 0x13, 0x84, 0x8f, 0x0d, 0x36, 0x04, 0xb5, 0x40, 0xa2,
-  0x2d, 0x2c, 0xcd, 0x8d, 0x08, 0xd4, 0xd3, 0x54, 0x12, 0x55, 0xd2, 0x93,
-  0xd3, 0x04, 0x61, 0x21, 0x83, 0x09, 0xc2, 0x52, 0x06, 0x1b, 0x02, 0x62,
-  0x82, 0xb0, 0x24, 0x1b, 0x84, 0xca, 0xda, 0xb0, 0x10, 0xb8, 0x90, 0x0b,
-  0xba, 0xb0, 0x0b, 0xba, 0x30, 0xf0, 0x02, 0xa1, 0x0b, 0xbd, 0xb0, 0x21,
-  0xf0, 0x05, 0x2e, 0x53, 0x56, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69,
-  0x6f, 0x6e, 0x13, 0x84, 0x05, 0x99, 0x20, 0x28, 0x62, 0xb0, 0x41, 0xa8,
-  0xc4, 0x61, 0xc3, 0x42, 0x80, 0x43, 0x2e, 0xf0, 0xc2, 0x2e, 0x84, 0xc3,
-  0x10, 0x0e, 0x84, 0x2e, 0x8c, 0xc3, 0x04, 0x61, 0x39, 0x36, 0x2c, 0xc3,
-  0x29, 0xe4, 0x82, 0x2e, 0xec, 0x42, 0x39, 0x0c, 0xbc, 0x30, 0xe8, 0x42,
-  0x2f, 0x6c, 0x10, 0xc8, 0xc1, 0x1c, 0x36, 0x0c, 0xbf, 0x70, 0x0e, 0xc0,
-  0x86, 0x02, 0x16, 0x6e, 0x01, 0x1d, 0x1e, 0x80, 0x86, 0x19, 0xdb, 0x5b,
-  0x18, 0xdd, 0x1c, 0x8b, 0x34, 0xb7, 0x39, 0xba, 0xb9, 0x09, 0x82, 0x32,
-  0x06, 0x34, 0xe6, 0xd2, 0xce, 0xbe, 0xd8, 0xc8, 0x68, 0xcc, 0xa5, 0x9d,
-  0x7d, 0xcd, 0xd1, 0x6d, 0x40, 0xd4, 0xe1, 0x5a, 0x07, 0x76, 0x68, 0x87,
-  0xca, 0x1d, 0xac, 0x2a, 0x6c, 0x6c, 0x76, 0x6d, 0x2e, 0x69, 0x64, 0x65,
-  0x6e, 0x74, 0x53, 0x82, 0xa0, 0x0a, 0x19, 0x9e, 0x8b, 0x5d, 0x99, 0xdc,
-  0x5c, 0xda, 0x9b, 0xdb, 0x94, 0x80, 0x68, 0x42, 0x86, 0xe7, 0x62, 0x17,
-  0xc6, 0x66, 0x57, 0x26, 0x37, 0x25, 0x28, 0xea, 0x90, 0xe1, 0xb9, 0xcc,
-  0xa1, 0x85, 0x91, 0x95, 0xc9, 0x35, 0xbd, 0x91, 0x95, 0xb1, 0x4d, 0x09,
-  0x90, 0x32, 0x64, 0x78, 0x2e, 0x72, 0x65, 0x73, 0x6f, 0x75, 0x72, 0x63,
-  0x65, 0x73, 0x53, 0x02, 0xa7, 0x12, 0x19, 0x9e, 0x0b, 0x5d, 0x1e, 0x5c,
-  0x59, 0x90, 0x9b, 0xdb, 0x1b, 0x5d, 0x18, 0x5d, 0xda, 0x9b, 0xdb, 0xdc,
-  0x14, 0xc1, 0x15, 0x66, 0xa1, 0x0e, 0x19, 0x9e, 0x8b, 0x5d, 0x5a, 0xd9,
-  0x5d, 0x12, 0xd9, 0x14, 0x5d, 0x18, 0x5d, 0xd9, 0x94, 0xa0, 0x16, 0xea,
-  0x90, 0xe1, 0xb9, 0x94, 0xb9, 0xd1, 0xc9, 0xe5, 0x41, 0xbd, 0xa5, 0xb9,
-  0xd1, 0xcd, 0x4d, 0x09, 0xd0, 0xa1, 0x0b, 0x19, 0x9e, 0xcb, 0xd8, 0x5b,
-  0x9d, 0x1b, 0x5d, 0x99, 0xdc, 0xdc, 0x94, 0xc0, 0x1d, 0x00, 0x79, 0x18,
-  0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1,
-  0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42,
-  0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f,
-  0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1,
-  0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84,
-  0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc,
-  0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70,
-  0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19,
-  0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f,
-  0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21,
-  0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc,
-  0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84,
-  0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37,
-  0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70,
-  0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77,
-  0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79,
-  0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e,
-  0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1,
-  0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81,
-  0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98,
-  0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88,
-  0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4,
-  0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a,
-  0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06,
-  0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e,
-  0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71, 0x20,
-  0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x06, 0x30, 0x09, 0x00, 0x43, 0x44,
-  0xc0, 0x46, 0x15, 0x05, 0x11, 0xfd, 0x0b, 0x61, 0x00, 0x02, 0x66, 0x04,
-  0xdb, 0x70, 0xf9, 0xce, 0xe3, 0x0b, 0x01, 0x55, 0x14, 0x44, 0x54, 0x3a,
-  0xc0, 0x50, 0x12, 0x06, 0x20, 0x60, 0x7e, 0x71, 0xdb, 0x66, 0x20, 0x0d,
-  0x97, 0xef, 0x3c, 0xbe, 0x10, 0x11, 0xc0, 0x44, 0x84, 0x40, 0x33, 0x2c,
-  0x84, 0x09, 0x4c, 0xc3, 0xe5, 0x3b, 0x8f, 0xbf, 0x38, 0xc0, 0x20, 0x36,
-  0x0f, 0x35, 0xf9, 0xc5, 0x6d, 0xdb, 0x40, 0x35, 0x5c, 0xbe, 0xf3, 0xf8,
-  0xd2, 0xe4, 0x44, 0x04, 0x4a, 0x4d, 0x0f, 0x35, 0xf9, 0xc5, 0x6d, 0x5b,
-  0x81, 0x34, 0x5c, 0xbe, 0xf3, 0xf8, 0x13, 0x11, 0x4d, 0x08, 0x10, 0x61,
-  0x7e, 0x71, 0xdb, 0x16, 0x40, 0x30, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x48, 0x41, 0x53, 0x48, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xa8, 0x66, 0x35, 0xa4, 0x6b, 0xb5, 0x78, 0x6e, 0xbd, 0x8c,
-  0xa7, 0x9e, 0x7c, 0xe9, 0x71, 0x29, 0x44, 0x58, 0x49, 0x4c, 0xb4, 0x07,
-  0x00, 0x00, 0x60, 0x00, 0x01, 0x00, 0xed, 0x01, 0x00, 0x00, 0x44, 0x58,
-  0x49, 0x4c, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x9c, 0x07,
-  0x00, 0x00, 0x42, 0x43, 0xc0, 0xde, 0x21, 0x0c, 0x00, 0x00, 0xe4, 0x01,
-  0x00, 0x00, 0x0b, 0x82, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00,
-  0x00, 0x00, 0x07, 0x81, 0x23, 0x91, 0x41, 0xc8, 0x04, 0x49, 0x06, 0x10,
-  0x32, 0x39, 0x92, 0x01, 0x84, 0x0c, 0x25, 0x05, 0x08, 0x19, 0x1e, 0x04,
-  0x8b, 0x62, 0x80, 0x14, 0x45, 0x02, 0x42, 0x92, 0x0b, 0x42, 0xa4, 0x10,
-  0x32, 0x14, 0x38, 0x08, 0x18, 0x4b, 0x0a, 0x32, 0x52, 0x88, 0x48, 0x90,
-  0x14, 0x20, 0x43, 0x46, 0x88, 0xa5, 0x00, 0x19, 0x32, 0x42, 0xe4, 0x48,
-  0x0e, 0x90, 0x91, 0x22, 0xc4, 0x50, 0x41, 0x51, 0x81, 0x8c, 0xe1, 0x83,
-  0xe5, 0x8a, 0x04, 0x29, 0x46, 0x06, 0x51, 0x18, 0x00, 0x00, 0x08, 0x00,
-  0x00, 0x00, 0x1b, 0x8c, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x40, 0x02,
-  0xa8, 0x0d, 0x84, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x03, 0x20, 0x6d, 0x30,
-  0x86, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x09, 0xa8, 0x00, 0x49, 0x18,
-  0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x82, 0x60, 0x42, 0x20, 0x4c,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x00, 0x89, 0x20, 0x00, 0x00, 0x30, 0x00,
-  0x00, 0x00, 0x32, 0x22, 0x48, 0x09, 0x20, 0x64, 0x85, 0x04, 0x93, 0x22,
-  0xa4, 0x84, 0x04, 0x93, 0x22, 0xe3, 0x84, 0xa1, 0x90, 0x14, 0x12, 0x4c,
-  0x8a, 0x8c, 0x0b, 0x84, 0xa4, 0x4c, 0x10, 0x70, 0x23, 0x00, 0x25, 0x00,
-  0x14, 0x66, 0x00, 0xe6, 0x08, 0xc0, 0x60, 0x8e, 0x00, 0x29, 0xc6, 0x20,
-  0x84, 0x14, 0x42, 0xa6, 0x18, 0x80, 0x10, 0x52, 0x06, 0xa1, 0xa3, 0x86,
-  0xcb, 0x9f, 0xb0, 0x87, 0x90, 0x7c, 0x6e, 0xa3, 0x8a, 0x95, 0x98, 0xfc,
-  0xe2, 0xb6, 0x11, 0x31, 0xc6, 0x18, 0x54, 0xee, 0x19, 0x2e, 0x7f, 0xc2,
-  0x1e, 0x42, 0xf2, 0x43, 0xa0, 0x19, 0x16, 0x02, 0x05, 0xab, 0x10, 0x8a,
-  0x30, 0x42, 0xad, 0x14, 0x83, 0x8c, 0x31, 0xe8, 0xcd, 0x11, 0x04, 0xc5,
-  0x60, 0xa4, 0x10, 0x12, 0x49, 0x0e, 0x04, 0x0c, 0x23, 0x10, 0x43, 0x12,
-  0xd4, 0x61, 0x84, 0x61, 0xb8, 0x30, 0x18, 0x2e, 0x1f, 0x58, 0x10, 0xa3,
-  0x61, 0x88, 0x66, 0xf2, 0x17, 0xc2, 0x00, 0x04, 0xcc, 0x97, 0xa6, 0x88,
-  0x12, 0x26, 0x9f, 0x03, 0x18, 0x22, 0x02, 0x90, 0x63, 0xad, 0xb5, 0x77,
-  0x8c, 0x31, 0xc6, 0x18, 0x63, 0x1c, 0x18, 0x0c, 0x97, 0x0f, 0x2c, 0x88,
-  0xd1, 0x30, 0x44, 0x33, 0xf9, 0x0b, 0x61, 0x00, 0x02, 0xe6, 0x0b, 0x00,
-  0x43, 0x44, 0xc0, 0x46, 0x15, 0x05, 0x11, 0xa1, 0x00, 0x53, 0xce, 0x02,
-  0x02, 0x00, 0x13, 0x14, 0x72, 0xc0, 0x87, 0x74, 0x60, 0x87, 0x36, 0x68,
-  0x87, 0x79, 0x68, 0x03, 0x72, 0xc0, 0x87, 0x0d, 0xaf, 0x50, 0x0e, 0x6d,
-  0xd0, 0x0e, 0x7a, 0x50, 0x0e, 0x6d, 0x00, 0x0f, 0x7a, 0x30, 0x07, 0x72,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x71, 0xa0, 0x07, 0x73,
-  0x20, 0x07, 0x6d, 0x90, 0x0e, 0x78, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d,
-  0x90, 0x0e, 0x71, 0x60, 0x07, 0x7a, 0x30, 0x07, 0x72, 0xd0, 0x06, 0xe9,
-  0x30, 0x07, 0x72, 0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x90, 0x0e, 0x76,
-  0x40, 0x07, 0x7a, 0x60, 0x07, 0x74, 0xd0, 0x06, 0xe6, 0x10, 0x07, 0x76,
-  0xa0, 0x07, 0x73, 0x20, 0x07, 0x6d, 0x60, 0x0e, 0x73, 0x20, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xd0, 0x06, 0xe6, 0x60, 0x07, 0x74, 0xa0, 0x07, 0x76,
-  0x40, 0x07, 0x6d, 0xe0, 0x0e, 0x78, 0xa0, 0x07, 0x71, 0x60, 0x07, 0x7a,
-  0x30, 0x07, 0x72, 0xa0, 0x07, 0x76, 0x40, 0x07, 0x43, 0x9e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x3c, 0x06,
-  0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x79,
-  0x10, 0x20, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0xf2, 0x34, 0x40, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0xe4, 0x79, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0xc8, 0x23, 0x01, 0x01, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x40, 0x16, 0x08, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x32, 0x1e,
-  0x98, 0x14, 0x19, 0x11, 0x4c, 0x90, 0x8c, 0x09, 0x26, 0x47, 0xc6, 0x04,
-  0x43, 0x22, 0x25, 0x30, 0x02, 0x50, 0x0c, 0x05, 0x4e, 0x50, 0x06, 0xe5,
-  0x50, 0x1e, 0x54, 0x4a, 0x62, 0x04, 0xa0, 0x0c, 0x0a, 0xa1, 0x08, 0x48,
-  0xcf, 0x00, 0xd0, 0x1e, 0xab, 0x18, 0x8e, 0xef, 0x15, 0xde, 0x00, 0x00,
-  0x00, 0x00, 0x79, 0x18, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x1a, 0x03,
-  0x4c, 0x90, 0x46, 0x02, 0x13, 0x44, 0x35, 0x18, 0x63, 0x0b, 0x73, 0x3b,
-  0x03, 0xb1, 0x2b, 0x93, 0x9b, 0x4b, 0x7b, 0x73, 0x03, 0x99, 0x71, 0xb9,
-  0x01, 0x41, 0xa1, 0x0b, 0x3b, 0x9b, 0x7b, 0x91, 0x2a, 0x62, 0x2a, 0x0a,
-  0x9a, 0x2a, 0xfa, 0x9a, 0xb9, 0x81, 0x79, 0x31, 0x4b, 0x73, 0x0b, 0x63,
-  0x4b, 0xd9, 0x10, 0x04, 0x13, 0x04, 0xc2, 0x98, 0x20, 0x10, 0xc7, 0x06,
-  0x61, 0x20, 0x26, 0x08, 0x04, 0xb2, 0x41, 0x18, 0x0c, 0x0a, 0x76, 0x73,
-  0x1b, 0x06, 0xc4, 0x20, 0x26, 0x08, 0x9a, 0x44, 0x60, 0x82, 0x40, 0x24,
-  0x1b, 0x10, 0x42, 0x59, 0x08, 0x62, 0x60, 0x80, 0x0d, 0x41, 0xb3, 0x81,
-  0x00, 0x00, 0x07, 0x98, 0x20, 0x6c, 0xd3, 0x86, 0x00, 0x9a, 0x20, 0x08,
-  0x00, 0x89, 0xb6, 0xb0, 0x34, 0x37, 0x22, 0x50, 0x4f, 0x53, 0x49, 0x54,
-  0x49, 0x4f, 0x4e, 0x13, 0x84, 0xa2, 0x99, 0x20, 0x14, 0xce, 0x86, 0x80,
-  0x98, 0x20, 0x14, 0xcf, 0x04, 0x81, 0x50, 0x26, 0x08, 0xc4, 0xb2, 0x41,
-  0xc8, 0xb4, 0x0d, 0x0b, 0x41, 0x55, 0xd6, 0x65, 0x0d, 0x18, 0x61, 0x6d,
-  0x1b, 0x02, 0x8e, 0xcb, 0x94, 0xd5, 0x17, 0xd4, 0xdb, 0x5c, 0x1a, 0x5d,
-  0xda, 0x9b, 0xdb, 0x04, 0xa1, 0x80, 0x26, 0x08, 0x04, 0xb3, 0x41, 0xc8,
-  0xc0, 0x60, 0xc3, 0x42, 0x78, 0x15, 0x76, 0x7d, 0xc3, 0x47, 0x58, 0x61,
-  0x40, 0x84, 0xaa, 0x08, 0x6b, 0xe8, 0xe9, 0x49, 0x8a, 0x68, 0x82, 0x50,
-  0x44, 0x1b, 0x96, 0x61, 0x0c, 0x2a, 0xeb, 0x22, 0x83, 0x01, 0x1b, 0xac,
-  0x6d, 0x83, 0x20, 0x06, 0x65, 0xb0, 0x61, 0xe8, 0xcc, 0x00, 0xd8, 0x50,
-  0x48, 0xd3, 0x19, 0x3c, 0x40, 0x15, 0x36, 0x36, 0xbb, 0x36, 0x97, 0x34,
-  0xb2, 0x32, 0x37, 0xba, 0x29, 0x41, 0x50, 0x85, 0x0c, 0xcf, 0xc5, 0xae,
-  0x4c, 0x6e, 0x2e, 0xed, 0xcd, 0x6d, 0x4a, 0x40, 0x34, 0x21, 0xc3, 0x73,
-  0xb1, 0x0b, 0x63, 0xb3, 0x2b, 0x93, 0x9b, 0x12, 0x18, 0x75, 0xc8, 0xf0,
-  0x5c, 0xe6, 0xd0, 0xc2, 0xc8, 0xca, 0xe4, 0x9a, 0xde, 0xc8, 0xca, 0xd8,
-  0xa6, 0x04, 0x48, 0x19, 0x32, 0x3c, 0x17, 0xb9, 0xb2, 0xb9, 0xb7, 0x3a,
-  0xb9, 0xb1, 0xb2, 0xb9, 0x29, 0x81, 0x53, 0x87, 0x0c, 0xcf, 0xc5, 0x2e,
-  0xad, 0xec, 0x2e, 0x89, 0x6c, 0x8a, 0x2e, 0x8c, 0xae, 0x6c, 0x4a, 0x00,
-  0xd5, 0x21, 0xc3, 0x73, 0x29, 0x73, 0xa3, 0x93, 0xcb, 0x83, 0x7a, 0x4b,
-  0x73, 0xa3, 0x9b, 0x9b, 0x12, 0x9c, 0x01, 0x00, 0x00, 0x00, 0x79, 0x18,
-  0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x33, 0x08, 0x80, 0x1c, 0xc4, 0xe1,
-  0x1c, 0x66, 0x14, 0x01, 0x3d, 0x88, 0x43, 0x38, 0x84, 0xc3, 0x8c, 0x42,
-  0x80, 0x07, 0x79, 0x78, 0x07, 0x73, 0x98, 0x71, 0x0c, 0xe6, 0x00, 0x0f,
-  0xed, 0x10, 0x0e, 0xf4, 0x80, 0x0e, 0x33, 0x0c, 0x42, 0x1e, 0xc2, 0xc1,
-  0x1d, 0xce, 0xa1, 0x1c, 0x66, 0x30, 0x05, 0x3d, 0x88, 0x43, 0x38, 0x84,
-  0x83, 0x1b, 0xcc, 0x03, 0x3d, 0xc8, 0x43, 0x3d, 0x8c, 0x03, 0x3d, 0xcc,
-  0x78, 0x8c, 0x74, 0x70, 0x07, 0x7b, 0x08, 0x07, 0x79, 0x48, 0x87, 0x70,
-  0x70, 0x07, 0x7a, 0x70, 0x03, 0x76, 0x78, 0x87, 0x70, 0x20, 0x87, 0x19,
-  0xcc, 0x11, 0x0e, 0xec, 0x90, 0x0e, 0xe1, 0x30, 0x0f, 0x6e, 0x30, 0x0f,
-  0xe3, 0xf0, 0x0e, 0xf0, 0x50, 0x0e, 0x33, 0x10, 0xc4, 0x1d, 0xde, 0x21,
-  0x1c, 0xd8, 0x21, 0x1d, 0xc2, 0x61, 0x1e, 0x66, 0x30, 0x89, 0x3b, 0xbc,
-  0x83, 0x3b, 0xd0, 0x43, 0x39, 0xb4, 0x03, 0x3c, 0xbc, 0x83, 0x3c, 0x84,
-  0x03, 0x3b, 0xcc, 0xf0, 0x14, 0x76, 0x60, 0x07, 0x7b, 0x68, 0x07, 0x37,
-  0x68, 0x87, 0x72, 0x68, 0x07, 0x37, 0x80, 0x87, 0x70, 0x90, 0x87, 0x70,
-  0x60, 0x07, 0x76, 0x28, 0x07, 0x76, 0xf8, 0x05, 0x76, 0x78, 0x87, 0x77,
-  0x80, 0x87, 0x5f, 0x08, 0x87, 0x71, 0x18, 0x87, 0x72, 0x98, 0x87, 0x79,
-  0x98, 0x81, 0x2c, 0xee, 0xf0, 0x0e, 0xee, 0xe0, 0x0e, 0xf5, 0xc0, 0x0e,
-  0xec, 0x30, 0x03, 0x62, 0xc8, 0xa1, 0x1c, 0xe4, 0xa1, 0x1c, 0xcc, 0xa1,
-  0x1c, 0xe4, 0xa1, 0x1c, 0xdc, 0x61, 0x1c, 0xca, 0x21, 0x1c, 0xc4, 0x81,
-  0x1d, 0xca, 0x61, 0x06, 0xd6, 0x90, 0x43, 0x39, 0xc8, 0x43, 0x39, 0x98,
-  0x43, 0x39, 0xc8, 0x43, 0x39, 0xb8, 0xc3, 0x38, 0x94, 0x43, 0x38, 0x88,
-  0x03, 0x3b, 0x94, 0xc3, 0x2f, 0xbc, 0x83, 0x3c, 0xfc, 0x82, 0x3b, 0xd4,
-  0x03, 0x3b, 0xb0, 0xc3, 0x0c, 0xc4, 0x21, 0x07, 0x7c, 0x70, 0x03, 0x7a,
-  0x28, 0x87, 0x76, 0x80, 0x87, 0x19, 0xd1, 0x43, 0x0e, 0xf8, 0xe0, 0x06,
-  0xe4, 0x20, 0x0e, 0xe7, 0xe0, 0x06, 0xf6, 0x10, 0x0e, 0xf2, 0xc0, 0x0e,
-  0xe1, 0x90, 0x0f, 0xef, 0x50, 0x0f, 0xf4, 0x00, 0x00, 0x00, 0x71, 0x20,
-  0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0xb0, 0x0d, 0x97, 0xef, 0x3c,
-  0xbe, 0x10, 0x50, 0x45, 0x41, 0x44, 0xa5, 0x03, 0x0c, 0x25, 0x61, 0x00,
-  0x02, 0xe6, 0x17, 0xb7, 0x6d, 0x05, 0xd2, 0x70, 0xf9, 0xce, 0xe3, 0x0b,
-  0x11, 0x01, 0x4c, 0x44, 0x08, 0x34, 0xc3, 0x42, 0x58, 0xc0, 0x34, 0x5c,
-  0xbe, 0xf3, 0xf8, 0x8b, 0x03, 0x0c, 0x62, 0xf3, 0x50, 0x93, 0x5f, 0xdc,
-  0xb6, 0x09, 0x54, 0xc3, 0xe5, 0x3b, 0x8f, 0x2f, 0x4d, 0x4e, 0x44, 0xa0,
-  0xd4, 0xf4, 0x50, 0x93, 0x5f, 0xdc, 0xb6, 0x11, 0x48, 0xc3, 0xe5, 0x3b,
-  0x8f, 0x3f, 0x11, 0xd1, 0x84, 0x00, 0x11, 0xe6, 0x17, 0xb7, 0x6d, 0x00,
-  0x04, 0x03, 0x20, 0x0d, 0x00, 0x00, 0x61, 0x20, 0x00, 0x00, 0x84, 0x00,
-  0x00, 0x00, 0x13, 0x04, 0x41, 0x2c, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00,
-  0x00, 0x00, 0x44, 0x8a, 0xab, 0x14, 0xca, 0xae, 0x10, 0x66, 0x00, 0x4a,
-  0xae, 0x08, 0xa8, 0x94, 0x00, 0xc5, 0x11, 0x00, 0x00, 0x00, 0x23, 0x06,
-  0x09, 0x00, 0x82, 0x60, 0x20, 0x61, 0x04, 0x63, 0x59, 0xc1, 0x88, 0x41,
-  0x02, 0x80, 0x20, 0x18, 0x18, 0xdd, 0x71, 0x5d, 0x90, 0x31, 0x62, 0x90,
-  0x00, 0x20, 0x08, 0x06, 0x86, 0x87, 0x60, 0x18, 0x71, 0x8c, 0x18, 0x24,
-  0x00, 0x08, 0x82, 0x81, 0xf1, 0x25, 0x59, 0xf6, 0x20, 0x23, 0x06, 0x07,
-  0x00, 0x82, 0x60, 0xd0, 0x78, 0x0b, 0xa1, 0x8d, 0x26, 0x04, 0xc0, 0x68,
-  0x82, 0x10, 0x8c, 0x26, 0x0c, 0xc2, 0x88, 0xc1, 0x01, 0x80, 0x20, 0x18,
-  0x34, 0x62, 0xf0, 0x20, 0xdf, 0x68, 0x42, 0x00, 0x8c, 0x26, 0x08, 0xc1,
-  0x68, 0xc2, 0x20, 0x8c, 0x18, 0x1c, 0x00, 0x08, 0x82, 0x41, 0x63, 0x06,
-  0x13, 0xf3, 0x8c, 0x26, 0x04, 0xc0, 0x68, 0x82, 0x10, 0x8c, 0x26, 0x0c,
-  0x82, 0x2d, 0x8f, 0x7c, 0x46, 0x0c, 0x10, 0x00, 0x04, 0xc1, 0xe0, 0x51,
-  0x03, 0x0d, 0x79, 0x82, 0x11, 0x03, 0x04, 0x00, 0x41, 0x30, 0x78, 0xd6,
-  0x60, 0x2b, 0x9e, 0xc0, 0x1a, 0x49, 0x3e, 0x23, 0x06, 0x08, 0x00, 0x82,
-  0x60, 0xf0, 0xb4, 0x41, 0xa7, 0x48, 0xc1, 0x88, 0x01, 0x02, 0x80, 0x20,
-  0x18, 0x3c, 0x6e, 0xe0, 0x1d, 0x52, 0x60, 0x4f, 0x25, 0x9f, 0x11, 0x03,
-  0x04, 0x00, 0x41, 0x30, 0x78, 0xe0, 0x00, 0x0c, 0x98, 0x2a, 0x18, 0x31,
-  0x40, 0x00, 0x10, 0x04, 0x83, 0x27, 0x0e, 0xc2, 0x20, 0xa9, 0x82, 0x11,
-  0x83, 0x03, 0x00, 0x41, 0x30, 0x68, 0xe6, 0x00, 0x0c, 0xb2, 0x6f, 0x34,
-  0x21, 0x00, 0x46, 0x13, 0x84, 0x60, 0x34, 0x61, 0x18, 0x46, 0x0c, 0x0e,
-  0x00, 0x04, 0xc1, 0xa0, 0xb9, 0x03, 0x32, 0xe8, 0xca, 0x60, 0x34, 0x21,
-  0x00, 0x46, 0x13, 0x84, 0x60, 0x34, 0x61, 0x18, 0x46, 0x0c, 0x0e, 0x00,
-  0x04, 0xc1, 0xa0, 0xd9, 0x03, 0x34, 0x08, 0x03, 0x3b, 0x18, 0x4d, 0x08,
-  0x80, 0xd1, 0x04, 0x21, 0x18, 0x4d, 0x18, 0x86, 0x11, 0x83, 0x03, 0x00,
-  0x41, 0x30, 0x68, 0xfe, 0x80, 0x0d, 0xca, 0xe0, 0x0e, 0x46, 0x13, 0x02,
-  0x60, 0x34, 0x41, 0x08, 0x46, 0x13, 0x86, 0xc1, 0x9e, 0x4b, 0x3e, 0x23,
-  0x06, 0x08, 0x00, 0x82, 0x60, 0xf0, 0x8c, 0xc2, 0x1c, 0x30, 0x55, 0x30,
-  0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0x0f, 0x29, 0xd0, 0x41, 0x32, 0x05,
-  0x16, 0x18, 0xd0, 0x31, 0x69, 0x93, 0xcf, 0x88, 0x01, 0x02, 0x80, 0x20,
-  0x18, 0x3c, 0xa7, 0x70, 0x07, 0x4f, 0x16, 0x8c, 0x18, 0x20, 0x00, 0x08,
-  0x82, 0xc1, 0x83, 0x0a, 0x78, 0xc0, 0x5c, 0x81, 0x05, 0x09, 0x74, 0xac,
-  0xfa, 0xe4, 0x33, 0x62, 0x80, 0x00, 0x20, 0x08, 0x06, 0xcf, 0x2a, 0xec,
-  0x81, 0xd4, 0x05, 0x23, 0x06, 0x08, 0x00, 0x82, 0x60, 0xf0, 0xb0, 0x02,
-  0x1f, 0x3c, 0x5b, 0x60, 0x01, 0x03, 0x9d, 0x11, 0x83, 0x04, 0x00, 0x41,
-  0x30, 0x40, 0x60, 0xa1, 0x0f, 0x56, 0x61, 0x15, 0x48, 0x21, 0x19, 0x31,
-  0x48, 0x00, 0x10, 0x04, 0x03, 0x04, 0x16, 0xfa, 0x60, 0x15, 0x56, 0xe1,
-  0x0e, 0x8a, 0x11, 0x83, 0x04, 0x00, 0x41, 0x30, 0x40, 0x60, 0xa1, 0x0f,
-  0x56, 0x61, 0x15, 0x42, 0x21, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03,
-  0x04, 0x16, 0xfa, 0x60, 0x15, 0x56, 0x61, 0x14, 0x82, 0x11, 0x83, 0x04,
-  0x00, 0x41, 0x30, 0x40, 0x60, 0xa1, 0x0f, 0x58, 0x61, 0x15, 0x48, 0x81,
-  0x0e, 0x46, 0x0c, 0x12, 0x00, 0x04, 0xc1, 0x00, 0x81, 0x85, 0x3e, 0x60,
-  0x85, 0x55, 0xb8, 0x03, 0x39, 0x18, 0x31, 0x48, 0x00, 0x10, 0x04, 0x03,
-  0x04, 0x16, 0xfa, 0x80, 0x15, 0x56, 0x21, 0x14, 0xe6, 0x00, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
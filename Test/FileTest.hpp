@@ -0,0 +1,108 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#pragma comment(lib, "psapi.lib")
+
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <fcntl.h>
+#include <fstream>
+#include <unistd.h>
+#endif
+
+#include "FilePool.hpp"
+
+enum class FILE_LOAD {
+	THREAD, // readFile on the thread pool
+	RING, // readFile through io_uring
+	MAP // mapFile
+};
+
+// Every file of the res tree
+std::vector<std::string> getBenchmarkFiles() {
+	std::vector<std::string> fileNames;
+	for(const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator("../res"))
+		if(entry.is_regular_file()) fileNames.push_back(entry.path().string());
+
+	return fileNames;
+}
+
+uint64_t getWorkingSetSize() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters{};
+	GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+	return counters.WorkingSetSize;
+#else
+	uint64_t size = 0, resident = 0;
+	std::ifstream statm("/proc/self/statm");
+	statm >> size >> resident;
+	return resident * sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// Drops the files from the file cache so the next load reads from the disk
+void evictFileCache(const std::vector<std::string>& fileNames) {
+#ifdef _WIN32
+	// There is no unprivileged way to do this, so only the first load after a reboot is cold
+#else
+	for(const std::string& fileName : fileNames) {
+		int file = open(fileName.c_str(), O_RDONLY);
+		if(file == -1) continue;
+
+		posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+		close(file);
+	}
+#endif
+}
+
+void benchmarkFilePool(const std::vector<std::string>& fileNames, FILE_LOAD load, bool cold) {
+	FilePool filePool(load == FILE_LOAD::RING);
+	if(load == FILE_LOAD::RING && !filePool.usingRing()) {
+		std::cout << "io_uring is not supported" << std::endl;
+		return;
+	}
+
+	std::vector<FilePool::File> files(fileNames.size());
+
+	if(cold) evictFileCache(fileNames);
+
+	uint64_t startWorkingSet = getWorkingSetSize();
+	auto start = std::chrono::steady_clock::now();
+
+	for(size_t i = 0; i < fileNames.size(); ++i) {
+		if(load == FILE_LOAD::MAP) filePool.mapFile(fileNames[i].c_str(), files[i]);
+		else filePool.readFile(fileNames[i].c_str(), files[i]);
+	}
+	filePool.wait();
+
+	std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	uint64_t workingSet = getWorkingSetSize() - startWorkingSet;
+
+	uint64_t size = 0;
+	for(const FilePool::File& file : files)
+		size += file.size();
+
+	const char* names[]{ "thread", "ring", "map" };
+	std::cout << names[(uint32_t)load] << (cold ? " cold: " : " warm: ") << elapsed.count() << " ms, ";
+	std::cout << size / 1024 << " KiB of files, ";
+	std::cout << workingSet / 1024 << " KiB working set, ";
+	std::cout << filePool.getCopiedBytes() / 1024 << " KiB copied" << std::endl;
+}
+
+void testFilePool() {
+	std::vector<std::string> fileNames = getBenchmarkFiles();
+	std::cout << fileNames.size() << " files" << std::endl;
+
+	for(FILE_LOAD load : { FILE_LOAD::THREAD, FILE_LOAD::RING, FILE_LOAD::MAP }) {
+		// Expected every byte copied by thread and ring, no bytes copied by map
+		benchmarkFilePool(fileNames, load, true);
+		benchmarkFilePool(fileNames, load, false);
+	}
+}
\ No newline at end of file
@@ -18,6 +18,7 @@ Your wndProc must respond to WM_SIZE and make a call to Renderer::resizeSwapChai
 #include <windowsx.h>
 
 #include <Renderer.hpp>
+#include <Skeleton.hpp>
 
 #include "Timer.hpp"
 #include "Input.hpp"
@@ -25,13 +26,35 @@ Your wndProc must respond to WM_SIZE and make a call to Renderer::resizeSwapChai
 #include "FirstPersonCamera.hpp"
 #include "SceneGraph.hpp"
 #include "FilePool.hpp"
+#include "SceneLoader.hpp"
 
 //#define TEST_ALLOC
 //#define TEST_POOL
+//#define TEST_UPLOAD
+//#define TEST_FILE
+//#define TEST_PACK
+//#define TEST_MESH
+//#define TEST_SKELETON
+//#define TEST_TEXTURE
+//#define TEST_SCENE
 #ifdef TEST_ALLOC
 #include "AllocationTest.hpp"
 #elif defined(TEST_POOL)
 #include "PoolTest.hpp"
+#elif defined(TEST_UPLOAD)
+#include "UploadTest.hpp"
+#elif defined(TEST_FILE)
+#include "FileTest.hpp"
+#elif defined(TEST_PACK)
+#include "PackTest.hpp"
+#elif defined(TEST_MESH)
+#include "MeshTest.hpp"
+#elif defined(TEST_SKELETON)
+#include "SkeletonTest.hpp"
+#elif defined(TEST_TEXTURE)
+#include "TextureTest.hpp"
+#elif defined(TEST_SCENE)
+#include "SceneTest.hpp"
 #endif
 
 constexpr float CAMERA_FOVY = DirectX::XM_PIDIV2;
@@ -76,6 +99,82 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 	std::cout << "--- Dynamic Pool Specialization ---" << std::endl;
 	testDynamicPoolSpecialization();
 
+	while(true);
+	return 0;
+#elif defined(TEST_UPLOAD)
+	std::cout << "--- Upload Chunker Buffer ---" << std::endl;
+	testUploadChunkerBuffer();
+	std::cout << "--- Upload Chunker Texture ---" << std::endl;
+	testUploadChunkerTexture();
+	std::cout << "--- Upload Coalescer ---" << std::endl;
+	testUploadCoalescer();
+	std::cout << "--- Upload Scheduler ---" << std::endl;
+	testUploadScheduler();
+	std::cout << "--- Texture Streamer ---" << std::endl;
+	testTextureStreamer();
+
+	while(true);
+	return 0;
+#elif defined(TEST_FILE)
+	std::cout << "--- File Pool ---" << std::endl;
+	testFilePool();
+
+	while(true);
+	return 0;
+#elif defined(TEST_PACK)
+	std::cout << "--- Pack ---" << std::endl;
+	testPack();
+
+	while(true);
+	return 0;
+#elif defined(TEST_MESH)
+	std::cout << "--- Vertex Codec ---" << std::endl;
+	testVertexCodec();
+	std::cout << "--- Index Codec ---" << std::endl;
+	testIndexCodec();
+	std::cout << "--- Index Narrowing ---" << std::endl;
+	testIndexNarrowing();
+	std::cout << "--- Vertex Quantization ---" << std::endl;
+	testVertexQuantization();
+	std::cout << "--- Bounds ---" << std::endl;
+	testBounds();
+	std::cout << "--- Posed Bounds ---" << std::endl;
+	testPosedBounds();
+	std::cout << "--- Mesh Files ---" << std::endl;
+	testMeshFiles();
+	std::cout << "--- Mesh Optimization ---" << std::endl;
+	testMeshOptimization();
+	std::cout << "--- Mesh Simplification ---" << std::endl;
+	testMeshSimplification();
+	std::cout << "--- Shared LOD Vertices ---" << std::endl;
+	testSharedLODVertices();
+	std::cout << "--- Model Cooking ---" << std::endl;
+	testModelCooking();
+
+	while(true);
+	return 0;
+#elif defined(TEST_SKELETON)
+	std::cout << "--- Skeleton ---" << std::endl;
+	testSkeleton();
+
+	while(true);
+	return 0;
+#elif defined(TEST_TEXTURE)
+	std::cout << "--- Texture Parsing ---" << std::endl;
+	testTextureParsing();
+	std::cout << "--- Texture Files ---" << std::endl;
+	testTextureFiles();
+	std::cout << "--- Block Compression ---" << std::endl;
+	testBlockCompression();
+	std::cout << "--- Block Compression Throughput ---" << std::endl;
+	testBlockCompressionThroughput();
+
+	while(true);
+	return 0;
+#elif defined(TEST_SCENE)
+	std::cout << "--- Scene Files ---" << std::endl;
+	testSceneFiles();
+
 	while(true);
 	return 0;
 #endif
@@ -120,15 +219,19 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 	config.engine = RIN::RENDER_ENGINE::D3D12;
 	config.uploadStreamSize = 32000000;
 	config.staticVertexCount = 10000000;
+	config.quantizeStaticVertices = true;
 	config.staticIndexCount = 10000000;
+	config.staticIndex16Count = 10000000;
 	config.staticMeshCount = 128;
 	config.staticObjectCount = 128;
 	config.dynamicVertexCount = 1000000;
 	config.dynamicIndexCount = 1000000;
+	config.dynamicIndex16Count = 1000000;
 	config.dynamicMeshCount = 128;
 	config.dynamicObjectCount = 128;
 	config.skinnedVertexCount = 1000000;
 	config.skinnedIndexCount = 1000000;
+	config.skinnedIndex16Count = 1000000;
 	config.skinnedMeshCount = 128;
 	config.skinnedObjectCount = 128;
 	config.boneCount = 250;
@@ -156,174 +259,19 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 	FilePool filePool;
 
 	// Working directory is RIN/Test/
-	// Note that we skip reading the dds file header for simplicity
-
-	// Read environment texture files
-	FilePool::File environmentFiles[3];
-	filePool.readFile("../res/environments/panorama map/skybox.dds", environmentFiles[0]);
-	filePool.readFile("../res/environments/panorama map/diffuseIBL.dds", environmentFiles[1]);
-	filePool.readFile("../res/environments/panorama map/specularIBL.dds", environmentFiles[2]);
-	
-	uint32_t environmentMipCounts[]{ 1, 1, (uint32_t)-1 };
-	RIN::Texture* environmentTextures[3]{};
-	bool skyboxSet = false;
-
-	// Read material texture files
-	RIN::TEXTURE_FORMAT textureFormats0[]{
-		RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB,
-		RIN::TEXTURE_FORMAT::BC5_UNORM,
-		RIN::TEXTURE_FORMAT::BC5_UNORM,
-		RIN::TEXTURE_FORMAT::BC4_UNORM,
-		RIN::TEXTURE_FORMAT::BC4_UNORM,
-		RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB
-	};
-
-	RIN::TEXTURE_FORMAT textureFormats1[]{
-		RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB,
-		RIN::TEXTURE_FORMAT::BC5_UNORM,
-		RIN::TEXTURE_FORMAT::BC5_UNORM,
-		RIN::TEXTURE_FORMAT::BC4_UNORM,
-		RIN::TEXTURE_FORMAT::BC4_UNORM,
-		RIN::TEXTURE_FORMAT::BC7_UNORM
-	};
-
-	RIN::TEXTURE_FORMAT* textureFormats[]{
-		textureFormats0,
-		textureFormats0,
-		textureFormats0,
-		textureFormats1,
-		textureFormats0,
-	};
-
-	FilePool::File textureFiles[5][6];
-	filePool.readFile("../res/materials/dirt/basecolor.dds", textureFiles[0][0]);
-	filePool.readFile("../res/materials/dirt/normal.dds", textureFiles[0][1]);
-	filePool.readFile("../res/materials/dirt/roughnessao.dds", textureFiles[0][2]);
-	filePool.readFile("../res/materials/dirt/height.dds", textureFiles[0][4]);
-	filePool.readFile("../res/materials/metal/basecolor.dds", textureFiles[1][0]);
-	filePool.readFile("../res/materials/metal/normal.dds", textureFiles[1][1]);
-	filePool.readFile("../res/materials/metal/roughnessao.dds", textureFiles[1][2]);
-	filePool.readFile("../res/materials/metal/height.dds", textureFiles[1][4]);
-	filePool.readFile("../res/materials/lava/basecolor.dds", textureFiles[2][0]);
-	filePool.readFile("../res/materials/lava/normal.dds", textureFiles[2][1]);
-	filePool.readFile("../res/materials/lava/roughnessao.dds", textureFiles[2][2]);
-	filePool.readFile("../res/materials/lava/height.dds", textureFiles[2][4]);
-	filePool.readFile("../res/materials/lava/emissive.dds", textureFiles[2][5]);
-	filePool.readFile("../res/materials/wood/basecolor.dds", textureFiles[3][0]);
-	filePool.readFile("../res/materials/wood/normal.dds", textureFiles[3][1]);
-	filePool.readFile("../res/materials/wood/roughnessao.dds", textureFiles[3][2]);
-	filePool.readFile("../res/materials/wood/metallic.dds", textureFiles[3][3]);
-	filePool.readFile("../res/materials/wood/height.dds", textureFiles[3][4]);
-	filePool.readFile("../res/materials/wood/clearcoat.dds", textureFiles[3][5]);
-	filePool.readFile("../res/materials/blanket/basecolor.dds", textureFiles[4][0]);
-	filePool.readFile("../res/materials/blanket/normal.dds", textureFiles[4][1]);
-	filePool.readFile("../res/materials/blanket/roughnessao.dds", textureFiles[4][2]);
-	filePool.readFile("../res/materials/blanket/height.dds", textureFiles[4][4]);
-
-	RIN::Texture* textures[5][6]{};
-	constexpr char black[]{ 0 };
-	constexpr char white[]{ (char)0xFF };
-	constexpr char sheen[]{ (char)0xC0, (char)0xC0, (char)0xE0, 0 };
-	textures[0][3] = renderer->addTexture(RIN::TEXTURE_TYPE::TEXTURE_2D, RIN::TEXTURE_FORMAT::R8_UNORM, 1, 1, 1, black);
-	textures[1][3] = renderer->addTexture(RIN::TEXTURE_TYPE::TEXTURE_2D, RIN::TEXTURE_FORMAT::R8_UNORM, 1, 1, 1, white);
-	textures[2][3] = renderer->addTexture(RIN::TEXTURE_TYPE::TEXTURE_2D, RIN::TEXTURE_FORMAT::R8_UNORM, 1, 1, 1, black);
-	textures[4][5] = renderer->addTexture(RIN::TEXTURE_TYPE::TEXTURE_2D, RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB, 1, 1, 1, sheen);
-
-	RIN::MATERIAL_TYPE materialTypes[]{
-		RIN::MATERIAL_TYPE::PBR_STANDARD,
-		RIN::MATERIAL_TYPE::PBR_STANDARD,
-		RIN::MATERIAL_TYPE::PBR_EMISSIVE,
-		RIN::MATERIAL_TYPE::PBR_CLEAR_COAT,
-		RIN::MATERIAL_TYPE::PBR_SHEEN
-	};
-	RIN::Material* materials[5]{};
-
-	// Read mesh files
-	FilePool::File staticFiles[13];
-	filePool.readFile("../res/meshes/Cube.smesh", staticFiles[0]);
-	filePool.readFile("../res/meshes/Cylinder.smesh", staticFiles[1]);
-	filePool.readFile("../res/meshes/Plane.smesh", staticFiles[2]);
-	filePool.readFile("../res/meshes/Sphere0.smesh", staticFiles[3]);
-	filePool.readFile("../res/meshes/Sphere1.smesh", staticFiles[4]);
-	filePool.readFile("../res/meshes/Sphere2.smesh", staticFiles[5]);
-	filePool.readFile("../res/meshes/Sphere3.smesh", staticFiles[6]);
-	filePool.readFile("../res/meshes/Sphere4.smesh", staticFiles[7]);
-	filePool.readFile("../res/meshes/Sphere5.smesh", staticFiles[8]);
-	filePool.readFile("../res/meshes/Torus0.smesh", staticFiles[9]);
-	filePool.readFile("../res/meshes/Torus1.smesh", staticFiles[10]);
-	filePool.readFile("../res/meshes/Torus2.smesh", staticFiles[11]);
-	filePool.readFile("../res/meshes/Cone.smesh", staticFiles[12]);
-
-	RIN::StaticMesh* staticMeshes[13]{};
-	
-	uint32_t staticObjectMaterials[]{ 3, 1, 0, 0, 1, 3, 4, 2, 3, 1, 0, 4, 2 };
-	RIN::StaticObject* staticObjects[13]{};
-
-	FilePool::File dynamicFiles[2];
-	filePool.readFile("../res/meshes/Monster.dmesh", dynamicFiles[0]);
-	filePool.readFile("../res/meshes/Torus0.dmesh", dynamicFiles[1]);
-
-	RIN::DynamicMesh* dynamicMeshes[2]{};
-
-	uint32_t dynamicObjectMeshes[]{ 0, 1, 0 };
-	uint32_t dynamicObjectMaterials[]{ 2, 1, 4 };
-	RIN::DynamicObject* dynamicObjects[3]{};
+	// Every read of the scene is issued at once, the assets are added as soon as what they depend on is
+	SceneLoader sceneLoader;
+	sceneLoader.load(filePool, renderer, "../res/scenes/Test.rscn");
+	bool statsPrinted = false;
 
 	SceneGraph::DynamicObjectNode* dynamicObjectNodes[3]{};
 
-	FilePool::File skinnedFiles[1];
-	filePool.readFile("../res/meshes/Monster.skmesh", skinnedFiles[0]);
-
-	RIN::SkinnedMesh* skinnedMeshes[1]{};
-
-	FilePool::File armatureFiles[1];
-	filePool.readFile("../res/armatures/Armature.arm", armatureFiles[0]);
-
-	RIN::Armature* armatures[1]{};
-
-	SceneGraph::BoneNode** boneNodes[1]{};
-
-	uint32_t skinnedObjectMaterials[]{ 1 };
-	RIN::SkinnedObject* skinnedObjects[1]{};
-
-	// Add lights
-	RIN::Light* lights[8]{};
-	for(uint32_t i = 0; i < _countof(lights); ++i)
-		lights[i] = renderer->addLight();
-
-	lights[0]->position = { 3.0f, 1.0f, 4.0f };
-	lights[0]->radius = 15.0f;
-	lights[0]->color = { 50.0f, 0.0f, 0.0f };
-
-	lights[1]->position = { 3.0f, -1.0f, 4.0f };
-	lights[1]->radius = 15.0f;
-	lights[1]->color = { 0.0f, 0.0f, 50.0f };
-
-	lights[2]->position = { 4.0f, 0.0f, 4.0f };
-	lights[2]->radius = 15.0f;
-	lights[2]->color = { 0.0f, 50.0f, 0.0f };
-
-	lights[3]->position = { 10.0f, 10.0f, 2.0f };
-	lights[3]->radius = 6.0f;
-	lights[3]->color = { 10.0f, 9.0f, 9.5f };
-
-	lights[4]->position = { -35.0f, 35.0f, 5.0f };
-	lights[4]->radius = 30.0f;
-	lights[4]->color = { 100.0f, 100.0f, 0.0f };
-
-	lights[5]->position = { -6.0f, -6.0f, 1.0f };
-	lights[5]->radius = 5.0f;
-	lights[5]->color = { 5.0f, 5.0f, 5.0f };
-
-	lights[6]->radius = 25.0f;
-
-	lights[7]->radius = 25.0f;
+	// Local matrices of the bones of each armature, see RIN::Skeleton
+	std::vector<DirectX::XMMATRIX> boneMatrices[1];
 
+	// Lights 6 and 7 are moved by the scene graph
 	SceneGraph::LightNode* lightNodes[2]{};
 
-	lightNodes[0] = sceneGraph.addNode(SceneGraph::ROOT_NODE, lights[6]);
-	lightNodes[1] = sceneGraph.addNode(SceneGraph::ROOT_NODE, lights[7]);
-
 	renderer->showWindow();
 
 	// Main loop
@@ -345,159 +293,36 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 		// Update everything in the scene for the current frame
 		renderer->update();
 
-		// Upload objects and materials and free buffers
-
-		for(uint32_t i = 0; i < _countof(environmentFiles); ++i) {
-			if(environmentFiles[i].ready()) {
-				if(!environmentTextures[i]) {
-					environmentTextures[i] = renderer->addTexture(RIN::TEXTURE_TYPE::TEXTURE_CUBE, RIN::TEXTURE_FORMAT::R16B16G16A16_FLOAT, 512, 512, environmentMipCounts[i], environmentFiles[i].data() + 148);
-				} else if(environmentTextures[i]->resident())
-					environmentFiles[i].close();
-			}
-		}
-
-		if(!skyboxSet && environmentTextures[0] && environmentTextures[1] && environmentTextures[2]) {
-			renderer->setSkybox(environmentTextures[0], environmentTextures[1], environmentTextures[2]);
-
-			skyboxSet = true;
-		}
-
-		for(uint32_t i = 0; i < _countof(textureFiles); ++i) {
-			for(uint32_t j = 0; j < _countof(textureFiles[i]); ++j) {
-				if(textureFiles[i][j].ready()) {
-					if(!textures[i][j])
-						textures[i][j] = renderer->addTexture(RIN::TEXTURE_TYPE::TEXTURE_2D, textureFormats[i][j], 2048, 2048, -1, textureFiles[i][j].data() + 148);
-					else if(textures[i][j]->resident())
-						textureFiles[i][j].close();
+		// Set the skybox and pick up what the scene loader has added
+		sceneLoader.update();
+
+		if(!statsPrinted && (sceneLoader.failed() || (sceneLoader.done() && sceneLoader.resident()))) {
+			if(sceneLoader.failed()) std::cout << "Invalid scene file" << std::endl;
+			else {
+				const char* assetNames[SCENE_ASSET_COUNT]{ "Textures", "Materials", "Meshes", "Armatures", "Static objects", "Dynamic objects", "Skinned objects" };
+				const SceneLoadStats& stats = sceneLoader.stats();
+				std::cout << "Scene parsed: " << stats.parseSeconds << " s" << std::endl;
+				for(uint32_t i = 0; i < SCENE_ASSET_COUNT; ++i) {
+					std::cout << assetNames[i] << ": " << stats.counts[i] << ", " << stats.failures[i] << " failed, ";
+					std::cout << stats.firstSeconds[i] << " s to " << stats.lastSeconds[i] << " s" << std::endl;
 				}
+				std::cout << "Scene added: " << stats.addedSeconds << " s, resident: " << stats.residentSeconds << " s" << std::endl;
 			}
 
-			if(!materials[i]) {
-				bool ready = true;
-
-				if(materialTypes[i] == RIN::MATERIAL_TYPE::PBR_SHEEN)
-					ready = textures[i][0] && textures[i][1] && textures[i][2] && textures[i][4];
-				else
-					for(uint32_t j = 0; j < 5; ++j)
-						ready = ready && textures[i][j];
-
-				if(materialTypes[i] != RIN::MATERIAL_TYPE::PBR_STANDARD)
-					ready = ready && textures[i][5];
-
-				if(ready)
-					materials[i] = renderer->addMaterial(materialTypes[i], textures[i][0], textures[i][1], textures[i][2], textures[i][3], textures[i][4], textures[i][5]);
-			}
+			statsPrinted = true;
 		}
 
-		for(uint32_t i = 0; i < _countof(staticFiles); ++i) {
-			if(staticFiles[i].ready()) {
-				if(!staticMeshes[i]) {
-					uint8_t lodCount = *(uint8_t*)(staticFiles[i].data() + 1);
-					float* bsphere = (float*)(staticFiles[i].data() + 2);
-					uint32_t* vertexCounts = (uint32_t*)(bsphere + 4);
-					uint32_t* indexCounts = vertexCounts + lodCount;
-
-					uint64_t totalVertexCount = 0;
-					for(uint8_t i = 0; i < lodCount; ++i)
-						totalVertexCount += vertexCounts[i];
-
-					RIN::BoundingSphere boundingSphere(bsphere[0], bsphere[1], bsphere[2], bsphere[3]);
-					RIN::StaticVertex* vertices = (RIN::StaticVertex*)(indexCounts + lodCount);
-					RIN::index_type* indices = (RIN::index_type*)(vertices + totalVertexCount);
-
-					staticMeshes[i] = renderer->addStaticMesh(boundingSphere, vertices, vertexCounts, indices, indexCounts, lodCount);
-				} else if(staticMeshes[i]->resident())
-					staticFiles[i].close();
-			}
-		}
+		for(uint32_t i = 0; i < _countof(dynamicObjectNodes); ++i)
+			if(!dynamicObjectNodes[i] && sceneLoader.getDynamicObject(i))
+				dynamicObjectNodes[i] = sceneGraph.addNode(SceneGraph::ROOT_NODE, sceneLoader.getDynamicObject(i));
 
-		for(uint32_t i = 0; i < _countof(staticObjects); ++i)
-			if(!staticObjects[i])
-				staticObjects[i] = renderer->addStaticObject(staticMeshes[i], materials[staticObjectMaterials[i]]);
-
-		for(uint32_t i = 0; i < _countof(dynamicFiles); ++i) {
-			if(dynamicFiles[i].ready()) {
-				if(!dynamicMeshes[i]) {
-					uint8_t lodCount = *(uint8_t*)(dynamicFiles[i].data() + 1);
-					float* bsphere = (float*)(dynamicFiles[i].data() + 2);
-					uint32_t* vertexCounts = (uint32_t*)(bsphere + 4);
-					uint32_t* indexCounts = vertexCounts + lodCount;
-
-					uint64_t totalVertexCount = 0;
-					for(uint8_t i = 0; i < lodCount; ++i)
-						totalVertexCount += vertexCounts[i];
-
-					RIN::BoundingSphere boundingSphere(bsphere[0], bsphere[1], bsphere[2], bsphere[3]);
-					RIN::DynamicVertex* vertices = (RIN::DynamicVertex*)(indexCounts + lodCount);
-					RIN::index_type* indices = (RIN::index_type*)(vertices + totalVertexCount);
-
-					dynamicMeshes[i] = renderer->addDynamicMesh(boundingSphere, vertices, vertexCounts, indices, indexCounts, lodCount);
-				} else if(dynamicMeshes[i]->resident())
-					dynamicFiles[i].close();
-			}
-		}
+		for(uint32_t i = 0; i < _countof(boneMatrices); ++i)
+			if(boneMatrices[i].empty() && sceneLoader.getArmature(i))
+				boneMatrices[i].assign(sceneLoader.getSkeleton(i).getBoneCount(), DirectX::XMMatrixIdentity());
 
-		for(uint32_t i = 0; i < _countof(dynamicObjects); ++i) {
-			if(!dynamicObjects[i]) {
-				dynamicObjects[i] = renderer->addDynamicObject(dynamicMeshes[dynamicObjectMeshes[i]], materials[dynamicObjectMaterials[i]]);
-				if(dynamicObjects[i]) dynamicObjectNodes[i] = sceneGraph.addNode(SceneGraph::ROOT_NODE, dynamicObjects[i]);
-			}
-		}
-
-		for(uint32_t i = 0; i < _countof(skinnedFiles); ++i) {
-			if(skinnedFiles[i].ready()) {
-				if(!skinnedMeshes[i]) {
-					uint8_t lodCount = *(uint8_t*)(skinnedFiles[i].data() + 1);
-					float* bsphere = (float*)(skinnedFiles[i].data() + 2);
-					uint32_t* vertexCounts = (uint32_t*)(bsphere + 4);
-					uint32_t* indexCounts = vertexCounts + lodCount;
-
-					uint64_t totalVertexCount = 0;
-					for(uint8_t i = 0; i < lodCount; ++i)
-						totalVertexCount += vertexCounts[i];
-
-					RIN::BoundingSphere boundingSphere(bsphere[0], bsphere[1], bsphere[2], bsphere[3]);
-					RIN::SkinnedVertex* vertices = (RIN::SkinnedVertex*)(indexCounts + lodCount);
-					RIN::index_type* indices = (RIN::index_type*)(vertices + totalVertexCount);
-
-					skinnedMeshes[i] = renderer->addSkinnedMesh(boundingSphere, vertices, vertexCounts, indices, indexCounts, lodCount);
-				} else if(skinnedMeshes[i]->resident())
-					skinnedFiles[i].close();
-			}
-		}
-
-		for(uint32_t i = 0; i < _countof(armatureFiles); ++i) {
-			if(armatureFiles[i].ready()) {
-				if(!armatures[i]) {
-					uint8_t boneCount = *(uint8_t*)(armatureFiles[i].data());
-
-					armatures[i] = renderer->addArmature(boneCount);
-					
-					if(armatures[i]) {
-						boneNodes[i] = new SceneGraph::BoneNode*[boneCount] {};
-
-						DirectX::XMMATRIX restMatrix = DirectX::XMLoadFloat4x4((DirectX::XMFLOAT4X4*)(armatureFiles[i].data() + 1));
-						boneNodes[i][0] = sceneGraph.addNode(SceneGraph::ROOT_NODE, armatures[i]->bones, restMatrix);
-
-						char* dataStart = (char*)(armatureFiles[i].data() + 1 + sizeof(DirectX::XMFLOAT4X4));
-						for(uint8_t j = 0; j < boneCount - 1; ++j) {
-							uint8_t boneIndex = *(uint8_t*)dataStart;
-							uint8_t parentIndex = *(uint8_t*)(dataStart + 1);
-							restMatrix = DirectX::XMLoadFloat4x4((DirectX::XMFLOAT4X4*)(dataStart + 2));
-
-							boneNodes[i][boneIndex] = sceneGraph.addNode(boneNodes[i][parentIndex], armatures[i]->bones + boneIndex, restMatrix);
-
-							dataStart += sizeof(uint8_t) + sizeof(uint8_t) + sizeof(DirectX::XMFLOAT4X4);
-						}
-					}
-				} else if(armatures[i]->resident())
-					armatureFiles[i].close();
-			}
-		}
-
-		for(uint32_t i = 0; i < _countof(skinnedObjects); ++i)
-			if(!skinnedObjects[i])
-				skinnedObjects[i] = renderer->addSkinnedObject(skinnedMeshes[i], armatures[i], materials[skinnedObjectMaterials[i]]);
+		for(uint32_t i = 0; i < _countof(lightNodes); ++i)
+			if(!lightNodes[i] && sceneLoader.getLight(6 + i))
+				lightNodes[i] = sceneGraph.addNode(SceneGraph::ROOT_NODE, sceneLoader.getLight(6 + i));
 
 		// Update the scene for the next frame
 		float elapsedSeconds = timer.elapsedSeconds();
@@ -516,43 +341,48 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 		if(dynamicObjectNodes[1]) dynamicObjectNodes[1]->setTansform(DirectX::XMMatrixRotationX(DirectX::XM_PIDIV4) * DirectX::XMMatrixRotationZ(scale * DirectX::XM_2PI) * DirectX::XMMatrixTranslation(-4.0f, 8.0f, 2.5f + sinSNorm * 0.5f));
 		if(dynamicObjectNodes[2]) dynamicObjectNodes[2]->setTansform(DirectX::XMMatrixRotationZ(DirectX::XM_PI * 1.15f) * DirectX::XMMatrixTranslation(9.5f, -9.0f, 0.0f));
 
-		if(boneNodes[0]) {
-			// Body
-			if(boneNodes[0][0]) boneNodes[0][0]->setTansform(DirectX::XMMatrixRotationZ(DirectX::XM_PI) * DirectX::XMMatrixTranslation(3.5f, -10.0f, 0.0f));
+		if(!boneMatrices[0].empty()) {
+			DirectX::XMMATRIX* bones = boneMatrices[0].data();
+
 			// Left arm
-			if(boneNodes[0][31]) boneNodes[0][31]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(cosUNorm * DirectX::XM_PIDIV4 - DirectX::XM_PIDIV4 * 0.5f));
-			if(boneNodes[0][32]) boneNodes[0][32]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(cosUNorm * DirectX::XM_PIDIV2 * 0.75f));
+			bones[31] = DirectX::XMMatrixRotationX(cosUNorm * DirectX::XM_PIDIV4 - DirectX::XM_PIDIV4 * 0.5f);
+			bones[32] = DirectX::XMMatrixRotationX(cosUNorm * DirectX::XM_PIDIV2 * 0.75f);
 			// Right arm
-			if(boneNodes[0][10]) boneNodes[0][10]->setBoneSpaceTansform(DirectX::XMMatrixRotationX((1.0f - cosUNorm) * DirectX::XM_PIDIV4 - DirectX::XM_PIDIV4 * 0.5f));
-			if(boneNodes[0][11]) boneNodes[0][11]->setBoneSpaceTansform(DirectX::XMMatrixRotationX((1.0f - cosUNorm) * DirectX::XM_PIDIV2 * 0.75f));
+			bones[10] = DirectX::XMMatrixRotationX((1.0f - cosUNorm) * DirectX::XM_PIDIV4 - DirectX::XM_PIDIV4 * 0.5f);
+			bones[11] = DirectX::XMMatrixRotationX((1.0f - cosUNorm) * DirectX::XM_PIDIV2 * 0.75f);
 			// Head
-			if(boneNodes[0][2]) boneNodes[0][2]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(sinSNorm * DirectX::XM_PIDIV4 * 0.025f));
-			if(boneNodes[0][3]) boneNodes[0][3]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(sinSNorm2 * DirectX::XM_PIDIV4 * 0.025f));
-			if(boneNodes[0][4]) boneNodes[0][4]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(sinSNorm2 * DirectX::XM_PIDIV4 * 0.025f));
-			if(boneNodes[0][7]) boneNodes[0][7]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(cosUNorm2 * DirectX::XM_PIDIV4 * 0.5f));
+			bones[2] = DirectX::XMMatrixRotationX(sinSNorm * DirectX::XM_PIDIV4 * 0.025f);
+			bones[3] = DirectX::XMMatrixRotationX(sinSNorm2 * DirectX::XM_PIDIV4 * 0.025f);
+			bones[4] = DirectX::XMMatrixRotationX(sinSNorm2 * DirectX::XM_PIDIV4 * 0.025f);
+			bones[7] = DirectX::XMMatrixRotationX(cosUNorm2 * DirectX::XM_PIDIV4 * 0.5f);
 			// Tail
-			if(boneNodes[0][50]) boneNodes[0][50]->setBoneSpaceTansform(DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.05f));
-			if(boneNodes[0][51]) boneNodes[0][51]->setBoneSpaceTansform(DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.125f));
-			if(boneNodes[0][52]) boneNodes[0][52]->setBoneSpaceTansform(DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.25f));
-			if(boneNodes[0][53]) boneNodes[0][53]->setBoneSpaceTansform(DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.25f));
-			if(boneNodes[0][54]) boneNodes[0][54]->setBoneSpaceTansform(DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.125f));
+			bones[50] = DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.05f);
+			bones[51] = DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.125f);
+			bones[52] = DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.25f);
+			bones[53] = DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.25f);
+			bones[54] = DirectX::XMMatrixRotationZ(sinSNorm * DirectX::XM_PIDIV4 * 0.125f);
 			// Left leg
-			if(boneNodes[0][62]) boneNodes[0][62]->setBoneSpaceTansform(DirectX::XMMatrixRotationX((1.0f - cosUNorm) * DirectX::XM_PIDIV4 * 0.5f));
-			if(boneNodes[0][63]) boneNodes[0][63]->setBoneSpaceTansform(DirectX::XMMatrixRotationX((1.0f - cosUNorm) * -DirectX::XM_PIDIV4 * 1.5f));
-			if(boneNodes[0][64]) boneNodes[0][64]->setBoneSpaceTansform(DirectX::XMMatrixRotationX((1.0f - cosUNorm) * -DirectX::XM_PIDIV4 * 0.25f));
-			if(boneNodes[0][65]) boneNodes[0][65]->setBoneSpaceTansform(DirectX::XMMatrixRotationZ(sinUNormOffset * -DirectX::XM_PIDIV4 * 0.55f));
+			bones[62] = DirectX::XMMatrixRotationX((1.0f - cosUNorm) * DirectX::XM_PIDIV4 * 0.5f);
+			bones[63] = DirectX::XMMatrixRotationX((1.0f - cosUNorm) * -DirectX::XM_PIDIV4 * 1.5f);
+			bones[64] = DirectX::XMMatrixRotationX((1.0f - cosUNorm) * -DirectX::XM_PIDIV4 * 0.25f);
+			bones[65] = DirectX::XMMatrixRotationZ(sinUNormOffset * -DirectX::XM_PIDIV4 * 0.55f);
 			// Right leg
-			if(boneNodes[0][57]) boneNodes[0][57]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(cosUNorm * DirectX::XM_PIDIV4 * 0.5f));
-			if(boneNodes[0][58]) boneNodes[0][58]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(cosUNorm * -DirectX::XM_PIDIV4 * 1.5f));
-			if(boneNodes[0][59]) boneNodes[0][59]->setBoneSpaceTansform(DirectX::XMMatrixRotationX(cosUNorm * -DirectX::XM_PIDIV4 * 0.25f));
-			if(boneNodes[0][60]) boneNodes[0][60]->setBoneSpaceTansform(DirectX::XMMatrixRotationZ(sinUNormOffset * DirectX::XM_PIDIV4 * 0.55f));
+			bones[57] = DirectX::XMMatrixRotationX(cosUNorm * DirectX::XM_PIDIV4 * 0.5f);
+			bones[58] = DirectX::XMMatrixRotationX(cosUNorm * -DirectX::XM_PIDIV4 * 1.5f);
+			bones[59] = DirectX::XMMatrixRotationX(cosUNorm * -DirectX::XM_PIDIV4 * 0.25f);
+			bones[60] = DirectX::XMMatrixRotationZ(sinUNormOffset * DirectX::XM_PIDIV4 * 0.55f);
+
+			// Body
+			sceneLoader.getSkeleton(0).pose(DirectX::XMMatrixRotationZ(DirectX::XM_PI) * DirectX::XMMatrixTranslation(3.5f, -10.0f, 0.0f), bones, sceneLoader.getArmature(0));
 		}
 
-		lightNodes[0]->setTansform(DirectX::XMMatrixTranslation(25.0f, 0.0f, 5.0f) * DirectX::XMMatrixRotationZ(scale * DirectX::XM_PI));
-		lights[6]->color = { cosUNorm * 50.0f, cosUNorm * 45.0f, cosUNorm * 47.5f };
+		if(lightNodes[0] && lightNodes[1]) {
+			lightNodes[0]->setTansform(DirectX::XMMatrixTranslation(25.0f, 0.0f, 5.0f) * DirectX::XMMatrixRotationZ(scale * DirectX::XM_PI));
+			sceneLoader.getLight(6)->color = { cosUNorm * 50.0f, cosUNorm * 45.0f, cosUNorm * 47.5f };
 
-		lightNodes[1]->setTansform(DirectX::XMMatrixTranslation(-25.0f, 0.0f, 5.0f) * DirectX::XMMatrixRotationZ(scale * DirectX::XM_PI));
-		lights[7]->color = lights[6]->color;
+			lightNodes[1]->setTansform(DirectX::XMMatrixTranslation(-25.0f, 0.0f, 5.0f) * DirectX::XMMatrixRotationZ(scale * DirectX::XM_PI));
+			sceneLoader.getLight(7)->color = sceneLoader.getLight(6)->color;
+		}
 
 		sceneGraph.update();
 
@@ -571,15 +401,9 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 		}
 	}
 
-	for(uint32_t i = 0; i < _countof(environmentTextures); ++i)
-		renderer->removeTexture(environmentTextures[i]);
-
-	for(uint32_t i = 0; i < _countof(textures); ++i)
-		for(uint32_t j = 0; j < _countof(textures[i]); ++j)
-			renderer->removeTexture(textures[i][j]);
-
-	for(uint32_t i = 0; i < _countof(boneNodes); ++i)
-		delete[] boneNodes[i];
+	// The workers may still be adding assets of the scene
+	filePool.wait();
+	sceneLoader.unload();
 
 	// Cleanup
 	delete input;
@@ -0,0 +1,958 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Bounds.hpp>
+#include <IndexData.hpp>
+#include <VertexData.hpp>
+
+#include "Json.hpp"
+#include "MeshCodec.hpp"
+#include "MeshCooker.hpp"
+#include "MeshFile.hpp"
+#include "MeshOptimizer.hpp"
+#include "MeshSimplifier.hpp"
+#include "ModelImport.hpp"
+
+void testVertexCodec() {
+	std::mt19937 random(0);
+
+	for(uint32_t stride : { 28, 36 }) {
+		for(uint32_t vertexCount : { 0, 1, 15, 16, 17, 255, 256, 257, 10000 }) {
+			// Noise, which is stored raw, and a smooth ramp, which packs down
+			for(bool smooth : { false, true }) {
+				std::vector<char> vertices((uint64_t)vertexCount * stride);
+				for(uint32_t i = 0; i < vertexCount; ++i)
+					for(uint32_t k = 0; k < stride; ++k)
+						vertices[(uint64_t)i * stride + k] = smooth ? (char)(i / 4 + k) : (char)random();
+
+				std::vector<char> data;
+				encodeVertices(vertices.data(), vertexCount, stride, data);
+
+				// The extra byte catches writes past the end
+				std::vector<char> decoded(vertices.size() + 1, 0x55), decodedScalar(vertices.size() + 1, 0x55);
+				bool valid = decodeVertices(data.data(), data.size(), vertexCount, stride, decoded.data());
+				bool validScalar = decodeVerticesScalar(data.data(), data.size(), vertexCount, stride, decodedScalar.data());
+
+				valid = valid && validScalar &&
+					!memcmp(decoded.data(), vertices.data(), vertices.size()) &&
+					!memcmp(decodedScalar.data(), vertices.data(), vertices.size()) &&
+					decoded.back() == 0x55 && decodedScalar.back() == 0x55;
+
+				// Truncated data must be rejected, empty data has nothing to truncate
+				const bool rejected = data.empty() || !decodeVertices(data.data(), data.size() - 1, vertexCount, stride, decoded.data());
+
+				// Expected valid, rejected
+				std::cout << "Stride " << stride << ", " << vertexCount << (smooth ? " smooth" : " noise") << " vertices: ";
+				std::cout << (valid ? "valid" : "invalid") << ", " << (rejected ? "rejected" : "accepted") << std::endl;
+			}
+		}
+	}
+}
+
+void testIndexCodec() {
+	std::mt19937 random(0);
+
+	for(uint32_t indexCount : { 0, 1, 3, 1000 }) {
+		std::vector<uint32_t> indices(indexCount);
+		for(uint32_t& index : indices)
+			index = random() % 100000;
+		// Extremes of the delta range
+		if(indexCount >= 3) {
+			indices[1] = 0xFFFFFFFF;
+			indices[2] = 0;
+		}
+
+		std::vector<char> data;
+		encodeIndices(indices.data(), indexCount, data);
+
+		std::vector<uint32_t> decoded(indexCount);
+		const bool valid = decodeIndices(data.data(), data.size(), indexCount, decoded.data()) && decoded == indices;
+		const bool rejected = data.empty() || !decodeIndices(data.data(), data.size() - 1, indexCount, decoded.data());
+
+		// Expected valid, rejected
+		std::cout << indexCount << " indices: " << (valid ? "valid" : "invalid") << ", " << (rejected ? "rejected" : "accepted") << std::endl;
+	}
+}
+
+void testIndexNarrowing() {
+	std::mt19937 random(0);
+
+	// Counts around the vector width, with the extremes of the 16-bit range
+	for(uint32_t indexCount : { 0, 1, 15, 16, 17, 33, 100000 }) {
+		std::vector<uint32_t> indices(indexCount);
+		for(uint32_t& index : indices)
+			index = random() % RIN::INDEX16_VERTEX_COUNT;
+		if(indexCount >= 3) {
+			indices[0] = 0;
+			indices[1] = 0x7FFF;
+			indices[2] = 0xFFFF;
+		}
+
+		// The extra element catches writes past the end
+		std::vector<uint16_t> narrowed(indexCount + 1, 0x5555);
+		RIN::narrowIndices(indices.data(), indexCount, narrowed.data());
+
+		bool equal = narrowed.back() == 0x5555;
+		for(uint32_t i = 0; i < indexCount; ++i)
+			equal &= narrowed[i] == indices[i];
+
+		// Expected equal
+		std::cout << indexCount << " indices: " << (equal ? "equal" : "different") << std::endl;
+	}
+}
+
+void testVertexQuantization() {
+	std::mt19937 random(0);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+	const RIN::BoundingSphere boundingSphere(3.0f, -2.0f, 5.0f, 7.0f);
+	// A position is off by at most half a step, the full step absorbs float error
+	const float positionBound = boundingSphere.radius / 32767.0f;
+	// Worst case of the 8-bit octahedral encoding, plus the half precision of the input
+	const float angleBound = 0.02f;
+
+	auto randomDirection = [&]() {
+		DirectX::XMFLOAT3 direction;
+		float length;
+		do {
+			direction = { unit(random), unit(random), unit(random) };
+			length = std::sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
+		} while(length < 0.1f || length > 1.0f);
+
+		return DirectX::XMFLOAT3(direction.x / length, direction.y / length, direction.z / length);
+	};
+
+	// Mirrors PBRStaticQuantizedVS.hlsl
+	auto decodeOctahedral = [](const int8_t* encoded) {
+		float x = std::max(encoded[0] / 127.0f, -1.0f);
+		float y = std::max(encoded[1] / 127.0f, -1.0f);
+		float z = 1.0f - std::fabs(x) - std::fabs(y);
+		float t = std::max(-z, 0.0f);
+		x += x >= 0.0f ? -t : t;
+		y += y >= 0.0f ? -t : t;
+
+		float length = std::sqrt(x * x + y * y + z * z);
+		return DirectX::XMFLOAT3(x / length, y / length, z / length);
+	};
+
+	auto getAngle = [](DirectX::PackedVector::HALF x, DirectX::PackedVector::HALF y, DirectX::PackedVector::HALF z, DirectX::XMFLOAT3 decoded) {
+		DirectX::XMFLOAT3 original(
+			DirectX::PackedVector::XMConvertHalfToFloat(x),
+			DirectX::PackedVector::XMConvertHalfToFloat(y),
+			DirectX::PackedVector::XMConvertHalfToFloat(z)
+		);
+		float length = std::sqrt(original.x * original.x + original.y * original.y + original.z * original.z);
+		float cosine = (original.x * decoded.x + original.y * decoded.y + original.z * decoded.z) / length;
+		return std::acos(std::min(std::max(cosine, -1.0f), 1.0f));
+	};
+
+	// Counts around the block size
+	for(uint32_t vertexCount : { 0, 1, 3, 4, 5, 7, 8, 100000 }) {
+		std::vector<RIN::StaticVertex> vertices(vertexCount);
+		for(uint32_t i = 0; i < vertexCount; ++i) {
+			RIN::StaticVertex& vertex = vertices[i];
+
+			DirectX::XMFLOAT3 offset = randomDirection();
+			float distance = (i % 8 ? std::fabs(unit(random)) : 1.0f) * boundingSphere.radius;
+			vertex.position.x = boundingSphere.center.x + offset.x * distance;
+			vertex.position.y = boundingSphere.center.y + offset.y * distance;
+			vertex.position.z = boundingSphere.center.z + offset.z * distance;
+
+			// Axis aligned directions hit the folds of the octahedron
+			DirectX::XMFLOAT3 normal = i % 16 == 1 ? DirectX::XMFLOAT3(0.0f, 0.0f, -1.0f) : randomDirection();
+			DirectX::XMFLOAT3 tangent = i % 16 == 2 ? DirectX::XMFLOAT3(-1.0f, 0.0f, 0.0f) : randomDirection();
+			vertex.normalX = DirectX::PackedVector::XMConvertFloatToHalf(normal.x);
+			vertex.normalY = DirectX::PackedVector::XMConvertFloatToHalf(normal.y);
+			vertex.normalZ = DirectX::PackedVector::XMConvertFloatToHalf(normal.z);
+			vertex.tangentX = DirectX::PackedVector::XMConvertFloatToHalf(tangent.x);
+			vertex.tangentY = DirectX::PackedVector::XMConvertFloatToHalf(tangent.y);
+			vertex.tangentZ = DirectX::PackedVector::XMConvertFloatToHalf(tangent.z);
+			vertex.texX = DirectX::PackedVector::XMConvertFloatToHalf(unit(random));
+			vertex.texY = DirectX::PackedVector::XMConvertFloatToHalf(unit(random));
+		}
+
+		// The extra element catches writes past the end
+		std::vector<RIN::QuantizedStaticVertex> quantized(vertexCount + 1), scalar(vertexCount + 1);
+		memset(quantized.data(), 0x55, quantized.size() * sizeof(RIN::QuantizedStaticVertex));
+		memset(scalar.data(), 0x55, scalar.size() * sizeof(RIN::QuantizedStaticVertex));
+		RIN::quantizeStaticVertices(vertices.data(), vertexCount, boundingSphere, quantized.data());
+		// One at a time takes the scalar path, which must give the same bits
+		for(uint32_t i = 0; i < vertexCount; ++i)
+			RIN::quantizeStaticVertices(vertices.data() + i, 1, boundingSphere, scalar.data() + i);
+
+		float positionError = 0.0f, angleError = 0.0f;
+		bool texEqual = true;
+		for(uint32_t i = 0; i < vertexCount; ++i) {
+			const RIN::StaticVertex& vertex = vertices[i];
+			const RIN::QuantizedStaticVertex& output = quantized[i];
+
+			const float position[3]{ vertex.position.x, vertex.position.y, vertex.position.z };
+			const float center[3]{ boundingSphere.center.x, boundingSphere.center.y, boundingSphere.center.z };
+			for(uint32_t k = 0; k < 3; ++k) {
+				float decoded = center[k] + std::max(output.position[k] / 32767.0f, -1.0f) * boundingSphere.radius;
+				positionError = std::max(positionError, std::fabs(decoded - position[k]));
+			}
+
+			angleError = std::max(angleError, getAngle(vertex.normalX, vertex.normalY, vertex.normalZ, decodeOctahedral(output.normal)));
+			angleError = std::max(angleError, getAngle(vertex.tangentX, vertex.tangentY, vertex.tangentZ, decodeOctahedral(output.tangent)));
+			texEqual &= output.texX == vertex.texX && output.texY == vertex.texY && !output.position[3];
+		}
+
+		const bool valid = positionError <= positionBound && angleError <= angleBound && texEqual &&
+			!memcmp(quantized.data(), scalar.data(), quantized.size() * sizeof(RIN::QuantizedStaticVertex)) &&
+			quantized.back().position[0] == 0x5555;
+
+		// Expected valid
+		std::cout << vertexCount << " vertices: position error " << positionError << ", angle error " << angleError << ", " << (valid ? "valid" : "invalid") << std::endl;
+	}
+}
+
+void testBounds() {
+	std::mt19937 random(0);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+	auto contains = [](const RIN::BoundingSphere& sphere, const DirectX::XMFLOAT3& p) {
+		const float dx = p.x - sphere.center.x, dy = p.y - sphere.center.y, dz = p.z - sphere.center.z;
+		return std::sqrt(dx * dx + dy * dy + dz * dz) <= sphere.radius;
+	};
+
+	// Points on a sphere and in a cube with its corners, whose minimal spheres are known
+	for(uint32_t shape = 0; shape < 2; ++shape) {
+		for(uint32_t vertexCount : { 1, 2, 7, 1000, 100001 }) {
+			std::vector<RIN::StaticVertex> vertices(vertexCount);
+			std::vector<DirectX::XMFLOAT3> positions(vertexCount);
+			for(uint32_t i = 0; i < vertexCount; ++i) {
+				DirectX::XMFLOAT3 p(unit(random), unit(random), unit(random));
+				if(!shape) {
+					const float length = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+					p = { p.x / length, p.y / length, p.z / length };
+				} else if(i < 8) p = { i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f };
+
+				// Offset so the center has to be found
+				p = { p.x + 10.0f, p.y - 5.0f, p.z + 2.0f };
+				vertices[i].position = positions[i] = p;
+			}
+
+			// The vertex stride takes the vector path, the packed positions the scalar one
+			const RIN::BoundingSphere sphere = RIN::computeBoundingSphere(vertices.data(), vertexCount, sizeof(RIN::StaticVertex));
+			const RIN::BoundingSphere scalarSphere = RIN::computeBoundingSphere(positions.data(), vertexCount, sizeof(DirectX::XMFLOAT3));
+			const RIN::BoundingBox box = RIN::computeBoundingBox(vertices.data(), vertexCount, sizeof(RIN::StaticVertex));
+
+			bool valid = true;
+			DirectX::XMFLOAT3 min = positions[0], max = positions[0];
+			for(const DirectX::XMFLOAT3& p : positions) {
+				valid &= contains(sphere, p) && contains(scalarSphere, p);
+				min = { std::min(min.x, p.x), std::min(min.y, p.y), std::min(min.z, p.z) };
+				max = { std::max(max.x, p.x), std::max(max.y, p.y), std::max(max.z, p.z) };
+			}
+			valid &= !memcmp(&box.min, &min, sizeof(min)) && !memcmp(&box.max, &max, sizeof(max));
+
+			// Only large point sets reach the minimal radius
+			const float minimalRadius = shape ? std::sqrt(3.0f) : 1.0f;
+			if(vertexCount >= 1000) valid &= sphere.radius <= minimalRadius * 1.02f && scalarSphere.radius <= minimalRadius * 1.02f;
+
+			// Expected valid
+			std::cout << (shape ? "Cube " : "Sphere ") << vertexCount << ": radius " << sphere.radius << ", " << (valid ? "valid" : "invalid") << std::endl;
+		}
+	}
+
+	// The computed spheres can only be tighter than the ones from the Blender scripts,
+	// and every vertex must be inside the sphere of each bone it has a weight in
+	for(const char* fileName : { "../res/meshes/Cone.smesh", "../res/meshes/Cube.smesh", "../res/meshes/Monster.dmesh", "../res/meshes/Monster.skmesh" }) {
+		std::ifstream stream(fileName, std::ios::binary);
+		std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		MeshData mesh;
+		if(!readMesh(file.data(), file.size(), mesh)) {
+			std::cout << fileName << ": invalid" << std::endl;
+			continue;
+		}
+
+		const float fileRadius = mesh.boundingSphere[3];
+		const auto start = std::chrono::high_resolution_clock::now();
+		computeBounds(mesh);
+		const float milliseconds = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+		bool valid = mesh.boundingBoxes.size() == mesh.lodCount();
+		const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+		const uint64_t vertexCount = mesh.vertices.size() / stride;
+		const RIN::BoundingSphere sphere(mesh.boundingSphere[0], mesh.boundingSphere[1], mesh.boundingSphere[2], mesh.boundingSphere[3]);
+		for(uint64_t i = 0; i < vertexCount; ++i) {
+			DirectX::XMFLOAT3 position;
+			memcpy(&position, mesh.vertices.data() + i * stride, sizeof(position));
+			valid &= contains(sphere, position);
+
+			if(mesh.type != MESH_TYPE::SKINNED) continue;
+
+			const RIN::SkinnedVertex& vertex = ((const RIN::SkinnedVertex*)mesh.vertices.data())[i];
+			const uint8_t* indices = &vertex.boneIndices.x;
+			const uint8_t* weights = &vertex.boneWeights.x;
+			for(uint32_t k = 0; k < 4; ++k) {
+				if(!weights[k]) continue;
+				const DirectX::XMFLOAT4& bone = mesh.boneSpheres[indices[k]];
+				valid &= contains(RIN::BoundingSphere(bone.x, bone.y, bone.z, bone.w), position);
+			}
+		}
+		valid &= mesh.type == MESH_TYPE::SKINNED ? !mesh.boneSpheres.empty() : mesh.boundingSphere[3] <= fileRadius;
+
+		// Expected valid
+		std::cout << fileName << ": radius " << fileRadius << " -> " << mesh.boundingSphere[3] << ", ";
+		if(mesh.type == MESH_TYPE::SKINNED) std::cout << mesh.boneSpheres.size() << " bone spheres, ";
+		std::cout << milliseconds << " ms, " << (valid ? "valid" : "invalid") << std::endl;
+	}
+}
+
+void testPosedBounds() {
+	std::mt19937 random(0);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+	// Rounding of the transforms is allowed for
+	auto contains = [](const RIN::BoundingSphere& sphere, DirectX::FXMVECTOR p) {
+		const DirectX::XMVECTOR offset = DirectX::XMVectorSubtract(p, DirectX::XMLoadFloat3(&sphere.center));
+		return DirectX::XMVectorGetX(DirectX::XMVector3Length(offset)) <= sphere.radius * 1.0001f + 0.0001f;
+	};
+
+	// A single sphere is moved by its bone and scaled by the largest scale
+	{
+		const DirectX::XMFLOAT4 boneSphere(1.0f, 2.0f, 3.0f, 0.5f);
+		const DirectX::XMMATRIX M = DirectX::XMMatrixMultiply(DirectX::XMMatrixScaling(1.0f, 3.0f, 2.0f), DirectX::XMMatrixTranslation(-4.0f, 0.0f, 1.0f));
+		const RIN::BoundingSphere sphere = RIN::computePosedBoundingSphere(&boneSphere, 1, &M, sizeof(DirectX::XMMATRIX));
+
+		const bool valid = sphere.center.x == -3.0f && sphere.center.y == 6.0f && sphere.center.z == 7.0f && sphere.radius == 1.5f;
+
+		// Expected valid
+		std::cout << "Single bone: " << (valid ? "valid" : "invalid") << std::endl;
+	}
+
+	// Bones without vertices are left out
+	{
+		const DirectX::XMFLOAT4 boneSpheres[2]{ { 0.0f, 0.0f, 0.0f, -1.0f }, { 5.0f, 0.0f, 0.0f, -1.0f } };
+		const DirectX::XMMATRIX matrices[2]{ DirectX::XMMatrixIdentity(), DirectX::XMMatrixIdentity() };
+		const RIN::BoundingSphere sphere = RIN::computePosedBoundingSphere(boneSpheres, 2, matrices, sizeof(DirectX::XMMATRIX));
+
+		const bool valid = sphere.radius == 0.0f;
+
+		// Expected valid
+		std::cout << "Unused bones: " << (valid ? "valid" : "invalid") << std::endl;
+	}
+
+	// Every skinned vertex must be inside the sphere of its pose, the rest pose must fit in the sphere of the file
+	std::ifstream stream("../res/meshes/Monster.skmesh", std::ios::binary);
+	std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	MeshData mesh;
+	if(!readMesh(file.data(), file.size(), mesh)) {
+		std::cout << "Monster.skmesh: invalid" << std::endl;
+		return;
+	}
+
+	computeBounds(mesh);
+
+	const uint32_t boneCount = (uint32_t)mesh.boneSpheres.size();
+	const RIN::SkinnedVertex* vertices = (const RIN::SkinnedVertex*)mesh.vertices.data();
+	const uint64_t vertexCount = mesh.vertices.size() / sizeof(RIN::SkinnedVertex);
+	std::vector<DirectX::XMMATRIX> matrices(boneCount);
+	for(uint32_t pose = 0; pose < 4; ++pose) {
+		for(DirectX::XMMATRIX& M : matrices) {
+			if(!pose) M = DirectX::XMMatrixIdentity();
+			else {
+				// Non-uniform scales are bounded by the largest one
+				const float scale = pose == 1 ? 1.0f : 1.5f + unit(random) * 0.5f;
+				M = DirectX::XMMatrixScaling(scale, scale + (pose == 3 ? unit(random) * 0.4f : 0.0f), scale);
+				M = DirectX::XMMatrixMultiply(M, DirectX::XMMatrixRotationRollPitchYaw(unit(random) * 3.1f, unit(random) * 3.1f, unit(random) * 3.1f));
+				M = DirectX::XMMatrixMultiply(M, DirectX::XMMatrixTranslation(unit(random) * 2.0f, unit(random) * 2.0f, unit(random) * 2.0f));
+			}
+		}
+
+		const auto start = std::chrono::high_resolution_clock::now();
+		const RIN::BoundingSphere sphere = RIN::computePosedBoundingSphere(mesh.boneSpheres.data(), boneCount, matrices.data(), sizeof(DirectX::XMMATRIX));
+		const float microseconds = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - start).count();
+
+		bool valid = true;
+		for(uint64_t i = 0; i < vertexCount; ++i) {
+			const RIN::SkinnedVertex& vertex = vertices[i];
+			const DirectX::XMVECTOR position = DirectX::XMLoadFloat3(&vertex.position);
+			const uint8_t* indices = &vertex.boneIndices.x;
+			const uint8_t* weights = &vertex.boneWeights.x;
+
+			DirectX::XMVECTOR skinned = DirectX::XMVectorZero();
+			for(uint32_t k = 0; k < 4; ++k) {
+				if(!weights[k]) continue;
+				const DirectX::XMVECTOR p = DirectX::XMVector3Transform(position, matrices[indices[k]]);
+				skinned = DirectX::XMVectorAdd(skinned, DirectX::XMVectorScale(p, weights[k] / 255.0f));
+			}
+			valid &= contains(sphere, skinned);
+		}
+		if(!pose) valid &= sphere.radius <= mesh.boundingSphere[3];
+
+		// Expected valid
+		std::cout << "Monster.skmesh pose " << pose << ": radius " << sphere.radius << ", " << microseconds << " us, " << (valid ? "valid" : "invalid") << std::endl;
+	}
+}
+
+void testMeshFiles() {
+	for(const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("../res/meshes")) {
+		std::ifstream stream(entry.path(), std::ios::binary);
+		std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		MeshData mesh;
+		if(!readMesh(file.data(), file.size(), mesh)) {
+			std::cout << entry.path().filename().string() << ": invalid" << std::endl;
+			continue;
+		}
+
+		// Writing the decoded mesh must give back the same file, compressed or not
+		std::vector<char> compressed, uncompressed;
+		writeMesh(mesh, MESH_FLAG_COMPRESSED_VERTICES | MESH_FLAG_COMPRESSED_INDICES, compressed);
+		writeMesh(mesh, 0, uncompressed);
+
+		MeshData uncompressedMesh;
+		bool roundTrip = compressed == file &&
+			readMesh(uncompressed.data(), uncompressed.size(), uncompressedMesh) &&
+			uncompressedMesh.vertices == mesh.vertices && uncompressedMesh.indices == mesh.indices;
+
+		// Decode throughput of the vertex streams
+		const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+		std::vector<char> vertices;
+		encodeVertices(mesh.vertices.data(), (uint32_t)(mesh.vertices.size() / stride), stride, vertices);
+
+		auto start = std::chrono::steady_clock::now();
+		decodeVertices(vertices.data(), vertices.size(), (uint32_t)(mesh.vertices.size() / stride), stride, mesh.vertices.data());
+		std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+
+		start = std::chrono::steady_clock::now();
+		decodeVerticesScalar(vertices.data(), vertices.size(), (uint32_t)(mesh.vertices.size() / stride), stride, mesh.vertices.data());
+		std::chrono::duration<float> scalarElapsed = std::chrono::steady_clock::now() - start;
+
+		float megabytes = mesh.vertices.size() / (1024.0f * 1024.0f);
+		// Expected round trip
+		std::cout << entry.path().filename().string() << ": " << (roundTrip ? "round trip" : "mismatch") << ", ";
+		std::cout << uncompressed.size() << " -> " << file.size() << " bytes, ";
+		std::cout << megabytes / elapsed.count() << " MB/s, " << megabytes / scalarElapsed.count() << " MB/s scalar" << std::endl;
+	}
+}
+// Triangles of a LOD as their vertex data, rotated so the smallest vertex is first, which keeps the winding
+std::vector<std::string> getTestTriangles(const char* vertices, const uint32_t* indices, uint32_t indexCount, uint32_t stride) {
+	std::vector<std::string> triangles;
+	for(uint32_t i = 0; i + 2 < indexCount; i += 3) {
+		std::string corners[3];
+		for(uint32_t j = 0; j < 3; ++j)
+			corners[j].assign(vertices + (uint64_t)indices[i + j] * stride, stride);
+
+		const uint32_t first = (uint32_t)(std::min_element(corners, corners + 3) - corners);
+		triangles.push_back(corners[first] + corners[(first + 1) % 3] + corners[(first + 2) % 3]);
+	}
+	std::sort(triangles.begin(), triangles.end());
+
+	return triangles;
+}
+
+void testMeshOptimization() {
+	std::mt19937 random(0);
+
+	// A shuffled grid, which the cache optimizer should bring close to 0.5 ACMR
+	constexpr uint32_t GRID_SIZE = 100;
+	std::vector<uint32_t> grid;
+	for(uint32_t y = 0; y < GRID_SIZE; ++y) {
+		for(uint32_t x = 0; x < GRID_SIZE; ++x) {
+			const uint32_t corner = y * (GRID_SIZE + 1) + x;
+			grid.insert(grid.end(), { corner, corner + GRID_SIZE + 1, corner + 1 });
+			grid.insert(grid.end(), { corner + 1, corner + GRID_SIZE + 1, corner + GRID_SIZE + 2 });
+		}
+	}
+
+	std::vector<uint32_t> triangleOrder(grid.size() / 3);
+	for(uint32_t i = 0; i < triangleOrder.size(); ++i)
+		triangleOrder[i] = i;
+	std::shuffle(triangleOrder.begin(), triangleOrder.end(), random);
+
+	std::vector<uint32_t> shuffled;
+	for(uint32_t triangle : triangleOrder)
+		shuffled.insert(shuffled.end(), grid.begin() + triangle * 3, grid.begin() + triangle * 3 + 3);
+
+	const uint32_t gridVertexCount = (GRID_SIZE + 1) * (GRID_SIZE + 1);
+	const VertexCacheStats before = getVertexCacheStats(shuffled.data(), (uint32_t)shuffled.size(), gridVertexCount);
+	optimizeVertexCache(shuffled.data(), (uint32_t)shuffled.size(), gridVertexCount);
+	const VertexCacheStats after = getVertexCacheStats(shuffled.data(), (uint32_t)shuffled.size(), gridVertexCount);
+
+	// Expected around 2.9 before and 0.7 after
+	std::cout << "Grid ACMR " << before.acmr << " -> " << after.acmr << std::endl;
+
+	// Optimizing must only reorder, every LOD keeps the same triangles with the same winding
+	for(const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator("../res/meshes")) {
+		std::ifstream stream(entry.path(), std::ios::binary);
+		std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		MeshData mesh;
+		if(!readMesh(file.data(), file.size(), mesh)) continue;
+
+		MeshData optimized = mesh;
+		optimizeMesh(optimized, true);
+
+		const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+		const char* vertices = mesh.vertices.data();
+		const char* optimizedVertices = optimized.vertices.data();
+		const uint32_t* indices = mesh.indices.data();
+		const uint32_t* optimizedIndices = optimized.indices.data();
+		bool equal = optimized.indexCounts == mesh.indexCounts;
+		for(uint32_t i = 0; i < mesh.lodCount() && equal; ++i) {
+			equal = getTestTriangles(vertices, indices, mesh.indexCounts[i], stride) ==
+				getTestTriangles(optimizedVertices, optimizedIndices, mesh.indexCounts[i], stride);
+
+			// Vertices must be in first use order
+			uint32_t nextVertex = 0;
+			for(uint32_t j = 0; j < mesh.indexCounts[i]; ++j) {
+				if(optimizedIndices[j] > nextVertex) equal = false;
+				else if(optimizedIndices[j] == nextVertex) ++nextVertex;
+			}
+			equal &= nextVertex == optimized.vertexCounts[i];
+
+			vertices += (uint64_t)mesh.vertexCounts[i] * stride;
+			optimizedVertices += (uint64_t)optimized.vertexCounts[i] * stride;
+			indices += mesh.indexCounts[i];
+			optimizedIndices += mesh.indexCounts[i];
+		}
+
+		// Expected equal
+		std::cout << entry.path().filename().string() << ": " << (equal ? "equal" : "different") << std::endl;
+	}
+}
+
+// Number of edges, by position, which have no edge going the other way
+uint32_t getTestOpenEdgeCount(const char* vertices, const uint32_t* indices, uint32_t indexCount, uint32_t stride) {
+	std::vector<std::string> edges;
+	for(uint32_t i = 0; i + 2 < indexCount; i += 3) {
+		for(uint32_t j = 0; j < 3; ++j) {
+			const char* a = vertices + (uint64_t)indices[i + j] * stride;
+			const char* b = vertices + (uint64_t)indices[i + (j + 1) % 3] * stride;
+			edges.push_back(std::string(a, 12) + std::string(b, 12));
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+
+	uint32_t openCount = 0;
+	for(const std::string& edge : edges) {
+		const std::string opposite = edge.substr(12) + edge.substr(0, 12);
+		if(!std::binary_search(edges.begin(), edges.end(), opposite)) ++openCount;
+	}
+
+	return openCount;
+}
+
+void testMeshSimplification() {
+	// A flat grid can collapse down to its border, which is locked
+	constexpr uint32_t GRID_SIZE = 20;
+	std::vector<RIN::StaticVertex> grid;
+	for(uint32_t y = 0; y <= GRID_SIZE; ++y) {
+		for(uint32_t x = 0; x <= GRID_SIZE; ++x) {
+			RIN::StaticVertex vertex{};
+			vertex.position = { (float)x, (float)y, 0.0f };
+			vertex.normalZ = DirectX::PackedVector::XMConvertFloatToHalf(-1.0f);
+			vertex.texX = DirectX::PackedVector::XMConvertFloatToHalf((float)x / GRID_SIZE);
+			vertex.texY = DirectX::PackedVector::XMConvertFloatToHalf((float)y / GRID_SIZE);
+			grid.push_back(vertex);
+		}
+	}
+
+	std::vector<uint32_t> gridIndices;
+	for(uint32_t y = 0; y < GRID_SIZE; ++y) {
+		for(uint32_t x = 0; x < GRID_SIZE; ++x) {
+			const uint32_t corner = y * (GRID_SIZE + 1) + x;
+			gridIndices.insert(gridIndices.end(), { corner, corner + GRID_SIZE + 1, corner + 1 });
+			gridIndices.insert(gridIndices.end(), { corner + 1, corner + GRID_SIZE + 1, corner + GRID_SIZE + 2 });
+		}
+	}
+
+	const float gridSphere[4]{ GRID_SIZE * 0.5f, GRID_SIZE * 0.5f, 0.0f, GRID_SIZE * 0.75f };
+	std::vector<uint32_t> simplified(gridIndices.size());
+	SimplifyResult result = simplifyMesh((const char*)grid.data(), (uint32_t)grid.size(), sizeof(RIN::StaticVertex), gridSphere,
+		gridIndices.data(), (uint32_t)gridIndices.size(), 0, 1.0f, simplified.data());
+
+	std::vector<bool> used(grid.size());
+	for(uint32_t i = 0; i < result.indexCount; ++i)
+		used[simplified[i]] = true;
+
+	bool borderKept = true;
+	for(uint32_t i = 0; i <= GRID_SIZE; ++i) {
+		borderKept &= used[i] && used[GRID_SIZE * (GRID_SIZE + 1) + i];
+		borderKept &= used[i * (GRID_SIZE + 1)] && used[i * (GRID_SIZE + 1) + GRID_SIZE];
+	}
+
+	// Expected around 80 triangles, about one for each border edge, with the border kept
+	std::cout << "Grid " << gridIndices.size() / 3 << " -> " << result.indexCount / 3 << " triangles, error " << result.error << ", ";
+	std::cout << (borderKept ? "border kept" : "border lost") << std::endl;
+
+	// Closed meshes must stay closed, UV seams included, and LODs must hit their targets
+	for(const char* fileName : { "../res/meshes/Sphere0.smesh", "../res/meshes/Torus0.smesh", "../res/meshes/Monster.skmesh" }) {
+		std::ifstream stream(fileName, std::ios::binary);
+		std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		MeshData mesh;
+		if(!readMesh(file.data(), file.size(), mesh)) {
+			std::cout << fileName << ": invalid" << std::endl;
+			continue;
+		}
+
+		// Only keep LOD 0 so every LOD is generated
+		mesh.vertices.resize((uint64_t)mesh.vertexCounts[0] * MESH_VERTEX_SIZES[(uint8_t)mesh.type]);
+		mesh.indices.resize(mesh.indexCounts[0]);
+		mesh.vertexCounts.resize(1);
+		mesh.indexCounts.resize(1);
+
+		const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+		const uint32_t openCount = getTestOpenEdgeCount(mesh.vertices.data(), mesh.indices.data(), mesh.indexCounts[0], stride);
+
+		const LODSettings settings;
+		const std::vector<float> errors = generateLODs(mesh, settings);
+		bool valid = mesh.lodCount() == settings.lodCount && errors.size() == settings.lodCount;
+
+		const char* vertices = mesh.vertices.data();
+		const uint32_t* indices = mesh.indices.data();
+		for(uint32_t i = 0; i < mesh.lodCount() && valid; ++i) {
+			valid &= mesh.indexCounts[i] <= (uint32_t)(mesh.indexCounts[0] / 3 * settings.ratios[i]) * 3;
+			valid &= errors[i] <= settings.maxError && (!i || errors[i] >= errors[i - 1]);
+			valid &= getTestOpenEdgeCount(vertices, indices, mesh.indexCounts[i], stride) == openCount;
+
+			vertices += (uint64_t)mesh.vertexCounts[i] * stride;
+			indices += mesh.indexCounts[i];
+		}
+
+		// Expected valid
+		std::cout << fileName << ": " << (valid ? "valid" : "invalid") << ", errors";
+		for(float error : errors)
+			std::cout << " " << error;
+		std::cout << std::endl;
+	}
+}
+
+// Set if every LOD only uses a prefix of the shared vertices and the prefixes do not grow with the LOD
+bool isTestSharedMeshValid(const MeshData& mesh) {
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+	bool valid = mesh.sharedVertices && mesh.vertices.size() == (uint64_t)mesh.vertexCounts[0] * stride;
+
+	const uint32_t* indices = mesh.indices.data();
+	for(uint32_t i = 0; i < mesh.lodCount() && valid; ++i) {
+		valid &= !i || mesh.vertexCounts[i] <= mesh.vertexCounts[i - 1];
+		for(uint32_t j = 0; j < mesh.indexCounts[i]; ++j)
+			valid &= indices[j] < mesh.vertexCounts[i];
+
+		indices += mesh.indexCounts[i];
+	}
+
+	return valid;
+}
+
+void testSharedLODVertices() {
+	for(const char* fileName : { "../res/meshes/Sphere0.smesh", "../res/meshes/Torus0.smesh", "../res/meshes/Cube.smesh" }) {
+		std::ifstream stream(fileName, std::ios::binary);
+		std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		MeshData mesh;
+		if(!readMesh(file.data(), file.size(), mesh)) {
+			std::cout << fileName << ": invalid" << std::endl;
+			continue;
+		}
+
+		const LODSettings settings;
+		generateLODs(mesh, settings);
+
+		MeshData shared = mesh;
+		shareLODVertices(shared);
+		optimizeMesh(shared, true);
+
+		// Every LOD keeps the same triangles
+		const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+		const char* vertices = mesh.vertices.data();
+		const uint32_t* indices = mesh.indices.data();
+		const uint32_t* sharedIndices = shared.indices.data();
+		bool valid = isTestSharedMeshValid(shared) && shared.indexCounts == mesh.indexCounts;
+		for(uint32_t i = 0; i < mesh.lodCount() && valid; ++i) {
+			valid = getTestTriangles(vertices, indices, mesh.indexCounts[i], stride) ==
+				getTestTriangles(shared.vertices.data(), sharedIndices, mesh.indexCounts[i], stride);
+
+			vertices += (uint64_t)mesh.vertexCounts[i] * stride;
+			indices += mesh.indexCounts[i];
+			sharedIndices += mesh.indexCounts[i];
+		}
+
+		// The file keeps the vertices shared
+		std::vector<char> sharedFile;
+		writeMesh(shared, MESH_FLAG_COMPRESSED_VERTICES | MESH_FLAG_COMPRESSED_INDICES, sharedFile);
+		MeshData read;
+		valid = valid && readMesh(sharedFile.data(), sharedFile.size(), read) && read.sharedVertices;
+		valid = valid && read.vertexCounts == shared.vertexCounts && read.vertices == shared.vertices && read.indices == shared.indices;
+
+		// Generating LODs for a shared mesh keeps it shared
+		MeshData generated = read;
+		generated.indices.resize(generated.indexCounts[0]);
+		generated.vertexCounts.resize(1);
+		generated.indexCounts.resize(1);
+		generateLODs(generated, settings);
+		valid = valid && generated.lodCount() == mesh.lodCount() && isTestSharedMeshValid(generated);
+
+		// The shared layout is only kept when it makes the file smaller
+		MeshData unshared = mesh;
+		optimizeMesh(unshared, true);
+		std::vector<char> unsharedFile;
+		writeMesh(unshared, MESH_FLAG_COMPRESSED_VERTICES | MESH_FLAG_COMPRESSED_INDICES, unsharedFile);
+		MeshData chosen = mesh;
+		optimizeMeshShared(chosen, true, MESH_FLAG_COMPRESSED_VERTICES | MESH_FLAG_COMPRESSED_INDICES);
+		std::vector<char> chosenFile;
+		writeMesh(chosen, MESH_FLAG_COMPRESSED_VERTICES | MESH_FLAG_COMPRESSED_INDICES, chosenFile);
+		valid = valid && chosenFile.size() == std::min(unsharedFile.size(), sharedFile.size());
+		valid = valid && chosen.sharedVertices == (sharedFile.size() < unsharedFile.size());
+
+		uint64_t vertexCount = 0;
+		for(uint32_t count : unshared.vertexCounts)
+			vertexCount += count;
+
+		// Expected valid with fewer shared vertices than the LODs had, and the smaller layout kept
+		std::cout << fileName << ": " << (valid ? "valid" : "invalid") << ", " << mesh.lodCount() << " LODs, ";
+		std::cout << vertexCount << " -> " << shared.vertexCounts[0] << " vertices, " << unsharedFile.size() << " -> " << sharedFile.size() << " bytes, ";
+		std::cout << (chosen.sharedVertices ? "shared" : "per LOD") << std::endl;
+	}
+}
+
+std::string getTestBase64(const std::vector<char>& data) {
+	constexpr char DIGITS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	std::string text;
+	for(size_t i = 0; i < data.size(); i += 3) {
+		uint32_t bits = (uint8_t)data[i] << 16;
+		if(i + 1 < data.size()) bits |= (uint8_t)data[i + 1] << 8;
+		if(i + 2 < data.size()) bits |= (uint8_t)data[i + 2];
+
+		text += DIGITS[bits >> 18];
+		text += DIGITS[bits >> 12 & 0x3F];
+		text += i + 1 < data.size() ? DIGITS[bits >> 6 & 0x3F] : '=';
+		text += i + 2 < data.size() ? DIGITS[bits & 0x3F] : '=';
+	}
+
+	return text;
+}
+
+template<typename T>
+void appendTestData(std::vector<char>& data, std::initializer_list<T> values) {
+	for(const T& value : values)
+		data.insert(data.end(), (const char*)&value, (const char*)(&value + 1));
+}
+
+// Checks the packed triangles are clockwise seen from the side their normals face,
+// the tangents are perpendicular to the normals and the bounding sphere holds every vertex
+bool isTestCookedMeshValid(const MeshData& mesh) {
+	const uint32_t stride = MESH_VERTEX_SIZES[(uint8_t)mesh.type];
+	auto getPosition = [&mesh, stride](uint32_t index) {
+		float position[3];
+		memcpy(position, mesh.vertices.data() + (uint64_t)index * stride, sizeof(position));
+		return DirectX::XMFLOAT3(position[0], position[1], position[2]);
+	};
+	auto getHalf3 = [&mesh, stride](uint32_t index, uint32_t offset) {
+		DirectX::PackedVector::HALF half[3];
+		memcpy(half, mesh.vertices.data() + (uint64_t)index * stride + offset, sizeof(half));
+		return DirectX::XMFLOAT3(
+			DirectX::PackedVector::XMConvertHalfToFloat(half[0]),
+			DirectX::PackedVector::XMConvertHalfToFloat(half[1]),
+			DirectX::PackedVector::XMConvertHalfToFloat(half[2])
+		);
+	};
+
+	bool valid = true;
+	for(uint32_t i = 0; i < mesh.vertexCounts[0]; ++i) {
+		const DirectX::XMFLOAT3 p = getPosition(i), n = getHalf3(i, 12), t = getHalf3(i, 20);
+		valid &= fabsf(n.x * n.x + n.y * n.y + n.z * n.z - 1.0f) < 0.01f;
+		valid &= fabsf(t.x * t.x + t.y * t.y + t.z * t.z - 1.0f) < 0.01f;
+		valid &= fabsf(n.x * t.x + n.y * t.y + n.z * t.z) < 0.01f;
+
+		const float dx = p.x - mesh.boundingSphere[0], dy = p.y - mesh.boundingSphere[1], dz = p.z - mesh.boundingSphere[2];
+		valid &= sqrtf(dx * dx + dy * dy + dz * dz) <= mesh.boundingSphere[3] * 1.0001f;
+	}
+
+	for(uint32_t i = 0; i < mesh.indexCounts[0]; i += 3) {
+		const DirectX::XMFLOAT3 a = getPosition(mesh.indices[i]), b = getPosition(mesh.indices[i + 1]), c = getPosition(mesh.indices[i + 2]);
+		const DirectX::XMFLOAT3 n = getHalf3(mesh.indices[i], 12);
+		const float e1[3]{ b.x - a.x, b.y - a.y, b.z - a.z }, e2[3]{ c.x - a.x, c.y - a.y, c.z - a.z };
+		const float faceNormal[3]{ e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+		valid &= faceNormal[0] * n.x + faceNormal[1] * n.y + faceNormal[2] * n.z < 0.0f;
+	}
+
+	return valid;
+}
+
+void testModelCooking() {
+	// JSON
+	{
+		const char* text = "{ \"a\": [1, -2.5e1, \"\\u00e9\\ud83d\\ude00\"], \"b\": true, \"c\": null }";
+		JsonValue value;
+		bool valid = parseJson(text, strlen(text), value);
+		valid = valid && value.find("a") && value.find("a")->elements.size() == 3;
+		valid = valid && value.find("a")->at(1)->number == -25.0 && value.find("a")->at(2)->string == "\xC3\xA9\xF0\x9F\x98\x80";
+		valid = valid && value.find("b")->boolean && value.find("c")->type == JSON_TYPE::NUL;
+
+		for(const char* invalid : { "[1,]", "{\"a\" 1}", "01", "[1] 2", "\"\\x\"", "-", "1." })
+			valid &= !parseJson(invalid, strlen(invalid), value);
+
+		// Expected valid
+		std::cout << "JSON: " << (valid ? "valid" : "invalid") << std::endl;
+	}
+
+	// A glTF quad facing up, moved up by its node
+	{
+		std::vector<char> buffer;
+		appendTestData<float>(buffer, { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, -1.0f });
+		appendTestData<float>(buffer, { 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f });
+		appendTestData<float>(buffer, { 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f });
+		appendTestData<uint16_t>(buffer, { 0, 1, 2, 0, 2, 3 });
+
+		const std::string text = R"({
+			"asset": { "version": "2.0" },
+			"scene": 0,
+			"scenes": [{ "nodes": [0] }],
+			"nodes": [{ "name": "Quad", "mesh": 0, "translation": [0, 1, 0] }],
+			"meshes": [{ "primitives": [{ "attributes": { "POSITION": 0, "NORMAL": 1, "TEXCOORD_0": 2 }, "indices": 3 }] }],
+			"accessors": [
+				{ "bufferView": 0, "componentType": 5126, "count": 4, "type": "VEC3" },
+				{ "bufferView": 1, "componentType": 5126, "count": 4, "type": "VEC3" },
+				{ "bufferView": 2, "componentType": 5126, "count": 4, "type": "VEC2" },
+				{ "bufferView": 3, "componentType": 5123, "count": 6, "type": "SCALAR" }
+			],
+			"bufferViews": [
+				{ "buffer": 0, "byteOffset": 0, "byteLength": 48 },
+				{ "buffer": 0, "byteOffset": 48, "byteLength": 48 },
+				{ "buffer": 0, "byteOffset": 96, "byteLength": 32 },
+				{ "buffer": 0, "byteOffset": 128, "byteLength": 12 }
+			],
+			"buffers": [{ "byteLength": 140, "uri": "data:application/octet-stream;base64,)" + getTestBase64(buffer) + R"(" }]
+		})";
+
+		ImportedModel model;
+		MeshData mesh;
+		bool valid = importGLTF(text.data(), text.size(), "", model) && model.meshes.size() == 1 && model.meshes[0].name == "Quad";
+		valid = valid && cookMesh(model.meshes.data(), 1, MESH_TYPE::STATIC, mesh);
+		valid = valid && mesh.vertexCounts[0] == 4 && mesh.indexCounts[0] == 6 && isTestCookedMeshValid(mesh);
+
+		// Y up becomes Z up, the tangent follows u along X
+		for(uint32_t i = 0; valid && i < mesh.vertexCounts[0]; ++i) {
+			const RIN::StaticVertex* vertex = (const RIN::StaticVertex*)mesh.vertices.data() + i;
+			valid &= vertex->position.z == 1.0f && DirectX::PackedVector::XMConvertHalfToFloat(vertex->normalZ) == 1.0f;
+			valid &= DirectX::PackedVector::XMConvertHalfToFloat(vertex->tangentX) == 1.0f;
+			valid &= DirectX::PackedVector::XMConvertHalfToFloat(vertex->texY) == vertex->position.y;
+		}
+
+		// Expected valid
+		std::cout << "glTF quad: " << (valid ? "valid" : "invalid") << std::endl;
+	}
+
+	// A glTF triangle skinned to two joints, listed child first so they are reordered
+	{
+		std::vector<char> buffer;
+		appendTestData<float>(buffer, { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f });
+		appendTestData<uint8_t>(buffer, { 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0 });
+		appendTestData<float>(buffer, { 1.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.75f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f });
+		// Inverse bind matrices, the child is 1 above the root
+		appendTestData<float>(buffer, { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, -1.0f, 0.0f, 1.0f });
+		appendTestData<float>(buffer, { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f });
+
+		const std::string text = R"({
+			"asset": { "version": "2.0" },
+			"nodes": [
+				{ "name": "Body", "mesh": 0, "skin": 0 },
+				{ "name": "Root", "children": [2] },
+				{ "name": "Child", "translation": [0, 1, 0] }
+			],
+			"skins": [{ "joints": [2, 1], "inverseBindMatrices": 3 }],
+			"meshes": [{ "primitives": [{ "attributes": { "POSITION": 0, "JOINTS_0": 1, "WEIGHTS_0": 2 } }] }],
+			"accessors": [
+				{ "bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3" },
+				{ "bufferView": 1, "componentType": 5121, "count": 3, "type": "VEC4" },
+				{ "bufferView": 2, "componentType": 5126, "count": 3, "type": "VEC4" },
+				{ "bufferView": 3, "componentType": 5126, "count": 2, "type": "MAT4" }
+			],
+			"bufferViews": [
+				{ "buffer": 0, "byteOffset": 0, "byteLength": 36 },
+				{ "buffer": 0, "byteOffset": 36, "byteLength": 12 },
+				{ "buffer": 0, "byteOffset": 48, "byteLength": 48 },
+				{ "buffer": 0, "byteOffset": 96, "byteLength": 128 }
+			],
+			"buffers": [{ "byteLength": 224, "uri": "data:application/octet-stream;base64,)" + getTestBase64(buffer) + R"(" }]
+		})";
+
+		ImportedModel model;
+		MeshData mesh;
+		bool valid = importGLTF(text.data(), text.size(), "", model) && model.meshes.size() == 1 && model.bones.size() == 2;
+		valid = valid && model.bones[0].name == "Root" && model.bones[1].name == "Child" && model.bones[1].parent == 0;
+		// The child is 1 above the root, which is along Z once converted
+		valid = valid && fabsf(model.bones[1].restMatrix[14] - 1.0f) < 1e-6f && fabsf(model.bones[1].restMatrix[13]) < 1e-6f;
+		valid = valid && cookMesh(model.meshes.data(), 1, MESH_TYPE::SKINNED, mesh);
+		valid = valid && mesh.vertexCounts[0] == 3 && isTestCookedMeshValid(mesh);
+
+		// Joint 0 is the child, which is bone 1
+		const uint8_t expected[3][2]{ { 0, 255 }, { 191, 64 }, { 255, 0 } };
+		for(uint32_t i = 0; valid && i < mesh.vertexCounts[0]; ++i) {
+			const RIN::SkinnedVertex* vertex = (const RIN::SkinnedVertex*)mesh.vertices.data() + i;
+			const uint32_t source = vertex->position.x == 1.0f ? 1 : vertex->position.z == 1.0f ? 2 : 0;
+			const uint8_t* indices = &vertex->boneIndices.x;
+			const uint8_t* weights = &vertex->boneWeights.x;
+
+			uint8_t boneWeights[2]{};
+			uint32_t sum = 0;
+			for(uint32_t j = 0; j < MAX_BONE_INFLUENCES; ++j) {
+				if(weights[j]) boneWeights[indices[j]] += weights[j];
+				sum += weights[j];
+			}
+			valid &= sum == 255 && boneWeights[0] == expected[source][0] && boneWeights[1] == expected[source][1];
+		}
+
+		std::vector<char> armature;
+		writeArmature(model.bones.data(), (uint32_t)model.bones.size(), armature);
+		valid &= armature.size() == 1 + sizeof(float) * 16 + 2 + sizeof(float) * 16 && armature[0] == 2;
+
+		// Expected valid
+		std::cout << "glTF skinned triangle: " << (valid ? "valid" : "invalid") << std::endl;
+	}
+
+	// An OBJ cube without normals, the last face uses relative indices, and a second object
+	{
+		const std::string text =
+			"# Cube\n"
+			"o Cube\n"
+			"v 1 1 -1\nv 1 -1 -1\nv 1 1 1\nv 1 -1 1\nv -1 1 -1\nv -1 -1 -1\nv -1 1 1\nv -1 -1 1\n"
+			"f 1 5 7 3\nf 4 3 7 8\nf 8 7 5 6\nf 6 2 4 8\nf 2 1 3 4\nf -3 -4 -8 -7\n"
+			"o Triangle\r\n"
+			"vt 0 0\r\nvt 1 0\r\nvt 0 1\r\n"
+			"f 1/1 2/2 3/3\r\n";
+
+		ImportedModel model;
+		MeshData mesh;
+		bool valid = importOBJ(text.data(), text.size(), model) && model.meshes.size() == 2;
+		valid = valid && model.meshes[0].name == "Cube" && model.meshes[1].name == "Triangle" && model.meshes[1].texCoords.size() == 6;
+		valid = valid && cookMesh(model.meshes.data(), 1, MESH_TYPE::DYNAMIC, mesh);
+		valid = valid && mesh.vertexCounts[0] == 8 && mesh.indexCounts[0] == 36 && isTestCookedMeshValid(mesh);
+
+		// Generated normals point out of the cube
+		for(uint32_t i = 0; valid && i < mesh.vertexCounts[0]; ++i) {
+			const RIN::DynamicVertex* vertex = (const RIN::DynamicVertex*)mesh.vertices.data() + i;
+			valid &= vertex->position.x * DirectX::PackedVector::XMConvertHalfToFloat(vertex->normalX) +
+				vertex->position.y * DirectX::PackedVector::XMConvertHalfToFloat(vertex->normalY) +
+				vertex->position.z * DirectX::PackedVector::XMConvertHalfToFloat(vertex->normalZ) > 1.5f;
+		}
+
+		// A corner of the cube is about sqrt(3) from its center
+		valid = valid && mesh.boundingSphere[3] < 1.75f;
+
+		for(const char* invalid : { "f 1 2 3\n", "v 1 2\n", "v 0 0 0\nf 1 1/2 1\n" })
+			valid &= !importOBJ(invalid, strlen(invalid), model);
+
+		// Expected valid
+		std::cout << "OBJ cube: " << (valid ? "valid" : "invalid") << std::endl;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "FilePool.hpp"
+#include "Pack.hpp"
+#include "TextureFormat.hpp"
+
+void testPack() {
+	std::vector<std::string> fileNames, entryNames;
+	for(const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator("../res")) {
+		if(!entry.is_regular_file() || entry.path().extension() == ".rpak") continue;
+
+		fileNames.push_back(entry.path().string());
+		entryNames.push_back(std::filesystem::relative(entry.path(), "../res").generic_string());
+	}
+
+	// Pack the resources into a temporary archive, the same way the Packer does
+	const std::string packFileName = (std::filesystem::temp_directory_path() / "test.rpak").string();
+	{
+		std::vector<PackFile> packFiles(fileNames.size());
+		for(size_t i = 0; i < fileNames.size(); ++i) {
+			std::ifstream stream(fileNames[i], std::ios::binary);
+			packFiles[i].name = entryNames[i];
+			packFiles[i].data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+			packFiles[i].type = getPackEntryType(fileNames[i]);
+		}
+
+		std::vector<char> data;
+		const bool written = writePack(packFiles.data(), (uint32_t)packFiles.size(), data);
+		std::ofstream(packFileName, std::ios::binary).write(data.data(), data.size());
+
+		// Expected written
+		std::cout << fileNames.size() << " files: " << (written ? "written" : "unsupported") << ", " << data.size() << " bytes" << std::endl;
+	}
+
+	// Loose files, one request per file
+	FilePool filePool;
+	std::vector<FilePool::File> files(fileNames.size());
+
+	auto start = std::chrono::steady_clock::now();
+	for(size_t i = 0; i < fileNames.size(); ++i)
+		filePool.readFile(fileNames[i].c_str(), files[i]);
+	filePool.wait();
+	std::chrono::duration<float, std::milli> looseElapsed = std::chrono::steady_clock::now() - start;
+
+	// The archive, one request in total
+	Pack pack;
+
+	start = std::chrono::steady_clock::now();
+	pack.read(filePool, packFileName.c_str());
+	filePool.wait();
+	std::chrono::duration<float, std::milli> packElapsed = std::chrono::steady_clock::now() - start;
+
+	if(!pack.valid()) {
+		std::cout << packFileName << " is invalid" << std::endl;
+		std::filesystem::remove(packFileName);
+		return;
+	}
+
+	uint32_t found = 0, matched = 0, aligned = 0;
+	for(size_t i = 0; i < entryNames.size(); ++i) {
+		const PackEntry* entry = pack.find(entryNames[i].c_str());
+		if(!entry) continue;
+		++found;
+
+		// Textures are packed as their subresources, without the file header
+		std::vector<char> expected(files[i].data(), files[i].data() + files[i].size());
+		TextureView view;
+		if(entry->type == PACK_ENTRY_TYPE::TEXTURE && parseTexture(files[i].data(), files[i].size(), view)) {
+			expected.resize(view.size());
+			copyTextureData(view, expected.data());
+		}
+
+		if(entry->size == expected.size() && !memcmp(pack.data(*entry), expected.data(), entry->size)) ++matched;
+		if(entry->offset % PACK_ALIGNMENT == 0) ++aligned;
+	}
+
+	std::cout << "Loose: " << looseElapsed.count() << " ms" << std::endl;
+	std::cout << "Pack: " << packElapsed.count() << " ms" << std::endl;
+	// Expected every entry found, matching, and aligned
+	std::cout << entryNames.size() << " files, " << found << " found, " << matched << " matched, " << aligned << " aligned" << std::endl;
+	// Expected missing
+	std::cout << (pack.find("missing.dds") ? "found" : "missing") << std::endl;
+
+	// An entry which points past the end of the archive is rejected when the archive is loaded
+	{
+		std::ifstream stream(packFileName, std::ios::binary);
+		std::vector<char> data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		const PackHeader* header = (const PackHeader*)data.data();
+		PackEntry* table = (PackEntry*)(data.data() + sizeof(PackHeader));
+		for(uint32_t i = 0; i < header->tableSize; ++i) {
+			if(table[i].type == PACK_ENTRY_TYPE::EMPTY) continue;
+
+			table[i].size = data.size() - table[i].offset + 1;
+			break;
+		}
+
+		const std::string corruptFileName = (std::filesystem::temp_directory_path() / "corrupt.rpak").string();
+		std::ofstream(corruptFileName, std::ios::binary).write(data.data(), data.size());
+
+		Pack corrupt;
+		corrupt.read(filePool, corruptFileName.c_str());
+		filePool.wait();
+		std::filesystem::remove(corruptFileName);
+
+		// Expected rejected
+		std::cout << (corrupt.valid() ? "accepted" : "rejected") << std::endl;
+	}
+
+	pack.close();
+	std::filesystem::remove(packFileName);
+}
\ No newline at end of file
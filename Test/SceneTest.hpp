@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "SceneFile.hpp"
+
+// Compile the scene first with: Cooker --output=../res/scenes ../res/scenes/Test.json
+constexpr const char* SCENE_SOURCE_NAME = "../res/scenes/Test.json";
+constexpr const char* SCENE_FILE_NAME = "../res/scenes/Test.rscn";
+
+std::vector<char> readTestFile(const char* fileName) {
+	std::ifstream stream(fileName, std::ios::binary);
+	return std::vector<char>((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+}
+
+bool parseTestScene(const std::string& source) {
+	SceneData scene;
+	return parseScene(source.data(), source.size(), scene);
+}
+
+void testSceneFiles() {
+	const std::vector<char> source = readTestFile(SCENE_SOURCE_NAME);
+	SceneData scene;
+	if(!parseScene(source.data(), source.size(), scene)) {
+		std::cout << SCENE_SOURCE_NAME << " is missing or invalid" << std::endl;
+		return;
+	}
+
+	// The compiled scene is up to date and reads back to the same scene
+	{
+		std::vector<char> data;
+		writeScene(scene, data);
+		const std::vector<char> file = readTestFile(SCENE_FILE_NAME);
+
+		SceneData read;
+		std::vector<char> rewritten;
+		const bool valid = readScene(file.data(), file.size(), read);
+		if(valid) writeScene(read, rewritten);
+
+		// Expected up to date, valid
+		std::cout << SCENE_FILE_NAME << ": " << (file == data ? "up to date" : "out of date") << ", " << (valid && rewritten == file ? "valid" : "invalid") << std::endl;
+	}
+
+	// Names are resolved to indices and the textures a material does not use are left out
+	{
+		const SceneMaterial& sheen = scene.materials[4];
+		const SceneObject& skinned = scene.skinnedObjects[0];
+		const bool resolved = sheen.type == RIN::MATERIAL_TYPE::PBR_SHEEN && sheen.textures[3] == SCENE_NONE &&
+			scene.textures[sheen.textures[5]].path == SCENE_NONE && scene.textures[sheen.textures[5]].color[2] == 224 &&
+			scene.meshes[skinned.mesh].type == MESH_TYPE::SKINNED && skinned.armature == 0 &&
+			scene.staticObjects[0].armature == SCENE_NONE && !strcmp(scene.string(scene.armatures[0].path), "../armatures/Armature.arm");
+
+		// Expected resolved
+		std::cout << scene.staticObjects.size() << " static, " << scene.dynamicObjects.size() << " dynamic, " << scene.skinnedObjects.size() << " skinned objects, ";
+		std::cout << (resolved ? "resolved" : "unresolved") << std::endl;
+	}
+
+	// Broken references and files are rejected
+	{
+		const std::string textures = R"("textures": [ { "name": "white", "format": "R8_UNORM", "color": [ 255 ] } ],)";
+		const std::string materials = R"("materials": [ { "name": "flat", "type": "standard", "baseColor": "white", "normal": "white", "roughnessAO": "white", "metallic": "white", "height": "white" } ],)";
+		const std::string meshes = R"("meshes": [ { "name": "Torus", "file": "Torus0.dmesh" } ],)";
+
+		uint32_t rejected = 0;
+		// Expected accepted
+		const bool accepted = parseTestScene("{" + textures + materials + meshes + R"("dynamicObjects": [ { "mesh": "Torus", "material": "flat" } ] })");
+		// Unknown texture
+		if(!parseTestScene("{" + textures + R"("skybox": { "texture": "white", "diffuse": "white", "specular": "black" } })")) ++rejected;
+		// Standard material without a normal map
+		if(!parseTestScene(R"({ "textures": [ { "name": "white", "format": "R8_UNORM", "color": [ 255 ] } ], "materials": [ { "name": "flat", "type": "standard", "baseColor": "white" } ] })")) ++rejected;
+		// Dynamic mesh used by a static object
+		if(!parseTestScene("{" + textures + materials + meshes + R"("staticObjects": [ { "mesh": "Torus", "material": "flat" } ] })")) ++rejected;
+		// Streamed dynamic mesh
+		if(!parseTestScene(R"({ "meshes": [ { "name": "Torus", "file": "Torus0.dmesh", "streamed": true } ] })")) ++rejected;
+		// Constant texture with the wrong number of channels
+		if(!parseTestScene(R"({ "textures": [ { "name": "white", "format": "R8G8B8A8_UNORM", "color": [ 255 ] } ] })")) ++rejected;
+		// Duplicate name
+		if(!parseTestScene(R"({ "textures": [ { "name": "white", "file": "a.dds" }, { "name": "white", "file": "b.dds" } ] })")) ++rejected;
+
+		std::vector<char> data;
+		writeScene(scene, data);
+		SceneData read;
+		// Truncated
+		if(!readScene(data.data(), data.size() - 1, read)) ++rejected;
+		// Material of the first static object out of range
+		{
+			std::vector<char> corrupt = data;
+			const uint64_t offset = sizeof(SceneHeader) + scene.textures.size() * sizeof(SceneTexture) + scene.materials.size() * sizeof(SceneMaterial) +
+				scene.meshes.size() * sizeof(SceneMesh) + scene.armatures.size() * sizeof(SceneArmature) + offsetof(SceneObject, material);
+			const uint32_t material = (uint32_t)scene.materials.size();
+			memcpy(corrupt.data() + offset, &material, sizeof(material));
+			if(!readScene(corrupt.data(), corrupt.size(), read)) ++rejected;
+		}
+
+		// Expected accepted, 8 of 8 rejected
+		std::cout << (accepted ? "accepted" : "rejected") << ", " << rejected << " of 8 rejected" << std::endl;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <Skeleton.hpp>
+
+// Appends a bone of a .arm file, the root is written without its index and parent
+void appendTestBone(std::vector<char>& data, uint8_t index, uint8_t parent, DirectX::CXMMATRIX restMatrix) {
+	if(index) {
+		data.push_back((char)index);
+		data.push_back((char)parent);
+	}
+
+	DirectX::XMFLOAT4X4 matrix;
+	DirectX::XMStoreFloat4x4(&matrix, restMatrix);
+	data.insert(data.end(), (const char*)&matrix, (const char*)(&matrix + 1));
+}
+
+bool isTestMatrixEqual(DirectX::FXMMATRIX A, DirectX::CXMMATRIX B, float tolerance) {
+	DirectX::XMFLOAT4X4 a, b;
+	DirectX::XMStoreFloat4x4(&a, A);
+	DirectX::XMStoreFloat4x4(&b, B);
+	for(uint32_t i = 0; i < 4; ++i)
+		for(uint32_t j = 0; j < 4; ++j)
+			if(fabsf(a.m[i][j] - b.m[i][j]) > tolerance) return false;
+
+	return true;
+}
+
+void testSkeleton() {
+	std::mt19937 random(0);
+	std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+	std::ifstream stream("../res/armatures/Armature.arm", std::ios::binary);
+	std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	RIN::Skeleton skeleton;
+	if(!skeleton.load(file.data(), file.size())) {
+		std::cout << "Armature.arm: invalid" << std::endl;
+		return;
+	}
+
+	// Parents come first, every bone of the file appears once and the inverse rest matrices invert
+	{
+		const uint32_t boneCount = skeleton.getBoneCount();
+		const uint8_t* parents = skeleton.getParents();
+		const uint8_t* boneIndices = skeleton.getBoneIndices();
+		std::vector<bool> found(boneCount);
+		bool valid = boneCount == (uint8_t)file[0] && !parents[0] && !boneIndices[0];
+		for(uint32_t i = 0; i < boneCount && valid; ++i) {
+			valid &= (!i || parents[i] < i) && boneIndices[i] < boneCount && !found[boneIndices[i]];
+			found[boneIndices[i]] = true;
+
+			const DirectX::XMMATRIX M = DirectX::XMMatrixMultiply(skeleton.getRestMatrices()[i], skeleton.getInvRestMatrices()[i]);
+			valid &= isTestMatrixEqual(M, DirectX::XMMatrixIdentity(), 0.0001f);
+		}
+
+		// Expected valid
+		std::cout << "Armature.arm: " << boneCount << " bones, " << (valid ? "valid" : "invalid") << std::endl;
+	}
+
+	// Posing matches walking the bones of the file up to the root
+	{
+		const uint32_t boneCount = skeleton.getBoneCount();
+		std::vector<uint8_t> parents(boneCount);
+		std::vector<DirectX::XMMATRIX> restMatrices(boneCount);
+		DirectX::XMFLOAT4X4 matrix;
+		memcpy(&matrix, file.data() + 1, sizeof(matrix));
+		restMatrices[0] = DirectX::XMLoadFloat4x4(&matrix);
+		for(uint32_t i = 1; i < boneCount; ++i) {
+			const char* bone = file.data() + 1 + sizeof(matrix) + (i - 1) * (2 + sizeof(matrix));
+			parents[(uint8_t)bone[0]] = (uint8_t)bone[1];
+			memcpy(&matrix, bone + 2, sizeof(matrix));
+			restMatrices[(uint8_t)bone[0]] = DirectX::XMLoadFloat4x4(&matrix);
+		}
+
+		std::vector<DirectX::XMMATRIX> localMatrices(boneCount);
+		for(DirectX::XMMATRIX& M : localMatrices)
+			M = DirectX::XMMatrixRotationRollPitchYaw(unit(random) * 0.5f, unit(random) * 0.5f, unit(random) * 0.5f);
+		const DirectX::XMMATRIX rootMatrix = DirectX::XMMatrixMultiply(DirectX::XMMatrixRotationZ(DirectX::XM_PI), DirectX::XMMatrixTranslation(3.5f, -10.0f, 0.0f));
+
+		std::vector<DirectX::XMMATRIX> worldMatrices(boneCount), restWorldMatrices(boneCount);
+		skeleton.computeWorldMatrices(rootMatrix, localMatrices.data(), worldMatrices.data());
+		skeleton.computeWorldMatrices(rootMatrix, nullptr, restWorldMatrices.data());
+
+		bool valid = true;
+		for(uint32_t i = 0; i < boneCount; ++i) {
+			DirectX::XMMATRIX expected = DirectX::XMMatrixIdentity();
+			for(uint32_t bone = i;; bone = parents[bone]) {
+				const DirectX::XMMATRIX pose = DirectX::XMMatrixMultiply(DirectX::XMMatrixMultiply(
+					DirectX::XMMatrixInverse(nullptr, restMatrices[bone]), localMatrices[bone]), restMatrices[bone]);
+				expected = DirectX::XMMatrixMultiply(expected, pose);
+				if(!bone) break;
+			}
+			expected = DirectX::XMMatrixMultiply(expected, rootMatrix);
+
+			valid &= isTestMatrixEqual(worldMatrices[i], expected, 0.001f);
+			valid &= isTestMatrixEqual(restWorldMatrices[i], rootMatrix, 0.0001f);
+		}
+
+		// Instancing only poses, the file is loaded once
+		constexpr uint32_t INSTANCE_COUNT = 1000;
+		auto start = std::chrono::high_resolution_clock::now();
+		for(uint32_t i = 0; i < INSTANCE_COUNT; ++i)
+			skeleton.computeWorldMatrices(rootMatrix, localMatrices.data(), worldMatrices.data());
+		const float poseMicroseconds = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - start).count() / INSTANCE_COUNT;
+
+		RIN::Skeleton loaded;
+		start = std::chrono::high_resolution_clock::now();
+		for(uint32_t i = 0; i < INSTANCE_COUNT; ++i)
+			valid &= loaded.load(file.data(), file.size());
+		const float loadMicroseconds = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - start).count() / INSTANCE_COUNT;
+
+		// Expected valid
+		std::cout << "Armature.arm pose: " << (valid ? "valid" : "invalid") << ", " << loadMicroseconds << " us to load, ";
+		std::cout << poseMicroseconds << " us to pose" << std::endl;
+	}
+
+	// Bones may come in any order as long as they lead back to the root
+	{
+		std::vector<char> data{ 4 };
+		appendTestBone(data, 0, 0, DirectX::XMMatrixIdentity());
+		appendTestBone(data, 3, 2, DirectX::XMMatrixTranslation(0.0f, 0.0f, 3.0f));
+		appendTestBone(data, 2, 1, DirectX::XMMatrixTranslation(0.0f, 0.0f, 2.0f));
+		appendTestBone(data, 1, 0, DirectX::XMMatrixTranslation(0.0f, 0.0f, 1.0f));
+
+		RIN::Skeleton chain;
+		bool valid = chain.load(data.data(), data.size()) && chain.getBoneCount() == 4;
+		for(uint32_t i = 0; valid && i < 4; ++i)
+			valid &= chain.getBoneIndices()[i] == i && chain.getParents()[i] == (i ? i - 1 : 0);
+
+		// Each invalid file is a single change to the chain
+		auto invalid = [&data](size_t offset, char value) {
+			std::vector<char> changed = data;
+			changed[offset] = value;
+			RIN::Skeleton rejected;
+			return !rejected.load(changed.data(), changed.size()) && !rejected.getBoneCount();
+		};
+		constexpr size_t BONE_START = 1 + sizeof(DirectX::XMFLOAT4X4);
+		constexpr size_t BONE_SIZE = 2 + sizeof(DirectX::XMFLOAT4X4);
+		valid &= invalid(0, 0); // No bones
+		valid &= invalid(0, 5); // Size does not match
+		valid &= invalid(BONE_START, 2); // Bone 2 twice
+		valid &= invalid(BONE_START, 0); // Root twice
+		valid &= invalid(BONE_START + 1, 4); // Parent out of range
+		valid &= invalid(BONE_START + 1, 3); // Own parent
+		valid &= invalid(BONE_START + BONE_SIZE * 2 + 1, 3); // 1, 2 and 3 form a cycle
+
+		// A rest matrix of zeros can not be inverted
+		std::vector<char> singular = data;
+		memset(singular.data() + 1, 0, sizeof(DirectX::XMFLOAT4X4));
+		RIN::Skeleton rejected;
+		valid &= !rejected.load(singular.data(), singular.size());
+		valid &= !rejected.load(data.data(), data.size() - 1);
+
+		// Expected valid
+		std::cout << "Unordered chain: " << (valid ? "valid" : "invalid") << std::endl;
+	}
+}
\ No newline at end of file
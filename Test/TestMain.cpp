@@ -0,0 +1,87 @@
+// Console entry point for the tests which do not need a window, see CMakeLists.txt
+// Pass the name of a test group, for example: RINTest upload
+
+#include <cstring>
+#include <iostream>
+
+#include "UploadTest.hpp"
+#include "FileTest.hpp"
+#include "PackTest.hpp"
+#ifdef RIN_DIRECTXMATH
+#include "MeshTest.hpp"
+#include "SkeletonTest.hpp"
+#include "TextureTest.hpp"
+#include "SceneTest.hpp"
+#endif
+
+int main(int argc, char** argv) {
+	if(argc != 2) {
+		std::cout << "Usage: RINTest <group>" << std::endl;
+		return 1;
+	}
+
+	const char* group = argv[1];
+	if(!strcmp(group, "upload")) {
+		std::cout << "--- Upload Chunker Buffer ---" << std::endl;
+		testUploadChunkerBuffer();
+		std::cout << "--- Upload Chunker Texture ---" << std::endl;
+		testUploadChunkerTexture();
+		std::cout << "--- Upload Coalescer ---" << std::endl;
+		testUploadCoalescer();
+		std::cout << "--- Upload Scheduler ---" << std::endl;
+		testUploadScheduler();
+		std::cout << "--- Texture Streamer ---" << std::endl;
+		testTextureStreamer();
+	} else if(!strcmp(group, "file")) {
+		std::cout << "--- File Pool ---" << std::endl;
+		testFilePool();
+	} else if(!strcmp(group, "pack")) {
+		std::cout << "--- Pack ---" << std::endl;
+		testPack();
+#ifdef RIN_DIRECTXMATH
+	} else if(!strcmp(group, "mesh")) {
+		std::cout << "--- Vertex Codec ---" << std::endl;
+		testVertexCodec();
+		std::cout << "--- Index Codec ---" << std::endl;
+		testIndexCodec();
+		std::cout << "--- Index Narrowing ---" << std::endl;
+		testIndexNarrowing();
+		std::cout << "--- Vertex Quantization ---" << std::endl;
+		testVertexQuantization();
+		std::cout << "--- Bounds ---" << std::endl;
+		testBounds();
+		std::cout << "--- Posed Bounds ---" << std::endl;
+		testPosedBounds();
+		std::cout << "--- Mesh Files ---" << std::endl;
+		testMeshFiles();
+		std::cout << "--- Mesh Optimization ---" << std::endl;
+		testMeshOptimization();
+		std::cout << "--- Mesh Simplification ---" << std::endl;
+		testMeshSimplification();
+		std::cout << "--- Shared LOD Vertices ---" << std::endl;
+		testSharedLODVertices();
+		std::cout << "--- Model Cooking ---" << std::endl;
+		testModelCooking();
+	} else if(!strcmp(group, "skeleton")) {
+		std::cout << "--- Skeleton ---" << std::endl;
+		testSkeleton();
+	} else if(!strcmp(group, "texture")) {
+		std::cout << "--- Texture Parsing ---" << std::endl;
+		testTextureParsing();
+		std::cout << "--- Texture Files ---" << std::endl;
+		testTextureFiles();
+		std::cout << "--- Block Compression ---" << std::endl;
+		testBlockCompression();
+		std::cout << "--- Block Compression Throughput ---" << std::endl;
+		testBlockCompressionThroughput();
+	} else if(!strcmp(group, "scene")) {
+		std::cout << "--- Scene Files ---" << std::endl;
+		testSceneFiles();
+#endif
+	} else {
+		std::cout << "Unknown test group: " << group << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
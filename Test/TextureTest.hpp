@@ -0,0 +1,661 @@
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <DirectXPackedVector.h>
+
+#include <BlockCompression.hpp>
+#include <ThreadPool.hpp>
+
+#include "TextureFormat.hpp"
+
+// Every subresource is filled with its index plus 1 so the views can be checked
+uint64_t getTestSubresourceSize(RIN::TEXTURE_FORMAT format, uint32_t width, uint32_t height, uint32_t mip) {
+	return RIN::Texture::getRowPitch(std::max(width >> mip, (uint32_t)1), format) *
+		RIN::Texture::getRowCount(std::max(height >> mip, (uint32_t)1), format);
+}
+
+void write32(std::vector<char>& file, uint64_t offset, uint32_t value) {
+	memcpy(file.data() + offset, &value, sizeof(value));
+}
+
+void write64(std::vector<char>& file, uint64_t offset, uint64_t value) {
+	memcpy(file.data() + offset, &value, sizeof(value));
+}
+
+// A DX10 DDS file if dxgiFormat is set, otherwise pixelFormat is written in place of the legacy pixel format
+std::vector<char> makeTestDDS(
+	RIN::TEXTURE_FORMAT format,
+	uint32_t dxgiFormat,
+	const uint32_t* pixelFormat,
+	uint32_t width,
+	uint32_t height,
+	uint32_t mipCount,
+	bool cube
+) {
+	std::vector<char> file(dxgiFormat ? 148 : 128);
+	memcpy(file.data(), "DDS ", 4);
+	write32(file, 4, 124);
+	write32(file, 12, height);
+	write32(file, 16, width);
+	write32(file, 28, mipCount);
+	write32(file, 76, 32);
+
+	if(dxgiFormat) {
+		write32(file, 80, 0x4);
+		memcpy(file.data() + 84, "DX10", 4);
+		write32(file, 128, dxgiFormat);
+		write32(file, 132, 3);
+		write32(file, 136, cube ? 0x4 : 0);
+		write32(file, 140, 1);
+	} else {
+		memcpy(file.data() + 80, pixelFormat, 7 * sizeof(uint32_t));
+		if(cube) write32(file, 112, 0x200 | 0xFC00);
+	}
+
+	for(uint32_t face = 0; face < (cube ? 6u : 1u); ++face)
+		for(uint32_t mip = 0; mip < mipCount; ++mip)
+			file.insert(file.end(), getTestSubresourceSize(format, width, height, mip), (char)(face * mipCount + mip + 1));
+
+	return file;
+}
+
+// Levels are stored from the least detailed up with padding between them, as KTX2 writers do
+std::vector<char> makeTestKTX2(RIN::TEXTURE_FORMAT format, uint32_t vkFormat, uint32_t width, uint32_t height, uint32_t mipCount, uint32_t faceCount) {
+	const char identifier[12]{ (char)0xAB, 'K', 'T', 'X', ' ', '2', '0', (char)0xBB, '\r', '\n', 0x1A, '\n' };
+
+	std::vector<char> file(80 + mipCount * 24);
+	memcpy(file.data(), identifier, sizeof(identifier));
+	write32(file, 12, vkFormat);
+	write32(file, 16, 1);
+	write32(file, 20, width);
+	write32(file, 24, height);
+	write32(file, 36, faceCount);
+	write32(file, 40, mipCount);
+
+	for(uint32_t mip = mipCount; mip-- > 0;) {
+		file.resize((file.size() + 15) & ~(uint64_t)15);
+
+		const uint64_t faceSize = getTestSubresourceSize(format, width, height, mip);
+		write64(file, 80 + mip * 24, file.size());
+		write64(file, 80 + mip * 24 + 8, faceSize * faceCount);
+		write64(file, 80 + mip * 24 + 16, faceSize * faceCount);
+
+		for(uint32_t face = 0; face < faceCount; ++face)
+			file.insert(file.end(), faceSize, (char)(face * mipCount + mip + 1));
+	}
+
+	return file;
+}
+
+// Every subresource view must hold its own fill value
+bool checkTestView(const TextureView& view) {
+	for(uint32_t i = 0; i < view.subresourceCount(); ++i) {
+		const TextureSubresource& subresource = view.subresources[i];
+		for(uint64_t j = 0; j < subresource.size; ++j)
+			if(subresource.data[j] != (char)(i + 1)) return false;
+	}
+
+	// The packed copy must be in subresource order
+	std::vector<char> packed(view.size());
+	copyTextureData(view, packed.data());
+
+	uint64_t offset = 0;
+	for(uint32_t i = 0; i < view.subresourceCount(); ++i) {
+		for(uint64_t j = 0; j < view.subresources[i].size; ++j)
+			if(packed[offset + j] != (char)(i + 1)) return false;
+		offset += view.subresources[i].size;
+	}
+
+	return true;
+}
+
+void testTextureParsing() {
+	TextureView view;
+
+	// DX10 2D texture with the full mip chain, the data stays in the file
+	std::vector<char> file = makeTestDDS(RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB, 99, nullptr, 256, 128, 9, false);
+	bool valid = parseTexture(file.data(), file.size(), view) &&
+		view.type == RIN::TEXTURE_TYPE::TEXTURE_2D && view.format == RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB &&
+		view.width == 256 && view.height == 128 && view.mipCount == 9 && view.contiguous &&
+		view.data() == file.data() + 148 && view.size() == file.size() - 148 && checkTestView(view);
+	std::cout << "DX10 2D: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+	// Truncated
+	std::cout << "DX10 truncated: " << (parseTexture(file.data(), file.size() - 1, view) ? "accepted" : "rejected") << std::endl; // Expected rejected
+	// More mips than the chain has
+	write32(file, 28, 10);
+	std::cout << "DX10 extra mip: " << (parseTexture(file.data(), file.size(), view) ? "accepted" : "rejected") << std::endl; // Expected rejected
+	// BC1 blocks are half the size, so the file has data left over
+	write32(file, 28, 9);
+	write32(file, 128, 71);
+	valid = parseTexture(file.data(), file.size(), view) && view.format == RIN::TEXTURE_FORMAT::BC1_UNORM && view.size() < file.size() - 148;
+	std::cout << "DX10 BC1: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+	// Unsigned and signed BC6H are told apart
+	write32(file, 128, 95);
+	valid = parseTexture(file.data(), file.size(), view) && view.format == RIN::TEXTURE_FORMAT::BC6H_UFLOAT;
+	write32(file, 128, 96);
+	valid = valid && parseTexture(file.data(), file.size(), view) && view.format == RIN::TEXTURE_FORMAT::BC6H_FLOAT;
+	std::cout << "DX10 BC6H: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+
+	// DX10 cube
+	file = makeTestDDS(RIN::TEXTURE_FORMAT::R16B16G16A16_FLOAT, 10, nullptr, 64, 64, 7, true);
+	valid = parseTexture(file.data(), file.size(), view) &&
+		view.type == RIN::TEXTURE_TYPE::TEXTURE_CUBE && view.arraySize == 6 && view.subresourceCount() == 42 &&
+		view.contiguous && checkTestView(view);
+	std::cout << "DX10 cube: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+
+	// Legacy DXT5 and RGBA cube
+	const uint32_t dxt5[7]{ 0x4, 0, 0, 0, 0, 0, 0 };
+	file = makeTestDDS(RIN::TEXTURE_FORMAT::BC3_UNORM, 0, dxt5, 64, 32, 1, false);
+	memcpy(file.data() + 84, "DXT5", 4);
+	valid = parseTexture(file.data(), file.size(), view) &&
+		view.format == RIN::TEXTURE_FORMAT::BC3_UNORM && view.data() == file.data() + 128 && checkTestView(view);
+	std::cout << "Legacy DXT5: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+
+	const uint32_t rgba[7]{ 0x41, 0, 32, 0xFF, 0xFF00, 0xFF0000, 0xFF000000 };
+	file = makeTestDDS(RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, 0, rgba, 16, 16, 5, true);
+	valid = parseTexture(file.data(), file.size(), view) &&
+		view.format == RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM && view.type == RIN::TEXTURE_TYPE::TEXTURE_CUBE && checkTestView(view);
+	std::cout << "Legacy RGBA cube: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+	// Cubes must have every face
+	write32(file, 112, 0x200 | 0x400);
+	std::cout << "Legacy missing faces: " << (parseTexture(file.data(), file.size(), view) ? "accepted" : "rejected") << std::endl; // Expected rejected
+
+	// KTX2 with mips, which are not in subresource order
+	file = makeTestKTX2(RIN::TEXTURE_FORMAT::BC5_UNORM, 141, 128, 128, 8, 1);
+	valid = parseTexture(file.data(), file.size(), view) &&
+		view.format == RIN::TEXTURE_FORMAT::BC5_UNORM && view.mipCount == 8 && !view.contiguous && checkTestView(view);
+	std::cout << "KTX2 2D: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+	// Unsigned BC6H, which has blocks of the same size
+	write32(file, 12, 143);
+	valid = parseTexture(file.data(), file.size(), view) && view.format == RIN::TEXTURE_FORMAT::BC6H_UFLOAT;
+	std::cout << "KTX2 BC6H: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+	// Level size which does not match the format
+	write64(file, 80 + 8, 1);
+	std::cout << "KTX2 level size: " << (parseTexture(file.data(), file.size(), view) ? "accepted" : "rejected") << std::endl; // Expected rejected
+
+	// KTX2 cube without mips, which is in subresource order
+	file = makeTestKTX2(RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB, 43, 32, 32, 1, 6);
+	valid = parseTexture(file.data(), file.size(), view) &&
+		view.type == RIN::TEXTURE_TYPE::TEXTURE_CUBE && view.contiguous && checkTestView(view);
+	std::cout << "KTX2 cube: " << (valid ? "valid" : "invalid") << std::endl; // Expected valid
+	// Supercompressed
+	write32(file, 44, 1);
+	std::cout << "KTX2 supercompressed: " << (parseTexture(file.data(), file.size(), view) ? "accepted" : "rejected") << std::endl; // Expected rejected
+}
+
+void testTextureFiles() {
+	for(const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator("../res")) {
+		std::string extension = entry.path().extension().string();
+		if(extension != ".dds" && extension != ".ktx2") continue;
+
+		std::ifstream stream(entry.path(), std::ios::binary);
+		std::vector<char> file((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+		TextureView view;
+		auto start = std::chrono::steady_clock::now();
+		bool valid = parseTexture(file.data(), file.size(), view);
+		std::chrono::duration<float, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::cout << std::filesystem::relative(entry.path(), "../res").generic_string() << ": ";
+		if(!valid) {
+			std::cout << "invalid" << std::endl;
+			continue;
+		}
+
+		// Expected every file parsed with nothing but the header left over
+		std::cout << view.width << "x" << view.height << ", " << view.mipCount << " mips, ";
+		std::cout << file.size() - view.size() << " header bytes, " << elapsed.count() << " us" << std::endl;
+	}
+}
+
+// Reads a block from the least significant bit up
+class TestBlockReader {
+	uint64_t words[2];
+	uint32_t offset = 0;
+public:
+	TestBlockReader(const char* block) {
+		memcpy(words, block, sizeof(words));
+	}
+
+	uint32_t read(uint32_t bitCount) {
+		uint32_t value = 0;
+		for(uint32_t i = 0; i < bitCount; ++i, ++offset)
+			value |= (uint32_t)(words[offset >> 6] >> (offset & 63) & 1) << i;
+		return value;
+	}
+};
+
+constexpr uint32_t TEST_BC7_WEIGHTS3[8]{ 0, 9, 18, 27, 37, 46, 55, 64 };
+constexpr uint32_t TEST_BC7_WEIGHTS4[16]{ 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+// Subset of each pixel for the first 2 subset partitions, the rest are read from the encoder's blocks
+constexpr uint16_t TEST_BC7_PARTITIONS2[64]{
+	0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+	0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+	0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+	0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+	0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+	0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+	0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+	0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+};
+constexpr uint8_t TEST_BC7_ANCHORS2[64]{
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 2, 8, 2, 2, 8, 8, 15, 2, 8, 2, 2, 8, 8, 2, 2,
+	15, 15, 6, 8, 2, 8, 15, 15, 2, 8, 2, 2, 2, 15, 15, 6,
+	6, 2, 6, 8, 15, 15, 2, 2, 15, 15, 15, 15, 15, 2, 2, 15
+};
+
+void decodeTestBC1(const char* block, uint8_t pixels[16][4]) {
+	uint16_t colors[2];
+	uint32_t indexBits;
+	memcpy(colors, block, 4);
+	memcpy(&indexBits, block + 4, 4);
+
+	uint8_t palette[4][4]{};
+	for(uint32_t i = 0; i < 2; ++i) {
+		const uint32_t r = colors[i] >> 11, g = colors[i] >> 5 & 0x3F, b = colors[i] & 0x1F;
+		palette[i][0] = (uint8_t)(r << 3 | r >> 2);
+		palette[i][1] = (uint8_t)(g << 2 | g >> 4);
+		palette[i][2] = (uint8_t)(b << 3 | b >> 2);
+		palette[i][3] = 255;
+	}
+	for(uint32_t c = 0; c < 3; ++c) {
+		if(colors[0] > colors[1]) {
+			palette[2][c] = (uint8_t)((2 * palette[0][c] + palette[1][c]) / 3);
+			palette[3][c] = (uint8_t)((palette[0][c] + 2 * palette[1][c]) / 3);
+		} else palette[2][c] = (uint8_t)((palette[0][c] + palette[1][c]) / 2);
+	}
+	palette[2][3] = 255;
+	palette[3][3] = colors[0] > colors[1] ? 255 : 0;
+
+	for(uint32_t i = 0; i < 16; ++i)
+		memcpy(pixels[i], palette[indexBits >> (i * 2) & 3], 4);
+}
+
+void decodeTestBC4(const char* block, uint32_t channel, uint8_t pixels[16][4]) {
+	const uint32_t endpoint0 = (uint8_t)block[0], endpoint1 = (uint8_t)block[1];
+	uint64_t indexBits = 0;
+	memcpy(&indexBits, block + 2, 6);
+
+	uint32_t palette[8]{ endpoint0, endpoint1 };
+	if(endpoint0 > endpoint1) {
+		for(uint32_t i = 1; i < 7; ++i)
+			palette[i + 1] = ((7 - i) * endpoint0 + i * endpoint1 + 3) / 7;
+	} else {
+		for(uint32_t i = 1; i < 5; ++i)
+			palette[i + 1] = ((5 - i) * endpoint0 + i * endpoint1 + 2) / 5;
+		palette[6] = 0;
+		palette[7] = 255;
+	}
+
+	for(uint32_t i = 0; i < 16; ++i)
+		pixels[i][channel] = (uint8_t)palette[indexBits >> (i * 3) & 7];
+}
+
+// Only modes 1 and 6, which are the modes the encoder writes
+bool decodeTestBC7(const char* block, uint8_t pixels[16][4]) {
+	TestBlockReader reader(block);
+	uint32_t mode = 0;
+	while(mode < 8 && !reader.read(1)) ++mode;
+
+	auto interpolate = [](uint32_t endpoint0, uint32_t endpoint1, uint32_t weight) {
+		return (uint8_t)(((64 - weight) * endpoint0 + weight * endpoint1 + 32) >> 6);
+	};
+
+	if(mode == 6) {
+		uint32_t endpoints[2][4];
+		for(uint32_t c = 0; c < 4; ++c) {
+			endpoints[0][c] = reader.read(7);
+			endpoints[1][c] = reader.read(7);
+		}
+		for(uint32_t e = 0; e < 2; ++e) {
+			const uint32_t pBit = reader.read(1);
+			for(uint32_t c = 0; c < 4; ++c)
+				endpoints[e][c] = endpoints[e][c] << 1 | pBit;
+		}
+		for(uint32_t i = 0; i < 16; ++i) {
+			const uint32_t index = reader.read(i ? 4 : 3);
+			for(uint32_t c = 0; c < 4; ++c)
+				pixels[i][c] = interpolate(endpoints[0][c], endpoints[1][c], TEST_BC7_WEIGHTS4[index]);
+		}
+		return true;
+	}
+
+	if(mode == 1) {
+		const uint32_t partition = reader.read(6);
+		uint32_t endpoints[2][2][3];
+		for(uint32_t c = 0; c < 3; ++c)
+			for(uint32_t subset = 0; subset < 2; ++subset)
+				for(uint32_t e = 0; e < 2; ++e)
+					endpoints[subset][e][c] = reader.read(6);
+		for(uint32_t subset = 0; subset < 2; ++subset) {
+			const uint32_t pBit = reader.read(1);
+			for(uint32_t e = 0; e < 2; ++e) {
+				for(uint32_t c = 0; c < 3; ++c) {
+					const uint32_t value = endpoints[subset][e][c] << 1 | pBit;
+					endpoints[subset][e][c] = value << 1 | value >> 6;
+				}
+			}
+		}
+		for(uint32_t i = 0; i < 16; ++i) {
+			const uint32_t subset = TEST_BC7_PARTITIONS2[partition] >> i & 1;
+			const uint32_t index = reader.read(i == 0 || i == TEST_BC7_ANCHORS2[partition] ? 2 : 3);
+			for(uint32_t c = 0; c < 3; ++c)
+				pixels[i][c] = interpolate(endpoints[subset][0][c], endpoints[subset][1][c], TEST_BC7_WEIGHTS3[index]);
+			pixels[i][3] = 255;
+		}
+		return true;
+	}
+
+	return false;
+}
+
+// Only signed mode 11, which is the mode the encoder writes
+bool decodeTestBC6H(const char* block, uint16_t pixels[16][3]) {
+	TestBlockReader reader(block);
+	if(reader.read(5) != 0x03) return false;
+
+	int32_t endpoints[2][3];
+	for(uint32_t e = 0; e < 2; ++e) {
+		for(uint32_t c = 0; c < 3; ++c) {
+			// Sign extend, then unquantize
+			int32_t value = (int32_t)(reader.read(10) << 22) >> 22;
+			int32_t magnitude = std::abs(value);
+			if(magnitude >= 511) magnitude = 0x7FFF;
+			else if(magnitude) magnitude = ((magnitude << 15) + 0x4000) >> 9;
+			endpoints[e][c] = value < 0 ? -magnitude : magnitude;
+		}
+	}
+
+	for(uint32_t i = 0; i < 16; ++i) {
+		const int32_t weight = (int32_t)TEST_BC7_WEIGHTS4[reader.read(i ? 4 : 3)];
+		for(uint32_t c = 0; c < 3; ++c) {
+			const int32_t value = ((64 - weight) * endpoints[0][c] + weight * endpoints[1][c] + 32) >> 6;
+			pixels[i][c] = value < 0 ? (uint16_t)(0x8000 | (-value * 31) >> 5) : (uint16_t)((value * 31) >> 5);
+		}
+	}
+	return true;
+}
+
+// Decodes a subresource into RGBA, channels the format does not have are left alone
+bool decodeTestTexture(RIN::TEXTURE_FORMAT format, const char* blocks, uint32_t width, uint32_t height, std::vector<uint8_t>& pixels) {
+	const uint64_t blockSize = RIN::Texture::getRowPitch(1, format);
+	for(uint32_t y = 0; y < height; y += 4) {
+		for(uint32_t x = 0; x < width; x += 4, blocks += blockSize) {
+			uint8_t block[16][4];
+			for(uint32_t i = 0; i < 16; ++i)
+				memcpy(block[i], &pixels[(std::min(y + i / 4, height - 1) * width + std::min(x + i % 4, width - 1)) * 4], 4);
+
+			switch(format) {
+			case RIN::TEXTURE_FORMAT::BC1_UNORM:
+				decodeTestBC1(blocks, block);
+				break;
+			case RIN::TEXTURE_FORMAT::BC4_UNORM:
+				decodeTestBC4(blocks, 0, block);
+				break;
+			case RIN::TEXTURE_FORMAT::BC5_UNORM:
+				decodeTestBC4(blocks, 0, block);
+				decodeTestBC4(blocks + 8, 1, block);
+				break;
+			default:
+				if(!decodeTestBC7(blocks, block)) return false;
+				break;
+			}
+
+			for(uint32_t i = 0; i < 16; ++i)
+				if(x + i % 4 < width && y + i / 4 < height) memcpy(&pixels[((y + i / 4) * width + x + i % 4) * 4], block[i], 4);
+		}
+	}
+	return true;
+}
+
+// Over the first channelCount channels
+float getTestPSNR(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, uint32_t channelCount) {
+	double error = 0.0;
+	for(size_t i = 0; i < a.size(); ++i) {
+		if(i % 4 >= channelCount) continue;
+		const double difference = (double)a[i] - (double)b[i];
+		error += difference * difference;
+	}
+	error /= (double)(a.size() / 4 * channelCount);
+	return error ? (float)(10.0 * std::log10(255.0 * 255.0 / error)) : INFINITY;
+}
+
+// Procedural RGBA with smooth gradients, hard edges and noise, as generated textures tend to have
+std::vector<uint8_t> makeTestImage(uint32_t width, uint32_t height, bool alpha) {
+	std::vector<uint8_t> image((uint64_t)width * height * 4);
+	uint32_t seed = 1;
+	for(uint32_t y = 0; y < height; ++y) {
+		for(uint32_t x = 0; x < width; ++x) {
+			seed = seed * 1664525 + 1013904223;
+			const int32_t noise = (int32_t)(seed >> 28) - 8;
+
+			uint8_t* pixel = &image[((uint64_t)y * width + x) * 4];
+			pixel[0] = (uint8_t)std::clamp((int32_t)(128.0f + 100.0f * std::sin(x * 0.05f) * std::cos(y * 0.03f)) + noise, 0, 255);
+			pixel[1] = (uint8_t)std::clamp((int32_t)((x + y) * 255 / (width + height)) + noise / 2, 0, 255);
+			pixel[2] = ((x / 32 + y / 32) & 1) ? 200 : 40;
+			pixel[3] = alpha ? (uint8_t)(x * 255 / width) : 255;
+		}
+	}
+	return image;
+}
+
+// HDR RGBA halves from 1/64 to 64
+std::vector<uint16_t> makeTestHDRImage(uint32_t width, uint32_t height) {
+	std::vector<uint16_t> image((uint64_t)width * height * 4);
+	for(uint32_t y = 0; y < height; ++y) {
+		for(uint32_t x = 0; x < width; ++x) {
+			const float exposure = std::exp2((float)x / (float)width * 12.0f - 6.0f);
+			const float color[4]{
+				exposure * (0.6f + 0.4f * std::sin(y * 0.1f)),
+				exposure * (0.5f + 0.5f * (float)y / (float)height),
+				exposure * (((x / 16 + y / 16) & 1) ? 1.0f : 0.25f),
+				1.0f
+			};
+			for(uint32_t c = 0; c < 4; ++c)
+				image[((uint64_t)y * width + x) * 4 + c] = DirectX::PackedVector::XMConvertFloatToHalf(color[c]);
+		}
+	}
+	return image;
+}
+
+// Over RGB after Reinhard tone mapping, so errors in bright pixels do not swamp the rest
+float getTestHDRPSNR(const std::vector<uint16_t>& image, const char* blocks, uint32_t width, uint32_t height) {
+	double error = 0.0;
+	for(uint32_t y = 0; y < height; y += 4) {
+		for(uint32_t x = 0; x < width; x += 4, blocks += 16) {
+			uint16_t block[16][3];
+			if(!decodeTestBC6H(blocks, block)) return 0.0f;
+
+			for(uint32_t i = 0; i < 16; ++i) {
+				if(x + i % 4 >= width || y + i / 4 >= height) continue;
+				for(uint32_t c = 0; c < 3; ++c) {
+					const float a = DirectX::PackedVector::XMConvertHalfToFloat(image[((uint64_t)(y + i / 4) * width + x + i % 4) * 4 + c]);
+					const float b = DirectX::PackedVector::XMConvertHalfToFloat(block[i][c]);
+					const double difference = 255.0 * (a / (1.0 + a) - b / (1.0 + b));
+					error += difference * difference;
+				}
+			}
+		}
+	}
+	error /= (double)width * height * 3;
+	return error ? (float)(10.0 * std::log10(255.0 * 255.0 / error)) : INFINITY;
+}
+
+void testBlockCompression() {
+	RIN::ThreadPool threadPool;
+
+	constexpr uint32_t width = 256, height = 256;
+	const std::vector<uint8_t> opaque = makeTestImage(width, height, false);
+	const std::vector<uint8_t> translucent = makeTestImage(width, height, true);
+
+	auto compress = [&](const std::vector<uint8_t>& image, RIN::TEXTURE_FORMAT format, RIN::TEXTURE_FORMAT compressedFormat, uint32_t channelCount) {
+		std::vector<char> blocks(RIN::Texture::getSize(width, height, 1, 1, compressedFormat));
+		RIN::compressTexture(threadPool, format, compressedFormat, width, height, 1, 1, (const char*)image.data(), blocks.data());
+
+		std::vector<uint8_t> decoded = image;
+		if(!decodeTestTexture(compressedFormat, blocks.data(), width, height, decoded)) return 0.0f;
+		return getTestPSNR(image, decoded, channelCount);
+	};
+
+	// Expected around 43 dB for BC1, 49 dB for BC7 with or without alpha
+	const float bc1 = compress(opaque, RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, RIN::TEXTURE_FORMAT::BC1_UNORM, 3);
+	const float bc7 = compress(opaque, RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, RIN::TEXTURE_FORMAT::BC7_UNORM, 3);
+	const float bc7Alpha = compress(translucent, RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, RIN::TEXTURE_FORMAT::BC7_UNORM, 4);
+	std::cout << "BC1 " << bc1 << " dB, BC7 " << bc7 << " dB, BC7 with alpha " << bc7Alpha << " dB" << std::endl;
+
+	// R8 and R8G8 images are the first channels of the RGBA image
+	std::vector<uint8_t> red(width * height), redGreen(width * height * 2);
+	for(uint32_t i = 0; i < width * height; ++i) {
+		red[i] = opaque[i * 4];
+		redGreen[i * 2] = opaque[i * 4];
+		redGreen[i * 2 + 1] = opaque[i * 4 + 1];
+	}
+
+	auto compressChannels = [&](const std::vector<uint8_t>& image, RIN::TEXTURE_FORMAT format, RIN::TEXTURE_FORMAT compressedFormat, uint32_t channelCount) {
+		std::vector<char> blocks(RIN::Texture::getSize(width, height, 1, 1, compressedFormat));
+		RIN::compressTexture(threadPool, format, compressedFormat, width, height, 1, 1, (const char*)image.data(), blocks.data());
+
+		std::vector<uint8_t> decoded = opaque;
+		decodeTestTexture(compressedFormat, blocks.data(), width, height, decoded);
+		return getTestPSNR(opaque, decoded, channelCount);
+	};
+
+	// Expected around 50 dB for both
+	const float bc4 = compressChannels(red, RIN::TEXTURE_FORMAT::R8_UNORM, RIN::TEXTURE_FORMAT::BC4_UNORM, 1);
+	const float bc5 = compressChannels(redGreen, RIN::TEXTURE_FORMAT::R8G8_UNORM, RIN::TEXTURE_FORMAT::BC5_UNORM, 2);
+	std::cout << "BC4 " << bc4 << " dB, BC5 " << bc5 << " dB" << std::endl;
+
+	// Expected around 49 dB
+	const std::vector<uint16_t> hdr = makeTestHDRImage(width, height);
+	std::vector<char> hdrBlocks(RIN::Texture::getSize(width, height, 1, 1, RIN::TEXTURE_FORMAT::BC6H_FLOAT));
+	RIN::compressTexture(threadPool, RIN::TEXTURE_FORMAT::R16B16G16A16_FLOAT, RIN::TEXTURE_FORMAT::BC6H_FLOAT, width, height, 1, 1, (const char*)hdr.data(), hdrBlocks.data());
+	const float bc6h = getTestHDRPSNR(hdr, hdrBlocks.data(), width, height);
+	std::cout << "BC6H " << bc6h << " dB" << std::endl;
+
+	// 32-bit floats are rounded to halves first, so they compress to the same blocks
+	std::vector<float> hdr32(hdr.size());
+	for(size_t i = 0; i < hdr.size(); ++i)
+		hdr32[i] = DirectX::PackedVector::XMConvertHalfToFloat(hdr[i]);
+	std::vector<char> hdr32Blocks(hdrBlocks.size());
+	RIN::compressTexture(threadPool, RIN::TEXTURE_FORMAT::R32G32B32A32_FLOAT, RIN::TEXTURE_FORMAT::BC6H_FLOAT, width, height, 1, 1, (const char*)hdr32.data(), hdr32Blocks.data());
+	std::cout << "BC6H from 32-bit floats: " << (hdr32Blocks == hdrBlocks ? "equal" : "different") << std::endl; // Expected equal
+
+	// Solid blocks, BC7 shares the lowest bit of every channel so it can be off by 1
+	uint8_t solid[16][4];
+	for(uint32_t i = 0; i < 16; ++i) {
+		solid[i][0] = 13;
+		solid[i][1] = 200;
+		solid[i][2] = 77;
+		solid[i][3] = 128;
+	}
+	char block[16];
+	uint8_t decoded[16][4]{};
+	RIN::compressBC7Block(solid, block);
+	bool near = decodeTestBC7(block, decoded);
+	for(uint32_t i = 0; i < 16; ++i)
+		for(uint32_t c = 0; c < 4; ++c)
+			near = near && std::abs((int32_t)decoded[i][c] - (int32_t)solid[i][c]) <= 1;
+	std::cout << "Solid BC7: " << (near ? "near" : "far") << std::endl; // Expected near
+	RIN::compressBC4Block(solid, 1, block);
+	decodeTestBC4(block, 1, decoded);
+	std::cout << "Solid BC4: " << (uint32_t)decoded[0][1] << " " << (uint32_t)decoded[15][1] << std::endl; // Expected 200 200
+
+	// BGRA is swizzled on load
+	std::vector<uint8_t> bgra = translucent;
+	for(size_t i = 0; i < bgra.size(); i += 4)
+		std::swap(bgra[i], bgra[i + 2]);
+	std::vector<char> rgbaBlocks(RIN::Texture::getSize(width, height, 1, 1, RIN::TEXTURE_FORMAT::BC7_UNORM)), bgraBlocks(rgbaBlocks.size());
+	RIN::compressTexture(threadPool, RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, RIN::TEXTURE_FORMAT::BC7_UNORM, width, height, 1, 1, (const char*)translucent.data(), rgbaBlocks.data());
+	RIN::compressTexture(threadPool, RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM, RIN::TEXTURE_FORMAT::BC7_UNORM, width, height, 1, 1, (const char*)bgra.data(), bgraBlocks.data());
+	std::cout << "BGRA: " << (rgbaBlocks == bgraBlocks ? "equal" : "different") << std::endl; // Expected equal
+
+	// A cube with a full mip chain of sizes which are not multiples of 4 must match compressing each subresource on one thread
+	constexpr uint32_t oddWidth = 70, oddHeight = 33, oddMipCount = 7;
+	const std::vector<uint8_t> odd = makeTestImage(oddWidth, oddHeight * 6 * 2, false);
+	std::vector<char> pooled(RIN::Texture::getSize(oddWidth, oddHeight, 6, oddMipCount, RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB));
+	std::vector<char> serial(pooled.size());
+	RIN::compressTexture(threadPool, RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB, RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB, oddWidth, oddHeight, 6, oddMipCount, (const char*)odd.data(), pooled.data());
+
+	const char* source = (const char*)odd.data();
+	char* destination = serial.data();
+	for(uint32_t face = 0; face < 6; ++face) {
+		for(uint32_t mip = 0; mip < oddMipCount; ++mip) {
+			const uint32_t mipWidth = std::max(oddWidth >> mip, 1u), mipHeight = std::max(oddHeight >> mip, 1u);
+			const uint32_t rowCount = RIN::Texture::getRowCount(mipHeight, RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB);
+			RIN::compressBlockRows(RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM_SRGB, RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB, mipWidth, mipHeight, source, 0, rowCount, destination);
+			source += (uint64_t)mipWidth * mipHeight * 4;
+			destination += RIN::Texture::getRowPitch(mipWidth, RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB) * rowCount;
+		}
+	}
+
+	std::vector<uint8_t> oddDecoded(odd.begin(), odd.begin() + oddWidth * oddHeight * 4);
+	const std::vector<uint8_t> oddFirst = oddDecoded;
+	const float oddPSNR = decodeTestTexture(RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB, pooled.data(), oddWidth, oddHeight, oddDecoded) ? getTestPSNR(oddFirst, oddDecoded, 3) : 0.0f;
+
+	// Expected equal, around 49 dB
+	std::cout << "Odd cube: " << (pooled == serial ? "equal" : "different") << ", " << oddPSNR << " dB" << std::endl;
+
+	// Format pairs
+	const bool pairs = RIN::canCompress(RIN::TEXTURE_FORMAT::B8G8R8A8_UNORM_SRGB, RIN::TEXTURE_FORMAT::BC1_UNORM_SRGB) &&
+		!RIN::canCompress(RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, RIN::TEXTURE_FORMAT::BC7_UNORM_SRGB) &&
+		!RIN::canCompress(RIN::TEXTURE_FORMAT::R16_FLOAT, RIN::TEXTURE_FORMAT::BC4_UNORM) &&
+		!RIN::canCompress(RIN::TEXTURE_FORMAT::BC7_UNORM, RIN::TEXTURE_FORMAT::BC7_UNORM) &&
+		RIN::getCompressedFormat(RIN::TEXTURE_FORMAT::R8G8_UNORM) == RIN::TEXTURE_FORMAT::BC5_UNORM &&
+		RIN::getCompressedFormat(RIN::TEXTURE_FORMAT::R16G16_FLOAT) == RIN::TEXTURE_FORMAT::R16G16_FLOAT;
+	std::cout << "Format pairs: " << (pairs ? "valid" : "invalid") << std::endl; // Expected valid
+}
+
+void testBlockCompressionThroughput() {
+	RIN::ThreadPool threadPool;
+
+	constexpr uint32_t width = 1024, height = 1024;
+	const std::vector<uint8_t> image = makeTestImage(width, height, false);
+	const std::vector<uint16_t> hdr = makeTestHDRImage(width, height);
+
+	std::vector<uint8_t> red(width * height), redGreen(width * height * 2);
+	for(uint32_t i = 0; i < width * height; ++i) {
+		red[i] = image[i * 4];
+		redGreen[i * 2] = image[i * 4];
+		redGreen[i * 2 + 1] = image[i * 4 + 1];
+	}
+
+	struct Run {
+		const char* name;
+		RIN::TEXTURE_FORMAT format;
+		RIN::TEXTURE_FORMAT compressedFormat;
+		const char* data;
+	};
+	const Run runs[]{
+		{ "BC1", RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, RIN::TEXTURE_FORMAT::BC1_UNORM, (const char*)image.data() },
+		{ "BC4", RIN::TEXTURE_FORMAT::R8_UNORM, RIN::TEXTURE_FORMAT::BC4_UNORM, (const char*)red.data() },
+		{ "BC5", RIN::TEXTURE_FORMAT::R8G8_UNORM, RIN::TEXTURE_FORMAT::BC5_UNORM, (const char*)redGreen.data() },
+		{ "BC6H", RIN::TEXTURE_FORMAT::R16B16G16A16_FLOAT, RIN::TEXTURE_FORMAT::BC6H_FLOAT, (const char*)hdr.data() },
+		{ "BC7", RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, RIN::TEXTURE_FORMAT::BC7_UNORM, (const char*)image.data() }
+	};
+
+	for(const Run& run : runs) {
+		std::vector<char> blocks(RIN::Texture::getSize(width, height, 1, 1, run.compressedFormat));
+
+		auto start = std::chrono::steady_clock::now();
+		RIN::compressBlockRows(run.format, run.compressedFormat, width, height, run.data, 0, height / 4, blocks.data());
+		std::chrono::duration<float> serialElapsed = std::chrono::steady_clock::now() - start;
+
+		start = std::chrono::steady_clock::now();
+		RIN::compressTexture(threadPool, run.format, run.compressedFormat, width, height, 1, 1, run.data, blocks.data());
+		std::chrono::duration<float> elapsed = std::chrono::steady_clock::now() - start;
+
+		// Expected the thread pool to scale with the number of cores
+		const float megapixels = (float)(width * height) / 1000000.0f;
+		std::cout << run.name << ": " << megapixels / serialElapsed.count() << " MP/s on 1 thread, ";
+		std::cout << megapixels / elapsed.count() << " MP/s on " << threadPool.numThreads << " threads" << std::endl;
+	}
+}
\ No newline at end of file
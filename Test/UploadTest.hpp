@@ -0,0 +1,208 @@
+#pragma once
+
+#include <iostream>
+
+#include <UploadChunker.hpp>
+#include <UploadCoalescer.hpp>
+#include <UploadScheduler.hpp>
+#include <TextureStreamer.hpp>
+
+void testUploadChunkerBuffer() {
+	RIN::UploadChunker chunker(100, 256, 512);
+
+	auto chunks = chunker.chunkBuffer(100);
+	std::cout << chunks.size() << std::endl; // Expected 1
+	chunks = chunker.chunkBuffer(250);
+	std::cout << chunks.size() << std::endl; // Expected 3
+	for(const auto& chunk : chunks)
+		std::cout << chunk.offset << " " << chunk.size << std::endl; // Expected 0 100, 100 100, 200 50
+	chunks = chunker.chunkBuffer(0);
+	std::cout << chunks.size() << std::endl; // Expected 0
+}
+
+void testUploadChunkerTexture() {
+	// 64x64 RGBA8 with 256 byte pitch alignment and 512 byte placement alignment
+	// Full chunk is 64 rows * 256 bytes = 16384 bytes plus 512 bytes of slack
+	RIN::UploadChunker large(1 << 20, 256, 512);
+	auto chunks = large.chunkTexture(RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, 64, 64, 1, 7);
+	std::cout << chunks.size() << std::endl; // Expected 1
+	std::cout << chunks[0].regions.size() << std::endl; // Expected 7
+	for(const auto& region : chunks[0].regions)
+		std::cout << region.subresource << " " << region.uploadOffset % 512 << std::endl; // Expected 0 0, 1 0, ..., 6 0
+
+	// Each chunk holds 16 rows of mip 0
+	RIN::UploadChunker small(16 * 256 + 512, 256, 512);
+	chunks = small.chunkTexture(RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, 64, 64, 1, 1);
+	std::cout << chunks.size() << std::endl; // Expected 4
+	for(const auto& chunk : chunks) {
+		const auto& region = chunk.regions[0];
+		std::cout << region.y << " " << region.rowCount << " " << region.dataOffset << " " << chunk.size << std::endl; // Expected 0 16 0 4608, 16 16 4096 4608, 32 16 8192 4608, 48 16 12288 4608
+	}
+
+	// Block compressed rows cover 4 texel rows
+	chunks = small.chunkTexture(RIN::TEXTURE_FORMAT::BC7_UNORM, 256, 256, 1, 1);
+	std::cout << chunks.size() << std::endl; // Expected 16
+	std::cout << chunks[1].regions[0].y << " " << chunks[1].regions[0].height << std::endl; // Expected 16 16
+
+	// Cube maps are split per face
+	chunks = small.chunkTexture(RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM, 16, 16, 6, 1);
+	std::cout << chunks.size() << std::endl; // Expected 6
+	std::cout << chunks[5].regions[0].subresource << " " << chunks[5].regions[0].dataOffset << std::endl; // Expected 5 5120
+
+	// A single row that doesn't fit fails
+	RIN::UploadChunker tiny(1024, 256, 512);
+	chunks = tiny.chunkTexture(RIN::TEXTURE_FORMAT::R32G32B32A32_FLOAT, 64, 64, 1, 1);
+	std::cout << chunks.size() << std::endl; // Expected 0
+}
+
+void testUploadCoalescer() {
+	RIN::UploadCoalescer coalescer;
+	int bufferA = 0, bufferB = 0;
+
+	// Ten adjacent objects followed by a gap
+	RIN::UploadCoalescer::Run run;
+	for(uint64_t i = 0; i < 10; ++i)
+		if(!run.append(&bufferA, i * 64, 64)) std::cout << "Adjacent object rejected" << std::endl;
+	std::cout << run.offset << " " << run.size << " " << run.requestCount << std::endl; // Expected 0 640 10
+	if(run.append(&bufferA, 704, 64)) std::cout << "Gap accepted" << std::endl;
+	else std::cout << "Gap rejected" << std::endl; // Expected
+	if(run.append(&bufferB, 640, 64)) std::cout << "Other buffer accepted" << std::endl;
+	else std::cout << "Other buffer rejected" << std::endl; // Expected
+	if(run.append(nullptr, 640, 64)) std::cout << "Non-buffer request accepted" << std::endl;
+	else std::cout << "Non-buffer request rejected" << std::endl; // Expected
+	coalescer.record(run);
+
+	run = {};
+	run.append(&bufferA, 704, 64);
+	coalescer.record(run);
+
+	// Empty runs issue no copy
+	coalescer.record({});
+
+	RIN::UploadStats stats = coalescer.getStats();
+	std::cout << stats.copyCount << " " << stats.requestCount << std::endl; // Expected 2 11
+}
+
+// CPU-only model of the upload stream, one asset is visible once its last request is copied
+struct UploadSimRequest {
+	uint32_t asset;
+	uint64_t size;
+	bool last;
+};
+
+void simulateUploadFrame(RIN::UploadScheduler<UploadSimRequest>& scheduler, uint64_t budget, uint64_t frame, uint64_t* visibleFrames) {
+	scheduler.nextFrame();
+
+	while(!scheduler.empty() && scheduler.front().size <= budget) {
+		const UploadSimRequest& request = scheduler.front();
+		budget -= request.size;
+		if(request.last) visibleFrames[request.asset] = frame;
+		scheduler.pop();
+	}
+}
+
+void testUploadScheduler() {
+	// A far asset taking 8 frames is added just before a near asset taking 1
+	for(float nearPriority : { 0.0f, -1.0f }) {
+		RIN::UploadScheduler<UploadSimRequest> scheduler(30);
+		uint64_t visibleFrames[2]{};
+
+		scheduler.beginBatch(nearPriority ? -100.0f : 0.0f);
+		for(uint32_t i = 0; i < 8; ++i)
+			scheduler.push({ 0, 4, i == 7 });
+		scheduler.beginBatch(nearPriority);
+		scheduler.push({ 1, 4, true });
+
+		for(uint64_t frame = 1; !scheduler.empty(); ++frame)
+			simulateUploadFrame(scheduler, 4, frame, visibleFrames);
+
+		std::cout << visibleFrames[1] << " " << visibleFrames[0] << std::endl; // Expected 9 8 in FIFO order, 1 9 by distance
+	}
+
+	// A far asset keeps losing to new near assets until it has waited 3 frames
+	RIN::UploadScheduler<UploadSimRequest> scheduler(3);
+	uint64_t visibleFrames[2]{};
+
+	scheduler.beginBatch(-100.0f);
+	scheduler.push({ 0, 4, true });
+
+	for(uint64_t frame = 1; frame <= 4; ++frame) {
+		scheduler.beginBatch(0.0f);
+		scheduler.push({ 1, 4, true });
+		simulateUploadFrame(scheduler, 4, frame, visibleFrames);
+	}
+
+	std::cout << visibleFrames[0] << std::endl; // Expected 3
+}
+
+void testTextureStreamer() {
+	constexpr RIN::TEXTURE_FORMAT format = RIN::TEXTURE_FORMAT::R8G8B8A8_UNORM;
+
+	// 1024x1024 with mips down to 128x128 always resident
+	const uint64_t fullSize = RIN::TextureStreamer::getSize(format, 1024, 1024, 11, 0);
+	const uint64_t tailSize = RIN::TextureStreamer::getSize(format, 1024, 1024, 11, 3);
+	std::cout << fullSize << " " << tailSize << std::endl; // Expected 5592404 87380
+
+	// Room for one full texture and one tail
+	RIN::TextureStreamer streamer(fullSize + tailSize, 2, 128);
+	std::cout << streamer.getTailMip(format, 1024, 1024, 11) << std::endl; // Expected 3
+	// The 192x12 mip is the last one which is a whole number of blocks
+	std::cout << streamer.getTailMip(format, 1536, 96, 11) << " " << streamer.getTailMip(RIN::TEXTURE_FORMAT::BC7_UNORM, 1536, 96, 11) << std::endl; // Expected 4 3
+	std::cout << RIN::TextureStreamer::getDesiredMip(1024, 1024, 11, 256.0f) << " "
+		<< RIN::TextureStreamer::getDesiredMip(1024, 1024, 11, 2000.0f) << " "
+		<< RIN::TextureStreamer::getDesiredMip(1024, 1024, 11, 0.0f) << std::endl; // Expected 2 0 10
+
+	RIN::TextureStreamer::Entry entries[3]{};
+	for(uint32_t i = 0; i < 2; ++i)
+		entries[i] = { 1024, 1024, 11, format, 3, 3, 3, 0, false, 3 };
+
+	std::vector<RIN::TextureStreamer::Change> changes;
+	auto apply = [&]() {
+		for(const auto& change : changes) {
+			std::cout << change.index << " " << change.mip << std::endl;
+			entries[change.index].residentMip = change.mip;
+			entries[change.index].pending = false;
+		}
+		changes.clear();
+	};
+
+	// The near texture is upgraded, unused entries are ignored
+	entries[0].desiredMip = 0;
+	streamer.update(entries, 3, 1, changes);
+	apply(); // Expected 0 0
+
+	// The first texture is no longer needed, so it is evicted to make room
+	// for the second, which is upgraded once the eviction is applied
+	entries[0].desiredMip = 3;
+	entries[1].desiredMip = 1;
+	streamer.update(entries, 3, 2, changes);
+	apply(); // Expected 0 3
+	streamer.update(entries, 3, 3, changes);
+	apply(); // Expected 1 1
+
+	// Mips which have not been needed for 2 frames are evicted
+	entries[1].desiredMip = 2;
+	streamer.update(entries, 3, 4, changes);
+	apply(); // Expected nothing
+	streamer.update(entries, 3, 5, changes);
+	apply(); // Expected 1 2
+
+	// An upgrade which is still pending counts at its new mip, so the next
+	// update does not admit another one over the budget
+	entries[0] = { 1024, 1024, 11, format, 3, 3, 0, 6, false, 3 };
+	entries[1] = { 1024, 1024, 11, format, 3, 3, 0, 6, false, 3 };
+	streamer.update(entries, 3, 6, changes);
+	const size_t firstChanges = changes.size();
+	changes.clear();
+	streamer.update(entries, 3, 7, changes);
+	std::cout << firstChanges << " " << changes.size() << std::endl; // Expected 1 0
+
+	// An eviction which is still pending does not free its memory yet
+	changes.clear();
+	entries[0] = { 1024, 1024, 11, format, 3, 0, 3, 7, false, 0 };
+	entries[1] = { 1024, 1024, 11, format, 3, 3, 3, 8, false, 3 };
+	streamer.update(entries, 3, 9, changes);
+	entries[1].desiredMip = 0;
+	streamer.update(entries, 3, 10, changes);
+	std::cout << changes.size() << " " << changes[0].index << " " << changes[0].mip << std::endl; // Expected 1 0 3
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 # mesh_export.py
 
 # This script is used for exporting individual meshes
+# The triangles and vertices are written in the order Blender gives them,
+# run the Optimizer tool on the exported files to reorder them for the GPU
+# The Cooker tool writes the same files from glTF and OBJ models without Blender
 # Select the type of mesh to export
 MESH_TYPE_STATIC = 0
 MESH_TYPE_DYNAMIC = 1
@@ -67,20 +70,97 @@ lods = [ "LOD 0", "LOD 1", "LOD 2" ]
 # BLENDWEIGHTS ((uint8)4) - unorm
 
 # File format
+# Magic ("RMSH")
+# Version (uint16)
 # Object type (uint8)
 # LOD count (uint8)
+# Flags (uint32) - 0x1 if the vertices are compressed, 0x2 if the indices are compressed
 # Bounding sphere center (float[3])
 # Bounding sphere radius (float)
 # Vertex counts (uint32 array of LOD count elements)
 # Index counts (uint32 array of LOD count elements)
+# Vertex offsets (uint64 array of LOD count elements)
+# Vertex sizes (uint64 array of LOD count elements)
+# Index offsets (uint64 array of LOD count elements)
+# Index sizes (uint64 array of LOD count elements)
 # Vertices (struct buffer array of LOD count buffers)
 # Indices (uint32 buffer array of LOD count buffers)
+# The offsets are from the start of the file and the sizes are the
+# stored sizes of the buffers, so a loader can read just the LODs it needs
+# The buffers are compressed the same way as Assets/MeshCodec.cpp
+# Set to False to export uncompressed buffers
+compress = True
 
 import bpy
 import struct
 import mathutils
 import math
 
+VERTEX_BLOCK_SIZE = 256
+GROUP_SIZE = 16
+
+# Vertices are delta encoded byte by byte against the previous vertex,
+# zigzag encoded and stored column by column in blocks of vertices,
+# each column is split into groups of 16 bytes which are bit packed
+# to 0, 2, 4 or 8 bits, selected by a 2-bit header per group
+def encode_vertices(vertex_data, stride):
+    out = bytearray()
+    count = len(vertex_data) // stride
+    last = [0] * stride
+    for block_start in range(0, count, VERTEX_BLOCK_SIZE):
+        block_count = min(VERTEX_BLOCK_SIZE, count - block_start)
+        group_count = (block_count + GROUP_SIZE - 1) // GROUP_SIZE
+        for k in range(stride):
+            values = []
+            previous = last[k]
+            for i in range(group_count * GROUP_SIZE):
+                if i < block_count:
+                    value = vertex_data[(block_start + i) * stride + k]
+                    delta = (value - previous) & 0xFF
+                    values.append(((delta << 1) ^ (0xFF if delta & 0x80 else 0)) & 0xFF)
+                    previous = value
+                else:
+                    values.append(0)
+            last[k] = previous
+            
+            headers = bytearray((group_count + 3) // 4)
+            groups = bytearray()
+            for group in range(group_count):
+                group_values = values[group * GROUP_SIZE:(group + 1) * GROUP_SIZE]
+                max_value = max(group_values)
+                if max_value == 0:
+                    mode = 0
+                elif max_value < 4:
+                    mode = 1
+                    for i in range(0, GROUP_SIZE, 4):
+                        groups.append(group_values[i] | group_values[i + 1] << 2 | group_values[i + 2] << 4 | group_values[i + 3] << 6)
+                elif max_value < 16:
+                    mode = 2
+                    for i in range(0, GROUP_SIZE, 2):
+                        groups.append(group_values[i] | group_values[i + 1] << 4)
+                else:
+                    mode = 3
+                    groups += bytes(group_values)
+                headers[group // 4] |= mode << (group % 4 * 2)
+            out += headers
+            out += groups
+    return bytes(out)
+
+# Indices are delta encoded against the previous index, zigzag
+# encoded and stored as variable length integers, 7 bits per byte
+def encode_indices(index_list):
+    out = bytearray()
+    previous = 0
+    for index in index_list:
+        delta = (index - previous) & 0xFFFFFFFF
+        value = ((delta << 1) ^ (0xFFFFFFFF if delta & 0x80000000 else 0)) & 0xFFFFFFFF
+        previous = index
+        while value >= 0x80:
+            out.append(value & 0x7F | 0x80)
+            value >>= 7
+        out.append(value)
+    return bytes(out)
+
 C = bpy.context
 D = bpy.data
 
@@ -342,10 +422,31 @@ if objects_valid:
         bsphere_radius *= bsphere_scale
     
     file = open(D.filepath[:D.filepath.rfind('\\') + 1] + path + C.active_object.name + extension, 'wb')
+    
+    if mesh_type == MESH_TYPE_SKINNED:
+        vertex_size = 36
+    else:
+        vertex_size = 28
+    
+    vertex_buffers = []
+    index_buffers = []
+    for lod_index in range(max_lods):
+        vertex_data = b"".join(vertices[lod_index])
+        index_data = indices[lod_index]
+        if compress:
+            vertex_buffers.append(encode_vertices(vertex_data, vertex_size))
+            index_buffers.append(encode_indices(index_data))
+        else:
+            vertex_buffers.append(vertex_data)
+            index_buffers.append(struct.pack('<' + str(len(index_data)) + 'I', *index_data))
+    
     file.write(struct.pack(
-        '<BBffff',
+        '<4sHBBIffff',
+        b"RMSH",
+        2,
         mesh_type,
         max_lods,
+        0x3 if compress else 0x0,
         bsphere_center.x,
         bsphere_center.y,
         bsphere_center.z,
@@ -355,12 +456,28 @@ if objects_valid:
         file.write(struct.pack('<I', len(vertices[lod_index])))
     for lod_index in range(max_lods):
         file.write(struct.pack('<I', len(indices[lod_index])))
+    
+    offset = 28 + max_lods * 40
+    vertex_offsets = []
+    for buffer in vertex_buffers:
+        vertex_offsets.append(offset)
+        offset += len(buffer)
+    index_offsets = []
+    for buffer in index_buffers:
+        index_offsets.append(offset)
+        offset += len(buffer)
+    for lod_index in range(max_lods):
+        file.write(struct.pack('<Q', vertex_offsets[lod_index]))
+    for lod_index in range(max_lods):
+        file.write(struct.pack('<Q', len(vertex_buffers[lod_index])))
     for lod_index in range(max_lods):
-        for packed_data in vertices[lod_index]:
-            file.write(packed_data)
+        file.write(struct.pack('<Q', index_offsets[lod_index]))
     for lod_index in range(max_lods):
-        for index in indices[lod_index]:
-            file.write(struct.pack('<I', index))
+        file.write(struct.pack('<Q', len(index_buffers[lod_index])))
+    for buffer in vertex_buffers:
+        file.write(buffer)
+    for buffer in index_buffers:
+        file.write(buffer)
     file.close()
     
     print("Finished generating \"" + file.name[file.name.rfind('\\') + 1:] + "\"")